@@ -6,6 +6,17 @@ ADD_CXX_DEBUG_DEFINITIONS("-DOBJEXXFCL_FARRAY_INIT_DEBUG") # Initialize ObjexxFC
 # Make sure expat is compiled as a static library
 ADD_DEFINITIONS("-DXML_STATIC")
 
+# OpenMP for the parallel loops; results do not depend on the number of threads
+IF ( ENABLE_OPENMP )
+    FIND_PACKAGE( OpenMP )
+    IF ( OPENMP_FOUND )
+        ADD_CXX_DEFINITIONS("${OpenMP_CXX_FLAGS}")
+        SET( CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} ${OpenMP_CXX_FLAGS}" )
+    ELSE()
+        MESSAGE( WARNING "ENABLE_OPENMP is ON but OpenMP was not found; parallel loops will run serially" )
+    ENDIF()
+ENDIF()
+
 IF ( MSVC ) # Visual C++ (VS 2013)
 
     # Disabled Warnings: Enable some of these as more serious warnings are addressed
@@ -1,6 +1,7 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <map>
 #include <string>
 
 // ObjexxFCL Headers
@@ -14,6 +15,7 @@
 #include <DataGlobals.hh>
 #include <DataHeatBalance.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <UtilityRoutines.hh>
@@ -54,7 +56,10 @@ namespace ConductionTransferFunctionCalc {
 	// Wisconsin-Madison.
 
 	// OTHER NOTES:
-	// na
+	// CTFs depend only on the processed layer properties, the zone time step and the
+	// source/sink options.  Constructions with the same hash of these share one calculation,
+	// and with the CTF_CACHE environment variable set the CTFs are also kept in a file (see
+	// ShadingCache::RecordFile) for later runs.
 
 	// Using/Aliasing
 	using namespace DataPrecisionGlobals;
@@ -99,6 +104,14 @@ namespace ConductionTransferFunctionCalc {
 	FArray2D< Real64 > s0( 4, 3 ); // Coefficients for the current surface temperature terms
 	Real64 TinyLimit;
 	FArray2D< Real64 > IdenMatrix; // Identity Matrix
+	int NumCTFsCalculated( 0 ); // Constructions whose CTFs were calculated by the state space method
+	int NumCTFsReused( 0 ); // Constructions whose CTFs were copied from an identical construction
+	int NumCTFsFromFile( 0 ); // Constructions whose CTFs were read from the CTF cache file
+
+	namespace {
+		int const CTFStoreVersion( 1 ); // Change whenever the CTF calculation changes its results
+		ShadingCache::RecordFile CTFFile( "EPCTF", { "CTF calculation changed" } );
+	}
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ConductionTransferFunctionCalc
 
@@ -119,6 +132,7 @@ namespace ConductionTransferFunctionCalc {
 		//                      June 2000, RKS, addition of QTFs (both 1- and 2-D solutions for constructions
 		//                       with embedded/internal heat sources/sinks)
 		//                      July 2010-August 2011, RKS, R-value only layer enhancement
+		//                      October 2026, reuse of CTFs of identical constructions and across runs
 		//       RE-ENGINEERED  June 1996, February 1997, August-October 1997, RKS; Nov 1999, LKL
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -139,8 +153,11 @@ namespace ConductionTransferFunctionCalc {
 		//   4. If the answer to 2 is (b), transfer the CTFs for the reverse
 		//      construction to the CTF arrays for this construct (reversing
 		//      the inside and outside terms).
-		//   5. If the answer to 2 is (c), calculate the CTFs using the state
-		//      space method described below.
+		//   5. If the answer to 2 is (c), look up the hash of the processed
+		//      layer properties, time step and source/sink options among the
+		//      constructions already done and in the CTF cache file, and
+		//      otherwise calculate the CTFs using the state space method
+		//      described below.
 		// The state space method of calculating CTFs involves
 		// applying a finite difference grid to a multilayered
 		// building element and performing linear algebra on the
@@ -166,6 +183,8 @@ namespace ConductionTransferFunctionCalc {
 
 		// Using/Aliasing
 		using namespace DataConversions;
+		using namespace ShadingCache;
+		using DataSystemVariables::CTFCacheFileName;
 		using General::RoundSigDigits;
 
 		// Locals
@@ -263,11 +282,28 @@ namespace ConductionTransferFunctionCalc {
 		Real64 Alpha; // thermal diffusivity in m2/s, for local check of properties
 		Real64 DeltaTimestep; // zone timestep in seconds, for local check of properties
 		Real64 ThicknessThreshold; // min thickness consistent with other thermal properties, for local check
+		std::uint64_t StoreKey; // Hash of everything the CTFs of the construction depend on
+		std::map< std::uint64_t, int > StoredConstr; // First construction calculated for each StoreKey
+		bool FromStore; // Set true if the CTFs were copied from an identical construction or the cache file
+		bool Calculated; // Set true if the CTFs were calculated without errors
+		ShadingRecord Record; // Packed CTFs
+
+		// Formats
+		static gio::Fmt fmtA( "(A)" );
 
 		// FLOW:
 		// Subroutine initializations
 		TinyLimit = rTinyValue;
 		DoCTFErrorReport = false;
+		NumCTFsCalculated = 0;
+		NumCTFsReused = 0;
+		NumCTFsFromFile = 0;
+		if ( ! CTFCacheFileName.empty() ) {
+			std::uint64_t Calculation( HashValue( HashSeed, CTFStoreVersion ) );
+			Calculation = HashValue( Calculation, MaxCTFTerms );
+			Calculation = HashValue( Calculation, NumOfPerpendNodes );
+			OpenRecordFile( CTFFile, CTFCacheFileName, { Calculation } );
+		}
 
 		for ( ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum ) { // Begin construction loop ...
 
@@ -289,6 +325,8 @@ namespace ConductionTransferFunctionCalc {
 			Construct( ConstrNum ).UValue = 0.0;
 
 			AdjacentResLayerNum = 0; // Zero this out for each construct
+			FromStore = false;
+			Calculated = false;
 
 			if ( Construct( ConstrNum ).TypeIsWindow ) continue;
 
@@ -559,7 +597,41 @@ namespace ConductionTransferFunctionCalc {
 
 				} // ... end of construct loop (check reversed--Constr)
 
-				if ( ! RevConst ) { // Calculate CTFs (non-reversed constr)
+				if ( ! RevConst ) { // Look for the same CTFs calculated before
+
+					StoreKey = HashValue( HashSeed, TimeStepZone );
+					StoreKey = HashValue( StoreKey, LayersInConstruct );
+					for ( Layer = 1; Layer <= LayersInConstruct; ++Layer ) {
+						StoreKey = HashValue( StoreKey, ResLayer( Layer ) );
+						StoreKey = HashValue( StoreKey, lr( Layer ) );
+						StoreKey = HashValue( StoreKey, dl( Layer ) );
+						StoreKey = HashValue( StoreKey, rk( Layer ) );
+						StoreKey = HashValue( StoreKey, rho( Layer ) );
+						StoreKey = HashValue( StoreKey, cp( Layer ) );
+					}
+					StoreKey = HashValue( StoreKey, Construct( ConstrNum ).SolutionDimensions );
+					StoreKey = HashValue( StoreKey, dyn );
+					StoreKey = HashValue( StoreKey, Construct( ConstrNum ).SourceSinkPresent );
+					if ( Construct( ConstrNum ).SourceSinkPresent ) {
+						StoreKey = HashValue( StoreKey, Construct( ConstrNum ).SourceAfterLayer );
+						StoreKey = HashValue( StoreKey, Construct( ConstrNum ).TempAfterLayer );
+					}
+
+					auto const Stored( StoredConstr.find( StoreKey ) );
+					if ( Stored != StoredConstr.end() ) {
+						PackCTFs( Stored->second, Record );
+						UnpackCTFs( Record, ConstrNum );
+						++NumCTFsReused;
+						FromStore = true;
+					} else if ( GetRecord( CTFFile, StoreKey, Record ) && UnpackCTFs( Record, ConstrNum ) ) { // A record of another size is a miss
+						StoredConstr[ StoreKey ] = ConstrNum;
+						++NumCTFsFromFile;
+						FromStore = true;
+					}
+
+				}
+
+				if ( ! RevConst && ! FromStore ) { // Calculate CTFs (non-reversed constr)
 
 					// Estimate number of nodes each layer of the construct will require
 					// and calculate the nodal spacing from that
@@ -1068,6 +1140,8 @@ namespace ConductionTransferFunctionCalc {
 
 					} // ... end of CTF calculation loop.
 
+					Calculated = CTFConvrg;
+
 				} // ... end of IF block for non-reversed constructs.
 
 			} else { // Construct has only resistive layers (no thermal mass).
@@ -1109,10 +1183,10 @@ namespace ConductionTransferFunctionCalc {
 			// constructions.  This transfer was done earlier in the routine for
 			// reversed constructions.
 
-			if ( ! RevConst ) { // If this is either a new construction or a non-
+			if ( ! RevConst && ! FromStore ) { // If this is either a new construction or a non-
 				// reversed construction, the CTFs must be stored
 				// in the proper arrays.  If this is a reversed
-				// construction, nothing further needs to be done.
+				// construction or the CTFs came from the store, nothing further needs to be done.
 
 				// Copy the CTFs into the storage arrays, converting them back to SI
 				// units in the process.  First the "zero" terms and then the history terms...
@@ -1160,6 +1234,15 @@ namespace ConductionTransferFunctionCalc {
 
 			} // ... end of the reversed construction IF block.
 
+			if ( Calculated ) { // Keep the CTFs for identical constructions in this and later runs
+				++NumCTFsCalculated;
+				StoredConstr[ StoreKey ] = ConstrNum;
+				if ( CTFFile.Status != CacheDisabled ) {
+					PackCTFs( ConstrNum, Record );
+					SaveRecord( CTFFile, StoreKey, Record );
+				}
+			}
+
 			Construct( ConstrNum ).UValue = cnd * CFU;
 
 			if ( allocated( AExp ) ) AExp.deallocate();
@@ -1175,12 +1258,107 @@ namespace ConductionTransferFunctionCalc {
 
 		ReportCTFs( DoCTFErrorReport );
 
+		if ( NumCTFsCalculated + NumCTFsReused + NumCTFsFromFile > 0 ) {
+			gio::write( OutputFileInits, fmtA ) << "! <CTF Store>, Calculated, Reused In Run, Read From Cache File, Hit Rate {%}, Cache Status, Cache File, Records Available, Reason";
+			gio::write( OutputFileInits, fmtA ) << "CTF Store," + RoundSigDigits( NumCTFsCalculated ) + ',' + RoundSigDigits( NumCTFsReused ) + ',' + RoundSigDigits( NumCTFsFromFile ) + ',' + RoundSigDigits( 100.0 * ( NumCTFsReused + NumCTFsFromFile ) / ( NumCTFsCalculated + NumCTFsReused + NumCTFsFromFile ), 1 ) + ',' + cCacheStatus[ CTFFile.Status ] + ',' + CTFFile.FileName + ',' + RoundSigDigits( CTFFile.NumRecordsAvailable ) + ',' + CTFFile.StatusReason;
+		}
+		CloseRecordFile( CTFFile );
+
 		if ( ErrorsFound ) {
 			ShowFatalError( "Program terminated for reasons listed (InitConductionTransferFunctions)" );
 		}
 
 	}
 
+	void
+	PackCTFs(
+		int const ConstrNum, // Construction whose CTFs are stored
+		ShadingCache::ShadingRecord & Record
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Packs the CTFs and QTFs of a construction for the CTF store (see UnpackCTFs).
+
+		auto const & construct( Construct( ConstrNum ) );
+		Record.clear();
+		Record.Ints.push_back( construct.NumHistories );
+		Record.Ints.push_back( construct.NumCTFTerms );
+		Record.Reals.push_back( construct.CTFTimeStep );
+		for ( int HistTerm = 0; HistTerm <= construct.NumCTFTerms; ++HistTerm ) {
+			Record.Reals.push_back( construct.CTFOutside( HistTerm ) );
+			Record.Reals.push_back( construct.CTFCross( HistTerm ) );
+			Record.Reals.push_back( construct.CTFInside( HistTerm ) );
+			Record.Reals.push_back( HistTerm != 0 ? construct.CTFFlux( HistTerm ) : 0.0 ); // CTFFlux has no term 0
+			Record.Reals.push_back( construct.CTFSourceOut( HistTerm ) );
+			Record.Reals.push_back( construct.CTFSourceIn( HistTerm ) );
+			Record.Reals.push_back( construct.CTFTSourceOut( HistTerm ) );
+			Record.Reals.push_back( construct.CTFTSourceIn( HistTerm ) );
+			Record.Reals.push_back( construct.CTFTSourceQ( HistTerm ) );
+			Record.Reals.push_back( construct.CTFTUserOut( HistTerm ) );
+			Record.Reals.push_back( construct.CTFTUserIn( HistTerm ) );
+			Record.Reals.push_back( construct.CTFTUserSource( HistTerm ) );
+		}
+
+	}
+
+	bool
+	UnpackCTFs(
+		ShadingCache::ShadingRecord const & Record,
+		int const ConstrNum // Construction that gets the stored CTFs
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Sets the CTFs and QTFs of a construction from a record packed by PackCTFs.  Returns false,
+		// leaving the construction as it was, if the record does not have the size PackCTFs gives
+		// it or its number of terms does not fit the CTF arrays; the CTFs must then be calculated.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		std::size_t const RealsPerTerm( 12 ); // Reals packed for each CTF term
+
+		if ( Record.Ints.size() != 2u ) return false;
+		int const NumHistories( Record.Ints[ 0 ] );
+		int const NumCTFTerms( Record.Ints[ 1 ] );
+		if ( NumHistories < 1 || NumCTFTerms < 0 || NumCTFTerms > MaxCTFTerms - 1 ) return false;
+		if ( Record.Reals.size() != 1u + RealsPerTerm * ( NumCTFTerms + 1 ) ) return false;
+
+		auto & construct( Construct( ConstrNum ) );
+		construct.NumHistories = NumHistories;
+		construct.NumCTFTerms = NumCTFTerms;
+		construct.CTFTimeStep = Record.Reals[ 0 ];
+		std::size_t Pos( 1 );
+		for ( int HistTerm = 0; HistTerm <= construct.NumCTFTerms; ++HistTerm ) {
+			construct.CTFOutside( HistTerm ) = Record.Reals[ Pos++ ];
+			construct.CTFCross( HistTerm ) = Record.Reals[ Pos++ ];
+			construct.CTFInside( HistTerm ) = Record.Reals[ Pos++ ];
+			if ( HistTerm != 0 ) construct.CTFFlux( HistTerm ) = Record.Reals[ Pos ];
+			++Pos;
+			construct.CTFSourceOut( HistTerm ) = Record.Reals[ Pos++ ];
+			construct.CTFSourceIn( HistTerm ) = Record.Reals[ Pos++ ];
+			construct.CTFTSourceOut( HistTerm ) = Record.Reals[ Pos++ ];
+			construct.CTFTSourceIn( HistTerm ) = Record.Reals[ Pos++ ];
+			construct.CTFTSourceQ( HistTerm ) = Record.Reals[ Pos++ ];
+			construct.CTFTUserOut( HistTerm ) = Record.Reals[ Pos++ ];
+			construct.CTFTUserIn( HistTerm ) = Record.Reals[ Pos++ ];
+			construct.CTFTUserSource( HistTerm ) = Record.Reals[ Pos++ ];
+		}
+		return true;
+
+	}
+
 	void
 	CalculateExponentialMatrix( Real64 & delt ) // Time step of the resulting CTFs
 	{
@@ -8,6 +8,7 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <ShadingCache.hh>
 
 namespace EnergyPlus {
 
@@ -51,6 +52,9 @@ namespace ConductionTransferFunctionCalc {
 	extern FArray2D< Real64 > s0; // Coefficients for the current surface temperature terms
 	extern Real64 TinyLimit;
 	extern FArray2D< Real64 > IdenMatrix; // Identity Matrix
+	extern int NumCTFsCalculated; // Constructions whose CTFs were calculated by the state space method
+	extern int NumCTFsReused; // Constructions whose CTFs were copied from an identical construction
+	extern int NumCTFsFromFile; // Constructions whose CTFs were read from the CTF cache file
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ConductionTransferFunctionCalc
 
@@ -59,6 +63,18 @@ namespace ConductionTransferFunctionCalc {
 	void
 	InitConductionTransferFunctions();
 
+	void
+	PackCTFs(
+		int const ConstrNum, // Construction whose CTFs are stored
+		ShadingCache::ShadingRecord & Record
+	);
+
+	bool
+	UnpackCTFs(
+		ShadingCache::ShadingRecord const & Record,
+		int const ConstrNum // Construction that gets the stored CTFs
+	);
+
 	void
 	CalculateExponentialMatrix( Real64 & delt ); // Time step of the resulting CTFs
 
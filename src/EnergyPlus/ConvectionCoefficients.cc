@@ -2,6 +2,7 @@
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -153,6 +154,7 @@ namespace ConvectionCoefficients {
 	int const InConvFlowRegime_C( 5 ); // central mechanical air
 	int const InConvFlowRegime_D( 6 ); // zone mechanical air
 	int const InConvFlowRegime_E( 7 ); // mixed. mechancial air and bouyancy
+	int const NumIntConvRegimeCases( 8 ); // flow regimes A1 to D, then E after C and E after D, in IntConvDispatch
 
 	//params for reference temperature type
 	int const RefTempMeanAirTemp( 1 );
@@ -181,6 +183,7 @@ namespace ConvectionCoefficients {
 	bool ConvectionGeometryMetaDataSetup( false ); // set to true once geometry meta data are setup
 	Real64 CubeRootOfOverallBuildingVolume( 0.0 ); // building meta data. cube root of the volume of all the zones
 	Real64 RoofLongAxisOutwardAzimuth( 0.0 ); // roof surfaces meta data. outward normal azimuth for longest roof edge
+	bool IntConvDispatchSetup( false ); // set to true once IntConvDispatch is filled in
 
 	// SUBROUTINE SPECIFICATIONS:
 	//PRIVATE ApplyConvectionValue ! internal to GetUserConvectionCoefficients
@@ -193,6 +196,7 @@ namespace ConvectionCoefficients {
 	FArray1D< HcInsideFaceUserCurveStruct > HcInsideUserCurve;
 	FArray1D< HcOutsideFaceUserCurveStruct > HcOutsideUserCurve;
 	RoofGeoCharactisticsStruct RoofGeo;
+	FArray1D< IntConvDispatchStruct > IntConvDispatch; // adaptive inside face classification and model of each surface
 
 	// Functions
 
@@ -263,6 +267,8 @@ namespace ConvectionCoefficients {
 		static bool NodeCheck( true ); // for CeilingDiffuser Zones
 		static bool ActiveSurfaceCheck( true ); // for radiant surfaces in zone
 		static bool MyEnvirnFlag( true );
+		static std::vector< int > AdaptiveSurfs; // surfaces of the zone using the adaptive convection algorithm
+		std::size_t AdaptiveSurf;
 
 		// FLOW:
 		if ( GetUserSuppliedConvectionCoeffs ) {
@@ -345,6 +351,7 @@ namespace ConvectionCoefficients {
 		ZoneLoop1_exit: ;
 		ZoneLoop2: for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
+			AdaptiveSurfs.clear();
 			SurfLoop: for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
 
 				if ( ! Surface( SurfNum ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
@@ -378,7 +385,8 @@ namespace ConvectionCoefficients {
 
 					} else if ( SELECT_CASE_var1 == AdaptiveConvectionAlgorithm ) {
 
-						ManageInsideAdaptiveConvectionAlgo( SurfNum );
+						AdaptiveSurfs.push_back( SurfNum );
+						continue; // with the other adaptive convection surfaces of the zone below
 
 					} else {
 						ShowFatalError( "Unhandled convection coefficient algorithm." );
@@ -404,7 +412,8 @@ namespace ConvectionCoefficients {
 
 					} else if ( SELECT_CASE_var1 == AdaptiveConvectionAlgorithm ) {
 
-						ManageInsideAdaptiveConvectionAlgo( SurfNum );
+						AdaptiveSurfs.push_back( SurfNum );
+						continue; // with the other adaptive convection surfaces of the zone below
 
 					} else if ( ( SELECT_CASE_var1 == CeilingDiffuser ) || ( SELECT_CASE_var1 == TrombeWall ) ) {
 						// Already done above and can't be at individual surface
@@ -427,6 +436,14 @@ namespace ConvectionCoefficients {
 			}
 			SurfLoop_exit: ;
 
+			if ( ! AdaptiveSurfs.empty() ) {
+				ManageInsideAdaptiveConvectionZone( ZoneNum, AdaptiveSurfs );
+				for ( AdaptiveSurf = 0; AdaptiveSurf < AdaptiveSurfs.size(); ++AdaptiveSurf ) {
+					SurfNum = AdaptiveSurfs[ AdaptiveSurf ];
+					if ( Surface( SurfNum ).EMSOverrideIntConvCoef ) HConvIn( SurfNum ) = Surface( SurfNum ).EMSValueForIntConvCoef;
+				}
+			}
+
 			ZoneLoop2_loop: ;
 		}
 		ZoneLoop2_exit: ;
@@ -5355,6 +5372,8 @@ namespace ConvectionCoefficients {
 			}
 		} // zone loop
 
+		IntConvDispatchSetup = false; // radiant surfaces may be classified differently now
+
 	}
 
 	void
@@ -5364,7 +5383,7 @@ namespace ConvectionCoefficients {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Brent Griffith
 		//       DATE WRITTEN   Aug 2010
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, evaluated with ManageInsideAdaptiveConvectionZone
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5372,43 +5391,173 @@ namespace ConvectionCoefficients {
 
 		// METHODOLOGY EMPLOYED:
 		// This routine implements the Adaptive Convection Algorithm developed by IB-M 2000 and IB-M 2002
-		//  - first calls a large routine, DynamicIntConvSurfaceClassification, that has most of the complex logic
-		//  - then calls a straightforward routine that maps the classification to model equation
-		//  - then calls a routine with a large case statement that calls model equations.
+		// for a single surface; InitInteriorConvectionCoeffs does all of the surfaces of a zone at once.
 
 		// REFERENCES:
 		// na
 
-		// USE STATEMENTS:
-		using General::TrimSigDigits;
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static std::vector< int > SurfNums( 1 );
 
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
+		SurfNums[ 0 ] = SurfNum;
+		ManageInsideAdaptiveConvectionZone( Surface( SurfNum ).Zone, SurfNums );
 
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		// na
+	}
 
-		// INTERFACE BLOCK SPECIFICATIONS:
-		// na
+	void
+	ManageInsideAdaptiveConvectionZone(
+		int const ZoneNum, // zone for which coefficients are being calculated
+		std::vector< int > const & SurfNums // surfaces of the zone that use the adaptive convection algorithm
+	)
+	{
 
-		// DERIVED TYPE DEFINITIONS:
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine calculates the interior convection coefficients of the adaptive convection
+		// surfaces of a zone.
+
+		// METHODOLOGY EMPLOYED:
+		// The Adaptive Convection Algorithm developed by IB-M 2000 and IB-M 2002:
+		//  - the flow regime is found once for the zone (DynamicIntConvZoneFlowRegime)
+		//  - the classification and model equation of each surface for that regime come from the tables
+		//    built by SetupIntConvDispatchTables, which leaves only the sign of the surface to air
+		//    temperature difference to look at
+		//  - surfaces are grouped by model equation and each group is evaluated by EvaluateIntHcModelBatch.
+
+		// REFERENCES:
 		// na
 
+		// Using/Aliasing
+		using DataHeatBalSurface::TH;
+		using DataHeatBalFanSys::MAT;
+
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int FlowRegime; // flow regime of the zone
+		int PriorFlowRegime; // forced flow regime of the zone if FlowRegime is mixed
+		int RegimeCase; // column of IntConvDispatch for the flow regime, 0 if not tabulated
+		int Sign; // row of IntConvDispatch for the sign of the temperature difference
+		int Classification;
+		int ModelNum; // group of the model equation, 0 for unknown model equations
+		int SurfNum;
+		Real64 DeltaTemp; // [C] surface minus zone air temperature
+		std::size_t I;
+		std::size_t J;
+		static std::vector< std::vector< int > > ModelSurfs; // surfaces of each model equation group
+		static std::vector< Real64 > Hc;
+
+		if ( ! IntConvDispatchSetup ) SetupIntConvDispatchTables();
+		if ( ModelSurfs.empty() ) ModelSurfs.resize( HcInt_GoldsteinNovoselacCeilingDiffuserFloor - HcInt_UserValue + 2 );
+
+		DynamicIntConvZoneFlowRegime( ZoneNum, FlowRegime, PriorFlowRegime );
+		if ( FlowRegime == InConvFlowRegime_E ) {
+			if ( PriorFlowRegime == InConvFlowRegime_C ) {
+				RegimeCase = NumIntConvRegimeCases - 1;
+			} else if ( PriorFlowRegime == InConvFlowRegime_D ) {
+				RegimeCase = NumIntConvRegimeCases;
+			} else {
+				RegimeCase = 0;
+			}
+		} else if ( ( FlowRegime >= InConvFlowRegime_A1 ) && ( FlowRegime <= InConvFlowRegime_D ) ) {
+			RegimeCase = FlowRegime;
+		} else {
+			RegimeCase = 0;
+		}
 
-		// this next call sets up the flow regime and assigns a classification to surface
-		//  TODO: candidate for rework to do zone level calcs once rather than for each surface
-		DynamicIntConvSurfaceClassification( SurfNum );
+		for ( I = 0; I < SurfNums.size(); ++I ) {
+			SurfNum = SurfNums[ I ];
+			auto & surface( Surface( SurfNum ) );
+			DeltaTemp = TH( SurfNum, 1, 2 ) - MAT( ZoneNum );
+			if ( RegimeCase > 0 ) {
+				Sign = ( DeltaTemp > 0.0 ) ? 3 : ( ( DeltaTemp < 0.0 ) ? 1 : 2 );
+				auto const & dispatch( IntConvDispatch( SurfNum ) );
+				Classification = dispatch.Classification( Sign, RegimeCase );
+				if ( Classification > 0 ) {
+					surface.IntConvClassification = Classification;
+					surface.IntConvHcModelEq = dispatch.HcModelEq( Sign, RegimeCase );
+					if ( surface.IntConvHcModelEq == HcInt_UserCurve ) surface.IntConvHcUserCurveIndex = dispatch.UserCurveNum( Sign, RegimeCase );
+				}
+			} else {
+				Classification = ClassifyIntConvSurface( SurfNum, FlowRegime, PriorFlowRegime, DeltaTemp );
+				if ( Classification > 0 ) {
+					surface.IntConvClassification = Classification;
+					MapIntConvClassificationToHcModels( SurfNum );
+				}
+			}
+			if ( surface.IntConvClassification == 0 ) {
+				ShowSevereError( "DynamicIntConvSurfaceClassification: failed to resolve Hc model for surface named " + surface.Name );
+			}
+
+			ModelNum = surface.IntConvHcModelEq - HcInt_UserValue + 1;
+			if ( ( ModelNum < 1 ) || ( ModelNum >= int( ModelSurfs.size() ) ) ) ModelNum = 0;
+			ModelSurfs[ ModelNum ].push_back( SurfNum );
+		}
 
-		// simple worker routine takes surface classification and fills in model to use (IntConvHcModelEq) for that surface
-		MapIntConvClassificationToHcModels( SurfNum );
+		for ( ModelNum = 0; ModelNum < int( ModelSurfs.size() ); ++ModelNum ) {
+			auto & modelSurfs( ModelSurfs[ ModelNum ] );
+			if ( modelSurfs.empty() ) continue;
+			EvaluateIntHcModelBatch( ZoneNum, ( ModelNum > 0 ) ? ModelNum + HcInt_UserValue - 1 : 0, modelSurfs, Hc );
+			for ( J = 0; J < modelSurfs.size(); ++J ) {
+				HConvIn( modelSurfs[ J ] ) = Hc[ J ];
+			}
+			modelSurfs.clear();
+		}
+
+	}
+
+	void
+	SetupIntConvDispatchTables()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Fill in IntConvDispatch, the adaptive inside face classification and model equation of each
+		// surface for every flow regime.
+
+		// METHODOLOGY EMPLOYED:
+		// ClassifyIntConvSurface looks at the class, tilt and radiant flags of the surface, which do not
+		// change, and only at the sign of the temperature difference, so all of its results can be found
+		// here along with the model equations they map to.
+
+		// REFERENCES:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SurfNum;
+		int RegimeCase;
+		int Sign;
+		int Classification;
+		int HcModelEq;
+		int UserCurveNum;
+
+		IntConvDispatch.deallocate();
+		IntConvDispatch.allocate( TotSurfaces );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( ! Surface( SurfNum ).HeatTransSurf ) continue;
+			auto & dispatch( IntConvDispatch( SurfNum ) );
+			for ( RegimeCase = 1; RegimeCase <= NumIntConvRegimeCases; ++RegimeCase ) {
+				for ( Sign = 1; Sign <= 3; ++Sign ) {
+					Classification = ClassifyIntConvSurface( SurfNum, min( RegimeCase, InConvFlowRegime_E ), ( RegimeCase == NumIntConvRegimeCases ) ? InConvFlowRegime_D : InConvFlowRegime_C, Real64( Sign - 2 ) );
+					HcModelEq = 0;
+					UserCurveNum = 0;
+					if ( Classification > 0 ) GetIntConvClassHcModel( SurfNum, Classification, HcModelEq, UserCurveNum );
+					dispatch.Classification( Sign, RegimeCase ) = Classification;
+					dispatch.HcModelEq( Sign, RegimeCase ) = HcModelEq;
+					dispatch.UserCurveNum( Sign, RegimeCase ) = UserCurveNum;
+				}
+			}
+		}
+		IntConvDispatchSetup = true;
 
-		EvaluateIntHcModels( SurfNum, Surface( SurfNum ).IntConvHcModelEq, HConvIn( SurfNum ) );
-		//if ( std::isnan( HConvIn( SurfNum ) ) ) { // Use IEEE_IS_NAN when GFortran supports it
-			//// throw Error
-			//ShowSevereError( "Inside convection coefficient is out of bound = " + Surface( SurfNum ).Name );
-			//ShowFatalError( "Inside convection coefficient model number = " + TrimSigDigits( Surface( SurfNum ).IntConvHcModelEq ) );
-		//}
 	}
 
 	void
@@ -5469,15 +5618,50 @@ namespace ConvectionCoefficients {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Brent Griffith
 		//       DATE WRITTEN   Aug 2010
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, evaluated as a batch of one surface
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// central case statement for calling inside convection models
 
 		// METHODOLOGY EMPLOYED:
-		//  - fills value for Hc by calling the appropriate convection model, usually as a function.
-		//     preperation of argument values for the function calls is contained in each Case block (repeats)
+		// see EvaluateIntHcModelBatch
+
+		// REFERENCES:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static std::vector< int > SurfNums( 1 );
+		static std::vector< Real64 > HcBatch( 1 );
+
+		SurfNums[ 0 ] = SurfNum;
+		EvaluateIntHcModelBatch( Surface( SurfNum ).Zone, ConvModelEquationNum, SurfNums, HcBatch );
+		Hc = HcBatch[ 0 ];
+
+	}
+
+	void
+	EvaluateIntHcModelBatch(
+		int const ZoneNum, // zone of all of the surfaces
+		int const ConvModelEquationNum, // model used for all of the surfaces
+		std::vector< int > const & SurfNums, // surfaces to evaluate
+		std::vector< Real64 > & Hc // calculated Hc value of each surface
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Brent Griffith
+		//       DATE WRITTEN   Aug 2010
+		//       MODIFIED       October 2026, evaluates a batch of surfaces of one zone with the same model
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// central case statement for calling inside convection models
+
+		// METHODOLOGY EMPLOYED:
+		//  - the zone air system values used by the ceiling diffuser and mixed regime models are found once
+		//     for the batch, then the case statement picks one loop that calls the model for every surface.
+		//     The loops over the temperature difference only models have no branches, so they can be vectorized.
 		//  - also updates the reference air temperature type for use in the surface heat balance calcs
 
 		// REFERENCES:
@@ -5505,128 +5689,42 @@ namespace ConvectionCoefficients {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		Real64 SupplyAirTemp;
-		Real64 AirChangeRate;
-		int ZoneNum; // zone associated with inside face of surface
+		Real64 SupplyAirTemp( 0.0 );
+		Real64 AirChangeRate( 0.0 );
 		int ZoneNode; // the system node for the zone, node index
 		int EquipNum;
 		Real64 SumMdotTemp;
 		Real64 SumMdot;
 		Real64 AirDensity;
-		Real64 AirSystemVolFlowRate;
-		int thisZoneInletNode;
-		Real64 tmpHc;
+		Real64 AirSystemVolFlowRate( 0.0 );
+		int thisZoneInletNode( 0 );
 		Real64 ZoneMult; // local product of zone multiplier and zonelist multipler
+		int TAirRef( ZoneMeanAirTemp ); // reference air temperature of all of the surfaces, 0 if set by the model
+		std::size_t const NumSurfs( SurfNums.size() );
+		std::size_t I;
+		static std::vector< Real64 > DeltaTemp; // surface minus zone mean air temperature
+
+		Hc.assign( NumSurfs, 0.0 );
+		DeltaTemp.resize( NumSurfs );
+		for ( I = 0; I < NumSurfs; ++I ) {
+			DeltaTemp[ I ] = TH( SurfNums[ I ], 1, 2 ) - MAT( ZoneNum );
+		}
 
-		tmpHc = 0.0;
-		//now call appropriate function to calculate Hc
-		{ auto const SELECT_CASE_var( ConvModelEquationNum );
-
-		if ( SELECT_CASE_var == HcInt_UserCurve ) {
-			CalcUserDefinedInsideHcModel( SurfNum, Surface( SurfNum ).IntConvHcUserCurveIndex, tmpHc );
-		} else if ( SELECT_CASE_var == HcInt_ASHRAEVerticalWall ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcASHRAEVerticalWall( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ) );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_WaltonUnstableHorizontalOrTilt ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcWaltonUnstableHorizontalOrTilt( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).CosTilt ); //TODO verify CosTilt in vs out
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_WaltonStableHorizontalOrTilt ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcWaltonStableHorizontalOrTilt( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).CosTilt ); //TODO verify CosTilt in vs out
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_FisherPedersenCeilDiffuserFloor ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
-			if ( ZoneNode > 0 ) {
-				ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
-				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Node( ZoneNode ).Temp, PsyWFnTdpPb( Node( ZoneNode ).Temp, OutBaroPress ) );
-				AirChangeRate = ( Node( ZoneNode ).MassFlowRate * SecInHour ) / ( AirDensity * Zone( ZoneNum ).Volume * ZoneMult );
-				AirChangeRate = min( AirChangeRate, MaxACH );
-				AirChangeRate = max( AirChangeRate, 0.0 );
-				Surface( SurfNum ).TAirRef = ZoneSupplyAirTemp;
-			} else {
-				AirChangeRate = 0.0;
-				Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-			}
-			tmpHc = CalcFisherPedersenCeilDiffuserFloor( AirChangeRate );
-
-		} else if ( SELECT_CASE_var == HcInt_FisherPedersenCeilDiffuserCeiling ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
+		// zone air system values, the same for every surface of the zone
+		ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
+		if ( ( ConvModelEquationNum == HcInt_FisherPedersenCeilDiffuserFloor ) || ( ConvModelEquationNum == HcInt_FisherPedersenCeilDiffuserCeiling ) || ( ConvModelEquationNum == HcInt_FisherPedersenCeilDiffuserWalls ) ) {
 			if ( ZoneNode > 0 ) {
 				ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
 				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Node( ZoneNode ).Temp, PsyWFnTdpPb( Node( ZoneNode ).Temp, OutBaroPress ) );
 				AirChangeRate = ( Node( ZoneNode ).MassFlowRate * SecInHour ) / ( AirDensity * Zone( ZoneNum ).Volume * ZoneMult );
 				AirChangeRate = min( AirChangeRate, MaxACH );
 				AirChangeRate = max( AirChangeRate, 0.0 );
-				Surface( SurfNum ).TAirRef = ZoneSupplyAirTemp;
+				TAirRef = ZoneSupplyAirTemp;
 			} else {
 				AirChangeRate = 0.0;
-				Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
+				TAirRef = ZoneMeanAirTemp;
 			}
-			tmpHc = CalcFisherPedersenCeilDiffuserCeiling( AirChangeRate );
-
-		} else if ( SELECT_CASE_var == HcInt_FisherPedersenCeilDiffuserWalls ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
-			if ( ZoneNode > 0 ) {
-				ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
-				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Node( ZoneNode ).Temp, PsyWFnTdpPb( Node( ZoneNode ).Temp, OutBaroPress ) );
-				AirChangeRate = ( Node( ZoneNode ).MassFlowRate * SecInHour ) / ( AirDensity * Zone( ZoneNum ).Volume * ZoneMult );
-				AirChangeRate = min( AirChangeRate, MaxACH );
-				AirChangeRate = max( AirChangeRate, 0.0 );
-				Surface( SurfNum ).TAirRef = ZoneSupplyAirTemp;
-			} else {
-				AirChangeRate = 0.0;
-				Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-			}
-			tmpHc = CalcFisherPedersenCeilDiffuserWalls( AirChangeRate );
-
-		} else if ( SELECT_CASE_var == HcInt_AlamdariHammondStableHorizontal ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcAlamdariHammondStableHorizontal( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).IntConvZoneHorizHydrDiam, SurfNum );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_AlamdariHammondVerticalWall ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcAlamdariHammondVerticalWall( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).IntConvZoneWallHeight, SurfNum );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_AlamdariHammondUnstableHorizontal ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcAlamdariHammondUnstableHorizontal( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).IntConvZoneHorizHydrDiam, SurfNum );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_KhalifaEq3WallAwayFromHeat ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcKhalifaEq3WallAwayFromHeat( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ) );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_KhalifaEq4CeilingAwayFromHeat ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcKhalifaEq4CeilingAwayFromHeat( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ) );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_KhalifaEq5WallNearHeat ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcKhalifaEq5WallsNearHeat( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ) );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_KhalifaEq6NonHeatedWalls ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcKhalifaEq6NonHeatedWalls( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ) );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_KhalifaEq7Ceiling ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcKhalifaEq7Ceiling( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ) );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_AwbiHattonHeatedFloor ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcAwbiHattonHeatedFloor( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).IntConvZoneHorizHydrDiam );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_AwbiHattonHeatedWall ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcAwbiHattonHeatedWall( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).IntConvZoneHorizHydrDiam );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_BeausoleilMorrisonMixedAssistingWall ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
+		} else if ( ( ConvModelEquationNum == HcInt_BeausoleilMorrisonMixedAssistingWall ) || ( ConvModelEquationNum == HcInt_BeausoleilMorrisonMixedOppossingWall ) || ( ConvModelEquationNum == HcInt_BeausoleilMorrisonMixedStableCeiling ) || ( ConvModelEquationNum == HcInt_BeausoleilMorrisonMixedUnstableCeiling ) || ( ConvModelEquationNum == HcInt_BeausoleilMorrisonMixedStableFloor ) || ( ConvModelEquationNum == HcInt_BeausoleilMorrisonMixedUnstableFloor ) ) {
 			if ( ZoneNode > 0 ) {
 				ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
 				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Node( ZoneNode ).Temp, PsyWFnTdpPb( Node( ZoneNode ).Temp, OutBaroPress ) );
@@ -5655,235 +5753,145 @@ namespace ConvectionCoefficients {
 				AirChangeRate = 0.0;
 				SupplyAirTemp = Node( ZoneNode ).Temp;
 			}
-			tmpHc = CalcBeausoleilMorrisonMixedAssistedWall( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).IntConvZoneWallHeight, TH( SurfNum, 1, 2 ), SupplyAirTemp, AirChangeRate, ZoneNum );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
-		} else if ( SELECT_CASE_var == HcInt_BeausoleilMorrisonMixedOppossingWall ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
+		} else if ( ( ConvModelEquationNum == HcInt_GoldsteinNovoselacCeilingDiffuserWindow ) || ( ConvModelEquationNum == HcInt_GoldsteinNovoselacCeilingDiffuserWalls ) || ( ConvModelEquationNum == HcInt_GoldsteinNovoselacCeilingDiffuserFloor ) ) {
 			if ( ZoneNode > 0 ) {
 				ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
 				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Node( ZoneNode ).Temp, PsyWFnTdpPb( Node( ZoneNode ).Temp, OutBaroPress ) );
-				AirChangeRate = ( Node( ZoneNode ).MassFlowRate * SecInHour ) / ( AirDensity * Zone( ZoneNum ).Volume * ZoneMult );
-				SumMdotTemp = 0.0;
-				SumMdot = 0.0;
-				for ( EquipNum = 1; EquipNum <= ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).NumOfEquipTypes; ++EquipNum ) {
-					if ( ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).NumOutlets > 0 ) {
-						thisZoneInletNode = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).OutletNodeNums( 1 );
-						if ( ( thisZoneInletNode > 0 ) && ( Node( thisZoneInletNode ).MassFlowRate > 0.0 ) ) {
-							SumMdotTemp += Node( thisZoneInletNode ).MassFlowRate * Node( thisZoneInletNode ).Temp;
-							SumMdot += Node( thisZoneInletNode ).MassFlowRate;
-						}
-					}
-				}
-				if ( SumMdot > 0.0 ) {
-					SupplyAirTemp = SumMdotTemp / SumMdot; // mass flow weighted inlet temperature
-				} else {
-					if ( thisZoneInletNode > 0 ) {
-						SupplyAirTemp = Node( thisZoneInletNode ).Temp;
-					} else {
-						SupplyAirTemp = Node( ZoneNode ).Temp;
-					}
-				}
+				AirSystemVolFlowRate = Node( ZoneNode ).MassFlowRate / ( AirDensity * ZoneMult );
+				TAirRef = ZoneSupplyAirTemp;
 			} else {
-				AirChangeRate = 0.0;
-				SupplyAirTemp = Node( ZoneNode ).Temp;
+				AirSystemVolFlowRate = 0.0;
+				TAirRef = ZoneMeanAirTemp;
 			}
+		}
 
-			tmpHc = CalcBeausoleilMorrisonMixedOpposingWall( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).IntConvZoneWallHeight, TH( SurfNum, 1, 2 ), SupplyAirTemp, AirChangeRate, ZoneNum );
+		//now call appropriate function to calculate Hc
+		{ auto const SELECT_CASE_var( ConvModelEquationNum );
 
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
+		if ( SELECT_CASE_var == HcInt_UserCurve ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				CalcUserDefinedInsideHcModel( SurfNums[ I ], Surface( SurfNums[ I ] ).IntConvHcUserCurveIndex, Hc[ I ] );
+			}
+			TAirRef = 0;
+		} else if ( SELECT_CASE_var == HcInt_ASHRAEVerticalWall ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcASHRAEVerticalWall( DeltaTemp[ I ] );
+			}
+		} else if ( SELECT_CASE_var == HcInt_WaltonUnstableHorizontalOrTilt ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcWaltonUnstableHorizontalOrTilt( DeltaTemp[ I ], Surface( SurfNums[ I ] ).CosTilt ); //TODO verify CosTilt in vs out
+			}
+		} else if ( SELECT_CASE_var == HcInt_WaltonStableHorizontalOrTilt ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcWaltonStableHorizontalOrTilt( DeltaTemp[ I ], Surface( SurfNums[ I ] ).CosTilt ); //TODO verify CosTilt in vs out
+			}
+		} else if ( SELECT_CASE_var == HcInt_FisherPedersenCeilDiffuserFloor ) {
+			Hc.assign( NumSurfs, CalcFisherPedersenCeilDiffuserFloor( AirChangeRate ) );
+		} else if ( SELECT_CASE_var == HcInt_FisherPedersenCeilDiffuserCeiling ) {
+			Hc.assign( NumSurfs, CalcFisherPedersenCeilDiffuserCeiling( AirChangeRate ) );
+		} else if ( SELECT_CASE_var == HcInt_FisherPedersenCeilDiffuserWalls ) {
+			Hc.assign( NumSurfs, CalcFisherPedersenCeilDiffuserWalls( AirChangeRate ) );
+		} else if ( SELECT_CASE_var == HcInt_AlamdariHammondStableHorizontal ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcAlamdariHammondStableHorizontal( DeltaTemp[ I ], Surface( SurfNums[ I ] ).IntConvZoneHorizHydrDiam, SurfNums[ I ] );
+			}
+		} else if ( SELECT_CASE_var == HcInt_AlamdariHammondVerticalWall ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcAlamdariHammondVerticalWall( DeltaTemp[ I ], Surface( SurfNums[ I ] ).IntConvZoneWallHeight, SurfNums[ I ] );
+			}
+		} else if ( SELECT_CASE_var == HcInt_AlamdariHammondUnstableHorizontal ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcAlamdariHammondUnstableHorizontal( DeltaTemp[ I ], Surface( SurfNums[ I ] ).IntConvZoneHorizHydrDiam, SurfNums[ I ] );
+			}
+		} else if ( SELECT_CASE_var == HcInt_KhalifaEq3WallAwayFromHeat ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcKhalifaEq3WallAwayFromHeat( DeltaTemp[ I ] );
+			}
+		} else if ( SELECT_CASE_var == HcInt_KhalifaEq4CeilingAwayFromHeat ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcKhalifaEq4CeilingAwayFromHeat( DeltaTemp[ I ] );
+			}
+		} else if ( SELECT_CASE_var == HcInt_KhalifaEq5WallNearHeat ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcKhalifaEq5WallsNearHeat( DeltaTemp[ I ] );
+			}
+		} else if ( SELECT_CASE_var == HcInt_KhalifaEq6NonHeatedWalls ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcKhalifaEq6NonHeatedWalls( DeltaTemp[ I ] );
+			}
+		} else if ( SELECT_CASE_var == HcInt_KhalifaEq7Ceiling ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcKhalifaEq7Ceiling( DeltaTemp[ I ] );
+			}
+		} else if ( SELECT_CASE_var == HcInt_AwbiHattonHeatedFloor ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcAwbiHattonHeatedFloor( DeltaTemp[ I ], Surface( SurfNums[ I ] ).IntConvZoneHorizHydrDiam );
+			}
+		} else if ( SELECT_CASE_var == HcInt_AwbiHattonHeatedWall ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcAwbiHattonHeatedWall( DeltaTemp[ I ], Surface( SurfNums[ I ] ).IntConvZoneHorizHydrDiam );
+			}
+		} else if ( SELECT_CASE_var == HcInt_BeausoleilMorrisonMixedAssistingWall ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcBeausoleilMorrisonMixedAssistedWall( DeltaTemp[ I ], Surface( SurfNums[ I ] ).IntConvZoneWallHeight, TH( SurfNums[ I ], 1, 2 ), SupplyAirTemp, AirChangeRate, ZoneNum );
+			}
+		} else if ( SELECT_CASE_var == HcInt_BeausoleilMorrisonMixedOppossingWall ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcBeausoleilMorrisonMixedOpposingWall( DeltaTemp[ I ], Surface( SurfNums[ I ] ).IntConvZoneWallHeight, TH( SurfNums[ I ], 1, 2 ), SupplyAirTemp, AirChangeRate, ZoneNum );
+			}
 		} else if ( SELECT_CASE_var == HcInt_BeausoleilMorrisonMixedStableCeiling ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
-			if ( ZoneNode > 0 ) {
-				ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
-				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Node( ZoneNode ).Temp, PsyWFnTdpPb( Node( ZoneNode ).Temp, OutBaroPress ) );
-				AirChangeRate = ( Node( ZoneNode ).MassFlowRate * SecInHour ) / ( AirDensity * Zone( ZoneNum ).Volume * ZoneMult );
-				SumMdotTemp = 0.0;
-				SumMdot = 0.0;
-				for ( EquipNum = 1; EquipNum <= ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).NumOfEquipTypes; ++EquipNum ) {
-					if ( ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).NumOutlets > 0 ) {
-						thisZoneInletNode = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).OutletNodeNums( 1 );
-						if ( ( thisZoneInletNode > 0 ) && ( Node( thisZoneInletNode ).MassFlowRate > 0.0 ) ) {
-							SumMdotTemp += Node( thisZoneInletNode ).MassFlowRate * Node( thisZoneInletNode ).Temp;
-							SumMdot += Node( thisZoneInletNode ).MassFlowRate;
-						}
-					}
-				}
-				if ( SumMdot > 0.0 ) {
-					SupplyAirTemp = SumMdotTemp / SumMdot; // mass flow weighted inlet temperature
-				} else {
-					if ( thisZoneInletNode > 0 ) {
-						SupplyAirTemp = Node( thisZoneInletNode ).Temp;
-					} else {
-						SupplyAirTemp = Node( ZoneNode ).Temp;
-					}
-				}
-			} else {
-				AirChangeRate = 0.0;
-				SupplyAirTemp = Node( ZoneNode ).Temp;
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcBeausoleilMorrisonMixedStableCeiling( DeltaTemp[ I ], Surface( SurfNums[ I ] ).IntConvZoneHorizHydrDiam, TH( SurfNums[ I ], 1, 2 ), SupplyAirTemp, AirChangeRate, ZoneNum );
 			}
-			tmpHc = CalcBeausoleilMorrisonMixedStableCeiling( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).IntConvZoneHorizHydrDiam, TH( SurfNum, 1, 2 ), SupplyAirTemp, AirChangeRate, ZoneNum );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
 		} else if ( SELECT_CASE_var == HcInt_BeausoleilMorrisonMixedUnstableCeiling ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
-			if ( ZoneNode > 0 ) {
-				ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
-				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Node( ZoneNode ).Temp, PsyWFnTdpPb( Node( ZoneNode ).Temp, OutBaroPress ) );
-				AirChangeRate = ( Node( ZoneNode ).MassFlowRate * SecInHour ) / ( AirDensity * Zone( ZoneNum ).Volume * ZoneMult );
-				SumMdotTemp = 0.0;
-				SumMdot = 0.0;
-				for ( EquipNum = 1; EquipNum <= ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).NumOfEquipTypes; ++EquipNum ) {
-					if ( ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).NumOutlets > 0 ) {
-						thisZoneInletNode = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).OutletNodeNums( 1 );
-						if ( ( thisZoneInletNode > 0 ) && ( Node( thisZoneInletNode ).MassFlowRate > 0.0 ) ) {
-							SumMdotTemp += Node( thisZoneInletNode ).MassFlowRate * Node( thisZoneInletNode ).Temp;
-							SumMdot += Node( thisZoneInletNode ).MassFlowRate;
-						}
-					}
-				}
-				if ( SumMdot > 0.0 ) {
-					SupplyAirTemp = SumMdotTemp / SumMdot; // mass flow weighted inlet temperature
-				} else {
-					if ( thisZoneInletNode > 0 ) {
-						SupplyAirTemp = Node( thisZoneInletNode ).Temp;
-					} else {
-						SupplyAirTemp = Node( ZoneNode ).Temp;
-					}
-				}
-			} else {
-				AirChangeRate = 0.0;
-				SupplyAirTemp = Node( ZoneNode ).Temp;
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcBeausoleilMorrisonMixedUnstableCeiling( DeltaTemp[ I ], Surface( SurfNums[ I ] ).IntConvZoneHorizHydrDiam, TH( SurfNums[ I ], 1, 2 ), SupplyAirTemp, AirChangeRate, ZoneNum );
 			}
-			tmpHc = CalcBeausoleilMorrisonMixedUnstableCeiling( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).IntConvZoneHorizHydrDiam, TH( SurfNum, 1, 2 ), SupplyAirTemp, AirChangeRate, ZoneNum );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
 		} else if ( SELECT_CASE_var == HcInt_BeausoleilMorrisonMixedStableFloor ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
-			if ( ZoneNode > 0 ) {
-				ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
-				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Node( ZoneNode ).Temp, PsyWFnTdpPb( Node( ZoneNode ).Temp, OutBaroPress ) );
-				AirChangeRate = ( Node( ZoneNode ).MassFlowRate * SecInHour ) / ( AirDensity * Zone( ZoneNum ).Volume * ZoneMult );
-				SumMdotTemp = 0.0;
-				SumMdot = 0.0;
-				for ( EquipNum = 1; EquipNum <= ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).NumOfEquipTypes; ++EquipNum ) {
-					if ( ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).NumOutlets > 0 ) {
-						thisZoneInletNode = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).OutletNodeNums( 1 );
-						if ( ( thisZoneInletNode > 0 ) && ( Node( thisZoneInletNode ).MassFlowRate > 0.0 ) ) {
-							SumMdotTemp += Node( thisZoneInletNode ).MassFlowRate * Node( thisZoneInletNode ).Temp;
-							SumMdot += Node( thisZoneInletNode ).MassFlowRate;
-						}
-					}
-				}
-				if ( SumMdot > 0.0 ) {
-					SupplyAirTemp = SumMdotTemp / SumMdot; // mass flow weighted inlet temperature
-				} else {
-					if ( thisZoneInletNode > 0 ) {
-						SupplyAirTemp = Node( thisZoneInletNode ).Temp;
-					} else {
-						SupplyAirTemp = Node( ZoneNode ).Temp;
-					}
-				}
-			} else {
-				AirChangeRate = 0.0;
-				SupplyAirTemp = Node( ZoneNode ).Temp;
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcBeausoleilMorrisonMixedStableFloor( DeltaTemp[ I ], Surface( SurfNums[ I ] ).IntConvZoneHorizHydrDiam, TH( SurfNums[ I ], 1, 2 ), SupplyAirTemp, AirChangeRate, ZoneNum );
 			}
-			tmpHc = CalcBeausoleilMorrisonMixedStableFloor( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).IntConvZoneHorizHydrDiam, TH( SurfNum, 1, 2 ), SupplyAirTemp, AirChangeRate, ZoneNum );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
 		} else if ( SELECT_CASE_var == HcInt_BeausoleilMorrisonMixedUnstableFloor ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
-			if ( ZoneNode > 0.0 ) {
-				ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
-				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Node( ZoneNode ).Temp, PsyWFnTdpPb( Node( ZoneNode ).Temp, OutBaroPress ) );
-				AirChangeRate = ( Node( ZoneNode ).MassFlowRate * SecInHour ) / ( AirDensity * Zone( ZoneNum ).Volume * ZoneMult );
-				SumMdotTemp = 0.0;
-				SumMdot = 0.0;
-				for ( EquipNum = 1; EquipNum <= ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).NumOfEquipTypes; ++EquipNum ) {
-					if ( ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).NumOutlets > 0 ) {
-						thisZoneInletNode = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).OutletNodeNums( 1 );
-						if ( ( thisZoneInletNode > 0 ) && ( Node( thisZoneInletNode ).MassFlowRate > 0.0 ) ) {
-							SumMdotTemp += Node( thisZoneInletNode ).MassFlowRate * Node( thisZoneInletNode ).Temp;
-							SumMdot += Node( thisZoneInletNode ).MassFlowRate;
-						}
-					}
-				}
-				if ( SumMdot > 0.0 ) {
-					SupplyAirTemp = SumMdotTemp / SumMdot; // mass flow weighted inlet temperature
-				} else {
-					if ( thisZoneInletNode > 0 ) {
-						SupplyAirTemp = Node( thisZoneInletNode ).Temp;
-					} else {
-						SupplyAirTemp = Node( ZoneNode ).Temp;
-					}
-				}
-			} else {
-				AirChangeRate = 0.0;
-				SupplyAirTemp = Node( ZoneNode ).Temp;
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcBeausoleilMorrisonMixedUnstableFloor( DeltaTemp[ I ], Surface( SurfNums[ I ] ).IntConvZoneHorizHydrDiam, TH( SurfNums[ I ], 1, 2 ), SupplyAirTemp, AirChangeRate, ZoneNum );
 			}
-			tmpHc = CalcBeausoleilMorrisonMixedUnstableFloor( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).IntConvZoneHorizHydrDiam, TH( SurfNum, 1, 2 ), SupplyAirTemp, AirChangeRate, ZoneNum );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
 		} else if ( SELECT_CASE_var == HcInt_FohannoPolidoriVerticalWall ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcFohannoPolidoriVerticalWall( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ), Surface( SurfNum ).IntConvZoneWallHeight, TH( SurfNum, 1, 2 ), -QdotConvInRepPerArea( SurfNum ), SurfNum );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcFohannoPolidoriVerticalWall( DeltaTemp[ I ], Surface( SurfNums[ I ] ).IntConvZoneWallHeight, TH( SurfNums[ I ], 1, 2 ), -QdotConvInRepPerArea( SurfNums[ I ] ), SurfNums[ I ] );
+			}
 		} else if ( SELECT_CASE_var == HcInt_KaradagChilledCeiling ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			tmpHc = CalcKaradagChilledCeiling( ( TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) ) );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcKaradagChilledCeiling( DeltaTemp[ I ] );
+			}
 		} else if ( SELECT_CASE_var == HcInt_ISO15099Windows ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			CalcISO15099WindowIntConvCoeff( SurfNum, TH( SurfNum, 1, 2 ), MAT( ZoneNum ) );
-			tmpHc = HConvIn( SurfNum );
-			Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
+			for ( I = 0; I < NumSurfs; ++I ) {
+				CalcISO15099WindowIntConvCoeff( SurfNums[ I ], TH( SurfNums[ I ], 1, 2 ), MAT( ZoneNum ) );
+				Hc[ I ] = HConvIn( SurfNums[ I ] );
+			}
 		} else if ( SELECT_CASE_var == HcInt_GoldsteinNovoselacCeilingDiffuserWindow ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
-			if ( ZoneNode > 0 ) {
-				ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
-				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Node( ZoneNode ).Temp, PsyWFnTdpPb( Node( ZoneNode ).Temp, OutBaroPress ) );
-				AirSystemVolFlowRate = Node( ZoneNode ).MassFlowRate / ( AirDensity * ZoneMult );
-				Surface( SurfNum ).TAirRef = ZoneSupplyAirTemp;
-			} else {
-				AirSystemVolFlowRate = 0.0;
-				Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcGoldsteinNovoselacCeilingDiffuserWindow( AirSystemVolFlowRate, Surface( SurfNums[ I ] ).IntConvZonePerimLength, Surface( SurfNums[ I ] ).IntConvWindowWallRatio, Surface( SurfNums[ I ] ).IntConvWindowLocation, ZoneNum );
 			}
-			tmpHc = CalcGoldsteinNovoselacCeilingDiffuserWindow( AirSystemVolFlowRate, Surface( SurfNum ).IntConvZonePerimLength, Surface( SurfNum ).IntConvWindowWallRatio, Surface( SurfNum ).IntConvWindowLocation, ZoneNum );
-
 		} else if ( SELECT_CASE_var == HcInt_GoldsteinNovoselacCeilingDiffuserWalls ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
-			if ( ZoneNode > 0 ) {
-				ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
-				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Node( ZoneNode ).Temp, PsyWFnTdpPb( Node( ZoneNode ).Temp, OutBaroPress ) );
-				AirSystemVolFlowRate = Node( ZoneNode ).MassFlowRate / ( AirDensity * ZoneMult );
-				Surface( SurfNum ).TAirRef = ZoneSupplyAirTemp;
-			} else {
-				AirSystemVolFlowRate = 0.0;
-				Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcGoldsteinNovoselacCeilingDiffuserWall( AirSystemVolFlowRate, Surface( SurfNums[ I ] ).IntConvZonePerimLength, Surface( SurfNums[ I ] ).IntConvWindowLocation, ZoneNum );
 			}
-			tmpHc = CalcGoldsteinNovoselacCeilingDiffuserWall( AirSystemVolFlowRate, Surface( SurfNum ).IntConvZonePerimLength, Surface( SurfNum ).IntConvWindowLocation, ZoneNum );
-
 		} else if ( SELECT_CASE_var == HcInt_GoldsteinNovoselacCeilingDiffuserFloor ) {
-			ZoneNum = Surface( SurfNum ).Zone;
-			ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
-			if ( ZoneNode > 0 ) {
-				ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
-				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Node( ZoneNode ).Temp, PsyWFnTdpPb( Node( ZoneNode ).Temp, OutBaroPress ) );
-				AirSystemVolFlowRate = Node( ZoneNode ).MassFlowRate / ( AirDensity * ZoneMult );
-				Surface( SurfNum ).TAirRef = ZoneSupplyAirTemp;
-			} else {
-				AirSystemVolFlowRate = 0.0;
-				Surface( SurfNum ).TAirRef = ZoneMeanAirTemp;
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Hc[ I ] = CalcGoldsteinNovoselacCeilingDiffuserFloor( AirSystemVolFlowRate, Surface( SurfNums[ I ] ).IntConvZonePerimLength, ZoneNum );
 			}
-			tmpHc = CalcGoldsteinNovoselacCeilingDiffuserFloor( AirSystemVolFlowRate, Surface( SurfNum ).IntConvZonePerimLength, ZoneNum );
-
+		} else {
+			TAirRef = 0;
 		}}
 
-		if ( tmpHc < AdaptiveHcInsideLowLimit ) tmpHc = AdaptiveHcInsideLowLimit;
-
-		Hc = tmpHc;
+		for ( I = 0; I < NumSurfs; ++I ) {
+			if ( Hc[ I ] < AdaptiveHcInsideLowLimit ) Hc[ I ] = AdaptiveHcInsideLowLimit;
+		}
+		if ( TAirRef != 0 ) {
+			for ( I = 0; I < NumSurfs; ++I ) {
+				Surface( SurfNums[ I ] ).TAirRef = TAirRef;
+			}
+		}
 
 	}
 
@@ -6236,7 +6244,7 @@ namespace ConvectionCoefficients {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR        Brent Griffith
 		//       DATE WRITTEN   Aug 2010
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, split into zone flow regime and surface classification
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -6251,6 +6259,51 @@ namespace ConvectionCoefficients {
 		// REFERENCES:
 		// na
 
+		// Using/Aliasing
+		using DataHeatBalSurface::TH;
+		using DataHeatBalFanSys::MAT;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ZoneNum; // zone of the surface
+		int FlowRegime; // flow regime of the zone
+		int PriorFlowRegime; // forced flow regime of the zone if FlowRegime is mixed
+		int Classification; // new classification of the surface, 0 if not resolved
+
+		ZoneNum = Surface( SurfNum ).Zone;
+		DynamicIntConvZoneFlowRegime( ZoneNum, FlowRegime, PriorFlowRegime );
+		Classification = ClassifyIntConvSurface( SurfNum, FlowRegime, PriorFlowRegime, TH( SurfNum, 1, 2 ) - MAT( ZoneNum ) );
+		if ( Classification > 0 ) Surface( SurfNum ).IntConvClassification = Classification;
+		if ( Surface( SurfNum ).IntConvClassification == 0 ) {
+			ShowSevereError( "DynamicIntConvSurfaceClassification: failed to resolve Hc model for surface named " + Surface( SurfNum ).Name );
+		}
+
+	}
+
+	void
+	DynamicIntConvZoneFlowRegime(
+		int const ZoneNum, // zone number
+		int & FlowRegime, // flow regime of the zone (InConvFlowRegime_A1 ... InConvFlowRegime_E)
+		int & PriorFlowRegime // forced flow regime (C or D) of the dominant equipment if FlowRegime is E
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Brent Griffith
+		//       DATE WRITTEN   Aug 2010
+		//       MODIFIED       October 2026, moved out of DynamicIntConvSurfaceClassification
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Decide the inside face flow regime of a zone for the adaptive convection algorithm.
+
+		// METHODOLOGY EMPLOYED:
+		// The regime depends only on the zone, its equipment and its surface temperatures, so it is found
+		// once for all of the surfaces of the zone.  The dominant equipment that is on sets the regime,
+		// and a forced regime is changed to natural or mixed depending on the Richardson number.
+
+		// REFERENCES:
+		// na
+
 		// Using/Aliasing
 		using namespace DataZoneEquipment;
 		using DataHeatBalSurface::TH;
@@ -6274,7 +6327,6 @@ namespace ConvectionCoefficients {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int ZoneNum( 0 );
 		static int PriorityEquipOn( 0 );
 		static FArray1D_int HeatingPriorityStack( {0,10}, 0 );
 		static FArray1D_int CoolingPriorityStack( {0,10}, 0 );
@@ -6284,8 +6336,6 @@ namespace ConvectionCoefficients {
 		static int EquipOnCount( 0 );
 		static int EquipOnLoop( 0 );
 		static int thisZoneInletNode( 0 );
-		//  INTEGER :: thisZnEqInletNode = 0
-		static int FinalFlowRegime( 0 );
 		static Real64 Tmin( 0.0 ); // temporary min surf temp
 		static Real64 Tmax( 0.0 ); // temporary max surf temp
 		static Real64 GrH( 0.0 ); // Grashof number for zone height H
@@ -6293,10 +6343,9 @@ namespace ConvectionCoefficients {
 		static Real64 Ri( 0.0 ); // Richardson Number, Gr/Re**2 for determining mixed regime
 		static Real64 AirDensity( 0.0 ); // temporary zone air density
 		static Real64 DeltaTemp( 0.0 ); // temporary temperature difference (Tsurf - Tair)
-		int SurfLoop; // local for separate looping across surfaces in the zone that has SurfNum
+		int SurfLoop; // local for separate looping across surfaces in the zone
 
 		EquipOnCount = 0;
-		ZoneNum = Surface( SurfNum ).Zone;
 		ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
 		FlowRegimeStack = 0;
 
@@ -6446,14 +6495,14 @@ namespace ConvectionCoefficients {
 					}
 				}
 			}
-			FinalFlowRegime = FlowRegimeStack( PriorityEquipOn );
+			FlowRegime = FlowRegimeStack( PriorityEquipOn );
 		} else {
 			// no equipment on, so simple bouyancy flow regime
-			FinalFlowRegime = InConvFlowRegime_A3;
+			FlowRegime = InConvFlowRegime_A3;
 		}
 
 		// now if flow regimes C or D, then check for Mixed regime or very low flow rates
-		if ( ( FinalFlowRegime == InConvFlowRegime_C ) || ( FinalFlowRegime == InConvFlowRegime_D ) ) {
+		if ( ( FlowRegime == InConvFlowRegime_C ) || ( FlowRegime == InConvFlowRegime_D ) ) {
 
 			//Calculate Grashof, Reynolds, and Richardson numbers for the zone
 			//Grashof for zone air based on largest delta T between surfaces and zone height
@@ -6472,467 +6521,469 @@ namespace ConvectionCoefficients {
 			if ( Re > 0.0 ) {
 				Ri = GrH / pow_2( Re ); //Richardson Number
 				if ( Ri > 10.0 ) { // natural convection expected
-					FinalFlowRegime = InConvFlowRegime_A3;
+					FlowRegime = InConvFlowRegime_A3;
 				} else if ( Ri < 0.1 ) { //forced
 					// no change, already a forced regime
 				} else { // mixed
-					FinalFlowRegime = InConvFlowRegime_E;
+					FlowRegime = InConvFlowRegime_E;
 				}
 			} else { // natural convection expected
-				FinalFlowRegime = InConvFlowRegime_A3;
+				FlowRegime = InConvFlowRegime_A3;
 			}
 		}
 
-		// now finish out specific model eq for this surface
-		//Surface(SurfNum)%IntConvClassification = 0 !init/check
-		{ auto const SELECT_CASE_var( FinalFlowRegime );
+		PriorFlowRegime = FlowRegimeStack( PriorityEquipOn );
+
+	}
+
+	int
+	ClassifyIntConvSurface(
+		int const SurfNum, // surface number
+		int const FlowRegime, // flow regime of the zone of the surface
+		int const PriorFlowRegime, // forced flow regime of the zone if FlowRegime is mixed
+		Real64 const DeltaTemp // [C] surface temperature minus zone air temperature
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         Brent Griffith
+		//       DATE WRITTEN   Aug 2010
+		//       MODIFIED       October 2026, moved out of DynamicIntConvSurfaceClassification
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Classify the inside face of a surface for the adaptive convection algorithm.
+
+		// METHODOLOGY EMPLOYED:
+		// The classification depends on the flow regime, the static characteristics of the surface and
+		// only the sign of DeltaTemp, which is what SetupIntConvDispatchTables relies on.
+		// Returns 0 if the surface cannot be classified.
+
+		// REFERENCES:
+		// na
+
+		// Return value
+		int Classification;
+
+		Classification = 0;
+		{ auto const SELECT_CASE_var( FlowRegime );
 
 		if ( SELECT_CASE_var == InConvFlowRegime_A1 ) {
-			DeltaTemp = TH( SurfNum, 1, 2 ) - MAT( ZoneNum );
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
 				if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
-					Surface( SurfNum ).IntConvClassification = InConvClass_A1_VertWalls;
+					Classification = InConvClass_A1_VertWalls;
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableTilted;
+						Classification = InConvClass_A1_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableTilted;
+						Classification = InConvClass_A1_StableTilted;
 					}
 				} else if ( Surface( SurfNum ).Tilt <= 85.0 ) { //tilted downwards
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableTilted;
+						Classification = InConvClass_A1_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableTilted;
+						Classification = InConvClass_A1_StableTilted;
 					}
 				}
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Roof ) {
 				if ( Surface( SurfNum ).IntConvSurfHasActiveInIt ) {
-					Surface( SurfNum ).IntConvClassification = InConvClass_A1_ChilledCeil;
+					Classification = InConvClass_A1_ChilledCeil;
 				} else if ( Surface( SurfNum ).Tilt < 5.0 ) {
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableHoriz;
+						Classification = InConvClass_A1_UnstableHoriz;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableHoriz;
+						Classification = InConvClass_A1_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt >= 5.0 ) && ( ( Surface( SurfNum ).Tilt < 95.0 ) ) ) { //tilted downwards
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableTilted;
+						Classification = InConvClass_A1_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableTilted;
+						Classification = InConvClass_A1_StableTilted;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
-					Surface( SurfNum ).IntConvClassification = InConvClass_A1_VertWalls;
+					Classification = InConvClass_A1_VertWalls;
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableTilted;
+						Classification = InConvClass_A1_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableTilted;
+						Classification = InConvClass_A1_StableTilted;
 					}
 				}
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Floor ) {
 				if ( Surface( SurfNum ).IntConvSurfHasActiveInIt ) {
-					Surface( SurfNum ).IntConvClassification = InConvClass_A1_HeatedFloor;
+					Classification = InConvClass_A1_HeatedFloor;
 				} else if ( Surface( SurfNum ).Tilt > 175.0 ) { //floor
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableHoriz;
+						Classification = InConvClass_A1_UnstableHoriz;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableHoriz;
+						Classification = InConvClass_A1_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt <= 175.0 ) && ( Surface( SurfNum ).Tilt >= 95.0 ) ) {
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableTilted;
+						Classification = InConvClass_A1_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableTilted;
+						Classification = InConvClass_A1_StableTilted;
 					}
 				}
 			} else if ( ( Surface( SurfNum ).Class == SurfaceClass_Window ) || ( Surface( SurfNum ).Class == SurfaceClass_GlassDoor ) || ( Surface( SurfNum ).Class == SurfaceClass_TDD_Diffuser ) ) {
-				Surface( SurfNum ).IntConvClassification = InConvClass_A1_Windows;
+				Classification = InConvClass_A1_Windows;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) {
 				// assume horizontal upwards.
 				if ( DeltaTemp > 0.0 ) {
-					Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableHoriz;
+					Classification = InConvClass_A1_UnstableHoriz;
 				} else {
-					Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableHoriz;
+					Classification = InConvClass_A1_StableHoriz;
 				}
 			}
 
-			if ( Surface( SurfNum ).IntConvClassification == 0 ) {
-				ShowSevereError( "DynamicIntConvSurfaceClassification: failed to resolve Hc model for A1 surface named" + Surface( SurfNum ).Name );
-			}
-
 		} else if ( SELECT_CASE_var == InConvFlowRegime_A2 ) {
-			DeltaTemp = TH( SurfNum, 1, 2 ) - MAT( ZoneNum );
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
 				if ( Surface( SurfNum ).IntConvSurfHasActiveInIt ) {
-					Surface( SurfNum ).IntConvClassification = InConvClass_A2_HeatedVerticalWall;
+					Classification = InConvClass_A2_HeatedVerticalWall;
 				} else if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
-					Surface( SurfNum ).IntConvClassification = InConvClass_A2_VertWallsNonHeated;
+					Classification = InConvClass_A2_VertWallsNonHeated;
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableTilted;
+						Classification = InConvClass_A2_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableTilted;
+						Classification = InConvClass_A2_StableTilted;
 					}
 				} else if ( Surface( SurfNum ).Tilt <= 85.0 ) { //tilted downwards
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableTilted;
+						Classification = InConvClass_A2_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableTilted;
+						Classification = InConvClass_A2_StableTilted;
 					}
 				}
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Roof ) {
 				if ( Surface( SurfNum ).Tilt < 5.0 ) {
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableHoriz;
+						Classification = InConvClass_A2_UnstableHoriz;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableHoriz;
+						Classification = InConvClass_A2_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt >= 5.0 ) && ( ( Surface( SurfNum ).Tilt < 95.0 ) ) ) { //tilted downwards
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableTilted;
+						Classification = InConvClass_A2_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableTilted;
+						Classification = InConvClass_A2_StableTilted;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
-					Surface( SurfNum ).IntConvClassification = InConvClass_A2_VertWallsNonHeated;
+					Classification = InConvClass_A2_VertWallsNonHeated;
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableTilted;
+						Classification = InConvClass_A2_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableTilted;
+						Classification = InConvClass_A2_StableTilted;
 					}
 				}
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Floor ) {
 				if ( Surface( SurfNum ).Tilt > 175.0 ) {
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableHoriz;
+						Classification = InConvClass_A2_UnstableHoriz;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableHoriz;
+						Classification = InConvClass_A2_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt <= 175.0 ) && ( Surface( SurfNum ).Tilt >= 95.0 ) ) {
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableTilted;
+						Classification = InConvClass_A2_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableTilted;
+						Classification = InConvClass_A2_StableTilted;
 					}
 				}
 			} else if ( ( Surface( SurfNum ).Class == SurfaceClass_Window ) || ( Surface( SurfNum ).Class == SurfaceClass_GlassDoor ) || ( Surface( SurfNum ).Class == SurfaceClass_TDD_Diffuser ) ) {
-				Surface( SurfNum ).IntConvClassification = InConvClass_A2_Windows;
+				Classification = InConvClass_A2_Windows;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) {
 				// assume horizontal upwards.
 				if ( DeltaTemp > 0.0 ) {
-					Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableHoriz;
+					Classification = InConvClass_A2_UnstableHoriz;
 				} else {
-					Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableHoriz;
+					Classification = InConvClass_A2_StableHoriz;
 				}
 			}
-
-			if ( Surface( SurfNum ).IntConvClassification == 0 ) {
-				ShowSevereError( "DynamicIntConvSurfaceClassification: failed to resolve Hc model for A2 surface named" + Surface( SurfNum ).Name );
-			}
 		} else if ( SELECT_CASE_var == InConvFlowRegime_A3 ) {
-			DeltaTemp = TH( SurfNum, 1, 2 ) - MAT( ZoneNum );
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
 				if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
-					Surface( SurfNum ).IntConvClassification = InConvClass_A3_VertWalls;
+					Classification = InConvClass_A3_VertWalls;
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableTilted;
+						Classification = InConvClass_A3_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableTilted;
+						Classification = InConvClass_A3_StableTilted;
 					}
 				} else if ( Surface( SurfNum ).Tilt <= 85.0 ) { //tilted downwards
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableTilted;
+						Classification = InConvClass_A3_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableTilted;
+						Classification = InConvClass_A3_StableTilted;
 					}
 				}
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Roof ) {
 				if ( Surface( SurfNum ).Tilt < 5.0 ) {
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableHoriz;
+						Classification = InConvClass_A3_UnstableHoriz;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableHoriz;
+						Classification = InConvClass_A3_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt > 5.0 ) && ( ( Surface( SurfNum ).Tilt < 85.0 ) ) ) { //tilted downwards
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableTilted;
+						Classification = InConvClass_A3_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableTilted;
+						Classification = InConvClass_A3_StableTilted;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
-					Surface( SurfNum ).IntConvClassification = InConvClass_A3_VertWalls;
+					Classification = InConvClass_A3_VertWalls;
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableTilted;
+						Classification = InConvClass_A3_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableTilted;
+						Classification = InConvClass_A3_StableTilted;
 					}
 				}
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Floor ) {
 				if ( Surface( SurfNum ).Tilt > 175.0 ) {
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableHoriz;
+						Classification = InConvClass_A3_UnstableHoriz;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableHoriz;
+						Classification = InConvClass_A3_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt <= 175.0 ) && ( Surface( SurfNum ).Tilt >= 95.0 ) ) {
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableTilted;
+						Classification = InConvClass_A3_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableTilted;
+						Classification = InConvClass_A3_StableTilted;
 					}
 				}
 			} else if ( ( Surface( SurfNum ).Class == SurfaceClass_Window ) || ( Surface( SurfNum ).Class == SurfaceClass_GlassDoor ) || ( Surface( SurfNum ).Class == SurfaceClass_TDD_Diffuser ) ) {
-				Surface( SurfNum ).IntConvClassification = InConvClass_A3_Windows;
+				Classification = InConvClass_A3_Windows;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) {
 				// assume horizontal upwards.
 				if ( DeltaTemp >= 0.0 ) {
-					Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableHoriz;
+					Classification = InConvClass_A3_UnstableHoriz;
 				} else {
-					Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableHoriz;
+					Classification = InConvClass_A3_StableHoriz;
 				}
 			}
-
-			if ( Surface( SurfNum ).IntConvClassification == 0 ) {
-				ShowSevereError( "DynamicIntConvSurfaceClassification: failed to resolve Hc model for A3 surface named" + Surface( SurfNum ).Name );
-			}
 		} else if ( SELECT_CASE_var == InConvFlowRegime_B ) {
-			DeltaTemp = TH( SurfNum, 1, 2 ) - MAT( ZoneNum );
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
 				if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
 					if ( Surface( SurfNum ).IntConvSurfGetsRadiantHeat ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_VertWallsNearHeat;
+						Classification = InConvClass_B_VertWallsNearHeat;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_VertWalls;
+						Classification = InConvClass_B_VertWalls;
 					}
 
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableTilted;
+						Classification = InConvClass_B_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableTilted;
+						Classification = InConvClass_B_StableTilted;
 					}
 				} else if ( Surface( SurfNum ).Tilt <= 85.0 ) { //tilted downwards
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableTilted;
+						Classification = InConvClass_B_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableTilted;
+						Classification = InConvClass_B_StableTilted;
 					}
 				}
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Roof ) {
 				if ( Surface( SurfNum ).Tilt < 5.0 ) {
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableHoriz;
+						Classification = InConvClass_B_UnstableHoriz;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableHoriz;
+						Classification = InConvClass_B_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt >= 5.0 ) && ( ( Surface( SurfNum ).Tilt < 85.0 ) ) ) { //tilted downwards
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableTilted;
+						Classification = InConvClass_B_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableTilted;
+						Classification = InConvClass_B_StableTilted;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
 					if ( Surface( SurfNum ).IntConvSurfGetsRadiantHeat ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_VertWallsNearHeat;
+						Classification = InConvClass_B_VertWallsNearHeat;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_VertWalls;
+						Classification = InConvClass_B_VertWalls;
 					}
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableTilted;
+						Classification = InConvClass_B_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableTilted;
+						Classification = InConvClass_B_StableTilted;
 					}
 				}
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Floor ) {
 				if ( Surface( SurfNum ).Tilt > 175.0 ) {
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableHoriz;
+						Classification = InConvClass_B_UnstableHoriz;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableHoriz;
+						Classification = InConvClass_B_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt <= 175.0 ) && ( Surface( SurfNum ).Tilt >= 95.0 ) ) {
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableTilted;
+						Classification = InConvClass_B_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableTilted;
+						Classification = InConvClass_B_StableTilted;
 					}
 				}
 			} else if ( ( Surface( SurfNum ).Class == SurfaceClass_Window ) || ( Surface( SurfNum ).Class == SurfaceClass_GlassDoor ) || ( Surface( SurfNum ).Class == SurfaceClass_TDD_Diffuser ) ) {
-				Surface( SurfNum ).IntConvClassification = InConvClass_B_Windows;
+				Classification = InConvClass_B_Windows;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) {
 				// assume horizontal upwards.
 				if ( DeltaTemp > 0.0 ) {
-					Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableHoriz;
+					Classification = InConvClass_B_UnstableHoriz;
 				} else {
-					Surface( SurfNum ).IntConvClassification = InConvClass_B_StableHoriz;
+					Classification = InConvClass_B_StableHoriz;
 				}
 			}
-
-			if ( Surface( SurfNum ).IntConvClassification == 0 ) {
-				ShowSevereError( "DynamicIntConvSurfaceClassification: failed to resolve Hc model for B surface named" + Surface( SurfNum ).Name );
-			}
 		} else if ( SELECT_CASE_var == InConvFlowRegime_C ) {
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
-				Surface( SurfNum ).IntConvClassification = InConvClass_C_Walls;
+				Classification = InConvClass_C_Walls;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Roof ) {
-				Surface( SurfNum ).IntConvClassification = InConvClass_C_Ceiling;
+				Classification = InConvClass_C_Ceiling;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Floor ) {
-				Surface( SurfNum ).IntConvClassification = InConvClass_C_Floor;
+				Classification = InConvClass_C_Floor;
 			} else if ( ( Surface( SurfNum ).Class == SurfaceClass_Window ) || ( Surface( SurfNum ).Class == SurfaceClass_GlassDoor ) || ( Surface( SurfNum ).Class == SurfaceClass_TDD_Diffuser ) ) {
-				Surface( SurfNum ).IntConvClassification = InConvClass_C_Windows;
+				Classification = InConvClass_C_Windows;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) {
-				Surface( SurfNum ).IntConvClassification = InConvClass_C_Floor;
-			}
-			if ( Surface( SurfNum ).IntConvClassification == 0 ) {
-				ShowSevereError( "DynamicIntConvSurfaceClassification: failed to resolve Hc model for C surface named" + Surface( SurfNum ).Name );
+				Classification = InConvClass_C_Floor;
 			}
 
 		} else if ( SELECT_CASE_var == InConvFlowRegime_D ) {
 
-			DeltaTemp = TH( SurfNum, 1, 2 ) - MAT( ZoneNum );
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
 				if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
 
-					Surface( SurfNum ).IntConvClassification = InConvClass_D_Walls;
+					Classification = InConvClass_D_Walls;
 
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableTilted;
+						Classification = InConvClass_D_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableTilted;
+						Classification = InConvClass_D_StableTilted;
 					}
 				} else if ( Surface( SurfNum ).Tilt <= 85.0 ) { //tilted downwards
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableTilted;
+						Classification = InConvClass_D_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableTilted;
+						Classification = InConvClass_D_StableTilted;
 					}
 				}
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Roof ) {
 				if ( Surface( SurfNum ).Tilt < 5.0 ) {
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableHoriz;
+						Classification = InConvClass_D_UnstableHoriz;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableHoriz;
+						Classification = InConvClass_D_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt >= 5.0 ) && ( ( Surface( SurfNum ).Tilt <= 85.0 ) ) ) { //tilted downwards
 					if ( DeltaTemp < 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableTilted;
+						Classification = InConvClass_D_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableTilted;
+						Classification = InConvClass_D_StableTilted;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
 
-					Surface( SurfNum ).IntConvClassification = InConvClass_D_Walls;
+					Classification = InConvClass_D_Walls;
 
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableTilted;
+						Classification = InConvClass_D_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableTilted;
+						Classification = InConvClass_D_StableTilted;
 					}
 				}
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Floor ) {
 				if ( Surface( SurfNum ).Tilt > 175.0 ) { //floor
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableHoriz;
+						Classification = InConvClass_D_UnstableHoriz;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableHoriz;
+						Classification = InConvClass_D_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt <= 175.0 ) && ( Surface( SurfNum ).Tilt >= 95.0 ) ) {
 					if ( DeltaTemp > 0.0 ) {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableTilted;
+						Classification = InConvClass_D_UnstableTilted;
 					} else {
-						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableTilted;
+						Classification = InConvClass_D_StableTilted;
 					}
 				}
 			} else if ( ( Surface( SurfNum ).Class == SurfaceClass_Window ) || ( Surface( SurfNum ).Class == SurfaceClass_GlassDoor ) || ( Surface( SurfNum ).Class == SurfaceClass_TDD_Diffuser ) ) {
-				Surface( SurfNum ).IntConvClassification = InConvClass_D_Windows;
+				Classification = InConvClass_D_Windows;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) {
 				// assume horizontal upwards.
 				if ( DeltaTemp > 0.0 ) {
-					Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableHoriz;
+					Classification = InConvClass_D_UnstableHoriz;
 				} else {
-					Surface( SurfNum ).IntConvClassification = InConvClass_D_StableHoriz;
+					Classification = InConvClass_D_StableHoriz;
 				}
 			}
 
-			if ( Surface( SurfNum ).IntConvClassification == 0 ) {
-				ShowSevereError( "DynamicIntConvSurfaceClassification: failed to resolve Hc model for D surface named" + Surface( SurfNum ).Name );
-			}
-
 		} else if ( SELECT_CASE_var == InConvFlowRegime_E ) {
 
-			DeltaTemp = TH( SurfNum, 1, 2 ) - MAT( ZoneNum );
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
 				//mixed regime, but need to know what regime it was before it was mixed
-				{ auto const SELECT_CASE_var1( FlowRegimeStack( PriorityEquipOn ) );
+				{ auto const SELECT_CASE_var1( PriorFlowRegime );
 
 				if ( SELECT_CASE_var1 == InConvFlowRegime_C ) {
 					//assume forced flow is down along wall (ceiling diffuser)
 					if ( DeltaTemp > 0.0 ) { // surface is hotter so plume upwards and forces oppose
-						Surface( SurfNum ).IntConvClassification = InConvClass_E_OpposFlowWalls;
+						Classification = InConvClass_E_OpposFlowWalls;
 					} else { // surface is cooler so plume down and forces assist
-						Surface( SurfNum ).IntConvClassification = InConvClass_E_AssistFlowWalls;
+						Classification = InConvClass_E_AssistFlowWalls;
 					}
 				} else if ( SELECT_CASE_var1 == InConvFlowRegime_D ) {
 					// assume forced flow is upward along wall (perimeter zone HVAC with fan)
 					if ( DeltaTemp > 0.0 ) { // surface is hotter so plume up and forces assist
-						Surface( SurfNum ).IntConvClassification = InConvClass_E_AssistFlowWalls;
+						Classification = InConvClass_E_AssistFlowWalls;
 					} else { // surface is cooler so plume downward and forces oppose
-						Surface( SurfNum ).IntConvClassification = InConvClass_E_OpposFlowWalls;
+						Classification = InConvClass_E_OpposFlowWalls;
 					}
 				}}
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Roof ) {
 				if ( DeltaTemp > 0.0 ) { //surface is hotter so stable
-					Surface( SurfNum ).IntConvClassification = InConvClass_E_StableCeiling;
+					Classification = InConvClass_E_StableCeiling;
 				} else {
-					Surface( SurfNum ).IntConvClassification = InConvClass_E_UnstableCieling;
+					Classification = InConvClass_E_UnstableCieling;
 				}
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Floor ) {
 				if ( DeltaTemp > 0.0 ) { //surface is hotter so unstable
-					Surface( SurfNum ).IntConvClassification = InConvClass_E_UnstableFloor;
+					Classification = InConvClass_E_UnstableFloor;
 				} else {
-					Surface( SurfNum ).IntConvClassification = InConvClass_E_StableFloor;
+					Classification = InConvClass_E_StableFloor;
 				}
 			} else if ( ( Surface( SurfNum ).Class == SurfaceClass_Window ) || ( Surface( SurfNum ).Class == SurfaceClass_GlassDoor ) || ( Surface( SurfNum ).Class == SurfaceClass_TDD_Diffuser ) ) {
-				Surface( SurfNum ).IntConvClassification = InConvClass_E_Windows;
+				Classification = InConvClass_E_Windows;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) {
 				if ( DeltaTemp > 0.0 ) {
-					Surface( SurfNum ).IntConvClassification = InConvClass_E_UnstableFloor;
+					Classification = InConvClass_E_UnstableFloor;
 				} else {
-					Surface( SurfNum ).IntConvClassification = InConvClass_E_StableFloor;
+					Classification = InConvClass_E_StableFloor;
 				}
 			}
-			if ( Surface( SurfNum ).IntConvClassification == 0 ) {
-				ShowSevereError( "DynamicIntConvSurfaceClassification: failed to resolve Hc model for D surface named " + Surface( SurfNum ).Name );
-			}
 		} else {
-			ShowSevereError( "DynamicIntConvSurfaceClassification: failed to deterime zone flow regime for surface named " + Surface( SurfNum ).Name );
+			ShowSevereError( "ClassifyIntConvSurface: failed to deterime zone flow regime for surface named " + Surface( SurfNum ).Name );
 
 		}}
 
+		return Classification;
+
 	}
 
 	void
@@ -6942,277 +6993,289 @@ namespace ConvectionCoefficients {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Brent Griffith
 		//       DATE WRITTEN   Aug 2010
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, case statement moved to GetIntConvClassHcModel
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Map Hc model equation data from central structure to surface structure
 
 		// METHODOLOGY EMPLOYED:
-		// Long case statement depends on surface classification determined in DynamicIntConvSurfaceClassification
-		// then simply map data stored in InsideFaceAdaptiveConvectionAlgo into the surface's structure
+		// Look up the model for the surface classification determined in DynamicIntConvSurfaceClassification
 		// if model type is user-defined, also store the index to the user curve to be used.
 
 		// REFERENCES:
 		// na
 
-		// USE STATEMENTS:
-		// na
+		GetIntConvClassHcModel( SurfNum, Surface( SurfNum ).IntConvClassification, Surface( SurfNum ).IntConvHcModelEq, Surface( SurfNum ).IntConvHcUserCurveIndex );
 
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
+	}
 
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		// na
+	void
+	GetIntConvClassHcModel(
+		int const SurfNum, // surface pointer index
+		int const Classification, // inside face classification (InConvClass_A1_VertWalls ... InConvClass_E_Windows)
+		int & HcModelEq, // set to the Hc model equation of the classification, unchanged if not classified
+		int & UserCurveNum // set to the user curve if HcModelEq is HcInt_UserCurve, unchanged otherwise
+	)
+	{
 
-		// INTERFACE BLOCK SPECIFICATIONS:
-		// na
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Brent Griffith
+		//       DATE WRITTEN   Aug 2010
+		//       MODIFIED       October 2026, moved out of MapIntConvClassificationToHcModels
+		//       RE-ENGINEERED  na
 
-		// DERIVED TYPE DEFINITIONS:
+		// PURPOSE OF THIS SUBROUTINE:
+		// Find the Hc model equation for an inside face classification of a surface
+
+		// METHODOLOGY EMPLOYED:
+		// Long case statement over the classification that maps data stored in InsideFaceAdaptiveConvectionAlgo.
+		// Only the static zone perimeter length of the surface is used besides the classification.
+
+		// REFERENCES:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		{ auto const SELECT_CASE_var( Surface( SurfNum ).IntConvClassification );
+		{ auto const SELECT_CASE_var( Classification );
 
 		if ( SELECT_CASE_var == InConvClass_A1_VertWalls ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolVertWallEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolVertWallUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolVertWallEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolVertWallUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A1_StableHoriz ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolStableHorizEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolStableHorizUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolStableHorizEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolStableHorizUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A1_UnstableHoriz ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolUnstableHorizEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolUnstableHorizUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolUnstableHorizEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolUnstableHorizUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A1_HeatedFloor ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolHeatedFloorEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolHeatedFloorUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolHeatedFloorEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolHeatedFloorUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A1_ChilledCeil ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolChilledCeilingEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolChilledCeilingUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolChilledCeilingEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolChilledCeilingUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A1_StableTilted ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolStableTiltedEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolStableTiltedUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolStableTiltedEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolStableTiltedUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A1_UnstableTilted ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolUnstableTiltedEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolUnstableTiltedUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolUnstableTiltedEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolUnstableTiltedUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A1_Windows ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolWindowsEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolWindowsUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolWindowsEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.FloorHeatCeilingCoolWindowsUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A2_VertWallsNonHeated ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatVertWallEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatVertWallUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatVertWallEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatVertWallUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A2_HeatedVerticalWall ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatHeatedWallEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatHeatedWallUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatHeatedWallEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatHeatedWallUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A2_StableHoriz ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatStableHorizEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatStableHorizUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatStableHorizEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatStableHorizUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A2_UnstableHoriz ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatUnstableHorizEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatUnstableHorizUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatUnstableHorizEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatUnstableHorizUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A2_StableTilted ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatStableTiltedEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatStableTiltedUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatStableTiltedEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatStableTiltedUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A2_UnstableTilted ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatUnstableTiltedEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatUnstableTiltedUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatUnstableTiltedEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatUnstableTiltedUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A2_Windows ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatWindowsEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatWindowsUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatWindowsEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.WallPanelHeatWindowsUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A3_VertWalls ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.SimpleBouyVertWallEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.SimpleBouyVertWallUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.SimpleBouyVertWallEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.SimpleBouyVertWallUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A3_StableHoriz ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.SimpleBouyStableHorizEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.SimpleBouyStableHorizUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.SimpleBouyStableHorizEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.SimpleBouyStableHorizUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A3_UnstableHoriz ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.SimpleBouyUnstableHorizEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.SimpleBouyUnstableHorizUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.SimpleBouyUnstableHorizEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.SimpleBouyUnstableHorizUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A3_StableTilted ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.SimpleBouyStableTiltedEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.SimpleBouyStableTiltedUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.SimpleBouyStableTiltedEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.SimpleBouyStableTiltedUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A3_UnstableTilted ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.SimpleBouyUnstableTiltedEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.SimpleBouyUnstableTiltedUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.SimpleBouyUnstableTiltedEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.SimpleBouyUnstableTiltedUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_A3_Windows ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.SimpleBouyWindowsEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.SimpleBouyWindowsUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.SimpleBouyWindowsEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.SimpleBouyWindowsUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_B_VertWalls ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatVertWallEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatVertWallUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatVertWallEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatVertWallUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_B_VertWallsNearHeat ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatVertWallNearHeaterEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatVertWallNearHeaterUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatVertWallNearHeaterEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatVertWallNearHeaterUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_B_StableHoriz ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatStableHorizEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatStableHorizUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatStableHorizEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatStableHorizUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_B_UnstableHoriz ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatUnstableHorizEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatUnstableHorizUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatUnstableHorizEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatUnstableHorizUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_B_StableTilted ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatStableTiltedEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatStableTiltedUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatStableTiltedEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatStableTiltedUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_B_UnstableTilted ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatUnstableTiltedEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatUnstableTiltedUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatUnstableTiltedEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatUnstableTiltedUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_B_Windows ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatWindowsEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatWindowsUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatWindowsEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.ConvectiveHeatWindowsUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_C_Walls ) {
 			if ( ( Surface( SurfNum ).IntConvZonePerimLength == 0.0 ) && ( InsideFaceAdaptiveConvectionAlgo.CentralAirWallEqNum == HcInt_GoldsteinNovoselacCeilingDiffuserWalls ) ) {
 				// no perimeter, Goldstein Novolselac model not good so revert to fisher pedersen model
-				Surface( SurfNum ).IntConvHcModelEq = HcInt_FisherPedersenCeilDiffuserWalls;
+				HcModelEq = HcInt_FisherPedersenCeilDiffuserWalls;
 			} else {
-				Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.CentralAirWallEqNum;
+				HcModelEq = InsideFaceAdaptiveConvectionAlgo.CentralAirWallEqNum;
 			}
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.CentralAirWallUserCurveNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.CentralAirWallUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_C_Ceiling ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.CentralAirCeilingEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.CentralAirCeilingUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.CentralAirCeilingEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.CentralAirCeilingUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_C_Floor ) {
 			if ( ( Surface( SurfNum ).IntConvZonePerimLength == 0.0 ) && ( InsideFaceAdaptiveConvectionAlgo.CentralAirFloorEqNum == HcInt_GoldsteinNovoselacCeilingDiffuserFloor ) ) {
 				// no perimeter, Goldstein Novolselac model not good so revert to fisher pedersen model
-				Surface( SurfNum ).IntConvHcModelEq = HcInt_FisherPedersenCeilDiffuserFloor;
+				HcModelEq = HcInt_FisherPedersenCeilDiffuserFloor;
 			} else {
-				Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.CentralAirFloorEqNum;
+				HcModelEq = InsideFaceAdaptiveConvectionAlgo.CentralAirFloorEqNum;
 			}
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.CentralAirFloorUserCurveNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.CentralAirFloorUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_C_Windows ) {
 			if ( ( Surface( SurfNum ).IntConvZonePerimLength == 0.0 ) && ( InsideFaceAdaptiveConvectionAlgo.CentralAirWindowsEqNum == HcInt_GoldsteinNovoselacCeilingDiffuserWindow ) ) {
 				// no perimeter, Goldstein Novolselac model not good so revert to ISO15099
-				Surface( SurfNum ).IntConvHcModelEq = HcInt_ISO15099Windows;
+				HcModelEq = HcInt_ISO15099Windows;
 			} else {
-				Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.CentralAirWindowsEqNum;
+				HcModelEq = InsideFaceAdaptiveConvectionAlgo.CentralAirWindowsEqNum;
 			}
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.CentralAirWindowsUserCurveNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.CentralAirWindowsUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_D_Walls ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircVertWallEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircVertWallUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircVertWallEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircVertWallUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_D_StableHoriz ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircStableHorizEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircStableHorizUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircStableHorizEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircStableHorizUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_D_UnstableHoriz ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircUnstableHorizEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircUnstableHorizUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircUnstableHorizEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircUnstableHorizUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_D_StableTilted ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircStableTiltedEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircStableTiltedUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircStableTiltedEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircStableTiltedUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_D_UnstableTilted ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircUnstableTiltedEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircUnstableTiltedUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircUnstableTiltedEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircUnstableTiltedUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_D_Windows ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircWindowsEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircWindowsUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircWindowsEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.ZoneFanCircWindowsUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_E_AssistFlowWalls ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedBouyAssistingFlowWallEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.MixedBouyAssistingFlowWallUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedBouyAssistingFlowWallEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.MixedBouyAssistingFlowWallUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_E_OpposFlowWalls ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedBouyOppossingFlowWallEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.MixedBouyOppossingFlowWallUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedBouyOppossingFlowWallEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.MixedBouyOppossingFlowWallUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_E_StableFloor ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedStableFloorEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.MixedStableFloorUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedStableFloorEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.MixedStableFloorUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_E_UnstableFloor ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedUnstableFloorEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.MixedUnstableFloorUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedUnstableFloorEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.MixedUnstableFloorUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_E_StableCeiling ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedStableCeilingEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.MixedStableCeilingUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedStableCeilingEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.MixedStableCeilingUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_E_UnstableCieling ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedUnstableCeilingEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.MixedUnstableCeilingUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedUnstableCeilingEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.MixedUnstableCeilingUserCurveNum;
 			}
 		} else if ( SELECT_CASE_var == InConvClass_E_Windows ) {
-			Surface( SurfNum ).IntConvHcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedWindowsEqNum;
-			if ( Surface( SurfNum ).IntConvHcModelEq == HcInt_UserCurve ) {
-				Surface( SurfNum ).IntConvHcUserCurveIndex = InsideFaceAdaptiveConvectionAlgo.MixedWindowsUserCurveNum;
+			HcModelEq = InsideFaceAdaptiveConvectionAlgo.MixedWindowsEqNum;
+			if ( HcModelEq == HcInt_UserCurve ) {
+				UserCurveNum = InsideFaceAdaptiveConvectionAlgo.MixedWindowsUserCurveNum;
 			}
 		}}
 
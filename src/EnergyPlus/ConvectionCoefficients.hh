@@ -1,8 +1,12 @@
 #ifndef ConvectionCoefficients_hh_INCLUDED
 #define ConvectionCoefficients_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/FArray2D.hh>
 #include <ObjexxFCL/FArray1S.hh>
 #include <ObjexxFCL/Optional.hh>
 
@@ -104,6 +108,7 @@ namespace ConvectionCoefficients {
 	extern int const InConvFlowRegime_C; // central mechanical air
 	extern int const InConvFlowRegime_D; // zone mechanical air
 	extern int const InConvFlowRegime_E; // mixed. mechancial air and bouyancy
+	extern int const NumIntConvRegimeCases; // flow regimes A1 to D, then E after C and E after D, in IntConvDispatch
 
 	//params for reference temperature type
 	extern int const RefTempMeanAirTemp;
@@ -132,6 +137,7 @@ namespace ConvectionCoefficients {
 	extern bool ConvectionGeometryMetaDataSetup; // set to true once geometry meta data are setup
 	extern Real64 CubeRootOfOverallBuildingVolume; // building meta data. cube root of the volume of all the zones
 	extern Real64 RoofLongAxisOutwardAzimuth; // roof surfaces meta data. outward normal azimuth for longest roof edge
+	extern bool IntConvDispatchSetup; // set to true once IntConvDispatch is filled in
 
 	// SUBROUTINE SPECIFICATIONS:
 	//PRIVATE ApplyConvectionValue ! internal to GetUserConvectionCoefficients
@@ -758,12 +764,31 @@ namespace ConvectionCoefficients {
 
 	};
 
+	struct IntConvDispatchStruct
+	{
+		// Members
+		// row is the sign of surface minus zone air temperature (1: negative, 2: zero, 3: positive),
+		// column is the zone flow regime case (see NumIntConvRegimeCases)
+		FArray2D_int Classification; // inside face classification
+		FArray2D_int HcModelEq; // Hc model equation for the classification
+		FArray2D_int UserCurveNum; // user curve if HcModelEq is HcInt_UserCurve
+
+		// Default Constructor
+		IntConvDispatchStruct() :
+			Classification( 3, NumIntConvRegimeCases, 0 ),
+			HcModelEq( 3, NumIntConvRegimeCases, 0 ),
+			UserCurveNum( 3, NumIntConvRegimeCases, 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern InsideFaceAdaptiveConvAlgoStruct InsideFaceAdaptiveConvectionAlgo; // stores rules for Hc model equations
 	extern OutsideFaceAdpativeConvAlgoStruct OutsideFaceAdaptiveConvectionAlgo;
 	extern FArray1D< HcInsideFaceUserCurveStruct > HcInsideUserCurve;
 	extern FArray1D< HcOutsideFaceUserCurveStruct > HcOutsideUserCurve;
 	extern RoofGeoCharactisticsStruct RoofGeo;
+	extern FArray1D< IntConvDispatchStruct > IntConvDispatch; // adaptive inside face classification and model of each surface
 
 	// Functions
 
@@ -900,6 +925,15 @@ namespace ConvectionCoefficients {
 	void
 	ManageInsideAdaptiveConvectionAlgo( int const SurfNum ); // surface number for which coefficients are being calculated
 
+	void
+	ManageInsideAdaptiveConvectionZone(
+		int const ZoneNum, // zone of the surfaces
+		std::vector< int > const & SurfNums // surfaces for which coefficients are being calculated
+	);
+
+	void
+	SetupIntConvDispatchTables();
+
 	void
 	ManageOutsideAdaptiveConvectionAlgo(
 		int const SurfNum, // surface number for which coefficients are being calculated
@@ -913,6 +947,14 @@ namespace ConvectionCoefficients {
 		Real64 & Hc // calculated Hc value
 	);
 
+	void
+	EvaluateIntHcModelBatch(
+		int const ZoneNum, // zone of the surfaces
+		int const ConvModelEquationNum,
+		std::vector< int > const & SurfNums, // surfaces using the model
+		std::vector< Real64 > & Hc // calculated Hc values, in the order of SurfNums
+	);
+
 	void
 	EvaluateExtHcModels(
 		int const SurfNum,
@@ -930,9 +972,32 @@ namespace ConvectionCoefficients {
 	void
 	DynamicIntConvSurfaceClassification( int const SurfNum ); // surface number
 
+	void
+	DynamicIntConvZoneFlowRegime(
+		int const ZoneNum, // zone number
+		int & FlowRegime, // current zone flow regime
+		int & PriorFlowRegime // flow regime of the equipment before the current one, for regime E
+	);
+
+	int
+	ClassifyIntConvSurface(
+		int const SurfNum, // surface number
+		int const FlowRegime, // zone flow regime
+		int const PriorFlowRegime, // flow regime of the equipment before the current one, for regime E
+		Real64 const DeltaTemp // surface minus zone air temperature, only the sign is used
+	);
+
 	void
 	MapIntConvClassificationToHcModels( int const SurfNum ); // surface pointer index
 
+	void
+	GetIntConvClassHcModel(
+		int const SurfNum, // surface pointer index
+		int const Classification, // inside face classification
+		int & HcModelEq, // Hc model equation
+		int & UserCurveNum // user curve if the model is a user curve
+	);
+
 	void
 	CalcUserDefinedInsideHcModel(
 		int const SurfNum,
@@ -469,6 +469,15 @@ namespace DataBSDFWindow {
 		FArray1D< Real64 > IntegratedBkAbs; // Sum of all back layer absorptances (for each back direction)
 		FArray1D< Real64 > IntegratedBkRefl; // Integrated back layer reflectance (for each back direction)
 		FArray1D< Real64 > IntegratedBkTrans; // Integrated back layer transmittance (for each back direction)
+		// Projections of the property matrices that do not change with the sun position
+		FArray1D< Real64 > FtDirHemiTrans; // Directional-hemispherical front transmittance (for each incident direction)
+		FArray1D< Real64 > BkDirHemiRefl; // Directional-hemispherical back reflectance (for each back incident direction)
+		FArray1D< Real64 > VisFtOverlapRefl; // Visible front transmittance weighted by the reflectance of the overlap
+		// surfaces it reaches (for each incident direction; used for daylighting first reflected flux)
+		FArray1D_int SolFtTransFirst; // First nonzero row of each column of the solar front transmittance matrix
+		FArray1D_int SolFtTransLast; // Last nonzero row of each column of the solar front transmittance matrix
+		FArray1D_int VisFtTransFirst; // First nonzero row of each column of the visible front transmittance matrix
+		FArray1D_int VisFtTransLast; // Last nonzero row of each column of the visible front transmittance matrix
 
 		// Default Constructor
 		BSDFStateDescr() :
@@ -506,7 +515,14 @@ namespace DataBSDFWindow {
 			FArray1< Real64 > const & IntegratedFtTrans, // Integrated back layer transmittance (for each back direction)
 			FArray1< Real64 > const & IntegratedBkAbs, // Sum of all back layer absorptances (for each back direction)
 			FArray1< Real64 > const & IntegratedBkRefl, // Integrated back layer reflectance (for each back direction)
-			FArray1< Real64 > const & IntegratedBkTrans // Integrated back layer transmittance (for each back direction)
+			FArray1< Real64 > const & IntegratedBkTrans, // Integrated back layer transmittance (for each back direction)
+			FArray1< Real64 > const & FtDirHemiTrans, // Directional-hemispherical front transmittance (for each incident direction)
+			FArray1< Real64 > const & BkDirHemiRefl, // Directional-hemispherical back reflectance (for each back incident direction)
+			FArray1< Real64 > const & VisFtOverlapRefl, // Visible front transmittance weighted by the reflectance of the overlap
+			FArray1_int const & SolFtTransFirst, // First nonzero row of each column of the solar front transmittance matrix
+			FArray1_int const & SolFtTransLast, // Last nonzero row of each column of the solar front transmittance matrix
+			FArray1_int const & VisFtTransFirst, // First nonzero row of each column of the visible front transmittance matrix
+			FArray1_int const & VisFtTransLast // Last nonzero row of each column of the visible front transmittance matrix
 		) :
 			Konst( Konst ),
 			WinDiffTrans( WinDiffTrans ),
@@ -532,7 +548,14 @@ namespace DataBSDFWindow {
 			IntegratedFtTrans( IntegratedFtTrans ),
 			IntegratedBkAbs( IntegratedBkAbs ),
 			IntegratedBkRefl( IntegratedBkRefl ),
-			IntegratedBkTrans( IntegratedBkTrans )
+			IntegratedBkTrans( IntegratedBkTrans ),
+			FtDirHemiTrans( FtDirHemiTrans ),
+			BkDirHemiRefl( BkDirHemiRefl ),
+			VisFtOverlapRefl( VisFtOverlapRefl ),
+			SolFtTransFirst( SolFtTransFirst ),
+			SolFtTransLast( SolFtTransLast ),
+			VisFtTransFirst( VisFtTransFirst ),
+			VisFtTransLast( VisFtTransLast )
 		{}
 
 	};
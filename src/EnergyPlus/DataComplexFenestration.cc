@@ -52,6 +52,11 @@ namespace DataComplexFenestration {
 	int const dmTemperatureAndPressureInput( 1 );
 	int const dmMeasuredDeflection( 2 );
 
+	// Parameters for reuse of tarcog solutions
+	int const rmNoReuse( 0 );
+	int const rmWarmStart( 1 );
+	int const rmReuseWithinTolerance( 2 );
+
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
@@ -48,6 +48,11 @@ namespace DataComplexFenestration {
 	extern int const dmTemperatureAndPressureInput;
 	extern int const dmMeasuredDeflection;
 
+	// Parameters for reuse of tarcog solutions
+	extern int const rmNoReuse;
+	extern int const rmWarmStart;
+	extern int const rmReuseWithinTolerance;
+
 	// Types
 
 	struct GapSupportPillar
@@ -195,6 +200,11 @@ namespace DataComplexFenestration {
 		Real64 VacuumPressureLimit; // Pressure limit at which it will be considered vacuum gas state
 		Real64 InitialTemperature; // Window(s) temperature in time of fabrication
 		Real64 InitialPressure; // Window(s) pressure in time of fabrication
+		int SolutionReuse; // Reuse of tarcog solutions for nearby boundary conditions
+		Real64 ReuseTemperatureTolerance; // Temperature tolerance for solution reuse (K)
+		Real64 ReuseIrradianceTolerance; // Solar and IR irradiance tolerance for solution reuse (W/m2)
+		Real64 ReuseWindSpeedTolerance; // Wind speed tolerance for solution reuse (m/s)
+		Real64 ReuseFilmCoefficientTolerance; // Film coefficient tolerance for solution reuse (W/m2-K)
 
 		// Default Constructor
 		WindowThermalModelParams() :
@@ -204,7 +214,12 @@ namespace DataComplexFenestration {
 			DeflectionModel( -1 ),
 			VacuumPressureLimit( 0.0 ),
 			InitialTemperature( 0.0 ),
-			InitialPressure( 0.0 )
+			InitialPressure( 0.0 ),
+			SolutionReuse( rmNoReuse ),
+			ReuseTemperatureTolerance( 0.0 ),
+			ReuseIrradianceTolerance( 0.0 ),
+			ReuseWindSpeedTolerance( 0.0 ),
+			ReuseFilmCoefficientTolerance( 0.0 )
 		{}
 
 		// Member Constructor
@@ -216,7 +231,12 @@ namespace DataComplexFenestration {
 			int const DeflectionModel, // Deflection model
 			Real64 const VacuumPressureLimit, // Pressure limit at which it will be considered vacuum gas state
 			Real64 const InitialTemperature, // Window(s) temperature in time of fabrication
-			Real64 const InitialPressure // Window(s) pressure in time of fabrication
+			Real64 const InitialPressure, // Window(s) pressure in time of fabrication
+			int const SolutionReuse, // Reuse of tarcog solutions for nearby boundary conditions
+			Real64 const ReuseTemperatureTolerance, // Temperature tolerance for solution reuse (K)
+			Real64 const ReuseIrradianceTolerance, // Solar and IR irradiance tolerance for solution reuse (W/m2)
+			Real64 const ReuseWindSpeedTolerance, // Wind speed tolerance for solution reuse (m/s)
+			Real64 const ReuseFilmCoefficientTolerance // Film coefficient tolerance for solution reuse (W/m2-K)
 		) :
 			Name( Name ),
 			CalculationStandard( CalculationStandard ),
@@ -225,7 +245,12 @@ namespace DataComplexFenestration {
 			DeflectionModel( DeflectionModel ),
 			VacuumPressureLimit( VacuumPressureLimit ),
 			InitialTemperature( InitialTemperature ),
-			InitialPressure( InitialPressure )
+			InitialPressure( InitialPressure ),
+			SolutionReuse( SolutionReuse ),
+			ReuseTemperatureTolerance( ReuseTemperatureTolerance ),
+			ReuseIrradianceTolerance( ReuseIrradianceTolerance ),
+			ReuseWindSpeedTolerance( ReuseWindSpeedTolerance ),
+			ReuseFilmCoefficientTolerance( ReuseFilmCoefficientTolerance )
 		{}
 
 	};
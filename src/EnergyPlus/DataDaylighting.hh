@@ -386,17 +386,13 @@ namespace DataDaylighting {
 		// Points 1 and 2 are the control reference points
 		FArray1D_bool MapRefPtInBounds; // True when coordinates are in bounds of zone coordinates
 		FArray1D< Real64 > DaylIllumAtMapPt; // Daylight illuminance at illuminance map points (lux)
-		FArray1D< Real64 > GlareIndexAtMapPt; // Glare index at illuminance map points
 		// following Hr - report avg hr
 		FArray1D< Real64 > DaylIllumAtMapPtHr; // Daylight illuminance at illuminance map points (lux)
-		FArray1D< Real64 > GlareIndexAtMapPtHr; // Glare index at illuminance map points
 		FArray2D< Real64 > SolidAngAtMapPt; // (MaxRefPoints,50)
 		FArray2D< Real64 > SolidAngAtMapPtWtd; // (MaxRefPoints,50)
-		FArray3D< Real64 > IllumFromWinAtMapPt; // (MaxRefPoints,2,50)
-		FArray3D< Real64 > BackLumFromWinAtMapPt; // (MaxRefPoints,2,50)
-		FArray3D< Real64 > SourceLumFromWinAtMapPt; // (MaxRefPoints,2,50)
-		//  1: Daylit window number (1 to NumOfDayltgExtWins)
-		//  2: Reference point number (1 to MaxRefPoints)
+		// Arguments for Dayl---Sky are (map point first so the factors of one window are contiguous over the map):
+		//  1: Map point number (1 to TotalMapRefPoints)
+		//  2: Daylit window number (1 to NumOfDayltgExtWins)
 		//  3: Sky type (1 to 4; 1 = clear, 2 = clear turbid, 3 = intermediate, 4 = overcast
 		//  4: Shading index (1 to MaxSlatAngs+1; 1 = bare window; 2 = with shade, or, if blinds
 		//      2 = first slat position, 3 = second position, ..., MaxSlatAngs+1 = last position)
@@ -405,8 +401,8 @@ namespace DataDaylighting {
 		FArray5D< Real64 > DaylSourceFacSky;
 		FArray5D< Real64 > DaylBackFacSky;
 		// Arguments for Dayl---Sun are:
-		//  1: Daylit window number (1 to NumOfDayltgExtWins)
-		//  2: Reference point number (1 to MaxRefPoints)
+		//  1: Map point number (1 to TotalMapRefPoints)
+		//  2: Daylit window number (1 to NumOfDayltgExtWins)
 		//  3: Shading index (1 to MaxShadeIndex; 1 = no shade; 2 = with shade, or, if blinds
 		//      2 = first slat position, 3 = second position, ..., MaxSlatAngs+1 = last position)
 		//  4: Sun position index (1 to 24)
@@ -430,14 +426,9 @@ namespace DataDaylighting {
 			FArray2< Real64 > const & MapRefPtAbsCoord, // X,Y,Z coordinates of all illuminance map reference points
 			FArray1_bool const & MapRefPtInBounds, // True when coordinates are in bounds of zone coordinates
 			FArray1< Real64 > const & DaylIllumAtMapPt, // Daylight illuminance at illuminance map points (lux)
-			FArray1< Real64 > const & GlareIndexAtMapPt, // Glare index at illuminance map points
 			FArray1< Real64 > const & DaylIllumAtMapPtHr, // Daylight illuminance at illuminance map points (lux)
-			FArray1< Real64 > const & GlareIndexAtMapPtHr, // Glare index at illuminance map points
 			FArray2< Real64 > const & SolidAngAtMapPt, // (MaxRefPoints,50)
 			FArray2< Real64 > const & SolidAngAtMapPtWtd, // (MaxRefPoints,50)
-			FArray3< Real64 > const & IllumFromWinAtMapPt, // (MaxRefPoints,2,50)
-			FArray3< Real64 > const & BackLumFromWinAtMapPt, // (MaxRefPoints,2,50)
-			FArray3< Real64 > const & SourceLumFromWinAtMapPt, // (MaxRefPoints,2,50)
 			FArray5< Real64 > const & DaylIllFacSky,
 			FArray5< Real64 > const & DaylSourceFacSky,
 			FArray5< Real64 > const & DaylBackFacSky,
@@ -453,14 +444,9 @@ namespace DataDaylighting {
 			MapRefPtAbsCoord( MapRefPtAbsCoord ),
 			MapRefPtInBounds( MapRefPtInBounds ),
 			DaylIllumAtMapPt( DaylIllumAtMapPt ),
-			GlareIndexAtMapPt( GlareIndexAtMapPt ),
 			DaylIllumAtMapPtHr( DaylIllumAtMapPtHr ),
-			GlareIndexAtMapPtHr( GlareIndexAtMapPtHr ),
 			SolidAngAtMapPt( SolidAngAtMapPt ),
 			SolidAngAtMapPtWtd( SolidAngAtMapPtWtd ),
-			IllumFromWinAtMapPt( IllumFromWinAtMapPt ),
-			BackLumFromWinAtMapPt( BackLumFromWinAtMapPt ),
-			SourceLumFromWinAtMapPt( SourceLumFromWinAtMapPt ),
 			DaylIllFacSky( DaylIllFacSky ),
 			DaylSourceFacSky( DaylSourceFacSky ),
 			DaylBackFacSky( DaylBackFacSky ),
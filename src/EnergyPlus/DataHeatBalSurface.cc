@@ -178,16 +178,31 @@ namespace DataHeatBalSurface {
 
 	//REAL(r64) variables from BLDCTF.inc and only used in the Heat Balance
 	FArray3D< Real64 > TH; // Temperature History (SurfNum,Hist Term,In/Out) where:
-	//Hist Term (1 = Current Time, 2-MaxCTFTerms = previous times),
+	//Hist Term (1 = Current Time only, previous times are in the CTF history ring buffers below),
 	//In/Out (1 = Outside, 2 = Inside)
-	FArray3D< Real64 > QH; // Flux History (TH and QH are interpolated from THM and QHM for
+	FArray3D< Real64 > QH; // Flux History (SurfNum,Hist Term,In/Out), current time only as for TH
+	FArray2D< Real64 > TsrcHist; // Temperature at the source location (Term,SurfNum), current time only
+	FArray2D< Real64 > QsrcHist; // Heat source/sink for the surface (Term,SurfNum), current time only
+
+	// CTF history terms 2 to NumCTFTerms+1 (previous times) are kept in ring buffers (Slot,SurfNum) instead
+	// of being shifted every time step.  Term 2 of a surface is in slot CTFHistHead(SurfNum) and older terms
+	// follow it, wrapping after CTFHistLength slots.  Slots CTFHistLength+1 to 2*CTFHistLength repeat the first
+	// CTFHistLength so that the history terms of a surface are always contiguous from the head slot.
+	int CTFHistLength( 0 ); // Ring buffer length (largest number of CTF terms of any construction)
+	FArray1D_int CTFHistHead; // Slot of history term 2 for each surface
+	FArray2D< Real64 > CTFHistTOut; // Outside temperature history (interpolated from CTFHistTOutM for
 	//the next user requested time step)
-	FArray3D< Real64 > THM; // Master Temperature History (on the time step for the construct)
-	FArray3D< Real64 > QHM; // Master Flux History (on the time step for the construct)
-	FArray2D< Real64 > TsrcHist; // Temperature history at the source location (SurfNum,Term)
-	FArray2D< Real64 > QsrcHist; // Heat source/sink history for the surface (SurfNum,Term)
-	FArray2D< Real64 > TsrcHistM; // Master temperature history at the source location (SurfNum,Term)
-	FArray2D< Real64 > QsrcHistM; // Master heat source/sink history for the surface (SurfNum,Term)
+	FArray2D< Real64 > CTFHistTIn; // Inside temperature history
+	FArray2D< Real64 > CTFHistQOut; // Outside flux history
+	FArray2D< Real64 > CTFHistQIn; // Inside flux history
+	FArray2D< Real64 > CTFHistTsrc; // Temperature history at the source location
+	FArray2D< Real64 > CTFHistQsrc; // Heat source/sink history for the surface
+	FArray2D< Real64 > CTFHistTOutM; // Master outside temperature history (on the time step for the construct)
+	FArray2D< Real64 > CTFHistTInM; // Master inside temperature history
+	FArray2D< Real64 > CTFHistQOutM; // Master outside flux history
+	FArray2D< Real64 > CTFHistQInM; // Master inside flux history
+	FArray2D< Real64 > CTFHistTsrcM; // Master temperature history at the source location
+	FArray2D< Real64 > CTFHistQsrcM; // Master heat source/sink history for the surface
 
 	FArray2D< Real64 > FractDifShortZtoZ; // Fraction of diffuse short radiation in Zone 2 transmitted to Zone 1
 	FArray1D_bool RecDifShortFromZ; // True if Zone gets short radiation from another
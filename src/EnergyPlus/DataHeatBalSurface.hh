@@ -165,16 +165,31 @@ namespace DataHeatBalSurface {
 
 	//REAL(r64) variables from BLDCTF.inc and only used in the Heat Balance
 	extern FArray3D< Real64 > TH; // Temperature History (SurfNum,Hist Term,In/Out) where:
-	//Hist Term (1 = Current Time, 2-MaxCTFTerms = previous times),
+	//Hist Term (1 = Current Time only, previous times are in the CTF history ring buffers below),
 	//In/Out (1 = Outside, 2 = Inside)
-	extern FArray3D< Real64 > QH; // Flux History (TH and QH are interpolated from THM and QHM for
+	extern FArray3D< Real64 > QH; // Flux History (SurfNum,Hist Term,In/Out), current time only as for TH
+	extern FArray2D< Real64 > TsrcHist; // Temperature at the source location (Term,SurfNum), current time only
+	extern FArray2D< Real64 > QsrcHist; // Heat source/sink for the surface (Term,SurfNum), current time only
+
+	// CTF history terms 2 to NumCTFTerms+1 (previous times) are kept in ring buffers (Slot,SurfNum) instead
+	// of being shifted every time step.  Term 2 of a surface is in slot CTFHistHead(SurfNum) and older terms
+	// follow it, wrapping after CTFHistLength slots.  Slots CTFHistLength+1 to 2*CTFHistLength repeat the first
+	// CTFHistLength so that the history terms of a surface are always contiguous from the head slot.
+	extern int CTFHistLength; // Ring buffer length (largest number of CTF terms of any construction)
+	extern FArray1D_int CTFHistHead; // Slot of history term 2 for each surface
+	extern FArray2D< Real64 > CTFHistTOut; // Outside temperature history (interpolated from CTFHistTOutM for
 	//the next user requested time step)
-	extern FArray3D< Real64 > THM; // Master Temperature History (on the time step for the construct)
-	extern FArray3D< Real64 > QHM; // Master Flux History (on the time step for the construct)
-	extern FArray2D< Real64 > TsrcHist; // Temperature history at the source location (Term,SurfNum)
-	extern FArray2D< Real64 > QsrcHist; // Heat source/sink history for the surface (Term,SurfNum)
-	extern FArray2D< Real64 > TsrcHistM; // Master temperature history at the source location (Term,SurfNum)
-	extern FArray2D< Real64 > QsrcHistM; // Master heat source/sink history for the surface (Term,SurfNum)
+	extern FArray2D< Real64 > CTFHistTIn; // Inside temperature history
+	extern FArray2D< Real64 > CTFHistQOut; // Outside flux history
+	extern FArray2D< Real64 > CTFHistQIn; // Inside flux history
+	extern FArray2D< Real64 > CTFHistTsrc; // Temperature history at the source location
+	extern FArray2D< Real64 > CTFHistQsrc; // Heat source/sink history for the surface
+	extern FArray2D< Real64 > CTFHistTOutM; // Master outside temperature history (on the time step for the construct)
+	extern FArray2D< Real64 > CTFHistTInM; // Master inside temperature history
+	extern FArray2D< Real64 > CTFHistQOutM; // Master outside flux history
+	extern FArray2D< Real64 > CTFHistQInM; // Master inside flux history
+	extern FArray2D< Real64 > CTFHistTsrcM; // Master temperature history at the source location
+	extern FArray2D< Real64 > CTFHistQsrcM; // Master heat source/sink history for the surface
 
 	extern FArray2D< Real64 > FractDifShortZtoZ; // Fraction of diffuse short radiation in Zone 2 transmitted to Zone 1
 	extern FArray1D_bool RecDifShortFromZ; // True if Zone gets short radiation from another
@@ -304,6 +304,9 @@ namespace DataHeatBalance {
 	int DefaultOutsideConvectionAlgo( 1 ); // 1 = simple (ASHRAE); 2 = detailed; etc (BLAST, TARP, MOWITT, DOE-2)
 	int SolarDistribution( 0 ); // Solar Distribution Algorithm
 	int InsideSurfIterations( 0 ); // Counts inside surface iterations
+	bool InsideSurfIterExtrapolation( false ); // TRUE if the inside surface iterations are accelerated by Aitken extrapolation
+	bool WindowNewtonSolver( false ); // TRUE if bare glazing face temperatures are found by Newton's method
+	bool HAMTBandSolver( false ); // TRUE if the HAMT cells of a surface are solved together as band matrices in substeps
 	int OverallHeatTransferSolutionAlgo( UseCTF ); // UseCTF Solution, UseEMPD moisture solution, UseCondFD solution
 	int NumberOfHeatTransferAlgosUsed( 1 );
 	FArray1D_int HeatTransferAlgosUsed;
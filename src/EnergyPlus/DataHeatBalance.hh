@@ -285,6 +285,9 @@ namespace DataHeatBalance {
 	extern int DefaultOutsideConvectionAlgo; // 1 = simple (ASHRAE); 2 = detailed; etc (BLAST, TARP, MOWITT, DOE-2)
 	extern int SolarDistribution; // Solar Distribution Algorithm
 	extern int InsideSurfIterations; // Counts inside surface iterations
+	extern bool InsideSurfIterExtrapolation; // TRUE if the inside surface iterations are accelerated by Aitken extrapolation
+	extern bool WindowNewtonSolver; // TRUE if bare glazing face temperatures are found by Newton's method
+	extern bool HAMTBandSolver; // TRUE if the HAMT cells of a surface are solved together as band matrices in substeps
 	extern int OverallHeatTransferSolutionAlgo; // UseCTF Solution, UseEMPD moisture solution, UseCondFD solution
 	extern int NumberOfHeatTransferAlgosUsed;
 	extern FArray1D_int HeatTransferAlgosUsed;
@@ -1,3 +1,6 @@
+// C++ Headers
+#include <algorithm>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
 
@@ -344,6 +347,7 @@ namespace DataPlant {
 
 	int PlantManageSubIterations( 0 ); // tracks plant iterations to characterize solver
 	int PlantManageHalfLoopCalls( 0 ); // tracks number of half loop calls
+	int PlantManageHalfLoopSkips( 0 ); // tracks number of half loop calls skipped because nothing they see changed
 
 	// two-way common pipe variables
 	//REAL(r64),SAVE,ALLOCATABLE,DIMENSION(:)    :: CurSecCPLegFlow    !Mass flow rate in primary common pipe leg
@@ -718,6 +722,86 @@ namespace DataPlant {
 
 	}
 
+	void
+	GatherHalfLoopState(
+		int const LoopNum,
+		std::vector< Real64 > & State // Node states seen by the half loops of this loop
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Collects the node states a half loop solution of this loop depends on, so that the plant
+		// manager can tell whether solving a half loop again would see anything new.
+
+		// METHODOLOGY EMPLOYED:
+		// The temperatures, flows, flow limits, pressures and setpoints of all nodes on both sides of
+		// the loop, and of the loops connected to it through components such as chiller condensers,
+		// are listed along with the flow locks.  The sensor nodes read by the operation schemes of
+		// these loops (the reference nodes of the temperature difference schemes and the demand and
+		// setpoint nodes of the component setpoint schemes) are listed too, as they need not be on
+		// any of the loops.  Two states compare equal only if every value is the same.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataLoopNode::Node;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::vector< int > LoopNums( 1, LoopNum ); // This loop and the loops connected to it
+		std::vector< int > NodeNums; // Nodes whose states are listed
+
+		State.clear();
+		for ( int LoopSideNum = DemandSide; LoopSideNum <= SupplySide; ++LoopSideNum ) {
+			auto const & loop_side( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
+			for ( int ConnectNum = 1; ConnectNum <= loop_side.TotalConnected; ++ConnectNum ) {
+				int const ConnectedLoopNum( loop_side.Connected( ConnectNum ).LoopNum );
+				if ( ConnectedLoopNum > 0 && std::find( LoopNums.begin(), LoopNums.end(), ConnectedLoopNum ) == LoopNums.end() ) {
+					LoopNums.push_back( ConnectedLoopNum );
+				}
+			}
+		}
+
+		for ( int const StateLoopNum : LoopNums ) {
+			auto const & this_loop( PlantLoop( StateLoopNum ) );
+			for ( int LoopSideNum = DemandSide; LoopSideNum <= SupplySide; ++LoopSideNum ) {
+				auto const & loop_side( this_loop.LoopSide( LoopSideNum ) );
+				State.push_back( loop_side.FlowLock );
+				for ( int BranchNum = 1; BranchNum <= loop_side.TotalBranches; ++BranchNum ) {
+					auto const & branch( loop_side.Branch( BranchNum ) );
+					for ( int CompNum = 1; CompNum <= branch.TotalComponents; ++CompNum ) {
+						NodeNums.push_back( branch.Comp( CompNum ).NodeNumIn );
+						NodeNums.push_back( branch.Comp( CompNum ).NodeNumOut );
+					}
+				}
+			}
+			for ( int SchemeNum = 1, SchemeNum_end = this_loop.OpScheme.size(); SchemeNum <= SchemeNum_end; ++SchemeNum ) {
+				auto const & op_scheme( this_loop.OpScheme( SchemeNum ) );
+				NodeNums.push_back( op_scheme.ReferenceNodeNumber );
+				for ( int ListNum = 1, ListNum_end = op_scheme.EquipList.size(); ListNum <= ListNum_end; ++ListNum ) {
+					auto const & equip_list( op_scheme.EquipList( ListNum ) );
+					for ( int CompNum = 1, CompNum_end = equip_list.Comp.size(); CompNum <= CompNum_end; ++CompNum ) {
+						NodeNums.push_back( equip_list.Comp( CompNum ).DemandNodeNum );
+						NodeNums.push_back( equip_list.Comp( CompNum ).SetPointNodeNum );
+					}
+				}
+			}
+		}
+
+		for ( int const NodeNum : NodeNums ) {
+			if ( NodeNum <= 0 ) continue;
+			auto const & node( Node( NodeNum ) );
+			State.insert( State.end(), { node.Temp, node.HumRat, node.Quality, node.Press, node.MassFlowRate, node.MassFlowRateRequest, node.MassFlowRateMinAvail, node.MassFlowRateMaxAvail, node.TempSetPoint, node.TempSetPointHi, node.TempSetPointLo } );
+		}
+
+	}
+
 	int
 	GetLoopSidePumpIndex(
 		int const LoopNum,
@@ -1,6 +1,9 @@
 #ifndef DataPlant_hh_INCLUDED
 #define DataPlant_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/Fmath.hh>
@@ -358,6 +361,7 @@ namespace DataPlant {
 
 	extern int PlantManageSubIterations; // tracks plant iterations to characterize solver
 	extern int PlantManageHalfLoopCalls; // tracks number of half loop calls
+	extern int PlantManageHalfLoopSkips; // tracks number of half loop calls skipped because nothing they see changed
 
 	// two-way common pipe variables
 	//REAL(r64),SAVE,ALLOCATABLE,DIMENSION(:)    :: CurSecCPLegFlow    !Mass flow rate in primary common pipe leg
@@ -893,6 +897,8 @@ namespace DataPlant {
 		EquipListCompData() :
 			TypeOf_Num( 0 ),
 			SetPointFlowRate( 0.0 ),
+			DemandNodeNum( 0 ),
+			SetPointNodeNum( 0 ),
 			EMSIntVarRemainingLoadValue( 0.0 ),
 			EMSActuatorDispatchedLoadValue( 0.0 )
 		{}
@@ -997,6 +1003,7 @@ namespace DataPlant {
 			NumEquipLists( 0 ),
 			CurListPtr( 0 ),
 			EquipListNumForLastStage( 0 ),
+			ReferenceNodeNumber( 0 ),
 			ErlSimProgramMngr( 0 ),
 			ErlInitProgramMngr( 0 ),
 			EMSIntVarLoopDemandRate( 0.0 ),
@@ -2347,6 +2354,12 @@ namespace DataPlant {
 	void
 	SetAllPlantSimFlagsToValue( bool const Value );
 
+	void
+	GatherHalfLoopState(
+		int const LoopNum,
+		std::vector< Real64 > & State // Node states seen by the half loops of this loop
+	);
+
 	int
 	GetLoopSidePumpIndex(
 		int const LoopNum,
@@ -279,6 +279,7 @@ namespace DataSurfaces {
 	// MODULE VARIABLE DECLARATIONS:
 
 	int TotSurfaces( 0 ); // Total number of surfaces (walls, floors, roofs, windows, shading surfaces, etc.--everything)
+	int SurfaceGeometryGeneration( 0 ); // Incremented each time GetSurfaceData sets up the surface geometry
 	int TotWindows( 0 ); // Total number of windows
 	int TotComplexWin( 0 ); // Total number of windows with complex optical properties
 	int TotStormWin( 0 ); // Total number of storm window blocks
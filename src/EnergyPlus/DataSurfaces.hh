@@ -263,6 +263,7 @@ namespace DataSurfaces {
 	// MODULE VARIABLE DECLARATIONS:
 
 	extern int TotSurfaces; // Total number of surfaces (walls, floors, roofs, windows, shading surfaces, etc.--everything)
+	extern int SurfaceGeometryGeneration; // Incremented each time GetSurfaceData sets up the surface geometry
 	extern int TotWindows; // Total number of windows
 	extern int TotComplexWin; // Total number of windows with complex optical properties
 	extern int TotStormWin; // Total number of storm window blocks
@@ -1152,6 +1153,7 @@ namespace DataSurfaces {
 		Real64 AirflowThisTS; // Gap airflow this timestep (m3/s per m of glazing width)
 		Real64 TAirflowGapOutlet; // Temperature of air leaving airflow gap between glass panes (C)
 		int WindowCalcIterationsRep; // Number of iterations in window heat balance calculation
+		Real64 WindowCalcResidualRep; // Largest glass face heat balance residual left by the Newton window solver [W/m2]
 		Real64 BmSolTransThruIntWinRep; // Beam solar transmitted through interior window [W]
 		Real64 VentingOpenFactorRep; // Window/door venting open factor, for reporting
 		Real64 VentingOpenFactorMultRep; // Window/door opening modulation multiplier on venting open factor, for reporting
@@ -1335,6 +1337,7 @@ namespace DataSurfaces {
 			AirflowThisTS( 0.0 ),
 			TAirflowGapOutlet( 0.0 ),
 			WindowCalcIterationsRep( 0 ),
+			WindowCalcResidualRep( 0.0 ),
 			BmSolTransThruIntWinRep( 0.0 ),
 			VentingOpenFactorRep( 0.0 ),
 			VentingOpenFactorMultRep( 0.0 ),
@@ -1510,6 +1513,7 @@ namespace DataSurfaces {
 			Real64 const AirflowThisTS, // Gap airflow this timestep (m3/s per m of glazing width)
 			Real64 const TAirflowGapOutlet, // Temperature of air leaving airflow gap between glass panes (C)
 			int const WindowCalcIterationsRep, // Number of iterations in window heat balance calculation
+			Real64 const WindowCalcResidualRep, // Largest glass face heat balance residual left by the Newton window solver [W/m2]
 			Real64 const BmSolTransThruIntWinRep, // Beam solar transmitted through interior window [W]
 			Real64 const VentingOpenFactorRep, // Window/door venting open factor, for reporting
 			Real64 const VentingOpenFactorMultRep, // Window/door opening modulation multiplier on venting open factor, for reporting
@@ -1683,6 +1687,7 @@ namespace DataSurfaces {
 			AirflowThisTS( AirflowThisTS ),
 			TAirflowGapOutlet( TAirflowGapOutlet ),
 			WindowCalcIterationsRep( WindowCalcIterationsRep ),
+			WindowCalcResidualRep( WindowCalcResidualRep ),
 			BmSolTransThruIntWinRep( BmSolTransThruIntWinRep ),
 			VentingOpenFactorRep( VentingOpenFactorRep ),
 			VentingOpenFactorMultRep( VentingOpenFactorMultRep ),
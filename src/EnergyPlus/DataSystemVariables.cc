@@ -85,8 +85,13 @@ namespace DataSystemVariables {
 	// solutions of all controllers on each air loop at each call to SimAirLoop()
 	std::string const TraceHVACControllerEnvVar( "TRACE_HVACCONTROLLER" ); // To generate a trace file for
 	//  each individual HVAC controller with all controller iterations
+	std::string const TraceHCClippingEnvVar( "TRACE_HCCLIPPING" ); // To generate a file with the polygon pairs
+	//  clipped in the shadowing calculations
 
 	std::string const MinReportFrequencyEnvVar( "MINREPORTFREQUENCY" ); // environment var for reporting frequency.
+	std::string const ShadingCacheEnvVar( "SHADING_CACHE" ); // environment var naming the shading result cache file
+	std::string const CTFCacheEnvVar( "CTF_CACHE" ); // environment var naming the conduction transfer function cache file
+	std::string const GlazingOpticsCacheEnvVar( "GLAZING_OPTICS_CACHE" ); // environment var naming the glazing optical properties cache file
 	std::string const cDisplayInputInAuditEnvVar( "DISPLAYINPUTINAUDIT" ); // environmental variable that enables the echoing of the input file into the audit file
 
 	// DERIVED TYPE DEFINITIONS
@@ -104,12 +109,16 @@ namespace DataSystemVariables {
 	bool SutherlandHodgman( true ); // TRUE if SutherlandHodgman algorithm for polygon clipping is to be used.
 	bool DetailedSkyDiffuseAlgorithm( false ); // use detailed diffuse shading algorithm for sky (shading transmittance varies)
 	bool DetailedSolarTimestepIntegration( false ); // when true, use detailed timestep integration for all solar,shading, etc.
+	bool PixelCountingShading( false ); // TRUE if beam shading is computed by pixel counting instead of polygon clipping
+	int PixelCountingResolution( 512 ); // Pixels along the longest side of each receiving surface for pixel counting
 	bool TrackAirLoopEnvFlag( false ); // If TRUE generates a file with runtime statistics for each HVAC
 	//  controller on each air loop
 	bool TraceAirLoopEnvFlag( false ); // If TRUE generates a trace file with the converged solutions of all
 	// HVAC controllers on each air loop at each call to SimAirLoop()
 	bool TraceHVACControllerEnvFlag( false ); // If TRUE generates a trace file for each individual HVAC
 	// controller with all controller iterations
+	bool TraceHCClippingEnvFlag( false ); // If TRUE generates a file with the polygon pairs clipped in the
+	// shadowing calculations
 	bool ReportDuringWarmup( false ); // True when the report outputs even during warmup
 	bool ReportDuringHVACSizingSimulation ( false ); // true when reporting outputs during HVAC sizing Simulation
 	bool ReportDetailedWarmupConvergence( false ); // True when the detailed warmup convergence is requested
@@ -120,6 +129,9 @@ namespace DataSystemVariables {
 	Real64 Time_Finish( 0.0 ); // Call to CPU_Time for end time of simulation
 	std::string cMinReportFrequency; // String for minimum reporting frequency
 	int MinReportFrequency( -2 ); // Frequency var turned into integer during get report var input.
+	std::string ShadingCacheFileName; // Shading result cache file (empty if none)
+	std::string CTFCacheFileName; // Conduction transfer function cache file (empty if none)
+	std::string GlazingOpticsCacheFileName; // Glazing optical properties cache file (empty if none)
 	bool SortedIDD( true ); // after processing, use sorted IDD to obtain Defs, etc.
 	bool lMinimalShadowing( false ); // TRUE if MinimalShadowing is to override Solar Distribution flag
 	std::string TempFullFileName;
@@ -54,8 +54,13 @@ namespace DataSystemVariables {
 	// solutions of all controllers on each air loop at each call to SimAirLoop()
 	extern std::string const TraceHVACControllerEnvVar; // To generate a trace file for
 	//  each individual HVAC controller with all controller iterations
+	extern std::string const TraceHCClippingEnvVar; // To generate a file with the polygon pairs
+	//  clipped in the shadowing calculations
 
 	extern std::string const MinReportFrequencyEnvVar; // environment var for reporting frequency.
+	extern std::string const ShadingCacheEnvVar; // environment var naming the shading result cache file
+	extern std::string const CTFCacheEnvVar; // environment var naming the conduction transfer function cache file
+	extern std::string const GlazingOpticsCacheEnvVar; // environment var naming the glazing optical properties cache file
 	extern std::string const cDisplayInputInAuditEnvVar; // environmental variable that enables the echoing of the input file into the audit file
 
 	// DERIVED TYPE DEFINITIONS
@@ -73,12 +78,16 @@ namespace DataSystemVariables {
 	extern bool SutherlandHodgman; // TRUE if SutherlandHodgman algorithm for polygon clipping is to be used.
 	extern bool DetailedSkyDiffuseAlgorithm; // use detailed diffuse shading algorithm for sky (shading transmittance varies)
 	extern bool DetailedSolarTimestepIntegration; // when true, use detailed timestep integration for all solar,shading, etc.
+	extern bool PixelCountingShading; // TRUE if beam shading is computed by pixel counting instead of polygon clipping
+	extern int PixelCountingResolution; // Pixels along the longest side of each receiving surface for pixel counting
 	extern bool TrackAirLoopEnvFlag; // If TRUE generates a file with runtime statistics for each HVAC
 	//  controller on each air loop
 	extern bool TraceAirLoopEnvFlag; // If TRUE generates a trace file with the converged solutions of all
 	// HVAC controllers on each air loop at each call to SimAirLoop()
 	extern bool TraceHVACControllerEnvFlag; // If TRUE generates a trace file for each individual HVAC
 	// controller with all controller iterations
+	extern bool TraceHCClippingEnvFlag; // If TRUE generates a file with the polygon pairs clipped in the
+	// shadowing calculations
 	extern bool ReportDuringWarmup; // True when the report outputs even during warmup
 	extern bool ReportDuringHVACSizingSimulation; // true when reporting outputs during HVAC sizing Simulation
 	extern bool ReportDetailedWarmupConvergence; // True when the detailed warmup convergence is requested
@@ -89,6 +98,9 @@ namespace DataSystemVariables {
 	extern Real64 Time_Finish; // Call to CPU_Time for end time of simulation
 	extern std::string cMinReportFrequency; // String for minimum reporting frequency
 	extern int MinReportFrequency; // Frequency var turned into integer during get report var input.
+	extern std::string ShadingCacheFileName; // Shading result cache file (empty if none)
+	extern std::string CTFCacheFileName; // Conduction transfer function cache file (empty if none)
+	extern std::string GlazingOpticsCacheFileName; // Glazing optical properties cache file (empty if none)
 	extern bool SortedIDD; // after processing, use sorted IDD to obtain Defs, etc.
 	extern bool lMinimalShadowing; // TRUE if MinimalShadowing is to override Solar Distribution flag
 	extern std::string TempFullFileName;
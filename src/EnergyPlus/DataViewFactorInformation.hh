@@ -1,6 +1,9 @@
 #ifndef DataViewFactorInformation_hh_INCLUDED
 #define DataViewFactorInformation_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/FArray2D.hh>
@@ -25,6 +28,22 @@ namespace DataViewFactorInformation {
 
 	// Types
 
+	struct ScriptFCoefficients // Exchange coefficients of a zone for one set of inside surface emissivities
+	{
+		// Members
+		std::vector< Real64 > Emissivity; // Inside surface emissivities the coefficients were found for
+		std::vector< Real64 > Sym; // Stefan-Boltzmann constant * Area * ScriptF, symmetric (see FormSymmetricScriptF)
+		std::vector< Real64 > RowSum; // Stefan-Boltzmann constant * sum of each row of ScriptF
+		bool Reciprocal; // True if Sym is used; false if ScriptF is not reciprocal and Full is used
+		std::vector< Real64 > Full; // Stefan-Boltzmann constant * Area * ScriptF, all of it (see FormFullScriptF)
+
+		// Default Constructor
+		ScriptFCoefficients() :
+			Reciprocal( true )
+		{}
+
+	};
+
 	struct ZoneViewFactorInformation
 	{
 		// Members
@@ -38,10 +57,15 @@ namespace DataViewFactorInformation {
 		FArray1D< Real64 > Tilt; // Tilt angle of the surface (in degrees)
 		FArray1D_int SurfacePtr; // Surface ALLOCATABLE (to Surface derived type)
 		FArray1D_string Class; // Class of surface (Wall, Roof, etc.)
+		std::vector< ScriptFCoefficients > ScriptFCache; // Exchange coefficients of the emissivity sets seen so far
+		int CurrentScriptF; // Entry of ScriptFCache in use (-1 if none yet)
+		int NextScriptF; // Entry of ScriptFCache replaced next once it is full
 
 		// Default Constructor
 		ZoneViewFactorInformation() :
-			NumOfSurfaces( 0 )
+			NumOfSurfaces( 0 ),
+			CurrentScriptF( -1 ),
+			NextScriptF( 0 )
 		{}
 
 		// Member Constructor
@@ -66,7 +90,9 @@ namespace DataViewFactorInformation {
 			Azimuth( Azimuth ),
 			Tilt( Tilt ),
 			SurfacePtr( SurfacePtr ),
-			Class( Class )
+			Class( Class ),
+			CurrentScriptF( -1 ),
+			NextScriptF( 0 )
 		{}
 
 	};
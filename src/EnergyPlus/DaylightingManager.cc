@@ -1,7 +1,9 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -35,8 +37,11 @@
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
 #include <ScheduleManager.hh>
+#include <ShadingCache.hh>
 #include <SolarReflectionManager.hh>
+#include <SolarShading.hh>
 #include <SQLiteProcedures.hh>
+#include <SurfaceBVH.hh>
 #include <UtilityRoutines.hh>
 #include <Vectors.hh>
 #include <WindowComplexManager.hh>
@@ -103,6 +108,7 @@ namespace DaylightingManager {
 	using DataBSDFWindow::ComplexWind;
 
 	using namespace ScheduleManager;
+	using SurfaceBVH::SurfacesAlongRay;
 	//USE Vectors
 
 	// Data
@@ -110,13 +116,15 @@ namespace DaylightingManager {
 	static std::string const BlankString;
 
 	// MODULE VARIABLE DECLARATIONS:
+	// The sun angles and the illuminance work arrays are thread_local so that CalcDayltgCoefficients
+	// can find the daylight factors of separate zones in parallel.
 	int TotWindowsWithDayl( 0 ); // Total number of exterior windows in all daylit zones
 	int OutputFileDFS( 0 ); // Unit number for daylight factors
 	FArray1D< Real64 > DaylIllum( MaxRefPoints, 0.0 ); // Daylight illuminance at reference points (lux)
-	Real64 PHSUN( 0.0 ); // Solar altitude (radians)
-	Real64 SPHSUN( 0.0 ); // Sine of solar altitude
-	Real64 CPHSUN( 0.0 ); // Cosine of solar altitude
-	Real64 THSUN( 0.0 ); // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
+	thread_local Real64 PHSUN( 0.0 ); // Solar altitude (radians)
+	thread_local Real64 SPHSUN( 0.0 ); // Sine of solar altitude
+	thread_local Real64 CPHSUN( 0.0 ); // Cosine of solar altitude
+	thread_local Real64 THSUN( 0.0 ); // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
 	FArray1D< Real64 > PHSUNHR( 24, 0.0 ); // Hourly values of PHSUN
 	FArray1D< Real64 > SPHSUNHR( 24, 0.0 ); // Hourly values of the sine of PHSUN
 	FArray1D< Real64 > CPHSUNHR( 24, 0.0 ); // Hourly values of the cosine of PHSUN
@@ -126,24 +134,24 @@ namespace DaylightingManager {
 	// I = 1 for clear sky, 2 for clear turbid, 3 for intermediate, 4 for overcast;
 	// J = 1 for bare window, 2 - 12 for shaded;
 	// K = sun position index.
-	FArray3D< Real64 > EINTSK( 4, MaxSlatAngs+1, 24, 0.0 ); // Sky-related portion of internally reflected illuminance
-	FArray2D< Real64 > EINTSU( MaxSlatAngs+1, 24, 0.0 ); // Sun-related portion of internally reflected illuminance,
+	thread_local FArray3D< Real64 > EINTSK( 4, MaxSlatAngs+1, 24, 0.0 ); // Sky-related portion of internally reflected illuminance
+	thread_local FArray2D< Real64 > EINTSU( MaxSlatAngs+1, 24, 0.0 ); // Sun-related portion of internally reflected illuminance,
 	// excluding entering beam
-	FArray2D< Real64 > EINTSUdisk( MaxSlatAngs+1, 24, 0.0 ); // Sun-related portion of internally reflected illuminance
+	thread_local FArray2D< Real64 > EINTSUdisk( MaxSlatAngs+1, 24, 0.0 ); // Sun-related portion of internally reflected illuminance
 	// due to entering beam
-	FArray3D< Real64 > WLUMSK( 4, MaxSlatAngs+1, 24, 0.0 ); // Sky-related window luminance
-	FArray2D< Real64 > WLUMSU( MaxSlatAngs+1, 24, 0.0 ); // Sun-related window luminance, excluding view of solar disk
-	FArray2D< Real64 > WLUMSUdisk( MaxSlatAngs+1, 24, 0.0 ); // Sun-related window luminance, due to view of solar disk
+	thread_local FArray3D< Real64 > WLUMSK( 4, MaxSlatAngs+1, 24, 0.0 ); // Sky-related window luminance
+	thread_local FArray2D< Real64 > WLUMSU( MaxSlatAngs+1, 24, 0.0 ); // Sun-related window luminance, excluding view of solar disk
+	thread_local FArray2D< Real64 > WLUMSUdisk( MaxSlatAngs+1, 24, 0.0 ); // Sun-related window luminance, due to view of solar disk
 
 	FArray2D< Real64 > GILSK( 4, 24, 0.0 ); // Horizontal illuminance from sky, by sky type, for each hour of the day
 	FArray1D< Real64 > GILSU( 24, 0.0 ); // Horizontal illuminance from sun for each hour of the day
 
-	FArray3D< Real64 > EDIRSK( 4, MaxSlatAngs+1, 24 ); // Sky-related component of direct illuminance
-	FArray2D< Real64 > EDIRSU( MaxSlatAngs+1, 24 ); // Sun-related component of direct illuminance (excluding beam solar at ref pt)
-	FArray2D< Real64 > EDIRSUdisk( MaxSlatAngs+1, 24 ); // Sun-related component of direct illuminance due to beam solar at ref pt
-	FArray3D< Real64 > AVWLSK( 4, MaxSlatAngs+1, 24 ); // Sky-related average window luminance
-	FArray2D< Real64 > AVWLSU( MaxSlatAngs+1, 24 ); // Sun-related average window luminance, excluding view of solar disk
-	FArray2D< Real64 > AVWLSUdisk( MaxSlatAngs+1, 24 ); // Sun-related average window luminance due to view of solar disk
+	thread_local FArray3D< Real64 > EDIRSK( 4, MaxSlatAngs+1, 24 ); // Sky-related component of direct illuminance
+	thread_local FArray2D< Real64 > EDIRSU( MaxSlatAngs+1, 24 ); // Sun-related component of direct illuminance (excluding beam solar at ref pt)
+	thread_local FArray2D< Real64 > EDIRSUdisk( MaxSlatAngs+1, 24 ); // Sun-related component of direct illuminance due to beam solar at ref pt
+	thread_local FArray3D< Real64 > AVWLSK( 4, MaxSlatAngs+1, 24 ); // Sky-related average window luminance
+	thread_local FArray2D< Real64 > AVWLSU( MaxSlatAngs+1, 24 ); // Sun-related average window luminance, excluding view of solar disk
+	thread_local FArray2D< Real64 > AVWLSUdisk( MaxSlatAngs+1, 24 ); // Sun-related average window luminance due to view of solar disk
 
 	// Allocatable daylight factor arrays  -- are in the ZoneDaylight Structure
 
@@ -157,6 +165,7 @@ namespace DaylightingManager {
 	FArray1D_bool CheckTDDZone;
 
 	std::string mapLine; // character variable to hold map outputs
+	std::uint64_t DayltgInputHash( 0 ); // Hash of the daylighting inputs starting each shading result cache record key
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE DaylightingModule
 
@@ -459,6 +468,11 @@ namespace DaylightingManager {
 
 		static bool CreateDFSReportFile( true );
 		static bool doSkyReporting( true );
+		static std::vector< std::vector< int > > ZoneGroups; // Daylit zones that share exterior windows
+		int MapNum; // Illuminance map counter
+		int MaxMapPoints; // Largest number of points in an illuminance map
+		int PipeNum; // TDD pipe object number
+		bool ErrorsFound; // True if a TDD:DOME has no pipe
 
 		// Formats
 		static gio::Fmt Format_700( "('! <Sky Daylight Factors>, MonthAndDay, Zone Name, Window Name, Daylight Fac: Ref Pt #1, Daylight Fac: Ref Pt #2')" );
@@ -469,6 +483,42 @@ namespace DaylightingManager {
 			CheckTDDsAndLightShelvesInDaylitZones();
 			firstTime = false;
 			if ( allocated( CheckTDDZone ) ) CheckTDDZone.deallocate();
+
+			// make sure all necessary surfaces match to pipes
+			ErrorsFound = false;
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				for ( loop = 1; loop <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loop ) {
+					IWin = ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop );
+					if ( SurfaceWindow( IWin ).OriginalClass != SurfaceClass_TDD_Diffuser ) continue;
+					// Look up the TDD:DOME object
+					PipeNum = FindTDDPipe( IWin );
+					if ( PipeNum == 0 ) {
+						ShowSevereError( "GetTDDInput: Surface=" + Surface( IWin ).Name + ", TDD:Dome object does not reference a valid Diffuser object." );
+						ShowContinueError( "...needs DaylightingDevice:Tubular of same name as Surface." );
+						ErrorsFound = true;
+					}
+				}
+			}
+
+			if ( ErrorsFound ) {
+				ShowFatalError( "Not all TubularDaylightDome objects have corresponding DaylightingDevice:Tubular objects. Program terminates." );
+			}
+
+			// Message flags are allocated here rather than in the zone loop, which may run in parallel
+			if ( any_gt( ZoneDaylight.TotalDaylRefPoints(), 0 ) ) {
+				RefErrIndex.allocate( TotSurfaces, maxval( ZoneDaylight.TotalDaylRefPoints() ) );
+				RefErrIndex = 0;
+			}
+			if ( TotIllumMaps > 0 ) {
+				MaxMapPoints = -999;
+				for ( MapNum = 1; MapNum <= TotIllumMaps; ++MapNum ) {
+					MaxMapPoints = max( MaxMapPoints, IllumMapCalc( MapNum ).TotalMapRefPoints );
+				}
+				MapErrIndex.allocate( TotSurfaces, MaxMapPoints );
+				MapErrIndex = 0;
+			}
+
+			FindDayltgZoneGroups( ZoneGroups );
 		} // End of check if firstTime
 
 		// Find the total number of exterior windows associated with all Daylighting:Detailed zones.
@@ -527,6 +577,9 @@ namespace DaylightingManager {
 				}
 			}
 
+			// Daylight factors are kept in the shading result cache together with the shading results
+			if ( ShadingCache::CacheStatus != ShadingCache::CacheDisabled ) DayltgInputHash = DayltgCoeffInputHash();
+
 		}
 
 		// Zero daylighting factor arrays
@@ -599,18 +652,69 @@ namespace DaylightingManager {
 		// ---------- ZONE LOOP ----------
 		//           -----------
 
-		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
-			// Skip zones that are not Daylighting:Detailed zones.
-			// TotalDaylRefPoints = 0 means zone has (1) no daylighting or
-			// (3) Daylighting:DElight
-			if ( ZoneDaylight( ZoneNum ).TotalDaylRefPoints == 0 ) continue;
+		if ( ! DoingSizing && ! KickOffSimulation && TotIllumMaps > 0 ) {
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				if ( ZoneDaylight( ZoneNum ).TotalDaylRefPoints == 0 || ZoneDaylight( ZoneNum ).NumOfDayltgExtWins == 0 ) continue;
+				for ( MapNum = 1; MapNum <= TotIllumMaps; ++MapNum ) {
+					if ( IllumMapCalc( MapNum ).Zone != ZoneNum ) continue;
+					if ( WarmupFlag ) {
+						DisplayString( "Calculating Daylighting Coefficients (Map Points), Zone=" + Zone( ZoneNum ).Name );
+					} else {
+						DisplayString( "Updating Daylighting Coefficients (Map Points), Zone=" + Zone( ZoneNum ).Name );
+					}
+				}
+			}
+		}
 
-			// Skip zones with no exterior windows in the zone or in adjacent zone with which an interior window is shared
-			if ( ZoneDaylight( ZoneNum ).NumOfDayltgExtWins == 0 ) continue;
+		if ( ! DetailedSolarTimestepIntegration ) {
+			// Each group of zones writes only its own daylight factors (and those of its windows), so the
+			// groups can run in parallel; within a group zones run in order, as in the serial loop below.
+			// The factors of a group are read from the shading result cache when its inputs are unchanged.
+			int const NumGroups( ZoneGroups.size() );
+			bool const MapsIncluded( ! DoingSizing && ! KickOffSimulation && TotIllumMaps > 0 );
+			bool const UseCache( ShadingCache::CacheStatus != ShadingCache::CacheDisabled );
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic )
+#endif
+			for ( int Group = 0; Group < NumGroups; ++Group ) {
+				std::vector< int > const & Zones( ZoneGroups[ Group ] );
+				bool const Cacheable( UseCache && DayltgCoeffsCacheable( Zones ) );
+				std::uint64_t RecordKey( 0 );
+				ShadingCache::ShadingRecord Record;
+				if ( Cacheable ) {
+					bool Found;
+					RecordKey = DayltgCoeffRecordKey( Zones, MapsIncluded );
+#ifdef _OPENMP
+#pragma omp critical( DayltgCoeffCache )
+#endif
+					Found = ShadingCache::GetShadingRecord( RecordKey, Record );
+					if ( Found && UnpackDayltgCoeffRecord( Zones, MapsIncluded, Record ) ) continue;
+				}
+				for ( int const GroupZoneNum : Zones ) {
+					CalcDayltgCoeffsRefMapPoints( GroupZoneNum );
+				}
+				if ( Cacheable ) {
+					PackDayltgCoeffRecord( Zones, MapsIncluded, Record );
+#ifdef _OPENMP
+#pragma omp critical( DayltgCoeffCache )
+#endif
+					ShadingCache::SaveShadingRecord( RecordKey, Record );
+				}
+			}
+		} else { // Sun-up tracking in CalcDayltgCoeffsRefPoints depends on the order of the zones
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				// Skip zones that are not Daylighting:Detailed zones.
+				// TotalDaylRefPoints = 0 means zone has (1) no daylighting or
+				// (3) Daylighting:DElight
+				if ( ZoneDaylight( ZoneNum ).TotalDaylRefPoints == 0 ) continue;
 
-			CalcDayltgCoeffsRefMapPoints( ZoneNum );
+				// Skip zones with no exterior windows in the zone or in adjacent zone with which an interior window is shared
+				if ( ZoneDaylight( ZoneNum ).NumOfDayltgExtWins == 0 ) continue;
 
-		} // End of zone loop, ZoneNum
+				CalcDayltgCoeffsRefMapPoints( ZoneNum );
+
+			} // End of zone loop, ZoneNum
+		}
 
 		if ( doSkyReporting ) {
 			if ( ! KickOffSizing && ! KickOffSimulation ) {
@@ -762,6 +866,535 @@ namespace DaylightingManager {
 
 	}
 
+	void
+	FindDayltgZoneGroups( std::vector< std::vector< int > > & ZoneGroups ) // Daylit zones that share exterior windows
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Groups the Daylighting:Detailed zones so that no exterior window is used by zones in
+		// different groups.  Finding daylight factors writes to the window (SurfaceWindow, ComplexWind,
+		// TDD pipe) as well as to the zone, so only separate groups can be computed in parallel.
+
+		// METHODOLOGY EMPLOYED:
+		// Union-find over zones, joining each zone to the first zone found using the same exterior
+		// window (through an interior window).  Groups are listed in order of their first zone and
+		// hold their zones in increasing order, so each group repeats the serial order.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray1D_int FirstZone( TotSurfaces, 0 ); // First daylit zone found using each exterior window
+		FArray1D_int Root( NumOfZones ); // Zone leading the group of each zone (union-find parent)
+		std::vector< int > GroupOfRoot( NumOfZones + 1, -1 ); // Index in ZoneGroups of each leading zone
+
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			Root( ZoneNum ) = ZoneNum;
+		}
+
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( ZoneDaylight( ZoneNum ).TotalDaylRefPoints == 0 || ZoneDaylight( ZoneNum ).NumOfDayltgExtWins == 0 ) continue;
+			for ( int loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
+				int const IWin( ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loopwin ) );
+				if ( FirstZone( IWin ) == 0 ) {
+					FirstZone( IWin ) = ZoneNum;
+					continue;
+				}
+				int Root1( FirstZone( IWin ) );
+				while ( Root( Root1 ) != Root1 ) Root1 = Root( Root1 );
+				int Root2( ZoneNum );
+				while ( Root( Root2 ) != Root2 ) Root2 = Root( Root2 );
+				Root( max( Root1, Root2 ) ) = min( Root1, Root2 );
+			}
+		}
+
+		ZoneGroups.clear();
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( ZoneDaylight( ZoneNum ).TotalDaylRefPoints == 0 || ZoneDaylight( ZoneNum ).NumOfDayltgExtWins == 0 ) continue;
+			int ZoneRoot( ZoneNum );
+			while ( Root( ZoneRoot ) != ZoneRoot ) ZoneRoot = Root( ZoneRoot );
+			if ( GroupOfRoot[ ZoneRoot ] < 0 ) {
+				GroupOfRoot[ ZoneRoot ] = ZoneGroups.size();
+				ZoneGroups.push_back( std::vector< int >() );
+			}
+			ZoneGroups[ GroupOfRoot[ ZoneRoot ] ].push_back( ZoneNum );
+		}
+
+	}
+
+	bool
+	DayltgCoeffsCacheable( std::vector< int > const & Zones ) // Daylit zones of one group
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if the daylight factors of a group of zones can be kept in the shading result
+		// cache.  Complex fenestration (BSDF) windows keep daylighting geometry of their own in
+		// ComplexWind, which is not cached, so groups using them are always calculated.
+
+		for ( int const ZoneNum : Zones ) {
+			for ( int loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
+				if ( SurfaceWindow( ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loopwin ) ).WindowModelType == WindowBSDFModel ) return false;
+			}
+		}
+		return true;
+
+	}
+
+	std::uint64_t
+	HashDayltgArray(
+		std::uint64_t const Hash,
+		FArray< Real64 > const & Values
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Continues a shading result cache hash chain with the size and values of an array.
+
+		// Using/Aliasing
+		using ShadingCache::HashValue;
+
+		std::uint64_t Result( HashValue( Hash, int( Values.size() ) ) );
+		for ( FArray< Real64 >::size_type i = 0; i < Values.size(); ++i ) {
+			Result = HashValue( Result, Values[ i ] );
+		}
+		return Result;
+
+	}
+
+	std::uint64_t
+	DayltgCoeffInputHash()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns a hash of the inputs the daylight factors depend on that are not already part of
+		// the shading result cache keys (geometry, location, timing and shading algorithm).
+
+		// METHODOLOGY EMPLOYED:
+		// Hashes the reference and map points, the interior reflectances found by
+		// DayltgAveInteriorReflectance and the visible properties of windows, shading devices,
+		// obstructions, light shelves and tubular daylighting devices.  Inputs that change during
+		// the run (sun position, ground reflectance, storm windows, obstruction reflections) go into
+		// each record key instead (see DayltgCoeffRecordKey).
+
+		// Using/Aliasing
+		using ShadingCache::HashSeed;
+		using ShadingCache::HashValue;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::uint64_t Hash( HashSeed );
+
+		Hash = HashValue( Hash, BuildingAzimuth );
+		Hash = HashValue( Hash, BuildingRotationAppendixG );
+		Hash = HashValue( Hash, CalcSolRefl );
+		Hash = HashValue( Hash, MaxRefPoints );
+
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			auto const & zoneDaylight( ZoneDaylight( ZoneNum ) );
+			Hash = HashValue( Hash, Zone( ZoneNum ).RelNorth );
+			Hash = HashValue( Hash, zoneDaylight.TotalDaylRefPoints );
+			Hash = HashDayltgArray( Hash, zoneDaylight.DaylRefPtAbsCoord );
+			Hash = HashValue( Hash, zoneDaylight.ViewAzimuthForGlare );
+			Hash = HashValue( Hash, zoneDaylight.AveVisDiffReflect );
+			Hash = HashValue( Hash, zoneDaylight.TotInsSurfArea );
+			Hash = HashValue( Hash, zoneDaylight.MinIntWinSolidAng );
+			Hash = HashValue( Hash, zoneDaylight.NumOfDayltgExtWins );
+			for ( int loopwin = 1; loopwin <= zoneDaylight.NumOfDayltgExtWins; ++loopwin ) {
+				Hash = HashValue( Hash, zoneDaylight.DayltgExtWinSurfNums( loopwin ) );
+			}
+			Hash = HashValue( Hash, zoneDaylight.NumOfIntWinAdjZoneExtWins );
+			for ( int loop = 1; loop <= zoneDaylight.NumOfIntWinAdjZoneExtWins; ++loop ) {
+				auto const & adjExtWin( zoneDaylight.IntWinAdjZoneExtWin( loop ) );
+				Hash = HashValue( Hash, adjExtWin.SurfNum );
+				Hash = HashValue( Hash, adjExtWin.NumOfIntWindows );
+				for ( int IntWin = 1; IntWin <= adjExtWin.NumOfIntWindows; ++IntWin ) {
+					Hash = HashValue( Hash, adjExtWin.IntWinNum( IntWin ) );
+				}
+			}
+		}
+
+		Hash = HashValue( Hash, TotIllumMaps );
+		for ( int MapNum = 1; MapNum <= TotIllumMaps; ++MapNum ) {
+			Hash = HashValue( Hash, IllumMapCalc( MapNum ).Zone );
+			Hash = HashValue( Hash, IllumMapCalc( MapNum ).TotalMapRefPoints );
+			Hash = HashDayltgArray( Hash, IllumMapCalc( MapNum ).MapRefPtAbsCoord );
+		}
+
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			Hash = HashValue( Hash, surface.Construction );
+			if ( surface.Construction > 0 && Construct( surface.Construction ).TotLayers > 0 ) {
+				Hash = HashValue( Hash, Material( Construct( surface.Construction ).LayerPoint( 1 ) ).AbsorpVisible );
+			}
+			Hash = HashValue( Hash, surface.ShadowSurfDiffuseVisRefl );
+			Hash = HashValue( Hash, surface.ShadowSurfGlazingFrac );
+			Hash = HashValue( Hash, surface.ShadowSurfGlazingConstruct );
+			Hash = HashValue( Hash, surface.Shelf );
+			if ( surface.Class != SurfaceClass_Window ) continue;
+			Hash = HashValue( Hash, surface.StormWinConstruction );
+			Hash = HashValue( Hash, surface.ShadedConstruction );
+			Hash = HashValue( Hash, surface.StormWinShadedConstruction );
+			Hash = HashValue( Hash, surface.WindowShadingControlPtr );
+			auto const & surfaceWindow( SurfaceWindow( SurfNum ) );
+			Hash = HashValue( Hash, surfaceWindow.GlazedFrac );
+			Hash = HashValue( Hash, surfaceWindow.LightWellEff );
+			Hash = HashValue( Hash, surfaceWindow.RhoCeilingWall );
+			Hash = HashValue( Hash, surfaceWindow.RhoFloorWall );
+			Hash = HashValue( Hash, surfaceWindow.FractionUpgoing );
+			Hash = HashValue( Hash, surfaceWindow.MovableSlats );
+			Hash = HashValue( Hash, surfaceWindow.SolarDiffusing );
+			Hash = HashValue( Hash, surfaceWindow.OriginalClass );
+			Hash = HashValue( Hash, surfaceWindow.WindowModelType );
+			Hash = HashValue( Hash, surfaceWindow.BlindNumber );
+			Hash = HashValue( Hash, surfaceWindow.ScreenNumber );
+		}
+
+		for ( int ShadingControlNum = 1; ShadingControlNum <= TotWinShadingControl; ++ShadingControlNum ) {
+			Hash = HashValue( Hash, WindowShadingControl( ShadingControlNum ).ShadingType );
+			Hash = HashValue( Hash, WindowShadingControl( ShadingControlNum ).ShadedConstruction );
+			Hash = HashValue( Hash, WindowShadingControl( ShadingControlNum ).ShadingDevice );
+		}
+
+		for ( int ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum ) {
+			auto const & construct( Construct( ConstrNum ) );
+			Hash = HashValue( Hash, construct.TypeIsWindow );
+			if ( ! construct.TypeIsWindow ) continue;
+			Hash = HashValue( Hash, construct.TotGlassLayers );
+			Hash = HashValue( Hash, construct.TCFlag );
+			Hash = HashValue( Hash, construct.TransDiffVis );
+			Hash = HashValue( Hash, construct.ReflectVisDiffFront );
+			Hash = HashValue( Hash, construct.ReflectVisDiffBack );
+			Hash = HashDayltgArray( Hash, construct.TransVisBeamCoef );
+			Hash = HashDayltgArray( Hash, construct.ReflSolBeamFrontCoef );
+			Hash = HashDayltgArray( Hash, construct.tBareVisCoef );
+			Hash = HashDayltgArray( Hash, construct.tBareVisDiff );
+			Hash = HashDayltgArray( Hash, construct.rfBareVisDiff );
+			Hash = HashDayltgArray( Hash, construct.rbBareVisDiff );
+		}
+
+		for ( int BlNum = 1; BlNum <= TotBlinds; ++BlNum ) {
+			auto const & blind( Blind( BlNum ) );
+			Hash = HashValue( Hash, blind.SlatOrientation );
+			Hash = HashValue( Hash, blind.SlatWidth );
+			Hash = HashValue( Hash, blind.SlatSeparation );
+			Hash = HashValue( Hash, blind.SlatThickness );
+			Hash = HashValue( Hash, blind.SlatAngle );
+			Hash = HashDayltgArray( Hash, blind.VisFrontBeamDiffTrans );
+			Hash = HashDayltgArray( Hash, blind.VisFrontBeamDiffRefl );
+			Hash = HashDayltgArray( Hash, blind.VisFrontDiffDiffTrans );
+			Hash = HashDayltgArray( Hash, blind.VisFrontDiffDiffRefl );
+			Hash = HashDayltgArray( Hash, blind.VisBackDiffDiffRefl );
+		}
+
+		for ( int ScNum = 1; ScNum <= NumSurfaceScreens; ++ScNum ) {
+			auto const & screen( SurfaceScreens( ScNum ) );
+			Hash = HashValue( Hash, screen.ReflectCylinderVis );
+			Hash = HashValue( Hash, screen.ReflectScreenVis );
+			Hash = HashValue( Hash, screen.DifReflectVis );
+			Hash = HashValue( Hash, screen.DifDifTransVis );
+			Hash = HashValue( Hash, screen.ScreenDiameterToSpacingRatio );
+			Hash = HashValue( Hash, screen.ScreenBeamReflectanceAccounting );
+		}
+
+		for ( int ShelfNum = 1; ShelfNum <= NumOfShelf; ++ShelfNum ) {
+			Hash = HashValue( Hash, Shelf( ShelfNum ).Window );
+			Hash = HashValue( Hash, Shelf( ShelfNum ).InSurf );
+			Hash = HashValue( Hash, Shelf( ShelfNum ).OutSurf );
+			Hash = HashValue( Hash, Shelf( ShelfNum ).OutReflectVis );
+			Hash = HashValue( Hash, Shelf( ShelfNum ).ViewFactor );
+		}
+
+		for ( int PipeNum = 1; PipeNum <= NumOfTDDPipes; ++PipeNum ) {
+			auto const & pipe( TDDPipe( PipeNum ) );
+			Hash = HashValue( Hash, pipe.Dome );
+			Hash = HashValue( Hash, pipe.Diffuser );
+			Hash = HashValue( Hash, pipe.Diameter );
+			Hash = HashValue( Hash, pipe.TotLength );
+			Hash = HashValue( Hash, pipe.AspectRatio );
+			Hash = HashValue( Hash, pipe.ReflectVis );
+			Hash = HashDayltgArray( Hash, pipe.PipeTransVisBeam );
+		}
+
+		return Hash;
+
+	}
+
+	std::uint64_t
+	DayltgCoeffRecordKey(
+		std::vector< int > const & Zones, // Daylit zones of one group
+		bool const MapsIncluded // True if illuminance map factors are calculated too
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the shading result cache key of the daylight factors of a group of zones for the
+		// current shadowing period.
+
+		// Using/Aliasing
+		using ShadingCache::HashValue;
+		using SolarShading::DaylightingRecord;
+
+		std::uint64_t Key( HashValue( DayltgInputHash, DaylightingRecord ) );
+		for ( int const ZoneNum : Zones ) {
+			Key = HashValue( Key, ZoneNum );
+		}
+		Key = HashValue( Key, MapsIncluded );
+		Key = HashValue( Key, GndReflectanceForDayltg );
+		for ( int IHR = 1; IHR <= 24; ++IHR ) {
+			Key = HashValue( Key, SUNCOSHR( 1, IHR ) );
+			Key = HashValue( Key, SUNCOSHR( 2, IHR ) );
+			Key = HashValue( Key, SUNCOSHR( 3, IHR ) );
+		}
+		for ( int const ZoneNum : Zones ) {
+			for ( int loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
+				int const IWin( ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loopwin ) );
+				Key = HashValue( Key, SurfaceWindow( IWin ).StormWinFlag );
+				if ( ! CalcSolRefl ) continue;
+				for ( int IHR = 1; IHR <= 24; ++IHR ) {
+					Key = HashValue( Key, ReflFacBmToBmSolObs( IWin, IHR ) );
+				}
+			}
+		}
+		return Key;
+
+	}
+
+	void
+	DayltgCoeffRecordArrays(
+		std::vector< int > const & Zones, // Daylit zones of one group
+		bool const MapsIncluded, // True if illuminance map factors are calculated too
+		std::vector< FArray< Real64 > * > & Arrays, // Arrays of results written for the group
+		std::vector< int > & Pipes // TDD pipes of the group's windows
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Lists the results CalcDayltgCoeffsRefMapPoints leaves for a group of zones, in the order
+		// they are stored in a shading result cache record.
+
+		// Using/Aliasing
+		using DaylightingDevices::FindTDDPipe;
+
+		Arrays.clear();
+		Pipes.clear();
+		for ( int const ZoneNum : Zones ) {
+			auto & zoneDaylight( ZoneDaylight( ZoneNum ) );
+			Arrays.push_back( &zoneDaylight.DaylIllFacSky );
+			Arrays.push_back( &zoneDaylight.DaylSourceFacSky );
+			Arrays.push_back( &zoneDaylight.DaylBackFacSky );
+			Arrays.push_back( &zoneDaylight.DaylIllFacSun );
+			Arrays.push_back( &zoneDaylight.DaylIllFacSunDisk );
+			Arrays.push_back( &zoneDaylight.DaylSourceFacSun );
+			Arrays.push_back( &zoneDaylight.DaylSourceFacSunDisk );
+			Arrays.push_back( &zoneDaylight.DaylBackFacSun );
+			Arrays.push_back( &zoneDaylight.DaylBackFacSunDisk );
+			Arrays.push_back( &zoneDaylight.SolidAngAtRefPt );
+			Arrays.push_back( &zoneDaylight.SolidAngAtRefPtWtd );
+			if ( MapsIncluded ) {
+				for ( int MapNum = 1; MapNum <= TotIllumMaps; ++MapNum ) {
+					auto & illumMap( IllumMapCalc( MapNum ) );
+					if ( illumMap.Zone != ZoneNum ) continue;
+					Arrays.push_back( &illumMap.DaylIllFacSky );
+					Arrays.push_back( &illumMap.DaylSourceFacSky );
+					Arrays.push_back( &illumMap.DaylBackFacSky );
+					Arrays.push_back( &illumMap.DaylIllFacSun );
+					Arrays.push_back( &illumMap.DaylIllFacSunDisk );
+					Arrays.push_back( &illumMap.DaylSourceFacSun );
+					Arrays.push_back( &illumMap.DaylSourceFacSunDisk );
+					Arrays.push_back( &illumMap.DaylBackFacSun );
+					Arrays.push_back( &illumMap.DaylBackFacSunDisk );
+					Arrays.push_back( &illumMap.SolidAngAtMapPt );
+					Arrays.push_back( &illumMap.SolidAngAtMapPtWtd );
+				}
+			}
+			for ( int loopwin = 1; loopwin <= zoneDaylight.NumOfDayltgExtWins; ++loopwin ) {
+				int const IWin( zoneDaylight.DayltgExtWinSurfNums( loopwin ) );
+				Arrays.push_back( &SurfaceWindow( IWin ).SolidAngAtRefPt );
+				Arrays.push_back( &SurfaceWindow( IWin ).SolidAngAtRefPtWtd );
+				if ( SurfaceWindow( IWin ).OriginalClass == SurfaceClass_TDD_Diffuser ) Pipes.push_back( FindTDDPipe( IWin ) );
+			}
+		}
+
+	}
+
+	void
+	PackDayltgCoeffRecord(
+		std::vector< int > const & Zones, // Daylit zones of one group
+		bool const MapsIncluded, // True if illuminance map factors are calculated too
+		ShadingCache::ShadingRecord & Record
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Packs the daylight factors of a group of zones into a shading result cache record.
+
+		// METHODOLOGY EMPLOYED:
+		// The arrays listed by DayltgCoeffRecordArrays are stored whole in Reals, followed by the
+		// hourly transmittance and flux values of the group's TDD pipes.  Ints holds the size of
+		// each array and the number of pipes so that UnpackDayltgCoeffRecord can check the layout.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::vector< FArray< Real64 > * > Arrays;
+		std::vector< int > Pipes;
+
+		DayltgCoeffRecordArrays( Zones, MapsIncluded, Arrays, Pipes );
+
+		Record.clear();
+		for ( auto const * Values : Arrays ) {
+			Record.Ints.push_back( int( Values->size() ) );
+			for ( FArray< Real64 >::size_type i = 0; i < Values->size(); ++i ) {
+				Record.Reals.push_back( ( *Values )[ i ] );
+			}
+		}
+		Record.Ints.push_back( int( Pipes.size() ) );
+		for ( int const PipeNum : Pipes ) {
+			for ( int IHR = 1; IHR <= 24; ++IHR ) {
+				Record.Reals.push_back( TDDTransVisBeam( PipeNum, IHR ) );
+				for ( int ISky = 1; ISky <= 4; ++ISky ) {
+					Record.Reals.push_back( TDDFluxInc( PipeNum, ISky, IHR ) );
+					Record.Reals.push_back( TDDFluxTrans( PipeNum, ISky, IHR ) );
+				}
+			}
+		}
+
+	}
+
+	bool
+	UnpackDayltgCoeffRecord(
+		std::vector< int > const & Zones, // Daylit zones of one group
+		bool const MapsIncluded, // True if illuminance map factors are calculated too
+		ShadingCache::ShadingRecord const & Record
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Restores the daylight factors packed by PackDayltgCoeffRecord.  Returns false, leaving the
+		// results untouched, if the record does not have the layout expected for this run.
+
+		// METHODOLOGY EMPLOYED:
+		// The per-window setup of the calculation is done again first (SetupDayltgCoeffsFromRecord),
+		// so window quantities used later in the time step and the reference point warnings are the
+		// same as when the factors are calculated.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::vector< FArray< Real64 > * > Arrays;
+		std::vector< int > Pipes;
+
+		DayltgCoeffRecordArrays( Zones, MapsIncluded, Arrays, Pipes );
+
+		// Check the layout before touching any results
+		if ( Record.Ints.size() != Arrays.size() + 1 ) return false;
+		std::size_t NumReals( 0 );
+		for ( std::size_t N = 0; N < Arrays.size(); ++N ) {
+			if ( Record.Ints[ N ] < 0 || std::size_t( Record.Ints[ N ] ) != Arrays[ N ]->size() ) return false;
+			NumReals += Arrays[ N ]->size();
+		}
+		if ( std::size_t( Record.Ints.back() ) != Pipes.size() ) return false;
+		if ( Record.Reals.size() != NumReals + Pipes.size() * 24 * 9 ) return false;
+
+		for ( int const ZoneNum : Zones ) {
+			SetupDayltgCoeffsFromRecord( ZoneNum, MapsIncluded );
+		}
+
+		auto Real( Record.Reals.begin() );
+		for ( auto * Values : Arrays ) {
+			for ( FArray< Real64 >::size_type i = 0; i < Values->size(); ++i ) {
+				( *Values )[ i ] = *Real++;
+			}
+		}
+		for ( int const PipeNum : Pipes ) {
+			for ( int IHR = 1; IHR <= 24; ++IHR ) {
+				TDDTransVisBeam( PipeNum, IHR ) = *Real++;
+				for ( int ISky = 1; ISky <= 4; ++ISky ) {
+					TDDFluxInc( PipeNum, ISky, IHR ) = *Real++;
+					TDDFluxTrans( PipeNum, ISky, IHR ) = *Real++;
+				}
+			}
+		}
+
+		return true;
+
+	}
+
+	void
+	SetupDayltgCoeffsFromRecord(
+		int const ZoneNum,
+		bool const MapsIncluded // True if illuminance map factors are calculated too
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Does the part of CalcDayltgCoeffsRefMapPoints that is not kept in a shading result cache
+		// record: resets the zone's illuminance results and runs the per-window setup for every
+		// reference and map point, which sets window quantities (center, orientation, visible
+		// transmittance ratio) and issues the reference point distance messages.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static thread_local FArray1D< Real64 > W2( 3 ); // Second vertex of window
+		static thread_local FArray1D< Real64 > W3( 3 ); // Third vertex of window
+		static thread_local FArray1D< Real64 > W21( 3 ); // Vector from window vertex 2 to window vertex 1
+		static thread_local FArray1D< Real64 > W23( 3 ); // Vector from window vertex 2 to window vertex 3
+		static thread_local FArray1D< Real64 > RREF( 3 ); // Location of a reference point in absolute coordinate system
+		static thread_local FArray1D< Real64 > RREF2( 3 ); // Location of virtual reference point in absolute coordinate system
+		static thread_local FArray1D< Real64 > WNORM2( 3 ); // Unit vector normal to TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > VIEWVC( 3 ); // View vector in absolute coordinate system
+		static thread_local FArray1D< Real64 > U2( 3 ); // Second vertex of window for TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > U21( 3 ); // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > U23( 3 ); // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > VIEWVC2( 3 ); // Virtual view vector in absolute coordinate system
+		Real64 AZVIEW; // Azimuth of view vector in absolute coord system for glare calculation (radians)
+		int IWin; // Window counter
+		int IWin2; // Secondary window counter (for TDD:DOME object, if exists)
+		int NWX; // Number of window elements in x direction for dayltg calc
+		int NWY; // Number of window elements in y direction for dayltg calc
+		int LSHCAL; // Interior shade calculation flag
+		int InShelfSurf; // Inside daylighting shelf surface number
+		int ICtrl; // Window control counter
+		int ShType; // Window shading type
+		int BlNum; // Window Blind Number
+		int ExtWinType; // Exterior window type (InZoneExtWin, AdjZoneExtWin, NotInOrAdjZoneExtWin)
+		int IConst; // Construction counter
+		Real64 DWX; // Horizontal dimension of window element (m)
+		Real64 DWY; // Vertical dimension of window element (m)
+		Real64 DAXY; // Area of window element
+		bool Rectangle; // True if window is rectangular
+		bool Triangle; // True if window is triangular
+		FArray2D< Real64 > MapWindowSolidAngAtRefPt;
+		FArray2D< Real64 > MapWindowSolidAngAtRefPtWtd;
+
+		// Azimuth of view vector in absolute coord sys
+		AZVIEW = ( ZoneDaylight( ZoneNum ).ViewAzimuthForGlare + Zone( ZoneNum ).RelNorth + BuildingAzimuth + BuildingRotationAppendixG ) * DegToRadians;
+		// View vector components in absolute coord sys
+		VIEWVC( 1 ) = std::sin( AZVIEW );
+		VIEWVC( 2 ) = std::cos( AZVIEW );
+		VIEWVC( 3 ) = 0.0;
+
+		ZoneDaylight( ZoneNum ).DaylIllumAtRefPt = 0.0;
+		ZoneDaylight( ZoneNum ).GlareIndexAtRefPt = 0.0;
+		ZoneDaylight( ZoneNum ).IllumFromWinAtRefPt = 0.0;
+		ZoneDaylight( ZoneNum ).BackLumFromWinAtRefPt = 0.0;
+		ZoneDaylight( ZoneNum ).SourceLumFromWinAtRefPt = 0.0;
+
+		for ( int IL = 1; IL <= ZoneDaylight( ZoneNum ).TotalDaylRefPoints; ++IL ) {
+			RREF( {1,3} ) = ZoneDaylight( ZoneNum ).DaylRefPtAbsCoord( IL, {1,3} );
+			for ( int loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
+				FigureDayltgCoeffsAtPointsSetupForWindow( ZoneNum, IL, loopwin, CalledForRefPoint, RREF, VIEWVC, IWin, IWin2, NWX, NWY, W2, W3, W21, W23, LSHCAL, InShelfSurf, ICtrl, ShType, BlNum, WNORM2, ExtWinType, IConst, RREF2, DWX, DWY, DAXY, U2, U23, U21, VIEWVC2, Rectangle, Triangle );
+			}
+		}
+
+		if ( ! MapsIncluded ) return;
+
+		for ( int MapNum = 1; MapNum <= TotIllumMaps; ++MapNum ) {
+			if ( IllumMapCalc( MapNum ).Zone != ZoneNum ) continue;
+			IllumMapCalc( MapNum ).DaylIllumAtMapPt = 0.0;
+			MapWindowSolidAngAtRefPt.allocate( ZoneDaylight( ZoneNum ).NumOfDayltgExtWins, IllumMapCalc( MapNum ).TotalMapRefPoints );
+			MapWindowSolidAngAtRefPtWtd.allocate( ZoneDaylight( ZoneNum ).NumOfDayltgExtWins, IllumMapCalc( MapNum ).TotalMapRefPoints );
+			for ( int IL = 1; IL <= IllumMapCalc( MapNum ).TotalMapRefPoints; ++IL ) {
+				RREF = IllumMapCalc( MapNum ).MapRefPtAbsCoord( IL, {1,3} );
+				for ( int loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
+					FigureDayltgCoeffsAtPointsSetupForWindow( ZoneNum, IL, loopwin, CalledForMapPoint, RREF, VIEWVC, IWin, IWin2, NWX, NWY, W2, W3, W21, W23, LSHCAL, InShelfSurf, ICtrl, ShType, BlNum, WNORM2, ExtWinType, IConst, RREF2, DWX, DWY, DAXY, U2, U23, U21, VIEWVC2, Rectangle, Triangle, MapNum, MapWindowSolidAngAtRefPt, MapWindowSolidAngAtRefPtWtd );
+				}
+			}
+		}
+
+	}
+
 	void
 	CalcDayltgCoeffsRefMapPoints( int const ZoneNum )
 	{
@@ -778,7 +1411,8 @@ namespace DaylightingManager {
 		// daylighting and illuminance map reference points.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// May run in parallel with other zones (CalcDayltgCoefficients), so one-time setup
+		// and messages are done by the caller.
 
 		// REFERENCES:
 		// na
@@ -807,50 +1441,13 @@ namespace DaylightingManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int IWin; // Window counter
-		int PipeNum; // TDD pipe object number
-		int loopwin; // loop index for exterior windows associated with a daylit zone
-		static bool VeryFirstTime( true );
-		int TZoneNum;
-		bool ErrorsFound;
-		int MapNum;
-
-		if ( VeryFirstTime ) {
-			// make sure all necessary surfaces match to pipes
-			ErrorsFound = false;
-			for ( TZoneNum = 1; TZoneNum <= NumOfZones; ++TZoneNum ) {
-				for ( loopwin = 1; loopwin <= ZoneDaylight( TZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
-					IWin = ZoneDaylight( TZoneNum ).DayltgExtWinSurfNums( loopwin );
-					if ( SurfaceWindow( IWin ).OriginalClass != SurfaceClass_TDD_Diffuser ) continue;
-					// Look up the TDD:DOME object
-					PipeNum = FindTDDPipe( IWin );
-					if ( PipeNum == 0 ) {
-						ShowSevereError( "GetTDDInput: Surface=" + Surface( IWin ).Name + ", TDD:Dome object does not reference a valid Diffuser object." );
-						ShowContinueError( "...needs DaylightingDevice:Tubular of same name as Surface." );
-						ErrorsFound = true;
-					}
-				}
-			}
-
-			if ( ErrorsFound ) {
-				ShowFatalError( "Not all TubularDaylightDome objects have corresponding DaylightingDevice:Tubular objects. Program terminates." );
-			}
-			VeryFirstTime = false;
-		}
+		// na
 
 		//Calc for daylighting reference points
 		CalcDayltgCoeffsRefPoints( ZoneNum );
 		if ( ! DoingSizing && ! KickOffSimulation ) {
 			//Calc for illuminance map
 			if ( TotIllumMaps > 0 ) {
-				for ( MapNum = 1; MapNum <= TotIllumMaps; ++MapNum ) {
-					if ( IllumMapCalc( MapNum ).Zone != ZoneNum ) continue;
-					if ( WarmupFlag ) {
-						DisplayString( "Calculating Daylighting Coefficients (Map Points), Zone=" + Zone( ZoneNum ).Name );
-					} else {
-						DisplayString( "Updating Daylighting Coefficients (Map Points), Zone=" + Zone( ZoneNum ).Name );
-					}
-				}
 				CalcDayltgCoeffsMapPoints( ZoneNum );
 			}
 		}
@@ -904,23 +1501,23 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static FArray1D< Real64 > W2( 3 ); // Second vertex of window
-		static FArray1D< Real64 > W3( 3 ); // Third vertex of window
-		static FArray1D< Real64 > W21( 3 ); // Vector from window vertex 2 to window vertex 1
-		static FArray1D< Real64 > W23( 3 ); // Vector from window vertex 2 to window vertex 3
-		static FArray1D< Real64 > RREF( 3 ); // Location of a reference point in absolute coordinate system
-		static FArray1D< Real64 > RREF2( 3 ); // Location of virtual reference point in absolute coordinate system
-		static FArray1D< Real64 > RWIN( 3 ); // Center of a window element in absolute coordinate system
-		static FArray1D< Real64 > RWIN2( 3 ); // Center of a window element for TDD:DOME (if exists) in abs coord sys
-		static FArray1D< Real64 > Ray( 3 ); // Unit vector along ray from reference point to window element
-		static FArray1D< Real64 > WNORM2( 3 ); // Unit vector normal to TDD:DOME (if exists)
-		static FArray1D< Real64 > VIEWVC( 3 ); // View vector in absolute coordinate system
-		static FArray1D< Real64 > U2( 3 ); // Second vertex of window for TDD:DOME (if exists)
-		static FArray1D< Real64 > U21( 3 ); // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
-		static FArray1D< Real64 > U23( 3 ); // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
-		static FArray1D< Real64 > ZF( 2 ); // Fraction of zone controlled by each reference point
-
-		static FArray1D< Real64 > VIEWVC2( 3 ); // Virtual view vector in absolute coordinate system
+		static thread_local FArray1D< Real64 > W2( 3 ); // Second vertex of window
+		static thread_local FArray1D< Real64 > W3( 3 ); // Third vertex of window
+		static thread_local FArray1D< Real64 > W21( 3 ); // Vector from window vertex 2 to window vertex 1
+		static thread_local FArray1D< Real64 > W23( 3 ); // Vector from window vertex 2 to window vertex 3
+		static thread_local FArray1D< Real64 > RREF( 3 ); // Location of a reference point in absolute coordinate system
+		static thread_local FArray1D< Real64 > RREF2( 3 ); // Location of virtual reference point in absolute coordinate system
+		static thread_local FArray1D< Real64 > RWIN( 3 ); // Center of a window element in absolute coordinate system
+		static thread_local FArray1D< Real64 > RWIN2( 3 ); // Center of a window element for TDD:DOME (if exists) in abs coord sys
+		static thread_local FArray1D< Real64 > Ray( 3 ); // Unit vector along ray from reference point to window element
+		static thread_local FArray1D< Real64 > WNORM2( 3 ); // Unit vector normal to TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > VIEWVC( 3 ); // View vector in absolute coordinate system
+		static thread_local FArray1D< Real64 > U2( 3 ); // Second vertex of window for TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > U21( 3 ); // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > U23( 3 ); // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > ZF( 2 ); // Fraction of zone controlled by each reference point
+
+		static thread_local FArray1D< Real64 > VIEWVC2( 3 ); // Virtual view vector in absolute coordinate system
 		int IHR; // Hour of day counter
 		int NRF; // Number of daylighting reference points in a zone
 		int IL; // Reference point counter
@@ -959,7 +1556,6 @@ namespace DaylightingManager {
 		Real64 DAXY; // Area of window element
 		Real64 SkyObstructionMult; // Ratio of obstructed to unobstructed sky diffuse at a ground point
 		int ExtWinType; // Exterior window type (InZoneExtWin, AdjZoneExtWin, NotInOrAdjZoneExtWin)
-		static bool refFirstTime( true );
 		int BRef;
 		int ILB;
 		int IHitIntObs; // = 1 if interior obstruction hit, = 0 otherwise
@@ -970,12 +1566,6 @@ namespace DaylightingManager {
 
 		int WinEl; // Current window element
 
-		if ( refFirstTime && any_gt( ZoneDaylight.TotalDaylRefPoints(), 0 ) ) {
-			RefErrIndex.allocate( TotSurfaces, maxval( ZoneDaylight.TotalDaylRefPoints() ) );
-			RefErrIndex = 0;
-			refFirstTime = false;
-		}
-
 		// Azimuth of view vector in absolute coord sys
 		AZVIEW = ( ZoneDaylight( ZoneNum ).ViewAzimuthForGlare + Zone( ZoneNum ).RelNorth + BuildingAzimuth + BuildingRotationAppendixG ) * DegToRadians;
 		// View vector components in absolute coord sys
@@ -1161,22 +1751,22 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static FArray1D< Real64 > W2( 3 ); // Second vertex of window
-		static FArray1D< Real64 > W3( 3 ); // Third vertex of window
-		static FArray1D< Real64 > U2( 3 ); // Second vertex of window for TDD:DOME (if exists)
-		static FArray1D< Real64 > RREF( 3 ); // Location of a reference point in absolute coordinate system
-		static FArray1D< Real64 > RREF2( 3 ); // Location of virtual reference point in absolute coordinate system
-		static FArray1D< Real64 > RWIN( 3 ); // Center of a window element in absolute coordinate system
-		static FArray1D< Real64 > RWIN2( 3 ); // Center of a window element for TDD:DOME (if exists) in abs coord sys
-		static FArray1D< Real64 > Ray( 3 ); // Unit vector along ray from reference point to window element
-		static FArray1D< Real64 > W21( 3 ); // Vector from window vertex 2 to window vertex 1
-		static FArray1D< Real64 > W23( 3 ); // Vector from window vertex 2 to window vertex 3
-		static FArray1D< Real64 > U21( 3 ); // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
-		static FArray1D< Real64 > U23( 3 ); // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
-		static FArray1D< Real64 > WNORM2( 3 ); // Unit vector normal to TDD:DOME (if exists)
-		static FArray1D< Real64 > VIEWVC( 3 ); // View vector in absolute coordinate system
-		static FArray1D< Real64 > VIEWVC2( 3 ); // Virtual view vector in absolute coordinate system
-		static FArray1D< Real64 > ZF( 2 ); // Fraction of zone controlled by each reference point
+		static thread_local FArray1D< Real64 > W2( 3 ); // Second vertex of window
+		static thread_local FArray1D< Real64 > W3( 3 ); // Third vertex of window
+		static thread_local FArray1D< Real64 > U2( 3 ); // Second vertex of window for TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > RREF( 3 ); // Location of a reference point in absolute coordinate system
+		static thread_local FArray1D< Real64 > RREF2( 3 ); // Location of virtual reference point in absolute coordinate system
+		static thread_local FArray1D< Real64 > RWIN( 3 ); // Center of a window element in absolute coordinate system
+		static thread_local FArray1D< Real64 > RWIN2( 3 ); // Center of a window element for TDD:DOME (if exists) in abs coord sys
+		static thread_local FArray1D< Real64 > Ray( 3 ); // Unit vector along ray from reference point to window element
+		static thread_local FArray1D< Real64 > W21( 3 ); // Vector from window vertex 2 to window vertex 1
+		static thread_local FArray1D< Real64 > W23( 3 ); // Vector from window vertex 2 to window vertex 3
+		static thread_local FArray1D< Real64 > U21( 3 ); // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > U23( 3 ); // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > WNORM2( 3 ); // Unit vector normal to TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > VIEWVC( 3 ); // View vector in absolute coordinate system
+		static thread_local FArray1D< Real64 > VIEWVC2( 3 ); // Virtual view vector in absolute coordinate system
+		static thread_local FArray1D< Real64 > ZF( 2 ); // Fraction of zone controlled by each reference point
 		//  In the following four variables, I=1 for clear sky, 2 for overcast.
 		int IHR; // Hour of day counter
 		int NRF; // Number of daylighting reference points in a zone
@@ -1224,20 +1814,9 @@ namespace DaylightingManager {
 		Real64 TVISIntWinDisk; // Visible transmittance of int win at COSBIntWin for sun
 		FArray2D< Real64 > MapWindowSolidAngAtRefPt;
 		FArray2D< Real64 > MapWindowSolidAngAtRefPtWtd;
-		static bool mapFirstTime( true );
 		static bool MySunIsUpFlag( false );
 		int WinEl; // window elements counter
 
-		if ( mapFirstTime && TotIllumMaps > 0 ) {
-			IL = -999;
-			for ( MapNum = 1; MapNum <= TotIllumMaps; ++MapNum ) {
-				IL = max( IL, IllumMapCalc( MapNum ).TotalMapRefPoints );
-			}
-			MapErrIndex.allocate( TotSurfaces, IL );
-			MapErrIndex = 0;
-			mapFirstTime = false;
-		}
-
 		// Azimuth of view vector in absolute coord sys
 		AZVIEW = ( ZoneDaylight( ZoneNum ).ViewAzimuthForGlare + Zone( ZoneNum ).RelNorth + BuildingAzimuth + BuildingRotationAppendixG ) * DegToRadians;
 		// View vector components in absolute coord sys
@@ -1250,12 +1829,8 @@ namespace DaylightingManager {
 			if ( IllumMapCalc( MapNum ).Zone != ZoneNum ) continue;
 
 			IllumMapCalc( MapNum ).DaylIllumAtMapPt = 0.0; // Daylight illuminance at reference points (lux)
-			IllumMapCalc( MapNum ).GlareIndexAtMapPt = 0.0; // Glare index at reference points
 			IllumMapCalc( MapNum ).SolidAngAtMapPt = 0.0;
 			IllumMapCalc( MapNum ).SolidAngAtMapPtWtd = 0.0;
-			IllumMapCalc( MapNum ).IllumFromWinAtMapPt = 0.0;
-			IllumMapCalc( MapNum ).BackLumFromWinAtMapPt = 0.0;
-			IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt = 0.0;
 			if ( ! DetailedSolarTimestepIntegration ) {
 				IllumMapCalc( MapNum ).DaylIllFacSky = 0.0;
 				IllumMapCalc( MapNum ).DaylSourceFacSky = 0.0;
@@ -1267,15 +1842,15 @@ namespace DaylightingManager {
 				IllumMapCalc( MapNum ).DaylBackFacSun = 0.0;
 				IllumMapCalc( MapNum ).DaylBackFacSunDisk = 0.0;
 			} else {
-				IllumMapCalc( MapNum ).DaylIllFacSky( {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxRefPoints}, {1,4}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
-				IllumMapCalc( MapNum ).DaylSourceFacSky( {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxRefPoints}, {1,4}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
-				IllumMapCalc( MapNum ).DaylBackFacSky( {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxRefPoints}, {1,4}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
-				IllumMapCalc( MapNum ).DaylIllFacSun( {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxRefPoints}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
-				IllumMapCalc( MapNum ).DaylIllFacSunDisk( {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxRefPoints}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
-				IllumMapCalc( MapNum ).DaylSourceFacSun( {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxRefPoints}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
-				IllumMapCalc( MapNum ).DaylSourceFacSunDisk( {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxRefPoints}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
-				IllumMapCalc( MapNum ).DaylBackFacSun( {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxRefPoints}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
-				IllumMapCalc( MapNum ).DaylBackFacSunDisk( {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxRefPoints}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
+				IllumMapCalc( MapNum ).DaylIllFacSky( {1,IllumMapCalc( MapNum ).TotalMapRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,4}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
+				IllumMapCalc( MapNum ).DaylSourceFacSky( {1,IllumMapCalc( MapNum ).TotalMapRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,4}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
+				IllumMapCalc( MapNum ).DaylBackFacSky( {1,IllumMapCalc( MapNum ).TotalMapRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,4}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
+				IllumMapCalc( MapNum ).DaylIllFacSun( {1,IllumMapCalc( MapNum ).TotalMapRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
+				IllumMapCalc( MapNum ).DaylIllFacSunDisk( {1,IllumMapCalc( MapNum ).TotalMapRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
+				IllumMapCalc( MapNum ).DaylSourceFacSun( {1,IllumMapCalc( MapNum ).TotalMapRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
+				IllumMapCalc( MapNum ).DaylSourceFacSunDisk( {1,IllumMapCalc( MapNum ).TotalMapRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
+				IllumMapCalc( MapNum ).DaylBackFacSun( {1,IllumMapCalc( MapNum ).TotalMapRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
+				IllumMapCalc( MapNum ).DaylBackFacSunDisk( {1,IllumMapCalc( MapNum ).TotalMapRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,MaxSlatAngs + 1}, HourOfDay ) = 0.0;
 			}
 			NRF = IllumMapCalc( MapNum ).TotalMapRefPoints;
 			ZF = 0.0;
@@ -1461,20 +2036,20 @@ namespace DaylightingManager {
 		int ZoneNumThisWin; // A window's zone number
 		int ShelfNum; // Daylighting shelf object number
 
-		static FArray1D< Real64 > W1( 3 ); // First vertex of window (where vertices are numbered
+		static thread_local FArray1D< Real64 > W1( 3 ); // First vertex of window (where vertices are numbered
 		// counter-clockwise starting at upper left as viewed
 		// from inside of room
 		int IConstShaded; // Shaded construction counter
 		int ScNum; // Window screen number
 		Real64 WW; // Window width (m)
 		Real64 HW; // Window height (m)
-		static FArray1D< Real64 > WC( 3 ); // Center point of window
-		static FArray1D< Real64 > REFWC( 3 ); // Vector from reference point to center of window
-		static FArray1D< Real64 > WNORM( 3 ); // Unit vector normal to window (pointing away from room)
+		static thread_local FArray1D< Real64 > WC( 3 ); // Center point of window
+		static thread_local FArray1D< Real64 > REFWC( 3 ); // Vector from reference point to center of window
+		static thread_local FArray1D< Real64 > WNORM( 3 ); // Unit vector normal to window (pointing away from room)
 		int NDIVX; // Number of window x divisions for daylighting calc
 		int NDIVY; // Number of window y divisions for daylighting calc
 		Real64 ALF; // Distance from reference point to window plane (m)
-		static FArray1D< Real64 > W2REF( 3 ); // Vector from window origin to project of ref. pt. on window plane
+		static thread_local FArray1D< Real64 > W2REF( 3 ); // Vector from window origin to project of ref. pt. on window plane
 		Real64 D1a; // Projection of vector from window origin to reference
 		//  on window X  axis (m)
 		Real64 D1b; // Projection of vector from window origin to reference
@@ -1483,10 +2058,10 @@ namespace DaylightingManager {
 		Real64 SolidAngMinIntWin; // Approx. smallest solid angle subtended by an int. window wrt ref pt
 		Real64 SolidAngRatio; // Ratio of SolidAngExtWin and SolidAngMinIntWin
 		int PipeNum; // TDD pipe object number
-		static FArray1D< Real64 > REFD( 3 ); // Vector from ref pt to center of win in TDD:DIFFUSER coord sys (if exists)
-		static FArray1D< Real64 > VIEWVD( 3 ); // Virtual view vector in TDD:DIFFUSER coord sys (if exists)
-		static FArray1D< Real64 > U1( 3 ); // First vertex of window for TDD:DOME (if exists)
-		static FArray1D< Real64 > U3( 3 ); // Third vertex of window for TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > REFD( 3 ); // Vector from ref pt to center of win in TDD:DIFFUSER coord sys (if exists)
+		static thread_local FArray1D< Real64 > VIEWVD( 3 ); // Virtual view vector in TDD:DIFFUSER coord sys (if exists)
+		static thread_local FArray1D< Real64 > U1( 3 ); // First vertex of window for TDD:DOME (if exists)
+		static thread_local FArray1D< Real64 > U3( 3 ); // Third vertex of window for TDD:DOME (if exists)
 		Real64 SinCornerAng; // For triangle, sine of corner angle of window element
 
 		// Complex fenestration variables
@@ -1494,7 +2069,7 @@ namespace DaylightingManager {
 		int NReflSurf; // Number of blocked beams for complex fenestration
 		int NRefPts; // number of reference points
 		int WinEl; // Current window element
-		static FArray1D< Real64 > RayVector( 3 );
+		static thread_local FArray1D< Real64 > RayVector( 3 );
 		Real64 TransBeam; // Obstructions transmittance for incoming BSDF rays (temporary variable)
 
 		// Complex fenestration variables
@@ -1619,22 +2194,37 @@ namespace DaylightingManager {
 
 				//            ! Error message if ref pt is too close to window.
 				if ( D1a > 0.0 && D1b > 0.0 && D1b <= HW && D1a <= WW ) {
-					ShowSevereError( "CalcDaylightCoeffRefPoints: Daylighting calculation cannot be done for zone " + Zone( ZoneNum ).Name + " because reference point #" + RoundSigDigits( iRefPoint ) + " is less than 0.15m (6\") from window plane " + Surface( IWin ).Name );
-					ShowContinueError( "Distance=[" + RoundSigDigits( ALF, 5 ) + "]. This is too close; check position of reference point." );
-					ShowFatalError( "Program terminates due to preceding condition." );
+#ifdef _OPENMP
+#pragma omp critical( DayltgCoeffMessages )
+#endif
+					{
+						ShowSevereError( "CalcDaylightCoeffRefPoints: Daylighting calculation cannot be done for zone " + Zone( ZoneNum ).Name + " because reference point #" + RoundSigDigits( iRefPoint ) + " is less than 0.15m (6\") from window plane " + Surface( IWin ).Name );
+						ShowContinueError( "Distance=[" + RoundSigDigits( ALF, 5 ) + "]. This is too close; check position of reference point." );
+						ShowFatalError( "Program terminates due to preceding condition." );
+					}
 				}
 			} else if ( ALF < 0.1524 && ExtWinType == AdjZoneExtWin ) {
 				if ( RefErrIndex( IWin, iRefPoint ) == 0 ) { // only show error message once
-					ShowWarningError( "CalcDaylightCoeffRefPoints: For Zone=\"" + Zone( ZoneNum ).Name + "\" External Window=\"" + Surface( IWin ).Name + "\"in Zone=\"" + Zone( Surface( IWin ).Zone ).Name + "\" reference point is less than 0.15m (6\") from window plane " );
-					ShowContinueError( "Distance=[" + RoundSigDigits( ALF, 1 ) + " m] to ref point=[" + RoundSigDigits( RREF( 1 ), 1 ) + ',' + RoundSigDigits( RREF( 2 ), 1 ) + ',' + RoundSigDigits( RREF( 3 ), 1 ) + "], Inaccuracy in Daylighting Calcs may result." );
+#ifdef _OPENMP
+#pragma omp critical( DayltgCoeffMessages )
+#endif
+					{
+						ShowWarningError( "CalcDaylightCoeffRefPoints: For Zone=\"" + Zone( ZoneNum ).Name + "\" External Window=\"" + Surface( IWin ).Name + "\"in Zone=\"" + Zone( Surface( IWin ).Zone ).Name + "\" reference point is less than 0.15m (6\") from window plane " );
+						ShowContinueError( "Distance=[" + RoundSigDigits( ALF, 1 ) + " m] to ref point=[" + RoundSigDigits( RREF( 1 ), 1 ) + ',' + RoundSigDigits( RREF( 2 ), 1 ) + ',' + RoundSigDigits( RREF( 3 ), 1 ) + "], Inaccuracy in Daylighting Calcs may result." );
+					}
 					RefErrIndex( IWin, iRefPoint ) = 1;
 				}
 			}
 		} else if ( CalledFrom == CalledForMapPoint ) {
 			if ( ALF < 0.1524 && ExtWinType == AdjZoneExtWin ) {
 				if ( MapErrIndex( IWin, iRefPoint ) == 0 ) { // only show error message once
-					ShowWarningError( "CalcDaylightCoeffMapPoints: For Zone=\"" + Zone( ZoneNum ).Name + "\" External Window=\"" + Surface( IWin ).Name + "\"in Zone=\"" + Zone( Surface( IWin ).Zone ).Name + "\" map point is less than 0.15m (6\") from window plane " );
-					ShowContinueError( "Distance=[" + RoundSigDigits( ALF, 1 ) + " m] map point=[" + RoundSigDigits( RREF( 1 ), 1 ) + ',' + RoundSigDigits( RREF( 2 ), 1 ) + ',' + RoundSigDigits( RREF( 3 ), 1 ) + "], Inaccuracy in Map Calcs may result." );
+#ifdef _OPENMP
+#pragma omp critical( DayltgCoeffMessages )
+#endif
+					{
+						ShowWarningError( "CalcDaylightCoeffMapPoints: For Zone=\"" + Zone( ZoneNum ).Name + "\" External Window=\"" + Surface( IWin ).Name + "\"in Zone=\"" + Zone( Surface( IWin ).Zone ).Name + "\" map point is less than 0.15m (6\") from window plane " );
+						ShowContinueError( "Distance=[" + RoundSigDigits( ALF, 1 ) + " m] map point=[" + RoundSigDigits( RREF( 1 ), 1 ) + ',' + RoundSigDigits( RREF( 2 ), 1 ) + ',' + RoundSigDigits( RREF( 3 ), 1 ) + "], Inaccuracy in Map Calcs may result." );
+					}
 					MapErrIndex( IWin, iRefPoint ) = 1;
 				}
 			}
@@ -1937,7 +2527,7 @@ namespace DaylightingManager {
 		int IHitIntWin; // Ray from ref pt passes through interior window
 		int PipeNum; // TDD pipe object number
 		int IntWin; // Interior window surface index
-		static FArray1D< Real64 > HitPtIntWin( 3 ); // Intersection point on an interior window for ray from ref pt to ext win (m)
+		static thread_local FArray1D< Real64 > HitPtIntWin( 3 ); // Intersection point on an interior window for ray from ref pt to ext win (m)
 		Real64 COSBIntWin; // Cos of angle between int win outward normal and ray betw ref pt and
 		//  exterior window element or between ref pt and sun
 
@@ -1945,16 +2535,16 @@ namespace DaylightingManager {
 		Real64 Beta; // Intermediate variable
 		Real64 HorDis; // Distance between ground hit point and proj'n of center
 		//  of window element onto ground (m)
-		static FArray1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray hits ground (m)
-		static FArray1D< Real64 > URay( 3 ); // Unit vector in (Phi,Theta) direction
-		static FArray1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
+		static thread_local FArray1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray hits ground (m)
+		static thread_local FArray1D< Real64 > URay( 3 ); // Unit vector in (Phi,Theta) direction
+		static thread_local FArray1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
 
 		// Local complex fenestration variables
 		int CplxFenState; // Current complex fenestration state
 		int NReflSurf; // Number of blocked beams for complex fenestration
 		int ICplxFen; // Complex fenestration counter
 		int RayIndex;
-		static FArray1D< Real64 > RayVector( 3 );
+		static thread_local FArray1D< Real64 > RayVector( 3 );
 		Real64 TransBeam; // Obstructions transmittance for incoming BSDF rays (temporary variable)
 
 		++LSHCAL;
@@ -2218,11 +2808,11 @@ namespace DaylightingManager {
 		Real64 WinElArea; // Window element area
 
 		// window coordinates and vectors
-		static FArray1D< Real64 > W1( 3 );
-		static FArray1D< Real64 > W2( 3 );
-		static FArray1D< Real64 > W3( 3 );
-		static FArray1D< Real64 > W21( 3 );
-		static FArray1D< Real64 > W23( 3 );
+		static thread_local FArray1D< Real64 > W1( 3 );
+		static thread_local FArray1D< Real64 > W2( 3 );
+		static thread_local FArray1D< Real64 > W3( 3 );
+		static thread_local FArray1D< Real64 > W21( 3 );
+		static thread_local FArray1D< Real64 > W23( 3 );
 
 		// window elements counters
 		// integer :: IX ! horizontal elements
@@ -2230,7 +2820,7 @@ namespace DaylightingManager {
 
 		// TYPE(Vector) :: HitPt ! surface hit point
 		// REAL(r64), dimension(3) :: RWin ! window element center point (same as centroid)
-		static FArray1D< Real64 > WNorm( 3 ); // unit vector from window (point towards outside)
+		static thread_local FArray1D< Real64 > WNorm( 3 ); // unit vector from window (point towards outside)
 
 		//REAL(r64) :: DotProd     !Temporary variable for manipulating dot product .dot.
 		//REAL(r64) :: LeastHitDsq  ! dist^2 from window element center to hit point
@@ -2242,9 +2832,9 @@ namespace DaylightingManager {
 
 		// reference point variables
 		// REAL(r64), dimension(3) :: RefPoint ! reference point
-		static FArray1D< Real64 > Ray( 3 ); // vector along ray from window to reference point
-		static FArray1D< Real64 > RayNorm( 3 ); // unit vector along ray from window to reference point
-		static FArray1D< Real64 > InterPoint( 3 ); // Intersection point
+		static thread_local FArray1D< Real64 > Ray( 3 ); // vector along ray from window to reference point
+		static thread_local FArray1D< Real64 > RayNorm( 3 ); // unit vector along ray from window to reference point
+		static thread_local FArray1D< Real64 > InterPoint( 3 ); // Intersection point
 
 		// Position factor variables
 		Real64 AZVIEW; // Azimuth of view vector
@@ -2410,14 +3000,14 @@ namespace DaylightingManager {
 		int MaxTotHits;
 		int IX;
 		int IY;
-		static FArray1D< Real64 > RWin( 3 ); // window element center point (same as centroid)
-		static FArray1D< Real64 > V( 3 ); // vector array
+		static thread_local FArray1D< Real64 > RWin( 3 ); // window element center point (same as centroid)
+		static thread_local FArray1D< Real64 > V( 3 ); // vector array
 		Real64 LeastHitDsq; // dist^2 from window element center to hit point
 		Real64 HitDsq;
 		Real64 TransRSurf;
 		int I;
 		int J;
-		static FArray1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray hits ground (m)
+		static thread_local FArray1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray hits ground (m)
 
 		// Refrence point data
 		// integer :: iRefPoint
@@ -2813,9 +3403,9 @@ namespace DaylightingManager {
 		//integer, intent(in) :: iRefPoint
 
 		// SUBROUTINE LOCAL VARIABLES
-		static FArray1D< Real64 > Ray( 3 );
-		static FArray1D< Real64 > RayNorm( 3 );
-		static FArray1D< Real64 > V( 3 );
+		static thread_local FArray1D< Real64 > Ray( 3 );
+		static thread_local FArray1D< Real64 > RayNorm( 3 );
+		static thread_local FArray1D< Real64 > V( 3 );
 		Real64 BestMatch;
 		int iTrnRay;
 		Real64 temp;
@@ -2886,9 +3476,9 @@ namespace DaylightingManager {
 		int iTrnRay;
 		Real64 XR;
 		Real64 YR;
-		static FArray1D< Real64 > V( 3 );
+		static thread_local FArray1D< Real64 > V( 3 );
 		int iPierc;
-		static FArray1D< Real64 > InterPoint( 3 );
+		static thread_local FArray1D< Real64 > InterPoint( 3 );
 
 		// Object Data
 		Vector Vec;
@@ -2950,7 +3540,7 @@ namespace DaylightingManager {
 		GroundHitPt.dim( 3 );
 
 		// Locals
-		static FArray1D< Real64 > URay( 3 ); // Unit vector in (Phi,Theta) direction
+		static thread_local FArray1D< Real64 > URay( 3 ); // Unit vector in (Phi,Theta) direction
 		Real64 DPhi; // Phi increment (radians)
 		Real64 DTheta; // Theta increment (radians)
 		Real64 SkyGndUnObs; // Unobstructed sky irradiance at a ground point
@@ -2968,7 +3558,8 @@ namespace DaylightingManager {
 		Real64 IncAngSolidAngFac; // CosIncAngURay*dOmegaGnd/Pi
 		int IHitObs; // 1 if obstruction is hit; 0 otherwise
 		int ObsSurfNum; // Surface number of obstruction
-		static FArray1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
+		static thread_local std::vector< int > ObsCandidates; // Possible obstructions along a ray
+		static thread_local FArray1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
 
 		DPhi = PiOvr2 / ( AltSteps / 2.0 );
 		DTheta = Pi / AzimSteps;
@@ -2995,7 +3586,8 @@ namespace DaylightingManager {
 				SkyGndUnObs += IncAngSolidAngFac;
 				// Does this ground ray hit an obstruction?
 				IHitObs = 0;
-				for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+				SurfacesAlongRay( GroundHitPt, URay, ObsCandidates );
+				for ( int const ObsSurfNum : ObsCandidates ) {
 					if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 					DayltgPierceSurface( ObsSurfNum, GroundHitPt, URay, IHitObs, ObsHitPt );
 					if ( IHitObs > 0 ) break;
@@ -3105,13 +3697,13 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static FArray1D< Real64 > const RREF( 3, 0.0 ); // Location of a reference point in absolute coordinate system //Autodesk Was used uninitialized: Never set here // Made static for performance and const for now until issue addressed
-		static FArray1D< Real64 > XEDIRSK( 4 ); // Illuminance contribution from luminance element, sky-related
+		static thread_local FArray1D< Real64 > XEDIRSK( 4 ); // Illuminance contribution from luminance element, sky-related
 		Real64 XEDIRSU; // Illuminance contribution from luminance element, sun-related
-		static FArray1D< Real64 > XAVWLSK( 4 ); // Luminance of window element, sky-related
-		static FArray1D< Real64 > RAYCOS( 3 ); // Unit vector from reference point to sun
+		static thread_local FArray1D< Real64 > XAVWLSK( 4 ); // Luminance of window element, sky-related
+		static thread_local FArray1D< Real64 > RAYCOS( 3 ); // Unit vector from reference point to sun
 		int JB; // Slat angle counter
-		static FArray1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Beam-beam transmittance of isolated blind
-		static FArray1D< Real64 > TransBmBmMultRefl( MaxSlatAngs ); // As above but for beam reflected from exterior obstruction
+		static thread_local FArray1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Beam-beam transmittance of isolated blind
+		static thread_local FArray1D< Real64 > TransBmBmMultRefl( MaxSlatAngs ); // As above but for beam reflected from exterior obstruction
 		Real64 ProfAng; // Solar profile angle on a window (radians)
 		Real64 POSFAC; // Position factor for a window element / ref point / view vector combination
 		Real64 XR; // Horizontal displacement ratio
@@ -3121,7 +3713,7 @@ namespace DaylightingManager {
 
 		Real64 ObTransDisk; // Product of solar transmittances of exterior obstructions hit by ray
 		// from reference point to sun
-		static FArray1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits
+		static thread_local FArray1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits
 		Real64 LumAtHitPtFrSun; // Luminance at hit point of obstruction by reflection of direct light from
 		//  sun (cd/m2)
 		int ISky; // Sky type index: 1=clear, 2=clear turbid, 3=intermediate, 4=overcast
@@ -3139,14 +3731,15 @@ namespace DaylightingManager {
 		int loop2;
 		int NearestHitSurfNum; // Surface number of nearest obstruction
 		int NearestHitSurfNumX; // Surface number to use when obstruction is a shadowing surface
-		static FArray1D< Real64 > NearestHitPt( 3 ); // Hit point of ray on nearest obstruction
+		static thread_local FArray1D< Real64 > NearestHitPt( 3 ); // Hit point of ray on nearest obstruction
 //		Real64 SunObstructionMult; // = 1.0 if sun hits a ground point; otherwise = 0.0
 		Real64 Alfa; // Intermediate variables
 		Real64 Beta;
-		static FArray1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray hits ground (m)
+		static thread_local FArray1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray hits ground (m)
 		int IHitObs; // 1 if obstruction is hit; 0 otherwise
-		static FArray1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
+		static thread_local FArray1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
 		int ObsSurfNum; // Surface number of obstruction
+		static thread_local std::vector< int > ObsCandidates; // Possible obstructions along a ray
 		int ObsConstrNum; // Construction number of obstruction
 		Real64 ObsVisRefl; // Visible reflectance of obstruction
 		Real64 SkyReflVisLum; // Reflected sky luminance at hit point divided by
@@ -3154,15 +3747,15 @@ namespace DaylightingManager {
 		int RecSurfNum; // Receiving surface number
 		int ReflSurfNum; // Reflecting surface number
 		int ReflSurfNumX;
-		static FArray1D< Real64 > ReflNorm( 3 ); // Normal vector to reflecting surface
+		static thread_local FArray1D< Real64 > ReflNorm( 3 ); // Normal vector to reflecting surface
 		Real64 CosIncAngRefl; // Cos of angle of incidence of beam on reflecting surface
-		static FArray1D< Real64 > SunVecMir( 3 ); // Sun ray mirrored in reflecting surface
+		static thread_local FArray1D< Real64 > SunVecMir( 3 ); // Sun ray mirrored in reflecting surface
 		Real64 CosIncAngRec; // Cos of angle of incidence of reflected beam on receiving window
 		int IHitRefl; // 1 if ray hits reflecting surface; 0 otherwise
-		static FArray1D< Real64 > HitPtRefl( 3 ); // Point that ray hits reflecting surface
+		static thread_local FArray1D< Real64 > HitPtRefl( 3 ); // Point that ray hits reflecting surface
 		Real64 ReflDistance; // Distance between ref pt and hit point on reflecting surf (m)
 		int IHitObsRefl; // > 0 if obstruction hit between ref pt and reflection point
-		static FArray1D< Real64 > HitPtObs( 3 ); // Hit point on obstruction
+		static thread_local FArray1D< Real64 > HitPtObs( 3 ); // Hit point on obstruction
 		Real64 ObsDistance; // Distance from ref pt to reflection point
 		int ReflSurfRecNum; // Receiving surface number for a reflecting window
 		Real64 SpecReflectance; // Specular reflectance of a reflecting surface
@@ -3177,7 +3770,7 @@ namespace DaylightingManager {
 		int IHitExtObsDisk; // 1 if ray from ref pt to sun hits an exterior obstruction; 0 otherwise
 
 		int IntWinDisk; // Surface loop index for finding int windows betw ref pt and sun
-		static FArray1D< Real64 > HitPtIntWinDisk( 3 ); // Intersection point on an interior window for ray from ref pt to sun (m)
+		static thread_local FArray1D< Real64 > HitPtIntWinDisk( 3 ); // Intersection point on an interior window for ray from ref pt to sun (m)
 		int IntWinDiskHitNum; // Surface number of int window intersected by ray betw ref pt and sun
 		Real64 COSBIntWin; // Cos of angle between int win outward normal and ray betw ref pt and
 		//  exterior window element or between ref pt and sun
@@ -3361,7 +3954,8 @@ namespace DaylightingManager {
 							if ( CalcSolRefl ) { // Coordinates of ground point hit by the ray
 								// Sun reaches ground point if vector from this point to the sun is unobstructed
 								IHitObs = 0;
-								for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+								SurfacesAlongRay( GroundHitPt, SUNCOS_iHour, ObsCandidates );
+								for ( int const ObsSurfNum : ObsCandidates ) {
 									if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 									DayltgPierceSurface( ObsSurfNum, GroundHitPt, SUNCOS_iHour, IHitObs, ObsHitPt );
 									if ( IHitObs > 0 ) break;
@@ -3620,7 +4214,8 @@ namespace DaylightingManager {
 									}
 								} else {
 									// Reflecting surface is a building shade
-									for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+									SurfacesAlongRay( HitPtRefl, RAYCOS, ObsCandidates );
+									for ( int const ObsSurfNum : ObsCandidates ) {
 										if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 										if ( ObsSurfNum == ReflSurfNum ) continue;
 										DayltgPierceSurface( ObsSurfNum, HitPtRefl, RAYCOS, IHitObs, HitPtObs );
@@ -3936,34 +4531,34 @@ namespace DaylightingManager {
 				if ( ! SurfaceWindow( IWin ).MovableSlats && JSH > 2 ) break;
 
 				if ( GILSK( ISky, iHour ) > tmpDFCalc ) {
-					IllumMapCalc( MapNum ).DaylIllFacSky( loopwin, iMapPoint, ISky, JSH, iHour ) = ( EDIRSK( ISky, JSH, iHour ) + EINTSK( ISky, JSH, iHour ) ) / GILSK( ISky, iHour );
-					IllumMapCalc( MapNum ).DaylSourceFacSky( loopwin, iMapPoint, ISky, JSH, iHour ) = AVWLSK( ISky, JSH, iHour ) / ( NWX * NWY * GILSK( ISky, iHour ) );
-					IllumMapCalc( MapNum ).DaylBackFacSky( loopwin, iMapPoint, ISky, JSH, iHour ) = EINTSK( ISky, JSH, iHour ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * GILSK( ISky, iHour ) );
+					IllumMapCalc( MapNum ).DaylIllFacSky( iMapPoint, loopwin, ISky, JSH, iHour ) = ( EDIRSK( ISky, JSH, iHour ) + EINTSK( ISky, JSH, iHour ) ) / GILSK( ISky, iHour );
+					IllumMapCalc( MapNum ).DaylSourceFacSky( iMapPoint, loopwin, ISky, JSH, iHour ) = AVWLSK( ISky, JSH, iHour ) / ( NWX * NWY * GILSK( ISky, iHour ) );
+					IllumMapCalc( MapNum ).DaylBackFacSky( iMapPoint, loopwin, ISky, JSH, iHour ) = EINTSK( ISky, JSH, iHour ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * GILSK( ISky, iHour ) );
 				} else {
-					IllumMapCalc( MapNum ).DaylIllFacSky( loopwin, iMapPoint, ISky, JSH, iHour ) = 0.0;
-					IllumMapCalc( MapNum ).DaylSourceFacSky( loopwin, iMapPoint, ISky, JSH, iHour ) = 0.0;
-					IllumMapCalc( MapNum ).DaylBackFacSky( loopwin, iMapPoint, ISky, JSH, iHour ) = 0.0;
+					IllumMapCalc( MapNum ).DaylIllFacSky( iMapPoint, loopwin, ISky, JSH, iHour ) = 0.0;
+					IllumMapCalc( MapNum ).DaylSourceFacSky( iMapPoint, loopwin, ISky, JSH, iHour ) = 0.0;
+					IllumMapCalc( MapNum ).DaylBackFacSky( iMapPoint, loopwin, ISky, JSH, iHour ) = 0.0;
 				}
 
 				if ( ISky == 1 ) {
 					if ( GILSU( iHour ) > tmpDFCalc ) {
-						IllumMapCalc( MapNum ).DaylIllFacSun( loopwin, iMapPoint, JSH, iHour ) = ( EDIRSU( JSH, iHour ) + EINTSU( JSH, iHour ) ) / ( GILSU( iHour ) + 0.0001 );
-						IllumMapCalc( MapNum ).DaylIllFacSunDisk( loopwin, iMapPoint, JSH, iHour ) = ( EDIRSUdisk( JSH, iHour ) + EINTSUdisk( JSH, iHour ) ) / ( GILSU( iHour ) + 0.0001 );
+						IllumMapCalc( MapNum ).DaylIllFacSun( iMapPoint, loopwin, JSH, iHour ) = ( EDIRSU( JSH, iHour ) + EINTSU( JSH, iHour ) ) / ( GILSU( iHour ) + 0.0001 );
+						IllumMapCalc( MapNum ).DaylIllFacSunDisk( iMapPoint, loopwin, JSH, iHour ) = ( EDIRSUdisk( JSH, iHour ) + EINTSUdisk( JSH, iHour ) ) / ( GILSU( iHour ) + 0.0001 );
 
-						IllumMapCalc( MapNum ).DaylSourceFacSun( loopwin, iMapPoint, JSH, iHour ) = AVWLSU( JSH, iHour ) / ( NWX * NWY * ( GILSU( iHour ) + 0.0001 ) );
-						IllumMapCalc( MapNum ).DaylSourceFacSunDisk( loopwin, iMapPoint, JSH, iHour ) = AVWLSUdisk( JSH, iHour ) / ( NWX * NWY * ( GILSU( iHour ) + 0.0001 ) );
+						IllumMapCalc( MapNum ).DaylSourceFacSun( iMapPoint, loopwin, JSH, iHour ) = AVWLSU( JSH, iHour ) / ( NWX * NWY * ( GILSU( iHour ) + 0.0001 ) );
+						IllumMapCalc( MapNum ).DaylSourceFacSunDisk( iMapPoint, loopwin, JSH, iHour ) = AVWLSUdisk( JSH, iHour ) / ( NWX * NWY * ( GILSU( iHour ) + 0.0001 ) );
 
-						IllumMapCalc( MapNum ).DaylBackFacSun( loopwin, iMapPoint, JSH, iHour ) = EINTSU( JSH, iHour ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * ( GILSU( iHour ) + 0.0001 ) );
-						IllumMapCalc( MapNum ).DaylBackFacSunDisk( loopwin, iMapPoint, JSH, iHour ) = EINTSUdisk( JSH, iHour ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * ( GILSU( iHour ) + 0.0001 ) );
+						IllumMapCalc( MapNum ).DaylBackFacSun( iMapPoint, loopwin, JSH, iHour ) = EINTSU( JSH, iHour ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * ( GILSU( iHour ) + 0.0001 ) );
+						IllumMapCalc( MapNum ).DaylBackFacSunDisk( iMapPoint, loopwin, JSH, iHour ) = EINTSUdisk( JSH, iHour ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * ( GILSU( iHour ) + 0.0001 ) );
 					} else {
-						IllumMapCalc( MapNum ).DaylIllFacSun( loopwin, iMapPoint, JSH, iHour ) = 0.0;
-						IllumMapCalc( MapNum ).DaylIllFacSunDisk( loopwin, iMapPoint, JSH, iHour ) = 0.0;
+						IllumMapCalc( MapNum ).DaylIllFacSun( iMapPoint, loopwin, JSH, iHour ) = 0.0;
+						IllumMapCalc( MapNum ).DaylIllFacSunDisk( iMapPoint, loopwin, JSH, iHour ) = 0.0;
 
-						IllumMapCalc( MapNum ).DaylSourceFacSun( loopwin, iMapPoint, JSH, iHour ) = 0.0;
-						IllumMapCalc( MapNum ).DaylSourceFacSunDisk( loopwin, iMapPoint, JSH, iHour ) = 0.0;
+						IllumMapCalc( MapNum ).DaylSourceFacSun( iMapPoint, loopwin, JSH, iHour ) = 0.0;
+						IllumMapCalc( MapNum ).DaylSourceFacSunDisk( iMapPoint, loopwin, JSH, iHour ) = 0.0;
 
-						IllumMapCalc( MapNum ).DaylBackFacSun( loopwin, iMapPoint, JSH, iHour ) = 0.0;
-						IllumMapCalc( MapNum ).DaylBackFacSunDisk( loopwin, iMapPoint, JSH, iHour ) = 0.0;
+						IllumMapCalc( MapNum ).DaylBackFacSun( iMapPoint, loopwin, JSH, iHour ) = 0.0;
+						IllumMapCalc( MapNum ).DaylBackFacSunDisk( iMapPoint, loopwin, JSH, iHour ) = 0.0;
 					}
 				}
 			} // End of shading index loop, JSH
@@ -3972,16 +4567,16 @@ namespace DaylightingManager {
 			if ( ICtrl > 0 ) {
 				if ( WindowShadingControl( ICtrl ).ShadingType == WSC_ST_SwitchableGlazing ) {
 					VTR = SurfaceWindow( IWin ).VisTransRatio;
-					IllumMapCalc( MapNum ).DaylIllFacSky( loopwin, iMapPoint, ISky, 2, iHour ) = IllumMapCalc( MapNum ).DaylIllFacSky( loopwin, iMapPoint, ISky, 1, iHour ) * VTR;
-					IllumMapCalc( MapNum ).DaylSourceFacSky( loopwin, iMapPoint, ISky, 2, iHour ) = IllumMapCalc( MapNum ).DaylSourceFacSky( loopwin, iMapPoint, ISky, 1, iHour ) * VTR;
-					IllumMapCalc( MapNum ).DaylBackFacSky( loopwin, iMapPoint, ISky, 2, iHour ) = IllumMapCalc( MapNum ).DaylBackFacSky( loopwin, iMapPoint, ISky, 1, iHour ) * VTR;
+					IllumMapCalc( MapNum ).DaylIllFacSky( iMapPoint, loopwin, ISky, 2, iHour ) = IllumMapCalc( MapNum ).DaylIllFacSky( iMapPoint, loopwin, ISky, 1, iHour ) * VTR;
+					IllumMapCalc( MapNum ).DaylSourceFacSky( iMapPoint, loopwin, ISky, 2, iHour ) = IllumMapCalc( MapNum ).DaylSourceFacSky( iMapPoint, loopwin, ISky, 1, iHour ) * VTR;
+					IllumMapCalc( MapNum ).DaylBackFacSky( iMapPoint, loopwin, ISky, 2, iHour ) = IllumMapCalc( MapNum ).DaylBackFacSky( iMapPoint, loopwin, ISky, 1, iHour ) * VTR;
 					if ( ISky == 1 ) {
-						IllumMapCalc( MapNum ).DaylIllFacSun( loopwin, iMapPoint, 2, iHour ) = IllumMapCalc( MapNum ).DaylIllFacSun( loopwin, iMapPoint, 1, iHour ) * VTR;
-						IllumMapCalc( MapNum ).DaylSourceFacSun( loopwin, iMapPoint, 2, iHour ) = IllumMapCalc( MapNum ).DaylSourceFacSun( loopwin, iMapPoint, 1, iHour ) * VTR;
-						IllumMapCalc( MapNum ).DaylBackFacSun( loopwin, iMapPoint, 2, iHour ) = IllumMapCalc( MapNum ).DaylBackFacSun( loopwin, iMapPoint, 1, iHour ) * VTR;
-						IllumMapCalc( MapNum ).DaylIllFacSunDisk( loopwin, iMapPoint, 2, iHour ) = IllumMapCalc( MapNum ).DaylIllFacSunDisk( loopwin, iMapPoint, 1, iHour ) * VTR;
-						IllumMapCalc( MapNum ).DaylSourceFacSunDisk( loopwin, iMapPoint, 2, iHour ) = IllumMapCalc( MapNum ).DaylSourceFacSunDisk( loopwin, iMapPoint, 1, iHour ) * VTR;
-						IllumMapCalc( MapNum ).DaylBackFacSunDisk( loopwin, iMapPoint, 2, iHour ) = IllumMapCalc( MapNum ).DaylBackFacSunDisk( loopwin, iMapPoint, 1, iHour ) * VTR;
+						IllumMapCalc( MapNum ).DaylIllFacSun( iMapPoint, loopwin, 2, iHour ) = IllumMapCalc( MapNum ).DaylIllFacSun( iMapPoint, loopwin, 1, iHour ) * VTR;
+						IllumMapCalc( MapNum ).DaylSourceFacSun( iMapPoint, loopwin, 2, iHour ) = IllumMapCalc( MapNum ).DaylSourceFacSun( iMapPoint, loopwin, 1, iHour ) * VTR;
+						IllumMapCalc( MapNum ).DaylBackFacSun( iMapPoint, loopwin, 2, iHour ) = IllumMapCalc( MapNum ).DaylBackFacSun( iMapPoint, loopwin, 1, iHour ) * VTR;
+						IllumMapCalc( MapNum ).DaylIllFacSunDisk( iMapPoint, loopwin, 2, iHour ) = IllumMapCalc( MapNum ).DaylIllFacSunDisk( iMapPoint, loopwin, 1, iHour ) * VTR;
+						IllumMapCalc( MapNum ).DaylSourceFacSunDisk( iMapPoint, loopwin, 2, iHour ) = IllumMapCalc( MapNum ).DaylSourceFacSunDisk( iMapPoint, loopwin, 1, iHour ) * VTR;
+						IllumMapCalc( MapNum ).DaylBackFacSunDisk( iMapPoint, loopwin, 2, iHour ) = IllumMapCalc( MapNum ).DaylBackFacSunDisk( iMapPoint, loopwin, 1, iHour ) * VTR;
 					}
 				}
 			} // ICtrl > 0
@@ -4687,12 +5282,8 @@ namespace DaylightingManager {
 						IllumMapCalc( MapNum ).MapRefPtInBounds = true;
 						IllumMapCalc( MapNum ).DaylIllumAtMapPt.allocate( AddMapPoints );
 						IllumMapCalc( MapNum ).DaylIllumAtMapPt = 0.0;
-						IllumMapCalc( MapNum ).GlareIndexAtMapPt.allocate( AddMapPoints );
-						IllumMapCalc( MapNum ).GlareIndexAtMapPt = 0.0;
 						IllumMapCalc( MapNum ).DaylIllumAtMapPtHr.allocate( AddMapPoints );
 						IllumMapCalc( MapNum ).DaylIllumAtMapPtHr = 0.0;
-						IllumMapCalc( MapNum ).GlareIndexAtMapPtHr.allocate( AddMapPoints );
-						IllumMapCalc( MapNum ).GlareIndexAtMapPtHr = 0.0;
 
 						if ( AddMapPoints > MaxMapRefPoints ) {
 							ShowSevereError( "GetDaylighting Parameters: Total Map Reference points entered is greater than maximum allowed." );
@@ -5449,19 +6040,19 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int NV; // Number of vertices (3 or 4)
-		static FArray1D< Real64 > V1( 3 ); // First vertex
-		static FArray1D< Real64 > V2( 3 ); // Second vertex
-		static FArray1D< Real64 > V3( 3 ); // Third vertex
-		static FArray1D< Real64 > A1( 3 ); // Vector from vertex 1 to 2
-		static FArray1D< Real64 > A2( 3 ); // Vector from vertex 2 to 3
-		static FArray1D< Real64 > AXC( 3 ); // Cross product of A and C
-		static FArray1D< Real64 > SN( 3 ); // Vector normal to surface (SN = A1 X A2)
-		static FArray1D< Real64 > AA( 3 ); // AA(I) = A(N,I)
-		static FArray1D< Real64 > CC( 3 ); // CC(I) = C(N,I)
-		static FArray1D< Real64 > CCC( 3 ); // Vector from vertex 2 to CP
-		static FArray1D< Real64 > AAA( 3 ); // Vector from vertex 2 to vertex 1
-		static FArray1D< Real64 > BBB( 3 ); // Vector from vertex 2 to vertex 3
-		static FArray1D< Real64 > V_tmp( 3 ); // Vector to avoid array temporary
+		static thread_local FArray1D< Real64 > V1( 3 ); // First vertex
+		static thread_local FArray1D< Real64 > V2( 3 ); // Second vertex
+		static thread_local FArray1D< Real64 > V3( 3 ); // Third vertex
+		static thread_local FArray1D< Real64 > A1( 3 ); // Vector from vertex 1 to 2
+		static thread_local FArray1D< Real64 > A2( 3 ); // Vector from vertex 2 to 3
+		static thread_local FArray1D< Real64 > AXC( 3 ); // Cross product of A and C
+		static thread_local FArray1D< Real64 > SN( 3 ); // Vector normal to surface (SN = A1 X A2)
+		static thread_local FArray1D< Real64 > AA( 3 ); // AA(I) = A(N,I)
+		static thread_local FArray1D< Real64 > CC( 3 ); // CC(I) = C(N,I)
+		static thread_local FArray1D< Real64 > CCC( 3 ); // Vector from vertex 2 to CP
+		static thread_local FArray1D< Real64 > AAA( 3 ); // Vector from vertex 2 to vertex 1
+		static thread_local FArray1D< Real64 > BBB( 3 ); // Vector from vertex 2 to vertex 3
+		static thread_local FArray1D< Real64 > V_tmp( 3 ); // Vector to avoid array temporary
 		int N; // Vertex loop index
 		int I; // Vertex-to-vertex index
 		Real64 F1; // Intermediate variables
@@ -5474,10 +6065,10 @@ namespace DaylightingManager {
 		//  REAL(r64)      :: A(4,3)                   ! Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
 		//  REAL(r64)      :: C(4,3)                   ! Vectors from vertices to intersection point
 		//  REAL(r64)      :: V(4,3)                   ! Vertices of surfaces
-		static FArray2D< Real64 > A; // Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
-		static FArray2D< Real64 > C; // Vectors from vertices to intersection point
-		static FArray2D< Real64 > V; // Vertices of surfaces
-		static bool FirstTimeFlag( true );
+		static thread_local FArray2D< Real64 > A; // Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
+		static thread_local FArray2D< Real64 > C; // Vectors from vertices to intersection point
+		static thread_local FArray2D< Real64 > V; // Vertices of surfaces
+		static thread_local bool FirstTimeFlag( true );
 
 		// FLOW:
 		if ( FirstTimeFlag ) {
@@ -5645,9 +6236,10 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ISurf; // Surface index
+		static thread_local std::vector< int > ObsCandidates; // Possible obstructions along the ray
 		int IType; // Surface type/class
 		//  mirror surfaces of shading surfaces
-		static FArray1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction
+		static thread_local FArray1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction
 		int Pierce; // 1 if a particular obstruction is hit, 0 otherwise
 		Real64 Trans; // Solar transmittance of a shading surface
 		// FLOW:
@@ -5659,7 +6251,8 @@ namespace DaylightingManager {
 		// Building elements are assumed to be opaque. A shadowing surface is opaque unless
 		// its transmittance schedule value is non-zero.
 
-		for ( ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
+		SurfacesAlongRay( R1, RN, ObsCandidates );
+		for ( int const ISurf : ObsCandidates ) {
 			if ( ! Surface( ISurf ).ShadowSurfPossibleObstruction ) continue;
 			IType = Surface( ISurf ).Class;
 			if ( ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) && ISurf != Surface( IWin ).BaseSurf ) {
@@ -5735,11 +6328,12 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ISurf; // Surface index
+		static thread_local std::vector< int > ObsCandidates; // Possible obstructions along the ray
 		int IType; // Surface type/class
-		static FArray1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction
+		static thread_local FArray1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction
 		Real64 r12; // Distance between R1 and R2
 		Real64 d; // Distance between R1 and pierced surface
-		static FArray1D< Real64 > RN( 3 ); // Unit vector along ray
+		static thread_local FArray1D< Real64 > RN( 3 ); // Unit vector along ray
 
 		// FLOW:
 		IHit = 0;
@@ -5750,7 +6344,8 @@ namespace DaylightingManager {
 
 		// Loop over obstructions, which can be building elements, like walls,
 		// or shadowing surfaces, like overhangs. Exclude base surface of window IWin.
-		for ( ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
+		SurfacesAlongRay( R1, RN, ObsCandidates );
+		for ( int const ISurf : ObsCandidates ) {
 			IType = Surface( ISurf ).Class;
 
 			if ( ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) && ISurf != Surface( IWin ).BaseSurf && ISurf != Surface( Surface( IWin ).BaseSurf ).ExtBoundCond ) {
@@ -5821,11 +6416,12 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ISurf; // Surface index
+		static thread_local std::vector< int > ObsCandidates; // Possible obstructions along the ray
 		int IType; // Surface type/class
-		static FArray1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction surface (m)
+		static thread_local FArray1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction surface (m)
 		Real64 r12; // Distance between R1 and R2 (m)
 		Real64 d; // Distance between R1 and obstruction surface (m)
-		static FArray1D< Real64 > RN( 3 ); // Unit vector along ray from R1 to R2
+		static thread_local FArray1D< Real64 > RN( 3 ); // Unit vector along ray from R1 to R2
 
 		// FLOW:
 		IHit = 0;
@@ -5837,7 +6433,8 @@ namespace DaylightingManager {
 		// Loop over obstructions, which can be building elements, like walls,
 		// or shadowing surfaces, like overhangs. Exclude base surface of window IWin1.
 		// Exclude base surface of window IWin2.
-		for ( ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
+		SurfacesAlongRay( R1, RN, ObsCandidates );
+		for ( int const ISurf : ObsCandidates ) {
 			IType = Surface( ISurf ).Class;
 
 			if ( ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) && ISurf != Surface( IWin2 ).BaseSurf && ISurf != Surface( IWin1 ).BaseSurf && ISurf != Surface( Surface( IWin2 ).BaseSurf ).ExtBoundCond && ISurf != Surface( Surface( IWin1 ).BaseSurf ).ExtBoundCond ) {
@@ -7049,16 +7646,16 @@ namespace DaylightingManager {
 		// In the following I,J arrays:
 		// I = sky type;
 		// J = 1 for bare window, 2 and above for window with shade or blind.
-		static FArray2D< Real64 > FLFWSK( 4, MaxSlatAngs+1 ); // Sky-related downgoing luminous flux
-		static FArray1D< Real64 > FLFWSU( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, excluding entering beam
-		static FArray1D< Real64 > FLFWSUdisk( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, due to entering beam
-		static FArray2D< Real64 > FLCWSK( 4, MaxSlatAngs+1 ); // Sky-related upgoing luminous flux
-		static FArray1D< Real64 > FLCWSU( MaxSlatAngs+1 ); // Sun-related upgoing luminous flux
+		static thread_local FArray2D< Real64 > FLFWSK( 4, MaxSlatAngs+1 ); // Sky-related downgoing luminous flux
+		static thread_local FArray1D< Real64 > FLFWSU( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, excluding entering beam
+		static thread_local FArray1D< Real64 > FLFWSUdisk( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, due to entering beam
+		static thread_local FArray2D< Real64 > FLCWSK( 4, MaxSlatAngs+1 ); // Sky-related upgoing luminous flux
+		static thread_local FArray1D< Real64 > FLCWSU( MaxSlatAngs+1 ); // Sun-related upgoing luminous flux
 
 		int ISky; // Sky type index: 1=clear, 2=clear turbid,
 		//  3=intermediate, 4=overcast
-		static FArray1D< Real64 > TransMult( MaxSlatAngs ); // Transmittance multiplier
-		static FArray1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Isolated blind beam-beam transmittance
+		static thread_local FArray1D< Real64 > TransMult( MaxSlatAngs ); // Transmittance multiplier
+		static thread_local FArray1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Isolated blind beam-beam transmittance
 		Real64 DPH; // Sky/ground element altitude and azimuth increments (radians)
 		Real64 DTH;
 		int IPH; // Sky/ground element altitude and azimuth indices
@@ -7079,12 +7676,12 @@ namespace DaylightingManager {
 		Real64 COSB; // Cosine of angle of incidence of light from sky or ground
 		Real64 TVISBR; // Transmittance of window without shading at COSB
 		//  (times light well efficiency, if appropriate)
-		static FArray1D< Real64 > ZSK( 4 ); // Sky-related and sun-related illuminance on window from sky/ground
+		static thread_local FArray1D< Real64 > ZSK( 4 ); // Sky-related and sun-related illuminance on window from sky/ground
 		Real64 ZSU;
 		//  element for clear and overcast sky
-		static FArray1D< Real64 > U( 3 ); // Unit vector in (PH,TH) direction
+		static thread_local FArray1D< Real64 > U( 3 ); // Unit vector in (PH,TH) direction
 		Real64 ObTrans; // Product of solar transmittances of obstructions seen by a light ray
-		static FArray2D< Real64 > ObTransM( NTHMAX, NPHMAX ); // ObTrans value for each (TH,PH) direction
+		static thread_local FArray2D< Real64 > ObTransM( NTHMAX, NPHMAX ); // ObTrans value for each (TH,PH) direction
 		//unused  REAL(r64)         :: HitPointLumFrClearSky     ! Luminance of obstruction from clear sky (cd/m2)
 		//unused  REAL(r64)         :: HitPointLumFrOvercSky     ! Luminance of obstruction from overcast sky (cd/m2)
 		//unused  REAL(r64)         :: HitPointLumFrSun          ! Luminance of obstruction from sun (cd/m2)
@@ -7136,26 +7733,27 @@ namespace DaylightingManager {
 		//  obstruction (for unit beam normal illuminance)
 		int NearestHitSurfNum; // Surface number of nearest obstruction
 		int NearestHitSurfNumX; // Surface number to use when obstruction is a shadowing surface
-		static FArray1D< Real64 > NearestHitPt( 3 ); // Hit point of ray on nearest obstruction (m)
+		static thread_local FArray1D< Real64 > NearestHitPt( 3 ); // Hit point of ray on nearest obstruction (m)
 		Real64 LumAtHitPtFrSun; // Luminance at hit point on obstruction from solar reflection
 		//  for unit beam normal illuminance (cd/m2)
 		Real64 SunObstructionMult; // = 1 if sun hits a ground point; otherwise = 0
-		static FArray2D< Real64 > SkyObstructionMult( NTHMAX, NPHMAX ); // Ratio of obstructed to unobstructed sky diffuse at
+		static thread_local FArray2D< Real64 > SkyObstructionMult( NTHMAX, NPHMAX ); // Ratio of obstructed to unobstructed sky diffuse at
 		// a ground point for each (TH,PH) direction
 		Real64 Alfa; // Direction angles for ray heading towards the ground (radians)
 		Real64 Beta;
 		Real64 HorDis; // Distance between ground hit point and proj'n of window center onto ground (m)
-		static FArray1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray from window center hits the ground (m)
+		static thread_local FArray1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray from window center hits the ground (m)
 		int ObsSurfNum; // Obstruction surface number
+		static thread_local std::vector< int > ObsCandidates; // Possible obstructions along a ray
 		int IHitObs; // = 1 if obstruction is hit, = 0 otherwise
-		static FArray1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
+		static thread_local FArray1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
 		int ObsConstrNum; // Construction number of obstruction
 		Real64 ObsVisRefl; // Visible reflectance of obstruction
 		Real64 SkyReflVisLum; // Reflected sky luminance at hit point divided by unobstructed sky
 		//  diffuse horizontal illuminance [(cd/m2)/lux]
 		Real64 dReflObsSky; // Contribution to sky-related illuminance on window due to sky diffuse
 		//  reflection from an obstruction
-		static FArray1D< Real64 > URay( 3 ); // Unit vector in (Phi,Theta) direction
+		static thread_local FArray1D< Real64 > URay( 3 ); // Unit vector in (Phi,Theta) direction
 		Real64 TVisSunRefl; // Diffuse vis trans of bare window for beam reflection calc
 		//  (times light well efficiency, if appropriate)
 		Real64 ZSU1refl; // Beam normal illuminance times ZSU1refl = illuminance on window
@@ -7331,7 +7929,8 @@ namespace DaylightingManager {
 					if ( CalcSolRefl && ObTransM( ITH, IPH ) > 1.e-6 ) {
 						// Sun reaches ground point if vector from this point to the sun is unobstructed
 						IHitObs = 0;
-						for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+						SurfacesAlongRay( GroundHitPt, SUNCOS_IHR, ObsCandidates );
+						for ( int const ObsSurfNum : ObsCandidates ) {
 							if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 							DayltgPierceSurface( ObsSurfNum, GroundHitPt, SUNCOS_IHR, IHitObs, ObsHitPt );
 							if ( IHitObs > 0 ) break;
@@ -7932,8 +8531,8 @@ namespace DaylightingManager {
 		Real64 BeamObstrMultiplier; // beam obstruction multiplier in case incoming beam is from the ground
 		int ObsSurfNum; // Obstruction surface number
 		int iHitObs; // = 1 if obstruction is hit, = 0 otherwise
-		static FArray1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
-		static FArray1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray from window center hits the ground (m)
+		static thread_local FArray1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
+		static thread_local FArray1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray from window center hits the ground (m)
 
 		int NRefl; // number of exterior obstructions
 		int iReflElem; // incoming direction blocking surfaces element counter
@@ -8066,7 +8665,7 @@ namespace DaylightingManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Simon Vidanovic
 		//       DATE WRITTEN   April 2013
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, use the overlap weighted transmittance of the window state
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -8077,7 +8676,11 @@ namespace DaylightingManager {
 		// the center of the window and then reflecting this
 		// light from the inside surfaces of the space.
 
-		// METHODOLOGY EMPLOYED: na
+		// METHODOLOGY EMPLOYED:
+		// The first reflected flux is the transmittance matrix applied to the incoming luminances and then
+		// weighted by the overlap reflectance of each outgoing direction.  The matrix and the reflectances
+		// do not change with the sun position, so their product (VisFtOverlapRefl, one value per incoming
+		// direction) is formed once per window state and only the incoming directions are integrated here.
 
 		// REFERENCES:
 
@@ -8086,58 +8689,30 @@ namespace DaylightingManager {
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
-		FArray2D< Real64 > FLSK; // Sky related luminous flux
-		FArray1D< Real64 > FLSU; // Sun related luminous flux, excluding entering beam
-		FArray1D< Real64 > FLSUdisk; // Sun related luminous flux, due to entering beam
-
-		FArray2D< Real64 > FirstFluxSK; // Sky related first reflected flux
-		FArray1D< Real64 > FirstFluxSU; // Sun related first reflected flux, excluding entering beam
-		FArray1D< Real64 > FirstFluxSUdisk; // Sun related first reflected flux, due to entering beam
-
 		FArray2D< Real64 > ElementLuminanceSky; // sky related luminance at window element (exterior side)
 		FArray1D< Real64 > ElementLuminanceSun; // sun related luminance at window element (exterior side), exluding beam
 		FArray1D< Real64 > ElementLuminanceSunDisk; // sun related luminance at window element (exterior side), due to sun beam
-		// Total transmitted flux
-		static FArray1D< Real64 > FLSKTot( 4 );
-		Real64 FLSUTot;
-		Real64 FLSUdiskTot;
 
 		// Total for first relflected fluxes
-		static FArray1D< Real64 > FFSKTot( 4 );
+		static thread_local FArray1D< Real64 > FFSKTot( 4 );
 		Real64 FFSUTot;
 		Real64 FFSUdiskTot;
 
 		Real64 COSIncSun; // cosine of sun incidence angle (from basis elements)
 
 		int iSky; // Sky type index: 1=clear, 2=clear turbid, 3=intermediate, 4=overcast
-		int iConst; // Construction number
 
 		int CurCplxFenState;
 		int NIncBasis;
-		int NTrnBasis;
 		int SolBmIndex; // index of current sun position
 
 		int iIncElem; // incoming direction counter
-		int iBackElem; // outgoing direction counter
 
-		Real64 LambdaInc; // current lambda value for incoming direction
-		//REAL(r64) :: LambdaTrn  ! current lambda value for incoming direction
-		Real64 dirTrans; // directional bsdf transmittance
+		Real64 ReflTrans; // lambda times the first reflected part of the transmittance for the incoming direction
 		Real64 ZoneInsideSurfArea;
 
 		CurCplxFenState = SurfaceWindow( IWin ).ComplexFen.CurrentState;
-		iConst = SurfaceWindow( IWin ).ComplexFen.State( CurCplxFenState ).Konst;
-		NTrnBasis = ComplexWind( IWin ).Geom( CurCplxFenState ).Trn.NBasis;
-
-		if ( ! allocated( FLSK ) ) FLSK.allocate( NTrnBasis, 4 );
-		FLSK = 0.0;
-		if ( ! allocated( FLSU ) ) FLSU.dimension( NTrnBasis, 0.0 );
-		if ( ! allocated( FLSUdisk ) ) FLSUdisk.dimension( NTrnBasis, 0.0 );
-
-		if ( ! allocated( FirstFluxSK ) ) FirstFluxSK.allocate( NTrnBasis, 4 );
-		FirstFluxSK = 0.0;
-		if ( ! allocated( FirstFluxSU ) ) FirstFluxSU.dimension( NTrnBasis, 0.0 );
-		if ( ! allocated( FirstFluxSUdisk ) ) FirstFluxSUdisk.dimension( NTrnBasis, 0.0 );
+		auto const & VisFtOverlapRefl( SurfaceWindow( IWin ).ComplexFen.State( CurCplxFenState ).VisFtOverlapRefl );
 
 		NIncBasis = ComplexWind( IWin ).Geom( CurCplxFenState ).Inc.NBasis;
 		if ( ! allocated( ElementLuminanceSky ) ) ElementLuminanceSky.allocate( NIncBasis, 4 );
@@ -8145,8 +8720,8 @@ namespace DaylightingManager {
 		if ( ! allocated( ElementLuminanceSun ) ) ElementLuminanceSun.dimension( NIncBasis, 0.0 );
 		if ( ! allocated( ElementLuminanceSunDisk ) ) ElementLuminanceSunDisk.dimension( NIncBasis, 0.0 );
 
-		// Integration over sky/ground/sun elements is done over window incoming basis element and flux is calculated for each
-		// outgoing direction. This is used to calculate first reflected flux
+		// Integration over sky/ground/sun elements is done over window incoming basis element. The flux into each
+		// outgoing direction and its first reflection are already folded into VisFtOverlapRefl
 
 		ComplexFenestrationLuminances( IWin, WinEl, NIncBasis, IHR, iRefPoint, ElementLuminanceSky, ElementLuminanceSun, ElementLuminanceSunDisk, CalledFrom, MapNum );
 
@@ -8159,38 +8734,18 @@ namespace DaylightingManager {
 		}
 		ElementLuminanceSunDisk *= SunlitFracHR( IWin, IHR ) * COSIncSun;
 
-		FLSKTot = 0.0;
-		FLSUTot = 0.0;
-		FLSUdiskTot = 0.0;
 		FFSKTot = 0.0;
 		FFSUTot = 0.0;
 		FFSUdiskTot = 0.0;
-		// now calculate flux into each outgoing direction by integrating over all incoming directions
-		for ( iBackElem = 1; iBackElem <= NTrnBasis; ++iBackElem ) {
-			for ( iIncElem = 1; iIncElem <= NIncBasis; ++iIncElem ) {
-				LambdaInc = ComplexWind( IWin ).Geom( CurCplxFenState ).Inc.Lamda( iIncElem );
-				dirTrans = Construct( iConst ).BSDFInput.VisFrtTrans( iIncElem, iBackElem );
-
-				for ( iSky = 1; iSky <= 4; ++iSky ) {
-					FLSK( iBackElem, iSky ) += dirTrans * LambdaInc * ElementLuminanceSky( iIncElem, iSky );
-				}
-
-				FLSU( iBackElem ) += dirTrans * LambdaInc * ElementLuminanceSun( iIncElem );
-				FLSUdisk( iBackElem ) += dirTrans * LambdaInc * ElementLuminanceSunDisk( iIncElem );
-			}
+		for ( iIncElem = 1; iIncElem <= NIncBasis; ++iIncElem ) {
+			ReflTrans = ComplexWind( IWin ).Geom( CurCplxFenState ).Inc.Lamda( iIncElem ) * VisFtOverlapRefl( iIncElem );
+			if ( ReflTrans == 0.0 ) continue;
 
 			for ( iSky = 1; iSky <= 4; ++iSky ) {
-				FirstFluxSK( iBackElem, iSky ) = FLSK( iBackElem, iSky ) * ComplexWind( IWin ).Geom( CurCplxFenState ).AveRhoVisOverlap( iBackElem );
-				FFSKTot( iSky ) += FirstFluxSK( iBackElem, iSky );
-				FLSKTot( iSky ) += FLSK( iBackElem, iSky );
+				FFSKTot( iSky ) += ReflTrans * ElementLuminanceSky( iIncElem, iSky );
 			}
-			FirstFluxSU( iBackElem ) = FLSU( iBackElem ) * ComplexWind( IWin ).Geom( CurCplxFenState ).AveRhoVisOverlap( iBackElem );
-			FFSUTot += FirstFluxSU( iBackElem );
-			FLSUTot += FLSU( iBackElem );
-
-			FirstFluxSUdisk( iBackElem ) = FLSUdisk( iBackElem ) * ComplexWind( IWin ).Geom( CurCplxFenState ).AveRhoVisOverlap( iBackElem );
-			FFSUdiskTot += FirstFluxSUdisk( iBackElem );
-			FLSUdiskTot += FLSUdisk( iBackElem );
+			FFSUTot += ReflTrans * ElementLuminanceSun( iIncElem );
+			FFSUdiskTot += ReflTrans * ElementLuminanceSunDisk( iIncElem );
 		}
 
 		ZoneInsideSurfArea = ZoneDaylight( ZoneNum ).TotInsSurfArea;
@@ -8200,14 +8755,6 @@ namespace DaylightingManager {
 		EINTSU( 1, IHR ) = FFSUTot * ( Surface( IWin ).Area / SurfaceWindow( IWin ).GlazedFrac ) / ( ZoneInsideSurfArea * ( 1.0 - ZoneDaylight( ZoneNum ).AveVisDiffReflect ) );
 		EINTSUdisk( 1, IHR ) = FFSUdiskTot * ( Surface( IWin ).Area / SurfaceWindow( IWin ).GlazedFrac ) / ( ZoneInsideSurfArea * ( 1.0 - ZoneDaylight( ZoneNum ).AveVisDiffReflect ) );
 
-		if ( allocated( FLSK ) ) FLSK.deallocate();
-		if ( allocated( FLSU ) ) FLSU.deallocate();
-		if ( allocated( FLSUdisk ) ) FLSUdisk.deallocate();
-
-		if ( allocated( FirstFluxSK ) ) FirstFluxSK.deallocate();
-		if ( allocated( FirstFluxSU ) ) FirstFluxSU.deallocate();
-		if ( allocated( FirstFluxSUdisk ) ) FirstFluxSUdisk.deallocate();
-
 		if ( allocated( ElementLuminanceSky ) ) ElementLuminanceSky.deallocate();
 		if ( allocated( ElementLuminanceSun ) ) ElementLuminanceSun.deallocate();
 		if ( allocated( ElementLuminanceSunDisk ) ) ElementLuminanceSunDisk.deallocate();
@@ -8229,7 +8776,7 @@ namespace DaylightingManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Simon Vidanovic
 		//       DATE WRITTEN   June 2013
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, skip incoming directions with zero transmittance
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -8253,11 +8800,11 @@ namespace DaylightingManager {
 		FArray1D< Real64 > ElementLuminanceSunDisk; // sun related luminance at window element (exterior side),
 		// due to sun beam
 
-		static FArray1D< Real64 > WinLumSK( 4 ); // Sky related window luminance
+		static thread_local FArray1D< Real64 > WinLumSK( 4 ); // Sky related window luminance
 		Real64 WinLumSU; // Sun related window luminance, excluding entering beam
 		//REAL(r64) :: WinLumSUdisk  ! Sun related window luminance, due to entering beam
 
-		static FArray1D< Real64 > EDirSky( 4 ); // Sky related direct illuminance
+		static thread_local FArray1D< Real64 > EDirSky( 4 ); // Sky related direct illuminance
 		Real64 EDirSun; // Sun related direct illuminance, excluding entering beam
 		Real64 EDirSunDisk; // Sun related direct illuminance, due to entering beam
 
@@ -8278,6 +8825,8 @@ namespace DaylightingManager {
 		CurCplxFenState = SurfaceWindow( IWin ).ComplexFen.CurrentState;
 		iConst = SurfaceWindow( IWin ).ComplexFen.State( CurCplxFenState ).Konst;
 		NIncBasis = ComplexWind( IWin ).Geom( CurCplxFenState ).Inc.NBasis;
+		auto const & VisFtTransFirst( SurfaceWindow( IWin ).ComplexFen.State( CurCplxFenState ).VisFtTransFirst );
+		auto const & VisFtTransLast( SurfaceWindow( IWin ).ComplexFen.State( CurCplxFenState ).VisFtTransLast );
 
 		if ( ! allocated( ElementLuminanceSky ) ) ElementLuminanceSky.allocate( NIncBasis, 4 );
 		ElementLuminanceSky = 0.0;
@@ -8304,7 +8853,8 @@ namespace DaylightingManager {
 		EDirSun = 0.0;
 		EDirSunDisk = 0.0;
 
-		for ( iIncElem = 1; iIncElem <= NIncBasis; ++iIncElem ) {
+		// Only the incoming directions in the nonzero rows of the outgoing column contribute
+		for ( iIncElem = VisFtTransFirst( RefPointIndex ); iIncElem <= VisFtTransLast( RefPointIndex ); ++iIncElem ) {
 			// LambdaInc = ComplexWind(IWin)%Geom(CurCplxFenState)%Inc%Lamda(iIncElem)
 			dirTrans = Construct( iConst ).BSDFInput.VisFrtTrans( iIncElem, RefPointIndex );
 
@@ -8395,8 +8945,8 @@ namespace DaylightingManager {
 		Real64 WinLumSunDisk; // window luminance from sun disk
 		Real64 ELumSunDisk; // window illuminance from sun disk
 		Real64 TransBeam; // transmittance of the beam for given direction
-		static FArray1D< Real64 > V( 3 ); // temporary vector
-		static FArray1D< Real64 > RWin( 3 ); // Window center
+		static thread_local FArray1D< Real64 > V( 3 ); // temporary vector
+		static thread_local FArray1D< Real64 > RWin( 3 ); // Window center
 		Real64 RayZ; // z component of unit vector for outgoing direction
 		bool refPointIntersect;
 
@@ -8626,12 +9176,12 @@ namespace DaylightingManager {
 		Real64 ElevWin; // Window elevation: angle between window outward normal and horizontal (radians)
 		Real64 AzimWin; // Window azimuth (radians)
 		Real64 AzimSun; // Sun azimuth (radians)
-		static FArray1D< Real64 > WinNorm( 3 ); // Window outward normal unit vector
+		static thread_local FArray1D< Real64 > WinNorm( 3 ); // Window outward normal unit vector
 		Real64 ThWin; // Azimuth angle of WinNorm
-		static FArray1D< Real64 > SunPrime( 3 ); // Projection of sun vector onto plane (perpendicular to
+		static thread_local FArray1D< Real64 > SunPrime( 3 ); // Projection of sun vector onto plane (perpendicular to
 		//  window plane) determined by WinNorm and vector along
 		//  baseline of window
-		static FArray1D< Real64 > WinNormCrossBase( 3 ); // Cross product of WinNorm and vector along window baseline
+		static thread_local FArray1D< Real64 > WinNormCrossBase( 3 ); // Cross product of WinNorm and vector along window baseline
 		//  INTEGER            :: IComp             ! Vector component index
 
 		// FLOW:
@@ -8710,9 +9260,10 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		// na
-		static FArray1D< Real64 > HitPt( 3 ); // Hit point on an obstruction (m)
+		static thread_local FArray1D< Real64 > HitPt( 3 ); // Hit point on an obstruction (m)
 		int IHit; // > 0 if obstruction is hit, 0 otherwise
 		int ObsSurfNum; // Obstruction surface number
+		static thread_local std::vector< int > ObsCandidates; // Possible obstructions along a ray
 
 		int TotObstructionsHit; // Number of obstructions hit by a ray
 		int ObsSurfNumToSkip; // Surface number of obstruction to be ignored
@@ -8725,7 +9276,8 @@ namespace DaylightingManager {
 		Real64 HitDistance_sq; // Distance squared from receiving point to hit point for a ray (m^2)
 		NearestHitPt = 0.0;
 		ObsSurfNumToSkip = 0;
-		for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+		SurfacesAlongRay( RecPt, RayVec, ObsCandidates );
+		for ( int const ObsSurfNum : ObsCandidates ) {
 			if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 			// If a window was hit previously (see below), ObsSurfNumToSkip was set to the window's base surface in order
 			// to remove that surface from consideration as a hit surface for this ray
@@ -8798,10 +9350,11 @@ namespace DaylightingManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static FArray1D< Real64 > ReflNorm( 3 ); // Unit normal to reflecting surface (m)
+		static thread_local FArray1D< Real64 > ReflNorm( 3 ); // Unit normal to reflecting surface (m)
 		int ObsSurfNum; // Obstruction surface number
+		static thread_local std::vector< int > ObsCandidates; // Possible obstructions along a ray
 		int IHitObs; // > 0 if obstruction is hit
-		static FArray1D< Real64 > ObsHitPt( 3 ); // Hit point on obstruction (m)
+		static thread_local FArray1D< Real64 > ObsHitPt( 3 ); // Hit point on obstruction (m)
 		Real64 CosIncAngAtHitPt; // Cosine of angle of incidence of sun at HitPt
 		Real64 DiffVisRefl; // Diffuse visible reflectance of ReflSurfNum
 
@@ -8826,7 +9379,8 @@ namespace DaylightingManager {
 		if ( CosIncAngAtHitPt <= 0.0 ) return; // Sun is in back of reflecting surface
 		// Sun reaches ReflHitPt if vector from ReflHitPt to sun is unobstructed
 		IHitObs = 0;
-		for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+		SurfacesAlongRay( ReflHitPt, SUNCOS_IHR, ObsCandidates );
+		for ( int const ObsSurfNum : ObsCandidates ) {
 			if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 			// Exclude as a possible obstructor ReflSurfNum and its base surface (if it has one)
 			if ( ObsSurfNum == ReflSurfNum || ObsSurfNum == Surface( ReflSurfNum ).BaseSurf ) continue;
@@ -8858,7 +9412,7 @@ namespace DaylightingManager {
 	{
 
 		// *****super modified version of DayltgInteriorIllum by Peter Graham Ellis
-		// *****removes all control code, just calculates illum and glare with previously determined control settings
+		// *****removes all control code, just calculates illum with previously determined control settings
 		// *****this should be packaged into a subroutine called from 2 places
 
 		// SUBROUTINE INFORMATION:
@@ -8873,23 +9427,31 @@ namespace DaylightingManager {
 		//                        daylight illum at ref pt was calculated as though it was off
 		//                      June 2009, TH: modified for thermochromic windows
 		//                      March 2010, TH: fix bug (CR 8057) for electrochromic windows
+		//                      October 2026: only evaluated for reported timesteps; factors are
+		//                        accumulated over contiguous map point columns; glare index dropped
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Using daylighting factors and exterior illuminance, determine
-		// the current-hour interior daylight illuminance and glare index
-		// at each reference point in a space.
+		// the current-hour interior daylight illuminance at each
+		// illuminance map point in a space.
 
 		// Called by InitSurfaceHeatBalance.
 
-		// METHODOLOGY EMPLOYED:na
+		// METHODOLOGY EMPLOYED:
+		// The maps are only written for the hours of non-warmup environments (see ReportIllumMap),
+		// so nothing is done during warmup, sizing or the kick-off of the simulation.
+		// For each window the sky and sun illuminance, the hour interpolation weights, the slat angle
+		// interpolation weights and the window VT multipliers are folded into one weight per factor
+		// column; the factor arrays are stored map point first so each column is contiguous and the
+		// accumulation over the map points is a simple loop.
+		// The map glare index is not reported and is therefore not calculated.
 
 		// REFERENCES:
 		// Based on DOE-2.1E subroutine DINTIL.
 
 		// Using/Aliasing
 		using General::POLYF;
-		using General::InterpSlatAng;
 
 		// Locals
 		static FArray1D< Real64 > DaylIllum;
@@ -8897,7 +9459,8 @@ namespace DaylightingManager {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		// na
+		static Real64 const DeltaAng( Pi / ( double( MaxSlatAngs ) - 1.0 ) ); // As in General::InterpSlatAng
+		static Real64 const DeltaAng_inv( ( double( MaxSlatAngs ) - 1.0 ) / Pi );
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -8907,40 +9470,22 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int NREFPT; // Number of daylighting map reference points
-		//INTEGER   :: REFPT1                ! 1st reference point
 		int ISky; // Sky type index
 		int ISky1; // Sky type index values for averaging two sky types
 		int ISky2;
-		static FArray2D< Real64 > DFSKHR( 4, 2 ); // Sky daylight factor for sky type (first index),
-		//   bare/shaded window (second index)
-		static FArray1D< Real64 > DFSUHR( 2 ); // Sun daylight factor for bare/shaded window
-		static FArray2D< Real64 > BFSKHR( 4, 2 ); // Sky background luminance factor for sky type (first index),
-		//   bare/shaded window (second index)
-		static FArray1D< Real64 > BFSUHR( 2 ); // Sun background luminance factor for bare/shaded window
-		static FArray2D< Real64 > SFSKHR( 4, 2 ); // Sky source luminance factor for sky type (first index),
-		//   bare/shaded window (second index)
-		static FArray1D< Real64 > SFSUHR( 2 ); // Sun source luminance factor for bare/shaded window
 		int IL; // Reference point index
 		int IWin; // Window index
 		int IS; // IS=1 for unshaded window, =2 for shaded window
-		//INTEGER   :: ISWFLG                ! Switchable glazing flag: =1 if one or more windows in a zone
-		//                                   !  has switchable glazing that adjusts visible transmittance to just meet
-		//                                   !  daylighting setpoint; =0 otherwise.
 		int ICtrl; // Window shading control pointer
 		Real64 SkyWeight; // Weighting factor used to average two different sky types
 		static FArray1D< Real64 > HorIllSky( 4 ); // Horizontal illuminance for different sky types
 		Real64 HorIllSkyFac; // Ratio between horizontal illuminance from sky horizontal irradiance and
 		//   luminous efficacy and horizontal illuminance from averaged sky
 		Real64 SlatAng; // Blind slat angle (rad)
-		bool VarSlats; // True if slats are movable, i.e., variable angle
+		int IBeta; // Slat angle index of the blind factors (2 to MaxSlatAngs+1)
+		Real64 InterpFac; // Slat angle interpolation factor
 		int loop; // Window loop index
-		Real64 GTOT;
-		Real64 GTOT1;
-		Real64 GTOT2;
-		static FArray1D< Real64 > BACLUM;
-		static FArray1D< Real64 > GLRNDX;
 		static bool FirstTimeFlag( true );
-		int ILB;
 
 		int IConst;
 		Real64 VTRatio;
@@ -8952,204 +9497,83 @@ namespace DaylightingManager {
 		static int IConstShaded( 0 ); // The shaded window construction for switchable windows
 		int MapNum;
 		int ILM;
+		int IHR; // Hour of the daylight factors (HourOfDay or PreviousHour)
+		int ISlat; // Slat angle interpolation term
+		int JSH; // Shading index of the daylight factors
+		bool SunDisk; // True if the sun disk is seen through the window
+		Real64 Sky1Mult; // Illuminance per unit daylight factor from sky type ISky1 (lux)
+		Real64 Sky2Mult; // Illuminance per unit daylight factor from sky type ISky2 (lux)
+		Real64 HourWeight; // Weight of the factors of hour IHR
+		Real64 SlatWeight; // Weight of the factors of shading index JSH
+		Real64 FacWeight; // Combined weight of the factors of this window, hour and shading index
+		Real64 SunWeight;
+		Real64 Sky1Weight;
+		Real64 Sky2Weight;
+
+		if ( WarmupFlag || DoingSizing || KickOffSimulation ) return;
+		if ( ZoneDaylight( ZoneNum ).MapCount == 0 ) return;
 
 		if ( FirstTimeFlag ) {
 			DaylIllum.allocate( MaxMapRefPoints );
-			BACLUM.allocate( MaxMapRefPoints );
-			GLRNDX.allocate( MaxMapRefPoints );
 			FirstTimeFlag = false;
 		}
 
-		if ( WarmupFlag ) return;
-		//              Initialize reference point illuminance and window background luminance
+		// Sky weights are the same for all maps and windows
+		if ( SkyClearness > 3.0 ) { //Sky is average of clear and clear turbid
+			SkyWeight = min( 1.0, ( SkyClearness - 3.0 ) / 3.0 );
+			ISky1 = 1;
+			ISky2 = 2;
+		} else if ( SkyClearness > 1.2 ) { //Sky is average of clear turbid and intermediate
+			SkyWeight = ( SkyClearness - 1.2 ) / 1.8;
+			ISky1 = 2;
+			ISky2 = 3;
+		} else { //Sky is average of intermediate and overcast
+			SkyWeight = min( 1.0, max( 0.0, ( SkyClearness - 1.0 ) / 0.2, ( SkyBrightness - 0.05 ) / 0.4 ) );
+			ISky1 = 3;
+			ISky2 = 4;
+		}
+
+		// Adding 0.001 in the following prevents zero HorIllSky in early morning or late evening when sun
+		// is up in the present time step but GILSK(ISky,HourOfDay) and GILSK(ISky,NextHour) are both zero.
+		for ( ISky = 1; ISky <= 4; ++ISky ) {
+			HorIllSky( ISky ) = WeightNow * GILSK( ISky, HourOfDay ) + WeightPreviousHour * GILSK( ISky, PreviousHour ) + 0.001;
+		}
+
+		// HISKF is current time step horizontal illuminance from sky, calculated in DayltgLuminousEfficacy,
+		// which is called in WeatherManager. HISUNF is current time step horizontal illuminance from sun,
+		// also calculated in DayltgLuminousEfficacy.
+		HorIllSkyFac = HISKF / ( ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) + SkyWeight * HorIllSky( ISky1 ) );
+		Sky1Mult = HorIllSkyFac * SkyWeight * HorIllSky( ISky1 );
+		Sky2Mult = HorIllSkyFac * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 );
 
 		for ( ILM = 1; ILM <= ZoneDaylight( ZoneNum ).MapCount; ++ILM ) {
 
 			MapNum = ZoneDaylight( ZoneNum ).ZoneToMap( ILM );
-			//    IllumMapCalc(MapNum)%DaylIllumAtMapPt  = 0.0
-			//    IllumMapCalc(MapNum)%GlareIndexAtMapPt = 0.0
-			NREFPT = IllumMapCalc( MapNum ).TotalMapRefPoints;
+			auto & MapCalc( IllumMapCalc( MapNum ) );
+			NREFPT = MapCalc.TotalMapRefPoints;
+			if ( NREFPT == 0 ) continue;
 
 			DaylIllum = 0.0;
-			BACLUM = 0.0;
-			GLRNDX = 0.0;
-
-			if ( SkyClearness > 3.0 ) { //Sky is average of clear and clear turbid
-				SkyWeight = min( 1.0, ( SkyClearness - 3.0 ) / 3.0 );
-				ISky1 = 1;
-				ISky2 = 2;
-			} else if ( SkyClearness > 1.2 ) { //Sky is average of clear turbid and intermediate
-				SkyWeight = ( SkyClearness - 1.2 ) / 1.8;
-				ISky1 = 2;
-				ISky2 = 3;
-			} else { //Sky is average of intermediate and overcast
-				SkyWeight = min( 1.0, max( 0.0, ( SkyClearness - 1.0 ) / 0.2, ( SkyBrightness - 0.05 ) / 0.4 ) );
-				ISky1 = 3;
-				ISky2 = 4;
-			}
-
-			//              First loop over windows in this space.
-			//              Find contribution of each window to the daylight illum
-			//              and to the glare numerator at each reference point.
-			//              Use shading flags set in WindowShadingManager.
+
+			//              Loop over windows in this space.
+			//              Add the contribution of each window to the daylight illum
+			//              at each map point. Use shading flags set in WindowShadingManager.
 
 			for ( loop = 1; loop <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loop ) {
 				IWin = ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop );
 
 				// Added TH 6/29/2009 for thermochromic windows
 				VTRatio = 1.0;
-				if ( NREFPT > 0 ) {
-					IConst = Surface( IWin ).Construction;
-					if ( Construct( IConst ).TCFlag == 1 ) {
-						// For thermochromic windows, daylight and glare factors are always calculated
-						//  based on the master construction. They need to be adjusted by the VTRatio, including:
-						//  ZoneDaylight()%DaylIllFacSky, DaylIllFacSun, DaylIllFacSunDisk; DaylBackFacSky,
-						//  DaylBackFacSun, DaylBackFacSunDisk, DaylSourceFacSky, DaylSourceFacSun, DaylSourceFacSunDisk
-						VTNow = POLYF( 1.0, Construct( IConst ).TransVisBeamCoef( 1 ) );
-						VTMaster = POLYF( 1.0, Construct( Construct( IConst ).TCMasterConst ).TransVisBeamCoef( 1 ) );
-						VTRatio = VTNow / VTMaster;
-					}
+				IConst = Surface( IWin ).Construction;
+				if ( Construct( IConst ).TCFlag == 1 ) {
+					// For thermochromic windows, daylight factors are always calculated
+					//  based on the master construction. They need to be adjusted by the VTRatio.
+					VTNow = POLYF( 1.0, Construct( IConst ).TransVisBeamCoef( 1 ) );
+					VTMaster = POLYF( 1.0, Construct( Construct( IConst ).TCMasterConst ).TransVisBeamCoef( 1 ) );
+					VTRatio = VTNow / VTMaster;
 				}
 
-				//              Loop over reference points
-				for ( ILB = 1; ILB <= NREFPT; ++ILB ) {
-
-					//          Daylight factors for current sun position
-					for ( ISky = 1; ISky <= 4; ++ISky ) {
-						//                                ===Bare window===
-						DFSKHR( ISky, 1 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSky( loop, ILB, ISky, 1, HourOfDay ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSky( loop, ILB, ISky, 1, PreviousHour ) );
-
-						if ( ISky == 1 ) {
-							DFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylIllFacSun( loop, ILB, 1, HourOfDay ) + IllumMapCalc( MapNum ).DaylIllFacSunDisk( loop, ILB, 1, HourOfDay ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylIllFacSun( loop, ILB, 1, PreviousHour ) + IllumMapCalc( MapNum ).DaylIllFacSunDisk( loop, ILB, 1, PreviousHour ) ) );
-						}
-
-						BFSKHR( ISky, 1 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSky( loop, ILB, ISky, 1, HourOfDay ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSky( loop, ILB, ISky, 1, PreviousHour ) );
-
-						if ( ISky == 1 ) {
-							BFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylBackFacSun( loop, ILB, 1, HourOfDay ) + IllumMapCalc( MapNum ).DaylBackFacSunDisk( loop, ILB, 1, HourOfDay ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylBackFacSun( loop, ILB, 1, PreviousHour ) + IllumMapCalc( MapNum ).DaylBackFacSunDisk( loop, ILB, 1, PreviousHour ) ) );
-						}
-
-						SFSKHR( ISky, 1 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSky( loop, ILB, ISky, 1, HourOfDay ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSky( loop, ILB, ISky, 1, PreviousHour ) );
-
-						if ( ISky == 1 ) {
-							SFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylSourceFacSun( loop, ILB, 1, HourOfDay ) + IllumMapCalc( MapNum ).DaylSourceFacSunDisk( loop, ILB, 1, HourOfDay ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylSourceFacSun( loop, ILB, 1, PreviousHour ) + IllumMapCalc( MapNum ).DaylSourceFacSunDisk( loop, ILB, 1, PreviousHour ) ) );
-						}
-
-						if ( SurfaceWindow( IWin ).ShadingFlag >= 1 || SurfaceWindow( IWin ).SolarDiffusing ) {
-
-							//                                 ===Shaded window===
-							if ( ! SurfaceWindow( IWin ).MovableSlats ) {
-								// Shade, screen, blind with fixed slats, or diffusing glass
-								DFSKHR( ISky, 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSky( loop, ILB, ISky, 2, HourOfDay ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSky( loop, ILB, ISky, 2, PreviousHour ) );
-
-								if ( ISky == 1 ) {
-									DFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSun( loop, ILB, 2, HourOfDay ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSun( loop, ILB, 2, PreviousHour ) );
-
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										DFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSunDisk( loop, ILB, 2, HourOfDay ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSunDisk( loop, ILB, 2, PreviousHour ) );
-									}
-								}
-
-								BFSKHR( ISky, 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSky( loop, ILB, ISky, 2, HourOfDay ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSky( loop, ILB, ISky, 2, PreviousHour ) );
-
-								if ( ISky == 1 ) {
-									BFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSun( loop, ILB, 2, HourOfDay ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSun( loop, ILB, 2, PreviousHour ) );
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										BFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSunDisk( loop, ILB, 2, HourOfDay ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSunDisk( loop, ILB, 2, PreviousHour ) );
-									}
-								}
-
-								SFSKHR( ISky, 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSky( loop, ILB, ISky, 2, HourOfDay ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSky( loop, ILB, ISky, 2, PreviousHour ) );
-
-								if ( ISky == 1 ) {
-									SFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSun( loop, ILB, 2, HourOfDay ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSun( loop, ILB, 2, PreviousHour ) );
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										SFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSunDisk( loop, ILB, 2, HourOfDay ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSunDisk( loop, ILB, 2, PreviousHour ) );
-									}
-								}
-
-							} else { // Blind with movable slats
-								VarSlats = SurfaceWindow( IWin ).MovableSlats;
-								SlatAng = SurfaceWindow( IWin ).SlatAngThisTS;
-
-								DFSKHR( ISky, 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSky( loop, ILB, ISky, {2,MaxSlatAngs + 1}, HourOfDay ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSky( loop, ILB, ISky, {2,MaxSlatAngs + 1}, PreviousHour ) ) );
-
-								if ( ISky == 1 ) {
-									DFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSun( loop, ILB, {2,MaxSlatAngs + 1}, HourOfDay ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSun( loop, ILB, {2,MaxSlatAngs + 1}, PreviousHour ) ) );
-
-									// We add the contribution from the solar disk if slats do not block beam solar
-									// TH CR 8010, DaylIllFacSunDisk needs to be interpolated
-									//IF(.NOT.SurfaceWindow(IWin)%SlatsBlockBeam) DFSUHR(2) = DFSUHR(2) + &
-									//  VTRatio * (WeightNow * ZoneDaylight(ZoneNum)%DaylIllFacSunDisk(loop,ILB,2,HourOfDay) + &
-									//            WeightPreviousHour * ZoneDaylight(ZoneNum)%DaylIllFacSunDisk(loop,ILB,2,PreviousHour))
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										DFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSunDisk( loop, ILB, {2,MaxSlatAngs + 1}, HourOfDay ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSunDisk( loop, ILB, {2,MaxSlatAngs + 1}, PreviousHour ) ) );
-									}
-								}
-
-								BFSKHR( ISky, 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( loop, ILB, ISky, {2,MaxSlatAngs + 1}, HourOfDay ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( loop, ILB, ISky, {2,MaxSlatAngs + 1}, PreviousHour ) ) );
-
-								if ( ISky == 1 ) {
-									BFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( loop, ILB, {2,MaxSlatAngs + 1}, HourOfDay ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( loop, ILB, {2,MaxSlatAngs + 1}, PreviousHour ) ) );
-
-									// TH CR 8010, DaylBackFacSunDisk needs to be interpolated
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										BFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSunDisk( loop, ILB, {2,MaxSlatAngs + 1}, HourOfDay ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSunDisk( loop, ILB, {2,MaxSlatAngs + 1}, PreviousHour ) ) );
-									}
-								}
-
-								SFSKHR( ISky, 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( loop, ILB, ISky, {2,MaxSlatAngs + 1}, HourOfDay ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( loop, ILB, ISky, {2,MaxSlatAngs + 1}, PreviousHour ) ) );
-
-								if ( ISky == 1 ) {
-									SFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( loop, ILB, {2,MaxSlatAngs + 1}, HourOfDay ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( loop, ILB, {2,MaxSlatAngs + 1}, PreviousHour ) ) );
-
-									// TH CR 8010, DaylSourceFacSunDisk needs to be interpolated
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										SFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSunDisk( loop, ILB, {2,MaxSlatAngs + 1}, HourOfDay ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSunDisk( loop, ILB, {2,MaxSlatAngs + 1}, PreviousHour ) ) );
-									}
-								}
-
-							} // End of check if window has blind with movable slats
-
-						} // End of check if window is shaded or has diffusing glass
-
-					}
-
-					//              Get illuminance at ref point from bare and shaded window by
-					//              multiplying daylight factors by exterior horizontal illuminance
-
-					// Adding 0.001 in the following prevents zero HorIllSky in early morning or late evening when sun
-					// is up in the present time step but GILSK(ISky,HourOfDay) and GILSK(ISky,NextHour) are both zero.
-					for ( ISky = 1; ISky <= 4; ++ISky ) {
-						HorIllSky( ISky ) = WeightNow * GILSK( ISky, HourOfDay ) + WeightPreviousHour * GILSK( ISky, PreviousHour ) + 0.001;
-					}
-
-					// HISKF is current time step horizontal illuminance from sky, calculated in DayltgLuminousEfficacy,
-					// which is called in WeatherManager. HISUNF is current time step horizontal illuminance from sun,
-					// also calculated in DayltgLuminousEfficacy.
-					HorIllSkyFac = HISKF / ( ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) + SkyWeight * HorIllSky( ISky1 ) );
-
-					for ( IS = 1; IS <= 2; ++IS ) {
-						if ( IS == 2 && SurfaceWindow( IWin ).ShadingFlag <= 0 && ! SurfaceWindow( IWin ).SolarDiffusing ) break;
-
-						IllumMapCalc( MapNum ).IllumFromWinAtMapPt( ILB, IS, loop ) = DFSUHR( IS ) * HISUNF + HorIllSkyFac * ( DFSKHR( ISky1, IS ) * SkyWeight * HorIllSky( ISky1 ) + DFSKHR( ISky2, IS ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
-
-						IllumMapCalc( MapNum ).BackLumFromWinAtMapPt( ILB, IS, loop ) = BFSUHR( IS ) * HISUNF + HorIllSkyFac * ( BFSKHR( ISky1, IS ) * SkyWeight * HorIllSky( ISky1 ) + BFSKHR( ISky2, IS ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
-
-						IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( ILB, IS, loop ) = SFSUHR( IS ) * HISUNF + HorIllSkyFac * ( SFSKHR( ISky1, IS ) * SkyWeight * HorIllSky( ISky1 ) + SFSKHR( ISky2, IS ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
-						IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( ILB, IS, loop ) = max( IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( ILB, IS, loop ), 0.0 );
-					}
-
-				} // End of reference point loop
-			} // End of first loop over windows
-
-			//              Second loop over windows. Find total daylight illuminance
-			//              and background luminance for each ref pt from all windows in
-			//              the space.  Use shading flags.
-
-			for ( loop = 1; loop <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loop ) {
-				IWin = ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop );
-
+				//              Determine if illuminance contribution is from bare or shaded window
 				IS = 1;
 				if ( ( SurfaceWindow( IWin ).ShadingFlag >= 1 && SurfaceWindow( IWin ).ShadingFlag <= 9 ) || SurfaceWindow( IWin ).SolarDiffusing ) IS = 2;
 
@@ -9168,57 +9592,57 @@ namespace DaylightingManager {
 					}
 				}
 
-				for ( IL = 1; IL <= NREFPT; ++IL ) {
-					//              Determine if illuminance contribution is from bare or shaded window
-					DaylIllum( IL ) += VTMULT * IllumMapCalc( MapNum ).IllumFromWinAtMapPt( IL, IS, loop );
-					BACLUM( IL ) += VTMULT * IllumMapCalc( MapNum ).BackLumFromWinAtMapPt( IL, IS, loop );
+				// Shading index and slat angle interpolation, as in General::InterpSlatAng
+				// TH CR 8010, the sun disk factors of blinds with movable slats are interpolated too
+				IBeta = IS;
+				InterpFac = 0.0;
+				SunDisk = true;
+				if ( IS == 2 ) {
+					SunDisk = ! SurfaceWindow( IWin ).SlatsBlockBeam;
+					if ( SurfaceWindow( IWin ).MovableSlats ) {
+						SlatAng = min( max( SurfaceWindow( IWin ).SlatAngThisTS, 0.0 ), Pi );
+						IBeta = 1 + int( SlatAng * DeltaAng_inv );
+						InterpFac = ( SlatAng - DeltaAng * ( IBeta - 1 ) ) * DeltaAng_inv;
+						if ( IBeta >= MaxSlatAngs ) InterpFac = 0.0; // Last slat angle: no next one
+						++IBeta; // Slat angle 1 is shading index 2
+					}
 				}
 
-			} // End of second window loop
-
-			//              Calculate glare index at each reference point
-			for ( IL = 1; IL <= NREFPT; ++IL ) {
-				//        Following code taken directly from DayltgGlare ... duplicate calculation
-				// Initialize glare constant
-				GTOT = 0.0;
-
-				// Loop over exterior windows associated with zone
-				for ( loop = 1; loop <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loop ) {
-					IWin = ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop );
-					IS = 1;
-					if ( ( SurfaceWindow( IWin ).ShadingFlag >= 1 && SurfaceWindow( IWin ).ShadingFlag <= 9 ) || SurfaceWindow( IWin ).SolarDiffusing ) IS = 2;
-
-					// CR 8057. 3/17/2010
-					VTMULT = 1.0;
-
-					ICtrl = Surface( IWin ).WindowShadingControlPtr;
-					if ( ICtrl > 0 ) {
-						if ( WindowShadingControl( ICtrl ).ShadingControlType == WSCT_MeetDaylIlumSetp && SurfaceWindow( IWin ).ShadingFlag == SwitchableGlazing ) {
-							// switchable windows in partial or fully switched state,
-							//  get its intermediate VT calculated in DayltgInteriorIllum
-							IConstShaded = Surface( IWin ).ShadedConstruction;
-							if ( IConstShaded > 0 ) VTDark = POLYF( 1.0, Construct( IConstShaded ).TransVisBeamCoef( 1 ) ) * SurfaceWindow( IWin ).GlazedFrac;
-							if ( VTDark > 0 ) VTMULT = SurfaceWindow( IWin ).VisTransSelected / VTDark;
+				for ( IHR = 1; IHR <= 2; ++IHR ) {
+					HourWeight = ( IHR == 1 ? WeightNow : WeightPreviousHour );
+					if ( HourWeight == 0.0 ) continue;
+					int const Hour( IHR == 1 ? HourOfDay : PreviousHour );
+					for ( ISlat = 0; ISlat <= 1; ++ISlat ) {
+						SlatWeight = ( ISlat == 0 ? 1.0 - InterpFac : InterpFac );
+						if ( SlatWeight == 0.0 ) continue;
+						JSH = IBeta + ISlat;
+						FacWeight = VTMULT * VTRatio * HourWeight * SlatWeight;
+						SunWeight = FacWeight * HISUNF;
+						Sky1Weight = FacWeight * Sky1Mult;
+						Sky2Weight = FacWeight * Sky2Mult;
+
+						//Tuned Linear indexing over the contiguous map point columns
+						auto const lSky1( MapCalc.DaylIllFacSky.index( 1, loop, ISky1, JSH, Hour ) );
+						auto const lSky2( MapCalc.DaylIllFacSky.index( 1, loop, ISky2, JSH, Hour ) );
+						auto const lSun( MapCalc.DaylIllFacSun.index( 1, loop, JSH, Hour ) );
+						assert( equal_dimensions( MapCalc.DaylIllFacSun, MapCalc.DaylIllFacSunDisk ) );
+						if ( SunDisk ) {
+							for ( IL = 0; IL < NREFPT; ++IL ) {
+								DaylIllum[ IL ] += SunWeight * ( MapCalc.DaylIllFacSun[ lSun + IL ] + MapCalc.DaylIllFacSunDisk[ lSun + IL ] ) + Sky1Weight * MapCalc.DaylIllFacSky[ lSky1 + IL ] + Sky2Weight * MapCalc.DaylIllFacSky[ lSky2 + IL ];
+							}
+						} else {
+							for ( IL = 0; IL < NREFPT; ++IL ) {
+								DaylIllum[ IL ] += SunWeight * MapCalc.DaylIllFacSun[ lSun + IL ] + Sky1Weight * MapCalc.DaylIllFacSky[ lSky1 + IL ] + Sky2Weight * MapCalc.DaylIllFacSky[ lSky2 + IL ];
+							}
 						}
 					}
-
-					// Conversion from ft-L to cd/m2, with cd/m2 = 0.2936 ft-L, gives the 0.4794 factor
-					// below, which is (0.2936)**0.6
-					GTOT1 = 0.4794 * ( std::pow( VTMULT * IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( IL, IS, loop ), 1.6 ) ) * std::pow( IllumMapCalc( MapNum ).SolidAngAtMapPtWtd( IL, loop ), 0.8 );
-					GTOT2 = BACLUM( IL ) + 0.07 * ( std::sqrt( IllumMapCalc( MapNum ).SolidAngAtMapPt( IL, loop ) ) ) * VTMULT * IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( IL, IS, loop );
-					GTOT += GTOT1 / ( GTOT2 + 0.000001 );
 				}
 
-				// Glare index (adding 0.000001 prevents LOG10 (0))
-				GLRNDX( IL ) = 10.0 * std::log10( GTOT + 0.000001 );
-				// Set glare index to zero for GTOT < 1
-				GLRNDX( IL ) = max( 0.0, GLRNDX( IL ) );
-			}
+			} // End of window loop
 
 			//              Variables for reporting
 			for ( IL = 1; IL <= NREFPT; ++IL ) {
-				IllumMapCalc( MapNum ).DaylIllumAtMapPt( IL ) = max( DaylIllum( IL ), 0.0 );
-				IllumMapCalc( MapNum ).GlareIndexAtMapPt( IL ) = GLRNDX( IL );
+				MapCalc.DaylIllumAtMapPt( IL ) = max( DaylIllum( IL ), 0.0 );
 			}
 		}
 
@@ -9846,12 +10270,6 @@ Label903: ;
 						IllumMapCalc( MapNum ).SolidAngAtMapPt = 0.0;
 						IllumMapCalc( MapNum ).SolidAngAtMapPtWtd.allocate( IllumMapCalc( MapNum ).TotalMapRefPoints, ZoneExtWin( ZoneNum ) );
 						IllumMapCalc( MapNum ).SolidAngAtMapPtWtd = 0.0;
-						IllumMapCalc( MapNum ).IllumFromWinAtMapPt.allocate( IllumMapCalc( MapNum ).TotalMapRefPoints, 2, ZoneExtWin( ZoneNum ) );
-						IllumMapCalc( MapNum ).IllumFromWinAtMapPt = 0.0;
-						IllumMapCalc( MapNum ).BackLumFromWinAtMapPt.allocate( IllumMapCalc( MapNum ).TotalMapRefPoints, 2, ZoneExtWin( ZoneNum ) );
-						IllumMapCalc( MapNum ).BackLumFromWinAtMapPt = 0.0;
-						IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt.allocate( IllumMapCalc( MapNum ).TotalMapRefPoints, 2, ZoneExtWin( ZoneNum ) );
-						IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt = 0.0;
 					}
 				}
 
@@ -9916,15 +10334,15 @@ Label903: ;
 				for ( loop = 1; loop <= ZoneDaylight( ZoneNum ).MapCount; ++loop ) {
 					MapNum = ZoneDaylight( ZoneNum ).ZoneToMap( loop );
 					RefSize = IllumMapCalc( MapNum ).TotalMapRefPoints;
-					IllumMapCalc( MapNum ).DaylIllFacSky.allocate( WinSize, RefSize, 4, MaxSlatAngs + 1, 24 );
-					IllumMapCalc( MapNum ).DaylSourceFacSky.allocate( WinSize, RefSize, 4, MaxSlatAngs + 1, 24 );
-					IllumMapCalc( MapNum ).DaylBackFacSky.allocate( WinSize, RefSize, 4, MaxSlatAngs + 1, 24 );
-					IllumMapCalc( MapNum ).DaylIllFacSun.allocate( WinSize, RefSize, MaxSlatAngs + 1, 24 );
-					IllumMapCalc( MapNum ).DaylIllFacSunDisk.allocate( WinSize, RefSize, MaxSlatAngs + 1, 24 );
-					IllumMapCalc( MapNum ).DaylSourceFacSun.allocate( WinSize, RefSize, MaxSlatAngs + 1, 24 );
-					IllumMapCalc( MapNum ).DaylSourceFacSunDisk.allocate( WinSize, RefSize, MaxSlatAngs + 1, 24 );
-					IllumMapCalc( MapNum ).DaylBackFacSun.allocate( WinSize, RefSize, MaxSlatAngs + 1, 24 );
-					IllumMapCalc( MapNum ).DaylBackFacSunDisk.allocate( WinSize, RefSize, MaxSlatAngs + 1, 24 );
+					IllumMapCalc( MapNum ).DaylIllFacSky.allocate( RefSize, WinSize, 4, MaxSlatAngs + 1, 24 );
+					IllumMapCalc( MapNum ).DaylSourceFacSky.allocate( RefSize, WinSize, 4, MaxSlatAngs + 1, 24 );
+					IllumMapCalc( MapNum ).DaylBackFacSky.allocate( RefSize, WinSize, 4, MaxSlatAngs + 1, 24 );
+					IllumMapCalc( MapNum ).DaylIllFacSun.allocate( RefSize, WinSize, MaxSlatAngs + 1, 24 );
+					IllumMapCalc( MapNum ).DaylIllFacSunDisk.allocate( RefSize, WinSize, MaxSlatAngs + 1, 24 );
+					IllumMapCalc( MapNum ).DaylSourceFacSun.allocate( RefSize, WinSize, MaxSlatAngs + 1, 24 );
+					IllumMapCalc( MapNum ).DaylSourceFacSunDisk.allocate( RefSize, WinSize, MaxSlatAngs + 1, 24 );
+					IllumMapCalc( MapNum ).DaylBackFacSun.allocate( RefSize, WinSize, MaxSlatAngs + 1, 24 );
+					IllumMapCalc( MapNum ).DaylBackFacSunDisk.allocate( RefSize, WinSize, MaxSlatAngs + 1, 24 );
 				}
 
 			} // End of check if a Daylighting:Detailed zone
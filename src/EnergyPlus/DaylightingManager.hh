@@ -1,7 +1,12 @@
 #ifndef DaylightingManager_hh_INCLUDED
 #define DaylightingManager_hh_INCLUDED
 
+// C++ Headers
+#include <cstdint>
+#include <vector>
+
 // ObjexxFCL Headers
+#include <ObjexxFCL/FArray.fwd.hh>
 #include <ObjexxFCL/FArray1A.hh>
 #include <ObjexxFCL/FArray2A.hh>
 #include <ObjexxFCL/FArray2S.hh>
@@ -11,6 +16,7 @@
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 #include <DataBSDFWindow.hh>
+#include <ShadingCache.hh>
 
 namespace EnergyPlus {
 
@@ -27,10 +33,10 @@ namespace DaylightingManager {
 	extern int TotWindowsWithDayl; // Total number of exterior windows in all daylit zones
 	extern int OutputFileDFS; // Unit number for daylight factors
 	extern FArray1D< Real64 > DaylIllum; // Daylight illuminance at reference points (lux)
-	extern Real64 PHSUN; // Solar altitude (radians)
-	extern Real64 SPHSUN; // Sine of solar altitude
-	extern Real64 CPHSUN; // Cosine of solar altitude
-	extern Real64 THSUN; // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
+	extern thread_local Real64 PHSUN; // Solar altitude (radians)
+	extern thread_local Real64 SPHSUN; // Sine of solar altitude
+	extern thread_local Real64 CPHSUN; // Cosine of solar altitude
+	extern thread_local Real64 THSUN; // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
 	extern FArray1D< Real64 > PHSUNHR; // Hourly values of PHSUN
 	extern FArray1D< Real64 > SPHSUNHR; // Hourly values of the sine of PHSUN
 	extern FArray1D< Real64 > CPHSUNHR; // Hourly values of the cosine of PHSUN
@@ -40,24 +46,24 @@ namespace DaylightingManager {
 	// I = 1 for clear sky, 2 for clear turbid, 3 for intermediate, 4 for overcast;
 	// J = 1 for bare window, 2 - 12 for shaded;
 	// K = sun position index.
-	extern FArray3D< Real64 > EINTSK; // Sky-related portion of internally reflected illuminance
-	extern FArray2D< Real64 > EINTSU; // Sun-related portion of internally reflected illuminance,
+	extern thread_local FArray3D< Real64 > EINTSK; // Sky-related portion of internally reflected illuminance
+	extern thread_local FArray2D< Real64 > EINTSU; // Sun-related portion of internally reflected illuminance,
 	// excluding entering beam
-	extern FArray2D< Real64 > EINTSUdisk; // Sun-related portion of internally reflected illuminance
+	extern thread_local FArray2D< Real64 > EINTSUdisk; // Sun-related portion of internally reflected illuminance
 	// due to entering beam
-	extern FArray3D< Real64 > WLUMSK; // Sky-related window luminance
-	extern FArray2D< Real64 > WLUMSU; // Sun-related window luminance, excluding view of solar disk
-	extern FArray2D< Real64 > WLUMSUdisk; // Sun-related window luminance, due to view of solar disk
+	extern thread_local FArray3D< Real64 > WLUMSK; // Sky-related window luminance
+	extern thread_local FArray2D< Real64 > WLUMSU; // Sun-related window luminance, excluding view of solar disk
+	extern thread_local FArray2D< Real64 > WLUMSUdisk; // Sun-related window luminance, due to view of solar disk
 
 	extern FArray2D< Real64 > GILSK; // Horizontal illuminance from sky, by sky type, for each hour of the day
 	extern FArray1D< Real64 > GILSU; // Horizontal illuminance from sun for each hour of the day
 
-	extern FArray3D< Real64 > EDIRSK; // Sky-related component of direct illuminance
-	extern FArray2D< Real64 > EDIRSU; // Sun-related component of direct illuminance (excluding beam solar at ref pt)
-	extern FArray2D< Real64 > EDIRSUdisk; // Sun-related component of direct illuminance due to beam solar at ref pt
-	extern FArray3D< Real64 > AVWLSK; // Sky-related average window luminance
-	extern FArray2D< Real64 > AVWLSU; // Sun-related average window luminance, excluding view of solar disk
-	extern FArray2D< Real64 > AVWLSUdisk; // Sun-related average window luminance due to view of solar disk
+	extern thread_local FArray3D< Real64 > EDIRSK; // Sky-related component of direct illuminance
+	extern thread_local FArray2D< Real64 > EDIRSU; // Sun-related component of direct illuminance (excluding beam solar at ref pt)
+	extern thread_local FArray2D< Real64 > EDIRSUdisk; // Sun-related component of direct illuminance due to beam solar at ref pt
+	extern thread_local FArray3D< Real64 > AVWLSK; // Sky-related average window luminance
+	extern thread_local FArray2D< Real64 > AVWLSU; // Sun-related average window luminance, excluding view of solar disk
+	extern thread_local FArray2D< Real64 > AVWLSUdisk; // Sun-related average window luminance due to view of solar disk
 
 	// Allocatable daylight factor arrays  -- are in the ZoneDaylight Structure
 
@@ -71,6 +77,7 @@ namespace DaylightingManager {
 	extern FArray1D_bool CheckTDDZone;
 
 	extern std::string mapLine; // character variable to hold map outputs
+	extern std::uint64_t DayltgInputHash; // Hash of the daylighting inputs starting each shading result cache record key
 
 	// Functions
 
@@ -80,6 +87,55 @@ namespace DaylightingManager {
 	void
 	CalcDayltgCoefficients();
 
+	void
+	FindDayltgZoneGroups( std::vector< std::vector< int > > & ZoneGroups ); // Daylit zones that share exterior windows
+
+	bool
+	DayltgCoeffsCacheable( std::vector< int > const & Zones ); // Daylit zones of one group
+
+	std::uint64_t
+	HashDayltgArray(
+		std::uint64_t const Hash,
+		FArray< Real64 > const & Values
+	);
+
+	std::uint64_t
+	DayltgCoeffInputHash();
+
+	std::uint64_t
+	DayltgCoeffRecordKey(
+		std::vector< int > const & Zones, // Daylit zones of one group
+		bool const MapsIncluded // True if illuminance map factors are calculated too
+	);
+
+	void
+	DayltgCoeffRecordArrays(
+		std::vector< int > const & Zones, // Daylit zones of one group
+		bool const MapsIncluded, // True if illuminance map factors are calculated too
+		std::vector< FArray< Real64 > * > & Arrays, // Arrays of results written for the group
+		std::vector< int > & Pipes // TDD pipes of the group's windows
+	);
+
+	void
+	PackDayltgCoeffRecord(
+		std::vector< int > const & Zones, // Daylit zones of one group
+		bool const MapsIncluded, // True if illuminance map factors are calculated too
+		ShadingCache::ShadingRecord & Record
+	);
+
+	bool
+	UnpackDayltgCoeffRecord(
+		std::vector< int > const & Zones, // Daylit zones of one group
+		bool const MapsIncluded, // True if illuminance map factors are calculated too
+		ShadingCache::ShadingRecord const & Record
+	);
+
+	void
+	SetupDayltgCoeffsFromRecord(
+		int const ZoneNum,
+		bool const MapsIncluded // True if illuminance map factors are calculated too
+	);
+
 	void
 	CalcDayltgCoeffsRefMapPoints( int const ZoneNum );
 
@@ -326,6 +326,15 @@ EnergyPlusPgm( std::string const & filepath )
 	get_environment_variable( MinReportFrequencyEnvVar, cEnvValue );
 	if ( ! cEnvValue.empty() ) cMinReportFrequency = cEnvValue; // turned into value later
 
+	get_environment_variable( ShadingCacheEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) ShadingCacheFileName = cEnvValue; // opened in SolarShading
+
+	get_environment_variable( CTFCacheEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) CTFCacheFileName = cEnvValue; // opened in ConductionTransferFunctionCalc
+
+	get_environment_variable( GlazingOpticsCacheEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) GlazingOpticsCacheFileName = cEnvValue; // opened in WindowManager
+
 	get_environment_variable( cDeveloperFlag, cEnvValue );
 	if ( ! cEnvValue.empty() ) DeveloperFlag = env_var_on( cEnvValue ); // Yes or True
 
@@ -354,6 +363,9 @@ EnergyPlusPgm( std::string const & filepath )
 	get_environment_variable( TraceHVACControllerEnvVar, cEnvValue );
 	if ( ! cEnvValue.empty() ) TraceHVACControllerEnvFlag = env_var_on( cEnvValue ); // Yes or True
 
+	get_environment_variable( TraceHCClippingEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) TraceHCClippingEnvFlag = env_var_on( cEnvValue ); // Yes or True
+
 	if( ! filepath.empty() ) {
 		// if filepath is not empty, then we are using E+ as a library API call
 		// change the directory to the specified folder, and pass in dummy args to command line parser
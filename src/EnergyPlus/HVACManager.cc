@@ -599,6 +599,7 @@ namespace HVACManager {
 		using DataPlant::TotNumLoops;
 		using DataPlant::PlantManageSubIterations;
 		using DataPlant::PlantManageHalfLoopCalls;
+		using DataPlant::PlantManageHalfLoopSkips;
 		using DataPlant::DemandSide;
 		using DataPlant::SupplySide;
 		using DataPlant::PlantLoop;
@@ -691,6 +692,7 @@ namespace HVACManager {
 		HVACManageIteration = 0;
 		PlantManageSubIterations = 0;
 		PlantManageHalfLoopCalls = 0;
+		PlantManageHalfLoopSkips = 0;
 		SetAllPlantSimFlagsToValue( true );
 		if ( ! IterSetup ) {
 			SetupOutputVariable( "HVAC System Solver Iteration Count []", HVACManageIteration, "HVAC", "Sum", "SimHVAC" );
@@ -709,6 +711,7 @@ namespace HVACManager {
 			if ( TotNumLoops > 0 ) {
 				SetupOutputVariable( "Plant Solver Sub Iteration Count []", PlantManageSubIterations, "HVAC", "Sum", "SimHVAC" );
 				SetupOutputVariable( "Plant Solver Half Loop Calls Count []", PlantManageHalfLoopCalls, "HVAC", "Sum", "SimHVAC" );
+				SetupOutputVariable( "Plant Solver Half Loop Calls Skipped Count []", PlantManageHalfLoopSkips, "HVAC", "Sum", "SimHVAC" );
 				for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
 					// init plant sizing numbers in main plant data structure
 					InitOneTimePlantSizingInfo( LoopNum );
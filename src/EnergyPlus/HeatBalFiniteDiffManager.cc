@@ -123,6 +123,10 @@ namespace HeatBalFiniteDiffManager {
 	int const FullyImplicitFirstOrder( 2 ); // fully implicit scheme, first order in time.
 	FArray1D_string const cCondFDSchemeType( 2, { "CrankNicholsonSecondOrder", "FullyImplicitFirstOrder" } );
 
+	int const GaussSeidelInnerSolver( 1 ); // original inner loop, node equations iterated one node at a time
+	int const TridiagonalInnerSolver( 2 ); // node equations of each sweep solved together with the Thomas algorithm
+	FArray1D_string const cCondFDInnerSolver( 2, { "GaussSeidel", "Tridiagonal" } );
+
 	Real64 const TempInitValue( 23.0 ); // Initialization value for Temperature
 	Real64 const RhovInitValue( 0.0115 ); // Initialization value for Rhov
 	Real64 const EnthInitValue( 100.0 ); // Initialization value for Enthalpy
@@ -157,6 +161,7 @@ namespace HeatBalFiniteDiffManager {
 	//                                                                 ! before CR 8280 -- Qdryout         !HeatFlux on Surface for reporting for Sensible only
 
 	int CondFDSchemeType( FullyImplicitFirstOrder ); // solution scheme for CondFD - default
+	int CondFDInnerSolver( GaussSeidelInnerSolver ); // solver for the node equations of each inner loop iteration
 	Real64 SpaceDescritConstant( 3.0 ); // spatial descritization constant,
 	Real64 MinTempLimit( -100.0 ); // lower limit check, degree C
 	Real64 MaxTempLimit( 100.0 ); // upper limit check, degree C
@@ -339,6 +344,21 @@ namespace HeatBalFiniteDiffManager {
 				MaxAllowedDelTempCondFD = rNumericArgs( 3 );
 			}
 
+			if ( NumAlphas > 1 && ! lAlphaFieldBlanks( 2 ) ) {
+
+				{ auto const SELECT_CASE_var( cAlphaArgs( 2 ) );
+
+				if ( SELECT_CASE_var == "GAUSSSEIDEL" ) {
+					CondFDInnerSolver = GaussSeidelInnerSolver;
+				} else if ( SELECT_CASE_var == "TRIDIAGONAL" ) {
+					CondFDInnerSolver = TridiagonalInnerSolver;
+				} else {
+					ShowSevereError( cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 2 ) + " entered=" + cAlphaArgs( 2 ) + ", must match GaussSeidel or Tridiagonal." );
+					ErrorsFound = true;
+				}}
+
+			}
+
 		} // settings object
 
 		pcMat = GetNumObjectsFound( "MaterialProperty:PhaseChange" );
@@ -943,6 +963,12 @@ namespace HeatBalFiniteDiffManager {
 			SurfaceFD( Surf ).EnthOld.allocate( TotNodes + 1 );
 			SurfaceFD( Surf ).EnthNew.allocate( TotNodes + 1 );
 			SurfaceFD( Surf ).EnthLast.allocate( TotNodes + 1 );
+			if ( CondFDInnerSolver == TridiagonalInnerSolver ) {
+				SurfaceFD( Surf ).CoefM.allocate( TotNodes + 1 );
+				SurfaceFD( Surf ).CoefP.allocate( TotNodes + 1 );
+				SurfaceFD( Surf ).CoefC.allocate( TotNodes + 1 );
+				SurfaceFD( Surf ).CoefWork.allocate( TotNodes + 1 );
+			}
 
 			//Initialize the allocated arrays.
 			SurfaceFD( Surf ).T = TempInitValue;
@@ -961,6 +987,12 @@ namespace HeatBalFiniteDiffManager {
 			SurfaceFD( Surf ).EnthOld = EnthInitValue;
 			SurfaceFD( Surf ).EnthNew = EnthInitValue;
 			SurfaceFD( Surf ).EnthLast = EnthInitValue;
+			if ( CondFDInnerSolver == TridiagonalInnerSolver ) {
+				SurfaceFD( Surf ).CoefM = 0.0;
+				SurfaceFD( Surf ).CoefP = 0.0;
+				SurfaceFD( Surf ).CoefC = TempInitValue;
+				SurfaceFD( Surf ).CoefWork = 0.0;
+			}
 		}
 
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
@@ -1070,8 +1102,6 @@ namespace HeatBalFiniteDiffManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Real64 MaxDelTemp( 0.0 );
-
 		int const ConstrNum( Surface( Surf ).Construction );
 
 		int const TotNodes( ConstructFD( ConstrNum ).TotNodes );
@@ -1107,6 +1137,8 @@ namespace HeatBalFiniteDiffManager {
 		int RoughIndexMovInsul; // roughness  Movable insulation
 		Real64 AbsExt; // exterior absorptivity  movable insulation
 		EvalOutsideMovableInsulation( Surf, HMovInsul, RoughIndexMovInsul, AbsExt );
+		bool const SolveTridiagonal( CondFDInnerSolver == TridiagonalInnerSolver );
+		int const MinGSiter( SolveTridiagonal ? 1 : 2 ); // Iterations always done before the convergence check
 		// Start stepping through the slab with time.
 		for ( int J = 1, J_end = nint( TimeStepZoneSec / Delt ); J <= J_end; ++J ) { //PT testing higher time steps
 
@@ -1143,6 +1175,13 @@ namespace HeatBalFiniteDiffManager {
 
 				} // layer loop
 
+				// With the tridiagonal solver the sweep above evaluates the conductivities and phase change
+				// enthalpies at the current temperatures and records the node equations, which are then solved
+				// for all nodes at once.  The iterations only follow the temperature dependent properties.
+				if ( SolveTridiagonal ) {
+					SolveNodeEquations( surfaceFD.CoefM, surfaceFD.CoefP, surfaceFD.CoefC, surfaceFD.CoefWork, TDT ); // Keeps the sweep result if singular
+				}
+
 				// Apply Relaxation factor for stability, use current (TDT) and previous (TDTLast) iteration temperature values
 				// to obtain the actual temperature that is going to be used for next iteration. This would mostly happen with PCM
 				//Tuned Function call to eliminate array temporaries and multiple relaxation passes
@@ -1157,7 +1196,7 @@ namespace HeatBalFiniteDiffManager {
 				// the following could blow up when all the node temps sum to less than 1.0.  seems poorly formulated for temperature in C.
 				//PT delete one zero and decrese number of minimum iterations, from 3 (which actually requires 4 iterations) to 2.
 
-				if ( ( GSiter > 2 ) && ( std::abs( sum_array_diff( TDT, TDTLast ) / sum( TDT ) ) < 0.00001 ) ) break;
+				if ( ( GSiter > MinGSiter ) && ( std::abs( sum_array_diff( TDT, TDTLast ) / sum( TDT ) ) < 0.00001 ) ) break;
 				//SurfaceFD(Surf)%GSloopCounter = Gsiter  !PT moved out of GSloop so it can actually count all iterations
 
 				//feb2012 the following could blow up when all the node temps sum to less than 1.0.  seems poorly formulated for temperature in C.
@@ -1199,7 +1238,7 @@ namespace HeatBalFiniteDiffManager {
 		RhoVaporSurfIn( Surf ) = 0.0;
 
 		// Determine largest change in node temps
-		MaxDelTemp = 0.0;
+		Real64 MaxDelTemp( 0.0 );
 		for ( int NodeNum = 1; NodeNum <= TotNodes + 1; ++NodeNum ) { // need to consider all nodes
 			MaxDelTemp = max( std::abs( TDT( NodeNum ) - TDreport( NodeNum ) ), MaxDelTemp );
 		}
@@ -1210,6 +1249,58 @@ namespace HeatBalFiniteDiffManager {
 
 	}
 
+	bool
+	SolveNodeEquations(
+		FArray1< Real64 > const & CoefM, // Coefficient of the node before in each node equation
+		FArray1< Real64 > const & CoefP, // Coefficient of the node after in each node equation
+		FArray1< Real64 > & CoefC, // Constant of each node equation (overwritten)
+		FArray1< Real64 > & Work, // Work array of the same size
+		FArray1< Real64 > & TDT // Node temperatures (result)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the node equations TDT(i) = CoefM(i)*TDT(i-1) + CoefP(i)*TDT(i+1) + CoefC(i) of a surface
+		// together.  Returns false, leaving TDT unchanged, if the system is singular.
+
+		// METHODOLOGY EMPLOYED:
+		// Thomas algorithm for the tridiagonal system with unit diagonal.  CoefM of the first node and
+		// CoefP of the last node are not used.  The node equations are diagonally dominant, so no
+		// pivoting is needed.
+
+		// REFERENCES:
+		// na
+
+		int const First( TDT.l() );
+		int const Last( TDT.u() );
+		assert( equal_dimensions( CoefM, TDT ) && equal_dimensions( CoefP, TDT ) && equal_dimensions( CoefC, TDT ) && equal_dimensions( Work, TDT ) );
+
+		// Forward elimination: TDT(i) = Work(i)*TDT(i+1) + CoefC(i)
+		Real64 Pivot( 1.0 );
+		Work( First ) = CoefP( First );
+		for ( int i = First + 1; i <= Last; ++i ) {
+			Pivot = 1.0 - CoefM( i ) * Work( i - 1 );
+			if ( std::abs( Pivot ) < smalldiff ) return false;
+			Real64 const InvPivot( 1.0 / Pivot );
+			Work( i ) = CoefP( i ) * InvPivot;
+			CoefC( i ) = ( CoefC( i ) + CoefM( i ) * CoefC( i - 1 ) ) * InvPivot;
+		}
+
+		// Back substitution
+		TDT( Last ) = CoefC( Last );
+		for ( int i = Last - 1; i >= First; --i ) {
+			TDT( i ) = Work( i ) * TDT( i + 1 ) + CoefC( i );
+		}
+
+		return true;
+	}
+
 	void
 	ReportFiniteDiffInits()
 	{
@@ -1266,8 +1357,8 @@ namespace HeatBalFiniteDiffManager {
 		static gio::Fmt Format_701( "(' Material CondFD Summary,',A,',',A,',',A,',',A,',',A,',',A)" );
 		static gio::Fmt Format_702( "(' ConductionFiniteDifference Node,',A,',',A,',',A,',',A,',',A)" );
 
-		gio::write( OutputFileInits, fmtA ) << "! <ConductionFiniteDifference HeatBalanceSettings>,Scheme Type,Space Discretization Constant,Relaxation Factor,Inside Face Surface Temperature Convergence Criteria";
-		gio::write( OutputFileInits, fmtA ) << " ConductionFiniteDifference HeatBalanceSettings," + cCondFDSchemeType( CondFDSchemeType ) + ',' + RoundSigDigits( SpaceDescritConstant, 2 ) + ',' + RoundSigDigits( CondFDRelaxFactorInput, 2 ) + ',' + RoundSigDigits( MaxAllowedDelTempCondFD, 4 );
+		gio::write( OutputFileInits, fmtA ) << "! <ConductionFiniteDifference HeatBalanceSettings>,Scheme Type,Space Discretization Constant,Relaxation Factor,Inside Face Surface Temperature Convergence Criteria,Inner Loop Solver";
+		gio::write( OutputFileInits, fmtA ) << " ConductionFiniteDifference HeatBalanceSettings," + cCondFDSchemeType( CondFDSchemeType ) + ',' + RoundSigDigits( SpaceDescritConstant, 2 ) + ',' + RoundSigDigits( CondFDRelaxFactorInput, 2 ) + ',' + RoundSigDigits( MaxAllowedDelTempCondFD, 4 ) + ',' + cCondFDInnerSolver( CondFDInnerSolver );
 		ScanForReports( "Constructions", DoReport, "Constructions" );
 
 		if ( DoReport ) {
@@ -1395,6 +1486,55 @@ namespace HeatBalFiniteDiffManager {
 	// Equation Types of the Module
 	//******************************************************************************
 
+	inline
+	void
+	SetNodeEquation(
+		int const Surf, // Surface number
+		int const i, // Node Index
+		Real64 const Am, // Coefficient of TDT(i-1) in the node equation
+		Real64 const Ap, // Coefficient of TDT(i+1) in the node equation
+		Real64 const TDT_eq, // Node temperature given by the node equation
+		Real64 const TDT_i // Node temperature after limit clipping
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Records the node equation of the current sweep for the tridiagonal inner loop solver.
+
+		// METHODOLOGY EMPLOYED:
+		// With the properties of the sweep each node equation is linear in the neighbouring node
+		// temperatures, so its constant is the node temperature less the neighbour terms.  Nodes
+		// clipped to the temperature limits or set from boundary conditions are held at their value.
+		// Must be called before TDT(i) is updated.
+
+		// REFERENCES:
+		// na
+
+		if ( CondFDInnerSolver != TridiagonalInnerSolver ) return;
+
+		auto & surfaceFD( SurfaceFD( Surf ) );
+		auto const & TDT( surfaceFD.TDT );
+		if ( TDT_i != TDT_eq ) { // Clipped
+			surfaceFD.CoefM( i ) = 0.0;
+			surfaceFD.CoefP( i ) = 0.0;
+			surfaceFD.CoefC( i ) = TDT_i;
+		} else {
+			surfaceFD.CoefM( i ) = Am;
+			surfaceFD.CoefP( i ) = Ap;
+			Real64 C( TDT_i );
+			if ( Am != 0.0 ) C -= Am * TDT( i - 1 );
+			if ( Ap != 0.0 ) C -= Ap * TDT( i + 1 );
+			surfaceFD.CoefC( i ) = C;
+		}
+
+	}
+
 	void
 	ExteriorBCEqns(
 		int const Delt, // Time Increment
@@ -1475,6 +1615,7 @@ namespace HeatBalFiniteDiffManager {
 //		Real64 const SigmaCLoc( SigmaC( ConstrNum ) ); //Unused
 
 		if ( surface_ExtBoundCond == Ground || IsRain ) {
+			SetNodeEquation( Surf, i, 0.0, 0.0, TempOutsideAirFD( Surf ), TempOutsideAirFD( Surf ) );
 			TDT( i ) = TT( i ) = TempOutsideAirFD( Surf );
 			RhoT( i ) = RhoVaporAirOut( Surf );
 		} else if ( surface_ExtBoundCond > 0 ) {
@@ -1490,6 +1631,7 @@ namespace HeatBalFiniteDiffManager {
 
 				auto & surfaceFD( SurfaceFD( Surf ) );
 				InteriorBCEqns( Delt, NodeIn, LayIn, Surf, surfaceFD.T, surfaceFD.TT, surfaceFD.Rhov, surfaceFD.RhoT, surfaceFD.RH, surfaceFD.TD, surfaceFD.TDT, surfaceFD.EnthOld, surfaceFD.EnthNew, surfaceFD.TDreport );
+				SetNodeEquation( Surf, i, 0.0, 0.0, surfaceFD.TDT( TotNodesPlusOne ), surfaceFD.TDT( TotNodesPlusOne ) ); // Lagged to the next iteration
 				TDT( i ) = surfaceFD.TDT( TotNodesPlusOne );
 				TT( i ) = surfaceFD.TT( TotNodesPlusOne );
 				RhoT( i ) = surfaceFD.RhoT( TotNodesPlusOne );
@@ -1500,6 +1642,7 @@ namespace HeatBalFiniteDiffManager {
 				auto & surfaceFDEBC( SurfaceFD( surface_ExtBoundCond ) );
 				InteriorBCEqns( Delt, NodeIn, LayIn, surface_ExtBoundCond, surfaceFDEBC.T, surfaceFDEBC.TT, surfaceFDEBC.Rhov, surfaceFDEBC.RhoT, surfaceFDEBC.RH, surfaceFDEBC.TD, surfaceFDEBC.TDT, surfaceFDEBC.EnthOld, surfaceFDEBC.EnthNew, surfaceFDEBC.TDreport );
 
+				SetNodeEquation( Surf, i, 0.0, 0.0, surfaceFDEBC.TDT( TotNodesPlusOne ), surfaceFDEBC.TDT( TotNodesPlusOne ) ); // Lagged to the next iteration
 				TDT( i ) = surfaceFDEBC.TDT( TotNodesPlusOne );
 				TT( i ) = surfaceFDEBC.TT( TotNodesPlusOne );
 				RhoT( i ) = surfaceFDEBC.RhoT( TotNodesPlusOne );
@@ -1551,12 +1694,14 @@ namespace HeatBalFiniteDiffManager {
 				auto const & matFD( MaterialFD( MatLay ) );
 
 				// regular outside conditions
+				Real64 Ap( 0.0 ); // Coefficient of TDT(i+1) in the node equation
 
 				// Calculate the Dry Heat Conduction Equation
 
 				if ( mat.ROnly || mat.Group == 1 ) { // R Layer or Air Layer  **********
 					// Use algebraic equation for TDT based on R
 					Real64 const Rlayer( mat.Resistance );
+					Ap = 1.0 / ( 1.0 + ( hconvo + hgnd + hrad + hsky ) * Rlayer );
 					TDT_i = ( TDT_p + ( QRadSWOutFD + hgnd * Tgnd + ( hconvo + hrad ) * Toa + hsky * Tsky ) * Rlayer ) / ( 1.0 + ( hconvo + hgnd + hrad + hsky ) * Rlayer );
 
 				} else { // Regular or phase change material layer
@@ -1602,6 +1747,7 @@ namespace HeatBalFiniteDiffManager {
 							Real64 const Cp_DelX_RhoS_2Delt( Cp * DelX * RhoS / ( 2.0 * Delt ) );
 							Real64 const kt_2DelX( kt / ( 2.0 * DelX ) );
 							Real64 const hsum( 0.5 * ( hconvo + hgnd + hrad + hsky ) );
+							Ap = kt_2DelX / ( hsum + kt_2DelX + Cp_DelX_RhoS_2Delt );
 							TDT_i = ( QRadSWOutFD + Cp_DelX_RhoS_2Delt * TD_i + kt_2DelX * ( TDT_p - TD_i + TD( i + 1 ) ) + hgnd * Tgnd + ( hconvo + hrad ) * Toa + hsky * Tsky - hsum * TD_i ) / ( hsum + kt_2DelX + Cp_DelX_RhoS_2Delt );
 							//feb2012            TDT(I)= (1.0d0*QRadSWOutFD + (0.5d0*Cp*Delx*RhoS*TD(I))/DelT + (0.5d0*kt*(-1.0d0*TD(I) + TD(I+1)))/Delx  &
 							//feb2012                     + (0.5d0*kt*TDT(I+1))/Delx + 0.5d0*hgnd*Tgnd + 0.5d0*hgnd*(-1.0d0*TD(I) + Tgnd) + 0.5d0*hconvo*Toa +   &
@@ -1613,6 +1759,7 @@ namespace HeatBalFiniteDiffManager {
 							Real64 const Two_Delt_DelX( 2.0 * Delt_DelX );
 							Real64 const Cp_DelX2_RhoS( Cp * pow_2( DelX ) * RhoS );
 							Real64 const Two_Delt_kt( 2.0 * Delt * kt );
+							Ap = Two_Delt_kt / ( Two_Delt_DelX * ( hconvo + hgnd + hrad + hsky ) + Two_Delt_kt + Cp_DelX2_RhoS );
 							TDT_i = ( Two_Delt_DelX * ( QRadSWOutFD + hgnd * Tgnd + ( hconvo + hrad ) * Toa + hsky * Tsky ) + Cp_DelX2_RhoS * TD_i + Two_Delt_kt * TDT_p ) / ( Two_Delt_DelX * ( hconvo + hgnd + hrad + hsky ) + Two_Delt_kt + Cp_DelX2_RhoS );
 						}
 
@@ -1632,6 +1779,7 @@ namespace HeatBalFiniteDiffManager {
 						//-     (2*Delt*Delx*HmovInsul + 2*Delt*kt + Cp*Delx**2*Rhos))))
 
 						// Wall first node temperature behind Movable insulation
+						Ap = Two_Delt_kt / ( Two_Delt_DelX * HMovInsul + Two_Delt_kt + Cp_DelX2_RhoS ); // TInsulOut lags
 						if ( CondFDSchemeType == CrankNicholsonSecondOrder ) {
 							TDT_i = ( Two_Delt_DelX * ( QRadSWOutFD + HMovInsul * TInsulOut ) + Cp_DelX2_RhoS * TD_i + Two_Delt_kt * TDT_p ) / ( Two_Delt_DelX * HMovInsul + Two_Delt_kt + Cp_DelX2_RhoS );
 						} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) {
@@ -1646,12 +1794,14 @@ namespace HeatBalFiniteDiffManager {
 				} // R layer or Regular layer
 
 				// Limit clipping
+				Real64 const TDT_eq( TDT_i );
 				if ( TDT_i < MinSurfaceTempLimit ) {
 					TDT_i = MinSurfaceTempLimit;
 				} else if ( TDT_i > MaxSurfaceTempLimit ) {
 					TDT_i = MaxSurfaceTempLimit;
 				}
 
+				SetNodeEquation( Surf, i, 0.0, Ap, TDT_eq, TDT_i );
 				TDT( i ) = TDT_i;
 
 			} // regular detailed FD part or SigmaR SigmaC part
@@ -1774,23 +1924,33 @@ namespace HeatBalFiniteDiffManager {
 		Real64 const RhoS( mat.Density );
 		Real64 const DelX( ConstructFD( ConstrNum ).DelX( Lay ) );
 		Real64 const Cp_DelX_RhoS_Delt( Cp * DelX * RhoS / Delt );
+		Real64 Am( 0.0 ); // Coefficient of TDT(i-1) in the node equation
+		Real64 Ap( 0.0 ); // Coefficient of TDT(i+1) in the node equation
 		if ( CondFDSchemeType == CrankNicholsonSecondOrder ) { // Adams-Moulton second order
 			Real64 const inv2DelX( 1.0 / ( 2.0 * DelX ) );
+			Real64 const Den( ( ( ktA1 + ktA2 ) * inv2DelX ) + Cp_DelX_RhoS_Delt );
+			Am = ktA2 * inv2DelX / Den;
+			Ap = ktA1 * inv2DelX / Den;
 			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA1 * ( TD( i + 1 ) - TD_i + TDT_p ) + ktA2 * ( TD( i - 1 ) - TD_i + TDT_m ) ) * inv2DelX ) ) / ( ( ( ktA1 + ktA2 ) * inv2DelX ) + Cp_DelX_RhoS_Delt );
 		} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) { // Adams-Moulton First order
 			Real64 const invDelX( 1.0 / DelX );
+			Real64 const Den( ( ( ktA1 + ktA2 ) * invDelX ) + Cp_DelX_RhoS_Delt );
+			Am = ktA2 * invDelX / Den;
+			Ap = ktA1 * invDelX / Den;
 			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA2 * TDT_m ) + ( ktA1 * TDT_p ) ) * invDelX ) / ( ( ( ktA1 + ktA2 ) * invDelX ) + Cp_DelX_RhoS_Delt );
 		} else {
 			assert( false ); // Illegal CondFDSchemeType
 		}
 
 		// Limit clipping
+		Real64 const TDT_eq( TDT_i );
 		if ( TDT_i < MinSurfaceTempLimit ) {
 			TDT_i = MinSurfaceTempLimit;
 		} else if ( TDT_i > MaxSurfaceTempLimit ) {
 			TDT_i = MaxSurfaceTempLimit;
 		}
 
+		SetNodeEquation( Surf, i, Am, Ap, TDT_eq, TDT_i );
 		TDT( i ) = TDT_i;
 	}
 
@@ -1869,7 +2029,9 @@ namespace HeatBalFiniteDiffManager {
 
 			if ( RLayerPresent && RLayer2Present ) {
 
-				TDT( i ) = ( Rlayer2 * TDT_m + Rlayer * TDT_p ) / ( Rlayer + Rlayer2 ); // Two adjacent R layers
+				Real64 const TDT_i( ( Rlayer2 * TDT_m + Rlayer * TDT_p ) / ( Rlayer + Rlayer2 ) ); // Two adjacent R layers
+				SetNodeEquation( Surf, i, Rlayer2 / ( Rlayer + Rlayer2 ), Rlayer / ( Rlayer + Rlayer2 ), TDT_i, TDT_i );
+				TDT( i ) = TDT_i;
 
 			} else {
 
@@ -1926,6 +2088,9 @@ namespace HeatBalFiniteDiffManager {
 				//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 				auto const TD_i( TD( i ) );
+				Real64 Am( 0.0 ); // Coefficient of TDT(i-1) in the node equation
+				Real64 Ap( 0.0 ); // Coefficient of TDT(i+1) in the node equation
+				Real64 TDT_eq; // Node temperature before limit clipping
 
 				auto const & matFD_TempEnth( matFD.TempEnth );
 				assert( matFD_TempEnth.u1() >= 3 );
@@ -1954,14 +2119,21 @@ namespace HeatBalFiniteDiffManager {
 					Real64 const Cp2_fac( Cp2 * pow_2( Delx2 ) * RhoS2 * Rlayer );
 					Real64 const Delt_kt2_Rlayer( Delt * kt2 * Rlayer );
 					if ( CondFDSchemeType == CrankNicholsonSecondOrder ) {
+						Real64 const Den( Delt_Delx2 + Delt_kt2_Rlayer + Cp2_fac );
+						Am = Delt_Delx2 / Den;
+						Ap = Delt_kt2_Rlayer / Den;
 						TDT_i = ( 2.0 * Delt_Delx2 * QSSFlux * Rlayer + ( Cp2_fac - Delt_Delx2 - Delt_kt2_Rlayer ) * TD_i + Delt_Delx2 * ( TD( i - 1 ) + TDT_m ) + Delt_kt2_Rlayer * ( TD( i + 1 ) + TDT_p ) ) / ( Delt_Delx2 + Delt_kt2_Rlayer + Cp2_fac );
 					} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) {
 						Real64 const Two_Delt_Delx2( 2.0 * Delt_Delx2 );
 						Real64 const Two_Delt_kt2_Rlayer( 2.0 * Delt_kt2_Rlayer );
+						Real64 const Den( Two_Delt_Delx2 + Two_Delt_kt2_Rlayer + Cp2_fac );
+						Am = Two_Delt_Delx2 / Den;
+						Ap = Two_Delt_kt2_Rlayer / Den;
 						TDT_i = ( Two_Delt_Delx2 * ( QSSFlux * Rlayer + TDT_m ) + Cp2_fac * TD_i + Two_Delt_kt2_Rlayer * TDT_p ) / ( Two_Delt_Delx2 + Two_Delt_kt2_Rlayer + Cp2_fac );
 					}
 
 					// Limit clipping
+					TDT_eq = TDT_i;
 					if ( TDT_i < MinSurfaceTempLimit ) {
 						TDT_i = MinSurfaceTempLimit;
 					} else if ( TDT_i > MaxSurfaceTempLimit ) {
@@ -1984,14 +2156,21 @@ namespace HeatBalFiniteDiffManager {
 					Real64 const Cp1_fac( Cp1 * pow_2( Delx1 ) * RhoS1 * Rlayer2 );
 					Real64 const Delt_kt1_Rlayer2( Delt * kt1 * Rlayer2 );
 					if ( CondFDSchemeType == CrankNicholsonSecondOrder ) {
+						Real64 const Den( Delt_Delx1 + Delt_kt1_Rlayer2 + Cp1_fac );
+						Am = Delt_kt1_Rlayer2 / Den;
+						Ap = Delt_Delx1 / Den;
 						TDT_i = ( 2.0 * Delt_Delx1 * QSSFlux * Rlayer2 + ( Cp1_fac - Delt_Delx1 - Delt_kt1_Rlayer2 ) * TD_i + Delt_Delx1 * ( TD( i + 1 ) + TDT_p ) + Delt_kt1_Rlayer2 * ( TD( i - 1 ) + TDT_m ) ) / ( Delt_Delx1 + Delt_kt1_Rlayer2 + Cp1_fac );
 					} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) {
 						Real64 const Two_Delt_Delx1( 2.0 * Delt_Delx1 );
 						Real64 const Two_Delt_kt1_Rlayer2( 2.0 * Delt_kt1_Rlayer2 );
+						Real64 const Den( Two_Delt_Delx1 + Two_Delt_kt1_Rlayer2 + Cp1_fac );
+						Am = Two_Delt_kt1_Rlayer2 / Den;
+						Ap = Two_Delt_Delx1 / Den;
 						TDT_i = ( Two_Delt_Delx1 * ( QSSFlux * Rlayer2 + TDT_p ) + Cp1_fac * TD_i + Two_Delt_kt1_Rlayer2 * TDT_m ) / ( Two_Delt_Delx1 + Two_Delt_kt1_Rlayer2 + Cp1_fac );
 					}
 
 					// Limit clipping
+					TDT_eq = TDT_i;
 					if ( TDT_i < MinSurfaceTempLimit ) {
 						TDT_i = MinSurfaceTempLimit;
 					} else if ( TDT_i > MaxSurfaceTempLimit ) {
@@ -2049,12 +2228,18 @@ namespace HeatBalFiniteDiffManager {
 					Real64 const Cp2_fac( Cp2 * Delx1 * pow_2( Delx2 ) * RhoS2 );
 					Real64 const Cp_fac( Cp1_fac + Cp2_fac );
 					if ( CondFDSchemeType == CrankNicholsonSecondOrder ) { // Regular Internal Interface Node with Source/sink using Adams Moulton second order
+						Am = Delt_Delx2_kt1 / ( Delt_sum + Cp_fac );
+						Ap = Delt_Delx1_kt2 / ( Delt_sum + Cp_fac );
 						TDT_i = ( 2.0 * Delt_Delx1 * Delx2 * QSSFlux + ( Cp_fac - Delt_sum ) * TD_i + Delt_Delx1_kt2 * ( TD( i + 1 ) + TDT_p ) + Delt_Delx2_kt1 * ( TD( i - 1 ) + TDT_m ) ) / ( Delt_sum + Cp_fac );
 					} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) { // First order adams moulton
+						Real64 const Den( 2.0 * ( Delt_Delx2_kt1 + Delt_Delx1_kt2 ) + Cp_fac );
+						Am = 2.0 * Delt_Delx2_kt1 / Den;
+						Ap = 2.0 * Delt_Delx1_kt2 / Den;
 						TDT_i = ( 2.0 * ( Delt_Delx1 * Delx2 * QSSFlux + Delt_Delx2_kt1 * TDT_m + Delt_Delx1_kt2 * TDT_p ) + Cp_fac * TD_i ) / ( 2.0 * ( Delt_Delx2_kt1 + Delt_Delx1_kt2 ) + Cp_fac );
 					}
 
 					// Limit clipping
+					TDT_eq = TDT_i;
 					if ( TDT_i < MinSurfaceTempLimit ) {
 						TDT_i = MinSurfaceTempLimit;
 					} else if ( TDT_i > MaxSurfaceTempLimit ) {
@@ -2068,6 +2253,7 @@ namespace HeatBalFiniteDiffManager {
 
 				} // End of R-layer and Regular check
 
+				SetNodeEquation( Surf, i, Am, Ap, TDT_eq, TDT_i );
 				TDT( i ) = TDT_i;
 
 			}
@@ -2159,6 +2345,8 @@ namespace HeatBalFiniteDiffManager {
 		//++++++++++++++++++++++++++++++++++++++++++++++++++++++
 		//    Do all the nodes in the surface   Else will switch to SigmaR,SigmaC
 		auto TDT_i( TDT( i ) );
+		Real64 Am( 0.0 ); // Coefficient of TDT(i-1) in the node equation
+		Real64 Ap( 0.0 ); // Coefficient of TDT(i+1) in the node equation
 		Real64 const QFac( NetLWRadToSurfFD + QHtRadSysSurfFD + QHWBaseboardSurfFD + QSteamBaseboardSurfFD + QElecBaseboardSurfFD + QRadSWInFD + QRadThermInFD );
 		if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
 			int const MatLay( Construct( ConstrNum ).LayerPoint( Lay ) );
@@ -2172,8 +2360,10 @@ namespace HeatBalFiniteDiffManager {
 				Real64 const IterDampConst( 5.0 ); // Damping constant for inside surface temperature iterations. Only used for massless (R-value only) Walls
 				Real64 const Rlayer( mat.Resistance );
 				if ( ( i == 1 ) && ( surface.ExtBoundCond > 0 ) ) { // this is for an adiabatic partition
+					Ap = 1.0 / ( 1.0 + ( hconvi + IterDampConst ) * Rlayer );
 					TDT_i = ( TDT( i + 1 ) + ( QFac + hconvi * Tia + TDreport( i ) * IterDampConst ) * Rlayer ) / ( 1.0 + ( hconvi + IterDampConst ) * Rlayer );
 				} else { // regular wall
+					Am = 1.0 / ( 1.0 + ( hconvi + IterDampConst ) * Rlayer );
 					TDT_i = ( TDT( i - 1 ) + ( QFac + hconvi * Tia + TDreport( i ) * IterDampConst ) * Rlayer ) / ( 1.0 + ( hconvi + IterDampConst ) * Rlayer );
 				}
 
@@ -2216,16 +2406,20 @@ namespace HeatBalFiniteDiffManager {
 				Real64 const Cp_DelX2_RhoS( Cp * pow_2( DelX ) * RhoS );
 				if ( ( surface.ExtBoundCond > 0 ) && ( i == 1 ) ) { // this is for an adiabatic or interzone partition
 					if ( CondFDSchemeType == CrankNicholsonSecondOrder ) { // Adams-Moulton second order
+						Ap = Delt_kt / ( Delt_DelX * hconvi + Delt_kt + Cp_DelX2_RhoS );
 						TDT_i = ( Two_Delt_DelX * ( QFac + hconvi * Tia ) + ( Cp_DelX2_RhoS - Delt_DelX * hconvi - Delt_kt ) * TD_i + Delt_kt * ( TD( i + 1 ) + TDT( i + 1 ) ) ) / ( Delt_DelX * hconvi + Delt_kt + Cp_DelX2_RhoS );
 					} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) { // Adams-Moulton First order
 						Real64 const Two_Delt_kt( 2.0 * Delt_kt );
+						Ap = Two_Delt_kt / ( Two_Delt_DelX * hconvi + Two_Delt_kt + Cp_DelX2_RhoS );
 						TDT_i = ( Two_Delt_DelX * ( QFac + hconvi * Tia ) + Cp_DelX2_RhoS * TD_i + Two_Delt_kt * TDT( i + 1 ) ) / ( Two_Delt_DelX * hconvi + Two_Delt_kt + Cp_DelX2_RhoS );
 					}
 				} else { // for regular or interzone walls
 					if ( CondFDSchemeType == CrankNicholsonSecondOrder ) {
+						Am = Delt_kt / ( Delt_DelX * hconvi + Delt_kt + Cp_DelX2_RhoS );
 						TDT_i = ( Two_Delt_DelX * ( QFac + hconvi * Tia ) + ( Cp_DelX2_RhoS - Delt_DelX * hconvi - Delt_kt ) * TD_i + Delt_kt * ( TD( i - 1 ) + TDT_m ) ) / ( Delt_DelX * hconvi + Delt_kt + Cp_DelX2_RhoS );
 					} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) {
 						Real64 const Two_Delt_kt( 2.0 * Delt_kt );
+						Am = Two_Delt_kt / ( Two_Delt_DelX * hconvi + Two_Delt_kt + Cp_DelX2_RhoS );
 						TDT_i = ( Two_Delt_DelX * ( QFac + hconvi * Tia ) + Cp_DelX2_RhoS * TD_i + Two_Delt_kt * TDT_m ) / ( Two_Delt_DelX * hconvi + Two_Delt_kt + Cp_DelX2_RhoS );
 					}
 				}
@@ -2235,12 +2429,14 @@ namespace HeatBalFiniteDiffManager {
 			} // Regular or R layer
 
 			// Limit clipping
+			Real64 const TDT_eq( TDT_i );
 			if ( TDT_i < MinSurfaceTempLimit ) {
 				TDT_i = MinSurfaceTempLimit;
 			} else if ( TDT_i > MaxSurfaceTempLimit ) {
 				TDT_i = MaxSurfaceTempLimit;
 			}
 
+			SetNodeEquation( Surf, i, Am, Ap, TDT_eq, TDT_i );
 			TDT( i ) = TDT_i;
 
 		} //  End of Regular node or SigmaR SigmaC option
@@ -24,6 +24,10 @@ namespace HeatBalFiniteDiffManager {
 	extern int const FullyImplicitFirstOrder; // fully implicit scheme, first order in time.
 	extern FArray1D_string const cCondFDSchemeType;
 
+	extern int const GaussSeidelInnerSolver; // original inner loop, node equations iterated one node at a time
+	extern int const TridiagonalInnerSolver; // node equations of each sweep solved together with the Thomas algorithm
+	extern FArray1D_string const cCondFDInnerSolver;
+
 	extern Real64 const TempInitValue; // Initialization value for Temperature
 	extern Real64 const RhovInitValue; // Initialization value for Rhov
 	extern Real64 const EnthInitValue; // Initialization value for Enthalpy
@@ -58,6 +62,7 @@ namespace HeatBalFiniteDiffManager {
 	//                                                                 ! before CR 8280 -- Qdryout         !HeatFlux on Surface for reporting for Sensible only
 
 	extern int CondFDSchemeType; // solution scheme for CondFD - default
+	extern int CondFDInnerSolver; // solver for the node equations of each inner loop iteration
 	extern Real64 SpaceDescritConstant; // spatial descritization constant,
 	extern Real64 MinTempLimit; // lower limit check, degree C
 	extern Real64 MaxTempLimit; // upper limit check, degree C
@@ -143,6 +148,10 @@ namespace HeatBalFiniteDiffManager {
 		FArray1D< Real64 > EnthOld; // Current node enthalpy
 		FArray1D< Real64 > EnthNew; // Node enthalpy at new time
 		FArray1D< Real64 > EnthLast;
+		FArray1D< Real64 > CoefM; // Node equations of the last sweep: TDT(i) = CoefM(i)*TDT(i-1) + CoefP(i)*TDT(i+1) + CoefC(i)
+		FArray1D< Real64 > CoefP;
+		FArray1D< Real64 > CoefC;
+		FArray1D< Real64 > CoefWork; // Work array for the tridiagonal solution
 		int GSloopCounter; // count of inner loop iterations
 		int GSloopErrorCount; // recurring error counter
 		Real64 MaxNodeDelTemp; // largest change in node temps after calc
@@ -172,6 +181,10 @@ namespace HeatBalFiniteDiffManager {
 			FArray1< Real64 > const & EnthOld, // Current node enthalpy
 			FArray1< Real64 > const & EnthNew, // Node enthalpy at new time
 			FArray1< Real64 > const & EnthLast,
+			FArray1< Real64 > const & CoefM,
+			FArray1< Real64 > const & CoefP,
+			FArray1< Real64 > const & CoefC,
+			FArray1< Real64 > const & CoefWork,
 			int const GSloopCounter, // count of inner loop iterations
 			int const GSloopErrorCount, // recurring error counter
 			Real64 const MaxNodeDelTemp // largest change in node temps after calc
@@ -192,6 +205,10 @@ namespace HeatBalFiniteDiffManager {
 			EnthOld( EnthOld ),
 			EnthNew( EnthNew ),
 			EnthLast( EnthLast ),
+			CoefM( CoefM ),
+			CoefP( CoefP ),
+			CoefC( CoefC ),
+			CoefWork( CoefWork ),
 			GSloopCounter( GSloopCounter ),
 			GSloopErrorCount( GSloopErrorCount ),
 			MaxNodeDelTemp( MaxNodeDelTemp )
@@ -280,6 +297,15 @@ namespace HeatBalFiniteDiffManager {
 		Real64 & TempSurfOutTmp // Outside Surface Temperature of each Heat Transfer Surface
 	);
 
+	bool
+	SolveNodeEquations(
+		FArray1< Real64 > const & CoefM, // Coefficient of the node before in each node equation
+		FArray1< Real64 > const & CoefP, // Coefficient of the node after in each node equation
+		FArray1< Real64 > & CoefC, // Constant of each node equation (overwritten)
+		FArray1< Real64 > & Work, // Work array of the same size
+		FArray1< Real64 > & TDT // Node temperatures (result)
+	);
+
 	// Beginning of Reporting subroutines
 	// *****************************************************************************
 
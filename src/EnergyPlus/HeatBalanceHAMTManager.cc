@@ -49,6 +49,9 @@ namespace HeatBalanceHAMTManager {
 	// with the option of including the latent heat, then liquid and vapor transfer. The process is ittereated.
 	// Once the temperatures have converged the internal surface
 	// temperature and vapor densities are passed back to EnergyPlus.
+	// With the BandMatrix solver the heat, liquid and vapor transfer are each solved for all the cells
+	// of the surface together, the iteration also waits for the relative humidities to converge, and
+	// the timestep is split into substeps when the moisture content changes too fast for one implicit step.
 
 	// Temperatures and relative humidities are updated once EnergyPlus has checked that
 	// the zone temperatures have converged.
@@ -97,6 +100,9 @@ namespace HeatBalanceHAMTManager {
 	Real64 const convt( 0.002 ); // Temperature convergence limit
 	Real64 const qvplim( 100000.0 ); // Maximum latent heat W
 	Real64 const rhmax( 1.01 ); // Maximum RH value
+	Real64 const rhconvt( 0.0001 ); // Relative humidity convergence limit
+	Real64 const rhsubtol( 0.002 ); // Largest relative humidity error estimate allowed in a substep
+	int const maxsubsteps( 16 ); // Maximum number of substeps in a timestep
 
 	static std::string const BlankString;
 
@@ -137,9 +143,48 @@ namespace HeatBalanceHAMTManager {
 
 	// Object Data
 	FArray1D< subcell > cells;
+	FArray1D< cellsystem > cellsys; // Cell equations of each surface
 
 	// Functions
 
+	// Saturation vapor pressure for the cells.  With the BandMatrix solver the HAMT surfaces of different
+	// zones are solved in parallel, and the cache of PsyPsatFnTemp is shared by all threads, so it is bypassed.
+	inline
+	Real64
+	CellPsat( Real64 const Temperature )
+	{
+#ifdef EP_cache_PsyPsatFnTemp
+		if ( HAMTBandSolver ) return PsyPsatFnTemp_raw( Temperature );
+#endif
+		return PsyPsatFnTemp( Temperature );
+	}
+
+	// Relative humidity of the air next to a surface, as PsyRhFnTdbRhov with its saturation pressure from CellPsat
+	inline
+	Real64
+	CellRH(
+		Real64 const Tdb, // dry-bulb temperature {C}
+		Real64 const Rhovapor, // vapor density in air {kg/m3}
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+	{
+		if ( ! HAMTBandSolver ) return PsyRhFnTdbRhov( Tdb, Rhovapor, CalledFrom );
+
+		Real64 const RHValue( Rhovapor > 0.0 ? Rhovapor * 461.52 * ( Tdb + KelvinConv ) / CellPsat( Tdb ) : 0.0 );
+		if ( ( RHValue < 0.0 ) || ( RHValue > 1.0 ) ) {
+#ifdef EP_psych_errors
+			if ( ( RHValue < -0.05 ) || ( RHValue > 1.01 ) ) {
+#ifdef _OPENMP
+#pragma omp critical( HAMTMessages )
+#endif
+				PsyRhFnTdbRhov_error( Tdb, Rhovapor, RHValue, CalledFrom );
+			}
+#endif
+			return min( max( RHValue, 0.01 ), 1.0 );
+		}
+		return RHValue;
+	}
+
 	void
 	ManageHeatBalHAMT(
 		int const SurfNum,
@@ -179,7 +224,38 @@ namespace HeatBalanceHAMTManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		SetupHeatBalHAMT();
+
+		CalcHeatBalHAMT( SurfNum, TempSurfInTmp, TempSurfOutTmp );
+
+	}
+
+	void
+	SetupHeatBalHAMT()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gets the input and sets up the cells the first time it is called.  The surface heat balance
+		// calls it before its surface loops, which solve the HAMT surfaces of different zones in parallel.
+
+		// METHODOLOGY EMPLOYED:
+		// na
 
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool OneTimeFlag( true );
 
 		if ( OneTimeFlag ) {
@@ -189,8 +265,6 @@ namespace HeatBalanceHAMTManager {
 			InitHeatBalHAMT();
 		}
 
-		CalcHeatBalHAMT( SurfNum, TempSurfInTmp, TempSurfOutTmp );
-
 	}
 
 	void
@@ -873,10 +947,11 @@ namespace HeatBalanceHAMTManager {
 
 		}
 
-		// Find adjacent cells.
+		// Find adjacent cells.  Only cells of the same surface can be adjacent, and they are numbered together.
 		for ( cid1 = 1; cid1 <= TotCellsMax; ++cid1 ) {
-			for ( cid2 = 1; cid2 <= TotCellsMax; ++cid2 ) {
-				if ( ( cid1 != cid2 ) && ( cells( cid1 ).sid == cells( cid2 ).sid ) ) {
+			if ( cells( cid1 ).sid < 1 ) continue;
+			for ( cid2 = firstcell( cells( cid1 ).sid ); cid2 <= lastcell( cells( cid1 ).sid ); ++cid2 ) {
+				if ( cid1 != cid2 ) {
 					high1 = cells( cid1 ).origin( 1 ) + cells( cid1 ).length( 1 ) / 2.0;
 					low2 = cells( cid2 ).origin( 1 ) - cells( cid2 ).length( 1 ) / 2.0;
 					if ( std::abs( low2 - high1 ) < adjdist ) {
@@ -906,6 +981,37 @@ namespace HeatBalanceHAMTManager {
 			}
 		}
 
+		// Band of the cell equations of each surface.  Only the cells from Extcell to Intcell are solved
+		// for; the links to the boundary cells around them go to the right hand side.
+		cellsys.allocate( TotSurfaces );
+		for ( sid = 1; sid <= TotSurfaces; ++sid ) {
+			if ( ! Surface( sid ).HeatTransSurf ) continue;
+			if ( Surface( sid ).Class == SurfaceClass_Window ) continue;
+			if ( Surface( sid ).HeatTransferAlgorithm != HeatTransferModel_HAMT ) continue;
+			auto & system( cellsys( sid ) );
+			system.ncells = lastcell( sid ) - firstcell( sid ) + 1;
+			system.hband = 0;
+			for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+				for ( ii = 1; ii <= adjmax; ++ii ) {
+					adj1 = cells( cid ).adjs( ii );
+					if ( adj1 == -1 ) break;
+					if ( adj1 >= Extcell( sid ) && adj1 <= Intcell( sid ) ) system.hband = max( system.hband, std::abs( adj1 - cid ) );
+				}
+			}
+			system.coef.allocate( 2 * system.hband + 1, system.ncells );
+			system.rhs.allocate( system.ncells );
+			system.tempold.allocate( system.ncells );
+			system.rhold.allocate( system.ncells );
+			system.rhstep.allocate( system.ncells );
+			system.lastrhstep.allocate( system.ncells );
+			system.coef = 0.0;
+			system.rhs = 0.0;
+			system.tempold = 0.0;
+			system.rhold = 0.0;
+			system.rhstep = 0.0;
+			system.lastrhstep = 0.0;
+		}
+
 		// Reset surface virtual cell origins and volumes. Initialise report variables.
 		gio::write( OutputFileInits, Format_1966 );
 		gio::write( OutputFileInits, Format_1965 );
@@ -980,20 +1086,25 @@ namespace HeatBalanceHAMTManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Phillip Biddulph
 		//       DATE WRITTEN   June 2008
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, adaptive substeps
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// To calculate the heat and moisture transfer through the surface
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The boundary cells are set from the surface heat balance.  The CellByCell solver then solves
+		// the timestep in one step (see CalcHAMTCellByCell).  The BandMatrix solver solves it in
+		// cellsys( sid ).nsub substeps (see CalcHAMTSubstep).  The local error of each implicit substep is
+		// estimated from the change in the relative humidity step of each material cell from the substep
+		// before (for the first substep, the last substep of the previous timestep).  While the largest
+		// estimate is above rhsubtol the number of substeps is doubled and the timestep solved again;
+		// UpdateHeatBalHAMT halves it again once the estimate is well below.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
-		using General::RoundSigDigits;
 		using DataSurfaces::OtherSideCondModeledExt;
 		using DataSurfaces::OSCM;
 
@@ -1014,39 +1125,9 @@ namespace HeatBalanceHAMTManager {
 		Real64 TempSurfInP;
 		Real64 RhoIn;
 		Real64 RhoOut;
-		Real64 torsum;
-		Real64 oorsum;
-		Real64 phioosum;
-		Real64 phiorsum;
-		Real64 vpoosum;
-		Real64 vporsum;
-		Real64 rhr1;
-		Real64 rhr2;
-		Real64 wcap;
-		Real64 thermr1;
-		Real64 thermr2;
-		Real64 tcap;
-		Real64 qvp;
-		Real64 vaporr1;
-		Real64 vaporr2;
-		Real64 vpdiff;
-		Real64 sumtp1;
-		Real64 tempmax;
-		Real64 tempmin;
 
-		int ii;
 		int matid;
-		int itter;
 		int cid;
-		//unused1208    INTEGER :: cid1
-		int adj;
-		int adjl;
-
-		//    INTEGER, SAVE :: tempErrCount=0
-		static int qvpErrCount( 0 );
-		//    INTEGER, SAVE :: tempErrReport=0
-		static int qvpErrReport( 0 );
-		Real64 denominator;
 
 		if ( BeginEnvrnFlag && MyEnvrnFlag( sid ) ) {
 			cells( Extcell( sid ) ).rh = 0.0;
@@ -1076,6 +1157,10 @@ namespace HeatBalanceHAMTManager {
 				cells( cid ).rhp1 = Material( matid ).irh;
 				cells( cid ).rhp2 = Material( matid ).irh;
 			}
+			if ( HAMTBandSolver ) {
+				cellsys( sid ).nsub = 1;
+				cellsys( sid ).lastsubdt = 0.0;
+			}
 			MyEnvrnFlag( sid ) = false;
 		}
 		if ( ! BeginEnvrnFlag ) {
@@ -1120,8 +1205,8 @@ namespace HeatBalanceHAMTManager {
 		// Check, Is this per unit area or for the whole wall.
 		//    cells(Intcell(sid))%Qadds=QRadSWInAbs(sid)+NetLWRadToSurf(sid)+QHtRadSysSurf(sid)+QRadThermInAbs(sid)
 
-		cells( ExtConcell( sid ) ).rh = PsyRhFnTdbRhov( cells( ExtConcell( sid ) ).temp, RhoOut, HAMTExt );
-		cells( IntConcell( sid ) ).rh = PsyRhFnTdbRhov( cells( IntConcell( sid ) ).temp, RhoIn, HAMTInt );
+		cells( ExtConcell( sid ) ).rh = CellRH( cells( ExtConcell( sid ) ).temp, RhoOut, HAMTExt );
+		cells( IntConcell( sid ) ).rh = CellRH( cells( IntConcell( sid ) ).temp, RhoIn, HAMTInt );
 
 		if ( cells( ExtConcell( sid ) ).rh > rhmax ) {
 			cells( ExtConcell( sid ) ).rh = rhmax;
@@ -1135,7 +1220,7 @@ namespace HeatBalanceHAMTManager {
 			cells( ExtConcell( sid ) ).vtc = extvtc( sid );
 		} else {
 			if ( cells( ExtConcell( sid ) ).rh > 0 ) {
-				cells( ExtConcell( sid ) ).vtc = HMassConvExtFD( sid ) * RhoOut / ( PsyPsatFnTemp( TempOutsideAirFD( sid ) ) * cells( ExtConcell( sid ) ).rh );
+				cells( ExtConcell( sid ) ).vtc = HMassConvExtFD( sid ) * RhoOut / ( CellPsat( TempOutsideAirFD( sid ) ) * cells( ExtConcell( sid ) ).rh );
 			} else {
 				cells( ExtConcell( sid ) ).vtc = 10000.0;
 			}
@@ -1143,10 +1228,10 @@ namespace HeatBalanceHAMTManager {
 
 		if ( intvtcflag( sid ) ) {
 			cells( IntConcell( sid ) ).vtc = intvtc( sid );
-			HMassConvInFD( sid ) = cells( IntConcell( sid ) ).vtc * PsyPsatFnTemp( MAT( Surface( sid ).Zone ) ) * cells( IntConcell( sid ) ).rh / RhoIn;
+			HMassConvInFD( sid ) = cells( IntConcell( sid ) ).vtc * CellPsat( MAT( Surface( sid ).Zone ) ) * cells( IntConcell( sid ) ).rh / RhoIn;
 		} else {
 			if ( cells( IntConcell( sid ) ).rh > 0 ) {
-				cells( IntConcell( sid ) ).vtc = HMassConvInFD( sid ) * RhoIn / ( PsyPsatFnTemp( MAT( Surface( sid ).Zone ) ) * cells( IntConcell( sid ) ).rh );
+				cells( IntConcell( sid ) ).vtc = HMassConvInFD( sid ) * RhoIn / ( CellPsat( MAT( Surface( sid ).Zone ) ) * cells( IntConcell( sid ) ).rh );
 			} else {
 				cells( IntConcell( sid ) ).vtc = 10000.0;
 			}
@@ -1159,14 +1244,139 @@ namespace HeatBalanceHAMTManager {
 			cells( cid ).tempp2 = cells( cid ).temp;
 			cells( cid ).rhp1 = cells( cid ).rh;
 			cells( cid ).rhp2 = cells( cid ).rh;
+			cells( cid ).vpp1 = RHtoVP( cells( cid ).rh, cells( cid ).temp );
 		}
 		for ( cid = Intcell( sid ) + 1; cid <= lastcell( sid ); ++cid ) {
 			cells( cid ).tempp1 = cells( cid ).temp;
 			cells( cid ).tempp2 = cells( cid ).temp;
 			cells( cid ).rhp1 = cells( cid ).rh;
 			cells( cid ).rhp2 = cells( cid ).rh;
+			cells( cid ).vpp1 = RHtoVP( cells( cid ).rh, cells( cid ).temp );
 		}
 
+		if ( HAMTBandSolver ) {
+			auto & system( cellsys( sid ) );
+			int const offset( firstcell( sid ) - 1 ); // Cell number less its equation number
+			while ( true ) {
+				Real64 const dt( deltat / system.nsub );
+				for ( cid = firstcell( sid ); cid <= lastcell( sid ); ++cid ) {
+					system.tempold( cid - offset ) = cells( cid ).temp;
+					system.rhold( cid - offset ) = cells( cid ).rh;
+				}
+				system.suberr = 0.0;
+				for ( int sub = 1; sub <= system.nsub; ++sub ) {
+					if ( system.nsub > 1 ) { // Start from the beginning of the substep rather than the end of the timestep
+						for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+							cells( cid ).tempp1 = system.tempold( cid - offset );
+							cells( cid ).rhp1 = system.rhold( cid - offset );
+						}
+					}
+
+					CalcHAMTSubstep( sid, dt );
+
+					for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+						int const i( cid - offset );
+						Real64 const rhstep( cells( cid ).rhp1 - system.rhold( i ) );
+						if ( cells( cid ).matid > 0 ) {
+							if ( sub > 1 ) {
+								system.suberr = max( system.suberr, 0.5 * std::abs( rhstep - system.rhstep( i ) ) );
+							} else if ( system.lastsubdt > 0.0 ) {
+								system.suberr = max( system.suberr, 0.5 * std::abs( rhstep - system.lastrhstep( i ) * dt / system.lastsubdt ) );
+							}
+						}
+						system.rhstep( i ) = rhstep;
+						system.tempold( i ) = cells( cid ).tempp1;
+						system.rhold( i ) = cells( cid ).rhp1;
+					}
+				}
+				system.subdt = dt;
+				if ( system.suberr <= rhsubtol || system.nsub >= maxsubsteps ) break;
+				system.nsub *= 2;
+			}
+		} else {
+			CalcHAMTCellByCell( sid );
+		}
+
+		// report back to CalcHeatBalanceInsideSurf
+		TempSurfOutTmp = cells( Extcell( sid ) ).tempp1;
+		TempSurfInTmp = cells( Intcell( sid ) ).tempp1;
+
+		TempSurfInP = cells( Intcell( sid ) ).rhp1 * CellPsat( cells( Intcell( sid ) ).tempp1 );
+
+		RhoVaporSurfIn( sid ) = TempSurfInP / ( 461.52 * ( MAT( Surface( sid ).Zone ) + KelvinConv ) );
+
+	}
+
+	void
+	CalcHAMTCellByCell( int const sid )
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Phillip Biddulph
+		//       DATE WRITTEN   June 2008
+		//       MODIFIED       October 2026, split from CalcHeatBalHAMT
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// To calculate the heat and moisture transfer through the surface over the timestep with the
+		// CellByCell solver.
+
+		// METHODOLOGY EMPLOYED:
+		// Each iteration sweeps the cells once, first for the temperatures and then for the relative
+		// humidities, each cell from the latest values of its neighbours.  The iterations stop once the
+		// temperatures change by less than convt.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 torsum;
+		Real64 oorsum;
+		Real64 phioosum;
+		Real64 phiorsum;
+		Real64 vpoosum;
+		Real64 vporsum;
+		Real64 rhr1;
+		Real64 rhr2;
+		Real64 wcap;
+		Real64 thermr1;
+		Real64 thermr2;
+		Real64 tcap;
+		Real64 qvp;
+		Real64 vaporr1;
+		Real64 vaporr2;
+		Real64 vpdiff;
+		Real64 sumtp1;
+		Real64 tempmax;
+		Real64 tempmin;
+
+		int ii;
+		int matid;
+		int itter;
+		int cid;
+		int adj;
+		int adjl;
+
+		//    INTEGER, SAVE :: tempErrCount=0
+		static int qvpErrCount( 0 );
+		//    INTEGER, SAVE :: tempErrReport=0
+		static int qvpErrReport( 0 );
+		Real64 denominator;
+
 		itter = 0;
 		while ( true ) {
 			++itter;
@@ -1393,14 +1603,433 @@ namespace HeatBalanceHAMTManager {
 			}
 		}
 
-		// report back to CalcHeatBalanceInsideSurf
-		TempSurfOutTmp = cells( Extcell( sid ) ).tempp1;
-		TempSurfInTmp = cells( Intcell( sid ) ).tempp1;
+	}
 
-		TempSurfInP = cells( Intcell( sid ) ).rhp1 * PsyPsatFnTemp( cells( Intcell( sid ) ).tempp1 );
+	void
+	CalcHAMTSubstep(
+		int const sid,
+		Real64 const dt // Substep length (s)
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Phillip Biddulph
+		//       DATE WRITTEN   June 2008
+		//       MODIFIED       October 2026, equations of all the cells solved together
+		//       RE-ENGINEERED  na
 
-		RhoVaporSurfIn( sid ) = TempSurfInP / ( 461.52 * ( MAT( Surface( sid ).Zone ) + KelvinConv ) );
+		// PURPOSE OF THIS SUBROUTINE:
+		// To calculate the heat and moisture transfer through the surface over one substep, starting
+		// from the cell temperatures and relative humidities in cellsys( sid ).
+
+		// METHODOLOGY EMPLOYED:
+		// Each iteration evaluates the material properties at the latest cell values, then solves the
+		// temperature equations of all the cells together (see SolveCellEquations) with the latent heat
+		// of the vapor flow at the start of the substep, and then, at the new temperatures, the relative
+		// humidity equations.  The iterations only have to follow the change of the properties with the
+		// moisture content and temperature, and stop once both the temperatures and the relative
+		// humidities have settled.
 
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 torsum;
+		Real64 oorsum;
+		Real64 phioosum;
+		Real64 phiorsum;
+		Real64 vpoosum;
+		Real64 vporsum;
+		Real64 rhr1;
+		Real64 rhr2;
+		Real64 wcap;
+		Real64 thermr1;
+		Real64 thermr2;
+		Real64 tcap;
+		Real64 qvp;
+		Real64 vaporr1;
+		Real64 vaporr2;
+		Real64 vpdiff;
+		Real64 sumtp1;
+		Real64 sumrhp1;
+		Real64 tempmax;
+		Real64 tempmin;
+
+		int ii;
+		int matid;
+		int itter;
+		int cid;
+		int adj;
+		int adjl;
+
+		//    INTEGER, SAVE :: tempErrCount=0
+		static int qvpErrCount( 0 );
+		//    INTEGER, SAVE :: tempErrReport=0
+		static int qvpErrReport( 0 );
+		Real64 denominator;
+
+		auto & system( cellsys( sid ) );
+		auto & coef( system.coef );
+		auto & rhs( system.rhs );
+		int const hband( system.hband );
+		int const diag( hband + 1 ); // Row of coef holding the diagonal
+		int const offset( firstcell( sid ) - 1 ); // Cell number less its equation number
+
+		// The boundary cells are fixed: their equations are left as identities and their links to the
+		// cells solved for are moved to the right hand side, so they stay outside the band
+		coef = 0.0;
+		for ( cid = firstcell( sid ); cid <= lastcell( sid ); ++cid ) {
+			if ( cid >= Extcell( sid ) && cid <= Intcell( sid ) ) continue;
+			coef( diag, cid - offset ) = 1.0;
+		}
+
+		for ( cid = firstcell( sid ); cid <= lastcell( sid ); ++cid ) {
+			cells( cid ).tempp2 = cells( cid ).tempp1;
+			cells( cid ).rhp2 = cells( cid ).rhp1;
+		}
+
+		itter = 0;
+		while ( true ) {
+			++itter;
+			// Update Moisture values
+
+			for ( cid = firstcell( sid ); cid <= lastcell( sid ); ++cid ) {
+				matid = cells( cid ).matid;
+				cells( cid ).vp = RHtoVP( system.rhold( cid - offset ), system.tempold( cid - offset ) );
+				if ( matid > 0 ) {
+					interp( Material( matid ).niso, Material( matid ).isorh, Material( matid ).isodata, cells( cid ).rhp1, cells( cid ).water, cells( cid ).dwdphi );
+					if ( IsRain && rainswitch ) {
+						interp( Material( matid ).nsuc, Material( matid ).sucwater, Material( matid ).sucdata, cells( cid ).water, cells( cid ).dw );
+					} else {
+						interp( Material( matid ).nred, Material( matid ).redwater, Material( matid ).reddata, cells( cid ).water, cells( cid ).dw );
+					}
+					interp( Material( matid ).nmu, Material( matid ).murh, Material( matid ).mudata, cells( cid ).rhp1, cells( cid ).mu );
+					interp( Material( matid ).ntc, Material( matid ).tcwater, Material( matid ).tcdata, cells( cid ).water, cells( cid ).wthermalc );
+				}
+			}
+
+			//Calculate Heat and Vapor resistances,
+			for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+				int const i( cid - offset );
+				torsum = 0.0;
+				oorsum = 0.0;
+				vpdiff = 0.0;
+				for ( int k = 1; k <= 2 * hband + 1; ++k ) {
+					coef( k, i ) = 0.0;
+				}
+				for ( ii = 1; ii <= adjmax; ++ii ) {
+					adj = cells( cid ).adjs( ii );
+					adjl = cells( cid ).adjsl( ii );
+					if ( adj == -1 ) break;
+
+					if ( cells( cid ).htc > 0 ) {
+						thermr1 = 1.0 / ( cells( cid ).overlap( ii ) * cells( cid ).htc );
+					} else if ( cells( cid ).matid > 0 ) {
+						thermr1 = cells( cid ).dist( ii ) / ( cells( cid ).overlap( ii ) * cells( cid ).wthermalc );
+					} else {
+						thermr1 = 0.0;
+					}
+
+					if ( cells( cid ).vtc > 0 ) {
+						vaporr1 = 1.0 / ( cells( cid ).overlap( ii ) * cells( cid ).vtc );
+					} else if ( cells( cid ).matid > 0 ) {
+						vaporr1 = ( cells( cid ).dist( ii ) * cells( cid ).mu ) / ( cells( cid ).overlap( ii ) * WVDC( cells( cid ).tempp1, OutBaroPress ) );
+					} else {
+						vaporr1 = 0.0;
+					}
+
+					if ( cells( adj ).htc > 0 ) {
+						thermr2 = 1.0 / ( cells( cid ).overlap( ii ) * cells( adj ).htc );
+					} else if ( cells( adj ).matid > 0 ) {
+						thermr2 = cells( adj ).dist( adjl ) / ( cells( cid ).overlap( ii ) * cells( adj ).wthermalc );
+					} else {
+						thermr2 = 0.0;
+					}
+
+					if ( cells( adj ).vtc > 0 ) {
+						vaporr2 = 1.0 / ( cells( cid ).overlap( ii ) * cells( adj ).vtc );
+					} else if ( cells( adj ).matid > 0 ) {
+						vaporr2 = cells( adj ).mu * cells( adj ).dist( adjl ) / ( WVDC( cells( adj ).tempp1, OutBaroPress ) * cells( cid ).overlap( ii ) );
+					} else {
+						vaporr2 = 0.0;
+					}
+
+					if ( thermr1 + thermr2 > 0 ) {
+						oorsum += 1.0 / ( thermr1 + thermr2 );
+						if ( adj >= Extcell( sid ) && adj <= Intcell( sid ) ) {
+							coef( diag + adj - cid, i ) -= 1.0 / ( thermr1 + thermr2 );
+						} else {
+							torsum += cells( adj ).tempp1 / ( thermr1 + thermr2 );
+						}
+					}
+					if ( vaporr1 + vaporr2 > 0 ) {
+						vpdiff += ( cells( adj ).vp - cells( cid ).vp ) / ( vaporr1 + vaporr2 );
+					}
+
+				}
+
+				// Calculate Heat Capacitance
+				tcap = ( ( cells( cid ).density * cells( cid ).spech + cells( cid ).water * wspech ) * cells( cid ).volume );
+
+				// calculate the latent heat if wanted and check for divergence
+				qvp = 0.0;
+				if ( ( cells( cid ).matid > 0 ) && ( latswitch ) ) {
+					qvp = vpdiff * whv;
+				}
+				if ( std::abs( qvp ) > qvplim ) {
+					if ( ! WarmupFlag ) {
+#ifdef _OPENMP
+#pragma omp critical( HAMTMessages )
+#endif
+						{
+							++qvpErrCount;
+							if ( qvpErrCount < 16 ) {
+								ShowWarningError( "HeatAndMoistureTransfer: Large Latent Heat for Surface " + Surface( sid ).Name );
+							} else {
+								ShowRecurringWarningErrorAtEnd( "HeatAndMoistureTransfer: Large Latent Heat Errors ", qvpErrReport );
+							}
+						}
+					}
+					qvp = 0.0;
+				}
+
+				// Temperature equation for the end of the substep
+				coef( diag, i ) = oorsum + ( tcap / dt );
+				rhs( i ) = torsum + qvp + cells( cid ).Qadds + ( tcap * system.tempold( i ) / dt );
+			}
+			for ( cid = firstcell( sid ); cid <= lastcell( sid ); ++cid ) {
+				if ( cid >= Extcell( sid ) && cid <= Intcell( sid ) ) continue;
+				rhs( cid - offset ) = cells( cid ).tempp1;
+			}
+			SolveCellEquations( system.ncells, hband, coef, rhs );
+			for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+				cells( cid ).tempp1 = rhs( cid - offset );
+			}
+
+			//Check for silly temperatures
+			tempmax = cells( firstcell( sid ) ).tempp1;
+			tempmin = cells( firstcell( sid ) ).tempp1;
+			for ( cid = firstcell( sid ) + 1; cid <= lastcell( sid ); ++cid ) {
+				tempmax = max( tempmax, cells( cid ).tempp1 );
+				tempmin = min( tempmin, cells( cid ).tempp1 );
+			}
+			if ( ( tempmax > MaxSurfaceTempLimit || tempmin < MinSurfaceTempLimit ) && ! WarmupFlag ) {
+#ifdef _OPENMP
+#pragma omp critical( HAMTMessages )
+#endif
+				{
+					if ( tempmax > MaxSurfaceTempLimit ) {
+						if ( Surface( sid ).HighTempErrCount == 0 ) {
+							ShowSevereMessage( "HAMT: Temperature (high) out of bounds (" + RoundSigDigits( tempmax, 2 ) + ") for surface=" + Surface( sid ).Name );
+							ShowContinueErrorTimeStamp( "" );
+						}
+						ShowRecurringWarningErrorAtEnd( "HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface( sid ).Name, Surface( sid ).HighTempErrCount, tempmax, tempmax, _, "C", "C" );
+					}
+					if ( tempmax > MaxSurfaceTempLimitBeforeFatal ) {
+						ShowSevereError( "HAMT: HAMT: Temperature (high) out of bounds ( " + RoundSigDigits( tempmax, 2 ) + ") for surface=" + Surface( sid ).Name );
+						ShowContinueErrorTimeStamp( "" );
+						ShowFatalError( "Program terminates due to preceding condition." );
+					}
+					if ( tempmin < MinSurfaceTempLimit ) {
+						if ( Surface( sid ).HighTempErrCount == 0 ) {
+							ShowSevereMessage( "HAMT: Temperature (low) out of bounds (" + RoundSigDigits( tempmin, 2 ) + ") for surface=" + Surface( sid ).Name );
+							ShowContinueErrorTimeStamp( "" );
+						}
+						ShowRecurringWarningErrorAtEnd( "HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface( sid ).Name, Surface( sid ).HighTempErrCount, tempmin, tempmin, _, "C", "C" );
+					}
+					if ( tempmin < MinSurfaceTempLimitBeforeFatal ) {
+						ShowSevereError( "HAMT: HAMT: Temperature (low) out of bounds ( " + RoundSigDigits( tempmin, 2 ) + ") for surface=" + Surface( sid ).Name );
+						ShowContinueErrorTimeStamp( "" );
+						ShowFatalError( "Program terminates due to preceding condition." );
+					}
+				}
+			}
+
+			// Calculate the liquid and vapor resisitances
+			for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+				cells( cid ).vpsat = CellPsat( cells( cid ).tempp1 );
+			}
+			for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+				int const i( cid - offset );
+				phioosum = 0.0;
+				phiorsum = 0.0;
+				vpoosum = 0.0;
+				vporsum = 0.0;
+				for ( int k = 1; k <= 2 * hband + 1; ++k ) {
+					coef( k, i ) = 0.0;
+				}
+
+				for ( ii = 1; ii <= adjmax; ++ii ) {
+					adj = cells( cid ).adjs( ii );
+					adjl = cells( cid ).adjsl( ii );
+					if ( adj == -1 ) break;
+					bool const adjsolved( adj >= Extcell( sid ) && adj <= Intcell( sid ) );
+
+					if ( cells( cid ).vtc > 0 ) {
+						vaporr1 = 1.0 / ( cells( cid ).overlap( ii ) * cells( cid ).vtc );
+					} else if ( cells( cid ).matid > 0 ) {
+						vaporr1 = ( cells( cid ).dist( ii ) * cells( cid ).mu ) / ( cells( cid ).overlap( ii ) * WVDC( cells( cid ).tempp1, OutBaroPress ) );
+					} else {
+						vaporr1 = 0.0;
+					}
+
+					if ( cells( adj ).vtc > 0 ) {
+						vaporr2 = 1.0 / ( cells( cid ).overlap( ii ) * cells( adj ).vtc );
+					} else if ( cells( adj ).matid > 0 ) {
+						vaporr2 = ( cells( adj ).dist( adjl ) * cells( adj ).mu ) / ( cells( cid ).overlap( ii ) * WVDC( cells( adj ).tempp1, OutBaroPress ) );
+					} else {
+						vaporr2 = 0.0;
+					}
+					if ( vaporr1 + vaporr2 > 0 ) {
+						vpoosum += 1.0 / ( vaporr1 + vaporr2 );
+						if ( adjsolved ) { // Vapor pressure of the other cell at the end of the substep
+							coef( diag + adj - cid, i ) -= cells( adj ).vpsat / ( vaporr1 + vaporr2 );
+						} else {
+							vporsum += ( cells( adj ).vpp1 / ( vaporr1 + vaporr2 ) );
+						}
+					}
+
+					if ( ( cells( cid ).dw > 0 ) && ( cells( cid ).dwdphi > 0 ) ) {
+						rhr1 = cells( cid ).dist( ii ) / ( cells( cid ).overlap( ii ) * cells( cid ).dw * cells( cid ).dwdphi );
+					} else {
+						rhr1 = 0.0;
+					}
+					if ( ( cells( adj ).dw > 0 ) && ( cells( adj ).dwdphi > 0 ) ) {
+						rhr2 = cells( adj ).dist( adjl ) / ( cells( cid ).overlap( ii ) * cells( adj ).dw * cells( adj ).dwdphi );
+					} else {
+						rhr2 = 0.0;
+					}
+
+					//             IF(rhr1+rhr2>0)THEN
+					if ( rhr1 * rhr2 > 0 ) {
+						phioosum += 1.0 / ( rhr1 + rhr2 );
+						if ( adjsolved ) {
+							coef( diag + adj - cid, i ) -= 1.0 / ( rhr1 + rhr2 );
+						} else {
+							phiorsum += ( cells( adj ).rhp1 / ( rhr1 + rhr2 ) );
+						}
+					}
+
+				}
+
+				// Moisture Capacitance
+				if ( cells( cid ).dwdphi > 0.0 ) {
+					wcap = cells( cid ).dwdphi * cells( cid ).volume;
+				} else {
+					wcap = 0.0;
+				}
+
+				// Relative humidity equation for the end of the substep
+				denominator = ( phioosum + vpoosum * cells( cid ).vpsat + wcap / dt );
+				if ( denominator == 0.0 ) {
+#ifdef _OPENMP
+#pragma omp critical( HAMTMessages )
+#endif
+					{
+						ShowSevereError( "CalcHeatBalHAMT: demoninator in calculating RH is zero.  Check material properties for accuracy." );
+						ShowContinueError( "...Problem occurs in Material=\"" + Material( cells( cid ).matid ).Name + "\"." );
+						ShowFatalError( "Program terminates due to preceding condition." );
+					}
+				}
+				coef( diag, i ) = denominator;
+				rhs( i ) = phiorsum + vporsum + ( wcap * system.rhold( i ) ) / dt;
+			}
+			for ( cid = firstcell( sid ); cid <= lastcell( sid ); ++cid ) {
+				if ( cid >= Extcell( sid ) && cid <= Intcell( sid ) ) continue;
+				rhs( cid - offset ) = cells( cid ).rhp1;
+			}
+			SolveCellEquations( system.ncells, hband, coef, rhs );
+			for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+				cells( cid ).rhp1 = min( rhs( cid - offset ), rhmax );
+			}
+
+			//Check for convergence or too many itterations
+			sumtp1 = 0.0;
+			sumrhp1 = 0.0;
+			for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+				sumtp1 = max( sumtp1, std::abs( cells( cid ).tempp2 - cells( cid ).tempp1 ) );
+				sumrhp1 = max( sumrhp1, std::abs( cells( cid ).rhp2 - cells( cid ).rhp1 ) );
+			}
+			if ( sumtp1 < convt && sumrhp1 < rhconvt ) {
+				break;
+			}
+			if ( itter > ittermax ) {
+				break;
+			}
+			for ( cid = firstcell( sid ); cid <= lastcell( sid ); ++cid ) {
+				cells( cid ).tempp2 = cells( cid ).tempp1;
+				cells( cid ).rhp2 = cells( cid ).rhp1;
+			}
+		}
+
+	}
+
+	void
+	SolveCellEquations(
+		int const n, // Number of equations
+		int const hband, // Half bandwidth
+		FArray2< Real64 > & coef, // Band of the equations (2*hband+1, n), LU factors on return
+		FArray1< Real64 > & rhs // Right hand side, solution on return
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the band matrix equations of the cells of a surface.  coef( hband + 1 + j - i, i ) is the
+		// coefficient of cell j in the equation of cell i.
+
+		// METHODOLOGY EMPLOYED:
+		// LU factorization without pivoting, which the diagonal dominance of the cell equations allows
+		// (by rows for the temperatures, by columns for the relative humidities).  Without pivoting the
+		// factors fill nothing outside the band, so the band width found from the cell adjacencies when
+		// the cells are set up is all the structure the factorization needs.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const diag( hband + 1 ); // Row of coef holding the diagonal
+
+		for ( int i = 1; i <= n; ++i ) {
+			int const last( min( n, i + hband ) );
+			for ( int r = i + 1; r <= last; ++r ) {
+				Real64 & lower( coef( diag + i - r, r ) );
+				if ( lower == 0.0 ) continue;
+				lower /= coef( diag, i );
+				for ( int c = i + 1; c <= last; ++c ) {
+					coef( diag + c - r, r ) -= lower * coef( diag + c - i, i );
+				}
+				rhs( r ) -= lower * rhs( i );
+			}
+		}
+		for ( int i = n; i >= 1; --i ) {
+			Real64 sum( rhs( i ) );
+			for ( int c = i + 1, last = min( n, i + hband ); c <= last; ++c ) {
+				sum -= coef( diag + c - i, i ) * rhs( c );
+			}
+			rhs( i ) = sum / coef( diag, i );
+		}
 	}
 
 	void
@@ -1469,6 +2098,14 @@ namespace HeatBalanceHAMTManager {
 		surfexttemp( sid ) = cells( Extcell( sid ) ).temp;
 		surfvp( sid ) = RHtoVP( cells( Intcell( sid ) ).rh, cells( Intcell( sid ) ).temp );
 
+		// Keep the substeps for the next timestep, halved if the error estimate was well within the limit
+		if ( HAMTBandSolver ) {
+			auto & system( cellsys( sid ) );
+			system.lastrhstep = system.rhstep;
+			system.lastsubdt = system.subdt;
+			if ( system.nsub > 1 && system.suberr < 0.2 * rhsubtol ) system.nsub /= 2;
+		}
+
 	}
 
 	void
@@ -1597,7 +2234,7 @@ namespace HeatBalanceHAMTManager {
 
 		Real64 VPSat;
 
-		VPSat = PsyPsatFnTemp( Temperature );
+		VPSat = CellPsat( Temperature );
 
 		RHtoVP = RH * VPSat;
 
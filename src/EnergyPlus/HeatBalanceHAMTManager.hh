@@ -3,6 +3,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
+#include <ObjexxFCL/FArray2D.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
@@ -23,6 +24,9 @@ namespace HeatBalanceHAMTManager {
 	extern Real64 const convt; // Temperature convergence limit
 	extern Real64 const qvplim; // Maximum latent heat W
 	extern Real64 const rhmax; // Maximum RH value
+	extern Real64 const rhconvt; // Relative humidity convergence limit
+	extern Real64 const rhsubtol; // Largest relative humidity error estimate allowed in a substep
+	extern int const maxsubsteps; // Maximum number of substeps in a timestep
 
 	// DERIVED TYPE DEFINITIONS:
 
@@ -196,8 +200,37 @@ namespace HeatBalanceHAMTManager {
 
 	};
 
+	struct cellsystem // Cell equations of one surface, solved together as a band matrix
+	{
+		// Members
+		int ncells; // Cells of the surface (firstcell to lastcell)
+		int hband; // Half bandwidth of the equations, found once from the cell adjacencies
+		int nsub; // Substeps of each timestep
+		Real64 suberr; // Largest relative humidity error estimate of the last solution
+		Real64 subdt; // Substep length of the last solution (s)
+		Real64 lastsubdt; // Substep length of the previous timestep (s), 0 if there is none
+		FArray2D< Real64 > coef; // Band of the equations (2*hband+1, ncells), LU factors after the solve
+		FArray1D< Real64 > rhs; // Right hand side of the equations, solution after the solve
+		FArray1D< Real64 > tempold; // Cell temperatures at the start of the substep
+		FArray1D< Real64 > rhold; // Cell relative humidities at the start of the substep
+		FArray1D< Real64 > rhstep; // Relative humidity change of each cell over the last substep
+		FArray1D< Real64 > lastrhstep; // Relative humidity change over the last substep of the previous timestep
+
+		// Default Constructor
+		cellsystem() :
+			ncells( 0 ),
+			hband( 0 ),
+			nsub( 1 ),
+			suberr( 0.0 ),
+			subdt( 0.0 ),
+			lastsubdt( 0.0 )
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< subcell > cells;
+	extern FArray1D< cellsystem > cellsys; // Cell equations of each surface
 
 	// Functions
 
@@ -208,6 +241,9 @@ namespace HeatBalanceHAMTManager {
 		Real64 & TempSurfOutTmp
 	);
 
+	void
+	SetupHeatBalHAMT();
+
 	void
 	GetHeatBalHAMTInput();
 
@@ -221,6 +257,23 @@ namespace HeatBalanceHAMTManager {
 		Real64 & TempSurfOutTmp
 	);
 
+	void
+	CalcHAMTCellByCell( int const sid );
+
+	void
+	CalcHAMTSubstep(
+		int const sid,
+		Real64 const dt // Substep length (s)
+	);
+
+	void
+	SolveCellEquations(
+		int const n, // Number of equations
+		int const hband, // Half bandwidth
+		FArray2< Real64 > & coef, // Band of the equations (2*hband+1, n), LU factors on return
+		FArray1< Real64 > & rhs // Right hand side, solution on return
+	);
+
 	void
 	UpdateHeatBalHAMT( int const sid );
 
@@ -1,6 +1,7 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -71,6 +72,9 @@ namespace HeatBalanceIntRadExchange {
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS
+	int const ScriptFBlockSize( 4 ); // Columns of the symmetric exchange coefficients stored together
+	int const MaxScriptFCacheSize( 16 ); // Emissivity sets per zone whose exchange coefficients are kept
+	Real64 const ScriptFReciprocityTolerance( 1.0e-9 ); // Relative difference of A(i)*ScriptF(i,j) and A(j)*ScriptF(j,i) taken as round-off
 	static gio::Fmt fmtLD( "*" );
 	static gio::Fmt fmtA( "(A)" );
 	static gio::Fmt fmtx( "(A,I4,1x,A,1x,6f16.8)" );
@@ -146,7 +150,6 @@ namespace HeatBalanceIntRadExchange {
 
 		int ConstrNumRec; // Receiving surface construction number
 		int ConstrNumSend; // Sending surface construction number
-		Real64 RecSurfTemp; // Receiving surface temperature (C)
 		Real64 SendSurfTemp; // Sending surface temperature (C)
 		Real64 RecSurfEmiss; // Inside surface emissivity
 		int SurfNum; // Surface number
@@ -157,9 +160,8 @@ namespace HeatBalanceIntRadExchange {
 		int ShadeFlagPrev; // Window shading status previous time step
 
 		//variables added as part of strategy to reduce calculation time - Glazer 2011-04-22
-//		Real64 SendSurfTempInKTo4th; // Sending surface temperature in K to 4th power
-		Real64 RecSurfTempInKTo4th; // Receiving surface temperature in K to 4th power
-		static FArray1D< Real64 > SendSurfaceTempInKto4thPrecalc;
+		static std::vector< Real64 > SurfaceTempInKTo4th; // Surface temperatures in K to 4th power, padded to whole blocks
+		static std::vector< Real64 > LWExchange; // Net exchange to each surface (W), padded to whole blocks
 
 		// FLOW:
 
@@ -168,11 +170,8 @@ namespace HeatBalanceIntRadExchange {
 #endif
 		if ( firstTime ) {
 			InitInteriorRadExchange();
-#ifdef EP_HBIRE_SEQ
-			SendSurfaceTempInKto4thPrecalc.allocate( MaxNumOfZoneSurfaces );
-#else
-			SendSurfaceTempInKto4thPrecalc.allocate( TotSurfaces );
-#endif
+			SurfaceTempInKTo4th.reserve( MaxNumOfZoneSurfaces + ScriptFBlockSize );
+			LWExchange.reserve( MaxNumOfZoneSurfaces + ScriptFBlockSize );
 			firstTime = false;
 			if ( DeveloperFlag ) {
 				std::string tdstring;
@@ -216,7 +215,6 @@ namespace HeatBalanceIntRadExchange {
 
 			auto const & zone( Zone( ZoneNum ) );
 			auto & zone_info( ZoneInfo( ZoneNum ) );
-			auto & zone_ScriptF( zone_info.ScriptF ); //Tuned Transposed
 			auto & zone_SurfacePtr( zone_info.SurfacePtr );
 			int const n_zone_Surfaces( zone_info.NumOfSurfaces );
 			size_type const s_zone_Surfaces( n_zone_Surfaces );
@@ -236,7 +234,7 @@ namespace HeatBalanceIntRadExchange {
 			// Determine if status of interior shade/blind on one or more windows in the zone has changed
 			// from previous time step.
 
-			if ( SurfIterations == 0 ) {
+			if ( SurfIterations == 0 || zone_info.CurrentScriptF < 0 ) {
 
 				IntShadeOrBlindStatusChanged = false;
 
@@ -251,7 +249,7 @@ namespace HeatBalanceIntRadExchange {
 					}
 				}
 
-				if ( IntShadeOrBlindStatusChanged || BeginEnvrnFlag ) { // Calc inside surface emissivities for this time step
+				if ( IntShadeOrBlindStatusChanged || BeginEnvrnFlag || zone_info.CurrentScriptF < 0 ) { // Calc inside surface emissivities for this time step
 					for ( int ZoneSurfNum = 1; ZoneSurfNum <= n_zone_Surfaces; ++ZoneSurfNum ) {
 						SurfNum = zone_SurfacePtr( ZoneSurfNum );
 						ConstrNum = Surface( SurfNum ).Construction;
@@ -262,14 +260,43 @@ namespace HeatBalanceIntRadExchange {
 						}
 					}
 
-					CalcScriptF( n_zone_Surfaces, zone_info.Area, zone_info.F, zone_info.Emissivity, zone_ScriptF );
-					// precalc - multiply by StefanBoltzmannConstant
-					zone_ScriptF *= StefanBoltzmannConst;
+					// Shades and blinds going back and forth give the same few emissivity sets, so the exchange
+					// coefficients of each set are kept rather than inverting the matrix again
+					auto & cache( zone_info.ScriptFCache );
+					std::vector< Real64 > Emissivity( n_zone_Surfaces );
+					for ( int ZoneSurfNum = 1; ZoneSurfNum <= n_zone_Surfaces; ++ZoneSurfNum ) {
+						Emissivity[ ZoneSurfNum - 1 ] = zone_info.Emissivity( ZoneSurfNum );
+					}
+					zone_info.CurrentScriptF = -1;
+					for ( int Entry = 0, Entry_end = cache.size(); Entry < Entry_end; ++Entry ) {
+						if ( cache[ Entry ].Emissivity == Emissivity ) {
+							zone_info.CurrentScriptF = Entry;
+							break;
+						}
+					}
+					if ( zone_info.CurrentScriptF < 0 ) {
+						if ( int( cache.size() ) < MaxScriptFCacheSize ) {
+							zone_info.CurrentScriptF = cache.size();
+							cache.push_back( ScriptFCoefficients() );
+						} else {
+							zone_info.CurrentScriptF = zone_info.NextScriptF;
+							zone_info.NextScriptF = ( zone_info.NextScriptF + 1 ) % MaxScriptFCacheSize;
+						}
+						auto & entry( cache[ zone_info.CurrentScriptF ] );
+						entry.Emissivity = Emissivity;
+						CalcScriptF( n_zone_Surfaces, zone_info.Area, zone_info.F, zone_info.Emissivity, zone_info.ScriptF );
+						// precalc - multiply by StefanBoltzmannConstant
+						entry.Reciprocal = FormSymmetricScriptF( n_zone_Surfaces, zone_info.Area, zone_info.ScriptF, StefanBoltzmannConst, entry.Sym, entry.RowSum );
+						if ( ! entry.Reciprocal ) FormFullScriptF( n_zone_Surfaces, zone_info.Area, zone_info.ScriptF, StefanBoltzmannConst, entry.Full );
+					}
 				}
 
 			} // End of check if SurfIterations = 0
 
+			auto const & zone_ScriptF( zone_info.ScriptFCache[ zone_info.CurrentScriptF ] );
+
 			// precalculate the fourth power of surface temperature as part of strategy to reduce calculation time - Glazer 2011-04-22
+			SurfaceTempInKTo4th.assign( ( n_zone_Surfaces + ScriptFBlockSize - 1 ) / ScriptFBlockSize * ScriptFBlockSize, 0.0 );
 			for ( size_type SendZoneSurfNum = 0; SendZoneSurfNum < s_zone_Surfaces; ++SendZoneSurfNum ) {
 				SendSurfNum = zone_SurfacePtr[ SendZoneSurfNum ];
 				auto const & surface_window( SurfaceWindow( SendSurfNum ) );
@@ -288,99 +315,43 @@ namespace HeatBalanceIntRadExchange {
 				} else {
 					SendSurfTemp = SurfaceTemp( SendSurfNum );
 				}
-#ifdef EP_HBIRE_SEQ
-				SendSurfaceTempInKto4thPrecalc[ SendZoneSurfNum ] = pow_4( SendSurfTemp + KelvinConv );
-#else
-				SendSurfaceTempInKto4thPrecalc( SendSurfNum ) = pow_4( SendSurfTemp + KelvinConv );
-#endif
+				SurfaceTempInKTo4th[ SendZoneSurfNum ] = pow_4( SendSurfTemp + KelvinConv );
+			}
+
+			// Net exchange as one pass over the symmetric coefficients: each pair of surfaces once.
+			// If the view factors leave ScriptF short of reciprocity the whole matrix is used instead.
+			if ( zone_ScriptF.Reciprocal ) {
+				CalcSymmetricLWExchange( n_zone_Surfaces, zone_ScriptF.Sym, SurfaceTempInKTo4th, LWExchange );
+			} else {
+				CalcFullLWExchange( n_zone_Surfaces, zone_ScriptF.Full, SurfaceTempInKTo4th, LWExchange );
 			}
 
-			// These are the money loops
-			size_type lSR( 0u );
+			// Net long-wave radiation for all surfaces and incident long-wave radiation for windows.
+			// The exchange of both paths is per zone surface, not per unit area: a surface without
+			// area exchanges nothing and is skipped.
 			for ( size_type RecZoneSurfNum = 0; RecZoneSurfNum < s_zone_Surfaces; ++RecZoneSurfNum ) {
+				if ( zone_info.Area[ RecZoneSurfNum ] <= 0.0 ) continue;
 				RecSurfNum = zone_SurfacePtr[ RecZoneSurfNum ];
 				ConstrNumRec = Surface( RecSurfNum ).Construction;
 				auto const & construct( Construct( ConstrNumRec ) );
+				Real64 const netLWRadToRecSurf_acc( LWExchange[ RecZoneSurfNum ] / zone_info.Area[ RecZoneSurfNum ] );
+				NetLWRadToSurf( RecSurfNum ) += netLWRadToRecSurf_acc;
+				if ( ! construct.TypeIsWindow ) continue;
+
 				auto & surface_window( SurfaceWindow( RecSurfNum ) );
-				auto & netLWRadToRecSurf( NetLWRadToSurf( RecSurfNum ) );
 				if ( construct.WindowTypeEQL ) {
 					RecSurfEmiss = EQLWindowInsideEffectiveEmiss( ConstrNumRec );
-					RecSurfTemp = surface_window.EffInsSurfTemp;
-				} else if ( construct.TypeIsWindow && surface_window.OriginalClass != SurfaceClass_TDD_Diffuser ) {
-					if ( SurfIterations == 0 && surface_window.ShadingFlag <= 0 ) {
-						// If the window is bare this TS and it is the first time through we use the previous TS glass
-						// temperature whether or not the window was shaded in the previous TS. If the window was shaded
-						// the previous time step this temperature is a better starting value than the shade temperature.
-						RecSurfTemp = surface_window.ThetaFace( 2 * construct.TotGlassLayers ) - KelvinConv;
-						RecSurfEmiss = construct.InsideAbsorpThermal;
-						// For windows with an interior shade or blind an effective inside surface temp
-						// and emiss is used here that is a weighted combination of shade/blind and glass temp and emiss.
-					} else if ( surface_window.ShadingFlag == IntShadeOn || surface_window.ShadingFlag == IntBlindOn ) {
-						RecSurfTemp = surface_window.EffInsSurfTemp;
-						RecSurfEmiss = InterpSlatAng( surface_window.SlatAngThisTS, surface_window.MovableSlats, surface_window.EffShBlindEmiss ) + InterpSlatAng( surface_window.SlatAngThisTS, surface_window.MovableSlats, surface_window.EffGlassEmiss );
-					} else {
-						RecSurfTemp = SurfaceTemp( RecSurfNum );
-						RecSurfEmiss = construct.InsideAbsorpThermal;
-					}
+				} else if ( surface_window.OriginalClass != SurfaceClass_TDD_Diffuser && ( surface_window.ShadingFlag == IntShadeOn || surface_window.ShadingFlag == IntBlindOn ) ) {
+					// For windows with an interior shade or blind an effective inside surface temp
+					// and emiss is used here that is a weighted combination of shade/blind and glass temp and emiss.
+					RecSurfEmiss = InterpSlatAng( surface_window.SlatAngThisTS, surface_window.MovableSlats, surface_window.EffShBlindEmiss ) + InterpSlatAng( surface_window.SlatAngThisTS, surface_window.MovableSlats, surface_window.EffGlassEmiss );
 				} else {
-					RecSurfTemp = SurfaceTemp( RecSurfNum );
 					RecSurfEmiss = construct.InsideAbsorpThermal;
 				}
-				// precalculate the fourth power of surface temperature as part of strategy to reduce calculation time - Glazer 2011-04-22
-				RecSurfTempInKTo4th = pow_4( RecSurfTemp + KelvinConv );
-				//      IF (ABS(RecSurfTempInKTo4th) > 1.d100) THEN
-				//        SendZoneSurfNum=0
-				//      ENDIF
-
-				// Calculate net long-wave radiation for opaque surfaces and incident
-				// long-wave radiation for windows.
-				if ( construct.TypeIsWindow ) { // Window
-					Real64 scriptF_acc( 0.0 ); // Local accumulator
-					Real64 netLWRadToRecSurf_cor( 0.0 ); // Correction
-					Real64 IRfromParentZone_acc( 0.0 ); // Local accumulator
-					for ( size_type SendZoneSurfNum = 0; SendZoneSurfNum < s_zone_Surfaces; ++SendZoneSurfNum, ++lSR ) {
-						Real64 const scriptF( zone_ScriptF[ lSR ] ); // [ lSR ] == ( SendZoneSurfNum+1, RecZoneSurfNum+1 )
-#ifdef EP_HBIRE_SEQ
-						Real64 const scriptF_temp_ink_4th( scriptF * SendSurfaceTempInKto4thPrecalc[ SendZoneSurfNum ] );
-#else
-						SendSurfNum = zone_SurfacePtr[ SendZoneSurfNum ] - 1;
-						Real64 const scriptF_temp_ink_4th( scriptF * SendSurfaceTempInKto4thPrecalc[ SendSurfNum ] );
-#endif
-						// Calculate interior LW incident on window rather than net LW for use in window layer heat balance calculation.
-						IRfromParentZone_acc += scriptF_temp_ink_4th;
 
-						if ( RecZoneSurfNum != SendZoneSurfNum ) {
-							scriptF_acc += scriptF;
-						} else {
-							netLWRadToRecSurf_cor = scriptF_temp_ink_4th;
-						}
-
-						// Per BG -- this should never happened.  (CR6346,CR6550 caused this to be put in.  Now removed. LKL 1/2013)
-						//          IF (SurfaceWindow(RecSurfNum)%IRfromParentZone < 0.0) THEN
-						//            CALL ShowRecurringWarningErrorAtEnd('CalcInteriorRadExchange: Window_IRFromParentZone negative, Window="'// &
-						//                TRIM(Surface(RecSurfNum)%Name)//'"',  &
-						//                SurfaceWindow(RecSurfNum)%IRErrCount)
-						//            CALL ShowRecurringContinueErrorAtEnd('..occurs in Zone="'//TRIM(Surface(RecSurfNum)%ZoneName)//  &
-						//                '", reset to 0.0 for remaining calculations.',SurfaceWindow(RecSurfNum)%IRErrCountC)
-						//            SurfaceWindow(RecSurfNum)%IRfromParentZone=0.0
-						//          ENDIF
-					}
-					netLWRadToRecSurf += IRfromParentZone_acc - netLWRadToRecSurf_cor - ( scriptF_acc * RecSurfTempInKTo4th );
-					surface_window.IRfromParentZone += IRfromParentZone_acc / RecSurfEmiss;
-				} else {
-					Real64 netLWRadToRecSurf_acc( 0.0 ); // Local accumulator
-					for ( size_type SendZoneSurfNum = 0; SendZoneSurfNum < s_zone_Surfaces; ++SendZoneSurfNum, ++lSR ) {
-						if ( RecZoneSurfNum != SendZoneSurfNum ) {
-#ifdef EP_HBIRE_SEQ
-							netLWRadToRecSurf_acc += zone_ScriptF[ lSR ] * ( SendSurfaceTempInKto4thPrecalc[ SendZoneSurfNum ] - RecSurfTempInKTo4th ); // [ lSR ] == ( SendZoneSurfNum+1, RecZoneSurfNum+1 )
-#else
-							SendSurfNum = zone_SurfacePtr[ SendZoneSurfNum ] - 1;
-							netLWRadToRecSurf_acc += zone_ScriptF[ lSR ] * ( SendSurfaceTempInKto4thPrecalc[ SendSurfNum ] - RecSurfTempInKTo4th ); // [ lSR ] == ( SendZoneSurfNum+1, RecZoneSurfNum+1 )
-#endif
-						}
-					}
-					netLWRadToRecSurf += netLWRadToRecSurf_acc;
-				}
+				// Calculate interior LW incident on window rather than net LW for use in window layer heat balance calculation:
+				// the sum of ScriptF * T^4 over all surfaces, the receiving one included
+				surface_window.IRfromParentZone += ( netLWRadToRecSurf_acc + zone_ScriptF.RowSum[ RecZoneSurfNum ] * SurfaceTempInKTo4th[ RecZoneSurfNum ] ) / RecSurfEmiss;
 			}
 		}
 
@@ -1431,6 +1402,186 @@ namespace HeatBalanceIntRadExchange {
 
 	}
 
+	bool
+	FormSymmetricScriptF(
+		int const N, // Number of surfaces
+		FArray1< Real64 > const & A, // Surface areas
+		FArray2< Real64 > const & ScriptF, // Script F factors (N X N) //Tuned Transposed
+		Real64 const Scale, // Factor applied to all coefficients
+		std::vector< Real64 > & ScriptFSym, // Scale * A(i) * ScriptF(i,j), upper triangle in blocks of columns
+		std::vector< Real64 > & ScriptFRowSum // Scale * sum over j of ScriptF(i,j)
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Forms the exchange coefficients A(i)*ScriptF(i,j) used by CalcSymmetricLWExchange.  By
+		// reciprocity A(i)*ScriptF(i,j) = A(j)*ScriptF(j,i), so only the upper triangle is kept.
+		// Returns false, with ScriptFSym empty, if a pair differs by more than
+		// ScriptFReciprocityTolerance; the full matrix (FormFullScriptF) must then be used.
+
+		// METHODOLOGY EMPLOYED:
+		// The two products are averaged, which removes the round-off of the matrix inverse.  Row i
+		// holds the columns from the block of ScriptFBlockSize columns containing column i+1 to N
+		// rounded up to whole blocks, with zeros left of column i+1 and past N, so the rows line up
+		// with the (zero padded) temperature vector in whole blocks.  The row sums are formed either way.
+
+		// Validate argument array dimensions
+		assert( ( A.l() == 1 ) && ( A.u() == N ) );
+		assert( ( ScriptF.l1() == 1 ) && ( ScriptF.u1() == N ) );
+		assert( ( ScriptF.l2() == 1 ) && ( ScriptF.u2() == N ) );
+
+		int const NPadded( ( N + ScriptFBlockSize - 1 ) / ScriptFBlockSize * ScriptFBlockSize );
+		ScriptFSym.clear();
+		ScriptFRowSum.assign( N, 0.0 );
+		for ( int i = 1; i <= N; ++i ) {
+			Real64 RowSum( 0.0 );
+			for ( int j = 1; j <= N; ++j ) {
+				RowSum += ScriptF( j, i ); // ( j, i ) == ScriptF(i,j) transposed
+			}
+			ScriptFRowSum[ i - 1 ] = Scale * RowSum;
+		}
+		for ( int i = 1; i <= N; ++i ) {
+			for ( int j = i / ScriptFBlockSize * ScriptFBlockSize + 1; j <= NPadded; ++j ) {
+				if ( j <= i || j > N ) {
+					ScriptFSym.push_back( 0.0 );
+				} else {
+					Real64 const AFij( A( i ) * ScriptF( j, i ) ); // ( j, i ) == ScriptF(i,j) transposed
+					Real64 const AFji( A( j ) * ScriptF( i, j ) );
+					if ( std::abs( AFij - AFji ) > ScriptFReciprocityTolerance * max( std::abs( AFij ), std::abs( AFji ) ) ) {
+						ScriptFSym.clear();
+						return false;
+					}
+					ScriptFSym.push_back( 0.5 * Scale * ( AFij + AFji ) );
+				}
+			}
+		}
+		return true;
+
+	}
+
+	void
+	FormFullScriptF(
+		int const N, // Number of surfaces
+		FArray1< Real64 > const & A, // Surface areas
+		FArray2< Real64 > const & ScriptF, // Script F factors (N X N) //Tuned Transposed
+		Real64 const Scale, // Factor applied to all coefficients
+		std::vector< Real64 > & ScriptFFull // Scale * A(i) * ScriptF(i,j), row by row
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Forms the exchange coefficients A(i)*ScriptF(i,j) used by CalcFullLWExchange, for zones
+		// whose ScriptF is not reciprocal (see FormSymmetricScriptF).
+
+		// Validate argument array dimensions
+		assert( ( A.l() == 1 ) && ( A.u() == N ) );
+		assert( ( ScriptF.l1() == 1 ) && ( ScriptF.u1() == N ) );
+		assert( ( ScriptF.l2() == 1 ) && ( ScriptF.u2() == N ) );
+
+		ScriptFFull.clear();
+		ScriptFFull.reserve( N * N );
+		for ( int i = 1; i <= N; ++i ) {
+			for ( int j = 1; j <= N; ++j ) {
+				ScriptFFull.push_back( Scale * A( i ) * ScriptF( j, i ) ); // ( j, i ) == ScriptF(i,j) transposed
+			}
+		}
+
+	}
+
+	void
+	CalcSymmetricLWExchange(
+		int const N, // Number of surfaces
+		std::vector< Real64 > const & ScriptFSym, // Symmetric exchange coefficients from FormSymmetricScriptF
+		std::vector< Real64 > const & TempKTo4th, // Fourth power of the surface temperatures (K), zero padded to whole blocks
+		std::vector< Real64 > & Exchange // Net exchange to each surface (coefficient units * K4), padded as TempKTo4th
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the net long-wave exchange to each surface of a zone, the sum over the other surfaces j
+		// of A(i)*ScriptF(i,j)*(T(j)^4 - T(i)^4).
+
+		// METHODOLOGY EMPLOYED:
+		// Each pair of surfaces is visited once: the exchange from j to i is added to i and taken from j.
+		// The rows of ScriptFSym run over whole blocks of columns, so the inner loop has no remainder
+		// and keeps one partial sum per column of the block, which lets the compiler use vector
+		// instructions while the order of the sums stays fixed.
+
+		int const NPadded( ( N + ScriptFBlockSize - 1 ) / ScriptFBlockSize * ScriptFBlockSize );
+		assert( int( TempKTo4th.size() ) == NPadded );
+		Exchange.assign( NPadded, 0.0 );
+		std::vector< Real64 >::size_type k( 0u );
+		for ( int i = 0; i < N; ++i ) {
+			Real64 const TempKTo4th_i( TempKTo4th[ i ] );
+			Real64 Sum[ ScriptFBlockSize ] = {}; // Partial sums of the exchange to surface i
+			for ( int j = ( i + 1 ) / ScriptFBlockSize * ScriptFBlockSize; j < NPadded; j += ScriptFBlockSize, k += ScriptFBlockSize ) {
+				for ( int l = 0; l < ScriptFBlockSize; ++l ) {
+					Real64 const Q( ScriptFSym[ k + l ] * ( TempKTo4th[ j + l ] - TempKTo4th_i ) );
+					Sum[ l ] += Q;
+					Exchange[ j + l ] -= Q;
+				}
+			}
+			for ( int l = 0; l < ScriptFBlockSize; ++l ) {
+				Exchange[ i ] += Sum[ l ];
+			}
+		}
+		assert( k == ScriptFSym.size() );
+
+	}
+
+	void
+	CalcFullLWExchange(
+		int const N, // Number of surfaces
+		std::vector< Real64 > const & ScriptFFull, // Exchange coefficients from FormFullScriptF
+		std::vector< Real64 > const & TempKTo4th, // Fourth power of the surface temperatures (K), zero padded to whole blocks
+		std::vector< Real64 > & Exchange // Net exchange to each surface (coefficient units * K4), padded as TempKTo4th
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the same net long-wave exchange as CalcSymmetricLWExchange from every receiving and
+		// sending pair, for zones whose ScriptF is not reciprocal.
+
+		int const NPadded( ( N + ScriptFBlockSize - 1 ) / ScriptFBlockSize * ScriptFBlockSize );
+		assert( int( TempKTo4th.size() ) == NPadded );
+		assert( int( ScriptFFull.size() ) == N * N );
+		Exchange.assign( NPadded, 0.0 );
+		std::vector< Real64 >::size_type k( 0u );
+		for ( int i = 0; i < N; ++i ) {
+			Real64 const TempKTo4th_i( TempKTo4th[ i ] );
+			Real64 Sum( 0.0 );
+			for ( int j = 0; j < N; ++j, ++k ) {
+				if ( j != i ) Sum += ScriptFFull[ k ] * ( TempKTo4th[ j ] - TempKTo4th_i );
+			}
+			Exchange[ i ] = Sum;
+		}
+
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -1,6 +1,9 @@
 #ifndef HeatBalanceIntRadExchange_hh_INCLUDED
 #define HeatBalanceIntRadExchange_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
 #include <ObjexxFCL/FArray1S.hh>
@@ -19,6 +22,9 @@ namespace HeatBalanceIntRadExchange {
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS
+	extern int const ScriptFBlockSize; // Columns of the symmetric exchange coefficients stored together
+	extern int const MaxScriptFCacheSize; // Emissivity sets per zone whose exchange coefficients are kept
+	extern Real64 const ScriptFReciprocityTolerance; // Relative difference of A(i)*ScriptF(i,j) and A(j)*ScriptF(j,i) taken as round-off
 
 	// DERIVED TYPE DEFINITIONS
 	// na
@@ -100,6 +106,41 @@ namespace HeatBalanceIntRadExchange {
 		FArray2< Real64 > & I // Returned as inverse matrix
 	);
 
+	bool
+	FormSymmetricScriptF(
+		int const N, // Number of surfaces
+		FArray1< Real64 > const & A, // Surface areas
+		FArray2< Real64 > const & ScriptF, // Script F factors (N X N) //Tuned Transposed
+		Real64 const Scale, // Factor applied to all coefficients
+		std::vector< Real64 > & ScriptFSym, // Scale * A(i) * ScriptF(i,j), upper triangle in blocks of columns
+		std::vector< Real64 > & ScriptFRowSum // Scale * sum over j of ScriptF(i,j)
+	);
+
+	void
+	FormFullScriptF(
+		int const N, // Number of surfaces
+		FArray1< Real64 > const & A, // Surface areas
+		FArray2< Real64 > const & ScriptF, // Script F factors (N X N) //Tuned Transposed
+		Real64 const Scale, // Factor applied to all coefficients
+		std::vector< Real64 > & ScriptFFull // Scale * A(i) * ScriptF(i,j), row by row
+	);
+
+	void
+	CalcSymmetricLWExchange(
+		int const N, // Number of surfaces
+		std::vector< Real64 > const & ScriptFSym, // Symmetric exchange coefficients from FormSymmetricScriptF
+		std::vector< Real64 > const & TempKTo4th, // Fourth power of the surface temperatures (K), zero padded to whole blocks
+		std::vector< Real64 > & Exchange // Net exchange to each surface (coefficient units * K4), padded as TempKTo4th
+	);
+
+	void
+	CalcFullLWExchange(
+		int const N, // Number of surfaces
+		std::vector< Real64 > const & ScriptFFull, // Exchange coefficients from FormFullScriptF
+		std::vector< Real64 > const & TempKTo4th, // Fourth power of the surface temperatures (K), zero padded to whole blocks
+		std::vector< Real64 > & Exchange // Net exchange to each surface (coefficient units * K4), padded as TempKTo4th
+	);
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
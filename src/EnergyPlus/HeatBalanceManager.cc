@@ -916,6 +916,33 @@ namespace HeatBalanceManager {
 				HighHConvLimit = BuildingNumbers( 3 );
 			}
 
+			InsideSurfIterExtrapolation = false;
+			if ( NumAlpha > 1 ) {
+				if ( SameString( AlphaName( 2 ), "AitkenExtrapolation" ) ) {
+					InsideSurfIterExtrapolation = true;
+				} else if ( ! SameString( AlphaName( 2 ), "Damped" ) && ! lAlphaFieldBlanks( 2 ) ) {
+					ShowWarningError( "GetSolutionAlgorithm: " + CurrentModuleObject + ": Invalid " + cAlphaFieldNames( 2 ) + " = " + AlphaName( 2 ) + ", Damped will be used." );
+				}
+			}
+
+			WindowNewtonSolver = false;
+			if ( NumAlpha > 2 ) {
+				if ( SameString( AlphaName( 3 ), "Newton" ) ) {
+					WindowNewtonSolver = true;
+				} else if ( ! SameString( AlphaName( 3 ), "FixedPoint" ) && ! lAlphaFieldBlanks( 3 ) ) {
+					ShowWarningError( "GetSolutionAlgorithm: " + CurrentModuleObject + ": Invalid " + cAlphaFieldNames( 3 ) + " = " + AlphaName( 3 ) + ", FixedPoint will be used." );
+				}
+			}
+
+			HAMTBandSolver = false;
+			if ( NumAlpha > 3 ) {
+				if ( SameString( AlphaName( 4 ), "BandMatrix" ) ) {
+					HAMTBandSolver = true;
+				} else if ( ! SameString( AlphaName( 4 ), "CellByCell" ) && ! lAlphaFieldBlanks( 4 ) ) {
+					ShowWarningError( "GetSolutionAlgorithm: " + CurrentModuleObject + ": Invalid " + cAlphaFieldNames( 4 ) + " = " + AlphaName( 4 ) + ", CellByCell will be used." );
+				}
+			}
+
 		} else {
 			OverallHeatTransferSolutionAlgo = UseCTF;
 			AlphaName( 1 ) = "ConductionTransferFunction";
@@ -926,6 +953,9 @@ namespace HeatBalanceManager {
 		HeatTransferAlgosUsed.allocate( 1 );
 		HeatTransferAlgosUsed( 1 ) = OverallHeatTransferSolutionAlgo;
 
+		gio::write( OutputFileInits, fmtA ) << "! <Heat Balance Algorithm Solvers>, Inside Surface Iteration Acceleration {Damped | AitkenExtrapolation}, Window Heat Balance Solver {FixedPoint | Newton}, HAMT Solver {CellByCell | BandMatrix}";
+		gio::write( OutputFileInits, fmtA ) << "Heat Balance Algorithm Solvers," + std::string( InsideSurfIterExtrapolation ? "AitkenExtrapolation" : "Damped" ) + ',' + std::string( WindowNewtonSolver ? "Newton" : "FixedPoint" ) + ',' + std::string( HAMTBandSolver ? "BandMatrix" : "CellByCell" );
+
 		// algorithm input checks now deferred until surface properties are read in,
 		//  moved to SurfaceGeometry.cc routine GetSurfaceHeatTransferAlgorithmOverrides
 
@@ -7475,6 +7505,41 @@ Label1000: ;
 				}
 			}
 
+			WindowThermalModel( Loop ).SolutionReuse = rmNoReuse;
+			if ( NumAlphas >= 5 && ! cAlphaArgs( 5 ).empty() ) {
+				auto const SELECT_CASE_var( cAlphaArgs( 5 ) );
+				if ( SELECT_CASE_var == "NOREUSE" ) {
+					WindowThermalModel( Loop ).SolutionReuse = rmNoReuse;
+				} else if ( SELECT_CASE_var == "WARMSTART" ) {
+					WindowThermalModel( Loop ).SolutionReuse = rmWarmStart;
+				} else if ( SELECT_CASE_var == "REUSEWITHINTOLERANCE" ) {
+					WindowThermalModel( Loop ).SolutionReuse = rmReuseWithinTolerance;
+				} else {
+					ErrorsFound = true;
+					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + ", object. Illegal value for " + cAlphaFieldNames( 5 ) + " has been found." );
+					ShowContinueError( cAlphaFieldNames( 5 ) + " entered value = \"" + cAlphaArgs( 5 ) + "\" should be NoReuse, WarmStart or ReuseWithinTolerance." );
+				}
+			}
+
+			// Tolerances for solution reuse in the order of the input fields, starting from their defaults
+			FArray1D< Real64 > ReuseTolerances( 4 );
+			ReuseTolerances = { 0.1, 1.0, 0.1, 0.1 };
+			for ( int Tol = 1; Tol <= 4; ++Tol ) {
+				int const NumField( Tol + 4 );
+				if ( NumNumbers < NumField || lNumericFieldBlanks( NumField ) ) continue;
+				if ( rNumericArgs( NumField ) <= 0.0 ) {
+					ErrorsFound = true;
+					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + ", object. Illegal value for " + cNumericFieldNames( NumField ) + " has been found." );
+					ShowContinueError( cNumericFieldNames( NumField ) + " must be > 0, entered value = " + RoundSigDigits( rNumericArgs( NumField ), 2 ) );
+				} else {
+					ReuseTolerances( Tol ) = rNumericArgs( NumField );
+				}
+			}
+			WindowThermalModel( Loop ).ReuseTemperatureTolerance = ReuseTolerances( 1 );
+			WindowThermalModel( Loop ).ReuseIrradianceTolerance = ReuseTolerances( 2 );
+			WindowThermalModel( Loop ).ReuseWindSpeedTolerance = ReuseTolerances( 3 );
+			WindowThermalModel( Loop ).ReuseFilmCoefficientTolerance = ReuseTolerances( 4 );
+
 		} //DO Loop = 1, TotThermalModels
 
 		//Reading Construction:ComplexFenestrationState
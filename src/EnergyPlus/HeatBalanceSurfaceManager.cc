@@ -1,6 +1,9 @@
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <iterator>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -133,7 +136,8 @@ namespace HeatBalanceSurfaceManager {
 	// na
 
 	// MODULE VARIABLE DECLARATIONS:
-	// na
+	std::vector< std::vector< int > > OutsideSurfGroups; // Surfaces of the outside heat balance, in groups done in parallel
+	std::vector< std::vector< int > > InsideSurfGroups; // Surfaces of the inside heat balance, in groups done in parallel
 
 	// Subroutine Specifications for the Heat Balance Module
 	// Driver Routines
@@ -154,6 +158,13 @@ namespace HeatBalanceSurfaceManager {
 
 	// Functions
 
+	void
+	clear_state()
+	{
+		OutsideSurfGroups.clear();
+		InsideSurfGroups.clear();
+	}
+
 	void
 	ManageSurfaceHeatBalance()
 	{
@@ -290,6 +301,7 @@ namespace HeatBalanceSurfaceManager {
 		using DataRoomAirModel::IsZoneUI;
 		using HeatBalanceIntRadExchange::CalcInteriorRadExchange;
 		using HeatBalFiniteDiffManager::InitHeatBalFiniteDiff;
+		using HeatBalanceHAMTManager::SetupHeatBalHAMT;
 		using DataSystemVariables::GoodIOStatValue;
 		using DataGlobals::AnyEnergyManagementSystemInModel;
 		// RJH DElight Modification Begin
@@ -632,6 +644,10 @@ namespace HeatBalanceSurfaceManager {
 		if ( any_eq( HeatTransferAlgosUsed, UseCondFD ) ) {
 			InitHeatBalFiniteDiff();
 		}
+		// HAMT sets up its cells here, before the inside heat balance runs its zones in parallel
+		if ( any_eq( HeatTransferAlgosUsed, UseHAMT ) ) {
+			SetupHeatBalHAMT();
+		}
 
 		CTFConstOutPart = 0.0;
 		CTFConstInPart = 0.0;
@@ -652,10 +668,8 @@ namespace HeatBalanceSurfaceManager {
 				QIC = 0.0;
 				QOC = 0.0;
 				TSC = 0.0;
-				auto l11( TH.index( SurfNum, 2, 1 ) );
-				auto l12( TH.index( SurfNum, 2, 2 ) );
-				auto const s1( TH.size1() );
-				for ( Term = 1; Term <= construct.NumCTFTerms; ++Term, l11 += s1, l12 += s1 ) { // [ l11 ] == ( SurfNum, Term + 1, 1 ), [ l12 ] == ( SurfNum, Term + 1, 2 )
+				auto l( CTFHistTOut.index( CTFHistHead( SurfNum ), SurfNum ) ); // History term 2: the older terms follow it
+				for ( Term = 1; Term <= construct.NumCTFTerms; ++Term, ++l ) { // [ l ] == history term Term + 1
 
 					// Sign convention for the various terms in the following two equations
 					// is based on the form of the Conduction Transfer Function equation
@@ -667,21 +681,21 @@ namespace HeatBalanceSurfaceManager {
 					//Tuned Aliases and linear indexing
 					Real64 const ctf_cross( construct.CTFCross( Term ) );
 					Real64 const ctf_flux( construct.CTFFlux( Term ) );
-					Real64 const TH11( TH[ l11 ] );
-					Real64 const TH12( TH[ l12 ] );
+					Real64 const TH11( CTFHistTOut[ l ] );
+					Real64 const TH12( CTFHistTIn[ l ] );
 
-					QIC += ctf_cross * TH11 - construct.CTFInside( Term ) * TH12 + construct.CTFFlux( Term ) * QH[ l12 ];
+					QIC += ctf_cross * TH11 - construct.CTFInside( Term ) * TH12 + ctf_flux * CTFHistQIn[ l ];
 
-					QOC += construct.CTFOutside( Term ) * TH11 - ctf_cross * TH12 + construct.CTFFlux( Term ) * QH[ l11 ];
+					QOC += construct.CTFOutside( Term ) * TH11 - ctf_cross * TH12 + ctf_flux * CTFHistQOut[ l ];
 
 					if ( construct.SourceSinkPresent ) {
-						Real64 const QsrcHist1( QsrcHist( Term + 1, SurfNum ) );
+						Real64 const QsrcHist1( CTFHistQsrc[ l ] );
 
 						QIC += construct.CTFSourceIn( Term ) * QsrcHist1;
 
 						QOC += construct.CTFSourceOut( Term ) * QsrcHist1;
 
-						TSC += construct.CTFTSourceOut( Term ) * TH11 + construct.CTFTSourceIn( Term ) * TH12 + construct.CTFTSourceQ( Term ) * QsrcHist1 + construct.CTFFlux( Term ) * TsrcHist( Term + 1, SurfNum );
+						TSC += construct.CTFTSourceOut( Term ) * TH11 + construct.CTFTSourceIn( Term ) * TH12 + construct.CTFTSourceQ( Term ) * QsrcHist1 + ctf_flux * CTFHistTsrc[ l ];
 					}
 
 				}
@@ -1188,7 +1202,7 @@ namespace HeatBalanceSurfaceManager {
 		QRadThermInAbs.dimension( TotSurfaces, 0.0 );
 		SUMH.dimension( TotSurfaces, 0 );
 
-		TH.dimension( TotSurfaces, MaxCTFTerms, 2, 0.0 );
+		TH.dimension( TotSurfaces, 1, 2, 0.0 );
 		TempSurfOut.dimension( TotSurfaces, 0.0 );
 		TempSurfInRep.dimension( TotSurfaces, 0.0 );
 		QConvInReport.dimension( TotSurfaces, 0.0 );
@@ -1252,13 +1266,27 @@ namespace HeatBalanceSurfaceManager {
 
 		OpaqSurfInsFaceBeamSolAbsorbed.dimension( TotSurfaces, 0.0 );
 		TempSource.dimension( TotSurfaces, 0.0 );
-		QH.dimension( TotSurfaces, MaxCTFTerms, 2, 0.0 );
-		THM.dimension( TotSurfaces, MaxCTFTerms, 2, 0.0 );
-		QHM.dimension( TotSurfaces, MaxCTFTerms, 2, 0.0 );
-		TsrcHist.dimension( MaxCTFTerms, TotSurfaces, 0.0 );
-		QsrcHist.dimension( MaxCTFTerms, TotSurfaces, 0.0 );
-		TsrcHistM.dimension( MaxCTFTerms, TotSurfaces, 0.0 );
-		QsrcHistM.dimension( MaxCTFTerms, TotSurfaces, 0.0 );
+		QH.dimension( TotSurfaces, 1, 2, 0.0 );
+		TsrcHist.dimension( 1, TotSurfaces, 0.0 );
+		QsrcHist.dimension( 1, TotSurfaces, 0.0 );
+
+		CTFHistLength = 1;
+		for ( int ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum ) {
+			CTFHistLength = max( CTFHistLength, Construct( ConstrNum ).NumCTFTerms );
+		}
+		CTFHistHead.dimension( TotSurfaces, 1 );
+		CTFHistTOut.dimension( 2 * CTFHistLength, TotSurfaces, 0.0 );
+		CTFHistTIn.dimension( 2 * CTFHistLength, TotSurfaces, 0.0 );
+		CTFHistQOut.dimension( 2 * CTFHistLength, TotSurfaces, 0.0 );
+		CTFHistQIn.dimension( 2 * CTFHistLength, TotSurfaces, 0.0 );
+		CTFHistTsrc.dimension( 2 * CTFHistLength, TotSurfaces, 0.0 );
+		CTFHistQsrc.dimension( 2 * CTFHistLength, TotSurfaces, 0.0 );
+		CTFHistTOutM.dimension( 2 * CTFHistLength, TotSurfaces, 0.0 );
+		CTFHistTInM.dimension( 2 * CTFHistLength, TotSurfaces, 0.0 );
+		CTFHistQOutM.dimension( 2 * CTFHistLength, TotSurfaces, 0.0 );
+		CTFHistQInM.dimension( 2 * CTFHistLength, TotSurfaces, 0.0 );
+		CTFHistTsrcM.dimension( 2 * CTFHistLength, TotSurfaces, 0.0 );
+		CTFHistQsrcM.dimension( 2 * CTFHistLength, TotSurfaces, 0.0 );
 
 		NetLWRadToSurf.dimension( TotSurfaces, 0.0 );
 		QRadSWLightsInAbs.dimension( TotSurfaces, 0.0 );
@@ -1534,15 +1562,24 @@ namespace HeatBalanceSurfaceManager {
 		TempEffBulkAir = 23.0;
 		TempTstatAir = 23.0;
 
-		// "Bulk" initializations of temperature arrays with dimensions (TotSurface,MaxCTFTerms,2)
+		// "Bulk" initializations of temperature and flux histories
 		TH = 23.0; // module level array
-		THM = 23.0; // module level array
 		TsrcHist = 23.0;
-		TsrcHistM = 23.0;
 		QH = 0.0;
-		QHM = 0.0;
 		QsrcHist = 0.0;
-		QsrcHistM = 0.0;
+		CTFHistHead = 1;
+		CTFHistTOut = 23.0;
+		CTFHistTIn = 23.0;
+		CTFHistTsrc = 23.0;
+		CTFHistTOutM = 23.0;
+		CTFHistTInM = 23.0;
+		CTFHistTsrcM = 23.0;
+		CTFHistQOut = 0.0;
+		CTFHistQIn = 0.0;
+		CTFHistQsrc = 0.0;
+		CTFHistQOutM = 0.0;
+		CTFHistQInM = 0.0;
+		CTFHistQsrcM = 0.0;
 		CondFDRelaxFactor = CondFDRelaxFactorInput;
 		// Initialize window frame and divider temperatures
 		SurfaceWindow.FrameTempSurfIn() = 23.0;
@@ -1564,18 +1601,21 @@ namespace HeatBalanceSurfaceManager {
 			// Reset outside boundary conditions if necessary
 			if ( ( Surface( SurfNum ).ExtBoundCond == ExternalEnvironment ) || ( Surface( SurfNum ).ExtBoundCond == OtherSideCondModeledExt ) ) {
 
-				THM( SurfNum, {1,Construct( Surface( SurfNum ).Construction ).NumCTFTerms + 1}, 1 ) = Surface( SurfNum ).OutDryBulbTemp;
-				TH( SurfNum, {1,Construct( Surface( SurfNum ).Construction ).NumCTFTerms + 1}, 1 ) = Surface( SurfNum ).OutDryBulbTemp;
+				TH( SurfNum, 1, 1 ) = Surface( SurfNum ).OutDryBulbTemp;
+				CTFHistTOut( _, SurfNum ) = Surface( SurfNum ).OutDryBulbTemp;
+				CTFHistTOutM( _, SurfNum ) = Surface( SurfNum ).OutDryBulbTemp;
 
 			} else if ( Surface( SurfNum ).ExtBoundCond == Ground ) {
 
-				THM( SurfNum, {1,Construct( Surface( SurfNum ).Construction ).NumCTFTerms + 1}, 1 ) = GroundTemp;
-				TH( SurfNum, {1,Construct( Surface( SurfNum ).Construction ).NumCTFTerms + 1}, 1 ) = GroundTemp;
+				TH( SurfNum, 1, 1 ) = GroundTemp;
+				CTFHistTOut( _, SurfNum ) = GroundTemp;
+				CTFHistTOutM( _, SurfNum ) = GroundTemp;
 
 			} else if ( Surface( SurfNum ).ExtBoundCond == GroundFCfactorMethod ) {
 
-				THM( SurfNum, {1,Construct( Surface( SurfNum ).Construction ).NumCTFTerms + 1}, 1 ) = GroundTempFC;
-				TH( SurfNum, {1,Construct( Surface( SurfNum ).Construction ).NumCTFTerms + 1}, 1 ) = GroundTempFC;
+				TH( SurfNum, 1, 1 ) = GroundTempFC;
+				CTFHistTOut( _, SurfNum ) = GroundTempFC;
+				CTFHistTOutM( _, SurfNum ) = GroundTempFC;
 
 			}
 
@@ -1585,10 +1625,11 @@ namespace HeatBalanceSurfaceManager {
 			}
 
 			// Initialize the flux histories
-			QH( SurfNum, {2,Construct( Surface( SurfNum ).Construction ).NumCTFTerms + 1}, 1 ) = Construct( Surface( SurfNum ).Construction ).UValue * ( TH( SurfNum, 1, 1 ) - TH( SurfNum, 1, 2 ) );
-			QH( SurfNum, {2,Construct( Surface( SurfNum ).Construction ).NumCTFTerms + 1}, 2 ) = QH( SurfNum, 2, 1 );
-			QHM( SurfNum, {2,Construct( Surface( SurfNum ).Construction ).NumCTFTerms + 1}, 1 ) = QH( SurfNum, 2, 1 );
-			QHM( SurfNum, {2,Construct( Surface( SurfNum ).Construction ).NumCTFTerms + 1}, 2 ) = QH( SurfNum, 2, 1 );
+			Real64 const QHist( Construct( Surface( SurfNum ).Construction ).UValue * ( TH( SurfNum, 1, 1 ) - TH( SurfNum, 1, 2 ) ) );
+			CTFHistQOut( _, SurfNum ) = QHist;
+			CTFHistQIn( _, SurfNum ) = QHist;
+			CTFHistQOutM( _, SurfNum ) = QHist;
+			CTFHistQInM( _, SurfNum ) = QHist;
 
 		}
 
@@ -3752,8 +3793,6 @@ namespace HeatBalanceSurfaceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int HistTermNum; // DO loop counter for history terms
-		int SideNum; // DO loop counter for surfaces sides (inside, outside)
 		int SurfNum; // Surface number DO loop counter
 		int ZoneNum; // Zone number DO loop counter
 
@@ -3770,12 +3809,18 @@ namespace HeatBalanceSurfaceManager {
 		// FLOW:
 
 		//Tuned Assure safe to use shared linear indexing below
-		assert( equal_dimensions( TH, THM ) );
 		assert( equal_dimensions( TH, QH ) );
-		assert( equal_dimensions( TH, QHM ) );
-		assert( equal_dimensions( TsrcHist, QsrcHist ) );
-		assert( equal_dimensions( TsrcHist, TsrcHistM ) );
-		assert( equal_dimensions( TsrcHistM, QsrcHistM ) );
+		assert( equal_dimensions( CTFHistTOut, CTFHistTOutM ) );
+		assert( equal_dimensions( CTFHistTOut, CTFHistTIn ) );
+		assert( equal_dimensions( CTFHistTOut, CTFHistTInM ) );
+		assert( equal_dimensions( CTFHistTOut, CTFHistTsrc ) );
+		assert( equal_dimensions( CTFHistTOut, CTFHistTsrcM ) );
+		assert( equal_dimensions( CTFHistTOut, CTFHistQOut ) );
+		assert( equal_dimensions( CTFHistTOut, CTFHistQOutM ) );
+		assert( equal_dimensions( CTFHistTOut, CTFHistQIn ) );
+		assert( equal_dimensions( CTFHistTOut, CTFHistQInM ) );
+		assert( equal_dimensions( CTFHistTOut, CTFHistQsrc ) );
+		assert( equal_dimensions( CTFHistTOut, CTFHistQsrcM ) );
 
 		if ( FirstTimeFlag ) {
 			QExt1.dimension( TotSurfaces, 0.0 );
@@ -3867,7 +3912,9 @@ namespace HeatBalanceSurfaceManager {
 		} // ...end of loop over all (heat transfer) surfaces...
 
 		// SHIFT TEMPERATURE AND FLUX HISTORIES:
-		// SHIFT AIR TEMP AND FLUX SHIFT VALUES WHEN AT BOTTOM OF ARRAY SPACE.
+		// The history terms are in ring buffers (see DataHeatBalSurface), so the master histories are shifted
+		// by moving the head back one slot, where the new term 2 replaces the oldest term.
+		int const HistLength( CTFHistLength );
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all (heat transfer) surfaces...
 			auto const & surface( Surface( SurfNum ) );
 
@@ -3880,119 +3927,75 @@ namespace HeatBalanceSurfaceManager {
 			++SUMH( SurfNum );
 			SumTime( SurfNum ) = double( SUMH( SurfNum ) ) * TimeStepZone;
 
+			int & Head( CTFHistHead( SurfNum ) );
 			if ( SUMH( SurfNum ) == construct.NumHistories ) {
 
 				SUMH( SurfNum ) = 0;
 
-				if ( construct.NumCTFTerms > 1 ) {
-					int const numCTFTerms( construct.NumCTFTerms );
-					for ( SideNum = 1; SideNum <= 2; ++SideNum ) { //Tuned Index order switched for cache friendliness
-						auto l( THM.index( SurfNum, numCTFTerms, SideNum ) );
-						auto const li( THM.size1() );
-						auto l1( l + li );
-						for ( HistTermNum = numCTFTerms + 1; HistTermNum >= 3; --HistTermNum, l1 = l, l -= li ) { //Tuned Linear indexing
-							//TH( SurfNum, HistTermNum, SideNum ) = THM( SurfNum, HistTermNum, SideNum ) = THM( SurfNum, HistTermNum - 1, SideNum );
-							//QH( SurfNum, HistTermNum, SideNum ) = QHM( SurfNum, HistTermNum, SideNum ) = QHM( SurfNum, HistTermNum - 1, SideNum );
-							TH[ l1 ] = THM[ l1 ] = THM[ l ];
-							QH[ l1 ] = QHM[ l1 ] = QHM[ l ];
-						}
-					}
-					auto m( TsrcHistM.index( numCTFTerms, SurfNum ) );
-					auto m1( m + 1 );
-					for ( HistTermNum = numCTFTerms + 1; HistTermNum >= 3; --HistTermNum, --m, --m1 ) { //Tuned Linear indexing
-						//TsrcHist( HistTerm, SurfNum ) = TsrcHistM( HistTerm, SurfNum ) = TsrcHistM( HistTermNum - 1, SurfNum );
-						//QsrcHist( HistTerm, SurfNum ) = QsrcHistM( HistTerm, SurfNum ) = QsrcHistM( HistTermNum - 1, SurfNum );
-						TsrcHist[ m1 ] = TsrcHistM[ m1 ] = TsrcHistM[ m ];
-						QsrcHist[ m1 ] = QsrcHistM[ m1 ] = QsrcHistM[ m ];
+				Head = ( Head > 1 ? Head - 1 : HistLength );
+				auto const l2( CTFHistTOutM.index( Head, SurfNum ) ); // Linear index of history term 2
+				auto const l2c( l2 + HistLength ); // Linear index of its copy
+				CTFHistTOutM[ l2 ] = CTFHistTOutM[ l2c ] = TempExt1( SurfNum );
+				CTFHistTInM[ l2 ] = CTFHistTInM[ l2c ] = TempInt1( SurfNum );
+				CTFHistTsrcM[ l2 ] = CTFHistTsrcM[ l2c ] = Tsrc1( SurfNum );
+				CTFHistQOutM[ l2 ] = CTFHistQOutM[ l2c ] = QExt1( SurfNum );
+				CTFHistQInM[ l2 ] = CTFHistQInM[ l2c ] = QInt1( SurfNum );
+				CTFHistQsrcM[ l2 ] = CTFHistQsrcM[ l2c ] = Qsrc1( SurfNum );
+
+				if ( construct.NumHistories == 1 ) { // Histories are the same as the master histories: only term 2 is new
+					CTFHistTOut[ l2 ] = CTFHistTOut[ l2c ] = TempExt1( SurfNum );
+					CTFHistTIn[ l2 ] = CTFHistTIn[ l2c ] = TempInt1( SurfNum );
+					CTFHistTsrc[ l2 ] = CTFHistTsrc[ l2c ] = Tsrc1( SurfNum );
+					CTFHistQOut[ l2 ] = CTFHistQOut[ l2c ] = QExt1( SurfNum );
+					CTFHistQIn[ l2 ] = CTFHistQIn[ l2c ] = QInt1( SurfNum );
+					CTFHistQsrc[ l2 ] = CTFHistQsrc[ l2c ] = Qsrc1( SurfNum );
+				} else { // Interpolated histories go back to the master histories
+					auto const l1( CTFHistTOutM.index( 1, SurfNum ) );
+					for ( auto l = l1, e = l1 + 2 * HistLength; l < e; ++l ) {
+						CTFHistTOut[ l ] = CTFHistTOutM[ l ];
+						CTFHistTIn[ l ] = CTFHistTInM[ l ];
+						CTFHistTsrc[ l ] = CTFHistTsrcM[ l ];
+						CTFHistQOut[ l ] = CTFHistQOutM[ l ];
+						CTFHistQIn[ l ] = CTFHistQInM[ l ];
+						CTFHistQsrc[ l ] = CTFHistQsrcM[ l ];
 					}
 				}
 
-				//Tuned Linear indexing
-				//THM( SurfNum, 2, 1 ) = TempExt1( SurfNum );
-				//THM( SurfNum, 2, 2 ) = TempInt1( SurfNum );
-				//TsrcHistM( 2, SurfNum ) = Tsrc1( SurfNum );
-				//QHM( SurfNum, 2, 1 ) = QExt1( SurfNum );
-				//QHM( SurfNum, 2, 2 ) = QInt1( SurfNum );
-				//QsrcHistM( 2, SurfNum ) = Qsrc1( SurfNum );
-				//
-				//TH( SurfNum, 2, 1 ) = THM( SurfNum, 2, 1 );
-				//TH( SurfNum, 2, 2 ) = THM( SurfNum, 2, 2 );
-				//TsrcHist( 2, SurfNum ) = TsrcHistM( 2, SurfNum );
-				//QH( SurfNum, 2, 1 ) = QHM( SurfNum, 2, 1 );
-				//QH( SurfNum, 2, 2 ) = QHM( SurfNum, 2, 2 );
-				//QsrcHist( 2, SurfNum ) = QsrcHistM( 2, SurfNum );
-
-				auto const l21( TH.index( SurfNum, 2, 1 ) ); // Linear index
-				auto const l22( TH.index( SurfNum, 2, 2 ) ); // Linear index
-				THM[ l21 ] = TempExt1( SurfNum );
-				THM[ l22 ] = TempInt1( SurfNum );
-				TsrcHistM( 2, SurfNum ) = Tsrc1( SurfNum );
-				QHM[ l21 ] = QExt1( SurfNum );
-				QHM[ l22 ] = QInt1( SurfNum );
-				QsrcHistM( 2, SurfNum ) = Qsrc1( SurfNum );
-
-				TH[ l21 ] = THM[ l21 ];
-				TH[ l22 ] = THM( SurfNum, 2, 2 );
-				TsrcHist( 2, SurfNum ) = TsrcHistM( 2, SurfNum );
-				QH[ l21 ] = QHM[ l21 ];
-				QH[ l22 ] = QHM( SurfNum, 2, 2 );
-				QsrcHist( 2, SurfNum ) = QsrcHistM( 2, SurfNum );
-
 			} else {
 
+				// Interpolate each history term between its master term and the next newer one (for term 2,
+				// the values of the first time step of the series)
 				Real64 const sum_steps( SumTime( SurfNum ) / construct.CTFTimeStep );
-				if ( construct.NumCTFTerms > 1 ) {
-					int const numCTFTerms( construct.NumCTFTerms );
-					for ( SideNum = 1; SideNum <= 2; ++SideNum ) { //Tuned Index order switched for cache friendliness
-						auto l( THM.index( SurfNum, numCTFTerms, SideNum ) );
-						auto const s1( THM.size1() );
-						auto l1( l + s1 );
-						for ( HistTermNum = numCTFTerms + 1; HistTermNum >= 3; --HistTermNum, l1 = l, l -= s1 ) { //Tuned Linear indexing
-							//Real64 const THM_l1( THM( SurfNum, HistTermNum, SideNum ) );
-							//TH( SurfNum, HistTermNum, SideNum ) = THM_l1 - ( THM_l1 - THM( SurfNum, HistTermNum - 1, SideNum ) ) * sum_steps;
-							//Real64 const QHM_l1( QHM( SurfNum, HistTermNum, SideNum ) );
-							//QH( SurfNum, HistTermNum, SideNum ) = QHM_l1 - ( QHM_l1 - QHM( SurfNum, HistTermNum - 1, SideNum ) ) * sum_steps;
-							Real64 const THM_l1( THM[ l1 ] );
-							TH[ l1 ] = THM_l1 - ( THM_l1 - THM[ l ] ) * sum_steps;
-							Real64 const QHM_l1( QHM[ l1 ] );
-							QH[ l1 ] = QHM_l1 - ( QHM_l1 - QHM[ l ] ) * sum_steps;
-						}
-					}
-					auto m( TsrcHistM.index( numCTFTerms, SurfNum ) );
-					auto m1( m + 1 );
-					for ( HistTermNum = numCTFTerms + 1; HistTermNum >= 3; --HistTermNum, --m, --m1 ) { //Tuned Linear indexing [ l ] == ()
-						//Real64 const TsrcHistM_elem( TsrcHistM( HistTermNum, SurfNum ) );
-						//TsrcHist( HistTermNum, SurfNum ) = TsrcHistM_elem - ( TsrcHistM_elem - TsrcHistM( HistTermNum - 1, SurfNum ) ) * sum_steps;
-						//Real64 const QsrcHistM_elem( QsrcHistM( HistTermNum, SurfNum ) );
-						//QsrcHist( HistTermNum, SurfNum ) = QsrcHistM_elem - ( QsrcHistM_elem - QsrcHistM( HistTermNum - 1, SurfNum ) ) * sum_steps;
-						Real64 const TsrcHistM_m1( TsrcHistM[ m1 ] );
-						TsrcHist[ m1 ] = TsrcHistM_m1 - ( TsrcHistM_m1 - TsrcHistM[ m ] ) * sum_steps;
-						Real64 const QsrcHistM_m1( QsrcHistM[ m1 ] );
-						QsrcHist[ m1 ] = QsrcHistM_m1 - ( QsrcHistM_m1 - QsrcHistM[ m ] ) * sum_steps;
-					}
+				Real64 TOutNewer( TempExt1( SurfNum ) );
+				Real64 TInNewer( TempInt1( SurfNum ) );
+				Real64 TsrcNewer( Tsrc1( SurfNum ) );
+				Real64 QOutNewer( QExt1( SurfNum ) );
+				Real64 QInNewer( QInt1( SurfNum ) );
+				Real64 QsrcNewer( Qsrc1( SurfNum ) );
+				int const numCTFTerms( max( construct.NumCTFTerms, 1 ) );
+				auto l( CTFHistTOutM.index( Head, SurfNum ) ); // [ l ] == history term 2
+				for ( int Slot = Head, e = Head + numCTFTerms; Slot < e; ++Slot, ++l ) {
+					auto const lc( Slot <= HistLength ? l + HistLength : l - HistLength ); // Linear index of the copy
+					Real64 const TOutM( CTFHistTOutM[ l ] );
+					CTFHistTOut[ l ] = CTFHistTOut[ lc ] = TOutM - ( TOutM - TOutNewer ) * sum_steps;
+					TOutNewer = TOutM;
+					Real64 const TInM( CTFHistTInM[ l ] );
+					CTFHistTIn[ l ] = CTFHistTIn[ lc ] = TInM - ( TInM - TInNewer ) * sum_steps;
+					TInNewer = TInM;
+					Real64 const TsrcM( CTFHistTsrcM[ l ] );
+					CTFHistTsrc[ l ] = CTFHistTsrc[ lc ] = TsrcM - ( TsrcM - TsrcNewer ) * sum_steps;
+					TsrcNewer = TsrcM;
+					Real64 const QOutM( CTFHistQOutM[ l ] );
+					CTFHistQOut[ l ] = CTFHistQOut[ lc ] = QOutM - ( QOutM - QOutNewer ) * sum_steps;
+					QOutNewer = QOutM;
+					Real64 const QInM( CTFHistQInM[ l ] );
+					CTFHistQIn[ l ] = CTFHistQIn[ lc ] = QInM - ( QInM - QInNewer ) * sum_steps;
+					QInNewer = QInM;
+					Real64 const QsrcM( CTFHistQsrcM[ l ] );
+					CTFHistQsrc[ l ] = CTFHistQsrc[ lc ] = QsrcM - ( QsrcM - QsrcNewer ) * sum_steps;
+					QsrcNewer = QsrcM;
 				}
 
-				//Tuned Linear indexing
-				//TH( SurfNum, 2, 1 ) = THM( SurfNum, 2, 1 ) - ( THM( SurfNum, 2, 1 ) - TempExt1( SurfNum ) ) * sum_steps;
-				//TH( SurfNum, 2, 2 ) = THM( SurfNum, 2, 2 ) - ( THM( SurfNum, 2, 2 ) - TempInt1( SurfNum ) ) * sum_steps;
-				//QH( SurfNum, 2, 1 ) = QHM( SurfNum, 2, 1 ) - ( QHM( SurfNum, 2, 1 ) - QExt1( SurfNum ) ) * sum_steps;
-				//QH( SurfNum, 2, 2 ) = QHM( SurfNum, 2, 2 ) - ( QHM( SurfNum, 2, 2 ) - QInt1( SurfNum ) ) * sum_steps;
-
-				auto const l21( TH.index( SurfNum, 2, 1 ) ); // Linear index
-				auto const l22( TH.index( SurfNum, 2, 2 ) ); // Linear index
-				TH[ l21 ] = THM[ l21 ] - ( THM[ l21 ] - TempExt1( SurfNum ) ) * sum_steps;
-				TH[ l22 ] = THM[ l22 ] - ( THM[ l22 ] - TempInt1( SurfNum ) ) * sum_steps;
-				QH[ l21 ] = QHM[ l21 ] - ( QHM[ l21 ] - QExt1( SurfNum ) ) * sum_steps;
-				QH[ l22 ] = QHM[ l22 ] - ( QHM[ l22 ] - QInt1( SurfNum ) ) * sum_steps;
-
-				//Tuned Linear indexing
-				//TsrcHist( 2, SurfNum ) = TsrcHistM( 2, SurfNum ) - ( TsrcHistM( 2, SurfNum ) - Tsrc1( SurfNum ) ) * sum_steps;
-				//QsrcHist( 2, SurfNum ) = QsrcHistM( 2, SurfNum ) - ( QsrcHistM( 2, SurfNum ) - Qsrc1( SurfNum ) ) * sum_steps;
-
-				auto const l2( TsrcHist.index( 2, SurfNum ) );
-				TsrcHist[ l2 ] = TsrcHistM[ l2 ] - ( TsrcHistM[ l2 ] - Tsrc1( SurfNum ) ) * sum_steps;
-				QsrcHist[ l2 ] = QsrcHistM[ l2 ] - ( QsrcHistM[ l2 ] - Qsrc1( SurfNum ) ) * sum_steps;
-
 			}
 
 		} // ...end of loop over all (heat transfer) surfaces
@@ -4253,6 +4256,105 @@ namespace HeatBalanceSurfaceManager {
 
 // EXTERNAL SUBROUTINES (heavily related to HeatBalanceSurfaceManager)
 
+void
+FindSurfHeatBalGroups()
+{
+
+	// SUBROUTINE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Splits the surfaces of the outside and inside heat balances into groups that can be done in
+	// parallel.  Group 0 holds the surfaces whose models keep state shared between surfaces (other
+	// side coefficients, ecoroof, movable insulation, adaptive and user convection coefficients,
+	// windows, EMPD with its psychrometric caches, HAMT unless it uses the BandMatrix solver, and CondFD
+	// and HAMT outside); it is done by one thread in surface order.  The CondFD and HAMT solutions of a
+	// surface only change its own state and that of the other side of an interzone partition, so CondFD
+	// surfaces without outside movable insulation and BandMatrix HAMT surfaces are done with their zone.  Within one iteration the surface balances only read the other surfaces' values
+	// of the iteration before, except for the radiant system coefficients swapped across interzone
+	// partitions, so the inside groups hold whole zones joined by interzone partitions.
+
+	// METHODOLOGY EMPLOYED:
+	// Union-find over zones, joining the two zones of each interzone partition.  Groups are listed
+	// in order of their first zone and hold their surfaces in increasing order, so each group repeats
+	// the serial order.  If any opaque surface of an inside group needs the serial group, all of the
+	// group's surfaces are moved there.
+
+	// Using/Aliasing
+	using DataGlobals::NumOfZones;
+	using namespace DataHeatBalance;
+	using namespace DataSurfaces;
+	using HeatBalanceSurfaceManager::OutsideSurfGroups;
+	using HeatBalanceSurfaceManager::InsideSurfGroups;
+
+	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+	FArray1D_int Root( NumOfZones ); // Zone leading the group of each zone (union-find parent)
+	std::vector< int > GroupOfRoot( NumOfZones + 1, -1 ); // Index in InsideSurfGroups of each leading zone
+	std::vector< bool > SerialGroup; // Inside groups that have to be done in the serial group
+
+	for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+		Root( ZoneNum ) = ZoneNum;
+	}
+
+	OutsideSurfGroups.assign( 1, std::vector< int >() );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		auto const & surface( Surface( SurfNum ) );
+		if ( ! surface.HeatTransSurf || surface.Zone == 0 ) continue;
+		if ( surface.ExtBoundCond > 0 && surface.ExtBoundCond != SurfNum ) { // Interzone partition
+			int Root1( surface.Zone );
+			while ( Root( Root1 ) != Root1 ) Root1 = Root( Root1 );
+			int Root2( Surface( surface.ExtBoundCond ).Zone );
+			while ( Root( Root2 ) != Root2 ) Root2 = Root( Root2 );
+			Root( max( Root1, Root2 ) ) = min( Root1, Root2 );
+		}
+		if ( surface.Class == SurfaceClass_Window ) continue; // Windows are done in the inside heat balance
+		int const ExtConvAlgo( surface.ExtConvCoeff <= -1 ? std::abs( surface.ExtConvCoeff ) : Zone( surface.Zone ).OutsideConvectionAlgo );
+		bool const Serial( surface.ExtBoundCond == OtherSideCoefNoCalcExt || surface.ExtBoundCond == OtherSideCoefCalcExt || surface.ExtBoundCond == OtherSideCondModeledExt || surface.ExtEcoRoof || surface.MaterialMovInsulExt > 0 || surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT || ( surface.ExtBoundCond == ExternalEnvironment && ( surface.ExtConvCoeff > 0 || ExtConvAlgo == AdaptiveConvectionAlgorithm ) ) );
+		if ( Serial ) {
+			OutsideSurfGroups[ 0 ].push_back( SurfNum );
+		} else {
+			OutsideSurfGroups.push_back( std::vector< int >( 1, SurfNum ) );
+		}
+	}
+
+	InsideSurfGroups.assign( 1, std::vector< int >() );
+	SerialGroup.assign( 1, true );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		auto const & surface( Surface( SurfNum ) );
+		if ( ! surface.HeatTransSurf || surface.Zone == 0 ) continue;
+		if ( surface.Class == SurfaceClass_TDD_Dome ) continue; // Done with its TDD:DIFFUSER
+		int ZoneRoot( surface.Zone );
+		while ( Root( ZoneRoot ) != ZoneRoot ) ZoneRoot = Root( ZoneRoot );
+		if ( GroupOfRoot[ ZoneRoot ] < 0 ) {
+			GroupOfRoot[ ZoneRoot ] = InsideSurfGroups.size();
+			InsideSurfGroups.push_back( std::vector< int >() );
+			SerialGroup.push_back( false );
+		}
+		int const Group( GroupOfRoot[ ZoneRoot ] );
+		if ( surface.Class == SurfaceClass_Window ) { // Window models share their working arrays
+			InsideSurfGroups[ 0 ].push_back( SurfNum );
+			continue;
+		}
+		if ( ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT && ! HAMTBandSolver ) || surface.HeatTransferAlgorithm == HeatTransferModel_EMPD || surface.MaterialMovInsulInt > 0 ) SerialGroup[ Group ] = true;
+		if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD && surface.MaterialMovInsulExt > 0 ) SerialGroup[ Group ] = true; // CondFD evaluates the outside insulation too
+		InsideSurfGroups[ Group ].push_back( SurfNum );
+	}
+
+	// Merge the serial groups into group 0, keeping the surface order
+	for ( std::vector< int >::size_type Group = 1; Group < InsideSurfGroups.size(); ++Group ) {
+		if ( ! SerialGroup[ Group ] ) continue;
+		std::vector< int > Merged;
+		std::merge( InsideSurfGroups[ 0 ].begin(), InsideSurfGroups[ 0 ].end(), InsideSurfGroups[ Group ].begin(), InsideSurfGroups[ Group ].end(), std::back_inserter( Merged ) );
+		InsideSurfGroups[ 0 ].swap( Merged );
+		InsideSurfGroups[ Group ].clear();
+	}
+	InsideSurfGroups.erase( std::remove_if( InsideSurfGroups.begin() + 1, InsideSurfGroups.end(), []( std::vector< int > const & Surfs ) { return Surfs.empty(); } ), InsideSurfGroups.end() );
+
+}
+
 void
 CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed in, then only calculate surfaces that have this zone
 {
@@ -4312,6 +4414,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 	using ScheduleManager::GetScheduleIndex;
 	using namespace Psychrometrics;
 	using EcoRoofManager::CalcEcoRoof;
+	using HeatBalanceSurfaceManager::OutsideSurfGroups;
 
 	// Locals
 	// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -4341,25 +4444,15 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	Real64 AbsThermSurf; // Thermal absoptance of the exterior surface
-	int ConstrNum; // Construction index for the current surface
-	Real64 HGround; // "Convection" coefficient from ground to surface
-	Real64 HMovInsul; // "Convection" coefficient of movable insulation
-	Real64 HSky; // "Convection" coefficient from sky to surface
-	Real64 HAir; // "Convection" coefficient from air to surface (radiation)
-	Real64 ConstantTempCoef; // Temperature Coefficient as input or modified using sine wave  COP mod
-	int RoughSurf; // Roughness index of the exterior surface
-	int SurfNum; // Surface number DO loop counter
-	Real64 TempExt; // Exterior temperature boundary condition
-	int ZoneNum; // Zone number the current surface is attached to
-	int OPtr;
-	Real64 RhoVaporSat; // Local temporary saturated vapor density for checking
+	// na
 
 	// FUNCTION DEFINITIONS:
 	// na
 
 	// FLOW:
-	for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+	if ( OutsideSurfGroups.empty() ) FindSurfHeatBalGroups();
+
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 		// Need to transfer any source/sink for a surface to the local array.  Note that
 		// the local array is flux (W/m2) while the QRadSysSource is heat transfer (W).
 		// This must be done at this location so that this is always updated correctly.
@@ -4375,293 +4468,339 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 		CalcInteriorRadExchange( TH( _, 1, 2 ), 0, NetLWRadToSurf, _, Outside );
 	}
 
-	for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all surfaces...
-
-		ZoneNum = Surface( SurfNum ).Zone;
-
-		if ( present( ZoneToResimulate ) ) {
-			if ( ( ZoneNum != ZoneToResimulate ) && ( AdjacentZoneToSurface( SurfNum ) != ZoneToResimulate ) ) {
-				continue; // skip surfaces that are not associated with this zone
+	bool const PartialResimulate( present( ZoneToResimulate ) );
+	std::vector< int > SurfToResimulate;
+	if ( PartialResimulate ) {
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( ( Surface( SurfNum ).Zone == ZoneToResimulate ) || ( AdjacentZoneToSurface( SurfNum ) == ZoneToResimulate ) ) {
+				SurfToResimulate.push_back( SurfNum ); // only the surfaces associated with this zone
 			}
 		}
+	}
 
-		if ( ! Surface( SurfNum ).HeatTransSurf || ZoneNum == 0 ) continue; // Skip non-heat transfer surfaces
+	// The first group holds the surfaces whose models keep shared state, done in surface order; the other
+	// groups are independent and run in parallel (see FindSurfHeatBalGroups)
+	int const NumSurfGroups( PartialResimulate ? 1 : OutsideSurfGroups.size() );
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) if ( NumSurfGroups > 1 )
+#endif
+	for ( int Group = 0; Group < NumSurfGroups; ++Group ) {
+		std::vector< int > const & GroupSurfs( PartialResimulate ? SurfToResimulate : OutsideSurfGroups[ Group ] );
+		for ( int const SurfNum : GroupSurfs ) { // Loop through all surfaces...
+
+			Real64 AbsThermSurf; // Thermal absoptance of the exterior surface
+			int ConstrNum; // Construction index for the current surface
+			Real64 HGround; // "Convection" coefficient from ground to surface
+			Real64 HMovInsul; // "Convection" coefficient of movable insulation
+			Real64 HSky; // "Convection" coefficient from sky to surface
+			Real64 HAir; // "Convection" coefficient from air to surface (radiation)
+			Real64 ConstantTempCoef; // Temperature Coefficient as input or modified using sine wave  COP mod
+			int RoughSurf; // Roughness index of the exterior surface
+			Real64 TempExt; // Exterior temperature boundary condition
+			int const ZoneNum( Surface( SurfNum ).Zone ); // Zone number the current surface is attached to
+			int OPtr( 0 );
+			Real64 RhoVaporSat; // Local temporary saturated vapor density for checking
 
-		if ( Surface( SurfNum ).Class == SurfaceClass_Window ) continue;
-		// Interior windows in partitions use "normal" heat balance calculations
-		// For rest, Outside surface temp of windows not needed in Window5 calculation approach.
-		// Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
+			if ( ! Surface( SurfNum ).HeatTransSurf || ZoneNum == 0 ) continue; // Skip non-heat transfer surfaces
 
-		// Initializations for this surface
-		ConstrNum = Surface( SurfNum ).Construction;
-		HMovInsul = 0.0;
-		HSky = 0.0;
-		HGround = 0.0;
-		HAir = 0.0;
-		HcExtSurf( SurfNum ) = 0.0;
-		HAirExtSurf( SurfNum ) = 0.0;
-		HSkyExtSurf( SurfNum ) = 0.0;
-		HGrdExtSurf( SurfNum ) = 0.0;
+			if ( Surface( SurfNum ).Class == SurfaceClass_Window ) continue;
+			// Interior windows in partitions use "normal" heat balance calculations
+			// For rest, Outside surface temp of windows not needed in Window5 calculation approach.
+			// Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
 
-		// Calculate the current outside surface temperature TH(SurfNum,1,1) for the
-		// various different boundary conditions
-		{ auto const SELECT_CASE_var( Surface( SurfNum ).ExtBoundCond );
+			// Initializations for this surface
+			ConstrNum = Surface( SurfNum ).Construction;
+			HMovInsul = 0.0;
+			HSky = 0.0;
+			HGround = 0.0;
+			HAir = 0.0;
+			HcExtSurf( SurfNum ) = 0.0;
+			HAirExtSurf( SurfNum ) = 0.0;
+			HSkyExtSurf( SurfNum ) = 0.0;
+			HGrdExtSurf( SurfNum ) = 0.0;
+
+			// Calculate the current outside surface temperature TH(SurfNum,1,1) for the
+			// various different boundary conditions
+			{ auto const SELECT_CASE_var( Surface( SurfNum ).ExtBoundCond );
+
+			if ( SELECT_CASE_var == Ground ) { // Surface in contact with ground
+
+				TH( SurfNum, 1, 1 ) = GroundTemp;
+
+				// Set the only radiant system heat balance coefficient that is non-zero for this case
+				if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
+
+				// start HAMT
+				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					// Set variables used in the HAMT moisture balance
+					TempOutsideAirFD( SurfNum ) = GroundTemp;
+					RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( GroundTemp, 1.0, HBSurfManGroundHAMT );
+					HConvExtFD( SurfNum ) = HighHConvLimit;
+
+					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTemp, PsyWFnTdbRhPb( GroundTemp, 1.0, OutBaroPress, RoutineNameGroundTemp ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTemp ) );
+
+					HSkyFD( SurfNum ) = HSky;
+					HGrndFD( SurfNum ) = HGround;
+					HAirFD( SurfNum ) = HAir;
+				}
+				// end HAMT
 
-		if ( SELECT_CASE_var == Ground ) { // Surface in contact with ground
+				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+					// Set variables used in the FD moisture balance
+					TempOutsideAirFD( SurfNum ) = GroundTemp;
+					RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( GroundTemp, 1.0 );
+					HConvExtFD( SurfNum ) = HighHConvLimit;
+					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTemp, PsyWFnTdbRhPb( GroundTemp, 1.0, OutBaroPress, RoutineNameGroundTemp ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTemp ) );
+					HSkyFD( SurfNum ) = HSky;
+					HGrndFD( SurfNum ) = HGround;
+					HAirFD( SurfNum ) = HAir;
+				}
 
-			TH( SurfNum, 1, 1 ) = GroundTemp;
+				// Added for FCfactor grounds
+			} else if ( SELECT_CASE_var == GroundFCfactorMethod ) { // Surface in contact with ground
 
-			// Set the only radiant system heat balance coefficient that is non-zero for this case
-			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
+				TH( SurfNum, 1, 1 ) = GroundTempFC;
 
-			// start HAMT
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-				// Set variables used in the HAMT moisture balance
-				TempOutsideAirFD( SurfNum ) = GroundTemp;
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( GroundTemp, 1.0, HBSurfManGroundHAMT );
-				HConvExtFD( SurfNum ) = HighHConvLimit;
+				// Set the only radiant system heat balance coefficient that is non-zero for this case
+				if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
 
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTemp, PsyWFnTdbRhPb( GroundTemp, 1.0, OutBaroPress, RoutineNameGroundTemp ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTemp ) );
+				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					// Set variables used in the HAMT moisture balance
+					TempOutsideAirFD( SurfNum ) = GroundTempFC;
+					RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( GroundTempFC, 1.0, HBSurfManGroundHAMT );
+					HConvExtFD( SurfNum ) = HighHConvLimit;
 
-				HSkyFD( SurfNum ) = HSky;
-				HGrndFD( SurfNum ) = HGround;
-				HAirFD( SurfNum ) = HAir;
-			}
-			// end HAMT
-
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
-				// Set variables used in the FD moisture balance
-				TempOutsideAirFD( SurfNum ) = GroundTemp;
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( GroundTemp, 1.0 );
-				HConvExtFD( SurfNum ) = HighHConvLimit;
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTemp, PsyWFnTdbRhPb( GroundTemp, 1.0, OutBaroPress, RoutineNameGroundTemp ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTemp ) );
-				HSkyFD( SurfNum ) = HSky;
-				HGrndFD( SurfNum ) = HGround;
-				HAirFD( SurfNum ) = HAir;
-			}
+					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTempFC, PsyWFnTdbRhPb( GroundTempFC, 1.0, OutBaroPress, RoutineNameGroundTempFC ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTempFC ) );
 
-			// Added for FCfactor grounds
-		} else if ( SELECT_CASE_var == GroundFCfactorMethod ) { // Surface in contact with ground
-
-			TH( SurfNum, 1, 1 ) = GroundTempFC;
+					HSkyFD( SurfNum ) = HSky;
+					HGrndFD( SurfNum ) = HGround;
+					HAirFD( SurfNum ) = HAir;
+				}
 
-			// Set the only radiant system heat balance coefficient that is non-zero for this case
-			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
+				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+					// Set variables used in the FD moisture balance
+					TempOutsideAirFD( SurfNum ) = GroundTempFC;
+					RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( GroundTempFC, 1.0 );
+					HConvExtFD( SurfNum ) = HighHConvLimit;
+					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTempFC, PsyWFnTdbRhPb( GroundTempFC, 1.0, OutBaroPress, RoutineNameGroundTempFC ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTempFC ) );
+					HSkyFD( SurfNum ) = HSky;
+					HGrndFD( SurfNum ) = HGround;
+					HAirFD( SurfNum ) = HAir;
+				}
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-				// Set variables used in the HAMT moisture balance
-				TempOutsideAirFD( SurfNum ) = GroundTempFC;
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( GroundTempFC, 1.0, HBSurfManGroundHAMT );
-				HConvExtFD( SurfNum ) = HighHConvLimit;
+			} else if ( SELECT_CASE_var == OtherSideCoefNoCalcExt ) {
+				// Use Other Side Coefficients to determine the surface film coefficient and
+				// the exterior boundary condition temperature
 
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTempFC, PsyWFnTdbRhPb( GroundTempFC, 1.0, OutBaroPress, RoutineNameGroundTempFC ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTempFC ) );
+				OPtr = Surface( SurfNum ).OSCPtr;
+				// Set surface temp from previous timestep
+				if ( BeginTimeStepFlag ) {
+					OSC( OPtr ).TOutsideSurfPast = TH( SurfNum, 1, 1 );
+				}
 
-				HSkyFD( SurfNum ) = HSky;
-				HGrndFD( SurfNum ) = HGround;
-				HAirFD( SurfNum ) = HAir;
-			}
+				if ( OSC( OPtr ).ConstTempScheduleIndex != 0 ) { // Determine outside temperature from schedule
+					OSC( OPtr ).ConstTemp = GetCurrentScheduleValue( OSC( OPtr ).ConstTempScheduleIndex );
+				}
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
-				// Set variables used in the FD moisture balance
-				TempOutsideAirFD( SurfNum ) = GroundTempFC;
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( GroundTempFC, 1.0 );
-				HConvExtFD( SurfNum ) = HighHConvLimit;
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTempFC, PsyWFnTdbRhPb( GroundTempFC, 1.0, OutBaroPress, RoutineNameGroundTempFC ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTempFC ) );
-				HSkyFD( SurfNum ) = HSky;
-				HGrndFD( SurfNum ) = HGround;
-				HAirFD( SurfNum ) = HAir;
-			}
+				//  Allow for modification of TemperatureCoefficient with unitary sine wave.
+				if ( OSC( OPtr ).SinusoidalConstTempCoef ) { // Sine wave C4
+					ConstantTempCoef = std::sin( 2 * Pi * CurrentTime / OSC( OPtr ).SinusoidPeriod );
+				} else {
+					ConstantTempCoef = OSC( OPtr ).ConstTempCoef;
+				}
 
-		} else if ( SELECT_CASE_var == OtherSideCoefNoCalcExt ) {
-			// Use Other Side Coefficients to determine the surface film coefficient and
-			// the exterior boundary condition temperature
+				OSC( OPtr ).OSCTempCalc = ( OSC( OPtr ).ZoneAirTempCoef * MAT( ZoneNum ) + OSC( OPtr ).ExtDryBulbCoef * Surface( SurfNum ).OutDryBulbTemp + ConstantTempCoef * OSC( OPtr ).ConstTemp + OSC( OPtr ).GroundTempCoef * GroundTemp + OSC( OPtr ).WindSpeedCoef * Surface( SurfNum ).WindSpeed * Surface( SurfNum ).OutDryBulbTemp + OSC( OPtr ).TPreviousCoef * OSC( OPtr ).TOutsideSurfPast );
 
-			OPtr = Surface( SurfNum ).OSCPtr;
-			// Set surface temp from previous timestep
-			if ( BeginTimeStepFlag ) {
-				OSC( OPtr ).TOutsideSurfPast = TH( SurfNum, 1, 1 );
-			}
+				// Enforce max/min limits if applicable
+				if ( OSC( OPtr ).MinLimitPresent ) OSC( OPtr ).OSCTempCalc = max( OSC( OPtr ).MinTempLimit, OSC( OPtr ).OSCTempCalc );
+				if ( OSC( OPtr ).MaxLimitPresent ) OSC( OPtr ).OSCTempCalc = min( OSC( OPtr ).MaxTempLimit, OSC( OPtr ).OSCTempCalc );
 
-			if ( OSC( OPtr ).ConstTempScheduleIndex != 0 ) { // Determine outside temperature from schedule
-				OSC( OPtr ).ConstTemp = GetCurrentScheduleValue( OSC( OPtr ).ConstTempScheduleIndex );
-			}
+				TH( SurfNum, 1, 1 ) = OSC( OPtr ).OSCTempCalc;
 
-			//  Allow for modification of TemperatureCoefficient with unitary sine wave.
-			if ( OSC( OPtr ).SinusoidalConstTempCoef ) { // Sine wave C4
-				ConstantTempCoef = std::sin( 2 * Pi * CurrentTime / OSC( OPtr ).SinusoidPeriod );
-			} else {
-				ConstantTempCoef = OSC( OPtr ).ConstTempCoef;
-			}
+				// Set the only radiant system heat balance coefficient that is non-zero for this case
+				if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
 
-			OSC( OPtr ).OSCTempCalc = ( OSC( OPtr ).ZoneAirTempCoef * MAT( ZoneNum ) + OSC( OPtr ).ExtDryBulbCoef * Surface( SurfNum ).OutDryBulbTemp + ConstantTempCoef * OSC( OPtr ).ConstTemp + OSC( OPtr ).GroundTempCoef * GroundTemp + OSC( OPtr ).WindSpeedCoef * Surface( SurfNum ).WindSpeed * Surface( SurfNum ).OutDryBulbTemp + OSC( OPtr ).TPreviousCoef * OSC( OPtr ).TOutsideSurfPast );
+				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					// Set variables used in the FD moisture balance and HAMT
+					TempOutsideAirFD( SurfNum ) = TH( SurfNum, 1, 1 );
+					RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
+					HConvExtFD( SurfNum ) = HighHConvLimit;
+					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOtherSideCoefNoCalcExt ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+					HSkyFD( SurfNum ) = HSky;
+					HGrndFD( SurfNum ) = HGround;
+					HAirFD( SurfNum ) = HAir;
+				}
 
-			// Enforce max/min limits if applicable
-			if ( OSC( OPtr ).MinLimitPresent ) OSC( OPtr ).OSCTempCalc = max( OSC( OPtr ).MinTempLimit, OSC( OPtr ).OSCTempCalc );
-			if ( OSC( OPtr ).MaxLimitPresent ) OSC( OPtr ).OSCTempCalc = min( OSC( OPtr ).MaxTempLimit, OSC( OPtr ).OSCTempCalc );
+				// This ends the calculations for this surface and goes on to the next SurfNum
 
-			TH( SurfNum, 1, 1 ) = OSC( OPtr ).OSCTempCalc;
+			} else if ( SELECT_CASE_var == OtherSideCoefCalcExt ) { // A surface with other side coefficients that define the outside environment
 
-			// Set the only radiant system heat balance coefficient that is non-zero for this case
-			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
+				// First, set up the outside convection coefficient and the exterior temperature
+				// boundary condition for the surface
+				OPtr = Surface( SurfNum ).OSCPtr;
+				// Set surface temp from previous timestep
+				if ( BeginTimeStepFlag ) {
+					OSC( OPtr ).TOutsideSurfPast = TH( SurfNum, 1, 1 );
+				}
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-				// Set variables used in the FD moisture balance and HAMT
-				TempOutsideAirFD( SurfNum ) = TH( SurfNum, 1, 1 );
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
-				HConvExtFD( SurfNum ) = HighHConvLimit;
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOtherSideCoefNoCalcExt ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-				HSkyFD( SurfNum ) = HSky;
-				HGrndFD( SurfNum ) = HGround;
-				HAirFD( SurfNum ) = HAir;
-			}
+				if ( OSC( OPtr ).ConstTempScheduleIndex != 0 ) { // Determine outside temperature from schedule
+					OSC( OPtr ).ConstTemp = GetCurrentScheduleValue( OSC( OPtr ).ConstTempScheduleIndex );
+				}
 
-			// This ends the calculations for this surface and goes on to the next SurfNum
+				HcExtSurf( SurfNum ) = OSC( OPtr ).SurfFilmCoef;
 
-		} else if ( SELECT_CASE_var == OtherSideCoefCalcExt ) { // A surface with other side coefficients that define the outside environment
+				OSC( OPtr ).OSCTempCalc = ( OSC( OPtr ).ZoneAirTempCoef * MAT( ZoneNum ) + OSC( OPtr ).ExtDryBulbCoef * Surface( SurfNum ).OutDryBulbTemp + OSC( OPtr ).ConstTempCoef * OSC( OPtr ).ConstTemp + OSC( OPtr ).GroundTempCoef * GroundTemp + OSC( OPtr ).WindSpeedCoef * Surface( SurfNum ).WindSpeed * Surface( SurfNum ).OutDryBulbTemp + OSC( OPtr ).TPreviousCoef * OSC( OPtr ).TOutsideSurfPast );
 
-			// First, set up the outside convection coefficient and the exterior temperature
-			// boundary condition for the surface
-			OPtr = Surface( SurfNum ).OSCPtr;
-			// Set surface temp from previous timestep
-			if ( BeginTimeStepFlag ) {
-				OSC( OPtr ).TOutsideSurfPast = TH( SurfNum, 1, 1 );
-			}
+				// Enforce max/min limits if applicable
+				if ( OSC( OPtr ).MinLimitPresent ) OSC( OPtr ).OSCTempCalc = max( OSC( OPtr ).MinTempLimit, OSC( OPtr ).OSCTempCalc );
+				if ( OSC( OPtr ).MaxLimitPresent ) OSC( OPtr ).OSCTempCalc = min( OSC( OPtr ).MaxTempLimit, OSC( OPtr ).OSCTempCalc );
 
-			if ( OSC( OPtr ).ConstTempScheduleIndex != 0 ) { // Determine outside temperature from schedule
-				OSC( OPtr ).ConstTemp = GetCurrentScheduleValue( OSC( OPtr ).ConstTempScheduleIndex );
-			}
+				TempExt = OSC( OPtr ).OSCTempCalc;
 
-			HcExtSurf( SurfNum ) = OSC( OPtr ).SurfFilmCoef;
+				// Set the only radiant system heat balance coefficient that is non-zero for this case
+				if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
 
-			OSC( OPtr ).OSCTempCalc = ( OSC( OPtr ).ZoneAirTempCoef * MAT( ZoneNum ) + OSC( OPtr ).ExtDryBulbCoef * Surface( SurfNum ).OutDryBulbTemp + OSC( OPtr ).ConstTempCoef * OSC( OPtr ).ConstTemp + OSC( OPtr ).GroundTempCoef * GroundTemp + OSC( OPtr ).WindSpeedCoef * Surface( SurfNum ).WindSpeed * Surface( SurfNum ).OutDryBulbTemp + OSC( OPtr ).TPreviousCoef * OSC( OPtr ).TOutsideSurfPast );
+				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					// Set variables used in the FD moisture balance and HAMT
+					TempOutsideAirFD( SurfNum ) = TempExt;
+					RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
+					HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
+					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOtherSideCoefCalcExt ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+					HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
+					HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
+					HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
+				}
 
-			// Enforce max/min limits if applicable
-			if ( OSC( OPtr ).MinLimitPresent ) OSC( OPtr ).OSCTempCalc = max( OSC( OPtr ).MinTempLimit, OSC( OPtr ).OSCTempCalc );
-			if ( OSC( OPtr ).MaxLimitPresent ) OSC( OPtr ).OSCTempCalc = min( OSC( OPtr ).MaxTempLimit, OSC( OPtr ).OSCTempCalc );
+				// Call the outside surface temp calculation and pass the necessary terms
+				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
 
-			TempExt = OSC( OPtr ).OSCTempCalc;
+				// This ends the calculations for this surface and goes on to the next SurfNum
 
-			// Set the only radiant system heat balance coefficient that is non-zero for this case
-			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
+			} else if ( SELECT_CASE_var == OtherSideCondModeledExt ) { // A surface with other side conditions determined from seperate, dynamic component
+				//                               modeling that defines the "outside environment"
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-				// Set variables used in the FD moisture balance and HAMT
-				TempOutsideAirFD( SurfNum ) = TempExt;
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
-				HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOtherSideCoefCalcExt ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-				HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
-				HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
-				HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
-			}
+				// First, set up the outside convection coefficient and the exterior temperature
+				// boundary condition for the surface
+				OPtr = Surface( SurfNum ).OSCMPtr;
+				// EMS overrides
+				if ( OSCM( OPtr ).EMSOverrideOnTConv ) OSCM( OPtr ).TConv = OSCM( OPtr ).EMSOverrideTConvValue;
+				if ( OSCM( OPtr ).EMSOverrideOnHConv ) OSCM( OPtr ).HConv = OSCM( OPtr ).EMSOverrideHConvValue;
+				if ( OSCM( OPtr ).EMSOverrideOnTRad ) OSCM( OPtr ).TRad = OSCM( OPtr ).EMSOverrideTRadValue;
+				if ( OSCM( OPtr ).EMSOverrideOnHrad ) OSCM( OPtr ).HRad = OSCM( OPtr ).EMSOverrideHradValue;
+				HcExtSurf( SurfNum ) = OSCM( OPtr ).HConv;
 
-			// Call the outside surface temp calculation and pass the necessary terms
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
-
-			// This ends the calculations for this surface and goes on to the next SurfNum
-
-		} else if ( SELECT_CASE_var == OtherSideCondModeledExt ) { // A surface with other side conditions determined from seperate, dynamic component
-			//                               modeling that defines the "outside environment"
-
-			// First, set up the outside convection coefficient and the exterior temperature
-			// boundary condition for the surface
-			OPtr = Surface( SurfNum ).OSCMPtr;
-			// EMS overrides
-			if ( OSCM( OPtr ).EMSOverrideOnTConv ) OSCM( OPtr ).TConv = OSCM( OPtr ).EMSOverrideTConvValue;
-			if ( OSCM( OPtr ).EMSOverrideOnHConv ) OSCM( OPtr ).HConv = OSCM( OPtr ).EMSOverrideHConvValue;
-			if ( OSCM( OPtr ).EMSOverrideOnTRad ) OSCM( OPtr ).TRad = OSCM( OPtr ).EMSOverrideTRadValue;
-			if ( OSCM( OPtr ).EMSOverrideOnHrad ) OSCM( OPtr ).HRad = OSCM( OPtr ).EMSOverrideHradValue;
-			HcExtSurf( SurfNum ) = OSCM( OPtr ).HConv;
-
-			TempExt = OSCM( OPtr ).TConv;
-
-			// Set the only radiant system heat balance coefficient that is non-zero for this case
-			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
-
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-				// Set variables used in the FD moisture balance and HAMT
-				TempOutsideAirFD( SurfNum ) = TempExt;
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
-				HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOSCM ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-				HSkyFD( SurfNum ) = OSCM( OPtr ).HRad; //CR 8046, use sky term for surface to baffle IR
-				HGrndFD( SurfNum ) = 0.0; //CR 8046, null out and use only sky term for surface to baffle IR
-				HAirFD( SurfNum ) = 0.0; //CR 8046, null out and use only sky term for surface to baffle IR
-			}
+				TempExt = OSCM( OPtr ).TConv;
 
-			// Call the outside surface temp calculation and pass the necessary terms
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+				// Set the only radiant system heat balance coefficient that is non-zero for this case
+				if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
 
-				if ( Surface( SurfNum ).ExtCavityPresent ) {
-					CalcExteriorVentedCavity( SurfNum );
+				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					// Set variables used in the FD moisture balance and HAMT
+					TempOutsideAirFD( SurfNum ) = TempExt;
+					RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
+					HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
+					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOSCM ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+					HSkyFD( SurfNum ) = OSCM( OPtr ).HRad; //CR 8046, use sky term for surface to baffle IR
+					HGrndFD( SurfNum ) = 0.0; //CR 8046, null out and use only sky term for surface to baffle IR
+					HAirFD( SurfNum ) = 0.0; //CR 8046, null out and use only sky term for surface to baffle IR
 				}
 
-				CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
-			} else if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-				if ( Surface( SurfNum ).ExtCavityPresent ) {
-					CalcExteriorVentedCavity( SurfNum );
+				// Call the outside surface temp calculation and pass the necessary terms
+				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+
+					if ( Surface( SurfNum ).ExtCavityPresent ) {
+						CalcExteriorVentedCavity( SurfNum );
+					}
+
+					CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
+				} else if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					if ( Surface( SurfNum ).ExtCavityPresent ) {
+						CalcExteriorVentedCavity( SurfNum );
+					}
 				}
-			}
 
-			// This ends the calculations for this surface and goes on to the next SurfNum
-		} else if ( SELECT_CASE_var == ExternalEnvironment ) {
+				// This ends the calculations for this surface and goes on to the next SurfNum
+			} else if ( SELECT_CASE_var == ExternalEnvironment ) {
 
-			//checking the EcoRoof presented in the external environment
-			// recompute each load by calling ecoroof
+				//checking the EcoRoof presented in the external environment
+				// recompute each load by calling ecoroof
 
-			if ( Surface( SurfNum ).ExtEcoRoof ) {
-				CalcEcoRoof( SurfNum, ZoneNum, ConstrNum, TempExt );
-				continue;
-			}
+				if ( Surface( SurfNum ).ExtEcoRoof ) {
+					CalcEcoRoof( SurfNum, ZoneNum, ConstrNum, TempExt );
+					continue;
+				}
 
-			if ( SurfaceWindow( SurfNum ).StormWinFlag == 1 ) ConstrNum = Surface( SurfNum ).StormWinConstruction;
-			RoughSurf = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).Roughness;
-			AbsThermSurf = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).AbsorpThermal;
+				if ( SurfaceWindow( SurfNum ).StormWinFlag == 1 ) ConstrNum = Surface( SurfNum ).StormWinConstruction;
+				RoughSurf = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).Roughness;
+				AbsThermSurf = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).AbsorpThermal;
 
-			// Check for outside movable insulation
-			if ( Surface( SurfNum ).MaterialMovInsulExt > 0 ) EvalOutsideMovableInsulation( SurfNum, HMovInsul, RoughSurf, AbsThermSurf );
+				// Check for outside movable insulation
+				if ( Surface( SurfNum ).MaterialMovInsulExt > 0 ) EvalOutsideMovableInsulation( SurfNum, HMovInsul, RoughSurf, AbsThermSurf );
 
-			// Check for exposure to wind (exterior environment)
-			if ( Surface( SurfNum ).ExtWind ) {
+				// Check for exposure to wind (exterior environment)
+				if ( Surface( SurfNum ).ExtWind ) {
 
-				// Calculate exterior heat transfer coefficients with windspeed (windspeed is calculated internally in subroutine)
-				InitExteriorConvectionCoeff( SurfNum, HMovInsul, RoughSurf, AbsThermSurf, TH( SurfNum, 1, 1 ), HcExtSurf( SurfNum ), HSkyExtSurf( SurfNum ), HGrdExtSurf( SurfNum ), HAirExtSurf( SurfNum ) );
+					// Calculate exterior heat transfer coefficients with windspeed (windspeed is calculated internally in subroutine)
+					InitExteriorConvectionCoeff( SurfNum, HMovInsul, RoughSurf, AbsThermSurf, TH( SurfNum, 1, 1 ), HcExtSurf( SurfNum ), HSkyExtSurf( SurfNum ), HGrdExtSurf( SurfNum ), HAirExtSurf( SurfNum ) );
 
-				if ( IsRain ) { // Raining: since wind exposed, outside surface gets wet
+					if ( IsRain ) { // Raining: since wind exposed, outside surface gets wet
 
-					if ( Surface( SurfNum ).ExtConvCoeff <= 0 ) { // Reset HcExtSurf because of wetness
-						HcExtSurf( SurfNum ) = 1000.0;
-					} else { // User set
-						HcExtSurf( SurfNum ) = SetExtConvectionCoeff( SurfNum );
-					}
+						if ( Surface( SurfNum ).ExtConvCoeff <= 0 ) { // Reset HcExtSurf because of wetness
+							HcExtSurf( SurfNum ) = 1000.0;
+						} else { // User set
+							HcExtSurf( SurfNum ) = SetExtConvectionCoeff( SurfNum );
+						}
 
-					TempExt = Surface( SurfNum ).OutWetBulbTemp;
+						TempExt = Surface( SurfNum ).OutWetBulbTemp;
+
+						// start HAMT
+						if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+							// Set variables used in the HAMT moisture balance
+							TempOutsideAirFD( SurfNum ) = TempExt;
+							RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( TempOutsideAirFD( SurfNum ), 1.0, HBSurfManRainHAMT );
+							HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
+							HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameExtEnvWetSurf ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+							HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
+							HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
+							HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
+						}
+						// end HAMT
+
+						if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+							// Set variables used in the FD moisture balance
+							TempOutsideAirFD( SurfNum ) = TempExt;
+							RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( TempOutsideAirFD( SurfNum ), 1.0 );
+							HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
+							HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameExtEnvWetSurf ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+							HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
+							HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
+							HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
+						}
 
-					// start HAMT
-					if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-						// Set variables used in the HAMT moisture balance
-						TempOutsideAirFD( SurfNum ) = TempExt;
-						RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( TempOutsideAirFD( SurfNum ), 1.0, HBSurfManRainHAMT );
-						HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
-						HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameExtEnvWetSurf ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-						HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
-						HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
-						HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
-					}
-					// end HAMT
+					} else { // Surface is dry, use the normal correlation
+
+						TempExt = Surface( SurfNum ).OutDryBulbTemp;
+
+						if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+							// Set variables used in the FD moisture balance and HAMT
+							TempOutsideAirFD( SurfNum ) = TempExt;
+							RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
+							HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
+							HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameExtEnvDrySurf ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+							//  check for saturation conditions of air
+							RhoVaporSat = PsyRhovFnTdbRh( TempOutsideAirFD( SurfNum ), 1.0, HBSurfManDrySurfCondFD );
+							if ( RhoVaporAirOut( SurfNum ) > RhoVaporSat ) RhoVaporAirOut( SurfNum ) = RhoVaporSat;
+							HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
+							HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
+							HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
+						}
 
-					if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
-						// Set variables used in the FD moisture balance
-						TempOutsideAirFD( SurfNum ) = TempExt;
-						RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( TempOutsideAirFD( SurfNum ), 1.0 );
-						HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
-						HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameExtEnvWetSurf ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-						HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
-						HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
-						HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
 					}
 
-				} else { // Surface is dry, use the normal correlation
+				} else { // No wind
+
+					// Calculate exterior heat transfer coefficients for windspeed = 0
+					InitExteriorConvectionCoeff( SurfNum, HMovInsul, RoughSurf, AbsThermSurf, TH( SurfNum, 1, 1 ), HcExtSurf( SurfNum ), HSkyExtSurf( SurfNum ), HGrdExtSurf( SurfNum ), HAirExtSurf( SurfNum ) );
 
 					TempExt = Surface( SurfNum ).OutDryBulbTemp;
 
@@ -4670,10 +4809,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 						TempOutsideAirFD( SurfNum ) = TempExt;
 						RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
 						HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
-						HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameExtEnvDrySurf ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-						//  check for saturation conditions of air
-						RhoVaporSat = PsyRhovFnTdbRh( TempOutsideAirFD( SurfNum ), 1.0, HBSurfManDrySurfCondFD );
-						if ( RhoVaporAirOut( SurfNum ) > RhoVaporSat ) RhoVaporAirOut( SurfNum ) = RhoVaporSat;
+						HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameNoWind ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
 						HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
 						HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
 						HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
@@ -4681,81 +4817,62 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 				}
 
-			} else { // No wind
+				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
 
-				// Calculate exterior heat transfer coefficients for windspeed = 0
-				InitExteriorConvectionCoeff( SurfNum, HMovInsul, RoughSurf, AbsThermSurf, TH( SurfNum, 1, 1 ), HcExtSurf( SurfNum ), HSkyExtSurf( SurfNum ), HGrdExtSurf( SurfNum ), HAirExtSurf( SurfNum ) );
+			} else { // for interior or other zone surfaces
 
-				TempExt = Surface( SurfNum ).OutDryBulbTemp;
+				if ( Surface( SurfNum ).ExtBoundCond == SurfNum ) { // Regular partition/internal mass
 
-				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-					// Set variables used in the FD moisture balance and HAMT
-					TempOutsideAirFD( SurfNum ) = TempExt;
-					RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
-					HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
-					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameNoWind ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-					HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
-					HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
-					HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
-				}
+					TH( SurfNum, 1, 1 ) = TempSurfIn( SurfNum );
 
-			}
+					// No need to set any radiant system heat balance coefficients here--will be done during inside heat balance
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
+					if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+						// Set variables used in the FD moisture balance HAMT
+						TempOutsideAirFD( SurfNum ) = TempSurfIn( SurfNum );
+						RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( SurfNum );
+						HConvExtFD( SurfNum ) = HConvIn( SurfNum );
+						HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOther ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+						HSkyFD( SurfNum ) = 0.0;
+						HGrndFD( SurfNum ) = 0.0;
+						HAirFD( SurfNum ) = 0.0;
+					}
 
-		} else { // for interior or other zone surfaces
+				} else { // Interzone partition
 
-			if ( Surface( SurfNum ).ExtBoundCond == SurfNum ) { // Regular partition/internal mass
+					TH( SurfNum, 1, 1 ) = TH( Surface( SurfNum ).ExtBoundCond, 1, 2 );
 
-				TH( SurfNum, 1, 1 ) = TempSurfIn( SurfNum );
+					// No need to set any radiant system heat balance coefficients here--will be done during inside heat balance
 
-				// No need to set any radiant system heat balance coefficients here--will be done during inside heat balance
+					if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+						// Set variables used in the FD moisture balance and HAMT
+						TempOutsideAirFD( SurfNum ) = TH( Surface( SurfNum ).ExtBoundCond, 1, 2 );
+						RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( Surface( SurfNum ).ExtBoundCond );
+						HConvExtFD( SurfNum ) = HConvIn( Surface( SurfNum ).ExtBoundCond );
+						HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameIZPart ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+						HSkyFD( SurfNum ) = 0.0;
+						HGrndFD( SurfNum ) = 0.0;
+						HAirFD( SurfNum ) = 0.0;
+					}
 
-				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-					// Set variables used in the FD moisture balance HAMT
-					TempOutsideAirFD( SurfNum ) = TempSurfIn( SurfNum );
-					RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( SurfNum );
-					HConvExtFD( SurfNum ) = HConvIn( SurfNum );
-					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOther ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-					HSkyFD( SurfNum ) = 0.0;
-					HGrndFD( SurfNum ) = 0.0;
-					HAirFD( SurfNum ) = 0.0;
 				}
 
-			} else { // Interzone partition
-
-				TH( SurfNum, 1, 1 ) = TH( Surface( SurfNum ).ExtBoundCond, 1, 2 );
+				// This ends the calculations for this surface and goes on to the next SurfNum
+			}}
 
-				// No need to set any radiant system heat balance coefficients here--will be done during inside heat balance
-
-				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-					// Set variables used in the FD moisture balance and HAMT
-					TempOutsideAirFD( SurfNum ) = TH( Surface( SurfNum ).ExtBoundCond, 1, 2 );
-					RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( Surface( SurfNum ).ExtBoundCond );
-					HConvExtFD( SurfNum ) = HConvIn( Surface( SurfNum ).ExtBoundCond );
-					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameIZPart ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-					HSkyFD( SurfNum ) = 0.0;
-					HGrndFD( SurfNum ) = 0.0;
-					HAirFD( SurfNum ) = 0.0;
-				}
+			//fill in reporting values for outside face
+			QdotConvOutRep( SurfNum ) = -Surface( SurfNum ).Area * HcExtSurf( SurfNum ) * ( TH( SurfNum, 1, 1 ) - Surface( SurfNum ).OutDryBulbTemp );
 
+			if ( Surface( SurfNum ).OSCMPtr > 0 ) { //Optr is set above in this case, use OSCM boundary data
+				QdotConvOutRepPerArea( SurfNum ) = -OSCM( OPtr ).HConv * ( TH( SurfNum, 1, 1 ) - OSCM( OPtr ).TConv );
+			} else {
+				QdotConvOutRepPerArea( SurfNum ) = -HcExtSurf( SurfNum ) * ( TH( SurfNum, 1, 1 ) - Surface( SurfNum ).OutDryBulbTemp );
 			}
 
-			// This ends the calculations for this surface and goes on to the next SurfNum
-		}}
-
-		//fill in reporting values for outside face
-		QdotConvOutRep( SurfNum ) = -Surface( SurfNum ).Area * HcExtSurf( SurfNum ) * ( TH( SurfNum, 1, 1 ) - Surface( SurfNum ).OutDryBulbTemp );
-
-		if ( Surface( SurfNum ).OSCMPtr > 0 ) { //Optr is set above in this case, use OSCM boundary data
-			QdotConvOutRepPerArea( SurfNum ) = -OSCM( OPtr ).HConv * ( TH( SurfNum, 1, 1 ) - OSCM( OPtr ).TConv );
-		} else {
-			QdotConvOutRepPerArea( SurfNum ) = -HcExtSurf( SurfNum ) * ( TH( SurfNum, 1, 1 ) - Surface( SurfNum ).OutDryBulbTemp );
-		}
-
-		QConvOutReport( SurfNum ) = QdotConvOutRep( SurfNum ) * TimeStepZoneSec;
+			QConvOutReport( SurfNum ) = QdotConvOutRep( SurfNum ) * TimeStepZoneSec;
 
-	} // ...end of DO loop over all surface (actually heat transfer surfaces)
+		} // ...end of DO loop over all surface (actually heat transfer surfaces)
+	}
 
 }
 
@@ -4836,6 +4953,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	using DataZoneEquipment::ZoneEquipConfig;
 	using DataLoopNode::Node;
 	using HeatBalanceSurfaceManager::CalculateZoneMRT;
+	using HeatBalanceSurfaceManager::InsideSurfGroups;
 	using namespace Psychrometrics;
 	using OutputReportTabular::loadConvectedNormal;
 	using OutputReportTabular::loadConvectedWithPulse;
@@ -4871,32 +4989,22 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	Real64 AbsInt; // Solar absorptance of inside movable insulation
-	int ConstrNum; // Construction index for the current surface
 	bool Converged; // .TRUE. if inside heat balance has converged
-	Real64 F1; // Intermediate calculation value
-	Real64 HMovInsul; // "Convection" coefficient of movable insulation
 	Real64 MaxDelTemp; // Maximum change in surface temperature for any
 	//  opaque surface from one iteration to the next
 	int SurfNum; // Surface number
 	int ZoneNum; // Zone number the current surface is attached to
-	int ConstrNumSh; // Shaded construction number for a window
-	int RoughSurf; // Outside surface roughness
-	Real64 EmisOut; // Glass outside surface emissivity
 
 	static FArray1D< Real64 > TempInsOld; // Holds previous iteration's value for convergence check
+	static FArray1D< Real64 > TempInsOlder; // Holds the value of the iteration before that for extrapolation
+	static std::vector< std::vector< int > > ExtrapolatedSurfs; // Surfaces of each zone whose temperatures may be extrapolated
+	int ItersSinceMapChange; // Iterations done since the convection coefficients were reevaluated or temperatures extrapolated
 	Real64 RhoVaporSat; // Local temporary saturated vapor density for checking
-	Real64 TempSurfOutTmp; // Local Temporary Surface temperature for the outside surface face
-	Real64 TempSurfInSat; // Local temperary surface dew point temperature
 	static bool firstTime( true ); // Used for trapping errors or other problems
-	int OtherSideSurfNum; // Surface number index for other side of an interzone partition
 	static int MinIterations; // Minimum number of iterations for the inside heat balance
 	//  CHARACTER(len=25):: ErrMsg
 	//  CHARACTER(len=5) :: TimeStmp
 	static int ErrCount( 0 );
-	int PipeNum; // TDD pipe object number
-	int SurfNum2; // TDD:DIFFUSER object number
-	Real64 Ueff; // 1 / effective R value between TDD:DOME and TDD:DIFFUSER
 
 	int ZoneEquipConfigNum;
 	//  LOGICAL           :: ControlledZoneAirFlag
@@ -4907,19 +5015,22 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	Real64 NodeTemp;
 	Real64 CpAir;
 	static FArray1D< Real64 > RefAirTemp; // reference air temperatures
+	static FArray1D< Real64 > ZoneRhoVaporAirIn; // Vapor density of the zone air, limited to saturation
+	static FArray1D< Real64 > ZoneMassConvInDiv; // Zone air (density + vapor density) * specific heat
 	static bool MyEnvrnFlag( true );
 	//  LOGICAL, SAVE     :: DoThisLoop
 	static int InsideSurfErrCount( 0 );
 	Real64 Wsurf; // Moisture ratio for HAMT
 	Real64 RhoAirZone; // Zone moisture density for HAMT
-	int OtherSideZoneNum; // Zone Number index for other side of an interzone partition HAMT
 	static int WarmupSurfTemp;
-	static int TimeStepInDay( 0 ); // time step number
 
 	// FLOW:
 	if ( firstTime ) {
 		TempInsOld.allocate( TotSurfaces );
 		RefAirTemp.allocate( TotSurfaces );
+		ZoneRhoVaporAirIn.allocate( NumOfZones );
+		ZoneMassConvInDiv.allocate( NumOfZones );
+		if ( InsideSurfGroups.empty() ) FindSurfHeatBalGroups();
 		if ( any_eq( HeatTransferAlgosUsed, UseEMPD ) ) {
 			MinIterations = MinEMPDIterations;
 		} else {
@@ -4928,6 +5039,26 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		if ( DisplayAdvancedReportVariables ) {
 			SetupOutputVariable( "Surface Inside Face Heat Balance Calculation Iteration Count []", InsideSurfIterations, "ZONE", "Sum", "Simulation" );
 		}
+		if ( InsideSurfIterExtrapolation ) {
+			// Only zones whose opaque surfaces are all plain CTF surfaces are extrapolated: the other algorithms
+			// keep internal states (nodes, moisture) that a jump in the face temperature would not carry along
+			TempInsOlder.allocate( TotSurfaces );
+			ExtrapolatedSurfs.resize( NumOfZones + 1 );
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				auto & zoneSurfs( ExtrapolatedSurfs[ ZoneNum ] );
+				for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+					auto const & surface( Surface( SurfNum ) );
+					if ( ! surface.HeatTransSurf ) continue;
+					if ( surface.Class == SurfaceClass_Window || surface.Class == SurfaceClass_TDD_Dome || surface.Class == SurfaceClass_TDD_Diffuser ) continue;
+					if ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) {
+						zoneSurfs.clear();
+						break;
+					}
+					if ( surface.IsPool || surface.MaterialMovInsulInt > 0 ) continue;
+					zoneSurfs.push_back( SurfNum );
+				}
+			}
+		}
 	}
 	if ( BeginEnvrnFlag && MyEnvrnFlag ) {
 		TempInsOld = 23.0;
@@ -5056,10 +5187,21 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		}
 	}
 
+	// Inside face moisture transfer conditions of each zone, checking for saturation of the air.  The
+	// psychrometric functions keep caches of their last results, so they are not called per surface.
+	for ( int iZone = 1; iZone <= NumOfZones; ++iZone ) {
+		Real64 const MAT_zone( MAT( iZone ) );
+		Real64 const ZoneAirHumRat_zone( max( ZoneAirHumRat( iZone ), 1.0e-5 ) );
+		ZoneRhoVaporAirIn( iZone ) = min( PsyRhovFnTdbWPb_fast( MAT_zone, ZoneAirHumRat_zone, OutBaroPress ), PsyRhovFnTdbRh( MAT_zone, 1.0, HBSurfManInsideSurf ) );
+		ZoneMassConvInDiv( iZone ) = ( PsyRhoAirFnPbTdbW_fast( OutBaroPress, MAT_zone, ZoneAirHumRat_zone ) + ZoneRhoVaporAirIn( iZone ) ) * PsyCpAirFnWTdb_fast( ZoneAirHumRat_zone, MAT_zone );
+	}
+
 	bool const useCondFDHTalg( any_eq( HeatTransferAlgosUsed, UseCondFD ) );
+	ItersSinceMapChange = -1; // Windows are only calculated in the first iteration
 	Converged = false;
 	while ( ! Converged ) { // Start of main inside heat balance DO loop...
 
+		if ( InsideSurfIterExtrapolation ) TempInsOlder = TempInsOld;
 		TempInsOld = TempSurfIn; // Keep track of last iteration's temperature values
 
 		CalcInteriorRadExchange( TempSurfIn, InsideSurfIterations, NetLWRadToSurf, ZoneToResimulate, Inside ); // Update the radiation balance
@@ -5072,333 +5214,365 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		// times before the iteration limit is hit.
 		if ( ( InsideSurfIterations > 0 ) && ( mod( InsideSurfIterations, ItersReevalConvCoeff ) == 0 ) ) {
 			InitInteriorConvectionCoeffs( TempSurfIn, ZoneToResimulate );
+			ItersSinceMapChange = 0;
 		}
 
-		for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) { // Perform a heat balance on all of the relevant inside surfaces...
-			SurfNum = SurfToResimulate[ iSurfToResimulate ];
-			auto & surface( Surface( SurfNum ) );
-			if ( ! surface.HeatTransSurf ) continue; // Skip non-heat transfer surfaces
-			if ( surface.Class == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
-			if ( ( ZoneNum = surface.Zone ) == 0 ) continue; // Skip non-heat transfer surfaces
-
-			Real64 & TH11( TH( SurfNum, 1, 1 )  );
-			Real64 & TH12( TH( SurfNum, 1, 2 )  );
-			Real64 & TH22( TH( SurfNum, 2, 2 )  );
-
-			ConstrNum = surface.Construction;
-			auto const & construct( Construct( ConstrNum ) );
-			Real64 const MAT_zone( MAT( ZoneNum ) );
-			Real64 const ZoneAirHumRat_zone( max( ZoneAirHumRat( ZoneNum ), 1.0e-5 ) );
-
-			// Calculate the inside surface moisture quantities
-			// calculate the inside surface moisture transfer conditions
-			// check for saturation conditions of air
-			Real64 const HConvIn_surf( HConvInFD( SurfNum ) = HConvIn( SurfNum ) );
-			RhoVaporAirIn( SurfNum ) = min( PsyRhovFnTdbWPb_fast( MAT_zone, ZoneAirHumRat_zone, OutBaroPress ), PsyRhovFnTdbRh( MAT_zone, 1.0, HBSurfManInsideSurf ) );
-			HMassConvInFD( SurfNum ) = HConvIn_surf / ( ( PsyRhoAirFnPbTdbW_fast( OutBaroPress, MAT_zone, ZoneAirHumRat_zone ) + RhoVaporAirIn( SurfNum ) ) * PsyCpAirFnWTdb_fast( ZoneAirHumRat_zone, MAT_zone ) );
-
-			// Perform heat balance on the inside face of the surface ...
-			// The following are possibilities here:
-			//   (a) the surface is a pool (no movable insulation, no source/sink, only CTF solution algorithm)
-			//   (b) the surface is a partition, in which case the temperature of both sides are the same
-			//   (c) standard (or interzone) opaque surface with no movable insulation, normal heat balance equation
-			//   (d) standard (or interzone) window: call to CalcWindowHeatBalance to get window layer temperatures
-			//   (e) standard opaque surface with movable insulation, special two-part equation
-			// In the surface calculation there are the following Algorithm types for opaque surfaces that
-			// do not have movable insulation:
-			//   (a) the regular CTF calc (SolutionAlgo = UseCTF)
-			//   (b) the EMPD calc (Solutionalgo = UseEMPD)
-			//   (c) the CondFD calc (SolutionAlgo = UseCondFD)
-			//   (d) the HAMT calc (solutionalgo = UseHAMT).
-
-			auto & zone( Zone( ZoneNum ) );
-			if ( surface.ExtBoundCond == SurfNum && surface.Class != SurfaceClass_Window ) {
-				//CR6869 -- let Window HB take care of it      IF (Surface(SurfNum)%ExtBoundCond == SurfNum) THEN
-				// Surface is a partition
-				if ( surface.HeatTransferAlgorithm == HeatTransferModel_CTF || surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) { // Regular CTF Surface and/or EMPD surface
-
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
-						CalcMoistureBalanceEMPD( SurfNum, TempSurfInTmp( SurfNum ), TH22, MAT_zone, TempSurfInSat );
-					}
-					//Pre-calculate a few terms
-					Real64 const TempTerm( CTFConstInPart( SurfNum ) + QRadThermInAbs( SurfNum ) + QRadSWInAbs( SurfNum ) + HConvIn_surf * RefAirTemp( SurfNum ) + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) + NetLWRadToSurf( SurfNum ) );
-					Real64 const TempDiv( 1.0 / ( construct.CTFInside( 0 ) - construct.CTFCross( 0 ) + HConvIn_surf + IterDampConst ) );
-					// Calculate the current inside surface temperature
-					if ( ( ! surface.IsPool ) || ( ( surface.IsPool ) && ( abs( QPoolSurfNumerator( SurfNum ) ) < SmallNumber ) && ( abs( PoolHeatTransCoefs( SurfNum ) ) < SmallNumber ) ) ) {
-						TempSurfInTmp( SurfNum ) = ( TempTerm + construct.CTFSourceIn( 0 ) * QsrcHist( 1, SurfNum ) + IterDampConst * TempInsOld( SurfNum ) ) * TempDiv; // Constant portion of conduction eq (history terms) | LW radiation from internal sources | SW radiation from internal sources | Convection from surface to zone air | Net radiant exchange with other zone surfaces | Heat source/sink term for radiant systems | (if there is one present) | Radiant flux from a high temperature radiant heater | Radiant flux from a hot water baseboard heater | Radiant flux from a steam baseboard heater | Radiant flux from an electric baseboard heater | Iterative damping term (for stability) | Conduction term (both partition sides same temp) | Conduction term (both partition sides same temp) | Convection and damping term
-					} else { // this is a pool and it has been simulated this time step
-						TempSurfInTmp( SurfNum ) = ( CTFConstInPart( SurfNum ) + QPoolSurfNumerator( SurfNum ) + IterDampConst * TempInsOld( SurfNum ) ) / ( construct.CTFInside( 0 ) - construct.CTFCross( 0 ) + PoolHeatTransCoefs( SurfNum ) + IterDampConst ); // Constant part of conduction eq (history terms) | Pool modified terms (see non-pool equation for details) | Iterative damping term (for stability) | Conduction term (both partition sides same temp) | Pool and damping term
-					}
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
-						TempSurfInTmp( SurfNum ) -= MoistEMPDFlux( SurfNum ) * TempDiv; // Conduction term (both partition sides same temp) | Conduction term (both partition sides same temp) | Convection and damping term
-						if ( TempSurfInSat > TempSurfInTmp( SurfNum ) ) {
-							TempSurfInTmp( SurfNum ) = TempSurfInSat; // Surface temp cannot be below dew point
+		// The first group holds the surfaces whose models keep shared state, done in surface order; the other
+		// groups are zones joined by interzone partitions and run in parallel (see FindSurfHeatBalGroups)
+		int const NumSurfGroups( PartialResimulate ? 1 : InsideSurfGroups.size() );
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) if ( NumSurfGroups > 1 )
+#endif
+		for ( int Group = 0; Group < NumSurfGroups; ++Group ) {
+			std::vector< int > const & GroupSurfs( PartialResimulate ? SurfToResimulate : InsideSurfGroups[ Group ] );
+			for ( int const SurfNum : GroupSurfs ) { // Perform a heat balance on all of the relevant inside surfaces...
+				auto & surface( Surface( SurfNum ) );
+				if ( ! surface.HeatTransSurf ) continue; // Skip non-heat transfer surfaces
+				if ( surface.Class == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
+				int ZoneNum( surface.Zone ); // Zone number the current surface is attached to
+				if ( ZoneNum == 0 ) continue; // Skip non-heat transfer surfaces
+
+				Real64 AbsInt; // Solar absorptance of inside movable insulation
+				Real64 F1; // Intermediate calculation value
+				Real64 HMovInsul; // "Convection" coefficient of movable insulation
+				int ConstrNumSh; // Shaded construction number for a window
+				int RoughSurf; // Outside surface roughness
+				Real64 EmisOut; // Glass outside surface emissivity
+				Real64 TempSurfOutTmp; // Local Temporary Surface temperature for the outside surface face
+				Real64 TempSurfInSat; // Local temperary surface dew point temperature
+				int OtherSideSurfNum; // Surface number index for other side of an interzone partition
+				int OtherSideZoneNum; // Zone Number index for other side of an interzone partition HAMT
+				int PipeNum; // TDD pipe object number
+				int SurfNum2( 0 ); // TDD:DIFFUSER object number
+				Real64 Ueff; // 1 / effective R value between TDD:DOME and TDD:DIFFUSER
+
+				Real64 & TH11( TH( SurfNum, 1, 1 )  );
+				Real64 & TH12( TH( SurfNum, 1, 2 )  );
+				Real64 const TH22( CTFHistTIn( CTFHistHead( SurfNum ), SurfNum ) ); // Inside surface temperature at the previous time step
+
+				int ConstrNum( surface.Construction ); // Construction index for the current surface
+				auto const & construct( Construct( ConstrNum ) );
+				Real64 const MAT_zone( MAT( ZoneNum ) );
+
+				// Calculate the inside surface moisture quantities
+				// calculate the inside surface moisture transfer conditions
+				Real64 const HConvIn_surf( HConvInFD( SurfNum ) = HConvIn( SurfNum ) );
+				RhoVaporAirIn( SurfNum ) = ZoneRhoVaporAirIn( ZoneNum );
+				HMassConvInFD( SurfNum ) = HConvIn_surf / ZoneMassConvInDiv( ZoneNum );
+
+				// Perform heat balance on the inside face of the surface ...
+				// The following are possibilities here:
+				//   (a) the surface is a pool (no movable insulation, no source/sink, only CTF solution algorithm)
+				//   (b) the surface is a partition, in which case the temperature of both sides are the same
+				//   (c) standard (or interzone) opaque surface with no movable insulation, normal heat balance equation
+				//   (d) standard (or interzone) window: call to CalcWindowHeatBalance to get window layer temperatures
+				//   (e) standard opaque surface with movable insulation, special two-part equation
+				// In the surface calculation there are the following Algorithm types for opaque surfaces that
+				// do not have movable insulation:
+				//   (a) the regular CTF calc (SolutionAlgo = UseCTF)
+				//   (b) the EMPD calc (Solutionalgo = UseEMPD)
+				//   (c) the CondFD calc (SolutionAlgo = UseCondFD)
+				//   (d) the HAMT calc (solutionalgo = UseHAMT).
+
+				if ( surface.ExtBoundCond == SurfNum && surface.Class != SurfaceClass_Window ) {
+					//CR6869 -- let Window HB take care of it      IF (Surface(SurfNum)%ExtBoundCond == SurfNum) THEN
+					// Surface is a partition
+					if ( surface.HeatTransferAlgorithm == HeatTransferModel_CTF || surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) { // Regular CTF Surface and/or EMPD surface
+
+						if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+							CalcMoistureBalanceEMPD( SurfNum, TempSurfInTmp( SurfNum ), TH22, MAT_zone, TempSurfInSat );
 						}
-					}
-					// if any mixed heat transfer models in zone, apply limits to CTF result
-					if ( any_surface_ConFD_or_HAMT( ZoneNum ) ) TempSurfInTmp( SurfNum ) = max( MinSurfaceTempLimit, min( MaxSurfaceTempLimit, TempSurfInTmp( SurfNum ) ) ); // Limit Check //Tuned Precomputed condition to eliminate loop
+						//Pre-calculate a few terms
+						Real64 const TempTerm( CTFConstInPart( SurfNum ) + QRadThermInAbs( SurfNum ) + QRadSWInAbs( SurfNum ) + HConvIn_surf * RefAirTemp( SurfNum ) + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) + NetLWRadToSurf( SurfNum ) );
+						Real64 const TempDiv( 1.0 / ( construct.CTFInside( 0 ) - construct.CTFCross( 0 ) + HConvIn_surf + IterDampConst ) );
+						// Calculate the current inside surface temperature
+						if ( ( ! surface.IsPool ) || ( ( surface.IsPool ) && ( abs( QPoolSurfNumerator( SurfNum ) ) < SmallNumber ) && ( abs( PoolHeatTransCoefs( SurfNum ) ) < SmallNumber ) ) ) {
+							TempSurfInTmp( SurfNum ) = ( TempTerm + construct.CTFSourceIn( 0 ) * QsrcHist( 1, SurfNum ) + IterDampConst * TempInsOld( SurfNum ) ) * TempDiv; // Constant portion of conduction eq (history terms) | LW radiation from internal sources | SW radiation from internal sources | Convection from surface to zone air | Net radiant exchange with other zone surfaces | Heat source/sink term for radiant systems | (if there is one present) | Radiant flux from a high temperature radiant heater | Radiant flux from a hot water baseboard heater | Radiant flux from a steam baseboard heater | Radiant flux from an electric baseboard heater | Iterative damping term (for stability) | Conduction term (both partition sides same temp) | Conduction term (both partition sides same temp) | Convection and damping term
+						} else { // this is a pool and it has been simulated this time step
+							TempSurfInTmp( SurfNum ) = ( CTFConstInPart( SurfNum ) + QPoolSurfNumerator( SurfNum ) + IterDampConst * TempInsOld( SurfNum ) ) / ( construct.CTFInside( 0 ) - construct.CTFCross( 0 ) + PoolHeatTransCoefs( SurfNum ) + IterDampConst ); // Constant part of conduction eq (history terms) | Pool modified terms (see non-pool equation for details) | Iterative damping term (for stability) | Conduction term (both partition sides same temp) | Pool and damping term
+						}
+						if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+							TempSurfInTmp( SurfNum ) -= MoistEMPDFlux( SurfNum ) * TempDiv; // Conduction term (both partition sides same temp) | Conduction term (both partition sides same temp) | Convection and damping term
+							if ( TempSurfInSat > TempSurfInTmp( SurfNum ) ) {
+								TempSurfInTmp( SurfNum ) = TempSurfInSat; // Surface temp cannot be below dew point
+							}
+						}
+						// if any mixed heat transfer models in zone, apply limits to CTF result
+						if ( any_surface_ConFD_or_HAMT( ZoneNum ) ) TempSurfInTmp( SurfNum ) = max( MinSurfaceTempLimit, min( MaxSurfaceTempLimit, TempSurfInTmp( SurfNum ) ) ); // Limit Check //Tuned Precomputed condition to eliminate loop
 
-					if ( construct.SourceSinkPresent ) { // Set the appropriate parameters for the radiant system
+						if ( construct.SourceSinkPresent ) { // Set the appropriate parameters for the radiant system
 
-						// Radiant system does not need the damping coefficient terms (hopefully) // Partitions are assumed to be symmetric
-						Real64 const RadSysDiv( 1.0 / ( construct.CTFInside( 0 ) - construct.CTFCross( 0 ) + HConvIn_surf ) );
-						RadSysToHBConstCoef( SurfNum ) = RadSysTiHBConstCoef( SurfNum ) = TempTerm * RadSysDiv; // Constant portion of conduction eq (history terms) | LW radiation from internal sources | SW radiation from internal sources | Convection from surface to zone air | Radiant flux from high temperature radiant heater | Radiant flux from a hot water baseboard heater | Radiant flux from a steam baseboard heater | Radiant flux from an electric baseboard heater | Net radiant exchange with other zone surfaces | Cond term (both partition sides same temp) | Cond term (both partition sides same temp) | Convection and damping term
-						RadSysToHBTinCoef( SurfNum ) = RadSysTiHBToutCoef( SurfNum ) = 0.0; // The outside temp is assumed to be equal to the inside temp for a partition
-						RadSysToHBQsrcCoef( SurfNum ) = RadSysTiHBQsrcCoef( SurfNum ) = construct.CTFSourceIn( 0 ) * RadSysDiv; // QTF term for the source | Cond term (both partition sides same temp) | Cond term (both partition sides same temp) | Convection and damping term
+							// Radiant system does not need the damping coefficient terms (hopefully) // Partitions are assumed to be symmetric
+							Real64 const RadSysDiv( 1.0 / ( construct.CTFInside( 0 ) - construct.CTFCross( 0 ) + HConvIn_surf ) );
+							RadSysToHBConstCoef( SurfNum ) = RadSysTiHBConstCoef( SurfNum ) = TempTerm * RadSysDiv; // Constant portion of conduction eq (history terms) | LW radiation from internal sources | SW radiation from internal sources | Convection from surface to zone air | Radiant flux from high temperature radiant heater | Radiant flux from a hot water baseboard heater | Radiant flux from a steam baseboard heater | Radiant flux from an electric baseboard heater | Net radiant exchange with other zone surfaces | Cond term (both partition sides same temp) | Cond term (both partition sides same temp) | Convection and damping term
+							RadSysToHBTinCoef( SurfNum ) = RadSysTiHBToutCoef( SurfNum ) = 0.0; // The outside temp is assumed to be equal to the inside temp for a partition
+							RadSysToHBQsrcCoef( SurfNum ) = RadSysTiHBQsrcCoef( SurfNum ) = construct.CTFSourceIn( 0 ) * RadSysDiv; // QTF term for the source | Cond term (both partition sides same temp) | Cond term (both partition sides same temp) | Convection and damping term
 
-					}
+						}
 
-				} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
 
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp ); //HAMT
+						if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp ); //HAMT
 
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+						if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
 
-					TH11 = TempSurfOutTmp;
+						TH11 = TempSurfOutTmp;
 
-				}
+					}
 
-				TempSurfIn( SurfNum ) = TempSurfInTmp( SurfNum );
+					TempSurfIn( SurfNum ) = TempSurfInTmp( SurfNum );
 
-			} else { // Standard surface or interzone surface
+				} else { // Standard surface or interzone surface
 
-				if ( surface.Class != SurfaceClass_Window ) { // Opaque surface
+					if ( surface.Class != SurfaceClass_Window ) { // Opaque surface
 
-					HMovInsul = 0.0;
-					if ( surface.MaterialMovInsulInt > 0 ) EvalInsideMovableInsulation( SurfNum, HMovInsul, AbsInt );
+						HMovInsul = 0.0;
+						if ( surface.MaterialMovInsulInt > 0 ) EvalInsideMovableInsulation( SurfNum, HMovInsul, AbsInt );
 
-					if ( HMovInsul <= 0.0 ) { // No movable insulation present, normal heat balance equation
+						if ( HMovInsul <= 0.0 ) { // No movable insulation present, normal heat balance equation
 
-						if ( surface.HeatTransferAlgorithm == HeatTransferModel_CTF || surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) { // Regular CTF Surface and/or EMPD surface
+							if ( surface.HeatTransferAlgorithm == HeatTransferModel_CTF || surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) { // Regular CTF Surface and/or EMPD surface
 
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
-								CalcMoistureBalanceEMPD( SurfNum, TempSurfInTmp( SurfNum ), TH22, MAT_zone, TempSurfInSat );
-							}
-							//Pre-calculate a few terms
-							Real64 const TempTerm( CTFConstInPart( SurfNum ) + QRadThermInAbs( SurfNum ) + QRadSWInAbs( SurfNum ) + HConvIn_surf * RefAirTemp( SurfNum ) + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) + NetLWRadToSurf( SurfNum ) );
-							Real64 const TempDiv( 1.0 / ( construct.CTFInside( 0 ) + HConvIn_surf + IterDampConst ) );
-							// Calculate the current inside surface temperature
-							if ( ( ! surface.IsPool ) || ( ( surface.IsPool ) && ( abs( QPoolSurfNumerator( SurfNum ) ) < SmallNumber ) && ( abs( PoolHeatTransCoefs( SurfNum ) ) < SmallNumber ) ) ) {
-								TempSurfInTmp( SurfNum ) = ( TempTerm + construct.CTFSourceIn( 0 ) * QsrcHist( 1, SurfNum ) + IterDampConst * TempInsOld( SurfNum ) + construct.CTFCross( 0 ) * TH11 ) * TempDiv; // Constant part of conduction eq (history terms) | LW radiation from internal sources | SW radiation from internal sources | Convection from surface to zone air | Net radiant exchange with other zone surfaces | Heat source/sink term for radiant systems | (if there is one present) | Radiant flux from high temp radiant heater | Radiant flux from a hot water baseboard heater | Radiant flux from a steam baseboard heater | Radiant flux from an electric baseboard heater | Iterative damping term (for stability) | Current conduction from | the outside surface | Coefficient for conduction (current time) | Convection and damping term
-							} else { // surface is a pool and the pool has been simulated this time step
-								TempSurfInTmp( SurfNum ) = ( CTFConstInPart( SurfNum ) + QPoolSurfNumerator( SurfNum ) + IterDampConst * TempInsOld( SurfNum ) + construct.CTFCross( 0 ) * TH11 ) / ( construct.CTFInside( 0 ) + PoolHeatTransCoefs( SurfNum ) + IterDampConst ); // Constant part of conduction eq (history terms) | Pool modified terms (see non-pool equation for details) | Iterative damping term (for stability) | Current conduction from | the outside surface | Coefficient for conduction (current time) | Pool and damping term
-							}
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
-								TempSurfInTmp( SurfNum ) -= MoistEMPDFlux( SurfNum ) * TempDiv; // Coefficient for conduction (current time) | Convection and damping term
-								if ( TempSurfInSat > TempSurfInTmp( SurfNum ) ) {
-									TempSurfInTmp( SurfNum ) = TempSurfInSat; // Surface temp cannot be below dew point
+								if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+									CalcMoistureBalanceEMPD( SurfNum, TempSurfInTmp( SurfNum ), TH22, MAT_zone, TempSurfInSat );
 								}
-							}
-							// if any mixed heat transfer models in zone, apply limits to CTF result
-							if ( any_surface_ConFD_or_HAMT( ZoneNum ) ) TempSurfInTmp( SurfNum ) = max( MinSurfaceTempLimit, min( MaxSurfaceTempLimit, TempSurfInTmp( SurfNum ) ) ); // Limit Check //Tuned Precomputed condition to eliminate loop
+								//Pre-calculate a few terms
+								Real64 const TempTerm( CTFConstInPart( SurfNum ) + QRadThermInAbs( SurfNum ) + QRadSWInAbs( SurfNum ) + HConvIn_surf * RefAirTemp( SurfNum ) + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) + NetLWRadToSurf( SurfNum ) );
+								Real64 const TempDiv( 1.0 / ( construct.CTFInside( 0 ) + HConvIn_surf + IterDampConst ) );
+								// Calculate the current inside surface temperature
+								if ( ( ! surface.IsPool ) || ( ( surface.IsPool ) && ( abs( QPoolSurfNumerator( SurfNum ) ) < SmallNumber ) && ( abs( PoolHeatTransCoefs( SurfNum ) ) < SmallNumber ) ) ) {
+									TempSurfInTmp( SurfNum ) = ( TempTerm + construct.CTFSourceIn( 0 ) * QsrcHist( 1, SurfNum ) + IterDampConst * TempInsOld( SurfNum ) + construct.CTFCross( 0 ) * TH11 ) * TempDiv; // Constant part of conduction eq (history terms) | LW radiation from internal sources | SW radiation from internal sources | Convection from surface to zone air | Net radiant exchange with other zone surfaces | Heat source/sink term for radiant systems | (if there is one present) | Radiant flux from high temp radiant heater | Radiant flux from a hot water baseboard heater | Radiant flux from a steam baseboard heater | Radiant flux from an electric baseboard heater | Iterative damping term (for stability) | Current conduction from | the outside surface | Coefficient for conduction (current time) | Convection and damping term
+								} else { // surface is a pool and the pool has been simulated this time step
+									TempSurfInTmp( SurfNum ) = ( CTFConstInPart( SurfNum ) + QPoolSurfNumerator( SurfNum ) + IterDampConst * TempInsOld( SurfNum ) + construct.CTFCross( 0 ) * TH11 ) / ( construct.CTFInside( 0 ) + PoolHeatTransCoefs( SurfNum ) + IterDampConst ); // Constant part of conduction eq (history terms) | Pool modified terms (see non-pool equation for details) | Iterative damping term (for stability) | Current conduction from | the outside surface | Coefficient for conduction (current time) | Pool and damping term
+								}
+								if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+									TempSurfInTmp( SurfNum ) -= MoistEMPDFlux( SurfNum ) * TempDiv; // Coefficient for conduction (current time) | Convection and damping term
+									if ( TempSurfInSat > TempSurfInTmp( SurfNum ) ) {
+										TempSurfInTmp( SurfNum ) = TempSurfInSat; // Surface temp cannot be below dew point
+									}
+								}
+								// if any mixed heat transfer models in zone, apply limits to CTF result
+								if ( any_surface_ConFD_or_HAMT( ZoneNum ) ) TempSurfInTmp( SurfNum ) = max( MinSurfaceTempLimit, min( MaxSurfaceTempLimit, TempSurfInTmp( SurfNum ) ) ); // Limit Check //Tuned Precomputed condition to eliminate loop
+
+								if ( construct.SourceSinkPresent ) { // Set the appropriate parameters for the radiant system
+
+									// Radiant system does not need the damping coefficient terms (hopefully)
+									Real64 const RadSysDiv( 1.0 / ( construct.CTFInside( 0 ) + HConvIn_surf ) );
+									RadSysTiHBConstCoef( SurfNum ) = TempTerm * RadSysDiv; // Constant portion of cond eq (history terms) | LW radiation from internal sources | SW radiation from internal sources | Convection from surface to zone air | Radiant flux from high temp radiant heater | Radiant flux from a hot water baseboard heater | Radiant flux from a steam baseboard heater | Radiant flux from an electric baseboard heater | Net radiant exchange with other zone surfaces | Cond term (both partition sides same temp) | Convection and damping term
+									RadSysTiHBToutCoef( SurfNum ) = construct.CTFCross( 0 ) * RadSysDiv; // Outside temp=inside temp for a partition | Cond term (both partition sides same temp) | Convection and damping term
+									RadSysTiHBQsrcCoef( SurfNum ) = construct.CTFSourceIn( 0 ) * RadSysDiv; // QTF term for the source | Cond term (both partition sides same temp) | Convection and damping term
+
+									if ( surface.ExtBoundCond > 0 ) { // This is an interzone partition and we need to set outside params
+										// The inside coefficients of one side are equal to the outside coefficients of the other side.  But,
+										// the inside coefficients are set up once the heat balance equation for that side has been calculated.
+										// For both sides to actually have been set, we have to wait until we get to the second side in the surface
+										// derived type.  At that point, both inside coefficient sets have been evaluated.
+										if ( surface.ExtBoundCond < SurfNum ) { // Both of the inside coefficients have now been set
+											OtherSideSurfNum = surface.ExtBoundCond;
+											RadSysToHBConstCoef( OtherSideSurfNum ) = RadSysTiHBConstCoef( SurfNum );
+											RadSysToHBTinCoef( OtherSideSurfNum ) = RadSysTiHBToutCoef( SurfNum );
+											RadSysToHBQsrcCoef( OtherSideSurfNum ) = RadSysTiHBQsrcCoef( SurfNum );
+											RadSysToHBConstCoef( SurfNum ) = RadSysTiHBConstCoef( OtherSideSurfNum );
+											RadSysToHBTinCoef( SurfNum ) = RadSysTiHBToutCoef( OtherSideSurfNum );
+											RadSysToHBQsrcCoef( SurfNum ) = RadSysTiHBQsrcCoef( OtherSideSurfNum );
+										}
+									}
 
-							if ( construct.SourceSinkPresent ) { // Set the appropriate parameters for the radiant system
+								}
 
-								// Radiant system does not need the damping coefficient terms (hopefully)
-								Real64 const RadSysDiv( 1.0 / ( construct.CTFInside( 0 ) + HConvIn_surf ) );
-								RadSysTiHBConstCoef( SurfNum ) = TempTerm * RadSysDiv; // Constant portion of cond eq (history terms) | LW radiation from internal sources | SW radiation from internal sources | Convection from surface to zone air | Radiant flux from high temp radiant heater | Radiant flux from a hot water baseboard heater | Radiant flux from a steam baseboard heater | Radiant flux from an electric baseboard heater | Net radiant exchange with other zone surfaces | Cond term (both partition sides same temp) | Convection and damping term
-								RadSysTiHBToutCoef( SurfNum ) = construct.CTFCross( 0 ) * RadSysDiv; // Outside temp=inside temp for a partition | Cond term (both partition sides same temp) | Convection and damping term
-								RadSysTiHBQsrcCoef( SurfNum ) = construct.CTFSourceIn( 0 ) * RadSysDiv; // QTF term for the source | Cond term (both partition sides same temp) | Convection and damping term
+							} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
 
-								if ( surface.ExtBoundCond > 0 ) { // This is an interzone partition and we need to set outside params
-									// The inside coefficients of one side are equal to the outside coefficients of the other side.  But,
-									// the inside coefficients are set up once the heat balance equation for that side has been calculated.
-									// For both sides to actually have been set, we have to wait until we get to the second side in the surface
-									// derived type.  At that point, both inside coefficient sets have been evaluated.
-									if ( surface.ExtBoundCond < SurfNum ) { // Both of the inside coefficients have now been set
+								if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+									if ( surface.ExtBoundCond > 0 ) {
+										// HAMT get the correct other side zone zone air temperature --
 										OtherSideSurfNum = surface.ExtBoundCond;
-										RadSysToHBConstCoef( OtherSideSurfNum ) = RadSysTiHBConstCoef( SurfNum );
-										RadSysToHBTinCoef( OtherSideSurfNum ) = RadSysTiHBToutCoef( SurfNum );
-										RadSysToHBQsrcCoef( OtherSideSurfNum ) = RadSysTiHBQsrcCoef( SurfNum );
-										RadSysToHBConstCoef( SurfNum ) = RadSysTiHBConstCoef( OtherSideSurfNum );
-										RadSysToHBTinCoef( SurfNum ) = RadSysTiHBToutCoef( OtherSideSurfNum );
-										RadSysToHBQsrcCoef( SurfNum ) = RadSysTiHBQsrcCoef( OtherSideSurfNum );
+										ZoneNum = surface.Zone;
+										OtherSideZoneNum = Surface( OtherSideSurfNum ).Zone;
+										TempOutsideAirFD( SurfNum ) = MAT( OtherSideZoneNum );
 									}
+									ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
 								}
 
-							}
+								if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
 
-						} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+								TH11 = TempSurfOutTmp;
 
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-								if ( surface.ExtBoundCond > 0 ) {
-									// HAMT get the correct other side zone zone air temperature --
-									OtherSideSurfNum = surface.ExtBoundCond;
-									ZoneNum = surface.Zone;
-									OtherSideZoneNum = Surface( OtherSideSurfNum ).Zone;
-									TempOutsideAirFD( SurfNum ) = MAT( OtherSideZoneNum );
-								}
-								ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
 							}
 
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+							TempSurfIn( SurfNum ) = TempSurfInTmp( SurfNum );
 
-							TH11 = TempSurfOutTmp;
+						} else { // Movable insulation present
 
+							if ( construct.SourceSinkPresent && firstTime ) ShowSevereError( "Movable insulation is not valid with embedded sources/sinks" );
+
+							F1 = HMovInsul / ( HMovInsul + HConvIn_surf + IterDampConst );
+
+							TempSurfIn( SurfNum ) = ( CTFConstInPart( SurfNum ) + QRadSWInAbs( SurfNum ) + construct.CTFCross( 0 ) * TH11 + F1 * ( QRadThermInAbs( SurfNum ) + HConvIn_surf * RefAirTemp( SurfNum ) + NetLWRadToSurf( SurfNum ) + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) + IterDampConst * TempInsOld( SurfNum ) ) ) / ( construct.CTFInside( 0 ) + HMovInsul - F1 * HMovInsul ); // Convection from surface to zone air
+
+							TempSurfInTmp( SurfNum ) = ( construct.CTFInside( 0 ) * TempSurfIn( SurfNum ) + HMovInsul * TempSurfIn( SurfNum ) - QRadSWInAbs( SurfNum ) - CTFConstInPart( SurfNum ) - construct.CTFCross( 0 ) * TH11 ) / ( HMovInsul );
+							// if any mixed heat transfer models in zone, apply limits to CTF result
+							if ( any_surface_ConFD_or_HAMT( ZoneNum ) ) TempSurfInTmp( SurfNum ) = max( MinSurfaceTempLimit, min( MaxSurfaceTempLimit, TempSurfInTmp( SurfNum ) ) ); // Limit Check //Tuned Precomputed condition to eliminate loop
 						}
 
-						TempSurfIn( SurfNum ) = TempSurfInTmp( SurfNum );
+					} else { // Window
 
-					} else { // Movable insulation present
+						if ( construct.SourceSinkPresent && firstTime ) ShowSevereError( "Windows are not allowed to have embedded sources/sinks" );
 
-						if ( construct.SourceSinkPresent && firstTime ) ShowSevereError( "Movable insulation is not valid with embedded sources/sinks" );
+						if ( SurfaceWindow( SurfNum ).OriginalClass == SurfaceClass_TDD_Diffuser ) { // Tubular daylighting device
+							// Lookup up the TDD:DOME object
+							PipeNum = FindTDDPipe( SurfNum );
+							SurfNum2 = TDDPipe( PipeNum ).Dome;
+							Ueff = 1.0 / TDDPipe( PipeNum ).Reff;
 
-						F1 = HMovInsul / ( HMovInsul + HConvIn_surf + IterDampConst );
+							// Similar to opaque surface but outside surface temp of TDD:DOME is used, and no embedded sources/sinks.
+							// Absorbed shortwave radiation is treated similar to a regular window, but only 1 glass layer is allowed.
+							//   = QRadSWwinAbs(SurfNum,1)/2.0
+							TempSurfIn( SurfNum ) = TempSurfInTmp( SurfNum ) = ( QRadThermInAbs( SurfNum ) + QRadSWwinAbs( SurfNum, 1 ) / 2.0 + HConvIn_surf * RefAirTemp( SurfNum ) + NetLWRadToSurf( SurfNum ) + IterDampConst * TempInsOld( SurfNum ) + Ueff * TH( SurfNum2, 1, 1 ) ) / ( Ueff + HConvIn_surf + IterDampConst ); // LW radiation from internal sources | SW radiation from internal sources and solar | Convection from surface to zone air | Net radiant exchange with other zone surfaces | Iterative damping term (for stability) | Current conduction from the outside surface | Coefficient for conduction (current time) | Convection and damping term
 
-						TempSurfIn( SurfNum ) = ( CTFConstInPart( SurfNum ) + QRadSWInAbs( SurfNum ) + construct.CTFCross( 0 ) * TH11 + F1 * ( QRadThermInAbs( SurfNum ) + HConvIn_surf * RefAirTemp( SurfNum ) + NetLWRadToSurf( SurfNum ) + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) + IterDampConst * TempInsOld( SurfNum ) ) ) / ( construct.CTFInside( 0 ) + HMovInsul - F1 * HMovInsul ); // Convection from surface to zone air
+							Real64 const Sigma_Temp_4( Sigma * pow_4( TempSurfIn( SurfNum ) ) );
 
-						TempSurfInTmp( SurfNum ) = ( construct.CTFInside( 0 ) * TempSurfIn( SurfNum ) + HMovInsul * TempSurfIn( SurfNum ) - QRadSWInAbs( SurfNum ) - CTFConstInPart( SurfNum ) - construct.CTFCross( 0 ) * TH11 ) / ( HMovInsul );
-						// if any mixed heat transfer models in zone, apply limits to CTF result
-						if ( any_surface_ConFD_or_HAMT( ZoneNum ) ) TempSurfInTmp( SurfNum ) = max( MinSurfaceTempLimit, min( MaxSurfaceTempLimit, TempSurfInTmp( SurfNum ) ) ); // Limit Check //Tuned Precomputed condition to eliminate loop
-					}
+							// Calculate window heat gain for TDD:DIFFUSER since this calculation is usually done in WindowManager
+							WinHeatGain( SurfNum ) = WinTransSolar( SurfNum ) + HConvIn_surf * surface.Area * ( TempSurfIn( SurfNum ) - RefAirTemp( SurfNum ) ) + Construct( surface.Construction ).InsideAbsorpThermal * surface.Area * ( Sigma_Temp_4 - ( SurfaceWindow( SurfNum ).IRfromParentZone + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) ) ) - QS( surface.Zone ) * surface.Area * Construct( surface.Construction ).TransDiff; // Transmitted solar | Convection | IR exchange | IR
+							// Zone diffuse interior shortwave reflected back into the TDD
 
-				} else { // Window
+							// fill out report vars for components of Window Heat Gain
+							WinGainConvGlazToZoneRep( SurfNum ) = HConvIn_surf * surface.Area * ( TempSurfIn( SurfNum ) - RefAirTemp( SurfNum ) );
+							WinGainIRGlazToZoneRep( SurfNum ) = Construct( surface.Construction ).InsideAbsorpThermal * surface.Area * ( Sigma_Temp_4 - ( SurfaceWindow( SurfNum ).IRfromParentZone + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) ) );
+							WinLossSWZoneToOutWinRep( SurfNum ) = QS( surface.Zone ) * surface.Area * Construct( surface.Construction ).TransDiff;
+							if ( WinHeatGain( SurfNum ) >= 0.0 ) {
+								WinHeatGainRep( SurfNum ) = WinHeatGain( SurfNum );
+								WinHeatGainRepEnergy( SurfNum ) = WinHeatGainRep( SurfNum ) * TimeStepZoneSec;
+							} else {
+								WinHeatLossRep( SurfNum ) = -WinHeatGain( SurfNum );
+								WinHeatLossRepEnergy( SurfNum ) = WinHeatLossRep( SurfNum ) * TimeStepZoneSec;
+							}
 
-					if ( construct.SourceSinkPresent && firstTime ) ShowSevereError( "Windows are not allowed to have embedded sources/sinks" );
+							TDDPipe( PipeNum ).HeatGain = WinHeatGainRep( SurfNum );
+							TDDPipe( PipeNum ).HeatLoss = WinHeatLossRep( SurfNum );
+
+						} else { // Regular window
+							if ( InsideSurfIterations == 0 ) { // Do windows only once
+								if ( SurfaceWindow( SurfNum ).StormWinFlag == 1 ) ConstrNum = surface.StormWinConstruction;
+								// Get outside convection coeff for exterior window here to avoid calling
+								// InitExteriorConvectionCoeff from CalcWindowHeatBalance, which avoids circular reference
+								// (HeatBalanceSurfaceManager USEing and WindowManager and
+								// WindowManager USEing HeatBalanceSurfaceManager)
+								if ( surface.ExtBoundCond == ExternalEnvironment ) {
+									RoughSurf = Material( construct.LayerPoint( 1 ) ).Roughness;
+									EmisOut = Material( construct.LayerPoint( 1 ) ).AbsorpThermalFront;
+									auto const shading_flag( SurfaceWindow( SurfNum ).ShadingFlag );
+									if ( shading_flag == ExtShadeOn || shading_flag == ExtBlindOn || shading_flag == ExtScreenOn ) {
+										// Exterior shade in place
+										ConstrNumSh = SurfaceWindow( SurfNum ).ShadedConstruction;
+										RoughSurf = Material( Construct( ConstrNumSh ).LayerPoint( 1 ) ).Roughness;
+										EmisOut = Material( Construct( ConstrNumSh ).LayerPoint( 1 ) ).AbsorpThermal;
+									}
 
-					if ( SurfaceWindow( SurfNum ).OriginalClass == SurfaceClass_TDD_Diffuser ) { // Tubular daylighting device
-						// Lookup up the TDD:DOME object
-						PipeNum = FindTDDPipe( SurfNum );
-						SurfNum2 = TDDPipe( PipeNum ).Dome;
-						Ueff = 1.0 / TDDPipe( PipeNum ).Reff;
-
-						// Similar to opaque surface but outside surface temp of TDD:DOME is used, and no embedded sources/sinks.
-						// Absorbed shortwave radiation is treated similar to a regular window, but only 1 glass layer is allowed.
-						//   = QRadSWwinAbs(SurfNum,1)/2.0
-						TempSurfIn( SurfNum ) = TempSurfInTmp( SurfNum ) = ( QRadThermInAbs( SurfNum ) + QRadSWwinAbs( SurfNum, 1 ) / 2.0 + HConvIn_surf * RefAirTemp( SurfNum ) + NetLWRadToSurf( SurfNum ) + IterDampConst * TempInsOld( SurfNum ) + Ueff * TH( SurfNum2, 1, 1 ) ) / ( Ueff + HConvIn_surf + IterDampConst ); // LW radiation from internal sources | SW radiation from internal sources and solar | Convection from surface to zone air | Net radiant exchange with other zone surfaces | Iterative damping term (for stability) | Current conduction from the outside surface | Coefficient for conduction (current time) | Convection and damping term
-
-						Real64 const Sigma_Temp_4( Sigma * pow_4( TempSurfIn( SurfNum ) ) );
-
-						// Calculate window heat gain for TDD:DIFFUSER since this calculation is usually done in WindowManager
-						WinHeatGain( SurfNum ) = WinTransSolar( SurfNum ) + HConvIn_surf * surface.Area * ( TempSurfIn( SurfNum ) - RefAirTemp( SurfNum ) ) + Construct( surface.Construction ).InsideAbsorpThermal * surface.Area * ( Sigma_Temp_4 - ( SurfaceWindow( SurfNum ).IRfromParentZone + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) ) ) - QS( surface.Zone ) * surface.Area * Construct( surface.Construction ).TransDiff; // Transmitted solar | Convection | IR exchange | IR
-						// Zone diffuse interior shortwave reflected back into the TDD
-
-						// fill out report vars for components of Window Heat Gain
-						WinGainConvGlazToZoneRep( SurfNum ) = HConvIn_surf * surface.Area * ( TempSurfIn( SurfNum ) - RefAirTemp( SurfNum ) );
-						WinGainIRGlazToZoneRep( SurfNum ) = Construct( surface.Construction ).InsideAbsorpThermal * surface.Area * ( Sigma_Temp_4 - ( SurfaceWindow( SurfNum ).IRfromParentZone + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) ) );
-						WinLossSWZoneToOutWinRep( SurfNum ) = QS( surface.Zone ) * surface.Area * Construct( surface.Construction ).TransDiff;
-						if ( WinHeatGain( SurfNum ) >= 0.0 ) {
-							WinHeatGainRep( SurfNum ) = WinHeatGain( SurfNum );
-							WinHeatGainRepEnergy( SurfNum ) = WinHeatGainRep( SurfNum ) * TimeStepZoneSec;
-						} else {
-							WinHeatLossRep( SurfNum ) = -WinHeatGain( SurfNum );
-							WinHeatLossRepEnergy( SurfNum ) = WinHeatLossRep( SurfNum ) * TimeStepZoneSec;
-						}
+									// Get the outside effective emissivity for Equivalent layer model
+									if ( construct.WindowTypeEQL ) {
+										EmisOut = EQLWindowOutsideEffectiveEmiss( ConstrNum );
+									}
+									// Set Exterior Convection Coefficient...
+									if ( surface.ExtConvCoeff > 0 ) {
 
-						TDDPipe( PipeNum ).HeatGain = WinHeatGainRep( SurfNum );
-						TDDPipe( PipeNum ).HeatLoss = WinHeatLossRep( SurfNum );
-
-					} else { // Regular window
-						if ( InsideSurfIterations == 0 ) { // Do windows only once
-							if ( SurfaceWindow( SurfNum ).StormWinFlag == 1 ) ConstrNum = surface.StormWinConstruction;
-							// Get outside convection coeff for exterior window here to avoid calling
-							// InitExteriorConvectionCoeff from CalcWindowHeatBalance, which avoids circular reference
-							// (HeatBalanceSurfaceManager USEing and WindowManager and
-							// WindowManager USEing HeatBalanceSurfaceManager)
-							if ( surface.ExtBoundCond == ExternalEnvironment ) {
-								RoughSurf = Material( construct.LayerPoint( 1 ) ).Roughness;
-								EmisOut = Material( construct.LayerPoint( 1 ) ).AbsorpThermalFront;
-								auto const shading_flag( SurfaceWindow( SurfNum ).ShadingFlag );
-								if ( shading_flag == ExtShadeOn || shading_flag == ExtBlindOn || shading_flag == ExtScreenOn ) {
-									// Exterior shade in place
-									ConstrNumSh = SurfaceWindow( SurfNum ).ShadedConstruction;
-									RoughSurf = Material( Construct( ConstrNumSh ).LayerPoint( 1 ) ).Roughness;
-									EmisOut = Material( Construct( ConstrNumSh ).LayerPoint( 1 ) ).AbsorpThermal;
-								}
+										HcExtSurf( SurfNum ) = SetExtConvectionCoeff( SurfNum );
 
-								// Get the outside effective emissivity for Equivalent layer model
-								if ( construct.WindowTypeEQL ) {
-									EmisOut = EQLWindowOutsideEffectiveEmiss( ConstrNum );
-								}
-								// Set Exterior Convection Coefficient...
-								if ( surface.ExtConvCoeff > 0 ) {
+									} else if ( surface.ExtWind ) { // Window is exposed to wind (and possibly rain)
 
-									HcExtSurf( SurfNum ) = SetExtConvectionCoeff( SurfNum );
+										// Calculate exterior heat transfer coefficients with windspeed (windspeed is calculated internally in subroutine)
+										InitExteriorConvectionCoeff( SurfNum, 0.0, RoughSurf, EmisOut, TH11, HcExtSurf( SurfNum ), HSkyExtSurf( SurfNum ), HGrdExtSurf( SurfNum ), HAirExtSurf( SurfNum ) );
 
-								} else if ( surface.ExtWind ) { // Window is exposed to wind (and possibly rain)
+										if ( IsRain ) { // Raining: since wind exposed, outside window surface gets wet
+											HcExtSurf( SurfNum ) = 1000.0; // Reset HcExtSurf because of wetness
+										}
 
-									// Calculate exterior heat transfer coefficients with windspeed (windspeed is calculated internally in subroutine)
-									InitExteriorConvectionCoeff( SurfNum, 0.0, RoughSurf, EmisOut, TH11, HcExtSurf( SurfNum ), HSkyExtSurf( SurfNum ), HGrdExtSurf( SurfNum ), HAirExtSurf( SurfNum ) );
+									} else { // Not Wind exposed
 
-									if ( IsRain ) { // Raining: since wind exposed, outside window surface gets wet
-										HcExtSurf( SurfNum ) = 1000.0; // Reset HcExtSurf because of wetness
-									}
+										// Calculate exterior heat transfer coefficients for windspeed = 0
+										InitExteriorConvectionCoeff( SurfNum, 0.0, RoughSurf, EmisOut, TH11, HcExtSurf( SurfNum ), HSkyExtSurf( SurfNum ), HGrdExtSurf( SurfNum ), HAirExtSurf( SurfNum ) );
 
-								} else { // Not Wind exposed
+									}
+								} else { // Interior Surface
 
-									// Calculate exterior heat transfer coefficients for windspeed = 0
-									InitExteriorConvectionCoeff( SurfNum, 0.0, RoughSurf, EmisOut, TH11, HcExtSurf( SurfNum ), HSkyExtSurf( SurfNum ), HGrdExtSurf( SurfNum ), HAirExtSurf( SurfNum ) );
+									if ( surface.ExtConvCoeff > 0 ) {
+										HcExtSurf( SurfNum ) = SetExtConvectionCoeff( SurfNum );
+									} else {
+										// Exterior Convection Coefficient for the Interior or Interzone Window is the Interior Convection Coeff of same
+										HcExtSurf( SurfNum ) = HConvIn( surface.ExtBoundCond );
+									}
 
 								}
-							} else { // Interior Surface
 
-								if ( surface.ExtConvCoeff > 0 ) {
-									HcExtSurf( SurfNum ) = SetExtConvectionCoeff( SurfNum );
+								// Following call determines inside surface temperature of glazing, and of
+								// frame and/or divider, if present
+								CalcWindowHeatBalance( SurfNum, HcExtSurf( SurfNum ), TempSurfInTmp( SurfNum ), TH11 );
+								if ( WinHeatGain( SurfNum ) >= 0.0 ) {
+									WinHeatGainRep( SurfNum ) = WinHeatGain( SurfNum );
+									WinHeatGainRepEnergy( SurfNum ) = WinHeatGainRep( SurfNum ) * TimeStepZoneSec;
 								} else {
-									// Exterior Convection Coefficient for the Interior or Interzone Window is the Interior Convection Coeff of same
-									HcExtSurf( SurfNum ) = HConvIn( surface.ExtBoundCond );
+									WinHeatLossRep( SurfNum ) = -WinHeatGain( SurfNum );
+									WinHeatLossRepEnergy( SurfNum ) = WinHeatLossRep( SurfNum ) * TimeStepZoneSec;
 								}
 
+								TempSurfIn( SurfNum ) = TempSurfInTmp( SurfNum );
 							}
-
-							// Following call determines inside surface temperature of glazing, and of
-							// frame and/or divider, if present
-							CalcWindowHeatBalance( SurfNum, HcExtSurf( SurfNum ), TempSurfInTmp( SurfNum ), TH11 );
-							if ( WinHeatGain( SurfNum ) >= 0.0 ) {
-								WinHeatGainRep( SurfNum ) = WinHeatGain( SurfNum );
-								WinHeatGainRepEnergy( SurfNum ) = WinHeatGainRep( SurfNum ) * TimeStepZoneSec;
-							} else {
-								WinHeatLossRep( SurfNum ) = -WinHeatGain( SurfNum );
-								WinHeatLossRepEnergy( SurfNum ) = WinHeatLossRep( SurfNum ) * TimeStepZoneSec;
-							}
-
-							TempSurfIn( SurfNum ) = TempSurfInTmp( SurfNum );
 						}
 					}
-				}
-			} // ...end of inside surface heat balance equation selection
-
-			TH12 = TempSurfInRep( SurfNum ) = TempSurfIn( SurfNum );
-			TempSurfOut( SurfNum ) = TH11; // For reporting
-
-			//if ( std::isnan( TempSurfInRep( SurfNum ) ) ) { // Use IEEE_IS_NAN when GFortran supports it
-				//// throw Error
-				//ShowFatalError( "Inside surface temperature is out of bound = " + Surface( SurfNum ).Name );
-			//}
-			// sign convention is positive means energy going into inside face from the air.
-			auto const HConvInTemp_fac( -HConvIn_surf * ( TempSurfIn( SurfNum ) - RefAirTemp( SurfNum ) ) );
-			QdotConvInRep( SurfNum ) = surface.Area * HConvInTemp_fac;
-			QdotConvInRepPerArea( SurfNum ) = HConvInTemp_fac;
-			QConvInReport( SurfNum ) = QdotConvInRep( SurfNum ) * TimeStepZoneSec;
-
-			// The QdotConvInRep which is called "Surface Inside Face Convection Heat Gain" is stored during
-			// sizing for both the normal and pulse cases so that load components can be derived later.
-			if ( ZoneSizingCalc && CompLoadReportIsReq ) {
-				if ( ! WarmupFlag ) {
-					TimeStepInDay = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
-					if ( isPulseZoneSizing ) {
-						loadConvectedWithPulse( SurfNum, TimeStepInDay, CurOverallSimDay ) = QdotConvInRep( SurfNum );
-					} else {
-						loadConvectedNormal( SurfNum, TimeStepInDay, CurOverallSimDay ) = QdotConvInRep( SurfNum );
-						netSurfRadSeq( SurfNum, TimeStepInDay, CurOverallSimDay ) = QdotRadNetSurfInRep( SurfNum );
+				} // ...end of inside surface heat balance equation selection
+
+				TH12 = TempSurfInRep( SurfNum ) = TempSurfIn( SurfNum );
+				TempSurfOut( SurfNum ) = TH11; // For reporting
+
+				//if ( std::isnan( TempSurfInRep( SurfNum ) ) ) { // Use IEEE_IS_NAN when GFortran supports it
+					//// throw Error
+					//ShowFatalError( "Inside surface temperature is out of bound = " + Surface( SurfNum ).Name );
+				//}
+				// sign convention is positive means energy going into inside face from the air.
+				auto const HConvInTemp_fac( -HConvIn_surf * ( TempSurfIn( SurfNum ) - RefAirTemp( SurfNum ) ) );
+				QdotConvInRep( SurfNum ) = surface.Area * HConvInTemp_fac;
+				QdotConvInRepPerArea( SurfNum ) = HConvInTemp_fac;
+				QConvInReport( SurfNum ) = QdotConvInRep( SurfNum ) * TimeStepZoneSec;
+
+				// The QdotConvInRep which is called "Surface Inside Face Convection Heat Gain" is stored during
+				// sizing for both the normal and pulse cases so that load components can be derived later.
+				if ( ZoneSizingCalc && CompLoadReportIsReq ) {
+					if ( ! WarmupFlag ) {
+						int const TimeStepInDay( ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep ); // time step number
+						if ( isPulseZoneSizing ) {
+							loadConvectedWithPulse( SurfNum, TimeStepInDay, CurOverallSimDay ) = QdotConvInRep( SurfNum );
+						} else {
+							loadConvectedNormal( SurfNum, TimeStepInDay, CurOverallSimDay ) = QdotConvInRep( SurfNum );
+							netSurfRadSeq( SurfNum, TimeStepInDay, CurOverallSimDay ) = QdotRadNetSurfInRep( SurfNum );
+						}
 					}
 				}
-			}
 
-			if ( SurfaceWindow( SurfNum ).OriginalClass == SurfaceClass_TDD_Diffuser ) { // Tubular daylighting device
-				// Tubular daylighting devices are treated as one big object with an effective R value.
-				// The outside face temperature of the TDD:DOME and the inside face temperature of the
-				// TDD:DIFFUSER are calculated with the outside and inside heat balances respectively.
-				// Below, the resulting temperatures are copied to the inside face of the TDD:DOME
-				// and the outside face of the TDD:DIFFUSER for reporting.
+				if ( SurfaceWindow( SurfNum ).OriginalClass == SurfaceClass_TDD_Diffuser ) { // Tubular daylighting device
+					// Tubular daylighting devices are treated as one big object with an effective R value.
+					// The outside face temperature of the TDD:DOME and the inside face temperature of the
+					// TDD:DIFFUSER are calculated with the outside and inside heat balances respectively.
+					// Below, the resulting temperatures are copied to the inside face of the TDD:DOME
+					// and the outside face of the TDD:DIFFUSER for reporting.
 
-				// Set inside temp variables of TDD:DOME equal to inside temp of TDD:DIFFUSER
-				TH( SurfNum2, 1, 2 ) = TempSurfIn( SurfNum2 ) = TempSurfInTmp( SurfNum2 ) = TempSurfInRep( SurfNum2 ) = TempSurfIn( SurfNum );
+					// Set inside temp variables of TDD:DOME equal to inside temp of TDD:DIFFUSER
+					TH( SurfNum2, 1, 2 ) = TempSurfIn( SurfNum2 ) = TempSurfInTmp( SurfNum2 ) = TempSurfInRep( SurfNum2 ) = TempSurfIn( SurfNum );
 
-				// Set outside temp reporting variable of TDD:DOME (since it gets skipped otherwise)
-				// Reset outside temp variables of TDD:DIFFUSER equal to outside temp of TDD:DOME
-				TH11 = TempSurfOut( SurfNum ) = TempSurfOut( SurfNum2 ) = TH( SurfNum2, 1, 1 );
-			}
+					// Set outside temp reporting variable of TDD:DOME (since it gets skipped otherwise)
+					// Reset outside temp variables of TDD:DIFFUSER equal to outside temp of TDD:DOME
+					TH11 = TempSurfOut( SurfNum ) = TempSurfOut( SurfNum2 ) = TH( SurfNum2, 1, 1 );
+				}
+			} // ...end of loop over all surfaces for inside heat balances
+		}
+
+		// Temperature limit checks, done in surface order after the (possibly parallel) heat balances
+		for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) {
+			SurfNum = SurfToResimulate[ iSurfToResimulate ];
+			auto & surface( Surface( SurfNum ) );
+			if ( ! surface.HeatTransSurf ) continue; // Skip non-heat transfer surfaces
+			if ( surface.Class == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
+			if ( surface.Zone == 0 ) continue; // Skip non-heat transfer surfaces
+			auto & zone( Zone( surface.Zone ) );
+			Real64 const TH12( TH( SurfNum, 1, 2 ) );
 
 			if ( ( TH12 > MaxSurfaceTempLimit ) || ( TH12 < MinSurfaceTempLimit ) ) {
 				if ( WarmupFlag ) ++WarmupSurfTemp;
@@ -5524,7 +5698,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 					}
 				}
 			}
-		} // ...end of loop over all surfaces for inside heat balances
+		} // ...end of temperature limit checks
 
 		// Interzone surface updating: interzone surfaces have other side temperatures
 		// which can vary as the simulation iterates through the inside heat
@@ -5557,7 +5731,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 			if ( ! Surface( SurfNum ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
 
-			ConstrNum = Surface( SurfNum ).Construction;
+			int const ConstrNum( Surface( SurfNum ).Construction );
 			if ( Construct( ConstrNum ).TransDiff <= 0.0 ) { // Opaque surface
 				MaxDelTemp = max( std::abs( TempSurfIn( SurfNum ) - TempInsOld( SurfNum ) ), MaxDelTemp );
 				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
@@ -5597,6 +5771,23 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 		if ( InsideSurfIterations < MinIterations ) Converged = false;
 
+		// Aitken extrapolation of the zones whose last two iterations contracted geometrically.  Convergence is
+		// only ever accepted after a regular iteration, so the result meets the same tolerance as without it.
+		++ItersSinceMapChange;
+		if ( InsideSurfIterExtrapolation && ! Converged && ItersSinceMapChange >= 2 ) {
+			Real64 const Tolerance( useCondFDHTalg ? MaxAllowedDelTempCondFD : MaxAllowedDelTemp );
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				if ( PartialResimulate && ( ZoneNum != ZoneToResimulate() ) ) continue;
+				auto const & zoneSurfs( ExtrapolatedSurfs[ ZoneNum ] );
+				Real64 const ExtrapFactor( InsideSurfExtrapolationFactor( zoneSurfs, TempSurfIn, TempInsOld, TempInsOlder, Tolerance ) );
+				if ( ExtrapFactor <= 0.0 ) continue;
+				for ( int const ExtrapSurfNum : zoneSurfs ) {
+					TempSurfIn( ExtrapSurfNum ) += ExtrapFactor * ( TempSurfIn( ExtrapSurfNum ) - TempInsOld( ExtrapSurfNum ) );
+				}
+				ItersSinceMapChange = 0;
+			}
+		}
+
 		if ( InsideSurfIterations > MaxIterations ) {
 			if ( ! WarmupFlag ) {
 				++ErrCount;
@@ -5704,6 +5895,72 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 }
 
+Real64
+InsideSurfExtrapolationFactor(
+	std::vector< int > const & SurfNums, // Surfaces of one zone that are extrapolated together
+	FArray1< Real64 > const & TempNew, // Inside face temperatures of the latest iteration
+	FArray1< Real64 > const & TempOld, // Inside face temperatures of the iteration before
+	FArray1< Real64 > const & TempOlder, // Inside face temperatures of the iteration before that
+	Real64 const Tolerance // Convergence tolerance of the inside surface iterations
+)
+{
+
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// Returns the factor F for which TempNew + F * ( TempNew - TempOld ) is the Aitken estimate of the
+	// limit of the damped inside surface iterations of a zone, or zero if extrapolation is not worthwhile.
+
+	// METHODOLOGY EMPLOYED:
+	// With the damping term, the slowest mode of the iteration dominates after a few iterations and the
+	// changes shrink by a constant ratio R each iteration.  R is the least squares fit of the latest change
+	// to the one before.  The sum of the remaining changes is R / ( 1 - R ) times the latest change.  The
+	// factor is only returned when the two changes are nearly parallel (the fit leaves less than 1% of the
+	// latest change unexplained), R is well below 1, and more than two regular iterations would still be
+	// needed; extrapolating costs an iteration of its own, since convergence is not accepted right after it.
+
+	// Return value
+	Real64 ExtrapFactor( 0.0 );
+
+	// FUNCTION PARAMETER DEFINITIONS:
+	Real64 const MaxRatio( 0.95 ); // Largest contraction ratio that is extrapolated
+	Real64 const MinAlignment( 0.99 ); // Smallest squared cosine between the latest two changes
+	Real64 const MaxStep( 5.0 ); // Largest extrapolation step of any surface (C)
+
+	// FUNCTION LOCAL VARIABLE DECLARATIONS:
+	Real64 SumNewOld( 0.0 ); // Sum of products of the latest change and the one before
+	Real64 SumOldOld( 0.0 ); // Sum of squares of the change before the latest
+	Real64 SumNewNew( 0.0 ); // Sum of squares of the latest change
+	Real64 MaxChange( 0.0 ); // Largest latest change of any surface (C)
+
+	for ( int const SurfNum : SurfNums ) {
+		Real64 const ChangeNew( TempNew( SurfNum ) - TempOld( SurfNum ) );
+		Real64 const ChangeOld( TempOld( SurfNum ) - TempOlder( SurfNum ) );
+		SumNewOld += ChangeNew * ChangeOld;
+		SumOldOld += ChangeOld * ChangeOld;
+		SumNewNew += ChangeNew * ChangeNew;
+		MaxChange = max( MaxChange, std::abs( ChangeNew ) );
+	}
+	if ( SumOldOld <= 0.0 || MaxChange <= Tolerance ) return ExtrapFactor;
+
+	Real64 const Ratio( SumNewOld / SumOldOld );
+	if ( Ratio <= 0.0 || Ratio >= MaxRatio ) return ExtrapFactor;
+	if ( SumNewOld * SumNewOld < MinAlignment * SumNewNew * SumOldOld ) return ExtrapFactor;
+
+	// Regular iterations still needed for the latest change to fall below the tolerance
+	Real64 const ItersToGo( std::log( Tolerance / MaxChange ) / std::log( Ratio ) );
+	if ( ItersToGo <= 2.0 ) return ExtrapFactor;
+
+	ExtrapFactor = Ratio / ( 1.0 - Ratio );
+	if ( ExtrapFactor * MaxChange > MaxStep ) ExtrapFactor = 0.0;
+	return ExtrapFactor;
+
+}
+
 void
 CalcOutsideSurfTemp(
 	int const SurfNum, // Surface number DO loop counter
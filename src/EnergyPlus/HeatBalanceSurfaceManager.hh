@@ -1,7 +1,11 @@
 #ifndef HeatBalanceSurfaceManager_hh_INCLUDED
 #define HeatBalanceSurfaceManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
+#include <ObjexxFCL/FArray1.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
@@ -19,7 +23,8 @@ namespace HeatBalanceSurfaceManager {
 	// na
 
 	// MODULE VARIABLE DECLARATIONS:
-	// na
+	extern std::vector< std::vector< int > > OutsideSurfGroups; // Surfaces of the outside heat balance, in groups done in parallel
+	extern std::vector< std::vector< int > > InsideSurfGroups; // Surfaces of the inside heat balance, in groups done in parallel
 
 	// Subroutine Specifications for the Heat Balance Module
 	// Driver Routines
@@ -37,6 +42,11 @@ namespace HeatBalanceSurfaceManager {
 
 	// Functions
 
+	// Clears the global data in HeatBalanceSurfaceManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	ManageSurfaceHeatBalance();
 
@@ -115,12 +125,24 @@ namespace HeatBalanceSurfaceManager {
 
 // EXTERNAL SUBROUTINES (heavily related to HeatBalanceSurfaceManager)
 
+void
+FindSurfHeatBalGroups();
+
 void
 CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate = _ ); // if passed in, then only calculate surfaces that have this zone
 
 void
 CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate = _ ); // if passed in, then only calculate surfaces that have this zone
 
+Real64
+InsideSurfExtrapolationFactor(
+	std::vector< int > const & SurfNums, // Surfaces of one zone that are extrapolated together
+	FArray1< Real64 > const & TempNew, // Inside face temperatures of the latest iteration
+	FArray1< Real64 > const & TempOld, // Inside face temperatures of the iteration before
+	FArray1< Real64 > const & TempOlder, // Inside face temperatures of the iteration before that
+	Real64 const Tolerance // Convergence tolerance of the inside surface iterations
+);
+
 void
 CalcOutsideSurfTemp(
 	int const SurfNum, // Surface number DO loop counter
@@ -0,0 +1,453 @@
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+
+// EnergyPlus Headers
+#include <PixelCounting.hh>
+
+namespace EnergyPlus {
+
+namespace PixelCounting {
+
+	// Module containing the raster (pixel counting) alternative to polygon clipping for beam shading
+
+	// PURPOSE OF THIS MODULE:
+	// Computes the sunlit fraction of a receiving surface and of each of its subsurfaces from
+	// shadow polygons already projected along the sun's rays onto the plane of the surface.
+	// Unlike the homogeneous coordinate overlap calculation (SolarShading::DeterminePolygonOverlap)
+	// the cost does not grow with the number of overlapping shadows and there is no limit on
+	// the number of figures, so it is suited to surfaces with many shading surfaces.
+
+	// METHODOLOGY EMPLOYED:
+	// The bounding box of the receiving surface is divided into square pixels, Resolution of them
+	// along its longest side.  Each pixel row is filled scanline fashion: a pixel belongs to a polygon
+	// when its centre is inside it (even-odd rule, so concave polygons are handled).  Every pixel holds
+	// the product of the transmittances of the shadows covering it, which is exact for overlapping
+	// semi-transparent shadows.  The sunlit fraction of a polygon is the average of this product over
+	// the pixels whose centres are inside the polygon.  A polygon too small to contain any pixel centre
+	// takes the value at its vertex average.
+	// Optionally the pixels are also grouped by the set of shadows covering them (cover sets).  The
+	// fraction of a polygon in each set depends only on geometry, so the sunlit fraction for other
+	// shadow transmittances is a weighted sum over the sets (ReweightRaster) and needs no rendering.
+	// Error: only pixels cut by a polygon edge can be misclassified, so with pixel size h the error in
+	// the sunlit area is at most about h*(sqrt(2)*L + 2*h) for each edge, where L is the length of the
+	// edge within the receiving surface (see RasterErrorBound, whose largest value for the beam
+	// shadows is reported in the eio).  Halving the pixel size halves the error.
+	// Each job only reads its own polygons, so jobs for different surfaces may be rendered in parallel.
+
+	// REFERENCES:
+	// Foley, J.D., A. van Dam, S.K. Feiner and J.F. Hughes. 1990. Computer Graphics: Principles and
+	//  Practice, 2nd ed.  Section 3.6, Filling Polygons.
+
+	// OTHER NOTES:
+	// na
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const DefaultResolution( 512 );
+	int const MinResolution( 16 );
+
+	// Functions
+
+	namespace {
+
+		// One past the last vertex of a polygon
+		inline
+		int
+		PolygonEnd(
+			RasterJob const & Job,
+			int const Polygon
+		)
+		{
+			return ( Polygon + 1 < Job.NumPolygons() ? Job.Start[ Polygon + 1 ] : int( Job.X.size() ) );
+		}
+
+		void
+		PolygonBounds(
+			RasterJob const & Job,
+			int const Polygon,
+			Real64 & XMin,
+			Real64 & XMax,
+			Real64 & YMin,
+			Real64 & YMax
+		)
+		{
+			int const First( Job.Start[ Polygon ] );
+			int const Last( PolygonEnd( Job, Polygon ) );
+			XMin = XMax = Job.X[ First ];
+			YMin = YMax = Job.Y[ First ];
+			for ( int N = First + 1; N < Last; ++N ) {
+				XMin = std::min( XMin, Job.X[ N ] );
+				XMax = std::max( XMax, Job.X[ N ] );
+				YMin = std::min( YMin, Job.Y[ N ] );
+				YMax = std::max( YMax, Job.Y[ N ] );
+			}
+		}
+
+		// Sorted X coordinates where the edges of a polygon cross the horizontal line at YP
+		void
+		EdgeCrossings(
+			RasterJob const & Job,
+			int const Polygon,
+			Real64 const YP,
+			std::vector< Real64 > & Crossings
+		)
+		{
+			int const First( Job.Start[ Polygon ] );
+			int const Last( PolygonEnd( Job, Polygon ) );
+			Crossings.clear();
+			for ( int N = First, P = Last - 1; N < Last; P = N++ ) { // Edge from vertex P to vertex N
+				Real64 const Y0( Job.Y[ P ] );
+				Real64 const Y1( Job.Y[ N ] );
+				if ( ( Y0 > YP ) == ( Y1 > YP ) ) continue; // Half-open rule: vertices on the line count once
+				Crossings.push_back( Job.X[ P ] + ( YP - Y0 ) * ( Job.X[ N ] - Job.X[ P ] ) / ( Y1 - Y0 ) );
+			}
+			std::sort( Crossings.begin(), Crossings.end() );
+		}
+
+		// First pixel whose centre is at or beyond XP
+		inline
+		int
+		PixelIndex(
+			Real64 const XP,
+			Real64 const XMin,
+			Real64 const PixelSize,
+			int const NX
+		)
+		{
+			Real64 const Index( std::ceil( ( XP - XMin ) / PixelSize - 0.5 ) );
+			if ( Index <= 0.0 ) return 0;
+			if ( Index >= Real64( NX ) ) return NX;
+			return int( Index );
+		}
+
+		Real64
+		PolygonArea(
+			RasterJob const & Job,
+			int const Polygon
+		)
+		{
+			int const First( Job.Start[ Polygon ] );
+			int const Last( PolygonEnd( Job, Polygon ) );
+			Real64 TwiceArea( 0.0 );
+			for ( int N = First, P = Last - 1; N < Last; P = N++ ) {
+				TwiceArea += Job.X[ P ] * Job.Y[ N ] - Job.X[ N ] * Job.Y[ P ];
+			}
+			return 0.5 * std::abs( TwiceArea );
+		}
+
+		// Even-odd test of a point against a polygon
+		bool
+		PointInPolygon(
+			RasterJob const & Job,
+			int const Polygon,
+			Real64 const XP,
+			Real64 const YP
+		)
+		{
+			int const First( Job.Start[ Polygon ] );
+			int const Last( PolygonEnd( Job, Polygon ) );
+			bool Inside( false );
+			for ( int N = First, P = Last - 1; N < Last; P = N++ ) {
+				Real64 const Y0( Job.Y[ P ] );
+				Real64 const Y1( Job.Y[ N ] );
+				if ( ( Y0 > YP ) == ( Y1 > YP ) ) continue;
+				if ( XP < Job.X[ P ] + ( YP - Y0 ) * ( Job.X[ N ] - Job.X[ P ] ) / ( Y1 - Y0 ) ) Inside = ! Inside;
+			}
+			return Inside;
+		}
+
+		// Cover set made of set Set and shadow Shadow (added to Job.CoverSets if new)
+		int
+		AddToCoverSet(
+			RasterJob & Job,
+			std::map< std::pair< int, int >, int > & NextSet,
+			int const Set,
+			int const Shadow
+		)
+		{
+			auto const Key( std::make_pair( Set, Shadow ) );
+			auto const Found( NextSet.find( Key ) );
+			if ( Found != NextSet.end() ) return Found->second;
+			int const NewSet( int( Job.CoverSets.size() ) );
+			Job.CoverSets.push_back( CoverSet() );
+			Job.CoverSets.back().Shadows = Job.CoverSets[ Set ].Shadows;
+			Job.CoverSets.back().Shadows.push_back( Shadow );
+			Job.CoverSets.back().Fraction.assign( Job.NumSubSurfaces + 1, 0.0 );
+			NextSet[ Key ] = NewSet;
+			return NewSet;
+		}
+
+		// Length of the segment (X0,Y0)-(X1,Y1) within the box (Liang-Barsky clipping)
+		Real64
+		LengthInBox(
+			Real64 const X0,
+			Real64 const Y0,
+			Real64 const X1,
+			Real64 const Y1,
+			Real64 const XMin,
+			Real64 const XMax,
+			Real64 const YMin,
+			Real64 const YMax
+		)
+		{
+			Real64 const DX( X1 - X0 );
+			Real64 const DY( Y1 - Y0 );
+			Real64 const P[ 4 ] = { -DX, DX, -DY, DY };
+			Real64 const Q[ 4 ] = { X0 - XMin, XMax - X0, Y0 - YMin, YMax - Y0 };
+			Real64 T0( 0.0 );
+			Real64 T1( 1.0 );
+			for ( int K = 0; K < 4; ++K ) {
+				if ( P[ K ] == 0.0 ) {
+					if ( Q[ K ] < 0.0 ) return 0.0; // Parallel to and outside this side
+				} else {
+					Real64 const T( Q[ K ] / P[ K ] );
+					if ( P[ K ] < 0.0 ) {
+						T0 = std::max( T0, T );
+					} else {
+						T1 = std::min( T1, T );
+					}
+				}
+			}
+			if ( T1 <= T0 ) return 0.0;
+			return ( T1 - T0 ) * std::sqrt( DX * DX + DY * DY );
+		}
+
+	}
+
+	void
+	RenderRaster(
+		RasterJob & Job,
+		int const Resolution // Pixels along the longest side of the receiving surface
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets Job.LitFraction for the receiving surface (entry 0) and each of its subsurfaces,
+		// and Job.CoverSets if Job.FindCoverSets.
+
+		// METHODOLOGY EMPLOYED:
+		// Scanline fill of each pixel row; see the module description.  For cover sets each pixel
+		// holds the index of the set of shadows covering it instead of their transmittance.  Shadows
+		// are applied in order, so a set is found by adding one shadow to the set before it; these
+		// steps are remembered in NextSet.  Fully transparent shadows are kept in cover sets since
+		// their transmittance may change.
+
+		int const NumPolygons( Job.NumPolygons() );
+		int const NumLit( Job.NumSubSurfaces + 1 ); // Receiving surface and subsurfaces
+		bool const FindCoverSets( Job.FindCoverSets );
+
+		Job.LitFraction.assign( NumLit, 1.0 );
+		Job.CoverSets.clear();
+		if ( FindCoverSets ) {
+			Job.CoverSets.push_back( CoverSet() );
+			Job.CoverSets[ 0 ].Fraction.assign( NumLit, 1.0 );
+		}
+		if ( NumPolygons <= NumLit ) return; // No shadows: fully sunlit
+
+		Real64 XMin;
+		Real64 XMax;
+		Real64 YMin;
+		Real64 YMax;
+		PolygonBounds( Job, 0, XMin, XMax, YMin, YMax );
+		Real64 const Side( std::max( XMax - XMin, YMax - YMin ) );
+		if ( Side <= 0.0 ) return;
+		Real64 const PixelSize( Side / std::max( Resolution, 1 ) );
+		int const NX( std::max( 1, int( std::ceil( ( XMax - XMin ) / PixelSize ) ) ) );
+		int const NY( std::max( 1, int( std::ceil( ( YMax - YMin ) / PixelSize ) ) ) );
+
+		std::vector< Real64 > RowTransmittance( NX );
+		std::vector< int > RowSet( FindCoverSets ? NX : 0 );
+		std::vector< Real64 > Crossings;
+		std::vector< Real64 > SumTransmittance( NumLit, 0.0 );
+		std::vector< int > NumPixels( NumLit, 0 );
+		std::map< std::pair< int, int >, int > NextSet; // ( Set, Shadow ) -> set with the shadow added
+		if ( FindCoverSets ) Job.CoverSets[ 0 ].Fraction.assign( NumLit, 0.0 );
+
+		for ( int J = 0; J < NY; ++J ) {
+			Real64 const YC( YMin + ( J + 0.5 ) * PixelSize ); // Pixel centres of this row
+
+			// Shadows
+			std::fill( RowTransmittance.begin(), RowTransmittance.end(), 1.0 );
+			std::fill( RowSet.begin(), RowSet.end(), 0 );
+			for ( int Polygon = NumLit; Polygon < NumPolygons; ++Polygon ) {
+				Real64 const Transmittance( Job.Transmittance[ Polygon ] );
+				if ( Transmittance >= 1.0 && ! FindCoverSets ) continue;
+				EdgeCrossings( Job, Polygon, YC, Crossings );
+				for ( std::size_t K = 1; K < Crossings.size(); K += 2 ) {
+					int const I1( PixelIndex( Crossings[ K ], XMin, PixelSize, NX ) );
+					int Set( -1 ); // Last set looked up, and the set it becomes
+					int Next( 0 );
+					for ( int I = PixelIndex( Crossings[ K - 1 ], XMin, PixelSize, NX ); I < I1; ++I ) {
+						RowTransmittance[ I ] *= Transmittance;
+						if ( FindCoverSets ) {
+							if ( RowSet[ I ] != Set ) {
+								Set = RowSet[ I ];
+								Next = AddToCoverSet( Job, NextSet, Set, Polygon );
+							}
+							RowSet[ I ] = Next;
+						}
+					}
+				}
+			}
+
+			// Receiving surface and subsurfaces
+			for ( int Polygon = 0; Polygon < NumLit; ++Polygon ) {
+				EdgeCrossings( Job, Polygon, YC, Crossings );
+				for ( std::size_t K = 1; K < Crossings.size(); K += 2 ) {
+					int const I1( PixelIndex( Crossings[ K ], XMin, PixelSize, NX ) );
+					for ( int I = PixelIndex( Crossings[ K - 1 ], XMin, PixelSize, NX ); I < I1; ++I ) {
+						SumTransmittance[ Polygon ] += RowTransmittance[ I ];
+						++NumPixels[ Polygon ];
+						if ( FindCoverSets ) Job.CoverSets[ RowSet[ I ] ].Fraction[ Polygon ] += 1.0;
+					}
+				}
+			}
+		}
+
+		for ( int Polygon = 0; Polygon < NumLit; ++Polygon ) {
+			if ( NumPixels[ Polygon ] > 0 ) {
+				Job.LitFraction[ Polygon ] = SumTransmittance[ Polygon ] / NumPixels[ Polygon ];
+				if ( FindCoverSets ) {
+					for ( auto & Cover : Job.CoverSets ) {
+						Cover.Fraction[ Polygon ] /= NumPixels[ Polygon ];
+					}
+				}
+			} else { // Smaller than a pixel: sample at the vertex average
+				int const First( Job.Start[ Polygon ] );
+				int const Last( PolygonEnd( Job, Polygon ) );
+				if ( Last <= First ) continue;
+				Real64 XC( 0.0 );
+				Real64 YC( 0.0 );
+				for ( int N = First; N < Last; ++N ) {
+					XC += Job.X[ N ];
+					YC += Job.Y[ N ];
+				}
+				XC /= Last - First;
+				YC /= Last - First;
+				Job.LitFraction[ Polygon ] = PointTransmittance( Job, XC, YC );
+				if ( FindCoverSets ) {
+					int Set( 0 );
+					for ( int Shadow = NumLit; Shadow < NumPolygons; ++Shadow ) {
+						if ( PointInPolygon( Job, Shadow, XC, YC ) ) Set = AddToCoverSet( Job, NextSet, Set, Shadow );
+					}
+					Job.CoverSets[ Set ].Fraction[ Polygon ] = 1.0;
+				}
+			}
+		}
+
+	}
+
+	void
+	ReweightRaster( RasterJob & Job )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets Job.LitFraction from the cover sets of an earlier RenderRaster (with FindCoverSets)
+		// and the current Job.Transmittance, without rendering again.
+
+		int const NumLit( Job.NumSubSurfaces + 1 );
+
+		Job.LitFraction.assign( NumLit, 0.0 );
+		for ( auto const & Cover : Job.CoverSets ) {
+			Real64 Transmittance( 1.0 );
+			for ( int const Shadow : Cover.Shadows ) {
+				Transmittance *= Job.Transmittance[ Shadow ];
+			}
+			for ( int Polygon = 0; Polygon < NumLit; ++Polygon ) {
+				Job.LitFraction[ Polygon ] += Cover.Fraction[ Polygon ] * Transmittance;
+			}
+		}
+
+	}
+
+	Real64
+	PointTransmittance(
+		RasterJob const & Job,
+		Real64 const XP, // X coordinate of the point
+		Real64 const YP // Y coordinate of the point
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the product of the transmittances of the shadows covering a point.
+
+		Real64 Transmittance( 1.0 );
+		for ( int Polygon = Job.NumSubSurfaces + 1; Polygon < Job.NumPolygons(); ++Polygon ) {
+			if ( PointInPolygon( Job, Polygon, XP, YP ) ) Transmittance *= Job.Transmittance[ Polygon ];
+		}
+		return Transmittance;
+
+	}
+
+	Real64
+	RasterErrorBound(
+		RasterJob const & Job,
+		int const Resolution // Pixels along the longest side of the receiving surface
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns an upper estimate of the error in the sunlit fraction of the receiving surface
+		// that RenderRaster returns at this resolution.
+
+		// METHODOLOGY EMPLOYED:
+		// A pixel can only be misclassified if an edge of the receiving surface or of a shadow
+		// passes through it.  An edge of length L within the receiving surface's bounding box
+		// passes through at most sqrt(2)*L/h + 2 pixels of size h, each of area h*h.  The sum
+		// over all such edges, relative to the area of the receiving surface, bounds the error.
+
+		int const NumPolygons( Job.NumPolygons() );
+		if ( NumPolygons <= Job.NumSubSurfaces + 1 ) return 0.0; // No shadows: exact
+
+		Real64 XMin;
+		Real64 XMax;
+		Real64 YMin;
+		Real64 YMax;
+		PolygonBounds( Job, 0, XMin, XMax, YMin, YMax );
+		Real64 const Area( PolygonArea( Job, 0 ) );
+		if ( Area <= 0.0 ) return 0.0;
+		Real64 const PixelSize( std::max( XMax - XMin, YMax - YMin ) / std::max( Resolution, 1 ) );
+
+		Real64 ErrorArea( 0.0 );
+		for ( int Polygon = 0; Polygon < NumPolygons; ++Polygon ) {
+			if ( Polygon > 0 && Polygon <= Job.NumSubSurfaces ) continue; // Subsurfaces do not change the receiving surface result
+			int const First( Job.Start[ Polygon ] );
+			int const Last( PolygonEnd( Job, Polygon ) );
+			for ( int N = First, P = Last - 1; N < Last; P = N++ ) {
+				Real64 const Length( LengthInBox( Job.X[ P ], Job.Y[ P ], Job.X[ N ], Job.Y[ N ], XMin, XMax, YMin, YMax ) );
+				if ( Length > 0.0 ) ErrorArea += PixelSize * ( std::sqrt( 2.0 ) * Length + 2.0 * PixelSize );
+			}
+		}
+		return std::min( ErrorArea / Area, 1.0 );
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // PixelCounting
+
+} // EnergyPlus
@@ -0,0 +1,146 @@
+#ifndef PixelCounting_hh_INCLUDED
+#define PixelCounting_hh_INCLUDED
+
+// C++ Headers
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace PixelCounting {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern int const DefaultResolution; // Pixels along the longest side of a receiving surface
+	extern int const MinResolution; // Smallest resolution accepted from input
+
+	// DERIVED TYPE DEFINITIONS:
+
+	// Types
+
+	struct CoverSet // Pixels covered by the same shadows
+	{
+		// Members
+		std::vector< int > Shadows; // Shadow polygons covering these pixels (in increasing order)
+		std::vector< Real64 > Fraction; // Fraction of the pixels of polygons 0..NumSubSurfaces in this set
+
+	};
+
+	struct RasterJob // One receiving surface with its subsurfaces and the shadows cast on it
+	{
+		// Members
+		// Polygons are in the plane of the receiving surface.  Polygon 0 is the receiving surface,
+		// polygons 1..NumSubSurfaces are its subsurfaces and the rest are shadows.
+		int NumSubSurfaces;
+		bool FindCoverSets; // Keep CoverSets so that LitFraction can be found again for new transmittances
+		std::vector< Real64 > X; // Vertex X coordinates of all polygons (m)
+		std::vector< Real64 > Y; // Vertex Y coordinates of all polygons (m)
+		std::vector< int > Start; // First vertex of each polygon in X and Y
+		std::vector< Real64 > Transmittance; // Transmittance of each shadow polygon (1.0 for the others)
+		std::vector< int > Tag; // Caller's identifier of each polygon (e.g. surface number)
+		std::vector< Real64 > LitFraction; // Result: sunlit fraction of polygons 0..NumSubSurfaces
+		std::vector< CoverSet > CoverSets; // Result if FindCoverSets; set 0 is the unshaded pixels
+
+		// Default Constructor
+		RasterJob() :
+			NumSubSurfaces( 0 ),
+			FindCoverSets( false )
+		{}
+
+		void
+		clear()
+		{
+			NumSubSurfaces = 0;
+			FindCoverSets = false;
+			X.clear();
+			Y.clear();
+			Start.clear();
+			Transmittance.clear();
+			Tag.clear();
+			LitFraction.clear();
+			CoverSets.clear();
+		}
+
+		int
+		NumPolygons() const
+		{
+			return int( Start.size() );
+		}
+
+		void
+		BeginPolygon(
+			Real64 const PolygonTransmittance,
+			int const PolygonTag = 0
+		)
+		{
+			Start.push_back( int( X.size() ) );
+			Transmittance.push_back( PolygonTransmittance );
+			Tag.push_back( PolygonTag );
+		}
+
+		void
+		AddVertex(
+			Real64 const XV,
+			Real64 const YV
+		)
+		{
+			X.push_back( XV );
+			Y.push_back( YV );
+		}
+
+	};
+
+	// Functions
+
+	void
+	RenderRaster(
+		RasterJob & Job,
+		int const Resolution // Pixels along the longest side of the receiving surface
+	);
+
+	void
+	ReweightRaster( RasterJob & Job );
+
+	Real64
+	PointTransmittance(
+		RasterJob const & Job,
+		Real64 const XP, // X coordinate of the point
+		Real64 const YP // Y coordinate of the point
+	);
+
+	Real64
+	RasterErrorBound(
+		RasterJob const & Job,
+		int const Resolution // Pixels along the longest side of the receiving surface
+	);
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // PixelCounting
+
+} // EnergyPlus
+
+#endif
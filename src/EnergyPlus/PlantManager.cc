@@ -1,5 +1,6 @@
 // C++ Headers
 #include <cassert>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -96,6 +97,13 @@ namespace PlantManager {
 	FArray1D_int SupplySideOutletNode; // Node number for the supply side outlet
 	FArray1D_int DemandSideInletNode; // Inlet node on the demand side
 
+	namespace {
+		// These are purposefully not in the header file as an extern variable,
+		// no one outside of this module should be using them.
+		std::vector< std::vector< Real64 > > HalfLoopStates; // Node states after the last solution of each half loop, by calling order
+		std::vector< Real64 > CurrentHalfLoopState; // Work space for the node states of the half loop being considered
+	}
+
 	// SUBROUTINE SPECIFICATIONS:
 	//The following public routines are called from HVAC Manager
 	//PUBLIC  CheckPlantLoopData      !called from SimHVAC
@@ -122,7 +130,7 @@ namespace PlantManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Sankaranarayanan K P
 		//       DATE WRITTEN   Apr 2005
-		//       MODIFIED
+		//       MODIFIED       October 2026, skip minimum sub iteration passes of half loops that would see nothing new
 		//       RE-ENGINEERED  B. Griffith, Feb. 2010
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -132,6 +140,9 @@ namespace PlantManager {
 		// Set up the while iteration block for the plant loop simulation.
 		// Calls half loop sides to be simulated in predetermined order.
 		// Reset the flags as necessary
+		// A half loop that is only due for one of the minimum sub iterations is passed over when none
+		// of the node states it sees has changed since it was last solved in this system time step.
+		// Loops with common pipes and models with EMS are always solved.
 
 		// REFERENCES:
 		// na
@@ -173,6 +184,10 @@ namespace PlantManager {
 		IterPlant = 0;
 		InitializeLoops( FirstHVACIteration );
 
+		if ( FirstHVACIteration || HalfLoopStates.size() != std::size_t( TotNumHalfLoops ) ) {
+			HalfLoopStates.assign( TotNumHalfLoops, std::vector< Real64 >() );
+		}
+
 		while ( ( SimPlantLoops ) && ( IterPlant <= MaxPlantSubIterations ) ) {
 			// go through half loops in predetermined calling order
 			for ( HalfLoopNum = 1; HalfLoopNum <= TotNumHalfLoops; ++HalfLoopNum ) {
@@ -189,6 +204,15 @@ namespace PlantManager {
 
 				if ( SimHalfLoopFlag || IterPlant <= CurntMinPlantSubIterations ) {
 
+					auto & half_loop_state( HalfLoopStates[ HalfLoopNum - 1 ] );
+					if ( ! SimHalfLoopFlag && ! half_loop_state.empty() ) {
+						GatherHalfLoopState( LoopNum, CurrentHalfLoopState );
+						if ( CurrentHalfLoopState == half_loop_state ) {
+							++PlantManageHalfLoopSkips;
+							continue;
+						}
+					}
+
 					PlantHalfLoopSolver( FirstHVACIteration, LoopSide, LoopNum, other_loop_side.SimLoopSideNeeded );
 
 					// Always set this side to false,  so that it won't keep being turned on just because of first hvac
@@ -205,6 +229,12 @@ namespace PlantManager {
 					PlantReport( LoopNum ).LastLoopSideSimulated = LoopSide;
 
 					++PlantManageHalfLoopCalls;
+
+					if ( ! FirstHVACIteration && ! AnyEnergyManagementSystemInModel && this_loop.CommonPipeType == CommonPipe_No ) {
+						GatherHalfLoopState( LoopNum, half_loop_state );
+					} else {
+						half_loop_state.clear();
+					}
 				}
 
 			} // half loop based calling order...
@@ -0,0 +1,336 @@
+// C++ Headers
+#include <cmath>
+#include <utility>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Fmath.hh>
+
+// EnergyPlus Headers
+#include <PolygonClipping.hh>
+
+namespace EnergyPlus {
+
+namespace PolygonClipping {
+
+	// Module containing the polygon kernels of the beam shading calculation
+
+	// PURPOSE OF THIS MODULE:
+	// Every shadow is clipped against its receiving surface and the shadows before it
+	// (SolarShading::CLIPPOLY) and every figure is converted to homogeneous coordinates with
+	// its area (SolarShading::HTRANS).  These are the innermost loops of all beam shading.
+
+	// METHODOLOGY EMPLOYED:
+	// Vertices and sides are held as separate X, Y and A, B, C arrays (structure of arrays).
+	// The work done for every vertex -- the side function of all vertices against a clipping
+	// edge, the sides of a polygon and its area -- is done in straight, branch-free loops the
+	// compiler can vectorize.  Only emitting the vertices of the clipped polygon is scalar.
+	// Vertex loops run over PaddedLength entries so they need no remainder loop.  The HC arrays
+	// of SolarShading have a column length (MaxHCV+1) that is a multiple of 16, so a padded read
+	// of a figure stays within its own column.
+	// Results are the same as the original Sutherland-Hodgman CLIPPOLY: coordinates are integer
+	// valued, intersections are rounded with nint64 and near-duplicate vertices (within two
+	// HC units) are removed on the last clipping edge.  Areas are summed in Real64 one side at a
+	// time in the original HTRANS order, so they are the same to the last bit.
+
+	// REFERENCES:
+	// Sutherland, I.E. and G.W. Hodgman. 1974. Reentrant Polygon Clipping.
+	//  Communications of the ACM 17(1): 32-42.
+
+	// OTHER NOTES:
+	// na
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const ClipLanes( 4 );
+
+	namespace {
+		// Divisor used by General::SafeDivide when the divisor is zero
+		Real64 const SafeDivideSmall( 1.0e-10 );
+	}
+
+	// Functions
+
+	namespace {
+
+		inline
+		void
+		EmitVertex(
+			Real64 const X, // Vertex 'X' coordinate
+			Real64 const Y, // Vertex 'Y' coordinate
+			bool const RemoveDuplicates, // Drop the vertex if it is within two HC units of one already emitted
+			Real64 * XOut,
+			Real64 * YOut,
+			int & NumOut
+		)
+		{
+			if ( RemoveDuplicates ) {
+				for ( int K = 0; K < NumOut; ++K ) {
+					if ( std::abs( X - XOut[ K ] ) > 2.0 ) continue;
+					if ( std::abs( Y - YOut[ K ] ) > 2.0 ) continue;
+					return;
+				}
+			}
+			XOut[ NumOut ] = X;
+			YOut[ NumOut ] = Y;
+			++NumOut;
+		}
+
+		inline
+		void
+		EmitIntercept(
+			Real64 const HCA_E, // Clipping edge 'A'
+			Real64 const HCB_E, // Clipping edge 'B'
+			Real64 const HCC_E, // Clipping edge 'C'
+			Real64 const A_S, // Subject side 'A'
+			Real64 const B_S, // Subject side 'B'
+			Real64 const C_S, // Subject side 'C'
+			bool const RemoveDuplicates,
+			Real64 * XOut,
+			Real64 * YOut,
+			int & NumOut
+		)
+		{
+			Real64 const W( HCB_E * A_S - HCA_E * B_S ); // Normalization factor
+			if ( W != 0.0 ) {
+				Real64 const W_inv( 1.0 / W );
+				EmitVertex( nint64( ( HCC_E * B_S - HCB_E * C_S ) * W_inv ), nint64( ( HCA_E * C_S - HCC_E * A_S ) * W_inv ), RemoveDuplicates, XOut, YOut, NumOut );
+			} else { // Parallel lines: as General::SafeDivide
+				EmitVertex( ( HCC_E * B_S - HCB_E * C_S ) / SafeDivideSmall, ( HCA_E * C_S - HCC_E * A_S ) / SafeDivideSmall, RemoveDuplicates, XOut, YOut, NumOut );
+			}
+		}
+
+	}
+
+	int
+	PaddedLength( int const NumVertices )
+	{
+		return ( ( NumVertices + ClipLanes - 1 ) / ClipLanes ) * ClipLanes;
+	}
+
+	void
+	ReserveWorkspace(
+		ClipWorkspace & Work,
+		int const NumVertices // Vertices (plus wrap-around entry) the buffers must hold
+	)
+	{
+		if ( NumVertices <= Work.Capacity ) return;
+		int const Capacity( PaddedLength( NumVertices ) );
+		Work.X.resize( Capacity, 0.0 );
+		Work.Y.resize( Capacity, 0.0 );
+		Work.XOut.resize( Capacity, 0.0 );
+		Work.YOut.resize( Capacity, 0.0 );
+		Work.A.resize( Capacity, 0.0 );
+		Work.B.resize( Capacity, 0.0 );
+		Work.C.resize( Capacity, 0.0 );
+		Work.H.resize( Capacity, 0.0 );
+		Work.Capacity = Capacity;
+	}
+
+	Real64
+	HCSidesAndArea(
+		Int64 * X, // 'X' homogeneous coordinates of vertices; entry NumVertices is set to entry 0
+		Int64 * Y, // 'Y' homogeneous coordinates of vertices; entry NumVertices is set to entry 0
+		int const NumVertices, // Number of vertices
+		Int64 * A, // 'A' homogeneous coordinates of sides (output)
+		Int64 * B, // 'B' homogeneous coordinates of sides (output)
+		Int64 * C // 'C' homogeneous coordinates of sides (output)
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Determine the homogeneous coordinates of the sides of a polygon and return twice its
+		// signed area (in HC units squared).
+
+		// METHODOLOGY EMPLOYED:
+		// Side N runs from vertex N to vertex N+1: (A,B,C) = (X(N),Y(N),1) cross (X(N+1),Y(N+1),1).
+		// The sum of the C's is twice the area.  See SolarShading::HTRANS.  The sum is accumulated
+		// in Real64 as HTRANS did, so the areas are the same to the last bit.
+
+		X[ NumVertices ] = X[ 0 ];
+		Y[ NumVertices ] = Y[ 0 ];
+
+		Real64 SUM( 0.0 );
+		for ( int N = 0; N < NumVertices; ++N ) {
+			A[ N ] = Y[ N ] - Y[ N + 1 ];
+			B[ N ] = X[ N + 1 ] - X[ N ];
+			C[ N ] = ( Y[ N + 1 ] * X[ N ] ) - ( X[ N + 1 ] * Y[ N ] );
+			SUM += C[ N ];
+		}
+		return SUM;
+
+	}
+
+	int
+	ClipPolygon(
+		Int64 const * SubX, // Subject polygon vertex 'X' coordinates
+		Int64 const * SubY, // Subject polygon vertex 'Y' coordinates
+		Int64 const * SubA, // Subject polygon side 'A' coordinates
+		Int64 const * SubB, // Subject polygon side 'B' coordinates
+		Int64 const * SubC, // Subject polygon side 'C' coordinates
+		int const NumSubVertices, // Number of vertices of the subject polygon
+		Int64 const * ClipA, // Clipping polygon side 'A' coordinates
+		Int64 const * ClipB, // Clipping polygon side 'B' coordinates
+		Int64 const * ClipC, // Clipping polygon side 'C' coordinates
+		int const NumClipVertices, // Number of vertices of the clipping polygon
+		ClipWorkspace & Work, // Buffers; Work.X and Work.Y hold the clipped polygon on return
+		bool & Intersected // True if any side of the subject polygon was cut
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Clip the subject polygon by the (convex) clipping polygon and return the number of
+		// vertices of the result.  The subject arrays are read for PaddedLength( NumSubVertices )
+		// entries.
+
+		// METHODOLOGY EMPLOYED:
+		// Sutherland-Hodgman: the polygon is clipped by each edge of the clipping polygon in turn.
+		// For each edge the side function of all vertices is computed in one vectorizable loop;
+		// when all vertices are outside the result is empty and when all are inside (except on the
+		// last edge, where near-duplicates are removed) the polygon is unchanged.  Otherwise the
+		// output polygon is emitted vertex by vertex as in the original CLIPPOLY.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int NVOut( NumSubVertices ); // Number of vertices of the current polygon
+		bool Swapped( false ); // True when the current polygon is in Work.XOut/YOut
+
+		Intersected = false;
+		ReserveWorkspace( Work, 2 * NumSubVertices + 1 );
+		Real64 * X( Work.X.data() ); // Current polygon
+		Real64 * Y( Work.Y.data() );
+		Real64 * XOut( Work.XOut.data() ); // Polygon being built
+		Real64 * YOut( Work.YOut.data() );
+		Real64 * A( Work.A.data() );
+		Real64 * B( Work.B.data() );
+		Real64 * C( Work.C.data() );
+		Real64 * H( Work.H.data() );
+
+		// Load the subject polygon
+		for ( int P = 0, NPad = PaddedLength( NumSubVertices ); P < NPad; ++P ) {
+			X[ P ] = Real64( SubX[ P ] );
+			Y[ P ] = Real64( SubY[ P ] );
+			A[ P ] = Real64( SubA[ P ] );
+			B[ P ] = Real64( SubB[ P ] );
+			C[ P ] = Real64( SubC[ P ] );
+		}
+
+		for ( int E = 0; E < NumClipVertices; ++E ) { // Loop over edges of the clipping polygon
+			bool const LastEdge( E == NumClipVertices - 1 );
+			Real64 const HCA_E( ClipA[ E ] );
+			Real64 const HCB_E( ClipB[ E ] );
+			Real64 const HCC_E( ClipC[ E ] );
+
+			if ( 2 * NVOut + 1 > Work.Capacity ) { // Each vertex adds at most one intercept
+				if ( Swapped ) {
+					std::swap( Work.X, Work.XOut );
+					std::swap( Work.Y, Work.YOut );
+					Swapped = false;
+				}
+				ReserveWorkspace( Work, 2 * NVOut + 1 );
+				X = Work.X.data();
+				Y = Work.Y.data();
+				XOut = Work.XOut.data();
+				YOut = Work.YOut.data();
+				A = Work.A.data();
+				B = Work.B.data();
+				C = Work.C.data();
+				H = Work.H.data();
+			}
+
+			// Side function of every vertex: <= 0 is on or inside the clipping edge
+			int NumInside( 0 );
+			for ( int P = 0, NPad = PaddedLength( NVOut ); P < NPad; ++P ) {
+				H[ P ] = X[ P ] * HCA_E + Y[ P ] * HCB_E + HCC_E;
+			}
+			for ( int P = 0; P < NVOut; ++P ) {
+				NumInside += ( H[ P ] <= 0.0 );
+			}
+
+			if ( NumInside == 0 ) { // Nothing left
+				NVOut = 0;
+				break;
+			}
+
+			if ( NumInside < NVOut || LastEdge ) {
+				int NVTemp( 0 );
+				int S( NVOut - 1 ); // Previous vertex
+				if ( ! LastEdge ) {
+					for ( int P = 0; P < NVOut; ++P ) {
+						bool const InsideP( H[ P ] <= 0.0 );
+						if ( InsideP != ( H[ S ] <= 0.0 ) ) { // Side S crosses the clip edge
+							EmitIntercept( HCA_E, HCB_E, HCC_E, A[ S ], B[ S ], C[ S ], false, XOut, YOut, NVTemp );
+						}
+						XOut[ NVTemp ] = X[ P ]; // Kept only if inside
+						YOut[ NVTemp ] = Y[ P ];
+						NVTemp += InsideP;
+						S = P;
+					}
+					Intersected = true; // Some but not all vertices are inside so a side was cut
+				} else {
+					for ( int P = 0; P < NVOut; ++P ) {
+						if ( H[ P ] <= 0.0 ) {
+							if ( H[ S ] > 0.0 ) { // Entering: intersection of the clip edge and side S
+								EmitIntercept( HCA_E, HCB_E, HCC_E, A[ S ], B[ S ], C[ S ], true, XOut, YOut, NVTemp );
+								Intersected = true;
+							}
+							EmitVertex( X[ P ], Y[ P ], true, XOut, YOut, NVTemp );
+						} else if ( H[ S ] <= 0.0 ) { // Leaving: intersection of the clip edge and side S
+							EmitIntercept( HCA_E, HCB_E, HCC_E, A[ S ], B[ S ], C[ S ], true, XOut, YOut, NVTemp );
+							Intersected = true;
+						}
+						S = P;
+					}
+				}
+				NVOut = NVTemp;
+				if ( NVOut == 0 ) break;
+				std::swap( X, XOut );
+				std::swap( Y, YOut );
+				Swapped = ! Swapped;
+			}
+
+			if ( ! LastEdge && NVOut > 2 ) { // Sides of the output polygon for the next edge
+				X[ NVOut ] = X[ 0 ];
+				Y[ NVOut ] = Y[ 0 ];
+				for ( int P = 0; P < NVOut; ++P ) {
+					A[ P ] = Y[ P ] - Y[ P + 1 ];
+					B[ P ] = X[ P + 1 ] - X[ P ];
+					C[ P ] = X[ P ] * Y[ P + 1 ] - Y[ P ] * X[ P + 1 ];
+				}
+			}
+
+		} // end loop over edges of the clipping polygon
+
+		if ( Swapped ) { // Result in Work.X and Work.Y
+			std::swap( Work.X, Work.XOut );
+			std::swap( Work.Y, Work.YOut );
+		}
+
+		return NVOut;
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // PolygonClipping
+
+} // EnergyPlus
@@ -0,0 +1,106 @@
+#ifndef PolygonClipping_hh_INCLUDED
+#define PolygonClipping_hh_INCLUDED
+
+// C++ Headers
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace PolygonClipping {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern int const ClipLanes; // Vertex loops are padded to a multiple of this many entries
+
+	// DERIVED TYPE DEFINITIONS:
+
+	// Types
+
+	struct ClipWorkspace // Structure-of-arrays vertex buffers reused between clips
+	{
+		// Members
+		int Capacity; // Entries in each buffer (multiple of ClipLanes)
+		std::vector< Real64 > X; // X of the current polygon (result after ClipPolygon)
+		std::vector< Real64 > Y; // Y of the current polygon (result after ClipPolygon)
+		std::vector< Real64 > XOut; // X of the polygon being built for the next clip edge
+		std::vector< Real64 > YOut; // Y of the polygon being built for the next clip edge
+		std::vector< Real64 > A; // 'A' homogeneous coordinates of sides of the current polygon
+		std::vector< Real64 > B; // 'B' homogeneous coordinates of sides of the current polygon
+		std::vector< Real64 > C; // 'C' homogeneous coordinates of sides of the current polygon
+		std::vector< Real64 > H; // Side function of each vertex for the current clip edge
+
+		// Default Constructor
+		ClipWorkspace() :
+			Capacity( 0 )
+		{}
+
+	};
+
+	// Functions
+
+	int
+	PaddedLength( int const NumVertices );
+
+	void
+	ReserveWorkspace(
+		ClipWorkspace & Work,
+		int const NumVertices // Vertices (plus wrap-around entry) the buffers must hold
+	);
+
+	Real64
+	HCSidesAndArea(
+		Int64 * X, // 'X' homogeneous coordinates of vertices; entry NumVertices is set to entry 0
+		Int64 * Y, // 'Y' homogeneous coordinates of vertices; entry NumVertices is set to entry 0
+		int const NumVertices, // Number of vertices
+		Int64 * A, // 'A' homogeneous coordinates of sides (output)
+		Int64 * B, // 'B' homogeneous coordinates of sides (output)
+		Int64 * C // 'C' homogeneous coordinates of sides (output)
+	);
+
+	int
+	ClipPolygon(
+		Int64 const * SubX, // Subject polygon vertex 'X' coordinates
+		Int64 const * SubY, // Subject polygon vertex 'Y' coordinates
+		Int64 const * SubA, // Subject polygon side 'A' coordinates
+		Int64 const * SubB, // Subject polygon side 'B' coordinates
+		Int64 const * SubC, // Subject polygon side 'C' coordinates
+		int const NumSubVertices, // Number of vertices of the subject polygon
+		Int64 const * ClipA, // Clipping polygon side 'A' coordinates
+		Int64 const * ClipB, // Clipping polygon side 'B' coordinates
+		Int64 const * ClipC, // Clipping polygon side 'C' coordinates
+		int const NumClipVertices, // Number of vertices of the clipping polygon
+		ClipWorkspace & Work, // Buffers; Work.X and Work.Y hold the clipped polygon on return
+		bool & Intersected // True if any side of the subject polygon was cut
+	);
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // PolygonClipping
+
+} // EnergyPlus
+
+#endif
@@ -0,0 +1,636 @@
+// C++ Headers
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+// EnergyPlus Headers
+#include <ShadingCache.hh>
+
+namespace EnergyPlus {
+
+namespace ShadingCache {
+
+	// Module containing a persistent store for solar shading results
+
+	// PURPOSE OF THIS MODULE:
+	// Runs that differ only in HVAC or envelope properties repeat the identical shading
+	// calculation (sunlit fractions, back surface overlaps and sky diffuse shading ratios).
+	// This module keeps those results in a file that later runs can read back instead of
+	// redoing the polygon clipping.
+
+	// METHODOLOGY EMPLOYED:
+	// The file starts with a header holding one hash per key category (geometry, location,
+	// timing and algorithm options), computed by the caller from everything the shading
+	// results depend on.  The hash of the keys is part of the file name, so runs with different
+	// inputs use different files and never overwrite each other's records; the header keys only
+	// guard against hash collisions.  After the header come records, each identified by a caller
+	// supplied key (e.g., a hash of the sun position inputs for a shadowing period) and holding
+	// packed real and integer results.
+	// A cache file may be shared by runs going on at the same time, so it is never changed in
+	// place.  The records computed in a run are kept in memory and written when the file is
+	// closed: under an advisory lock on a companion ".lock" file, the records in the file at that
+	// time and the new ones are written to a temporary file that is then renamed over the cache
+	// file.  Readers see either the old or the new file, never one being written.  An interrupted
+	// run leaves the file as it was.
+	// Hashes are 64-bit FNV-1a over the exact bits of the values.
+	// The file handling is done on RecordFile objects so that other results (e.g., the conduction
+	// transfer functions) can be kept in files of their own with their own header keys.
+
+	// REFERENCES:
+	// Fowler, G., L.C. Noll, K.-P. Vo and D. Eastlake. The FNV Non-Cryptographic Hash Algorithm.
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const CacheDisabled( 0 );
+	int const CacheCreated( 1 );
+	int const CacheReused( 2 );
+	int const CacheInvalidated( 3 );
+	std::string const cCacheStatus[] = { "Disabled", "Created", "Reused", "Invalidated" };
+
+	int const KeyGeometry( 0 );
+	int const KeyLocation( 1 );
+	int const KeyTiming( 2 );
+	int const KeyAlgorithm( 3 );
+	int const NumCacheKeys( 4 );
+
+	std::uint64_t const HashSeed( 14695981039346656037ULL );
+
+	namespace {
+		std::uint64_t const HashPrime( 1099511628211ULL );
+		std::int32_t const FileVersion( 1 ); // Change whenever the layout of the records changes
+
+		RecordFile ShadingFile( "EPSHADE", { "geometry changed", "location changed", "shadowing frequency or timesteps changed", "shading algorithm options changed" } );
+	}
+
+	// MODULE VARIABLE DECLARATIONS:
+	int CacheStatus( CacheDisabled );
+	std::string CacheFileName;
+	std::string StatusReason;
+	int NumRecordsAvailable( 0 );
+	int NumRecordsReused( 0 );
+	int NumRecordsComputed( 0 );
+
+	// Functions
+
+	namespace {
+
+		std::uint64_t
+		HashBytes(
+			std::uint64_t Hash,
+			void const * Data,
+			std::size_t const Size
+		)
+		{
+			unsigned char const * Byte( static_cast< unsigned char const * >( Data ) );
+			for ( std::size_t I = 0; I < Size; ++I ) {
+				Hash ^= Byte[ I ];
+				Hash *= HashPrime;
+			}
+			return Hash;
+		}
+
+		template< typename T >
+		bool
+		ReadValue(
+			std::istream & Stream,
+			T & Value
+		)
+		{
+			return bool( Stream.read( reinterpret_cast< char * >( &Value ), sizeof( T ) ) );
+		}
+
+		template< typename T >
+		void
+		WriteValue(
+			std::ostream & Stream,
+			T const & Value
+		)
+		{
+			Stream.write( reinterpret_cast< char const * >( &Value ), sizeof( T ) );
+		}
+
+		// File type tag padded to 8 bytes
+		void
+		FileTag(
+			RecordFile const & File,
+			char ( & Tag )[ 8 ]
+		)
+		{
+			std::memset( Tag, 0, sizeof( Tag ) );
+			std::memcpy( Tag, File.Tag.data(), std::min( File.Tag.size(), sizeof( Tag ) - 1 ) );
+		}
+
+		// Bytes before the first record of a file with NumKeys header keys
+		std::streamoff
+		HeaderSize( std::size_t const NumKeys )
+		{
+			return std::streamoff( 8 + sizeof( std::int32_t ) + sizeof( std::int32_t ) + NumKeys * sizeof( std::uint64_t ) );
+		}
+
+		// True if NumReals reals and NumInts integers fit in the Remaining bytes of a file
+		bool
+		CountsFit(
+			std::uint64_t const NumReals,
+			std::uint64_t const NumInts,
+			std::streamoff const Remaining
+		)
+		{
+			if ( Remaining < 0 ) return false;
+			std::uint64_t const Bytes( Remaining );
+			if ( NumReals > Bytes / sizeof( Real64 ) ) return false;
+			return NumInts <= ( Bytes - NumReals * sizeof( Real64 ) ) / sizeof( std::int32_t );
+		}
+
+		// Reads the header and indexes the records; returns an empty string if the file can be reused
+		std::string
+		ScanCacheFile(
+			RecordFile const & File,
+			std::istream & Stream,
+			std::vector< std::uint64_t > const & Keys,
+			std::map< std::uint64_t, std::streamoff > & RecordIndex, // Record key to file position of its counts
+			std::streamoff & FileEnd // Length of the file
+		)
+		{
+			int const NumKeys( File.KeyDescription.size() );
+			char Tag[ 8 ];
+			char ExpectedTag[ 8 ];
+			std::int32_t Version( 0 );
+			std::int32_t FileNumKeys( 0 );
+
+			RecordIndex.clear();
+			FileTag( File, ExpectedTag );
+			if ( ! Stream.read( Tag, sizeof( Tag ) ) || std::memcmp( Tag, ExpectedTag, sizeof( Tag ) ) != 0 ) return "not a cache file of this kind";
+			if ( ! ReadValue( Stream, Version ) || Version != FileVersion ) return "cache file version changed";
+			if ( ! ReadValue( Stream, FileNumKeys ) || FileNumKeys != NumKeys ) return "cache file version changed";
+
+			std::string Reason;
+			for ( int Key = 0; Key < NumKeys; ++Key ) {
+				std::uint64_t FileKey( 0 );
+				if ( ! ReadValue( Stream, FileKey ) ) return "cache file is incomplete";
+				if ( FileKey != Keys[ Key ] ) {
+					if ( ! Reason.empty() ) Reason += "; ";
+					Reason += File.KeyDescription[ Key ];
+				}
+			}
+			if ( ! Reason.empty() ) return Reason;
+
+			Stream.seekg( 0, std::ios::end );
+			FileEnd = Stream.tellg();
+			std::streamoff Position( HeaderSize( NumKeys ) );
+			Stream.seekg( Position );
+			while ( Position < FileEnd ) {
+				std::uint64_t RecordKey( 0 );
+				std::uint64_t NumReals( 0 );
+				std::uint64_t NumInts( 0 );
+				if ( ! ReadValue( Stream, RecordKey ) || ! ReadValue( Stream, NumReals ) || ! ReadValue( Stream, NumInts ) ) return "cache file is incomplete";
+				std::streamoff const Counts( Position + std::streamoff( sizeof( RecordKey ) ) );
+				std::streamoff const Values( Counts + std::streamoff( sizeof( NumReals ) + sizeof( NumInts ) ) );
+				if ( ! CountsFit( NumReals, NumInts, FileEnd - Values ) ) return "cache file is incomplete";
+				Position = Values + std::streamoff( NumReals * sizeof( Real64 ) + NumInts * sizeof( std::int32_t ) );
+				RecordIndex[ RecordKey ] = Counts;
+				Stream.seekg( Position );
+			}
+			return std::string();
+		}
+
+		// Name of the cache file for the given header keys: the file name asked for plus the hash of the keys
+		std::string
+		KeyedFileName(
+			RecordFile const & File,
+			std::string const & FileName,
+			std::vector< std::uint64_t > const & Keys
+		)
+		{
+			std::uint64_t Hash( HashBytes( HashSeed, File.Tag.data(), File.Tag.size() ) );
+			for ( auto const Key : Keys ) {
+				Hash = HashBytes( Hash, &Key, sizeof( Key ) );
+			}
+			char Hex[ 17 ];
+			std::snprintf( Hex, sizeof( Hex ), "%016llx", static_cast< unsigned long long >( Hash ) );
+			return FileName + '.' + Hex;
+		}
+
+		// Exclusive advisory lock on a file, held while the object exists.  Runs that cannot create
+		// the lock file go on without it; the renamed writes still keep the cache file whole.
+		class FileLock
+		{
+
+		public: // Creation
+
+			explicit
+			FileLock( std::string const & LockFileName )
+			{
+#ifdef _WIN32
+				Handle = CreateFileA( LockFileName.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL );
+				if ( Handle != INVALID_HANDLE_VALUE ) {
+					OVERLAPPED Overlapped = {};
+					if ( ! LockFileEx( Handle, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &Overlapped ) ) {
+						CloseHandle( Handle );
+						Handle = INVALID_HANDLE_VALUE;
+					}
+				}
+#else
+				Descriptor = open( LockFileName.c_str(), O_RDWR | O_CREAT, 0644 );
+				if ( Descriptor >= 0 && flock( Descriptor, LOCK_EX ) != 0 ) {
+					close( Descriptor );
+					Descriptor = -1;
+				}
+#endif
+			}
+
+			~FileLock()
+			{
+#ifdef _WIN32
+				if ( Handle != INVALID_HANDLE_VALUE ) {
+					OVERLAPPED Overlapped = {};
+					UnlockFileEx( Handle, 0, 1, 0, &Overlapped );
+					CloseHandle( Handle );
+				}
+#else
+				if ( Descriptor >= 0 ) {
+					flock( Descriptor, LOCK_UN );
+					close( Descriptor );
+				}
+#endif
+			}
+
+		private: // Creation
+
+			FileLock( FileLock const & ); // Not copyable
+
+			FileLock &
+			operator =( FileLock const & ); // Not assignable
+
+		private: // Data
+
+#ifdef _WIN32
+			HANDLE Handle;
+#else
+			int Descriptor;
+#endif
+
+		};
+
+		// Renames Source over Destination in one step; returns false if that failed
+		bool
+		ReplaceFile(
+			std::string const & Source,
+			std::string const & Destination
+		)
+		{
+#ifdef _WIN32
+			return MoveFileExA( Source.c_str(), Destination.c_str(), MOVEFILE_REPLACE_EXISTING ) != 0;
+#else
+			return std::rename( Source.c_str(), Destination.c_str() ) == 0;
+#endif
+		}
+
+		// Writes one record at the current position of Stream
+		void
+		WriteRecord(
+			std::ostream & Stream,
+			std::uint64_t const RecordKey,
+			ShadingRecord const & Record
+		)
+		{
+			std::vector< std::int32_t > const Ints( Record.Ints.begin(), Record.Ints.end() );
+			WriteValue( Stream, RecordKey );
+			WriteValue( Stream, std::uint64_t( Record.Reals.size() ) );
+			WriteValue( Stream, std::uint64_t( Ints.size() ) );
+			if ( ! Record.Reals.empty() ) Stream.write( reinterpret_cast< char const * >( Record.Reals.data() ), Record.Reals.size() * sizeof( Real64 ) );
+			if ( ! Ints.empty() ) Stream.write( reinterpret_cast< char const * >( Ints.data() ), Ints.size() * sizeof( std::int32_t ) );
+		}
+
+		// Writes the records of the file as it is now and the records computed in this run to a
+		// temporary file and renames that over the cache file
+		void
+		WriteRecordFile( RecordFile & File )
+		{
+			FileLock const Lock( File.FileName + ".lock" );
+
+			// Records other runs saved since this one opened the file are kept
+			std::ifstream Current( File.FileName, std::ios::in | std::ios::binary );
+			std::map< std::uint64_t, std::streamoff > CurrentIndex;
+			std::streamoff CurrentEnd( 0 );
+			bool const KeepCurrent( Current && ScanCacheFile( File, Current, File.Keys, CurrentIndex, CurrentEnd ).empty() );
+
+			std::string const TempFileName( File.FileName + ".tmp" );
+			{
+				std::ofstream Temp( TempFileName, std::ios::out | std::ios::binary | std::ios::trunc );
+				char Tag[ 8 ];
+				FileTag( File, Tag );
+				Temp.write( Tag, sizeof( Tag ) );
+				WriteValue( Temp, FileVersion );
+				WriteValue( Temp, std::int32_t( File.KeyDescription.size() ) );
+				for ( auto const Key : File.Keys ) {
+					WriteValue( Temp, Key );
+				}
+				if ( KeepCurrent ) {
+					std::streamoff const Start( HeaderSize( File.KeyDescription.size() ) );
+					if ( CurrentEnd > Start ) {
+						Current.clear();
+						Current.seekg( Start );
+						std::vector< char > Bytes( CurrentEnd - Start );
+						if ( Current.read( Bytes.data(), Bytes.size() ) ) Temp.write( Bytes.data(), Bytes.size() );
+					}
+				}
+				for ( auto const & New : File.NewRecords ) {
+					if ( KeepCurrent && CurrentIndex.find( New.first ) != CurrentIndex.end() ) continue;
+					WriteRecord( Temp, New.first, New.second );
+				}
+				Temp.close();
+				if ( ! Temp ) {
+					std::remove( TempFileName.c_str() );
+					return;
+				}
+			}
+			Current.close();
+			if ( ! ReplaceFile( TempFileName, File.FileName ) ) std::remove( TempFileName.c_str() );
+		}
+
+		// Copies the state of the shading cache file to the module variables
+		void
+		ReportShadingFile()
+		{
+			CacheStatus = ShadingFile.Status;
+			CacheFileName = ShadingFile.FileName;
+			StatusReason = ShadingFile.StatusReason;
+			NumRecordsAvailable = ShadingFile.NumRecordsAvailable;
+			NumRecordsReused = ShadingFile.NumRecordsReused;
+			NumRecordsComputed = ShadingFile.NumRecordsComputed;
+		}
+
+	}
+
+	std::uint64_t
+	HashValue(
+		std::uint64_t const Hash,
+		Real64 const Value
+	)
+	{
+		Real64 const Bits( Value == 0.0 ? 0.0 : Value ); // -0.0 and 0.0 give the same results
+		return HashBytes( Hash, &Bits, sizeof( Bits ) );
+	}
+
+	std::uint64_t
+	HashValue(
+		std::uint64_t const Hash,
+		int const Value
+	)
+	{
+		std::int32_t const Bits( Value );
+		return HashBytes( Hash, &Bits, sizeof( Bits ) );
+	}
+
+	std::uint64_t
+	HashValue(
+		std::uint64_t const Hash,
+		bool const Value
+	)
+	{
+		unsigned char const Bits( Value ? 1 : 0 );
+		return HashBytes( Hash, &Bits, sizeof( Bits ) );
+	}
+
+	void
+	OpenRecordFile(
+		RecordFile & File,
+		std::string const & FileName, // Cache file to read and extend; the hash of the keys is appended
+		std::vector< std::uint64_t > const & Keys // Hash of each key category (one per KeyDescription)
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Opens the cache file for the current keys and indexes its records.  File.Status and
+		// File.StatusReason tell whether it was found and could be read.
+
+		CloseRecordFile( File );
+		File.FileName = KeyedFileName( File, FileName, Keys );
+		File.Keys = Keys;
+		File.StatusReason.clear();
+		File.NumRecordsAvailable = 0;
+		File.NumRecordsReused = 0;
+		File.NumRecordsComputed = 0;
+
+		// The file is only ever replaced by a rename, so once open it can be read without the lock
+		FileLock const Lock( File.FileName + ".lock" );
+		File.Stream.open( File.FileName, std::ios::in | std::ios::binary );
+		if ( ! File.Stream ) {
+			File.Status = CacheCreated;
+			File.StatusReason = "no cache file found";
+			File.Stream.close();
+			File.Stream.clear();
+		} else {
+			File.StatusReason = ScanCacheFile( File, File.Stream, Keys, File.RecordIndex, File.FileEnd );
+			if ( File.StatusReason.empty() ) {
+				File.Status = CacheReused;
+				File.NumRecordsAvailable = int( File.RecordIndex.size() );
+			} else { // Replaced when the file is closed
+				File.Status = CacheInvalidated;
+				File.RecordIndex.clear();
+				File.Stream.close();
+				File.Stream.clear();
+			}
+		}
+
+	}
+
+	void
+	DisableRecordFile(
+		RecordFile & File,
+		std::string const & Reason
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Turns the cache file off for this run, e.g., when the results depend on more than
+		// the keyed inputs.  Records computed so far are not written.
+
+		File.NewRecords.clear();
+		CloseRecordFile( File );
+		File.Status = CacheDisabled;
+		File.StatusReason = Reason;
+		File.NumRecordsAvailable = 0;
+
+	}
+
+	bool
+	GetRecord(
+		RecordFile & File,
+		std::uint64_t const RecordKey,
+		ShadingRecord & Record
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reads the record stored under RecordKey; returns false if there is none, or if the
+		// stored counts do not fit in the file.
+
+		if ( File.Status == CacheDisabled ) return false;
+		auto const New( File.NewRecords.find( RecordKey ) );
+		if ( New != File.NewRecords.end() ) {
+			Record = New->second;
+			++File.NumRecordsReused;
+			return true;
+		}
+		auto const Found( File.RecordIndex.find( RecordKey ) );
+		if ( Found == File.RecordIndex.end() ) return false;
+
+		std::uint64_t NumReals( 0 );
+		std::uint64_t NumInts( 0 );
+		File.Stream.clear();
+		File.Stream.seekg( Found->second );
+		if ( ! ReadValue( File.Stream, NumReals ) || ! ReadValue( File.Stream, NumInts ) ) return false;
+		if ( ! CountsFit( NumReals, NumInts, File.FileEnd - Found->second - std::streamoff( sizeof( NumReals ) + sizeof( NumInts ) ) ) ) return false;
+		Record.Reals.resize( NumReals );
+		std::vector< std::int32_t > Ints( NumInts );
+		if ( NumReals > 0 && ! File.Stream.read( reinterpret_cast< char * >( Record.Reals.data() ), NumReals * sizeof( Real64 ) ) ) return false;
+		if ( NumInts > 0 && ! File.Stream.read( reinterpret_cast< char * >( Ints.data() ), NumInts * sizeof( std::int32_t ) ) ) return false;
+		Record.Ints.assign( Ints.begin(), Ints.end() );
+
+		++File.NumRecordsReused;
+		return true;
+
+	}
+
+	void
+	SaveRecord(
+		RecordFile & File,
+		std::uint64_t const RecordKey,
+		ShadingRecord const & Record
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds a record to be written when the cache file is closed.  A key that is already
+		// stored is left alone.
+
+		if ( File.Status == CacheDisabled ) return;
+		if ( File.RecordIndex.find( RecordKey ) != File.RecordIndex.end() ) return;
+		if ( ! File.NewRecords.insert( std::make_pair( RecordKey, Record ) ).second ) return;
+
+		++File.NumRecordsComputed;
+
+	}
+
+	void
+	CloseRecordFile( RecordFile & File )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the records computed in this run and closes the cache file.  The status and
+		// record counts are kept for reporting.
+
+		if ( File.Stream.is_open() ) File.Stream.close();
+		File.Stream.clear();
+		File.RecordIndex.clear();
+		File.FileEnd = 0;
+		if ( File.Status != CacheDisabled && ! File.NewRecords.empty() ) WriteRecordFile( File );
+		File.NewRecords.clear();
+
+	}
+
+	void
+	OpenShadingCache(
+		std::string const & FileName, // Cache file to read and extend
+		std::vector< std::uint64_t > const & Keys // Hash of each Key* category (NumCacheKeys entries)
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Opens the shading cache file (see OpenRecordFile).
+
+		OpenRecordFile( ShadingFile, FileName, Keys );
+		ReportShadingFile();
+
+	}
+
+	void
+	DisableShadingCache( std::string const & Reason )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Turns the shading cache off for this run, e.g., when the shading results depend on more
+		// than the keyed inputs.
+
+		DisableRecordFile( ShadingFile, Reason );
+		ReportShadingFile();
+
+	}
+
+	bool
+	GetShadingRecord(
+		std::uint64_t const RecordKey,
+		ShadingRecord & Record
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reads the shading record stored under RecordKey; returns false if there is none.
+
+		bool const Found( GetRecord( ShadingFile, RecordKey, Record ) );
+		ReportShadingFile();
+		return Found;
+
+	}
+
+	void
+	SaveShadingRecord(
+		std::uint64_t const RecordKey,
+		ShadingRecord const & Record
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Appends a shading record to the cache file.
+
+		SaveRecord( ShadingFile, RecordKey, Record );
+		ReportShadingFile();
+
+	}
+
+	void
+	CloseShadingCache()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Closes the shading cache file.  The status and record counts are kept for reporting.
+
+		CloseRecordFile( ShadingFile );
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // ShadingCache
+
+} // EnergyPlus
@@ -0,0 +1,195 @@
+#ifndef ShadingCache_hh_INCLUDED
+#define ShadingCache_hh_INCLUDED
+
+// C++ Headers
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace ShadingCache {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern int const CacheDisabled; // No cache file requested, or results cannot be reused
+	extern int const CacheCreated; // No cache file for these keys existed; one is written on closing
+	extern int const CacheReused; // Existing cache file matched all keys
+	extern int const CacheInvalidated; // Existing cache file could not be read; it is replaced on closing
+	extern std::string const cCacheStatus[]; // Report name of each Cache* status
+
+	extern int const KeyGeometry; // Shading-relevant surface geometry
+	extern int const KeyLocation; // Site latitude, longitude and time zone
+	extern int const KeyTiming; // ShadowingCalcFrequency and time steps per hour
+	extern int const KeyAlgorithm; // Solar distribution, clipping and integration options
+	extern int const NumCacheKeys;
+
+	extern std::uint64_t const HashSeed; // Starting value for HashValue chains
+
+	// DERIVED TYPE DEFINITIONS:
+
+	// Types
+
+	struct ShadingRecord // Results of one shading (or other cached) calculation, packed by the caller
+	{
+		// Members
+		std::vector< Real64 > Reals;
+		std::vector< int > Ints;
+
+		void
+		clear()
+		{
+			Reals.clear();
+			Ints.clear();
+		}
+
+	};
+
+	struct RecordFile // A cache file of keyed records with the keys of the inputs it was made from
+	{
+		// Members
+		std::string Tag; // File type written at the start of the file (at most 7 characters)
+		std::vector< std::string > KeyDescription; // Reported reason when each header key differs
+		int Status; // One of the Cache* parameters
+		std::string FileName; // Cache file in use: the name asked for plus the hash of the keys
+		std::string StatusReason; // Why the file was disabled or invalidated
+		int NumRecordsAvailable; // Records found in the file when it was opened
+		int NumRecordsReused; // Records read back instead of being computed
+		int NumRecordsComputed; // Records computed and added to the file
+		std::vector< std::uint64_t > Keys; // Header keys of the file
+		std::ifstream Stream; // The file as it was when opened
+		std::streamoff FileEnd; // Length of the file when opened
+		std::map< std::uint64_t, std::streamoff > RecordIndex; // Record key to file position of its counts
+		std::map< std::uint64_t, ShadingRecord > NewRecords; // Records computed in this run, written on closing
+
+		// Member Constructor
+		RecordFile(
+			std::string const & Tag,
+			std::vector< std::string > const & KeyDescription
+		) :
+			Tag( Tag ),
+			KeyDescription( KeyDescription ),
+			Status( CacheDisabled ),
+			NumRecordsAvailable( 0 ),
+			NumRecordsReused( 0 ),
+			NumRecordsComputed( 0 ),
+			FileEnd( 0 )
+		{}
+
+	};
+
+	// MODULE VARIABLE DECLARATIONS:
+	extern int CacheStatus; // One of the Cache* parameters
+	extern std::string CacheFileName; // Cache file in use (empty if disabled)
+	extern std::string StatusReason; // Why the cache was disabled or invalidated
+	extern int NumRecordsAvailable; // Records found in the cache file when it was opened
+	extern int NumRecordsReused; // Records read back instead of being computed
+	extern int NumRecordsComputed; // Records computed and added to the cache file
+
+	// Functions
+
+	std::uint64_t
+	HashValue(
+		std::uint64_t const Hash,
+		Real64 const Value
+	);
+
+	std::uint64_t
+	HashValue(
+		std::uint64_t const Hash,
+		int const Value
+	);
+
+	std::uint64_t
+	HashValue(
+		std::uint64_t const Hash,
+		bool const Value
+	);
+
+	void
+	OpenRecordFile(
+		RecordFile & File,
+		std::string const & FileName, // Cache file to read and extend; the hash of the keys is appended
+		std::vector< std::uint64_t > const & Keys // Hash of each key category (one per KeyDescription)
+	);
+
+	void
+	DisableRecordFile(
+		RecordFile & File,
+		std::string const & Reason
+	);
+
+	bool
+	GetRecord(
+		RecordFile & File,
+		std::uint64_t const RecordKey,
+		ShadingRecord & Record
+	);
+
+	void
+	SaveRecord(
+		RecordFile & File,
+		std::uint64_t const RecordKey,
+		ShadingRecord const & Record
+	);
+
+	void
+	CloseRecordFile( RecordFile & File );
+
+	void
+	OpenShadingCache(
+		std::string const & FileName, // Cache file to read and extend
+		std::vector< std::uint64_t > const & Keys // Hash of each Key* category (NumCacheKeys entries)
+	);
+
+	void
+	DisableShadingCache( std::string const & Reason );
+
+	bool
+	GetShadingRecord(
+		std::uint64_t const RecordKey,
+		ShadingRecord & Record
+	);
+
+	void
+	SaveShadingRecord(
+		std::uint64_t const RecordKey,
+		ShadingRecord const & Record
+	);
+
+	void
+	CloseShadingCache();
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // ShadingCache
+
+} // EnergyPlus
+
+#endif
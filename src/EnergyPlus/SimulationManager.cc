@@ -78,12 +78,15 @@ extern "C" {
 #include <Psychrometrics.hh>
 #include <RefrigeratedCase.hh>
 #include <SetPointManager.hh>
+#include <ShadingCache.hh>
 #include <SizingManager.hh>
 #include <SolarShading.hh>
 #include <SQLiteProcedures.hh>
 #include <SystemReports.hh>
 #include <UtilityRoutines.hh>
 #include <WeatherManager.hh>
+#include <WindowComplexManager.hh>
+#include <WindowEquivalentLayer.hh>
 #include <ZoneContaminantPredictorCorrector.hh>
 #include <ZoneTempPredictorCorrector.hh>
 #include <ZoneEquipmentManager.hh>
@@ -1430,6 +1433,23 @@ namespace SimulationManager {
 			gio::write( OutputFileInits, fmtA ) << "! <ConductionFiniteDifference Numerical Parameters>, Starting Relaxation Factor, Final Relaxation Factor";
 			gio::write( OutputFileInits, fmtA ) << "ConductionFiniteDifference Numerical Parameters, " + RoundSigDigits( CondFDRelaxFactorInput, 3 ) + ", " + RoundSigDigits( CondFDRelaxFactor, 3 );
 		}
+		if ( ShadingCache::CacheStatus != ShadingCache::CacheDisabled ) { // report use of the shading result cache
+			gio::write( OutputFileInits, fmtA ) << "! <Shading Result Cache Usage>, Records Reused, Records Computed";
+			gio::write( OutputFileInits, fmtA ) << "Shading Result Cache Usage," + RoundSigDigits( ShadingCache::NumRecordsReused ) + ',' + RoundSigDigits( ShadingCache::NumRecordsComputed );
+			ShadingCache::CloseShadingCache();
+		}
+		if ( PixelCountingShading && SolarShading::MaxRasterErrorSurface > 0 ) { // report accuracy of pixel counting shading
+			gio::write( OutputFileInits, fmtA ) << "! <Pixel Counting Shading Error>, Pixel Counting Resolution, Maximum Sunlit Fraction Error Bound, Surface Name";
+			gio::write( OutputFileInits, fmtA ) << "Pixel Counting Shading Error," + RoundSigDigits( PixelCountingResolution ) + ',' + RoundSigDigits( SolarShading::MaxRasterErrorBound, 4 ) + ',' + DataSurfaces::Surface( SolarShading::MaxRasterErrorSurface ).Name;
+		}
+		if ( WindowComplexManager::NumTARCOGSolved + WindowComplexManager::NumTARCOGReused > 0 ) { // report complex fenestration solution reuse
+			gio::write( OutputFileInits, fmtA ) << "! <Complex Fenestration Solution Reuse>, Solutions Calculated, Solutions Reused, Warm Starts";
+			gio::write( OutputFileInits, fmtA ) << "Complex Fenestration Solution Reuse," + RoundSigDigits( WindowComplexManager::NumTARCOGSolved ) + ',' + RoundSigDigits( WindowComplexManager::NumTARCOGReused ) + ',' + RoundSigDigits( WindowComplexManager::NumTARCOGWarmStarts );
+		}
+		if ( WindowEquivalentLayer::NumEQLOpticsCalculated + WindowEquivalentLayer::NumEQLOpticsReused > 0 ) { // report equivalent layer optics sharing
+			gio::write( OutputFileInits, fmtA ) << "! <Equivalent Layer Optics Sharing>, Properties Calculated, Properties Reused";
+			gio::write( OutputFileInits, fmtA ) << "Equivalent Layer Optics Sharing," + RoundSigDigits( WindowEquivalentLayer::NumEQLOpticsCalculated ) + ',' + RoundSigDigits( WindowEquivalentLayer::NumEQLOpticsReused );
+		}
 		// Report number of threads to eio file
 		if ( Threading ) {
 			if ( iEnvSetThreads == 0 ) {
@@ -1,5 +1,6 @@
 // C++ Headers
 #include <cmath>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -16,6 +17,7 @@
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <ScheduleManager.hh>
+#include <SurfaceBVH.hh>
 #include <Vectors.hh>
 
 namespace EnergyPlus {
@@ -47,6 +49,7 @@ namespace SolarReflectionManager {
 	using namespace DataEnvironment;
 
 	using namespace DataVectorTypes;
+	using SurfaceBVH::SurfacesAlongRay;
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS:na
@@ -97,7 +100,6 @@ namespace SolarReflectionManager {
 		int SurfNum; // Surface number
 		int RecSurfNum; // Receiving surface number
 		int loop; // DO loop indices
-		int loop1; // DO loop indices
 		int loopA; // DO loop indices
 		int loopB; // DO loop indices
 		int ObsSurfNum; // Surface number of an obstruction
@@ -106,9 +108,7 @@ namespace SolarReflectionManager {
 		Vector3< Real64 > RecVec; // First vertex of a receiving surface (m)
 		Vector3< Real64 > ObsVec; // A vertex of a candidate obstructing surface (m)
 		Vector3< Real64 > VecAB; // Vector from receiving surface vertex to obstruction surface vertex (m)
-		Vector3< Real64 > HitPt; // Hit point (m)
 		Real64 DotProd; // Dot product of vectors (m2)
-		int RecPtNum; // Receiving point number
 		//unused  REAL(r64)         :: SumX                 ! Sum of X (or Y or Z) coordinate values of a surface
 		//unused  REAL(r64)         :: SumY                 ! Sum of X (or Y or Z) coordinate values of a surface
 		//unused  REAL(r64)         :: SumZ                 ! Sum of X (or Y or Z) coordinate values of a surface
@@ -131,24 +131,6 @@ namespace SolarReflectionManager {
 		Vector3< Real64 > URay; // Unit vector along ray pointing away from receiving surface
 		Real64 CosIncAngRay; // Cosine of angle of incidence of ray on receiving surface
 		Real64 dOmega; // Solid angle associated with a ray
-		int IHit; // = 1 if obstruction is hit, 0 otherwise
-		int TotObstructionsHit; // Number of obstructions hit by a ray
-		Real64 HitDistance; // Distance from receiving point to hit point for a ray (m)
-		int NearestHitSurfNum; // Surface number of nearest obstruction hit by a ray
-		Vector3< Real64 > NearestHitPt; // Nearest hit pit for a ray (m)
-		Real64 NearestHitDistance; // Distance from receiving point to nearest hit point for a ray (m)
-		int ObsSurfNumToSkip; // Surface number of obstruction to be ignored
-		Vector3< Real64 > RecPt; // Receiving point (m)
-		Vector3< Real64 > RayVec; // Unit vector along ray
-		Vector3< Real64 > Vec1; // Vectors between hit surface vertices (m)
-		Vector3< Real64 > Vec2; // Vectors between hit surface vertices (m)
-		Vector3< Real64 > VNorm; // For a hit surface, unit normal vector pointing into the hemisphere
-		// containing the receiving point
-		int ObsConstrNum; // Construction number of obstruction; = 0 if a shading surface
-		Real64 Alfa; // Direction angles for ray heading towards the ground (radians)
-		Real64 Beta;
-		Real64 HorDis; // Distance between ground hit point and proj'n of receiving pt onto ground (m)
-		Vector3< Real64 > GroundHitPt; // Coordinates of ground hit point
 		//unused  REAL(r64)         :: ArgASin
 		Real64 ACosTanTan;
 		int J; // DO loop indices
@@ -157,7 +139,6 @@ namespace SolarReflectionManager {
 		int NumRecPts; // Number of surface receiving points for reflected solar radiation
 		Real64 VertexWt; // Vertex weighting factor for calculating receiving points
 
-		static Vector3< Real64 > const unit_z( 0.0, 0.0, 1.0 );
 		static Vector3< Real64 > const zero3( 0.0 );
 
 		// FLOW:
@@ -416,111 +397,203 @@ namespace SolarReflectionManager {
 		// (hit point = point that ray intersects nearest obstruction, or, if ray is downgoing and hits no
 		// obstructions, point that ray intersects ground plane).
 
+		// The rays of each receiving surface only write to that surface's hit point data
+		SurfaceBVH::EnsureSurfaceBVH(); // Build before the threads query it
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic )
+#endif
 		for ( RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
-			SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
-			for ( RecPtNum = 1; RecPtNum <= SolReflRecSurf( RecSurfNum ).NumRecPts; ++RecPtNum ) {
-				RecPt = SolReflRecSurf( RecSurfNum ).RecPt( RecPtNum );
-				for ( RayNum = 1; RayNum <= SolReflRecSurf( RecSurfNum ).NumReflRays; ++RayNum ) {
-					IHit = 0;
-					// Loop over possible obstructions. If ray hits one or more obstructions get hit point on closest obstruction.
-					// If ray hits no obstructions and is going upward set HitPointSurfNum = 0.
-					// If ray hits no obstructions and is going downward set HitPointSurfNum = -1 and get hit point on ground.
-					TotObstructionsHit = 0;
-					NearestHitSurfNum = 0;
-					NearestHitDistance = 1.0e+8;
-					ObsSurfNumToSkip = 0;
-					RayVec = SolReflRecSurf( RecSurfNum ).RayVec( RayNum );
-					for ( loop1 = 1; loop1 <= SolReflRecSurf( RecSurfNum ).NumPossibleObs; ++loop1 ) {
-						// Surface number of this obstruction
-						ObsSurfNum = SolReflRecSurf( RecSurfNum ).PossibleObsSurfNums( loop1 );
-						// If a window was hit previously (see below), ObsSurfNumToSkip was set to the window's base surface in order
-						// to remove that surface from consideration as a hit surface for this ray
-						if ( ObsSurfNum == ObsSurfNumToSkip ) continue;
-						// Determine if this ray hits ObsSurfNum (in which case IHit > 0) and, if so, what the
-						// distance from the receiving point to the hit point is
-						PierceSurface( ObsSurfNum, RecPt, RayVec, IHit, HitPt );
-						if ( IHit > 0 ) {
-							// added TH 3/29/2010 to set ObsSurfNumToSkip
-							if ( Surface( ObsSurfNum ).Class == SurfaceClass_Window ) {
-								ObsSurfNumToSkip = Surface( ObsSurfNum ).BaseSurf;
-							}
+			FigureSolReflHitPoints( RecSurfNum );
+		}
+
+	}
+
+	void
+	FigureSolReflHitPoints( int const RecSurfNum )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Fred Winkelmann
+		//       DATE WRITTEN   September 2003
+		//       MODIFIED       Moved out of InitSolReflRecSurf so that receiving surfaces can be done in parallel
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// For each ray from each receiving point of a receiving surface, finds the hit point (point that
+		// the ray intersects the nearest obstruction, or, if the ray is downgoing and hits no obstructions,
+		// point that the ray intersects the ground plane) and the information associated with that point.
+
+		// METHODOLOGY EMPLOYED:
+		// Only the possible obstructions whose bounding box the ray enters are tested (PossibleObsAlongRay).
+		// They are tested in ascending surface number, as in the full list, so ties resolve the same way.
+
+		// REFERENCES: na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// RecSurfNum: Receiving surface number
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static Vector3< Real64 > const unit_z( 0.0, 0.0, 1.0 );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int RecPtNum; // Receiving point number
+		int RayNum; // Ray number
+		Vector3< Real64 > HitPt; // Hit point (m)
+		int IHit; // = 1 if obstruction is hit, 0 otherwise
+		int TotObstructionsHit; // Number of obstructions hit by a ray
+		Real64 HitDistance; // Distance from receiving point to hit point for a ray (m)
+		int NearestHitSurfNum; // Surface number of nearest obstruction hit by a ray
+		Vector3< Real64 > NearestHitPt; // Nearest hit pit for a ray (m)
+		Real64 NearestHitDistance; // Distance from receiving point to nearest hit point for a ray (m)
+		int ObsSurfNumToSkip; // Surface number of obstruction to be ignored
+		Vector3< Real64 > RecPt; // Receiving point (m)
+		Vector3< Real64 > RayVec; // Unit vector along ray
+		Vector3< Real64 > Vec1; // Vectors between hit surface vertices (m)
+		Vector3< Real64 > Vec2; // Vectors between hit surface vertices (m)
+		Vector3< Real64 > VNorm; // For a hit surface, unit normal vector pointing into the hemisphere
+		// containing the receiving point
+		int ObsConstrNum; // Construction number of obstruction; = 0 if a shading surface
+		Real64 Alfa; // Direction angles for ray heading towards the ground (radians)
+		Real64 Beta;
+		Real64 HorDis; // Distance between ground hit point and proj'n of receiving pt onto ground (m)
+		Vector3< Real64 > GroundHitPt; // Coordinates of ground hit point
+		static thread_local std::vector< int > ObsSurfNums; // Possible obstructions along a ray
+
+		// FLOW:
+		for ( RecPtNum = 1; RecPtNum <= SolReflRecSurf( RecSurfNum ).NumRecPts; ++RecPtNum ) {
+			RecPt = SolReflRecSurf( RecSurfNum ).RecPt( RecPtNum );
+			for ( RayNum = 1; RayNum <= SolReflRecSurf( RecSurfNum ).NumReflRays; ++RayNum ) {
+				IHit = 0;
+				// Loop over possible obstructions. If ray hits one or more obstructions get hit point on closest obstruction.
+				// If ray hits no obstructions and is going upward set HitPointSurfNum = 0.
+				// If ray hits no obstructions and is going downward set HitPointSurfNum = -1 and get hit point on ground.
+				TotObstructionsHit = 0;
+				NearestHitSurfNum = 0;
+				NearestHitDistance = 1.0e+8;
+				ObsSurfNumToSkip = 0;
+				RayVec = SolReflRecSurf( RecSurfNum ).RayVec( RayNum );
+				PossibleObsAlongRay( RecSurfNum, RecPt, RayVec, ObsSurfNums );
+				for ( int const ObsSurfNum : ObsSurfNums ) {
+					// If a window was hit previously (see below), ObsSurfNumToSkip was set to the window's base surface in order
+					// to remove that surface from consideration as a hit surface for this ray
+					if ( ObsSurfNum == ObsSurfNumToSkip ) continue;
+					// Determine if this ray hits ObsSurfNum (in which case IHit > 0) and, if so, what the
+					// distance from the receiving point to the hit point is
+					PierceSurface( ObsSurfNum, RecPt, RayVec, IHit, HitPt );
+					if ( IHit > 0 ) {
+						// added TH 3/29/2010 to set ObsSurfNumToSkip
+						if ( Surface( ObsSurfNum ).Class == SurfaceClass_Window ) {
+							ObsSurfNumToSkip = Surface( ObsSurfNum ).BaseSurf;
+						}
 
-							// If obstruction is a window and its base surface is the nearest obstruction hit so far,
-							// set NearestHitSurfNum to this window. Note that in this case NearestHitDistance has already
-							// been calculated, so does not have to be recalculated.
-							if ( Surface( ObsSurfNum ).Class == SurfaceClass_Window && Surface( ObsSurfNum ).BaseSurf == NearestHitSurfNum ) {
+						// If obstruction is a window and its base surface is the nearest obstruction hit so far,
+						// set NearestHitSurfNum to this window. Note that in this case NearestHitDistance has already
+						// been calculated, so does not have to be recalculated.
+						if ( Surface( ObsSurfNum ).Class == SurfaceClass_Window && Surface( ObsSurfNum ).BaseSurf == NearestHitSurfNum ) {
+							NearestHitSurfNum = ObsSurfNum;
+						} else {
+							++TotObstructionsHit;
+							// Distance from receiving point to hit point
+							HitDistance = distance( HitPt, RecPt );
+							// Reset NearestHitSurfNum and NearestHitDistance if this hit point is closer than previous closest
+							if ( HitDistance < NearestHitDistance ) {
+								NearestHitDistance = HitDistance;
 								NearestHitSurfNum = ObsSurfNum;
-							} else {
-								++TotObstructionsHit;
-								// Distance from receiving point to hit point
-								HitDistance = distance( HitPt, RecPt );
-								// Reset NearestHitSurfNum and NearestHitDistance if this hit point is closer than previous closest
-								if ( HitDistance < NearestHitDistance ) {
-									NearestHitDistance = HitDistance;
+								NearestHitPt = HitPt;
+							} else if ( HitDistance == NearestHitDistance ) { // TH2 CR8959
+								// Ray hits mirrored surfaces. Choose the surface facing the ray.
+								if ( dot( Surface( ObsSurfNum ).OutNormVec, RayVec ) <= 0.0 ) {
 									NearestHitSurfNum = ObsSurfNum;
-									NearestHitPt = HitPt;
-								} else if ( HitDistance == NearestHitDistance ) { // TH2 CR8959
-									// Ray hits mirrored surfaces. Choose the surface facing the ray.
-									if ( dot( Surface( ObsSurfNum ).OutNormVec, RayVec ) <= 0.0 ) {
-										NearestHitSurfNum = ObsSurfNum;
-									}
 								}
 							}
-						} // End of check if obstruction was hit
-					} // End of loop over possible obstructions for this ray
-
-					if ( TotObstructionsHit > 0 ) {
-						// One or more obstructions were hit by this ray
-						SolReflRecSurf( RecSurfNum ).HitPtSurfNum( RecPtNum, RayNum ) = NearestHitSurfNum;
-						SolReflRecSurf( RecSurfNum ).RecPtHitPtDis( RecPtNum, RayNum ) = NearestHitDistance;
-						SolReflRecSurf( RecSurfNum ).HitPt( RecPtNum, RayNum ) = NearestHitPt;
-						// For hit surface, calculate unit normal vector pointing into the hemisphere
-						// containing the receiving point
-						( Surface( NearestHitSurfNum ).Vertex( 1 ) - Surface( NearestHitSurfNum ).Vertex( 3 ) ).assign_to( Vec1 );
-						( Surface( NearestHitSurfNum ).Vertex( 2 ) - Surface( NearestHitSurfNum ).Vertex( 3 ) ).assign_to( Vec2 );
-						VNorm = cross( Vec1, Vec2 );
-						VNorm.normalize(); //Do Handle magnitude==0
-						if ( dot( VNorm, -RayVec ) < 0.0 ) VNorm = -VNorm;
-						SolReflRecSurf( RecSurfNum ).HitPtNormVec( RecPtNum, RayNum ) = VNorm;
-						// Get solar and visible beam-to-diffuse reflectance at nearest hit point
-						ObsConstrNum = Surface( NearestHitSurfNum ).Construction;
-						if ( ObsConstrNum > 0 ) {
-							// Exterior building surface is nearest hit
-							if ( ! Construct( ObsConstrNum ).TypeIsWindow ) {
-								// Obstruction is not a window, i.e., is an opaque surface
-								SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RecPtNum, RayNum ) = 1.0 - Construct( ObsConstrNum ).OutsideAbsorpSolar;
-							} else {
-								// Obstruction is a window. Assume it is bare so that there is no beam-to-diffuse reflection
-								// (beam-to-beam reflection is calculated in subroutine CalcBeamSolSpecularReflFactors).
-								SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RecPtNum, RayNum ) = 0.0;
-							}
+						}
+					} // End of check if obstruction was hit
+				} // End of loop over possible obstructions for this ray
+
+				if ( TotObstructionsHit > 0 ) {
+					// One or more obstructions were hit by this ray
+					SolReflRecSurf( RecSurfNum ).HitPtSurfNum( RecPtNum, RayNum ) = NearestHitSurfNum;
+					SolReflRecSurf( RecSurfNum ).RecPtHitPtDis( RecPtNum, RayNum ) = NearestHitDistance;
+					SolReflRecSurf( RecSurfNum ).HitPt( RecPtNum, RayNum ) = NearestHitPt;
+					// For hit surface, calculate unit normal vector pointing into the hemisphere
+					// containing the receiving point
+					( Surface( NearestHitSurfNum ).Vertex( 1 ) - Surface( NearestHitSurfNum ).Vertex( 3 ) ).assign_to( Vec1 );
+					( Surface( NearestHitSurfNum ).Vertex( 2 ) - Surface( NearestHitSurfNum ).Vertex( 3 ) ).assign_to( Vec2 );
+					VNorm = cross( Vec1, Vec2 );
+					VNorm.normalize(); //Do Handle magnitude==0
+					if ( dot( VNorm, -RayVec ) < 0.0 ) VNorm = -VNorm;
+					SolReflRecSurf( RecSurfNum ).HitPtNormVec( RecPtNum, RayNum ) = VNorm;
+					// Get solar and visible beam-to-diffuse reflectance at nearest hit point
+					ObsConstrNum = Surface( NearestHitSurfNum ).Construction;
+					if ( ObsConstrNum > 0 ) {
+						// Exterior building surface is nearest hit
+						if ( ! Construct( ObsConstrNum ).TypeIsWindow ) {
+							// Obstruction is not a window, i.e., is an opaque surface
+							SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RecPtNum, RayNum ) = 1.0 - Construct( ObsConstrNum ).OutsideAbsorpSolar;
 						} else {
-							// Shading surface is nearest hit
-							SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RecPtNum, RayNum ) = Surface( NearestHitSurfNum ).ShadowSurfDiffuseSolRefl;
+							// Obstruction is a window. Assume it is bare so that there is no beam-to-diffuse reflection
+							// (beam-to-beam reflection is calculated in subroutine CalcBeamSolSpecularReflFactors).
+							SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RecPtNum, RayNum ) = 0.0;
 						}
 					} else {
-						// No obstructions were hit by this ray
-						SolReflRecSurf( RecSurfNum ).HitPtSurfNum( RecPtNum, RayNum ) = 0;
-						// If ray is going downward find the hit point on the ground plane if the receiving point
-						// is above ground level; note that GroundLevelZ is <= 0.0
-						if ( RayVec( 3 ) < 0.0 && SolReflRecSurf( RecSurfNum ).RecPt( RecPtNum ).z > GroundLevelZ ) {
-							// Ray hits ground
-							Alfa = std::acos( -RayVec.z );
-							Beta = std::atan2( RayVec.y, RayVec.x );
-							HorDis = ( RecPt.z - GroundLevelZ ) * std::tan( Alfa );
-							GroundHitPt.z = GroundLevelZ;
-							GroundHitPt.x = RecPt.x + HorDis * std::cos( Beta );
-							GroundHitPt.y = RecPt.y + HorDis * std::sin( Beta );
-							SolReflRecSurf( RecSurfNum ).HitPt( RecPtNum, RayNum ) = GroundHitPt;
-							SolReflRecSurf( RecSurfNum ).HitPtSurfNum( RecPtNum, RayNum ) = -1;
-							SolReflRecSurf( RecSurfNum ).RecPtHitPtDis( RecPtNum, RayNum ) = ( RecPt( 3 ) - GroundLevelZ ) / ( -RayVec( 3 ) );
-							SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RecPtNum, RayNum ) = GndReflectance;
-							SolReflRecSurf( RecSurfNum ).HitPtNormVec( RecPtNum, RayNum ) = unit_z;
-						} // End of check if ray hits ground
-					} // End of check if obstruction hit
-				} // End of RayNum loop
-			} // End of receiving point loop
-		} // End of receiving surface loop
+						// Shading surface is nearest hit
+						SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RecPtNum, RayNum ) = Surface( NearestHitSurfNum ).ShadowSurfDiffuseSolRefl;
+					}
+				} else {
+					// No obstructions were hit by this ray
+					SolReflRecSurf( RecSurfNum ).HitPtSurfNum( RecPtNum, RayNum ) = 0;
+					// If ray is going downward find the hit point on the ground plane if the receiving point
+					// is above ground level; note that GroundLevelZ is <= 0.0
+					if ( RayVec( 3 ) < 0.0 && SolReflRecSurf( RecSurfNum ).RecPt( RecPtNum ).z > GroundLevelZ ) {
+						// Ray hits ground
+						Alfa = std::acos( -RayVec.z );
+						Beta = std::atan2( RayVec.y, RayVec.x );
+						HorDis = ( RecPt.z - GroundLevelZ ) * std::tan( Alfa );
+						GroundHitPt.z = GroundLevelZ;
+						GroundHitPt.x = RecPt.x + HorDis * std::cos( Beta );
+						GroundHitPt.y = RecPt.y + HorDis * std::sin( Beta );
+						SolReflRecSurf( RecSurfNum ).HitPt( RecPtNum, RayNum ) = GroundHitPt;
+						SolReflRecSurf( RecSurfNum ).HitPtSurfNum( RecPtNum, RayNum ) = -1;
+						SolReflRecSurf( RecSurfNum ).RecPtHitPtDis( RecPtNum, RayNum ) = ( RecPt( 3 ) - GroundLevelZ ) / ( -RayVec( 3 ) );
+						SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RecPtNum, RayNum ) = GndReflectance;
+						SolReflRecSurf( RecSurfNum ).HitPtNormVec( RecPtNum, RayNum ) = unit_z;
+					} // End of check if ray hits ground
+				} // End of check if obstruction hit
+			} // End of RayNum loop
+		} // End of receiving point loop
+
+	}
+
+	void
+	PossibleObsAlongRay(
+		int const RecSurfNum, // Receiving surface number
+		Vector3< Real64 > const & Origin, // Point from which the ray originates (m)
+		Vector3< Real64 > const & RayVec, // Direction of the ray
+		std::vector< int > & ObsSurfNums // Possible obstructions of RecSurfNum that the ray may hit, ascending
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Returns the possible obstructions of a receiving surface that a ray may pierce, so that
+		// PierceSurface is called for a few surfaces instead of all of PossibleObsSurfNums.
+
+		// METHODOLOGY EMPLOYED:
+		// The candidates from the surface bounding volume hierarchy and PossibleObsSurfNums are both
+		// in ascending order, so they are merged in a single pass.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static thread_local std::vector< int > Candidates; // Surfaces whose bounding box the ray enters
+		auto const & RecSurf( SolReflRecSurf( RecSurfNum ) );
+		int Pos( 1 ); // Position in PossibleObsSurfNums
+
+		ObsSurfNums.clear();
+		SurfacesAlongRay( Origin, RayVec, Candidates );
+		for ( int const SurfNum : Candidates ) {
+			while ( Pos <= RecSurf.NumPossibleObs && RecSurf.PossibleObsSurfNums( Pos ) < SurfNum ) ++Pos;
+			if ( Pos > RecSurf.NumPossibleObs ) break;
+			if ( RecSurf.PossibleObsSurfNums( Pos ) == SurfNum ) ObsSurfNums.push_back( SurfNum );
+		}
 
 	}
 
@@ -614,43 +687,42 @@ namespace SolarReflectionManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Vector3< Real64 > SunVec( 0.0 ); // Unit vector to sun
-		static int RecSurfNum( 0 ); // Receiving surface number
-		static int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
-		static int RecPtNum( 0 ); // Receiving point number
-		static int NumRecPts( 0 ); // Number of receiving points on a receiving surface
-		static int HitPtSurfNum( 0 ); // Surface number of hit point: -1 = ground,
-		// 0 = sky or obstruction with receiving point below ground level,
-		// >0 = obstruction with receiving point above ground level
-		FArray1D< Real64 > ReflBmToDiffSolObs( MaxRecPts ); // Irradiance at a receiving point for
-		// beam solar diffusely reflected from obstructions, divided by
-		// beam normal irradiance
-		FArray1D< Real64 > ReflBmToDiffSolGnd( MaxRecPts ); // Irradiance at a receiving point for
-		// beam solar diffusely reflected from the ground, divided by
-		// beam normal irradiance
-		static int RayNum( 0 ); // Ray number
-		static int IHit( 0 ); // > 0 if obstruction is hit; otherwise = 0
-		static Vector3< Real64 > OriginThisRay( 0.0 ); // Origin point of a ray (m)
-		static Vector3< Real64 > ObsHitPt( 0.0 ); // Hit point on obstruction (m)
-		static int ObsSurfNum( 0 ); // Obstruction surface number
-		static Real64 CosIncBmAtHitPt( 0.0 ); // Cosine of incidence angle of beam solar at hit point
-		static Real64 CosIncBmAtHitPt2( 0.0 ); // Cosine of incidence angle of beam solar at hit point,
-		//  the mirrored shading surface
-		static Real64 BmReflSolRadiance( 0.0 ); // Solar radiance at hit point due to incident beam, divided
-		//  by beam normal irradiance
-		static Real64 dReflBeamToDiffSol( 0.0 ); // Contribution to reflection factor at a receiving point
-		//  from beam solar reflected from a hit point
-		static Real64 SunLitFract( 0.0 ); // Sunlit fraction
-
-		ReflBmToDiffSolObs = 0.0;
-		ReflBmToDiffSolGnd = 0.0;
+		Vector3< Real64 > SunVec; // Unit vector to sun
 
 		// Unit vector to sun
 		SunVec = SUNCOSHR( {1,3}, iHour );
 
-		// loop through each surface that can receive beam solar reflected as diffuse solar from other surfaces
-		for ( RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
-			SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
+		// loop through each surface that can receive beam solar reflected as diffuse solar from other surfaces.
+		// Each receiving surface only writes its own reflection factors, so they are done in parallel.
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic )
+#endif
+		for ( int RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
+			int const SurfNum( SolReflRecSurf( RecSurfNum ).SurfNum ); // Heat transfer surface number corresponding to RecSurfNum
+			int RecPtNum; // Receiving point number
+			int NumRecPts; // Number of receiving points on a receiving surface
+			int HitPtSurfNum; // Surface number of hit point: -1 = ground,
+			// 0 = sky or obstruction with receiving point below ground level,
+			// >0 = obstruction with receiving point above ground level
+			FArray1D< Real64 > ReflBmToDiffSolObs( MaxRecPts, 0.0 ); // Irradiance at a receiving point for
+			// beam solar diffusely reflected from obstructions, divided by
+			// beam normal irradiance
+			FArray1D< Real64 > ReflBmToDiffSolGnd( MaxRecPts, 0.0 ); // Irradiance at a receiving point for
+			// beam solar diffusely reflected from the ground, divided by
+			// beam normal irradiance
+			int RayNum; // Ray number
+			int IHit; // > 0 if obstruction is hit; otherwise = 0
+			Vector3< Real64 > OriginThisRay; // Origin point of a ray (m)
+			Vector3< Real64 > ObsHitPt; // Hit point on obstruction (m)
+			Real64 CosIncBmAtHitPt; // Cosine of incidence angle of beam solar at hit point
+			Real64 CosIncBmAtHitPt2; // Cosine of incidence angle of beam solar at hit point,
+			//  the mirrored shading surface
+			Real64 BmReflSolRadiance; // Solar radiance at hit point due to incident beam, divided
+			//  by beam normal irradiance
+			Real64 dReflBeamToDiffSol; // Contribution to reflection factor at a receiving point
+			//  from beam solar reflected from a hit point
+			Real64 SunLitFract; // Sunlit fraction
+			static thread_local std::vector< int > ObsCandidates; // Possible obstructions along the ray to the sun
 
 			for ( RecPtNum = 1; RecPtNum <= SolReflRecSurf( RecSurfNum ).NumRecPts; ++RecPtNum ) {
 				ReflBmToDiffSolObs( RecPtNum ) = 0.0;
@@ -727,9 +799,9 @@ namespace SolarReflectionManager {
 					//  it does not belong to SolReflRecSurf which only contain heat transfer surfaces
 					//  that can receive reflected solar (ExtSolar = True)!
 
-					// To speed up, ideally should store all possible shading surfaces for the HitPtSurfNum
-					//  obstruction surface in the SolReflSurf(HitPtSurfNum)%PossibleObsSurfNums(loop) array as well
-					for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+					// Only the surfaces whose bounding box the ray to the sun enters can obstruct it
+					SurfacesAlongRay( OriginThisRay, SunVec, ObsCandidates );
+					for ( int const ObsSurfNum : ObsCandidates ) {
 						//        DO loop = 1,SolReflRecSurf(RecSurfNum)%NumPossibleObs
 						//          ObsSurfNum = SolReflRecSurf(RecSurfNum)%PossibleObsSurfNums(loop)
 
@@ -900,51 +972,45 @@ namespace SolarReflectionManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int loop( 0 ); // DO loop indices
-		static int loop2( 0 ); // DO loop indices
-		static Vector3< Real64 > SunVec( 0.0 ); // Unit vector to sun
-		static Vector3< Real64 > SunVecMir( 0.0 ); // Unit vector to sun mirrored by a reflecting surface
-		static int RecSurfNum( 0 ); // Receiving surface number
-		static int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
-		static int NumRecPts( 0 ); // Number of receiving points on a receiving surface
-		static int RecPtNum( 0 ); // Receiving point number
-		static Vector3< Real64 > RecPt( 0.0 ); // Receiving point (m)
-		static Vector3< Real64 > HitPtRefl( 0.0 ); // Hit point on a reflecting surface (m)
-		FArray1D< Real64 > ReflBmToDiffSolObs( MaxRecPts ); // Irradiance at a receiving point for
-		// beam solar diffusely reflected from obstructions, divided by
-		// beam normal irradiance
-		//unused  INTEGER           :: RayNum               =0   ! Ray number
-		static int IHitRefl( 0 ); // > 0 if reflecting surface is hit; otherwise = 0
-		static int IHitObs( 0 ); // > 0 if obstruction is hit
-		static Vector3< Real64 > HitPtObs( 0.0 ); // Hit point on obstruction (m)
-		static int IHitObsRefl( 0 ); // > 0 if obstruction hit between rec. pt. and reflection point
-		static int ObsSurfNum( 0 ); // Obstruction surface number
-		static int ReflSurfNum( 0 ); // Reflecting surface number
-		static int ReflSurfRecNum( 0 ); // Receiving surface number corresponding to a reflecting surface number
-		static Vector3< Real64 > ReflNorm( 0.0 ); // Unit normal to reflecting surface
-		FArray1D< Real64 > ReflBmToBmSolObs( MaxRecPts ); // Irradiance at a receiving point for
-		// beam solar specularly reflected from obstructions, divided by
-		// beam normal irradiance
-		static Real64 ReflDistance( 0.0 ); // Distance from receiving point to hit point on a reflecting surface (m)
-		static Real64 ObsDistance( 0.0 ); // Distance from receiving point to hit point on an obstruction (m)
-		static Real64 SpecReflectance( 0.0 ); // Specular reflectance of a reflecting surface
-		static int ConstrNumRefl( 0 ); // Construction number of a reflecting surface
-		static Real64 CosIncAngRefl( 0.0 ); // Cosine of incidence angle of beam on reflecting surface
-		static Real64 CosIncAngRec( 0.0 ); // Angle of incidence of reflected beam on receiving surface
-		static Real64 ReflFac( 0.0 ); // Contribution to specular reflection factor
-		FArray1D< Real64 > ReflFacTimesCosIncSum( MaxRecPts ); // Sum of ReflFac times CosIncAngRefl
-		static Real64 CosIncWeighted( 0.0 ); // Cosine of incidence angle on receiving surf weighted by reflection factor
-
-		ReflBmToDiffSolObs = 0.0;
-		ReflFacTimesCosIncSum = 0.0;
+		Vector3< Real64 > SunVec; // Unit vector to sun
 
 		if ( SUNCOSHR( 3, iHour ) < SunIsUpValue ) return; // Skip if sun is below horizon
 
 		// Unit vector to sun
 		SunVec = SUNCOSHR( {1,3}, iHour );
 
-		for ( RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
-			SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
+		// Each receiving surface only writes its own reflection factors, so they are done in parallel
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic )
+#endif
+		for ( int RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
+			int const SurfNum( SolReflRecSurf( RecSurfNum ).SurfNum ); // Heat transfer surface number corresponding to RecSurfNum
+			int loop; // DO loop indices
+			Vector3< Real64 > SunVecMir; // Unit vector to sun mirrored by a reflecting surface
+			int NumRecPts; // Number of receiving points on a receiving surface
+			int RecPtNum; // Receiving point number
+			Vector3< Real64 > RecPt; // Receiving point (m)
+			Vector3< Real64 > HitPtRefl; // Hit point on a reflecting surface (m)
+			int IHitRefl; // > 0 if reflecting surface is hit; otherwise = 0
+			int IHitObs; // > 0 if obstruction is hit
+			Vector3< Real64 > HitPtObs; // Hit point on obstruction (m)
+			int IHitObsRefl; // > 0 if obstruction hit between rec. pt. and reflection point
+			int ReflSurfNum; // Reflecting surface number
+			int ReflSurfRecNum; // Receiving surface number corresponding to a reflecting surface number
+			Vector3< Real64 > ReflNorm; // Unit normal to reflecting surface
+			FArray1D< Real64 > ReflBmToBmSolObs( MaxRecPts ); // Irradiance at a receiving point for
+			// beam solar specularly reflected from obstructions, divided by
+			// beam normal irradiance
+			Real64 ReflDistance; // Distance from receiving point to hit point on a reflecting surface (m)
+			Real64 ObsDistance; // Distance from receiving point to hit point on an obstruction (m)
+			Real64 SpecReflectance; // Specular reflectance of a reflecting surface
+			int ConstrNumRefl; // Construction number of a reflecting surface
+			Real64 CosIncAngRefl; // Cosine of incidence angle of beam on reflecting surface
+			Real64 CosIncAngRec; // Angle of incidence of reflected beam on receiving surface
+			Real64 ReflFac; // Contribution to specular reflection factor
+			FArray1D< Real64 > ReflFacTimesCosIncSum( MaxRecPts ); // Sum of ReflFac times CosIncAngRefl
+			Real64 CosIncWeighted; // Cosine of incidence angle on receiving surf weighted by reflection factor
+			static thread_local std::vector< int > ObsSurfNums; // Possible obstructions along a ray
 			if ( SolReflRecSurf( RecSurfNum ).NumPossibleObs > 0 ) {
 				ReflBmToBmSolObs = 0.0;
 				ReflFacTimesCosIncSum = 0.0;
@@ -974,8 +1040,8 @@ namespace SolarReflectionManager {
 								ReflDistance = distance( HitPtRefl, RecPt );
 								// Determine if ray from receiving point to hit point is obstructed
 								IHitObsRefl = 0;
-								for ( loop2 = 1; loop2 <= SolReflRecSurf( RecSurfNum ).NumPossibleObs; ++loop2 ) {
-									ObsSurfNum = SolReflRecSurf( RecSurfNum ).PossibleObsSurfNums( loop2 );
+								PossibleObsAlongRay( RecSurfNum, RecPt, SunVecMir, ObsSurfNums );
+								for ( int const ObsSurfNum : ObsSurfNums ) {
 									if ( ObsSurfNum == ReflSurfNum || ObsSurfNum == Surface( ReflSurfNum ).BaseSurf ) continue;
 									PierceSurface( ObsSurfNum, RecPt, SunVecMir, IHitObs, HitPtObs );
 									if ( IHitObs > 0 ) {
@@ -996,15 +1062,16 @@ namespace SolarReflectionManager {
 									ReflSurfRecNum = Surface( ReflSurfNum ).ShadowSurfRecSurfNum;
 									if ( ReflSurfRecNum > 0 ) {
 										// Loop over possible obstructions for this window
-										for ( loop2 = 1; loop2 <= SolReflRecSurf( ReflSurfRecNum ).NumPossibleObs; ++loop2 ) {
-											ObsSurfNum = SolReflRecSurf( ReflSurfRecNum ).PossibleObsSurfNums( loop2 );
+										PossibleObsAlongRay( ReflSurfRecNum, HitPtRefl, SunVec, ObsSurfNums );
+										for ( int const ObsSurfNum : ObsSurfNums ) {
 											PierceSurface( ObsSurfNum, HitPtRefl, SunVec, IHitObs, HitPtObs );
 											if ( IHitObs > 0 ) break;
 										}
 									}
 								} else {
 									// Reflecting surface is a building shade
-									for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+									SurfacesAlongRay( HitPtRefl, SunVec, ObsSurfNums );
+									for ( int const ObsSurfNum : ObsSurfNums ) {
 										if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 										if ( ObsSurfNum == ReflSurfNum ) continue;
 
@@ -1090,55 +1157,55 @@ namespace SolarReflectionManager {
 		// INTERFACE BLOCK SPECIFICATIONS: na
 		// DERIVED TYPE DEFINITIONS: na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int RecSurfNum( 0 ); // Receiving surface number
-		static int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
-		static int ObsSurfNum( 0 ); // Obstruction surface number
-		static int RecPtNum( 0 ); // Receiving point number
-		static int NumRecPts( 0 ); // Number of receiving points on a receiving surface
-		static int HitPtSurfNum( 0 ); // Surface number of hit point: -1 = ground,
-		// 0 = sky or obstruction with receiving point below ground level,
-		// >0 = obstruction with receiving point above ground level
-		static int HitPtSurfNumX( 0 ); // For a shading surface, HitPtSurfNum for original surface,
-		// HitPitSurfNum + 1 for mirror surface
-		FArray1D< Real64 > ReflSkySolObs( MaxRecPts ); // Irradiance at a receiving point for sky diffuse solar
-		// reflected from obstructions, divided by unobstructed
-		// sky diffuse horizontal irradiance
-		FArray1D< Real64 > ReflSkySolGnd( MaxRecPts ); // Irradiance at a receiving point for sky diffuse solar
-		// reflected from ground, divided by unobstructed
-		// sky diffuse horizontal irradiance
-		static int RayNum( 0 ); // Ray number
-		static Vector3< Real64 > HitPtRefl( 0.0 ); // Coordinates of hit point on obstruction or ground (m)
-		static int IHitObs( 0 ); // > 0 if obstruction is hit; otherwise = 0
-		static Vector3< Real64 > HitPtObs( 0.0 ); // Hit point on an obstruction (m)
-		//unused  REAL(r64)         :: ObsHitPt(3)          =0.0 ! Hit point on obstruction (m)
-		static Real64 dOmega( 0.0 ); // Solid angle increment (steradians)
-		static Real64 CosIncAngRayToSky( 0.0 ); // Cosine of incidence angle on ground of ray to sky
-		static Real64 SkyReflSolRadiance( 0.0 ); // Reflected radiance at hit point divided by unobstructed
-		//  sky diffuse horizontal irradiance
-		static Real64 dReflSkySol( 0.0 ); // Contribution to reflection factor at a receiving point
-		//  from sky solar reflected from a hit point
-		static Real64 Phi( 0.0 ); // Altitude angle and increment (radians)
-		static Real64 DPhi( 0.0 ); // Altitude angle and increment (radians)
-		static Real64 SPhi( 0.0 ); // Sine of Phi
-		static Real64 CPhi( 0.0 ); // Cosine of Phi
-		static Real64 Theta( 0.0 ); // Azimuth angle (radians)
-		static Real64 DTheta( 0.0 ); // Azimuth increment (radians)
-		static int IPhi( 0 ); // Altitude angle index
-		static int ITheta( 0 ); // Azimuth angle index
-		static Vector3< Real64 > URay( 0.0 ); // Unit vector along ray from ground hit point
-		static Vector3< Real64 > SurfVertToGndPt( 0.0 ); // Vector from a vertex of possible obstructing surface to ground
-		//  hit point (m)
-		static Vector3< Real64 > SurfVert( 0.0 ); // Surface vertex (m)
-		static Real64 dReflSkyGnd( 0.0 ); // Factor for ground radiance due to direct sky diffuse reflection
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS: na
 		// FLOW:
 
 		DisplayString( "Calculating Sky Diffuse Exterior Solar Reflection Factors" );
-		ReflSkySolObs = 0.0;
-		ReflSkySolGnd = 0.0;
 
-		for ( RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
-			SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
+		// Each receiving surface only writes its own reflection factors, so they are done in parallel
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic )
+#endif
+		for ( int RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
+			int const SurfNum( SolReflRecSurf( RecSurfNum ).SurfNum ); // Heat transfer surface number corresponding to RecSurfNum
+			int RecPtNum; // Receiving point number
+			int NumRecPts; // Number of receiving points on a receiving surface
+			int HitPtSurfNum; // Surface number of hit point: -1 = ground,
+			// 0 = sky or obstruction with receiving point below ground level,
+			// >0 = obstruction with receiving point above ground level
+			int HitPtSurfNumX; // For a shading surface, HitPtSurfNum for original surface,
+			// HitPitSurfNum + 1 for mirror surface
+			FArray1D< Real64 > ReflSkySolObs( MaxRecPts, 0.0 ); // Irradiance at a receiving point for sky diffuse solar
+			// reflected from obstructions, divided by unobstructed
+			// sky diffuse horizontal irradiance
+			FArray1D< Real64 > ReflSkySolGnd( MaxRecPts, 0.0 ); // Irradiance at a receiving point for sky diffuse solar
+			// reflected from ground, divided by unobstructed
+			// sky diffuse horizontal irradiance
+			int RayNum; // Ray number
+			Vector3< Real64 > HitPtRefl; // Coordinates of hit point on obstruction or ground (m)
+			int IHitObs; // > 0 if obstruction is hit; otherwise = 0
+			Vector3< Real64 > HitPtObs; // Hit point on an obstruction (m)
+			//unused  REAL(r64)         :: ObsHitPt(3)          =0.0 ! Hit point on obstruction (m)
+			Real64 dOmega; // Solid angle increment (steradians)
+			Real64 CosIncAngRayToSky; // Cosine of incidence angle on ground of ray to sky
+			Real64 SkyReflSolRadiance; // Reflected radiance at hit point divided by unobstructed
+			//  sky diffuse horizontal irradiance
+			Real64 dReflSkySol; // Contribution to reflection factor at a receiving point
+			//  from sky solar reflected from a hit point
+			Real64 Phi; // Altitude angle and increment (radians)
+			Real64 DPhi; // Altitude angle and increment (radians)
+			Real64 SPhi; // Sine of Phi
+			Real64 CPhi; // Cosine of Phi
+			Real64 Theta; // Azimuth angle (radians)
+			Real64 DTheta; // Azimuth increment (radians)
+			int IPhi; // Altitude angle index
+			int ITheta; // Azimuth angle index
+			Vector3< Real64 > URay; // Unit vector along ray from ground hit point
+			Vector3< Real64 > SurfVertToGndPt; // Vector from a vertex of possible obstructing surface to ground
+			//  hit point (m)
+			Vector3< Real64 > SurfVert; // Surface vertex (m)
+			Real64 dReflSkyGnd; // Factor for ground radiance due to direct sky diffuse reflection
+			static thread_local std::vector< int > ObsCandidates; // Possible obstructions along a ray to the sky
 			for ( RecPtNum = 1; RecPtNum <= SolReflRecSurf( RecSurfNum ).NumRecPts; ++RecPtNum ) {
 				ReflSkySolObs( RecPtNum ) = 0.0;
 				ReflSkySolGnd( RecPtNum ) = 0.0;
@@ -1205,7 +1272,8 @@ namespace SolarReflectionManager {
 								URay.y = CPhi * std::sin( Theta );
 								// Does this ray hit an obstruction?
 								IHitObs = 0;
-								for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+								SurfacesAlongRay( HitPtRefl, URay, ObsCandidates );
+								for ( int const ObsSurfNum : ObsCandidates ) {
 									if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 									// Horizontal roof surfaces cannot be obstructions for rays from ground
 									if ( Surface( ObsSurfNum ).Tilt < 5.0 ) continue;
@@ -1329,9 +1397,9 @@ namespace SolarReflectionManager {
 		//unused  REAL(r64) :: DOTAXCSN                 ! Dot product of vectors AXC and SN
 
 		// Vertex vectors
-		static FArray1D< Vector3< Real64 > > V( MaxVerticesPerSurface ); // Vertices of surfaces
-		static FArray1D< Vector3< Real64 > > A( MaxVerticesPerSurface ); // Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
-		static FArray1D< Vector3< Real64 > > C( MaxVerticesPerSurface ); // Vectors from vertices to intersection point
+		static thread_local FArray1D< Vector3< Real64 > > V( MaxVerticesPerSurface ); // Vertices of surfaces
+		static thread_local FArray1D< Vector3< Real64 > > A( MaxVerticesPerSurface ); // Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
+		static thread_local FArray1D< Vector3< Real64 > > C( MaxVerticesPerSurface ); // Vectors from vertices to intersection point
 
 		// FLOW:
 		IPIERC = 0;
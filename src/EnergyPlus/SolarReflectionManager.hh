@@ -1,6 +1,9 @@
 #ifndef SolarReflectionManager_hh_INCLUDED
 #define SolarReflectionManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
 #include <ObjexxFCL/FArray2D.hh>
@@ -120,6 +123,17 @@ namespace SolarReflectionManager {
 	void
 	InitSolReflRecSurf();
 
+	void
+	FigureSolReflHitPoints( int const RecSurfNum );
+
+	void
+	PossibleObsAlongRay(
+		int const RecSurfNum, // Receiving surface number
+		Vector3< Real64 > const & Origin, // Point from which the ray originates (m)
+		Vector3< Real64 > const & RayVec, // Direction of the ray
+		std::vector< int > & ObsSurfNums // Possible obstructions of RecSurfNum that the ray may hit, ascending
+	);
+
 	//=====================================================================================================
 
 	void
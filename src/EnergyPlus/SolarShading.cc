@@ -1,6 +1,10 @@
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <iterator>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -38,8 +42,12 @@
 #include <InputProcessor.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
+#include <PixelCounting.hh>
+#include <PolygonClipping.hh>
 #include <ScheduleManager.hh>
+#include <ShadingCache.hh>
 #include <SolarReflectionManager.hh>
+#include <SurfaceBVH.hh>
 #include <UtilityRoutines.hh>
 #include <Vectors.hh>
 #include <WindowComplexManager.hh>
@@ -118,6 +126,11 @@ namespace SolarShading {
 	int const TooManyFigures( 6 );
 	FArray1D_string const cOverLapStatus( 6, { "No-Overlap", "1st-Surf-within-2nd", "2nd-Surf-within-1st", "Partial-Overlap", "Too-Many-Vertices", "Too-Many-Figures" } );
 
+	// Parameters for use with ShadingRecordKey...
+	int const SkyDiffuseRecord( 1 ); // Sky diffuse shading ratios (SkyDifSolarShading)
+	int const BeamRecord( 2 ); // Beam sunlit fractions and overlaps for a shadowing period (CalcPerSolarBeam)
+	int const DaylightingRecord( 3 ); // Daylight factors of a group of zones (DaylightingManager)
+
 	// DERIVED TYPE DEFINITIONS:
 	// INTERFACE BLOCK SPECIFICATIONS:
 	// na
@@ -151,6 +164,11 @@ namespace SolarShading {
 	int NRVLHC; // Number of reveal surfaces in HC array
 	int NSBSHC; // Number of subsurfaces in the HC arrays
 	bool CalcSkyDifShading; // True when sky diffuse solar shading is
+	bool ShadowRastersReady( false ); // True when ShadowRasters already hold the jobs for the next SHADOW call
+	Real64 MaxRasterErrorBound( 0.0 ); // Largest RasterErrorBound of the beam sunlit fractions found by pixel counting
+	int MaxRasterErrorSurface( 0 ); // Receiving surface with MaxRasterErrorBound
+	bool KeepSkyPatchRasters( false ); // True when the sky patch jobs are kept for ReweightSkyDifShading
+	bool ReweightOneTimeFlag( true ); // True until ReweightSkyDifShading has gathered the sky patch jobs
 	int ShadowingCalcFrequency( 0 ); // Frequency for Shadowing Calculations
 	int ShadowingDaysLeft( 0 ); // Days left in current shadowing period
 	bool debugging( false );
@@ -187,11 +205,9 @@ namespace SolarShading {
 	FArray1D< Real64 > YVS; // Y-vertices of the shadow
 	FArray1D< Real64 > ZVC; // Z-vertices of the clipped figure
 	// Used in Sutherland Hodman poly clipping
-	FArray1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
-	FArray1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
-	FArray1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
-	FArray1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
-	FArray1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
+	PolygonClipping::ClipWorkspace HCClipWork; // Vertex buffers of the overlap being clipped
+	std::ofstream clp_stream; // Polygon pairs clipped (TRACE_HCCLIPPING)
+	ShadingCache::ShadingRecord ShadingResults; // Packed results read from or added to the shading result cache
 	int maxNumberOfFigures( 0 );
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SolarShading
@@ -200,6 +216,9 @@ namespace SolarShading {
 	FArray1D< SurfaceErrorTracking > TrackTooManyFigures;
 	FArray1D< SurfaceErrorTracking > TrackTooManyVertices;
 	FArray1D< SurfaceErrorTracking > TrackBaseSubSurround;
+	FArray1D< PixelCounting::RasterJob > ShadowRasters; // Pixel counting job of each receiving surface
+	std::vector< std::vector< int > > SkyPatchReceivers; // Receiving surfaces with a job for each sky patch
+	std::vector< std::vector< PixelCounting::RasterJob > > SkyPatchRasters; // Pixel counting jobs of each sky patch
 
 	static gio::Fmt fmtLD( "*" );
 
@@ -207,6 +226,19 @@ namespace SolarShading {
 
 	// Functions
 
+	void
+	clear_state()
+	{
+		ShadowRastersReady = false;
+		MaxRasterErrorBound = 0.0;
+		MaxRasterErrorSurface = 0;
+		KeepSkyPatchRasters = false;
+		ReweightOneTimeFlag = true;
+		ShadowRasters.deallocate();
+		SkyPatchReceivers.clear();
+		SkyPatchRasters.clear();
+	}
+
 	void
 	InitSolarCalculations()
 	{
@@ -227,8 +259,8 @@ namespace SolarShading {
 		// REFERENCES:
 		// na
 
-		// USE STATEMENTS:
-		// na
+		// Using/Aliasing
+		using DataSystemVariables::TraceHCClippingEnvFlag;
 
 		// Locals
 		// SUBROUTINE PARAMETER DEFINITIONS:
@@ -257,6 +289,15 @@ namespace SolarShading {
 				ShowFatalError( "InitSolarCalculations: Could not open file \"" + DataStringGlobals::outputShdFileName + "\" for output (write)." );
 			}
 
+			// To write the polygon pairs given to CLIPPOLY (e.g. for benchmarking the clipping kernel),
+			// define the environment variable TRACE_HCCLIPPING=YES or TRACE_HCCLIPPING=Y.
+			if ( TraceHCClippingEnvFlag && ! clp_stream.is_open() ) {
+				clp_stream.open( "polygons.HCClipping.txt" );
+				if ( ! clp_stream ) {
+					ShowFatalError( "InitSolarCalculations: Could not open file \"polygons.HCClipping.txt\" for output (write)." );
+				}
+			}
+
 			if ( GetInputFlag ) {
 				GetShadowingInput();
 				GetInputFlag = false;
@@ -432,6 +473,8 @@ namespace SolarShading {
 		using DataSystemVariables::SutherlandHodgman;
 		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
 		using DataSystemVariables::DetailedSolarTimestepIntegration;
+		using DataSystemVariables::PixelCountingShading;
+		using DataSystemVariables::PixelCountingResolution;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -455,6 +498,7 @@ namespace SolarShading {
 		rNumericArgs( {1,4} ) = 0.0; // so if nothing gotten, defaults will be maintained.
 		cAlphaArgs( 1 ) = "";
 		cAlphaArgs( 2 ) = "";
+		cAlphaArgs( 4 ) = "";
 		cCurrentModuleObject = "ShadowCalculation";
 		NumItems = GetNumObjectsFound( cCurrentModuleObject );
 		NumAlphas = 0;
@@ -549,6 +593,33 @@ namespace SolarShading {
 			DetailedSkyDiffuseAlgorithm = false;
 		}
 
+		if ( NumAlphas >= 4 ) {
+			if ( SameString( cAlphaArgs( 4 ), "PolygonClipping" ) ) {
+				PixelCountingShading = false;
+				cAlphaArgs( 4 ) = "PolygonClipping";
+			} else if ( SameString( cAlphaArgs( 4 ), "PixelCounting" ) ) {
+				PixelCountingShading = true;
+				cAlphaArgs( 4 ) = "PixelCounting";
+			} else if ( lAlphaFieldBlanks( 4 ) ) {
+				PixelCountingShading = false;
+				cAlphaArgs( 4 ) = "PolygonClipping";
+			} else {
+				ShowWarningError( cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 4 ) );
+				ShowContinueError( "Value entered=\"" + cAlphaArgs( 4 ) + "\", PolygonClipping will be used." );
+				PixelCountingShading = false;
+				cAlphaArgs( 4 ) = "PolygonClipping";
+			}
+		} else {
+			PixelCountingShading = false;
+			cAlphaArgs( 4 ) = "PolygonClipping";
+		}
+
+		if ( NumNumbers >= 3 && ! lNumericFieldBlanks( 3 ) ) {
+			PixelCountingResolution = max( nint( rNumericArgs( 3 ) ), PixelCounting::MinResolution );
+		} else {
+			PixelCountingResolution = PixelCounting::DefaultResolution;
+		}
+
 		if ( ! DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing ) {
 			ShowWarningError( "GetShadowingInput: The shading transmittance for shading devices changes throughout the year. Choose DetailedSkyDiffuseModeling in the " + cCurrentModuleObject + " object to remove this warning." );
 			ShowContinueError( "Simulation has been reset to use DetailedSkyDiffuseModeling. Simulation continues." );
@@ -566,8 +637,8 @@ namespace SolarShading {
 			}
 		}
 
-		gio::write( OutputFileInits, fmtA ) << "! <Shadowing/Sun Position Calculations> [Annual Simulations], Calculation Method, Value {days}, Allowable Number Figures in Shadow Overlap {}, Polygon Clipping Algorithm, Sky Diffuse Modeling Algorithm";
-		gio::write( OutputFileInits, fmtA ) << "Shadowing/Sun Position Calculations," + cAlphaArgs( 1 ) + ',' + RoundSigDigits( ShadowingCalcFrequency ) + ',' + RoundSigDigits( MaxHCS ) + ',' + cAlphaArgs( 2 ) + ',' + cAlphaArgs( 3 );
+		gio::write( OutputFileInits, fmtA ) << "! <Shadowing/Sun Position Calculations> [Annual Simulations], Calculation Method, Value {days}, Allowable Number Figures in Shadow Overlap {}, Polygon Clipping Algorithm, Sky Diffuse Modeling Algorithm, Shading Calculation Method, Pixel Counting Resolution {}";
+		gio::write( OutputFileInits, fmtA ) << "Shadowing/Sun Position Calculations," + cAlphaArgs( 1 ) + ',' + RoundSigDigits( ShadowingCalcFrequency ) + ',' + RoundSigDigits( MaxHCS ) + ',' + cAlphaArgs( 2 ) + ',' + cAlphaArgs( 3 ) + ',' + cAlphaArgs( 4 ) + ',' + RoundSigDigits( PixelCountingResolution );
 
 	}
 
@@ -593,6 +664,7 @@ namespace SolarShading {
 
 		// Using/Aliasing
 		using General::RoundSigDigits;
+		using PolygonClipping::ReserveWorkspace;
 
 		// Locals
 		// SUBROUTINE PARAMETER DEFINITIONS:
@@ -739,11 +811,7 @@ namespace SolarShading {
 		ZVC.dimension( MaxVerticesPerSurface + 1, 0.0 );
 
 		// Sutherland-Hodgman
-		ATEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
-		BTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
-		CTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
-		XTEMP1.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
-		YTEMP1.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		ReserveWorkspace( HCClipWork, 2 * ( MaxVerticesPerSurface + 1 ) );
 
 		//energy
 		WinTransSolarEnergy.dimension( TotSurfaces, 0.0 );
@@ -991,6 +1059,9 @@ namespace SolarShading {
 					SetupOutputVariable( "Surface Window Glazing Beam to Diffuse Solar Transmittance []", SurfaceWindow( SurfLoop ).GlTsolBmDif, "Zone", "State", Surface( SurfLoop ).Name );
 					SetupOutputVariable( "Surface Window Glazing Diffuse to Diffuse Solar Transmittance []", SurfaceWindow( SurfLoop ).GlTsolDifDif, "Zone", "State", Surface( SurfLoop ).Name );
 					SetupOutputVariable( "Surface Window Model Solver Iteration Count []", SurfaceWindow( SurfLoop ).WindowCalcIterationsRep, "Zone", "State", Surface( SurfLoop ).Name );
+					if ( WindowNewtonSolver ) {
+						SetupOutputVariable( "Surface Window Model Solver Residual [W/m2]", SurfaceWindow( SurfLoop ).WindowCalcResidualRep, "Zone", "State", Surface( SurfLoop ).Name );
+					}
 				} else if ( ! Surface( SurfLoop ).ExtSolar ) { // Not ExtSolar
 					if ( DisplayAdvancedReportVariables ) {
 						// CurrentModuleObject='InteriorWindows(Advanced)'
@@ -1070,6 +1141,9 @@ namespace SolarShading {
 						SetupOutputVariable( "Surface Window Glazing Beam to Diffuse Solar Transmittance []", SurfaceWindow( SurfLoop ).GlTsolBmDif, "Zone", "State", Surface( SurfLoop ).Name );
 						SetupOutputVariable( "Surface Window Glazing Diffuse to Diffuse Solar Transmittance []", SurfaceWindow( SurfLoop ).GlTsolDifDif, "Zone", "State", Surface( SurfLoop ).Name );
 						SetupOutputVariable( "Surface Window Model Solver Iteration Count []", SurfaceWindow( SurfLoop ).WindowCalcIterationsRep, "Zone", "State", Surface( SurfLoop ).Name );
+						if ( WindowNewtonSolver ) {
+							SetupOutputVariable( "Surface Window Model Solver Residual [W/m2]", SurfaceWindow( SurfLoop ).WindowCalcResidualRep, "Zone", "State", Surface( SurfLoop ).Name );
+						}
 					}
 				} // end non extsolar reporting as advanced variables
 			} // Window Reporting
@@ -2275,6 +2349,7 @@ namespace SolarShading {
 
 		// Using/Aliasing
 		using General::TrimSigDigits;
+		using PolygonClipping::HCSidesAndArea;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2315,27 +2390,9 @@ namespace SolarShading {
 
 		}
 
-		// Establish extra point for finding lines between points.
-
-		auto l( HCX.index( NumVertices + 1, NS ) );
-		Int64 HCX_m( HCX[ l ] = HCX[ l1 ] ); // [ l ] == ( NumVertices + 1, NS ), [ l1 ] == ( 1, NS )
-		Int64 HCY_m( HCY[ l ] = HCY[ l1 ] ); // [ l ] == ( NumVertices + 1, NS ), [ l1 ] == ( 1, NS )
-
-		// Determine lines between points.
-		l = l1;
-		auto m( l1 + 1u );
-		Int64 HCX_l;
-		Int64 HCY_l;
-		Real64 SUM( 0.0 ); // Sum variable
-		for ( int N = 1; N <= NumVertices; ++N, ++l, ++m ) { // [ l ] == ( N, NS ), [ m ] == ( N + 1, NS )
-			HCX_l = HCX_m;
-			HCY_l = HCY_m;
-			HCX_m = HCX[ m ];
-			HCY_m = HCY[ m ];
-			HCA[ l ] = HCY_l - HCY_m;
-			HCB[ l ] = HCX_m - HCX_l;
-			SUM += HCC[ l ] = ( HCY_m * HCX_l ) - ( HCX_m * HCY_l );
-		}
+		// Establish extra point for finding lines between points and determine lines between points.
+		// The sum of the 'C' values is twice the area of the polygon.
+		Real64 const SUM( HCSidesAndArea( &HCX[ l1 ], &HCY[ l1 ], NumVertices, &HCA[ l1 ], &HCB[ l1 ], &HCC[ l1 ] ) ); // [ l1 ] == ( 1, NS )
 
 		// Compute area of polygon.
 		//  SUM=0.0D0
@@ -2355,6 +2412,7 @@ namespace SolarShading {
 	{
 		// Using/Aliasing
 		using General::TrimSigDigits;
+		using PolygonClipping::HCSidesAndArea;
 
 		// Locals
 
@@ -2373,24 +2431,7 @@ namespace SolarShading {
 
 		auto const l1( HCX.index( 1, NS ) );
 
-		auto l( HCX.index( NumVertices + 1, NS ) );
-		Int64 HCX_m( HCX[ l ] = HCX[ l1 ] ); // [ l1 ] == ( 1, NS )
-		Int64 HCY_m( HCY[ l ] = HCY[ l1 ] ); // [ l1 ] == ( 1, NS )
-
-		l = l1;
-		auto m( l1 + 1u );
-		Int64 HCX_l;
-		Int64 HCY_l;
-		Real64 SUM( 0.0 );
-		for ( int N = 1; N <= NumVertices; ++N, ++l, ++m ) { // [ l ] == ( N, NS ), [ m ] == ( N + 1, NS )
-			HCX_l = HCX_m;
-			HCY_l = HCY_m;
-			HCX_m = HCX[ m ];
-			HCY_m = HCY[ m ];
-			HCA[ l ] = HCY_l - HCY_m;
-			HCB[ l ] = HCX_m - HCX_l;
-			SUM += HCC[ l ] = ( HCY_m * HCX_l ) - ( HCX_m * HCY_l );
-		}
+		Real64 const SUM( HCSidesAndArea( &HCX[ l1 ], &HCY[ l1 ], NumVertices, &HCA[ l1 ], &HCB[ l1 ], &HCC[ l1 ] ) ); // [ l1 ] == ( 1, NS )
 
 		HCAREA( NS ) = SUM * sqHCMULT_fac;
 
@@ -2404,6 +2445,7 @@ namespace SolarShading {
 	{
 		// Using/Aliasing
 		using General::TrimSigDigits;
+		using PolygonClipping::HCSidesAndArea;
 
 		if ( NS > 2 * MaxHCS ) {
 			ShowFatalError( "Solar Shading: HTrans1: Too many Figures (>" + TrimSigDigits( MaxHCS ) + ')' );
@@ -2427,24 +2469,7 @@ namespace SolarShading {
 			HCY[ l ] = nint64( YVS( N ) * HCMULT );
 		}
 
-		l = HCX.index( NumVertices + 1, NS );
-		Int64 HCX_m( HCX[ l ] = HCX[ l1 ] ); // [ l1 ] == ( 1, NS )
-		Int64 HCY_m( HCY[ l ] = HCY[ l1 ] );
-
-		l = l1;
-		auto m( l1 + 1u );
-		Int64 HCX_l;
-		Int64 HCY_l;
-		Real64 SUM( 0.0 );
-		for ( int N = 1; N <= NumVertices; ++N, ++l, ++m ) { // [ l ] == ( N, NS ), [ m ] == ( N + 1, NS )
-			HCX_l = HCX_m;
-			HCY_l = HCY_m;
-			HCX_m = HCX[ m ];
-			HCY_m = HCY[ m ];
-			HCA[ l ] = HCY_l - HCY_m;
-			HCB[ l ] = HCX_m - HCX_l;
-			SUM += HCC[ l ] = ( HCY_m * HCX_l ) - ( HCX_m * HCY_l );
-		}
+		Real64 const SUM( HCSidesAndArea( &HCX[ l1 ], &HCY[ l1 ], NumVertices, &HCA[ l1 ], &HCB[ l1 ], &HCC[ l1 ] ) ); // [ l1 ] == ( 1, NS )
 
 		HCAREA( NS ) = SUM * sqHCMULT_fac;
 
@@ -2659,7 +2684,7 @@ namespace SolarShading {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Tyler Hoyt
 		//       DATE WRITTEN   May 4, 2010
-		//       MODIFIED       na
+		//       MODIFIED       October 2026; clipping moved to PolygonClipping::ClipPolygon
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2669,14 +2694,13 @@ namespace SolarShading {
 
 		// METHODOLOGY EMPLOYED:
 		// The Sutherland-Hodgman algorithm for polygon clipping is employed.
-
-		// METHODOLOGY EMPLOYED:
+		// The clipping itself is done on the structure-of-arrays buffers in HCClipWork
+		// by PolygonClipping::ClipPolygon, which reads the HC arrays of the figures directly.
 
 		// REFERENCES:
 
 		// Using/Aliasing
-		using General::ReallocateRealArray;
-		using General::SafeDivide;
+		using PolygonClipping::ClipPolygon;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2691,15 +2715,7 @@ namespace SolarShading {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		typedef  FArray2D< Int64 >::size_type  size_type;
 		bool INTFLAG; // For overlap status
-		int S; // Test vertex
-		int KK; // Duplicate test index
-		int NVOUT; // Current output length for loops
-		int NVTEMP;
-
-		Real64 W; // Normalization factor
-		Real64 HFunct;
 
 #ifdef EP_Count_Calls
 		++NumClipPoly_Calls;
@@ -2711,171 +2727,29 @@ namespace SolarShading {
 		assert( equal_dimensions( HCX, HCB ) );
 		assert( equal_dimensions( HCX, HCC ) );
 
-		// Populate the arrays with the original polygon
-		for ( size_type j = 0, l = HCX.index( 1, NS1 ), e = NV1; j < e; ++j, ++l ) {
-			XTEMP[ j ] = HCX[ l ]; // [ l ] == ( j+1, NS1 )
-			YTEMP[ j ] = HCY[ l ];
-			ATEMP[ j ] = HCA[ l ];
-			BTEMP[ j ] = HCB[ l ];
-			CTEMP[ j ] = HCC[ l ];
-		}
-
-		NVOUT = NV1; // First point-loop is the length of the subject polygon.
-		INTFLAG = false;
-		NVTEMP = 0;
-		KK = 0;
-
-		auto l( HCA.index( 1, NS2 ) );
-		for ( int E = 1; E <= NV2; ++E, ++l ) { // Loop over edges of the clipping polygon
-			for ( int P = 1; P <= NVOUT; ++P ) {
-				XTEMP1( P ) = XTEMP( P );
-				YTEMP1( P ) = YTEMP( P );
-			}
-			S = NVOUT;
-			Real64 const HCA_E( HCA[ l ] );
-			Real64 const HCB_E( HCB[ l ] );
-			Real64 const HCC_E( HCC[ l ] );
-			Real64 XTEMP1_S( XTEMP1( S ) );
-			Real64 YTEMP1_S( YTEMP1( S ) );
-			for ( int P = 1; P <= NVOUT; ++P ) {
-				Real64 const XTEMP1_P( XTEMP1( P ) );
-				Real64 const YTEMP1_P( YTEMP1( P ) );
-				HFunct = XTEMP1_P * HCA_E + YTEMP1_P * HCB_E + HCC_E;
-				// S is constant within this block
-				if ( HFunct <= 0.0 ) { // Vertex is not in the clipping plane
-					HFunct = XTEMP1_S * HCA_E + YTEMP1_S * HCB_E + HCC_E;
-					if ( HFunct > 0.0 ) { // Test vertex is in the clipping plane
-
-						// Find/store the intersection of the clip edge and the line connecting S and P
-						KK = NVTEMP;
-						++NVTEMP;
-						Real64 const ATEMP_S( ATEMP( S ) );
-						Real64 const BTEMP_S( BTEMP( S ) );
-						Real64 const CTEMP_S( CTEMP( S ) );
-						W = HCB_E * ATEMP_S - HCA_E * BTEMP_S;
-						if ( W != 0.0 ) {
-							Real64 const W_inv( 1.0 / W );
-							XTEMP( NVTEMP ) = nint64( ( HCC_E * BTEMP_S - HCB_E * CTEMP_S ) * W_inv );
-							YTEMP( NVTEMP ) = nint64( ( HCA_E * CTEMP_S - HCC_E * ATEMP_S ) * W_inv );
-						} else {
-							XTEMP( NVTEMP ) = SafeDivide( HCC_E * BTEMP_S - HCB_E * CTEMP_S, W );
-							YTEMP( NVTEMP ) = SafeDivide( HCA_E * CTEMP_S - HCC_E * ATEMP_S, W );
-						}
-						INTFLAG = true;
-
-						if ( E == NV2 ) { // Remove near-duplicates on last edge
-							if ( KK != 0 ) {
-								auto const x( XTEMP( NVTEMP ) );
-								auto const y( YTEMP( NVTEMP ) );
-								for ( int K = 1; K <= KK; ++K ) {
-									if ( std::abs( x - XTEMP( K ) ) > 2.0 ) continue;
-									if ( std::abs( y - YTEMP( K ) ) > 2.0 ) continue;
-									NVTEMP = KK;
-									break; // K loop
-								}
-							}
-						}
-
-					}
-
-					KK = NVTEMP;
-					++NVTEMP;
-					if ( NVTEMP > MAXHCArrayBounds ) {
-						int const NewArrayBounds( MAXHCArrayBounds + MAXHCArrayIncrement );
-						XTEMP.redimension( NewArrayBounds, 0.0 );
-						YTEMP.redimension( NewArrayBounds, 0.0 );
-						XTEMP1.redimension( NewArrayBounds, 0.0 );
-						YTEMP1.redimension( NewArrayBounds, 0.0 );
-						ATEMP.redimension( NewArrayBounds, 0.0 );
-						BTEMP.redimension( NewArrayBounds, 0.0 );
-						CTEMP.redimension( NewArrayBounds, 0.0 );
-						MAXHCArrayBounds = NewArrayBounds;
-					}
-
-					XTEMP( NVTEMP ) = XTEMP1_P;
-					YTEMP( NVTEMP ) = YTEMP1_P;
-
-					if ( E == NV2 ) { // Remove near-duplicates on last edge
-						if ( KK != 0 ) {
-							auto const x( XTEMP( NVTEMP ) );
-							auto const y( YTEMP( NVTEMP ) );
-							for ( int K = 1; K <= KK; ++K ) {
-								if ( std::abs( x - XTEMP( K ) ) > 2.0 ) continue;
-								if ( std::abs( y - YTEMP( K ) ) > 2.0 ) continue;
-								NVTEMP = KK;
-								break; // K loop
-							}
-						}
-					}
-
-				} else {
-					HFunct = XTEMP1_S * HCA_E + YTEMP1_S * HCB_E + HCC_E;
-					if ( HFunct <= 0.0 ) { // Test vertex is not in the clipping plane
-
-						KK = NVTEMP;
-						++NVTEMP;
-						Real64 const ATEMP_S( ATEMP( S ) );
-						Real64 const BTEMP_S( BTEMP( S ) );
-						Real64 const CTEMP_S( CTEMP( S ) );
-						W = HCB_E * ATEMP_S - HCA_E * BTEMP_S;
-						if ( W != 0.0 ) {
-							Real64 const W_inv( 1.0 / W );
-							XTEMP( NVTEMP ) = nint64( ( HCC_E * BTEMP_S - HCB_E * CTEMP_S ) * W_inv );
-							YTEMP( NVTEMP ) = nint64( ( HCA_E * CTEMP_S - HCC_E * ATEMP_S ) * W_inv );
-						} else {
-							XTEMP( NVTEMP ) = SafeDivide( HCC_E * BTEMP_S - HCB_E * CTEMP_S, W );
-							YTEMP( NVTEMP ) = SafeDivide( HCA_E * CTEMP_S - HCC_E * ATEMP_S, W );
-						}
-						INTFLAG = true;
-
-						if ( E == NV2 ) { // Remove near-duplicates on last edge
-							if ( KK != 0 ) {
-								auto const x( XTEMP( NVTEMP ) );
-								auto const y( YTEMP( NVTEMP ) );
-								for ( int K = 1; K <= KK; ++K ) {
-									if ( std::abs( x - XTEMP( K ) ) > 2.0 ) continue;
-									if ( std::abs( y - YTEMP( K ) ) > 2.0 ) continue;
-									NVTEMP = KK;
-									break; // K loop
-								}
-							}
-						}
+		auto const l1( HCX.index( 1, NS1 ) );
+		auto const l2( HCX.index( 1, NS2 ) );
 
-					}
-				}
-				S = P;
-				XTEMP1_S = XTEMP1_P;
-				YTEMP1_S = YTEMP1_P;
-			} // end loop over points of subject polygon
-
-			NVOUT = NVTEMP;
-			if ( NVOUT == 0 ) break; // Added to avoid array bounds violation of XTEMP1 and YTEMP1 and wasted looping
-			NVTEMP = 0;
-
-			if ( E != NV2 ) {
-				if ( NVOUT > 2 ) { // Compute HC values for edges of output polygon
-					Real64 const X_1( XTEMP( 1 ) );
-					Real64 const Y_1( YTEMP( 1 ) );
-					Real64 X_P( X_1 ), X_P1;
-					Real64 Y_P( Y_1 ), Y_P1;
-					for ( int P = 1; P < NVOUT; ++P ) {
-						X_P1 = XTEMP( P + 1 );
-						Y_P1 = YTEMP( P + 1 );
-						ATEMP( P ) = Y_P - Y_P1;
-						BTEMP( P ) = X_P1 - X_P;
-						CTEMP( P ) = X_P * Y_P1 - Y_P * X_P1;
-						X_P = X_P1;
-						Y_P = Y_P1;
-					}
-					ATEMP( NVOUT ) = Y_P1 - Y_1;
-					BTEMP( NVOUT ) = X_1 - X_P1;
-					CTEMP( NVOUT ) = X_P1 * Y_1 - Y_P1 * X_1;
-				}
-			}
+		if ( clp_stream.is_open() ) { // Record the pair: NV1 (X,Y)... NV2 (X,Y)...
+			clp_stream << NV1;
+			for ( int N = 0; N < NV1; ++N ) clp_stream << ' ' << HCX[ l1 + N ] << ' ' << HCY[ l1 + N ];
+			clp_stream << ' ' << NV2;
+			for ( int N = 0; N < NV2; ++N ) clp_stream << ' ' << HCX[ l2 + N ] << ' ' << HCY[ l2 + N ];
+			clp_stream << '\n';
+		}
 
-		} // end loop over edges in NS2
+		NV3 = ClipPolygon( &HCX[ l1 ], &HCY[ l1 ], &HCA[ l1 ], &HCB[ l1 ], &HCC[ l1 ], NV1, &HCA[ l2 ], &HCB[ l2 ], &HCC[ l2 ], NV2, HCClipWork, INTFLAG );
 
-		NV3 = NVOUT;
+		if ( NV3 > isize( XTEMP ) ) {
+			int const NewArrayBounds( max( NV3, isize( XTEMP ) + MAXHCArrayIncrement ) );
+			XTEMP.redimension( NewArrayBounds, 0.0 );
+			YTEMP.redimension( NewArrayBounds, 0.0 );
+			MAXHCArrayBounds = NewArrayBounds;
+		}
+		for ( int N = 1; N <= NV3; ++N ) {
+			XTEMP( N ) = HCClipWork.X[ N - 1 ];
+			YTEMP( N ) = HCClipWork.Y[ N - 1 ];
+		}
 
 		if ( NV3 < 3 ) { // Determine overlap status
 			OverlapStatus = NoOverlap;
@@ -3318,6 +3192,10 @@ namespace SolarShading {
 		using DataGlobals::TimeStepZone;
 		using DataGlobals::HourOfDay;
 		using DataGlobals::TimeStep;
+		using ShadingCache::CacheStatus;
+		using ShadingCache::CacheDisabled;
+		using ShadingCache::GetShadingRecord;
+		using ShadingCache::SaveShadingRecord;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -3333,6 +3211,11 @@ namespace SolarShading {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int iHour; // Hour index number
 		int TS; // TimeStep Loop Counter
+		int FirstHour; // First hour calculated this call
+		int LastHour; // Last hour calculated this call
+		int FirstTimeStep; // First time step calculated this call
+		int LastTimeStep; // Last time step calculated this call
+		std::uint64_t RecordKey( 0 ); // Shading result cache key for this period
 		static bool Once( true );
 
 		if ( Once ) InitComplexWindows();
@@ -3384,6 +3267,25 @@ namespace SolarShading {
 		}
 		//Initialize/update the Complex Fenestration geometry and optical properties
 		UpdateComplexWindows();
+
+		if ( ! DetailedSolarTimestepIntegration ) {
+			FirstHour = 1;
+			LastHour = 24;
+			FirstTimeStep = 1;
+			LastTimeStep = NumOfTimeStepInHour;
+		} else {
+			FirstHour = HourOfDay;
+			LastHour = HourOfDay;
+			FirstTimeStep = TimeStep;
+			LastTimeStep = TimeStep;
+		}
+
+		// Reuse the results of an earlier run with the same shading inputs and sun positions
+		if ( CacheStatus != CacheDisabled ) {
+			RecordKey = ShadingRecordKey( BeamRecord, AvgEqOfTime, AvgSinSolarDeclin, AvgCosSolarDeclin, FirstHour, FirstTimeStep );
+			if ( GetShadingRecord( RecordKey, ShadingResults ) && UnpackShadingRecord( FirstHour, LastHour, FirstTimeStep, LastTimeStep, ShadingResults ) ) return;
+		}
+
 		if ( ! DetailedSolarTimestepIntegration ) {
 			for ( iHour = 1; iHour <= 24; ++iHour ) { // Do for all hours.
 				for ( TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
@@ -3394,6 +3296,11 @@ namespace SolarShading {
 			FigureSolarBeamAtTimestep( HourOfDay, TimeStep );
 		}
 
+		if ( CacheStatus != CacheDisabled ) {
+			PackShadingRecord( FirstHour, LastHour, FirstTimeStep, LastTimeStep, ShadingResults );
+			SaveShadingRecord( RecordKey, ShadingResults );
+		}
+
 	}
 
 	void
@@ -3484,6 +3391,7 @@ namespace SolarShading {
 		// Using/Aliasing
 		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
 		using DataSystemVariables::DetailedSolarTimestepIntegration;
+		using DataSystemVariables::PixelCountingShading;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -3549,39 +3457,43 @@ namespace SolarShading {
 
 		//   Note -- if not the below, values are set in SkyDifSolarShading routine (constant for simulation)
 		if ( DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing ) {
-			CosPhi = 1.0 - SUNCOS( 3 );
+			if ( PixelCountingShading && ! SkyPatchRasters.empty() ) { // Re-weight the sky patches for the current transmittances
+				ReweightSkyDifShading( iHour, iTimeStep );
+			} else {
+				CosPhi = 1.0 - SUNCOS( 3 );
 
-			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 
-				if ( ! Surface( SurfNum ).ShadowingSurf && ( ! Surface( SurfNum ).HeatTransSurf || ! Surface( SurfNum ).ExtSolar || ( Surface( SurfNum ).ExtBoundCond != ExternalEnvironment && Surface( SurfNum ).ExtBoundCond != OtherSideCondModeledExt ) ) ) continue;
+					if ( ! Surface( SurfNum ).ShadowingSurf && ( ! Surface( SurfNum ).HeatTransSurf || ! Surface( SurfNum ).ExtSolar || ( Surface( SurfNum ).ExtBoundCond != ExternalEnvironment && Surface( SurfNum ).ExtBoundCond != OtherSideCondModeledExt ) ) ) continue;
 
-				if ( CTHETA( SurfNum ) < 0.0 ) continue;
+					if ( CTHETA( SurfNum ) < 0.0 ) continue;
 
-				Fac1WoShdg = CosPhi * DThetaDPhi * CTHETA( SurfNum );
-				Fac1WithShdg = Fac1WoShdg * SunlitFrac( SurfNum, iHour, iTimeStep );
-				WithShdgIsoSky( SurfNum ) = Fac1WithShdg;
-				WoShdgIsoSky( SurfNum ) = Fac1WoShdg;
+					Fac1WoShdg = CosPhi * DThetaDPhi * CTHETA( SurfNum );
+					Fac1WithShdg = Fac1WoShdg * SunlitFrac( SurfNum, iHour, iTimeStep );
+					WithShdgIsoSky( SurfNum ) = Fac1WithShdg;
+					WoShdgIsoSky( SurfNum ) = Fac1WoShdg;
 
-				// Horizon region
-				if ( SUNCOS( 3 ) <= PhiMin ) {
-					WithShdgHoriz( SurfNum ) = Fac1WithShdg;
-					WoShdgHoriz( SurfNum ) = Fac1WoShdg;
-				}
-			} // End of surface loop
+					// Horizon region
+					if ( SUNCOS( 3 ) <= PhiMin ) {
+						WithShdgHoriz( SurfNum ) = Fac1WithShdg;
+						WoShdgHoriz( SurfNum ) = Fac1WoShdg;
+					}
+				} // End of surface loop
 
-			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 
-				if ( ! Surface( SurfNum ).ShadowingSurf && ( ! Surface( SurfNum ).HeatTransSurf || ! Surface( SurfNum ).ExtSolar || ( Surface( SurfNum ).ExtBoundCond != ExternalEnvironment && Surface( SurfNum ).ExtBoundCond != OtherSideCondModeledExt ) ) ) continue;
+					if ( ! Surface( SurfNum ).ShadowingSurf && ( ! Surface( SurfNum ).HeatTransSurf || ! Surface( SurfNum ).ExtSolar || ( Surface( SurfNum ).ExtBoundCond != ExternalEnvironment && Surface( SurfNum ).ExtBoundCond != OtherSideCondModeledExt ) ) ) continue;
 
-				if ( std::abs( WoShdgIsoSky( SurfNum ) ) > Eps ) {
-					DifShdgRatioIsoSkyHRTS( SurfNum, iHour, iTimeStep ) = ( WithShdgIsoSky( SurfNum ) ) / ( WoShdgIsoSky( SurfNum ) );
-				} else {
-					DifShdgRatioIsoSkyHRTS( SurfNum, iHour, iTimeStep ) = ( WithShdgIsoSky( SurfNum ) ) / ( WoShdgIsoSky( SurfNum ) + Eps );
-				}
-				if ( std::abs( WoShdgHoriz( SurfNum ) ) > Eps ) {
-					DifShdgRatioHorizHRTS( SurfNum, iHour, iTimeStep ) = ( WithShdgHoriz( SurfNum ) ) / ( WoShdgHoriz( SurfNum ) );
-				} else {
-					DifShdgRatioHorizHRTS( SurfNum, iHour, iTimeStep ) = ( WithShdgHoriz( SurfNum ) ) / ( WoShdgHoriz( SurfNum ) + Eps );
+					if ( std::abs( WoShdgIsoSky( SurfNum ) ) > Eps ) {
+						DifShdgRatioIsoSkyHRTS( SurfNum, iHour, iTimeStep ) = ( WithShdgIsoSky( SurfNum ) ) / ( WoShdgIsoSky( SurfNum ) );
+					} else {
+						DifShdgRatioIsoSkyHRTS( SurfNum, iHour, iTimeStep ) = ( WithShdgIsoSky( SurfNum ) ) / ( WoShdgIsoSky( SurfNum ) + Eps );
+					}
+					if ( std::abs( WoShdgHoriz( SurfNum ) ) > Eps ) {
+						DifShdgRatioHorizHRTS( SurfNum, iHour, iTimeStep ) = ( WithShdgHoriz( SurfNum ) ) / ( WoShdgHoriz( SurfNum ) );
+					} else {
+						DifShdgRatioHorizHRTS( SurfNum, iHour, iTimeStep ) = ( WithShdgHoriz( SurfNum ) ) / ( WoShdgHoriz( SurfNum ) + Eps );
+					}
 				}
 			}
 
@@ -3632,11 +3544,18 @@ namespace SolarShading {
 		// As appropriate surfaces are identified, they are placed into the
 		// ShadowComb data structure (module level) with the accompanying lists
 		// of other surface numbers.
+		// Candidate shadow casting surfaces come from the surface bounding volume
+		// hierarchy (only those with a point above the receiving surface plane and
+		// above its lowest point); subsurfaces and back surfaces come from lists
+		// gathered once.  Candidates are visited in ascending surface number so the
+		// resulting lists are the same as from checking every surface.
 
 		// REFERENCES:
 		// BLAST/IBLAST code, original author George Walton
 
 		// Using/Aliasing
+		using SurfaceBVH::HalfSpace;
+		using SurfaceBVH::SurfacesInHalfSpaces;
 		using OutputReportPredefined::ShadowRelate;
 		using OutputReportPredefined::numShadowRelate;
 		using OutputReportPredefined::recKindSurface;
@@ -3667,16 +3586,19 @@ namespace SolarShading {
 		bool CannotShade; // TRUE if subsurface cannot shade receiving surface
 		bool HasWindow; // TRUE if a window is present on receiving surface
 		Real64 ZMIN; // Lowest point on the receiving surface
-		int BackSurfaceNumber; // Back surface number
 		int HTS; // Heat transfer surface number for a receiving surface
 		int GRSNR; // Receiving surface number
-		int GSSNR; // Shadowing surface number
 		int SBSNR; // Subsurface number
 		int NBKS; // Number of back surfaces for a receiving surface
 		int NGSS; // Number of shadowing surfaces for a receiving surface
 		int NSBS; // Number of subsurfaces for a receiving surface
 		bool ShadowingSurf; // True if a receiving surface is a shadowing surface
 		FArray1D_bool CastingSurface; // tracking during setup of ShadowComb
+		std::vector< std::vector< int > > SubSurfsOfBase; // Surfaces (other than itself) having a given base surface
+		std::vector< std::vector< int > > SurfsInZone; // Surfaces in a given zone
+		std::vector< int > CandidateSurfs; // Possible shadow casting surfaces for a receiving surface
+		std::vector< int > CullSurfs; // Surfaces passing the bounding volume cull
+		std::vector< HalfSpace > CullPlanes( 2 ); // Receiving surface front side and region above its lowest point
 
 		static int MaxDim( 0 );
 
@@ -3709,6 +3631,13 @@ namespace SolarShading {
 			return;
 		}
 
+		SubSurfsOfBase.resize( TotSurfaces + 1 );
+		SurfsInZone.resize( NumOfZones + 1 );
+		for ( SBSNR = 1; SBSNR <= TotSurfaces; ++SBSNR ) {
+			if ( Surface( SBSNR ).BaseSurf > 0 && Surface( SBSNR ).BaseSurf != SBSNR ) SubSurfsOfBase[ Surface( SBSNR ).BaseSurf ].push_back( SBSNR );
+			if ( Surface( SBSNR ).Zone > 0 ) SurfsInZone[ Surface( SBSNR ).Zone ].push_back( SBSNR );
+		}
+
 		for ( GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR ) { // Loop through all surfaces (looking for potential receiving surfaces)...
 
 			ShadowingSurf = Surface( GRSNR ).ShadowingSurf;
@@ -3729,7 +3658,16 @@ namespace SolarShading {
 			NGSS = 0;
 			if ( SolarDistribution != MinimalShadowing ) { // Except when doing simplified exterior shadowing.
 
-				for ( GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) { // Loop through all surfaces, looking for ones that could shade GRSNR
+				// Only subsurfaces of GRSNR and surfaces reaching above both the plane of GRSNR
+				// and its lowest point (see CHKGSS) can shade it
+				auto const & vertex_R( Surface( GRSNR ).Vertex );
+				CullPlanes[ 0 ] = HalfSpace( ( vertex_R( 3 ) - vertex_R( 2 ) ) * ( vertex_R( 1 ) - vertex_R( 2 ) ), vertex_R( 2 ), 0.0 );
+				CullPlanes[ 1 ] = HalfSpace( Vector( 0.0, 0.0, 1.0 ), Vector( 0.0, 0.0, ZMIN ), 0.0 );
+				SurfacesInHalfSpaces( CullPlanes, CullSurfs );
+				CandidateSurfs.clear();
+				std::set_union( SubSurfsOfBase[ GRSNR ].begin(), SubSurfsOfBase[ GRSNR ].end(), CullSurfs.begin(), CullSurfs.end(), std::back_inserter( CandidateSurfs ) );
+
+				for ( int const GSSNR : CandidateSurfs ) { // Loop through possible shadow casting surfaces, looking for ones that could shade GRSNR
 
 					if ( GSSNR == GRSNR ) continue; // Receiving surface cannot shade itself
 					if ( ( Surface( GSSNR ).HeatTransSurf ) && ( Surface( GSSNR ).BaseSurf == GRSNR ) ) continue; // A heat transfer subsurface of a receiving surface
@@ -3765,7 +3703,7 @@ namespace SolarShading {
 				} // ...end of surfaces DO loop (GSSNR)
 			} else { // Simplified Distribution -- still check for Shading Subsurfaces
 
-				for ( GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) { // Loop through all surfaces (looking for surfaces which could shade GRSNR) ...
+				for ( int const GSSNR : SubSurfsOfBase[ GRSNR ] ) { // Loop through subsurfaces (looking for surfaces which could shade GRSNR) ...
 
 					if ( GSSNR == GRSNR ) continue; // Receiving surface cannot shade itself
 					if ( ( Surface( GSSNR ).HeatTransSurf ) && ( Surface( GSSNR ).BaseSurf == GRSNR ) ) continue; // Skip heat transfer subsurfaces of receiving surface
@@ -3784,7 +3722,7 @@ namespace SolarShading {
 			NSBS = 0;
 			HasWindow = false;
 			//legacy: IF (OSENV(HTS) > 10) WINDOW=.TRUE. -->Note: WINDOW was set true for roof ponds, solar walls, or other zones
-			for ( SBSNR = 1; SBSNR <= TotSurfaces; ++SBSNR ) { // Loop through the surfaces yet again (looking for subsurfaces of GRSNR)...
+			for ( int const SBSNR : SubSurfsOfBase[ GRSNR ] ) { // Loop through the subsurfaces of GRSNR...
 
 				if ( ! Surface( SBSNR ).HeatTransSurf ) continue; // Skip non heat transfer subsurfaces
 				if ( SBSNR == GRSNR ) continue; // Surface itself cannot be its own subsurface
@@ -3805,9 +3743,9 @@ namespace SolarShading {
 			NBKS = 0;
 			//                                        Except for simplified
 			//                                        interior solar distribution,
-			if ( ( SolarDistribution == FullInteriorExterior ) && ( HasWindow ) ) { // For full interior solar distribution | and a window present on base surface (GRSNR)
+			if ( ( SolarDistribution == FullInteriorExterior ) && ( HasWindow ) && ( Surface( GRSNR ).Zone > 0 ) ) { // For full interior solar distribution | and a window present on base surface (GRSNR)
 
-				for ( BackSurfaceNumber = 1; BackSurfaceNumber <= TotSurfaces; ++BackSurfaceNumber ) { // Loop through surfaces yet again, looking for back surfaces to GRSNR
+				for ( int const BackSurfaceNumber : SurfsInZone[ Surface( GRSNR ).Zone ] ) { // Loop through surfaces of the zone, looking for back surfaces to GRSNR
 
 					if ( ! Surface( BackSurfaceNumber ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
 					if ( Surface( BackSurfaceNumber ).BaseSurf == GRSNR ) continue; // Skip subsurfaces of this GRSNR
@@ -3964,13 +3902,15 @@ namespace SolarShading {
 		// and sunlit areas used in computing the solar beam flux multipliers.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// With PixelCountingShading the shadows on all receiving surfaces are rendered first
+		// (RenderShadowRasters) unless ShadowRastersReady says they already have been (sky
+		// patches); SHDGSS and SHDSBS then use the sunlit fractions found.
 
 		// REFERENCES:
 		// BLAST/IBLAST code, original author George Walton
 
-		// USE STATEMENTS:
-		// na
+		// Using/Aliasing
+		using DataSystemVariables::PixelCountingShading;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -3985,9 +3925,6 @@ namespace SolarShading {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 XS; // Intermediate result
-		Real64 YS; // Intermediate result
-		Real64 ZS; // Intermediate result
 		int N; // Vertex number
 		int NGRS; // Coordinate transformation index
 		int NZ; // Zone Number of surface
@@ -4024,6 +3961,8 @@ namespace SolarShading {
 
 		SAREA = 0.0;
 
+		if ( PixelCountingShading && ! ShadowRastersReady ) RenderShadowRasters( iHour, TS );
+
 		for ( GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR ) {
 
 			if ( ! ShadowComb( GRSNR ).UseThisSurf ) continue;
@@ -4055,20 +3994,7 @@ namespace SolarShading {
 				NGRS = Surface( GRSNR ).BaseSurf;
 				if ( Surface( GRSNR ).ShadowingSurf ) NGRS = GRSNR;
 
-				// Compute the X and Y displacements of a shadow.
-				XS = Surface( NGRS ).lcsx.x * SUNCOS( 1 ) + Surface( NGRS ).lcsx.y * SUNCOS( 2 ) + Surface( NGRS ).lcsx.z * SUNCOS( 3 );
-				YS = Surface( NGRS ).lcsy.x * SUNCOS( 1 ) + Surface( NGRS ).lcsy.y * SUNCOS( 2 ) + Surface( NGRS ).lcsy.z * SUNCOS( 3 );
-				ZS = Surface( NGRS ).lcsz.x * SUNCOS( 1 ) + Surface( NGRS ).lcsz.y * SUNCOS( 2 ) + Surface( NGRS ).lcsz.z * SUNCOS( 3 );
-
-				if ( std::abs( ZS ) > 1.e-4 ) {
-					XShadowProjection = XS / ZS;
-					YShadowProjection = YS / ZS;
-					if ( std::abs( XShadowProjection ) < 1.e-8 ) XShadowProjection = 0.0;
-					if ( std::abs( YShadowProjection ) < 1.e-8 ) YShadowProjection = 0.0;
-				} else {
-					XShadowProjection = 0.0;
-					YShadowProjection = 0.0;
-				}
+				CalcShadowProjection( NGRS ); // Compute the X and Y displacements of a shadow.
 
 				CTRANS( GRSNR, NGRS, NVT, XVT, YVT, ZVT ); // Transform coordinates of the receiving surface to 2-D form
 
@@ -4106,6 +4032,181 @@ namespace SolarShading {
 
 	}
 
+	void
+	CalcShadowProjection( int const NGRS ) // Surface whose coordinate system shadows are projected in
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets XShadowProjection and YShadowProjection, the X and Y displacements of a shadow
+		// per unit height above the plane of surface NGRS, for the current sun position.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 XS; // Intermediate result
+		Real64 YS; // Intermediate result
+		Real64 ZS; // Intermediate result
+
+		XS = Surface( NGRS ).lcsx.x * SUNCOS( 1 ) + Surface( NGRS ).lcsx.y * SUNCOS( 2 ) + Surface( NGRS ).lcsx.z * SUNCOS( 3 );
+		YS = Surface( NGRS ).lcsy.x * SUNCOS( 1 ) + Surface( NGRS ).lcsy.y * SUNCOS( 2 ) + Surface( NGRS ).lcsy.z * SUNCOS( 3 );
+		ZS = Surface( NGRS ).lcsz.x * SUNCOS( 1 ) + Surface( NGRS ).lcsz.y * SUNCOS( 2 ) + Surface( NGRS ).lcsz.z * SUNCOS( 3 );
+
+		if ( std::abs( ZS ) > 1.e-4 ) {
+			XShadowProjection = XS / ZS;
+			YShadowProjection = YS / ZS;
+			if ( std::abs( XShadowProjection ) < 1.e-8 ) XShadowProjection = 0.0;
+			if ( std::abs( YShadowProjection ) < 1.e-8 ) YShadowProjection = 0.0;
+		} else {
+			XShadowProjection = 0.0;
+			YShadowProjection = 0.0;
+		}
+
+	}
+
+	void
+	RenderShadowRasters(
+		int const iHour, // Hour index
+		int const TS // Time Step
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Computes the sunlit fraction of every sunlit receiving surface that has shadowing
+		// surfaces or subsurfaces, and of its subsurfaces, by pixel counting
+		// (PixelCountingShading).  SHDGSS and SHDSBS use the results in ShadowRasters.
+		// Also keeps the largest error bound of the results for the eio report.
+
+		// Using/Aliasing
+		using DataSystemVariables::PixelCountingResolution;
+		using PixelCounting::RasterErrorBound;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static std::vector< int > Receivers; // Surfaces with a job for this sun position
+		static std::vector< PixelCounting::RasterJob * > Jobs;
+
+		BuildShadowRasters( iHour, TS, false, Receivers );
+
+		Jobs.clear();
+		for ( int const GRSNR : Receivers ) {
+			Jobs.push_back( &ShadowRasters( GRSNR ) );
+		}
+		RenderRasters( Jobs );
+
+		for ( int const GRSNR : Receivers ) {
+			Real64 const ErrorBound( RasterErrorBound( ShadowRasters( GRSNR ), PixelCountingResolution ) );
+			if ( ErrorBound > MaxRasterErrorBound ) {
+				MaxRasterErrorBound = ErrorBound;
+				MaxRasterErrorSurface = GRSNR;
+			}
+		}
+
+	}
+
+	void
+	BuildShadowRasters(
+		int const iHour, // Hour index
+		int const TS, // Time Step
+		bool const FindCoverSets, // Keep cover sets so the jobs can be re-weighted for new transmittances
+		std::vector< int > & Receivers // Surfaces given a job in ShadowRasters
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets up the pixel counting job in ShadowRasters of every sunlit receiving surface that has
+		// shadowing surfaces or subsurfaces, for the current sun position (SUNCOS, CTHETA).
+
+		// METHODOLOGY EMPLOYED:
+		// Receiving surfaces, subsurfaces and projected shadows are found exactly as for polygon
+		// clipping (CTRANS, ShadeV and ProjectShadowCaster).  These use the module work arrays, so
+		// the jobs are built one surface at a time; only rendering (RenderRasters) is parallel.
+		// Shadows are tagged with the number of the shading surface.  With FindCoverSets, shading
+		// surfaces that are currently fully transparent are kept so that they can be re-weighted.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static FArray1D< Real64 > XVT; // X Vertices of the receiving surface
+		static FArray1D< Real64 > YVT; // Y Vertices of the receiving surface
+		static FArray1D< Real64 > ZVT; // Z Vertices of the receiving surface
+		static bool OneTimeFlag( true );
+		int NVT; // Number of vertices of the receiving surface
+		int NGRS; // Coordinate transformation index
+		Real64 SchValue; // Transmittance of a shadow
+
+		if ( OneTimeFlag ) {
+			XVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
+			YVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
+			ZVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
+			ShadowRasters.allocate( TotSurfaces );
+			OneTimeFlag = false;
+		}
+
+		Receivers.clear();
+		for ( int GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR ) {
+
+			if ( ! ShadowComb( GRSNR ).UseThisSurf ) continue;
+			if ( CTHETA( GRSNR ) < SunIsUpValue ) continue; // Receiving surface is not in the sun
+			int const NGSS( ShadowComb( GRSNR ).NumGenSurf );
+			int const NSBS( ShadowComb( GRSNR ).NumSubSurf );
+			if ( ( NGSS <= 0 ) && ( NSBS <= 0 ) ) continue; // Simple surface--no shaders or subsurfaces
+
+			NGRS = Surface( GRSNR ).BaseSurf;
+			if ( Surface( GRSNR ).ShadowingSurf ) NGRS = GRSNR;
+			CalcShadowProjection( NGRS );
+
+			auto & Job( ShadowRasters( GRSNR ) );
+			Job.clear();
+			Job.FindCoverSets = FindCoverSets;
+
+			CTRANS( GRSNR, NGRS, NVT, XVT, YVT, ZVT );
+			Job.BeginPolygon( 1.0, GRSNR );
+			for ( int N = 1; N <= NVT; ++N ) {
+				Job.AddVertex( XVT( N ), YVT( N ) );
+			}
+
+			for ( int I = 1; I <= NSBS; ++I ) {
+				int const SBSNR( ShadowComb( GRSNR ).SubSurf( I ) );
+				Job.BeginPolygon( 1.0, SBSNR );
+				for ( int N = 1; N <= Surface( SBSNR ).Sides; ++N ) {
+					Job.AddVertex( ShadeV( SBSNR ).XV( N ), ShadeV( SBSNR ).YV( N ) );
+				}
+			}
+			Job.NumSubSurfaces = NSBS;
+
+			for ( int I = 1; I <= NGSS; ++I ) {
+				int const GSSNR( ShadowComb( GRSNR ).GenSurf( I ) );
+				if ( ! ProjectShadowCaster( NGRS, iHour, TS, GSSNR, SchValue, FindCoverSets ) ) continue;
+				Job.BeginPolygon( SchValue, GSSNR );
+				for ( int N = 1; N <= NVS; ++N ) {
+					Job.AddVertex( XVS( N ), YVS( N ) );
+				}
+			}
+
+			Receivers.push_back( GRSNR );
+		}
+
+	}
+
+	void
+	RenderRasters( std::vector< PixelCounting::RasterJob * > const & Jobs )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Renders pixel counting jobs, in parallel when built with OpenMP.
+
+		// METHODOLOGY EMPLOYED:
+		// A job only touches its own data, so the result does not depend on the number of threads.
+
+		// Using/Aliasing
+		using DataSystemVariables::PixelCountingResolution;
+		using PixelCounting::RenderRaster;
+
+		int const NumJobs( Jobs.size() );
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic )
+#endif
+		for ( int I = 0; I < NumJobs; ++I ) {
+			RenderRaster( *Jobs[ I ], PixelCountingResolution );
+		}
+
+	}
+
 	void
 	SHDBKS(
 		int const NGRS, // Number of the general receiving surface
@@ -4268,16 +4369,14 @@ namespace SolarShading {
 		// This subroutine determines the shadows on a general receiving surface.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// With PixelCountingShading the shadows have already been rendered (RenderShadowRasters)
+		// and only the sunlit fraction of the surface is used; no shadow figures are kept.
 
 		// REFERENCES:
 		// BLAST/IBLAST code, original author George Walton
 
 		// Using/Aliasing
-		using ScheduleManager::LookUpScheduleValue;
-		using ScheduleManager::GetCurrentScheduleValue;
-		using ScheduleManager::GetScheduleMinValue;
-		using ScheduleManager::GetScheduleName;
+		using DataSystemVariables::PixelCountingShading;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -4296,22 +4395,11 @@ namespace SolarShading {
 		int GSSNR; // General shadowing surface number
 		int MainOverlapStatus; // Overlap status of the main overlap calculation not the check for
 		// multiple overlaps (unless there was an error)
-		static FArray1D< Real64 > XVT;
-		static FArray1D< Real64 > YVT;
-		static FArray1D< Real64 > ZVT;
-		static bool OneTimeFlag( true );
 		int NS1; // Number of the figure being overlapped
 		int NS2; // Number of the figure doing overlapping
 		int NS3; // Location to place results of overlap
 		Real64 SchValue; // Value for Schedule of shading transmittence
 
-		if ( OneTimeFlag ) {
-			XVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
-			YVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
-			ZVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
-			OneTimeFlag = false;
-		}
-
 		FGSSHC = LOCHCA + 1;
 		MainOverlapStatus = NoOverlap; // Set to ensure that the value from the last surface is not saved
 		OverlapStatus = NoOverlap;
@@ -4320,73 +4408,20 @@ namespace SolarShading {
 
 			SAREA( HTS ) = HCAREA( 1 ); // Surface fully sunlit
 
+		} else if ( PixelCountingShading ) {
+
+			SAREA( HTS ) = HCAREA( 1 ) * ShadowRasters( CurSurf ).LitFraction[ 0 ];
+
 		} else {
 
 			int ExitLoopStatus( -1 );
 			auto const & GenSurf( ShadowComb( CurSurf ).GenSurf );
-			auto const sunIsUp( SunIsUpValue );
 			for ( int I = 1; I <= NGSS; ++I ) { // Loop through all shadowing surfaces...
 
 				GSSNR = GenSurf( I );
 
-				if ( CTHETA( GSSNR ) > sunIsUp ) continue; //.001) CYCLE ! NO SHADOW IF GSS IN SUNLIGHT.
-
-				auto const & surface( Surface( GSSNR ) );
-				bool const notHeatTransSurf( ! surface.HeatTransSurf );
-
-				//     This used to check to see if the shadowing surface was not opaque (within the scheduled dates of
-				//            transmittance value.  Perhaps it ignored it if it were outside the range.  (if so, was an error)
-				//     The proper action seems to be delete this statement all together, but there would also be no shading if
-				//            the shading surface were transparent...
-				//---former stmt      IF ((.NOT.Surface(GSSNR)%HeatTransSurf) .AND. &
-				//---former stmt            GetCurrentScheduleValue(Surface(GSSNR)%SchedShadowSurfIndex,IHOUR) == 0.0) CYCLE
-
-				if ( notHeatTransSurf ) {
-					if ( surface.IsTransparent ) continue; // No shadow if shading surface is transparent
-					if ( surface.SchedShadowSurfIndex > 0 ) {
-						if ( LookUpScheduleValue( surface.SchedShadowSurfIndex, iHour ) == 1.0 ) continue;
-						if ( ! CalcSkyDifShading ) {
-							if ( LookUpScheduleValue( surface.SchedShadowSurfIndex, iHour, TS ) == 1.0 ) continue;
-						}
-					}
-				}
-
-				//      IF ((.NOT.Surface(GSSNR)%HeatTransSurf) .AND. &
-				//            GetCurrentScheduleValue(Surface(GSSNR)%SchedShadowSurfIndex) == 1.0) CYCLE
-
-				// Transform shadow casting surface from cartesian to homogeneous coordinates according to surface type.
-
-				if ( ( notHeatTransSurf ) && ( surface.BaseSurf != 0 ) ) {
-
-					// For shadowing subsurface coordinates of shadow casting surface are relative to the receiving surface
-					// project shadow to the receiving surface
-
-					NVS = surface.Sides;
-					auto const & XV( ShadeV( GSSNR ).XV );
-					auto const & YV( ShadeV( GSSNR ).YV );
-					auto const & ZV( ShadeV( GSSNR ).ZV );
-					for ( int N = 1; N <= NVS; ++N ) {
-						XVS( N ) = XV( N ) - XShadowProjection * ZV( N );
-						YVS( N ) = YV( N ) - YShadowProjection * ZV( N );
-					}
-
-				} else {
-					// Transform coordinates of shadow casting surface from general system to the system relative to the receiving surface
-					int NVT;
-					CTRANS( GSSNR, NGRS, NVT, XVT, YVT, ZVT );
-					CLIP( NVT, XVT, YVT, ZVT ); // Clip portions of the shadow casting surface which are behind the receiving surface
-
-					if ( NumVertInShadowOrClippedSurface <= 2 ) continue;
-
-					// Project shadow from shadow casting surface along sun's rays to receiving surface Shadow vertices
-					// become clockwise sequential
-
-					for ( int N = 1; N <= NumVertInShadowOrClippedSurface; ++N ) {
-						XVS( N ) = XVC( N ) - XShadowProjection * ZVC( N );
-						YVS( N ) = YVC( N ) - YShadowProjection * ZVC( N );
-					}
-
-				}
+				// Skip casters that cast no shadow; otherwise project the shadow into XVS, YVS.
+				if ( ! ProjectShadowCaster( NGRS, iHour, TS, GSSNR, SchValue ) ) continue;
 
 				// Transform to the homogeneous coordinate system.
 
@@ -4413,15 +4448,6 @@ namespace SolarShading {
 					}
 				}
 				HTRANS0( NS3, NumVertInShadowOrClippedSurface );
-				if ( ! CalcSkyDifShading ) {
-					if ( iHour != 0 ) {
-						SchValue = LookUpScheduleValue( surface.SchedShadowSurfIndex, iHour, TS );
-					} else {
-						SchValue = surface.SchedMinValue;
-					}
-				} else {
-					SchValue = surface.SchedMinValue;
-				}
 
 				HCT( NS3 ) = SchValue;
 
@@ -4491,31 +4517,147 @@ namespace SolarShading {
 
 	}
 
-	void
-	CalcInteriorSolarOverlaps(
-		int const iHour, // Hour Index
-		int const NBKS, // Number of back surfaces associated with this GRSNR (in general, only
-		int const HTSS, // Surface number of the subsurface (exterior window)
-		int const GRSNR, // General receiving surface number (base surface of the exterior window)
-		int const TS // Time step Index
+	bool
+	ProjectShadowCaster(
+		int const NGRS, // Surface whose coordinate system shadows are projected in
+		int const iHour, // Hour Counter
+		int const TS, // TimeStep
+		int const GSSNR, // General shadowing surface number
+		Real64 & SchValue, // Transmittance of the shadow
+		bool const KeepTransparent // Project surfaces scheduled to be fully transparent now (SchValue = 1)
 	)
 	{
 
-		// SUBROUTINE INFORMATION:
-		//       AUTHOR         Fred Winkelmann
-		//       DATE WRITTEN   January 1999
-		//       MODIFIED       Nov 2001, FW: include beam radiation overlaps with
-		//                       back windows and doors; previously these subsurfaces ignored.
-		//                      May 2002, FW: fix problem where reveal was not being considered
-		//                       in calculating overlap areas if window is shaded only by reveal.
-		//                      June 2002, FW: fix problem that gave incorrect calculation when
-		//                       window is not shaded only by reveal
-		//                      June 2002, FW: remove incorrect multiplication of overlap areas
-		//                       by sunlit fraction when window is shaded only by reveal
-		//       RE-ENGINEERED  na
+		// PURPOSE OF THIS FUNCTION:
+		// Projects the shadow of shadow casting surface GSSNR along the sun's rays onto the plane
+		// of surface NGRS, leaving its NVS vertices in XVS and YVS.  Returns false if the surface
+		// casts no shadow (in the sun, transparent, or entirely behind the receiving surface).
 
-		// PURPOSE OF THIS SUBROUTINE:
-		// For an exterior window with surface number HTSS, determines (1) the surface numbers of back
+		// METHODOLOGY EMPLOYED:
+		// Taken from SHDGSS so that polygon clipping and pixel counting project shadows the same way.
+		// XShadowProjection and YShadowProjection must be set for NGRS (CalcShadowProjection).
+
+		// REFERENCES:
+		// BLAST/IBLAST code, original author George Walton
+
+		// Using/Aliasing
+		using ScheduleManager::LookUpScheduleValue;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		static FArray1D< Real64 > XVT;
+		static FArray1D< Real64 > YVT;
+		static FArray1D< Real64 > ZVT;
+		static bool OneTimeFlag( true );
+
+		if ( OneTimeFlag ) {
+			XVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
+			YVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
+			ZVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
+			OneTimeFlag = false;
+		}
+
+		if ( CTHETA( GSSNR ) > SunIsUpValue ) return false; //.001) CYCLE ! NO SHADOW IF GSS IN SUNLIGHT.
+
+		auto const & surface( Surface( GSSNR ) );
+		bool const notHeatTransSurf( ! surface.HeatTransSurf );
+
+		//     This used to check to see if the shadowing surface was not opaque (within the scheduled dates of
+		//            transmittance value.  Perhaps it ignored it if it were outside the range.  (if so, was an error)
+		//     The proper action seems to be delete this statement all together, but there would also be no shading if
+		//            the shading surface were transparent...
+		//---former stmt      IF ((.NOT.Surface(GSSNR)%HeatTransSurf) .AND. &
+		//---former stmt            GetCurrentScheduleValue(Surface(GSSNR)%SchedShadowSurfIndex,IHOUR) == 0.0) CYCLE
+
+		bool ScheduledTransparent( false ); // Transmittance schedule is 1.0 now
+		if ( notHeatTransSurf ) {
+			if ( surface.IsTransparent ) return false; // No shadow if shading surface is transparent
+			if ( surface.SchedShadowSurfIndex > 0 ) {
+				if ( LookUpScheduleValue( surface.SchedShadowSurfIndex, iHour ) == 1.0 ) ScheduledTransparent = true;
+				if ( ! ScheduledTransparent && ! CalcSkyDifShading ) {
+					if ( LookUpScheduleValue( surface.SchedShadowSurfIndex, iHour, TS ) == 1.0 ) ScheduledTransparent = true;
+				}
+				if ( ScheduledTransparent && ! KeepTransparent ) return false;
+			}
+		}
+
+		//      IF ((.NOT.Surface(GSSNR)%HeatTransSurf) .AND. &
+		//            GetCurrentScheduleValue(Surface(GSSNR)%SchedShadowSurfIndex) == 1.0) CYCLE
+
+		// Transform shadow casting surface from cartesian to homogeneous coordinates according to surface type.
+
+		if ( ( notHeatTransSurf ) && ( surface.BaseSurf != 0 ) ) {
+
+			// For shadowing subsurface coordinates of shadow casting surface are relative to the receiving surface
+			// project shadow to the receiving surface
+
+			NVS = surface.Sides;
+			auto const & XV( ShadeV( GSSNR ).XV );
+			auto const & YV( ShadeV( GSSNR ).YV );
+			auto const & ZV( ShadeV( GSSNR ).ZV );
+			for ( int N = 1; N <= NVS; ++N ) {
+				XVS( N ) = XV( N ) - XShadowProjection * ZV( N );
+				YVS( N ) = YV( N ) - YShadowProjection * ZV( N );
+			}
+
+		} else {
+			// Transform coordinates of shadow casting surface from general system to the system relative to the receiving surface
+			int NVT;
+			CTRANS( GSSNR, NGRS, NVT, XVT, YVT, ZVT );
+			CLIP( NVT, XVT, YVT, ZVT ); // Clip portions of the shadow casting surface which are behind the receiving surface
+
+			if ( NumVertInShadowOrClippedSurface <= 2 ) return false;
+
+			// Project shadow from shadow casting surface along sun's rays to receiving surface Shadow vertices
+			// become clockwise sequential
+
+			for ( int N = 1; N <= NumVertInShadowOrClippedSurface; ++N ) {
+				XVS( N ) = XVC( N ) - XShadowProjection * ZVC( N );
+				YVS( N ) = YVC( N ) - YShadowProjection * ZVC( N );
+			}
+
+		}
+
+		if ( ScheduledTransparent ) {
+			SchValue = 1.0;
+		} else if ( ! CalcSkyDifShading ) {
+			if ( iHour != 0 ) {
+				SchValue = LookUpScheduleValue( surface.SchedShadowSurfIndex, iHour, TS );
+			} else {
+				SchValue = surface.SchedMinValue;
+			}
+		} else {
+			SchValue = surface.SchedMinValue;
+		}
+
+		return true;
+
+	}
+
+	void
+	CalcInteriorSolarOverlaps(
+		int const iHour, // Hour Index
+		int const NBKS, // Number of back surfaces associated with this GRSNR (in general, only
+		int const HTSS, // Surface number of the subsurface (exterior window)
+		int const GRSNR, // General receiving surface number (base surface of the exterior window)
+		int const TS // Time step Index
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Fred Winkelmann
+		//       DATE WRITTEN   January 1999
+		//       MODIFIED       Nov 2001, FW: include beam radiation overlaps with
+		//                       back windows and doors; previously these subsurfaces ignored.
+		//                      May 2002, FW: fix problem where reveal was not being considered
+		//                       in calculating overlap areas if window is shaded only by reveal.
+		//                      June 2002, FW: fix problem that gave incorrect calculation when
+		//                       window is not shaded only by reveal
+		//                      June 2002, FW: remove incorrect multiplication of overlap areas
+		//                       by sunlit fraction when window is shaded only by reveal
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// For an exterior window with surface number HTSS, determines (1) the surface numbers of back
 		// surfaces receiving beam radiation from the window and (2) for each such back surface, the area
 		// of the portion of the window sending beam radiation to the back surface; this is called the
 		// "overlap area."
@@ -7034,6 +7176,7 @@ namespace SolarShading {
 		// Calculate sky diffuse shading
 
 		if ( BeginSimFlag ) {
+			InitShadingResultCache();
 			CalcSkyDifShading = true;
 			SkyDifSolarShading(); // Calculate factors for shading of sky diffuse solar
 			CalcSkyDifShading = false;
@@ -7104,6 +7247,253 @@ namespace SolarShading {
 
 	}
 
+	void
+	InitShadingResultCache()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Opens the shading result cache named by the SHADING_CACHE environment variable (with the
+		// hash of the cache keys appended) and reports its status to the initialization output file.
+
+		// METHODOLOGY EMPLOYED:
+		// The cache keys hash everything the sunlit fractions, back surface overlaps and sky
+		// diffuse shading ratios depend on apart from the sun position, which goes into each
+		// record key instead (see ShadingRecordKey).  Geometry is hashed after it has been
+		// processed, so changes to e.g. wall thickness that move window reveals are caught while
+		// changes to material properties are not.  Shading surface transmittance schedules that
+		// vary make the results depend on the day of the run, so the cache is not used then.
+
+		// Using/Aliasing
+		using namespace ShadingCache;
+		using DataSystemVariables::ShadingCacheFileName;
+		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
+		using DataSystemVariables::DetailedSolarTimestepIntegration;
+		using DataSystemVariables::SutherlandHodgman;
+		using DataSystemVariables::PixelCountingShading;
+		using DataSystemVariables::PixelCountingResolution;
+		using General::RoundSigDigits;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::vector< std::uint64_t > Keys( NumCacheKeys, HashSeed );
+
+		if ( ShadingCacheFileName.empty() ) return;
+
+		std::uint64_t & Geometry( Keys[ KeyGeometry ] );
+		Geometry = HashValue( Geometry, TotSurfaces );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			Geometry = HashValue( Geometry, surface.Class );
+			Geometry = HashValue( Geometry, surface.Sides );
+			for ( int N = 1; N <= surface.Sides; ++N ) {
+				Geometry = HashValue( Geometry, surface.Vertex( N ).x );
+				Geometry = HashValue( Geometry, surface.Vertex( N ).y );
+				Geometry = HashValue( Geometry, surface.Vertex( N ).z );
+			}
+			Geometry = HashValue( Geometry, surface.BaseSurf );
+			Geometry = HashValue( Geometry, surface.Zone );
+			Geometry = HashValue( Geometry, surface.ExtBoundCond );
+			Geometry = HashValue( Geometry, surface.ShadowingSurf );
+			Geometry = HashValue( Geometry, surface.HeatTransSurf );
+			Geometry = HashValue( Geometry, surface.ExtSolar );
+			Geometry = HashValue( Geometry, surface.MirroredSurf );
+			Geometry = HashValue( Geometry, surface.IsConvex );
+			Geometry = HashValue( Geometry, surface.IsTransparent );
+			Geometry = HashValue( Geometry, surface.SchedMinValue );
+			Geometry = HashValue( Geometry, surface.Area );
+			Geometry = HashValue( Geometry, surface.NetAreaShadowCalc );
+			Geometry = HashValue( Geometry, surface.Reveal );
+			Geometry = HashValue( Geometry, surface.Construction > 0 && Construct( surface.Construction ).TransDiff > 0.0 );
+			if ( surface.Class == SurfaceClass_Window ) {
+				Geometry = HashValue( Geometry, SurfaceWindow( SurfNum ).GlazedFrac );
+				if ( surface.FrameDivider > 0 ) {
+					auto const & frameDivider( FrameDivider( surface.FrameDivider ) );
+					Geometry = HashValue( Geometry, frameDivider.FrameWidth );
+					Geometry = HashValue( Geometry, frameDivider.FrameProjectionOut );
+					Geometry = HashValue( Geometry, frameDivider.FrameProjectionIn );
+					Geometry = HashValue( Geometry, frameDivider.DividerWidth );
+					Geometry = HashValue( Geometry, frameDivider.DividerProjectionOut );
+					Geometry = HashValue( Geometry, frameDivider.DividerProjectionIn );
+					Geometry = HashValue( Geometry, frameDivider.HorDividers );
+					Geometry = HashValue( Geometry, frameDivider.VertDividers );
+				}
+			}
+		}
+
+		std::uint64_t & Location( Keys[ KeyLocation ] );
+		Location = HashValue( Location, Latitude );
+		Location = HashValue( Location, Longitude );
+		Location = HashValue( Location, TimeZoneMeridian );
+
+		std::uint64_t & Timing( Keys[ KeyTiming ] );
+		Timing = HashValue( Timing, ShadowingCalcFrequency );
+		Timing = HashValue( Timing, NumOfTimeStepInHour );
+		Timing = HashValue( Timing, TS1TimeOffset );
+
+		std::uint64_t & Algorithm( Keys[ KeyAlgorithm ] );
+		Algorithm = HashValue( Algorithm, SolarDistribution );
+		Algorithm = HashValue( Algorithm, SutherlandHodgman );
+		Algorithm = HashValue( Algorithm, DetailedSkyDiffuseAlgorithm );
+		Algorithm = HashValue( Algorithm, DetailedSolarTimestepIntegration );
+		Algorithm = HashValue( Algorithm, MaxHCS );
+		Algorithm = HashValue( Algorithm, MaxBkSurf );
+		Algorithm = HashValue( Algorithm, PixelCountingShading );
+		if ( PixelCountingShading ) Algorithm = HashValue( Algorithm, PixelCountingResolution );
+
+		if ( ShadingTransmittanceVaries ) {
+			DisableShadingCache( "shading surface transmittance varies" );
+		} else {
+			OpenShadingCache( ShadingCacheFileName, Keys );
+		}
+
+		gio::write( OutputFileInits, fmtA ) << "! <Shading Result Cache>, Status, Cache File, Records Available, Reason";
+		gio::write( OutputFileInits, fmtA ) << "Shading Result Cache," + cCacheStatus[ CacheStatus ] + ',' + ( CacheStatus == CacheDisabled ? ShadingCacheFileName : CacheFileName ) + ',' + RoundSigDigits( NumRecordsAvailable ) + ',' + StatusReason;
+
+	}
+
+	std::uint64_t
+	ShadingRecordKey(
+		int const Kind, // SkyDiffuseRecord or BeamRecord
+		Real64 const EqOfTime, // Equation of Time for the period
+		Real64 const SinSolarDeclin, // Sine of Solar Declination for the period
+		Real64 const CosSolarDeclin, // Cosine of Solar Declination for the period
+		int const iHour, // First hour of the results
+		int const iTimeStep // First time step of the results
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the shading result cache key of a set of shading results.
+
+		// Using/Aliasing
+		using ShadingCache::HashSeed;
+		using ShadingCache::HashValue;
+
+		std::uint64_t Key( HashValue( HashSeed, Kind ) );
+		Key = HashValue( Key, EqOfTime );
+		Key = HashValue( Key, SinSolarDeclin );
+		Key = HashValue( Key, CosSolarDeclin );
+		Key = HashValue( Key, iHour );
+		return HashValue( Key, iTimeStep );
+
+	}
+
+	void
+	PackShadingRecord(
+		int const FirstHour,
+		int const LastHour,
+		int const FirstTimeStep,
+		int const LastTimeStep,
+		ShadingCache::ShadingRecord & Record
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Packs the beam solar results of CalcPerSolarBeam for the given hours and time steps
+		// into a shading result cache record.
+
+		// METHODOLOGY EMPLOYED:
+		// The hourly and time step values of each surface are stored densely in Reals.  Back
+		// surfaces are stored sparsely: for each surface, hour and time step, Ints holds the
+		// number of back surfaces followed by their surface numbers, and their overlap areas
+		// are appended to Reals after the dense values.
+
+		Record.clear();
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			for ( int iHour = FirstHour; iHour <= LastHour; ++iHour ) {
+				Record.Reals.push_back( SunlitFracHR( SurfNum, iHour ) );
+				Record.Reals.push_back( CosIncAngHR( SurfNum, iHour ) );
+				Record.Reals.push_back( SurfaceWindow( SurfNum ).OutProjSLFracMult( iHour ) );
+				Record.Reals.push_back( SurfaceWindow( SurfNum ).InOutProjSLFracMult( iHour ) );
+				for ( int TS = FirstTimeStep; TS <= LastTimeStep; ++TS ) {
+					Record.Reals.push_back( SunlitFrac( SurfNum, iHour, TS ) );
+					Record.Reals.push_back( SunlitFracWithoutReveal( SurfNum, iHour, TS ) );
+					Record.Reals.push_back( CosIncAng( SurfNum, iHour, TS ) );
+				}
+			}
+		}
+
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			for ( int iHour = FirstHour; iHour <= LastHour; ++iHour ) {
+				for ( int TS = FirstTimeStep; TS <= LastTimeStep; ++TS ) {
+					int NumBack( 0 );
+					while ( NumBack < MaxBkSurf && BackSurfaces( SurfNum, NumBack + 1, iHour, TS ) != 0 ) ++NumBack;
+					Record.Ints.push_back( NumBack );
+					for ( int Back = 1; Back <= NumBack; ++Back ) {
+						Record.Ints.push_back( BackSurfaces( SurfNum, Back, iHour, TS ) );
+						Record.Reals.push_back( OverlapAreas( SurfNum, Back, iHour, TS ) );
+					}
+				}
+			}
+		}
+
+	}
+
+	bool
+	UnpackShadingRecord(
+		int const FirstHour,
+		int const LastHour,
+		int const FirstTimeStep,
+		int const LastTimeStep,
+		ShadingCache::ShadingRecord const & Record
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Restores the beam solar results packed by PackShadingRecord.  Returns false, leaving
+		// the results untouched, if the record does not have the layout expected for this run.
+
+		int const NumHours( LastHour - FirstHour + 1 );
+		int const NumTimeSteps( LastTimeStep - FirstTimeStep + 1 );
+		std::size_t const NumDense( std::size_t( TotSurfaces ) * NumHours * ( 4 + 3 * NumTimeSteps ) );
+		std::size_t const NumEntries( std::size_t( TotSurfaces ) * NumHours * NumTimeSteps );
+
+		// Check the layout before touching any results
+		std::size_t NumOverlaps( 0 );
+		std::size_t Pos( 0 );
+		for ( std::size_t Entry = 0; Entry < NumEntries; ++Entry ) {
+			if ( Pos >= Record.Ints.size() ) return false;
+			int const NumBack( Record.Ints[ Pos ] );
+			if ( NumBack < 0 || NumBack > MaxBkSurf ) return false;
+			Pos += NumBack + 1;
+			NumOverlaps += NumBack;
+		}
+		if ( Pos != Record.Ints.size() || NumDense + NumOverlaps != Record.Reals.size() ) return false;
+
+		auto Real( Record.Reals.begin() );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			for ( int iHour = FirstHour; iHour <= LastHour; ++iHour ) {
+				SunlitFracHR( SurfNum, iHour ) = *Real++;
+				CosIncAngHR( SurfNum, iHour ) = *Real++;
+				SurfaceWindow( SurfNum ).OutProjSLFracMult( iHour ) = *Real++;
+				SurfaceWindow( SurfNum ).InOutProjSLFracMult( iHour ) = *Real++;
+				for ( int TS = FirstTimeStep; TS <= LastTimeStep; ++TS ) {
+					SunlitFrac( SurfNum, iHour, TS ) = *Real++;
+					SunlitFracWithoutReveal( SurfNum, iHour, TS ) = *Real++;
+					CosIncAng( SurfNum, iHour, TS ) = *Real++;
+				}
+			}
+		}
+
+		auto Int( Record.Ints.begin() );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			for ( int iHour = FirstHour; iHour <= LastHour; ++iHour ) {
+				for ( int TS = FirstTimeStep; TS <= LastTimeStep; ++TS ) {
+					int const NumBack( *Int++ );
+					for ( int Back = 1; Back <= NumBack; ++Back ) {
+						BackSurfaces( SurfNum, Back, iHour, TS ) = *Int++;
+						OverlapAreas( SurfNum, Back, iHour, TS ) = *Real++;
+					}
+				}
+			}
+		}
+
+		return true;
+
+	}
+
 	void
 	SHDRVL(
 		int const HTSS, // Heat transfer surface number of the subsurface
@@ -7346,13 +7736,16 @@ namespace SolarShading {
 		// the effect of transparent subsurfaces.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// With PixelCountingShading the sunlit fraction of each subsurface comes from
+		// RenderShadowRasters.  Reveal shadowing and the overlaps with back surfaces are then
+		// found for the unshaded subsurface and scaled by that fraction, i.e., the other shadows
+		// are taken to be spread uniformly over the subsurface.
 
 		// REFERENCES:
 		// BLAST/IBLAST code, original author George Walton
 
-		// USE STATEMENTS:
-		// na
+		// Using/Aliasing
+		using DataSystemVariables::PixelCountingShading;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -7378,6 +7771,7 @@ namespace SolarShading {
 		//  REAL(r64) DividerAreaAdd  ! Additional frame area sunlit
 		int HTSS; // Heat transfer surface number of the subsurface
 		int SBSNR; // Subsurface number
+		Real64 LitFraction; // Sunlit fraction of the subsurface from pixel counting
 
 		if ( NSBS > 0 ) { // Action taken only if subsurfaces present
 
@@ -7386,6 +7780,7 @@ namespace SolarShading {
 			for ( I = 1; I <= NSBS; ++I ) { // Do for all subsurfaces (sbs).
 
 				SBSNR = ShadowComb( CurSurf ).SubSurf( I );
+				LitFraction = 1.0;
 
 				HTSS = SBSNR;
 
@@ -7419,6 +7814,20 @@ namespace SolarShading {
 
 					if ( iHour > 0 && TS > 0 ) SunlitFracWithoutReveal( HTSS, iHour, TS ) = 0.0;
 
+				} else if ( PixelCountingShading ) { // Shadows were counted by RenderShadowRasters
+
+					LitFraction = ShadowRasters( CurSurf ).LitFraction[ I ];
+					SAREA( HTSS ) = HCAREA( FSBSHC ) * LitFraction;
+					SAREA( HTS ) -= SAREA( HTSS ); // Revise sunlit area of general receiving surface.
+
+					if ( iHour > 0 && TS > 0 ) SunlitFracWithoutReveal( HTSS, iHour, TS ) = SAREA( HTSS ) / Surface( HTSS ).NetAreaShadowCalc;
+
+					SAREA( HTSS ) = HCAREA( FSBSHC );
+					SHDRVL( HTSS, SBSNR, iHour, TS ); // Determine shadowing from reveal.
+					SAREA( HTSS ) *= LitFraction;
+
+					if ( ( OverlapStatus == TooManyVertices ) || ( OverlapStatus == TooManyFigures ) ) SAREA( HTSS ) = 0.0;
+
 				} else if ( ( NGSSHC <= 0 ) || ( NSBSHC == 1 ) ) { // No shadows.
 
 					SAREA( HTSS ) = HCAREA( FSBSHC );
@@ -7468,6 +7877,12 @@ namespace SolarShading {
 
 						CalcInteriorSolarOverlaps( iHour, NBKS, HTSS, CurSurf, TS );
 
+						if ( LitFraction < 1.0 ) {
+							for ( J = 1; J <= MaxBkSurf; ++J ) {
+								OverlapAreas( HTSS, J, iHour, TS ) *= LitFraction;
+							}
+						}
+
 					}
 
 				}
@@ -8205,12 +8620,15 @@ namespace SolarShading {
 
 		// Using/Aliasing
 		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
+		using DataSystemVariables::PixelCountingShading;
+		using ShadingCache::CacheStatus;
+		using ShadingCache::CacheDisabled;
+		using ShadingCache::GetShadingRecord;
+		using ShadingCache::SaveShadingRecord;
 
 		// Locals
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		int const NPhi( 6 ); // Number of altitude angle steps for sky integration
-		int const NTheta( 24 ); // Number of azimuth angle steps for sky integration
-		Real64 const Eps( 1.e-10 ); // Small number
+		// na
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -8221,20 +8639,7 @@ namespace SolarShading {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		int SurfNum; // Surface counter
-		int IPhi; // Altitude step counter
-		int ITheta; // Azimuth step counter
-		Real64 DPhi; // Altitude step size
-		Real64 DTheta; // Azimuth step size
-		Real64 DThetaDPhi; // Product of DTheta and DPhi
-		Real64 PhiMin; // Minimum altitude
-		Real64 Phi; // Altitude angle
-		Real64 Theta; // Azimuth angle
-		Real64 CosPhi; // Cosine of Phi
-		Real64 Fac1WoShdg; // Intermediate calculation factor, without shading
-		Real64 FracIlluminated; // Fraction of surface area illuminated by a sky patch
-		Real64 Fac1WithShdg; // Intermediate calculation factor, with shading
-		Real64 SurfArea; // Surface area (m2)
-		bool ShadowingSurf; // True if surface is a shadowing surface
+		std::uint64_t RecordKey; // Shading result cache key for the sky diffuse shading
 		//REAL(r64), ALLOCATABLE, DIMENSION(:) :: WithShdgIsoSky     ! Diffuse solar irradiance from isotropic
 		//                                                          ! sky on surface, with shading
 		//REAL(r64), ALLOCATABLE, DIMENSION(:) :: WoShdgIsoSky       ! Diffuse solar from isotropic
@@ -8284,32 +8689,213 @@ namespace SolarShading {
 			SetupOutputVariable( "Debug Surface Solar Shading Model WoShdgIsoSky []", WoShdgIsoSky( SurfNum ), "Zone", "Average", Surface( SurfNum ).Name );
 		}
 
-		DPhi = PiOvr2 / NPhi; // 15 deg for NPhi = 6
-		DTheta = 2.0 * Pi / NTheta; // 15 deg for NTheta = 24
-		DThetaDPhi = DTheta * DPhi;
-		PhiMin = 0.5 * DPhi; // 7.5 deg for DPhi = 15 deg
+		// Reuse the sky diffuse shading of an earlier run with the same shading inputs
+		RecordKey = ShadingRecordKey( SkyDiffuseRecord, 0.0, 0.0, 0.0, 0, 0 );
+		if ( GetShadingRecord( RecordKey, ShadingResults ) && int( ShadingResults.Reals.size() ) == 6 * TotSurfaces ) {
+			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				auto const Packed( ShadingResults.Reals.begin() + 6 * ( SurfNum - 1 ) );
+				WithShdgIsoSky( SurfNum ) = Packed[ 0 ];
+				WoShdgIsoSky( SurfNum ) = Packed[ 1 ];
+				WithShdgHoriz( SurfNum ) = Packed[ 2 ];
+				WoShdgHoriz( SurfNum ) = Packed[ 3 ];
+				DifShdgRatioIsoSky( SurfNum ) = Packed[ 4 ];
+				DifShdgRatioHoriz( SurfNum ) = Packed[ 5 ];
+			}
+		} else {
+			// Pixel counting jobs are kept to re-weight them as shading transmittances change
+			KeepSkyPatchRasters = PixelCountingShading && DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing;
+			IntegrateSkyPatches( true );
+			if ( ! KeepSkyPatchRasters ) {
+				SkyPatchReceivers.clear();
+				SkyPatchRasters.clear();
+			}
+
+			if ( CacheStatus != CacheDisabled ) {
+				ShadingResults.clear();
+				for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+					ShadingResults.Reals.push_back( WithShdgIsoSky( SurfNum ) );
+					ShadingResults.Reals.push_back( WoShdgIsoSky( SurfNum ) );
+					ShadingResults.Reals.push_back( WithShdgHoriz( SurfNum ) );
+					ShadingResults.Reals.push_back( WoShdgHoriz( SurfNum ) );
+					ShadingResults.Reals.push_back( DifShdgRatioIsoSky( SurfNum ) );
+					ShadingResults.Reals.push_back( DifShdgRatioHoriz( SurfNum ) );
+				}
+				SaveShadingRecord( RecordKey, ShadingResults );
+			}
+		}
+
+		// Get IR view factors. An exterior surface can receive IR radiation from
+		// sky, ground or shadowing surfaces. Assume shadowing surfaces have same
+		// temperature as outside air (and therefore same temperature as ground),
+		// so that the view factor to these shadowing surfaces can be included in
+		// the ground view factor. Sky IR is assumed to be isotropic and shadowing
+		// surfaces are assumed to be opaque to IR so they totally "shade" IR from
+		// sky or ground.
+
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( ! DetailedSkyDiffuseAlgorithm || ! ShadingTransmittanceVaries || SolarDistribution == MinimalShadowing ) {
+				Surface( SurfNum ).ViewFactorSkyIR *= DifShdgRatioIsoSky( SurfNum );
+			} else {
+				Surface( SurfNum ).ViewFactorSkyIR *= DifShdgRatioIsoSkyHRTS( SurfNum, 1, 1 );
+			}
+			Surface( SurfNum ).ViewFactorGroundIR = 1.0 - Surface( SurfNum ).ViewFactorSkyIR;
+		}
+
+		//  DEALLOCATE(WithShdgIsoSky)
+		//  DEALLOCATE(WoShdgIsoSky)
+		//  DEALLOCATE(WithShdgHoriz)
+		//  DEALLOCATE(WoShdgHoriz)
+
+		if ( DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing ) {
+			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				DifShdgRatioIsoSkyHRTS( SurfNum, {1,24}, {1,NumOfTimeStepInHour} ) = DifShdgRatioIsoSky( SurfNum );
+				DifShdgRatioHorizHRTS( SurfNum, {1,24}, {1,NumOfTimeStepInHour} ) = DifShdgRatioHoriz( SurfNum );
+			}
+		}
+
+	}
+
+	void
+	SetSkyPatchDirection(
+		Real64 const Phi, // Altitude angle of the sky patch
+		Real64 const Theta // Azimuth angle of the sky patch
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Points SUNCOS at a sky patch and sets CTHETA of the shadowing and heat transfer surfaces
+		// for it, so that SHADOW finds the shading of radiation from the patch.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 const CosPhi( std::cos( Phi ) ); // Cosine of Phi
+
+		SUNCOS( 3 ) = std::sin( Phi );
+		SUNCOS( 1 ) = CosPhi * std::cos( Theta );
+		SUNCOS( 2 ) = CosPhi * std::sin( Theta );
+
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Cosine of angle of incidence on surface of solar
+			// radiation from patch
+			if ( ! Surface( SurfNum ).ShadowingSurf && ! Surface( SurfNum ).HeatTransSurf ) continue;
+
+			CTHETA( SurfNum ) = SUNCOS( 1 ) * Surface( SurfNum ).OutNormVec( 1 ) + SUNCOS( 2 ) * Surface( SurfNum ).OutNormVec( 2 ) + SUNCOS( 3 ) * Surface( SurfNum ).OutNormVec( 3 );
+		}
+
+	}
+
+	void
+	SwapSkyPatchRasters( int const Patch ) // Sky patch index in SkyPatchRasters
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Exchanges the pixel counting jobs of a sky patch with those in ShadowRasters.  Called
+		// once to put the jobs in place for SHADOW and once more to put them back.
+
+		auto & Rasters( SkyPatchRasters[ Patch ] );
+		auto const & Receivers( SkyPatchReceivers[ Patch ] );
+		for ( std::size_t K = 0; K < Receivers.size(); ++K ) {
+			std::swap( ShadowRasters( Receivers[ K ] ), Rasters[ K ] );
+		}
+
+	}
+
+	void
+	IntegrateSkyPatches( bool const RenderPatches ) // Build and render the pixel counting jobs of the patches
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Fred Winkelmann
+		//       DATE WRITTEN   May 1999
+		//       MODIFIED       Taken from SkyDifSolarShading so the patches can be integrated again
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sums the sky diffuse solar on each exterior surface from the sky patches, with and
+		// without shading, into WithShdgIsoSky, WoShdgIsoSky, WithShdgHoriz and WoShdgHoriz, and
+		// sets DifShdgRatioIsoSky and DifShdgRatioHoriz from the sums (see SkyDifSolarShading).
+
+		// METHODOLOGY EMPLOYED:
+		// Polygon clipping keeps its figures in the module HC arrays, so SHADOW is called for
+		// one patch at a time.  With PixelCountingShading the jobs of all patches are built
+		// first and rendered together (RenderRasters), which lets the patches run in parallel;
+		// SHADOW then takes the jobs of each patch as they are (ShadowRastersReady).  Without
+		// RenderPatches the jobs already in SkyPatchRasters are used (ReweightSkyDifShading).
+
+		// Using/Aliasing
+		using DataSystemVariables::PixelCountingShading;
+		using PixelCounting::RasterJob;
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const NPhi( 6 ); // Number of altitude angle steps for sky integration
+		int const NTheta( 24 ); // Number of azimuth angle steps for sky integration
+		Real64 const Eps( 1.e-10 ); // Small number
+		Real64 const DPhi( PiOvr2 / NPhi ); // Altitude step size, 15 deg for NPhi = 6
+		Real64 const DTheta( 2.0 * Pi / NTheta ); // Azimuth step size, 15 deg for NTheta = 24
+		Real64 const DThetaDPhi( DTheta * DPhi ); // Product of DTheta and DPhi
+		Real64 const PhiMin( 0.5 * DPhi ); // Minimum altitude, 7.5 deg for DPhi = 15 deg
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static std::vector< RasterJob * > Jobs; // Jobs of all sky patches
+		int SurfNum; // Surface counter
+		int IPhi; // Altitude step counter
+		int ITheta; // Azimuth step counter
+		int Patch; // Sky patch index in SkyPatchRasters
+		Real64 Phi; // Altitude angle
+		Real64 Theta; // Azimuth angle
+		Real64 CosPhi; // Cosine of Phi
+		Real64 Fac1WoShdg; // Intermediate calculation factor, without shading
+		Real64 FracIlluminated; // Fraction of surface area illuminated by a sky patch
+		Real64 Fac1WithShdg; // Intermediate calculation factor, with shading
+		Real64 SurfArea; // Surface area (m2)
+		bool ShadowingSurf; // True if surface is a shadowing surface
+
+		WithShdgIsoSky = 0.0;
+		WoShdgIsoSky = 0.0;
+		WithShdgHoriz = 0.0;
+		WoShdgHoriz = 0.0;
+
+		if ( PixelCountingShading && RenderPatches ) {
+			SkyPatchReceivers.assign( NPhi * NTheta, std::vector< int >() );
+			SkyPatchRasters.assign( NPhi * NTheta, std::vector< RasterJob >() );
+			for ( IPhi = 1; IPhi <= NPhi; ++IPhi ) {
+				for ( ITheta = 1; ITheta <= NTheta; ++ITheta ) {
+					Patch = ( IPhi - 1 ) * NTheta + ITheta - 1;
+					SetSkyPatchDirection( PhiMin + ( IPhi - 1 ) * DPhi, ( ITheta - 1 ) * DTheta );
+					BuildShadowRasters( 0, 0, KeepSkyPatchRasters, SkyPatchReceivers[ Patch ] );
+					SkyPatchRasters[ Patch ].resize( SkyPatchReceivers[ Patch ].size() );
+					SwapSkyPatchRasters( Patch );
+				}
+			}
+			Jobs.clear();
+			for ( auto & Rasters : SkyPatchRasters ) {
+				for ( auto & Job : Rasters ) {
+					Jobs.push_back( &Job );
+				}
+			}
+			RenderRasters( Jobs );
+		}
 
 		for ( IPhi = 1; IPhi <= NPhi; ++IPhi ) { // Loop over patch altitude values
 			Phi = PhiMin + ( IPhi - 1 ) * DPhi; // 7.5,22.5,37.5,52.5,67.5,82.5 for NPhi = 6
-			SUNCOS( 3 ) = std::sin( Phi );
 			CosPhi = std::cos( Phi );
 
 			for ( ITheta = 1; ITheta <= NTheta; ++ITheta ) { // Loop over patch azimuth values
 				Theta = ( ITheta - 1 ) * DTheta; // 0,15,30,....,330,345 for NTheta = 24
-				SUNCOS( 1 ) = CosPhi * std::cos( Theta );
-				SUNCOS( 2 ) = CosPhi * std::sin( Theta );
-
-				for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Cosine of angle of incidence on surface of solar
-					// radiation from patch
-					ShadowingSurf = Surface( SurfNum ).ShadowingSurf;
-
-					if ( ! ShadowingSurf && ! Surface( SurfNum ).HeatTransSurf ) continue;
+				SetSkyPatchDirection( Phi, Theta );
 
-					CTHETA( SurfNum ) = SUNCOS( 1 ) * Surface( SurfNum ).OutNormVec( 1 ) + SUNCOS( 2 ) * Surface( SurfNum ).OutNormVec( 2 ) + SUNCOS( 3 ) * Surface( SurfNum ).OutNormVec( 3 );
+				Patch = ( IPhi - 1 ) * NTheta + ITheta - 1;
+				if ( PixelCountingShading ) {
+					SwapSkyPatchRasters( Patch );
+					ShadowRastersReady = true;
 				}
 
 				SHADOW( 0, 0 );
 
+				if ( PixelCountingShading ) {
+					ShadowRastersReady = false;
+					SwapSkyPatchRasters( Patch );
+				}
+
 				for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 					ShadowingSurf = Surface( SurfNum ).ShadowingSurf;
 
@@ -8354,33 +8940,105 @@ namespace SolarShading {
 			}
 		}
 
-		// Get IR view factors. An exterior surface can receive IR radiation from
-		// sky, ground or shadowing surfaces. Assume shadowing surfaces have same
-		// temperature as outside air (and therefore same temperature as ground),
-		// so that the view factor to these shadowing surfaces can be included in
-		// the ground view factor. Sky IR is assumed to be isotropic and shadowing
-		// surfaces are assumed to be opaque to IR so they totally "shade" IR from
-		// sky or ground.
+	}
 
-		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-			if ( ! DetailedSkyDiffuseAlgorithm || ! ShadingTransmittanceVaries || SolarDistribution == MinimalShadowing ) {
-				Surface( SurfNum ).ViewFactorSkyIR *= DifShdgRatioIsoSky( SurfNum );
-			} else {
-				Surface( SurfNum ).ViewFactorSkyIR *= DifShdgRatioIsoSkyHRTS( SurfNum, 1, 1 );
+	void
+	ReweightSkyDifShading(
+		int const iHour, // Hour index
+		int const TS // Time Step
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets DifShdgRatioIsoSkyHRTS and DifShdgRatioHorizHRTS for this hour and time step from
+		// the sky patch jobs kept by SkyDifSolarShading (KeepSkyPatchRasters), using the current
+		// transmittances of the scheduled shading surfaces.  Replaces the sun position estimate
+		// of FigureSolarBeamAtTimestep when pixel counting is used.
+
+		// METHODOLOGY EMPLOYED:
+		// The patches are not projected or rendered again.  When a transmittance has changed since
+		// the last call, the cover sets of the jobs are re-weighted (PixelCounting::ReweightRaster)
+		// and the patches integrated again; otherwise the last ratios are reused.  The sun
+		// position and DifShdgRatioIsoSky, DifShdgRatioHoriz (used by daylighting) are restored.
+
+		// Using/Aliasing
+		using PixelCounting::RasterJob;
+		using PixelCounting::ReweightRaster;
+		using ScheduleManager::LookUpScheduleValue;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static std::vector< int > Casters; // Shading surfaces in the jobs with a transmittance schedule
+		static std::vector< RasterJob * > Jobs; // Jobs of all sky patches
+		static FArray1D< Real64 > Transmittance; // Transmittance of each scheduled shading surface (-1 for others)
+		static FArray1D< Real64 > RatioIsoSky; // DifShdgRatioIsoSky for the transmittances in Transmittance
+		static FArray1D< Real64 > RatioHoriz; // DifShdgRatioHoriz for the transmittances in Transmittance
+		bool Changed( false ); // True if a transmittance has changed since the last call
+
+		if ( ReweightOneTimeFlag ) {
+			// Start from the ratios of SkyDifSolarShading so that they stand when no job has a scheduled caster
+			Casters.clear();
+			Jobs.clear();
+			Transmittance.dimension( TotSurfaces, -1.0 );
+			RatioIsoSky.dimension( TotSurfaces );
+			RatioIsoSky = DifShdgRatioIsoSky;
+			RatioHoriz.dimension( TotSurfaces );
+			RatioHoriz = DifShdgRatioHoriz;
+			for ( auto & Rasters : SkyPatchRasters ) {
+				for ( auto & Job : Rasters ) {
+					Jobs.push_back( &Job );
+					for ( int Q = Job.NumSubSurfaces + 1; Q < Job.NumPolygons(); ++Q ) {
+						int const GSSNR( Job.Tag[ Q ] );
+						if ( Surface( GSSNR ).HeatTransSurf || Surface( GSSNR ).SchedShadowSurfIndex <= 0 ) continue;
+						if ( std::find( Casters.begin(), Casters.end(), GSSNR ) == Casters.end() ) Casters.push_back( GSSNR );
+					}
+				}
 			}
-			Surface( SurfNum ).ViewFactorGroundIR = 1.0 - Surface( SurfNum ).ViewFactorSkyIR;
+			ReweightOneTimeFlag = false;
 		}
 
-		//  DEALLOCATE(WithShdgIsoSky)
-		//  DEALLOCATE(WoShdgIsoSky)
-		//  DEALLOCATE(WithShdgHoriz)
-		//  DEALLOCATE(WoShdgHoriz)
+		for ( int const GSSNR : Casters ) {
+			Real64 const CurTransmittance( LookUpScheduleValue( Surface( GSSNR ).SchedShadowSurfIndex, iHour, TS ) );
+			if ( CurTransmittance != Transmittance( GSSNR ) ) {
+				Transmittance( GSSNR ) = CurTransmittance;
+				Changed = true;
+			}
+		}
 
-		if ( DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing ) {
-			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-				DifShdgRatioIsoSkyHRTS( SurfNum, {1,24}, {1,NumOfTimeStepInHour} ) = DifShdgRatioIsoSky( SurfNum );
-				DifShdgRatioHorizHRTS( SurfNum, {1,24}, {1,NumOfTimeStepInHour} ) = DifShdgRatioHoriz( SurfNum );
+		if ( Changed ) {
+			int const NumJobs( Jobs.size() );
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic )
+#endif
+			for ( int I = 0; I < NumJobs; ++I ) {
+				auto & Job( *Jobs[ I ] );
+				for ( int Q = Job.NumSubSurfaces + 1; Q < Job.NumPolygons(); ++Q ) {
+					if ( Transmittance( Job.Tag[ Q ] ) >= 0.0 ) Job.Transmittance[ Q ] = Transmittance( Job.Tag[ Q ] );
+				}
+				ReweightRaster( Job );
 			}
+
+			FArray1D< Real64 > const SaveSUNCOS( SUNCOS );
+			FArray1D< Real64 > const SaveCTHETA( CTHETA );
+			FArray1D< Real64 > const SaveSAREA( SAREA );
+			FArray1D< Real64 > const SaveRatioIsoSky( DifShdgRatioIsoSky );
+			FArray1D< Real64 > const SaveRatioHoriz( DifShdgRatioHoriz );
+
+			CalcSkyDifShading = true;
+			IntegrateSkyPatches( false );
+			CalcSkyDifShading = false;
+
+			RatioIsoSky = DifShdgRatioIsoSky;
+			RatioHoriz = DifShdgRatioHoriz;
+			SUNCOS = SaveSUNCOS;
+			CTHETA = SaveCTHETA;
+			SAREA = SaveSAREA;
+			DifShdgRatioIsoSky = SaveRatioIsoSky;
+			DifShdgRatioHoriz = SaveRatioHoriz;
+		}
+
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			DifShdgRatioIsoSkyHRTS( SurfNum, iHour, TS ) = RatioIsoSky( SurfNum );
+			DifShdgRatioHorizHRTS( SurfNum, iHour, TS ) = RatioHoriz( SurfNum );
 		}
 
 	}
@@ -10746,6 +11404,7 @@ namespace SolarShading {
 		//       AUTHOR         Simon Vidanovic
 		//       DATE WRITTEN   May 2012
 		//       MODIFIED       May 2012 (Initialize complex fenestration in case of EMS)
+		//                      October 2026, weight the visible transmittance by the overlap reflectances
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -10761,6 +11420,7 @@ namespace SolarShading {
 
 		// Using/Aliasing
 		using WindowComplexManager::CheckCFSStates;
+		using WindowComplexManager::CalcWindowOverlapReflection;
 
 		// Locals
 		int iSurf; // Current surface number
@@ -10779,6 +11439,7 @@ namespace SolarShading {
 					// do initialization only once
 					if ( ComplexWind( iSurf ).Geom( iState ).InitState ) {
 						CalcComplexWindowOverlap( ComplexWind( iSurf ).Geom( iState ), ComplexWind( iSurf ), iSurf );
+						CalcWindowOverlapReflection( ComplexWind( iSurf ).Geom( iState ), SurfaceWindow( iSurf ).ComplexFen.State( iState ) );
 						ComplexWind( iSurf ).Geom( iState ).InitState = false;
 					}
 				}
@@ -3,6 +3,7 @@
 
 // C++ Headers
 #include <fstream>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
@@ -13,6 +14,9 @@
 #include <EnergyPlus.hh>
 #include <DataBSDFWindow.hh>
 #include <DataVectorTypes.hh>
+#include <PixelCounting.hh>
+#include <PolygonClipping.hh>
+#include <ShadingCache.hh>
 
 namespace EnergyPlus {
 
@@ -43,6 +47,11 @@ namespace SolarShading {
 	extern int const TooManyFigures;
 	extern FArray1D_string const cOverLapStatus;
 
+	// Parameters for use with ShadingRecordKey...
+	extern int const SkyDiffuseRecord; // Sky diffuse shading ratios (SkyDifSolarShading)
+	extern int const BeamRecord; // Beam sunlit fractions and overlaps for a shadowing period (CalcPerSolarBeam)
+	extern int const DaylightingRecord; // Daylight factors of a group of zones (DaylightingManager)
+
 	// DERIVED TYPE DEFINITIONS:
 	// INTERFACE BLOCK SPECIFICATIONS:
 	// na
@@ -76,6 +85,11 @@ namespace SolarShading {
 	extern int NRVLHC; // Number of reveal surfaces in HC array
 	extern int NSBSHC; // Number of subsurfaces in the HC arrays
 	extern bool CalcSkyDifShading; // True when sky diffuse solar shading is
+	extern bool ShadowRastersReady; // True when ShadowRasters already hold the jobs for the next SHADOW call
+	extern Real64 MaxRasterErrorBound; // Largest RasterErrorBound of the beam sunlit fractions found by pixel counting
+	extern int MaxRasterErrorSurface; // Receiving surface with MaxRasterErrorBound
+	extern bool KeepSkyPatchRasters; // True when the sky patch jobs are kept for ReweightSkyDifShading
+	extern bool ReweightOneTimeFlag; // True until ReweightSkyDifShading has gathered the sky patch jobs
 	extern int ShadowingCalcFrequency; // Frequency for Shadowing Calculations
 	extern int ShadowingDaysLeft; // Days left in current shadowing period
 	extern bool debugging;
@@ -112,11 +126,9 @@ namespace SolarShading {
 	extern FArray1D< Real64 > YVS; // Y-vertices of the shadow
 	extern FArray1D< Real64 > ZVC; // Z-vertices of the clipped figure
 	// Used in Sutherland Hodman poly clipping
-	extern FArray1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
-	extern FArray1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
-	extern FArray1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
-	extern FArray1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
-	extern FArray1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
+	extern PolygonClipping::ClipWorkspace HCClipWork; // Vertex buffers of the overlap being clipped
+	extern std::ofstream clp_stream; // Polygon pairs clipped (TRACE_HCCLIPPING)
+	extern ShadingCache::ShadingRecord ShadingResults; // Packed results read from or added to the shading result cache
 	extern int maxNumberOfFigures;
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SolarShading
@@ -154,9 +166,17 @@ namespace SolarShading {
 	extern FArray1D< SurfaceErrorTracking > TrackTooManyFigures;
 	extern FArray1D< SurfaceErrorTracking > TrackTooManyVertices;
 	extern FArray1D< SurfaceErrorTracking > TrackBaseSubSurround;
+	extern FArray1D< PixelCounting::RasterJob > ShadowRasters; // Pixel counting job of each receiving surface
+	extern std::vector< std::vector< int > > SkyPatchReceivers; // Receiving surfaces with a job for each sky patch
+	extern std::vector< std::vector< PixelCounting::RasterJob > > SkyPatchRasters; // Pixel counting jobs of each sky patch
 
 	// Functions
 
+	// Clears the global data in SolarShading.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	InitSolarCalculations();
 
@@ -319,6 +339,26 @@ namespace SolarShading {
 		int const TS // Time Step
 	);
 
+	void
+	CalcShadowProjection( int const NGRS ); // Surface whose coordinate system shadows are projected in
+
+	void
+	RenderShadowRasters(
+		int const iHour, // Hour index
+		int const TS // Time Step
+	);
+
+	void
+	BuildShadowRasters(
+		int const iHour, // Hour index
+		int const TS, // Time Step
+		bool const FindCoverSets, // Keep cover sets so the jobs can be re-weighted for new transmittances
+		std::vector< int > & Receivers // Surfaces given a job in ShadowRasters
+	);
+
+	void
+	RenderRasters( std::vector< PixelCounting::RasterJob * > const & Jobs );
+
 	void
 	SHDBKS(
 		int const NGRS, // Number of the general receiving surface
@@ -337,6 +377,16 @@ namespace SolarShading {
 		int const HTS // Heat transfer surface number of the general receiving surf
 	);
 
+	bool
+	ProjectShadowCaster(
+		int const NGRS, // Surface whose coordinate system shadows are projected in
+		int const iHour, // Hour Counter
+		int const TS, // TimeStep
+		int const GSSNR, // General shadowing surface number
+		Real64 & SchValue, // Transmittance of the shadow
+		bool const KeepTransparent = false // Project surfaces scheduled to be fully transparent now (SchValue = 1)
+	);
+
 	void
 	CalcInteriorSolarOverlaps(
 		int const iHour, // Hour Index
@@ -364,6 +414,37 @@ namespace SolarShading {
 	void
 	PerformSolarCalculations();
 
+	void
+	InitShadingResultCache();
+
+	std::uint64_t
+	ShadingRecordKey(
+		int const Kind, // SkyDiffuseRecord or BeamRecord
+		Real64 const EqOfTime, // Equation of Time for the period
+		Real64 const SinSolarDeclin, // Sine of Solar Declination for the period
+		Real64 const CosSolarDeclin, // Cosine of Solar Declination for the period
+		int const iHour, // First hour of the results
+		int const iTimeStep // First time step of the results
+	);
+
+	void
+	PackShadingRecord(
+		int const FirstHour,
+		int const LastHour,
+		int const FirstTimeStep,
+		int const LastTimeStep,
+		ShadingCache::ShadingRecord & Record
+	);
+
+	bool
+	UnpackShadingRecord(
+		int const FirstHour,
+		int const LastHour,
+		int const FirstTimeStep,
+		int const LastTimeStep,
+		ShadingCache::ShadingRecord const & Record
+	);
+
 	void
 	SHDRVL(
 		int const HTSS, // Heat transfer surface number of the subsurface
@@ -406,6 +487,24 @@ namespace SolarShading {
 	void
 	SkyDifSolarShading();
 
+	void
+	SetSkyPatchDirection(
+		Real64 const Phi, // Altitude angle of the sky patch
+		Real64 const Theta // Azimuth angle of the sky patch
+	);
+
+	void
+	SwapSkyPatchRasters( int const Patch ); // Sky patch index in SkyPatchRasters
+
+	void
+	IntegrateSkyPatches( bool const RenderPatches ); // Build and render the pixel counting jobs of the patches
+
+	void
+	ReweightSkyDifShading(
+		int const iHour, // Hour index
+		int const TS // Time Step
+	);
+
 	void
 	CalcWindowProfileAngles();
 
@@ -0,0 +1,389 @@
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Fmath.hh>
+
+// EnergyPlus Headers
+#include <SurfaceBVH.hh>
+#include <DataGlobals.hh>
+#include <DataPrecisionGlobals.hh>
+#include <DataSurfaces.hh>
+
+namespace EnergyPlus {
+
+namespace SurfaceBVH {
+
+	// Module containing a bounding volume hierarchy over the surface geometry
+
+	// PURPOSE OF THIS MODULE:
+	// Shadowing, daylighting and exterior reflection calculations need, for a given receiving
+	// surface or ray, the (usually few) surfaces that can possibly interact with it.  Scanning
+	// all surfaces for each receiver or ray is O(N) per query and dominates startup for models
+	// with many shading surfaces.  This module keeps an axis-aligned bounding box hierarchy over
+	// DataSurfaces::Surface that is built once after the zone geometry is set up.
+
+	// METHODOLOGY EMPLOYED:
+	// Top-down median split on the longest axis of the surface box centroids.  Queries are
+	// conservative: they return every surface whose (padded) box can satisfy the query, and the
+	// caller still applies its exact test.  Results are returned in ascending surface number so
+	// callers see surfaces in the same order as the original loops over all surfaces.
+
+	// REFERENCES:
+	// Ericson, C. 2005. Real-Time Collision Detection. Morgan Kaufmann. Chapter 6.
+
+	// OTHER NOTES:
+	// Surface vertices must not change after the hierarchy is built.  The queries rebuild it when
+	// DataSurfaces::SurfaceGeometryGeneration has moved on or after clear_state.
+
+	// Using/Aliasing
+	using namespace DataPrecisionGlobals;
+	using DataGlobals::BigNumber;
+	using DataSurfaces::Surface;
+	using DataSurfaces::TotSurfaces;
+	using DataSurfaces::SurfaceGeometryGeneration;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const MaxSurfacesPerLeaf( 4 );
+	Real64 const BoxPadding( 0.001 );
+
+	namespace {
+		// Depth of a median split tree is about log2(N); this covers any realistic surface count
+		int const MaxStackDepth( 64 );
+	}
+
+	// MODULE VARIABLE DECLARATIONS:
+	int GenerationInTree( -1 );
+
+	// Object Data
+	std::vector< BVHNode > Node;
+	std::vector< int > SurfaceOrder;
+	FArray1D< BoundingBox > SurfaceBox;
+
+	// Functions
+
+	namespace {
+
+		Real64
+		BoxCenter(
+			BoundingBox const & Box,
+			int const Axis
+		)
+		{
+			if ( Axis == 0 ) return 0.5 * ( Box.Lo.x + Box.Hi.x );
+			if ( Axis == 1 ) return 0.5 * ( Box.Lo.y + Box.Hi.y );
+			return 0.5 * ( Box.Lo.z + Box.Hi.z );
+		}
+
+		void
+		ExpandBox(
+			BoundingBox & Box,
+			BoundingBox const & Other
+		)
+		{
+			Box.Lo.x = min( Box.Lo.x, Other.Lo.x );
+			Box.Lo.y = min( Box.Lo.y, Other.Lo.y );
+			Box.Lo.z = min( Box.Lo.z, Other.Lo.z );
+			Box.Hi.x = max( Box.Hi.x, Other.Hi.x );
+			Box.Hi.y = max( Box.Hi.y, Other.Hi.y );
+			Box.Hi.z = max( Box.Hi.z, Other.Hi.z );
+		}
+
+		int
+		BuildNode(
+			int const First, // First position in SurfaceOrder covered by this node
+			int const Last // One past the last position in SurfaceOrder covered by this node
+		)
+		{
+			int const NodeNum( static_cast< int >( Node.size() ) );
+			Node.push_back( BVHNode() );
+
+			BoundingBox Box( SurfaceBox( SurfaceOrder[ First ] ) );
+			Real64 CenterLo[ 3 ] = { BoxCenter( Box, 0 ), BoxCenter( Box, 1 ), BoxCenter( Box, 2 ) };
+			Real64 CenterHi[ 3 ] = { CenterLo[ 0 ], CenterLo[ 1 ], CenterLo[ 2 ] };
+			for ( int Pos = First + 1; Pos < Last; ++Pos ) {
+				BoundingBox const & SurfBox( SurfaceBox( SurfaceOrder[ Pos ] ) );
+				ExpandBox( Box, SurfBox );
+				for ( int Axis = 0; Axis < 3; ++Axis ) {
+					Real64 const Center( BoxCenter( SurfBox, Axis ) );
+					CenterLo[ Axis ] = min( CenterLo[ Axis ], Center );
+					CenterHi[ Axis ] = max( CenterHi[ Axis ], Center );
+				}
+			}
+			Node[ NodeNum ].Box = Box;
+
+			int SplitAxis( 0 );
+			for ( int Axis = 1; Axis < 3; ++Axis ) {
+				if ( CenterHi[ Axis ] - CenterLo[ Axis ] > CenterHi[ SplitAxis ] - CenterLo[ SplitAxis ] ) SplitAxis = Axis;
+			}
+
+			// Leaf when small enough or when all centers coincide (no split can separate them)
+			if ( ( Last - First <= MaxSurfacesPerLeaf ) || ( CenterHi[ SplitAxis ] - CenterLo[ SplitAxis ] <= 0.0 ) ) {
+				Node[ NodeNum ].First = First;
+				Node[ NodeNum ].Count = Last - First;
+				return NodeNum;
+			}
+
+			int const Mid( First + ( Last - First ) / 2 );
+			std::nth_element( SurfaceOrder.begin() + First, SurfaceOrder.begin() + Mid, SurfaceOrder.begin() + Last, [SplitAxis]( int const a, int const b ) {
+				Real64 const CenterA( BoxCenter( SurfaceBox( a ), SplitAxis ) );
+				Real64 const CenterB( BoxCenter( SurfaceBox( b ), SplitAxis ) );
+				return ( CenterA < CenterB ) || ( ( CenterA == CenterB ) && ( a < b ) );
+			} );
+
+			int const Left( BuildNode( First, Mid ) );
+			int const Right( BuildNode( Mid, Last ) );
+			Node[ NodeNum ].Left = Left;
+			Node[ NodeNum ].Right = Right;
+			return NodeNum;
+		}
+
+		bool
+		BoxInHalfSpace(
+			BoundingBox const & Box,
+			HalfSpace const & Plane
+		)
+		{
+			// Largest value of Normal.(p - Point) over the box, attained at one of its corners
+			Real64 const MaxDist( Plane.Normal.x * ( ( Plane.Normal.x > 0.0 ? Box.Hi.x : Box.Lo.x ) - Plane.Point.x ) + Plane.Normal.y * ( ( Plane.Normal.y > 0.0 ? Box.Hi.y : Box.Lo.y ) - Plane.Point.y ) + Plane.Normal.z * ( ( Plane.Normal.z > 0.0 ? Box.Hi.z : Box.Lo.z ) - Plane.Point.z ) );
+			return MaxDist > Plane.Tolerance;
+		}
+
+		bool
+		RayEntersBox(
+			BoundingBox const & Box,
+			Vector const & Origin,
+			Vector const & Direction
+		)
+		{
+			// Slab test for the half-line Origin + t*Direction, t >= 0
+			Real64 const O[ 3 ] = { Origin.x, Origin.y, Origin.z };
+			Real64 const D[ 3 ] = { Direction.x, Direction.y, Direction.z };
+			Real64 const Lo[ 3 ] = { Box.Lo.x, Box.Lo.y, Box.Lo.z };
+			Real64 const Hi[ 3 ] = { Box.Hi.x, Box.Hi.y, Box.Hi.z };
+			Real64 TNear( 0.0 );
+			Real64 TFar( BigNumber );
+			for ( int Axis = 0; Axis < 3; ++Axis ) {
+				if ( std::abs( D[ Axis ] ) < 1.0e-12 ) {
+					if ( ( O[ Axis ] < Lo[ Axis ] ) || ( O[ Axis ] > Hi[ Axis ] ) ) return false;
+				} else {
+					Real64 T1( ( Lo[ Axis ] - O[ Axis ] ) / D[ Axis ] );
+					Real64 T2( ( Hi[ Axis ] - O[ Axis ] ) / D[ Axis ] );
+					if ( T1 > T2 ) std::swap( T1, T2 );
+					TNear = max( TNear, T1 );
+					TFar = min( TFar, T2 );
+					if ( TNear > TFar ) return false;
+				}
+			}
+			return true;
+		}
+
+	} // namespace
+
+	void
+	clear_state()
+	{
+		Node.clear();
+		SurfaceOrder.clear();
+		SurfaceBox.deallocate();
+		GenerationInTree = -1;
+	}
+
+	void
+	EnsureSurfaceBVH()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the hierarchy if it has not been built for the current surface geometry.  Callers
+		// that query from several threads call this first.
+
+		if ( GenerationInTree != SurfaceGeometryGeneration ) BuildSurfaceBVH();
+
+	}
+
+	void
+	BuildSurfaceBVH()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the bounding volume hierarchy over all surfaces that have vertices.
+
+		// METHODOLOGY EMPLOYED:
+		// Each surface gets an axis-aligned box padded by BoxPadding so that planar surfaces
+		// have nonzero thickness and roundoff in the callers' exact tests cannot miss a surface.
+
+		int SurfNum; // Surface number
+		int Vert; // Vertex index
+
+		Node.clear();
+		SurfaceOrder.clear();
+		SurfaceBox.dimension( TotSurfaces, BoundingBox() );
+		GenerationInTree = SurfaceGeometryGeneration;
+
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			if ( surface.Sides < 3 ) continue; // Internal mass and other surfaces without geometry
+			BoundingBox & Box( SurfaceBox( SurfNum ) );
+			Box.Lo = surface.Vertex( 1 );
+			Box.Hi = surface.Vertex( 1 );
+			for ( Vert = 2; Vert <= surface.Sides; ++Vert ) {
+				auto const & vertex( surface.Vertex( Vert ) );
+				Box.Lo.x = min( Box.Lo.x, vertex.x );
+				Box.Lo.y = min( Box.Lo.y, vertex.y );
+				Box.Lo.z = min( Box.Lo.z, vertex.z );
+				Box.Hi.x = max( Box.Hi.x, vertex.x );
+				Box.Hi.y = max( Box.Hi.y, vertex.y );
+				Box.Hi.z = max( Box.Hi.z, vertex.z );
+			}
+			Box.Lo -= BoxPadding;
+			Box.Hi += BoxPadding;
+			SurfaceOrder.push_back( SurfNum );
+		}
+
+		if ( SurfaceOrder.empty() ) return;
+		Node.reserve( 2 * SurfaceOrder.size() / MaxSurfacesPerLeaf + 1 );
+		BuildNode( 0, static_cast< int >( SurfaceOrder.size() ) );
+
+	}
+
+	void
+	SurfacesInHalfSpaces(
+		std::vector< HalfSpace > const & Planes, // Convex region (e.g. a frustum) as an intersection of half-spaces
+		std::vector< int > & SurfNums // Surfaces whose box reaches into every half-space, ascending
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Returns the surfaces that may have a point in each of the given half-spaces, e.g. the
+		// candidate shadow casters in front of a receiving surface and above its lowest point.
+
+		// METHODOLOGY EMPLOYED:
+		// A box can contribute a point to a half-space only if its farthest corner along the
+		// normal does.  Subtrees failing any plane are skipped.
+
+		int Stack[ MaxStackDepth ];
+		int StackSize( 0 );
+
+		SurfNums.clear();
+		EnsureSurfaceBVH();
+		if ( Node.empty() ) return;
+
+		Stack[ StackSize++ ] = 0;
+		while ( StackSize > 0 ) {
+			BVHNode const & ThisNode( Node[ Stack[ --StackSize ] ] );
+			bool Inside( true );
+			for ( auto const & Plane : Planes ) {
+				if ( ! BoxInHalfSpace( ThisNode.Box, Plane ) ) {
+					Inside = false;
+					break;
+				}
+			}
+			if ( ! Inside ) continue;
+			if ( ThisNode.Left < 0 ) {
+				for ( int Pos = ThisNode.First; Pos < ThisNode.First + ThisNode.Count; ++Pos ) {
+					int const SurfNum( SurfaceOrder[ Pos ] );
+					bool SurfInside( true );
+					for ( auto const & Plane : Planes ) {
+						if ( ! BoxInHalfSpace( SurfaceBox( SurfNum ), Plane ) ) {
+							SurfInside = false;
+							break;
+						}
+					}
+					if ( SurfInside ) SurfNums.push_back( SurfNum );
+				}
+			} else {
+				Stack[ StackSize++ ] = ThisNode.Left;
+				Stack[ StackSize++ ] = ThisNode.Right;
+			}
+		}
+
+		std::sort( SurfNums.begin(), SurfNums.end() );
+
+	}
+
+	void
+	SurfacesAlongRay(
+		Vector const & Origin, // Point from which the ray originates (m)
+		Vector const & Direction, // Direction of the ray (need not be unit length)
+		std::vector< int > & SurfNums // Surfaces whose box the ray enters, ascending
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Returns the surfaces that the half-line from Origin along Direction may pierce,
+		// for use ahead of DayltgPierceSurface/PierceSurface.
+
+		int Stack[ MaxStackDepth ];
+		int StackSize( 0 );
+
+		SurfNums.clear();
+		EnsureSurfaceBVH();
+		if ( Node.empty() ) return;
+
+		Stack[ StackSize++ ] = 0;
+		while ( StackSize > 0 ) {
+			BVHNode const & ThisNode( Node[ Stack[ --StackSize ] ] );
+			if ( ! RayEntersBox( ThisNode.Box, Origin, Direction ) ) continue;
+			if ( ThisNode.Left < 0 ) {
+				for ( int Pos = ThisNode.First; Pos < ThisNode.First + ThisNode.Count; ++Pos ) {
+					int const SurfNum( SurfaceOrder[ Pos ] );
+					if ( RayEntersBox( SurfaceBox( SurfNum ), Origin, Direction ) ) SurfNums.push_back( SurfNum );
+				}
+			} else {
+				Stack[ StackSize++ ] = ThisNode.Left;
+				Stack[ StackSize++ ] = ThisNode.Right;
+			}
+		}
+
+		std::sort( SurfNums.begin(), SurfNums.end() );
+
+	}
+
+	void
+	SurfacesAlongRay(
+		FArray1< Real64 > const & Origin, // Point from which the ray originates (m)
+		FArray1< Real64 > const & Direction, // Direction of the ray (need not be unit length)
+		std::vector< int > & SurfNums // Surfaces whose box the ray enters, ascending
+	)
+	{
+		SurfacesAlongRay( Vector( Origin( 1 ), Origin( 2 ), Origin( 3 ) ), Vector( Direction( 1 ), Direction( 2 ), Direction( 3 ) ), SurfNums );
+	}
+
+	void
+	SurfacesAlongRay(
+		Vector3< Real64 > const & Origin, // Point from which the ray originates (m)
+		Vector3< Real64 > const & Direction, // Direction of the ray (need not be unit length)
+		std::vector< int > & SurfNums // Surfaces whose box the ray enters, ascending
+	)
+	{
+		SurfacesAlongRay( Vector( Origin.x, Origin.y, Origin.z ), Vector( Direction.x, Direction.y, Direction.z ), SurfNums );
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // SurfaceBVH
+
+} // EnergyPlus
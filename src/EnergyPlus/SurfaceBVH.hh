@@ -0,0 +1,167 @@
+#ifndef SurfaceBVH_hh_INCLUDED
+#define SurfaceBVH_hh_INCLUDED
+
+// C++ Headers
+#include <vector>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1.hh>
+#include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/Vector3.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+#include <DataVectorTypes.hh>
+
+namespace EnergyPlus {
+
+namespace SurfaceBVH {
+
+	// Using/Aliasing
+	using DataVectorTypes::Vector;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern int const MaxSurfacesPerLeaf; // Node splitting stops at this many surfaces
+	extern Real64 const BoxPadding; // Padding added to each surface bounding box (m)
+
+	// DERIVED TYPE DEFINITIONS:
+
+	// Types
+
+	struct BoundingBox
+	{
+		// Members
+		Vector Lo; // Minimum x, y and z (m)
+		Vector Hi; // Maximum x, y and z (m)
+
+		// Default Constructor
+		BoundingBox() :
+			Lo( 0.0 ),
+			Hi( 0.0 )
+		{}
+
+	};
+
+	struct BVHNode
+	{
+		// Members
+		BoundingBox Box; // Bounds of all surfaces below this node
+		int Left; // Index of first child node in Node (-1 for a leaf)
+		int Right; // Index of second child node in Node (-1 for a leaf)
+		int First; // Leaf only: first position of its surfaces in SurfaceOrder
+		int Count; // Leaf only: number of surfaces in the leaf
+
+		// Default Constructor
+		BVHNode() :
+			Left( -1 ),
+			Right( -1 ),
+			First( 0 ),
+			Count( 0 )
+		{}
+
+	};
+
+	struct HalfSpace // Open half-space of points p where Normal.(p - Point) > Tolerance
+	{
+		// Members
+		Vector Normal; // Normal pointing into the half-space (need not be unit length)
+		Vector Point; // Any point on the bounding plane (m)
+		Real64 Tolerance; // Same units as Normal.(p - Point)
+
+		// Default Constructor
+		HalfSpace() :
+			Normal( 0.0 ),
+			Point( 0.0 ),
+			Tolerance( 0.0 )
+		{}
+
+		// Member Constructor
+		HalfSpace(
+			Vector const & Normal,
+			Vector const & Point,
+			Real64 const Tolerance
+		) :
+			Normal( Normal ),
+			Point( Point ),
+			Tolerance( Tolerance )
+		{}
+
+	};
+
+	// MODULE VARIABLE DECLARATIONS:
+	extern int GenerationInTree; // DataSurfaces::SurfaceGeometryGeneration the hierarchy was built for (-1 = not built)
+
+	// Object Data
+	extern std::vector< BVHNode > Node; // Hierarchy nodes; Node[ 0 ] is the root
+	extern std::vector< int > SurfaceOrder; // Surface numbers grouped by leaf
+	extern FArray1D< BoundingBox > SurfaceBox; // Padded bounding box of each surface
+
+	// Functions
+
+	// Clears the global data in SurfaceBVH.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
+	void
+	EnsureSurfaceBVH();
+
+	void
+	BuildSurfaceBVH();
+
+	void
+	SurfacesInHalfSpaces(
+		std::vector< HalfSpace > const & Planes, // Convex region (e.g. a frustum) as an intersection of half-spaces
+		std::vector< int > & SurfNums // Surfaces whose box reaches into every half-space, ascending
+	);
+
+	void
+	SurfacesAlongRay(
+		Vector const & Origin, // Point from which the ray originates (m)
+		Vector const & Direction, // Direction of the ray (need not be unit length)
+		std::vector< int > & SurfNums // Surfaces whose box the ray enters, ascending
+	);
+
+	void
+	SurfacesAlongRay(
+		FArray1< Real64 > const & Origin, // Point from which the ray originates (m)
+		FArray1< Real64 > const & Direction, // Direction of the ray (need not be unit length)
+		std::vector< int > & SurfNums // Surfaces whose box the ray enters, ascending
+	);
+
+	void
+	SurfacesAlongRay(
+		Vector3< Real64 > const & Origin, // Point from which the ray originates (m)
+		Vector3< Real64 > const & Direction, // Direction of the ray (need not be unit length)
+		std::vector< int > & SurfNums // Surfaces whose box the ray enters, ascending
+	);
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // SurfaceBVH
+
+} // EnergyPlus
+
+#endif
@@ -28,6 +28,7 @@
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
 #include <ScheduleManager.hh>
+#include <SurfaceBVH.hh>
 #include <UtilityRoutines.hh>
 #include <Vectors.hh>
 
@@ -141,6 +142,7 @@ namespace SurfaceGeometry {
 		using General::RoundSigDigits;
 		using namespace DataReportingFlags;
 		using InputProcessor::GetNumSectionsFound;
+		using SurfaceBVH::BuildSurfaceBVH;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -567,6 +569,10 @@ namespace SurfaceGeometry {
 		// Do the Stratosphere check
 		SetOutBulbTempAt( NumOfZones, Zone( {1,NumOfZones} ).ma( &ZoneData::Centroid ).z(), Zone( {1,NumOfZones} ).OutDryBulbTemp(), Zone( {1,NumOfZones} ).OutWetBulbTemp(), "Zone" );
 
+		// Surface geometry is final from here on; build the hierarchy used by shadowing and daylighting queries
+		++SurfaceGeometryGeneration;
+		BuildSurfaceBVH();
+
 		//  IF (ALLOCATED(ZoneSurfacesCount)) DEALLOCATE(ZoneSurfacesCount)
 		//  IF (ALLOCATED(ZoneSubSurfacesCount)) DEALLOCATE(ZoneSubSurfacesCount)
 		//  IF (ALLOCATED(ZoneShadingSurfacesCount)) DEALLOCATE(ZoneShadingSurfacesCount)
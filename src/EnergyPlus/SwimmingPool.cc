@@ -800,6 +800,8 @@ namespace SwimmingPool {
 		using DataHeatBalSurface::QRadSWInAbs;
 		using FluidProperties::GetSpecificHeatGlycol;
 		using DataHeatBalSurface::TH;
+		using DataHeatBalSurface::CTFHistHead;
+		using DataHeatBalSurface::CTFHistTIn;
 		using DataSurfaces::Surface;
 		using DataGlobals::TimeStepZoneSec;
 		using DataGlobals::SecInHour;
@@ -885,7 +887,7 @@ namespace SwimmingPool {
 		// Get an estimate of the pool water specific heat
 		Cp = GetSpecificHeatGlycol( "WATER", Pool( PoolNum ).PoolWaterTemp, Pool( PoolNum ).GlycolIndex, RoutineName );
 
-		TH22 = TH( SurfNum, 2, 2 ); // inside surface temperature at the previous time step equals the old pool water temperature
+		TH22 = CTFHistTIn( CTFHistHead( SurfNum ), SurfNum ); // inside surface temperature at the previous time step equals the old pool water temperature
 		TH11 = TH( SurfNum, 1, 1 ); // outside surface temperature at the current time step
 		ConstrNum = Surface( SurfNum ).Construction;
 		TInSurf = Pool( PoolNum ).CurSetPtTemp;
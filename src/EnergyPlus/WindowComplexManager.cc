@@ -1,7 +1,10 @@
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
+#include <limits>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -25,6 +28,7 @@
 #include <General.hh>
 #include <InputProcessor.hh>
 #include <Psychrometrics.hh>
+#include <ShadingCache.hh>
 #include <TARCOGGassesParams.hh>
 #include <TARCOGMain.hh>
 #include <TARCOGParams.hh>
@@ -98,6 +102,9 @@ namespace WindowComplexManager {
 	int const Back_Transmitted( 5 );
 	int const Back_Reflected( 6 );
 
+	std::size_t const MaxTARCOGSolutions( 2048 ); // Stored tarcog solutions per window system
+	Real64 const TARCOGPressureBin( 100.0 ); // Band width of the gas pressure for tarcog solution reuse [Pa]
+
 	// DERIVED TYPE DEFINITIONS:
 
 	// MODULE VARIABLE DECLARATIONS:
@@ -110,6 +117,25 @@ namespace WindowComplexManager {
 	Real64 DdbgTheta;
 	Real64 DdbgPhi;
 	//EndDebug
+	int NumTARCOGSolved( 0 ); // Window heat balances solved by tarcog with solution reuse on
+	int NumTARCOGReused( 0 ); // Window heat balances taken from a stored tarcog solution
+	int NumTARCOGWarmStarts( 0 ); // Tarcog solutions started from a stored solution
+
+	namespace {
+		std::vector< std::uint64_t > LastTARCOGSystem; // Window system of the last solution of each surface
+		std::vector< std::vector< std::int64_t > > LastTARCOGBins; // Boundary conditions of the last solution of each surface
+
+		// Index key of a set of tarcog boundary condition bands
+		std::uint64_t
+		TARCOGBinsKey( std::vector< std::int64_t > const & Bins )
+		{
+			std::uint64_t Key( ShadingCache::HashSeed );
+			for ( std::int64_t const Bin : Bins ) {
+				Key = ShadingCache::HashValue( Key, Real64( Bin ) );
+			}
+			return Key;
+		}
+	}
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowComplexManager:
 
@@ -117,9 +143,21 @@ namespace WindowComplexManager {
 	FArray1D< BasisStruct > BasisList;
 	FArray1D< WindowIndex > WindowList;
 	FArray2D< WindowStateIndex > WindowStateList;
+	std::map< std::uint64_t, TARCOGSystemSolutions > TARCOGSolutions; // By construction and window geometry
 
 	// Functions
 
+	void
+	clear_state()
+	{
+		NumTARCOGSolved = 0;
+		NumTARCOGReused = 0;
+		NumTARCOGWarmStarts = 0;
+		TARCOGSolutions.clear();
+		LastTARCOGSystem.clear();
+		LastTARCOGBins.clear();
+	}
+
 	void
 	InitBSDFWindows()
 	{
@@ -921,7 +959,7 @@ namespace WindowComplexManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Joe Klems
 		//       DATE WRITTEN   August 2011
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, use the matrix projections kept in the state
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -930,7 +968,9 @@ namespace WindowComplexManager {
 
 		// METHODOLOGY EMPLOYED:
 		// Locate the bidirectional property matrices in the BSDFInput structure
-		// and use them to calculate the desired average properties.
+		// and use them to calculate the desired average properties.  Directional-hemispherical
+		// values are looked up in the column sums formed by CalcWindowStaticProperties, and rays
+		// outside the nonzero rows of the beam column are skipped.
 
 		// REFERENCES:
 		// na
@@ -962,13 +1002,14 @@ namespace WindowComplexManager {
 		int JSurf; // gen purpose surface no
 		int BaseSurf; // base surface no
 		int K; // general purpose index
-		int M; // general purpose index--ray
 		int L; // general purpose index--layer
 		int KBkSurf; // general purpose index--back surface
 		Real64 Sum1; // general purpose sum
 		Real64 Sum2; // general purpose sum
 		Real64 Sum3; // general purpose sum
 		int IBm; // index of beam ray in incoming basis
+		int FirstRay; // first outgoing ray with nonzero transmittance for the beam
+		int LastRay; // last outgoing ray with nonzero transmittance for the beam
 		int BkIncRay; // index of sun dir in back incidence basis
 		bool RegWindFnd; // flag for regular exterior back surf window
 		FArray1D_int RegWinIndex; // bk surf nos of reg windows
@@ -992,19 +1033,19 @@ namespace WindowComplexManager {
 			State.WinDirSpecTrans( Hour, TS ) = 0.0;
 			State.WinBmFtAbs( {1,State.NLayers}, Hour, TS ) = 0.0;
 		} else {
+			FirstRay = State.SolFtTransFirst( IBm );
+			LastRay = State.SolFtTransLast( IBm );
 			for ( I = 1; I <= Window.NBkSurf; ++I ) { //Back surface loop
 				Sum1 = 0.0;
 				for ( J = 1; J <= Geom.NSurfInt( I ); ++J ) { //Ray loop
-					Sum1 += Geom.Trn.Lamda( Geom.SurfInt( I, J ) ) * Construct( IConst ).BSDFInput.SolFrtTrans( Geom.SurfInt( I, J ), IBm );
+					JRay = Geom.SurfInt( I, J );
+					if ( JRay < FirstRay || JRay > LastRay ) continue;
+					Sum1 += Geom.Trn.Lamda( JRay ) * Construct( IConst ).BSDFInput.SolFrtTrans( JRay, IBm );
 				} //Ray loop
 				State.WinToSurfBmTrans( I, Hour, TS ) = Sum1;
 			} //Back surface loop
 			//Calculate the directional-hemispherical transmittance
-			Sum1 = 0.0;
-			for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-				Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolFrtTrans( J, IBm );
-			}
-			State.WinDirHemiTrans( Hour, TS ) = Sum1;
+			State.WinDirHemiTrans( Hour, TS ) = State.FtDirHemiTrans( IBm );
 			//Calculate the directional specular transmittance
 			//Note:  again using assumption that Inc and Trn basis have same structure
 			State.WinDirSpecTrans( Hour, TS ) = Geom.Trn.Lamda( IBm ) * Construct( IConst ).BSDFInput.SolFrtTrans( IBm, IBm );
@@ -1022,9 +1063,7 @@ namespace WindowComplexManager {
 			JRay = Geom.GndIndex( J );
 			if ( Geom.SolBmGndWt( J, Hour, TS ) > 0.0 ) {
 				Sum2 += Geom.SolBmGndWt( J, Hour, TS ) * Geom.Inc.Lamda( JRay );
-				for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-					Sum1 += Geom.SolBmGndWt( J, Hour, TS ) * Geom.Inc.Lamda( JRay ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, JRay );
-				} //Outgoing ray loop
+				Sum1 += Geom.SolBmGndWt( J, Hour, TS ) * Geom.Inc.Lamda( JRay ) * State.FtDirHemiTrans( JRay );
 			}
 		} //Indcident ray loop
 		if ( Sum2 > 0.0 ) {
@@ -1076,11 +1115,7 @@ namespace WindowComplexManager {
 				//Here calculate the back incidence properties for the solar ray
 				//this does not say whether or not the ray can pass through the
 				//back surface window and hit this one!
-				Sum1 = 0.0;
-				for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-					Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolBkRefl( J, BkIncRay );
-				}
-				Refl = Sum1;
+				Refl = State.BkDirHemiRefl( BkIncRay );
 				for ( L = 1; L <= State.NLayers; ++L ) {
 					Absorb( L ) = Construct( IConst ).BSDFInput.Layer( L ).BkAbs( 1, BkIncRay );
 				}
@@ -2011,7 +2046,7 @@ namespace WindowComplexManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Joe Klems
 		//       DATE WRITTEN   <date_written>
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, project the property matrices once per state
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2019,7 +2054,10 @@ namespace WindowComplexManager {
 		// do not depend on the beam direction (hence, on hour and time step)
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The transmittance and reflectance matrices are reduced to weighted row or column sums in one
+		// pass each.  The hemispherical averages are formed from these vectors, and the column sums are
+		// kept in the state for the beam calculations of every hour and time step, together with the
+		// range of nonzero rows in each column of the transmittance matrices.
 
 		// REFERENCES:
 		// na
@@ -2053,18 +2091,28 @@ namespace WindowComplexManager {
 		Real64 Sum2; // general purpose temporary sum
 		Real64 Sum3; // general purpose temporary sum
 		Real64 Hold; // temp variable
+		FArray1D< Real64 > SolFtRowTrans; // Solar front transmittance summed over the columns (for each row)
+		FArray1D< Real64 > VisFtRowTrans; // Visible front transmittance summed over the columns (for each row)
+		FArray1D< Real64 > VisBkColRefl; // Visible back reflectance summed over the rows (for each column)
 
 		IConst = SurfaceWindow( ISurf ).ComplexFen.State( IState ).Konst;
 
+		//Project the property matrices
+		BSDFRowSums( Construct( IConst ).BSDFInput.SolFrtTrans, Geom.Trn.Lamda, SolFtRowTrans );
+		BSDFRowSums( Construct( IConst ).BSDFInput.VisFrtTrans, Geom.Trn.Lamda, VisFtRowTrans );
+		BSDFColumnSums( Construct( IConst ).BSDFInput.SolFrtTrans, Geom.Trn.Lamda, State.FtDirHemiTrans );
+		BSDFColumnSums( Construct( IConst ).BSDFInput.SolBkRefl, Geom.Trn.Lamda, State.BkDirHemiRefl );
+		BSDFColumnSums( Construct( IConst ).BSDFInput.VisBkRefl, Geom.Trn.Lamda, VisBkColRefl );
+		FindBSDFBands( Construct( IConst ).BSDFInput.SolFrtTrans, State.SolFtTransFirst, State.SolFtTransLast );
+		FindBSDFBands( Construct( IConst ).BSDFInput.VisFrtTrans, State.VisFtTransFirst, State.VisFtTransLast );
+
 		//Calculate the hemispherical-hemispherical transmittance
 
 		Sum1 = 0.0;
 		Sum2 = 0.0;
 		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { //Incident ray loop
 			Sum2 += Geom.Inc.Lamda( J );
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-				Sum1 += Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( J, M );
-			} //Outgoing ray loop
+			Sum1 += Geom.Inc.Lamda( J ) * SolFtRowTrans( J );
 		} //Incident ray loop
 		if ( Sum2 > 0 ) {
 			State.WinDiffTrans = Sum1 / Sum2;
@@ -2079,9 +2127,7 @@ namespace WindowComplexManager {
 		Sum2 = 0.0;
 		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { //Incident ray loop
 			Sum2 += Geom.Inc.Lamda( J );
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-				Sum1 += Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.VisFrtTrans( J, M );
-			} //Outgoing ray loop
+			Sum1 += Geom.Inc.Lamda( J ) * VisFtRowTrans( J );
 		} //Incident ray loop
 		if ( Sum2 > 0.0 ) {
 			State.WinDiffVisTrans = Sum1 / Sum2;
@@ -2098,10 +2144,8 @@ namespace WindowComplexManager {
 		Sum2 = 0.0;
 		Sum3 = 0.0;
 		for ( JJ = 1; JJ <= Geom.NSky; ++JJ ) {
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) {
-				J = Geom.SkyIndex( JJ );
-				Sum1 += Geom.SolSkyWt( JJ ) * Construct( IConst ).BSDFInput.SolFrtTrans( J, M ) * Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M );
-			}
+			J = Geom.SkyIndex( JJ );
+			Sum1 += Geom.SolSkyWt( JJ ) * SolFtRowTrans( J ) * Geom.Inc.Lamda( J );
 		}
 		for ( JJ = 1; JJ <= Geom.NSky; ++JJ ) {
 			J = Geom.SkyIndex( JJ );
@@ -2141,10 +2185,8 @@ namespace WindowComplexManager {
 		Sum3 = 0.0;
 
 		for ( JJ = 1; JJ <= Geom.NGnd; ++JJ ) {
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) {
-				J = Geom.GndIndex( JJ );
-				Sum1 += Geom.SolSkyGndWt( JJ ) * Construct( IConst ).BSDFInput.SolFrtTrans( J, M ) * Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M );
-			}
+			J = Geom.GndIndex( JJ );
+			Sum1 += Geom.SolSkyGndWt( JJ ) * SolFtRowTrans( J ) * Geom.Inc.Lamda( J );
 		}
 
 		for ( JJ = 1; JJ <= Geom.NGnd; ++JJ ) {
@@ -2179,10 +2221,8 @@ namespace WindowComplexManager {
 		Sum3 = 0.0;
 		//Note this again assumes the equivalence Inc basis = transmission basis for back incidence and
 		// Trn basis = incident basis for back incidence
-		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-			for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
-				Sum1 += Construct( IConst ).BSDFInput.SolBkRefl( J, M ) * Geom.Trn.Lamda( J ) * Geom.Inc.Lamda( M );
-			}
+		for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
+			Sum1 += State.BkDirHemiRefl( M ) * Geom.Inc.Lamda( M );
 		}
 		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
 			Sum2 += Geom.Trn.Lamda( J );
@@ -2240,10 +2280,8 @@ namespace WindowComplexManager {
 		Sum2 = 0.0;
 		//Note this again assumes the equivalence Inc basis = transmission basis for back incidence and
 		// Trn basis = incident basis for back incidence
-		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-			for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
-				Sum1 += Construct( IConst ).BSDFInput.VisBkRefl( J, M ) * Geom.Trn.Lamda( J ) * Geom.Inc.Lamda( M );
-			}
+		for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
+			Sum1 += VisBkColRefl( M ) * Geom.Inc.Lamda( M );
 		}
 		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
 			Sum2 += Geom.Trn.Lamda( J );
@@ -2397,6 +2435,141 @@ namespace WindowComplexManager {
 
 	}
 
+	void
+	CalcWindowOverlapReflection(
+		BSDFGeomDescr const & Geom, // State Geometry
+		BSDFStateDescr & State // State Description
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Weights the visible front transmittance matrix by the average reflectance of the interior
+		// surfaces each outgoing direction reaches, giving for each incident direction the fraction of
+		// its light that is reflected at first bounce.  The daylighting inter-reflection calculation then
+		// needs only one pass over the incident directions per window element.
+
+		// METHODOLOGY EMPLOYED:
+		// Must be called after the overlap areas of the state have been calculated (AveRhoVisOverlap).
+
+		BSDFRowSums( Construct( State.Konst ).BSDFInput.VisFrtTrans, Geom.AveRhoVisOverlap, State.VisFtOverlapRefl );
+
+	}
+
+	void
+	BSDFColumnSums(
+		FArray2< Real64 > const & Mat, // Property matrix
+		FArray1< Real64 > const & Wt, // Weight for each row
+		FArray1D< Real64 > & Sums // Weighted sum of each column
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Forms Sums( K ) = sum over I of Wt( I ) * Mat( I, K ).  With the Lamda values of the outgoing
+		// basis as weights this is the directional-hemispherical value for each incident direction.
+
+		// METHODOLOGY EMPLOYED:
+		// The matrix is walked once in storage order.  Each column is summed in increasing row order, so
+		// the result is the same as that of a loop over the rows for one column.
+
+		int const NRows( Mat.isize1() );
+		int const NCols( Mat.isize2() );
+		Sums.dimension( NCols );
+		for ( int K = 1; K <= NCols; ++K ) {
+			Real64 Sum( 0.0 );
+			for ( int I = 1; I <= NRows; ++I ) {
+				Sum += Wt( I ) * Mat( I, K );
+			}
+			Sums( K ) = Sum;
+		}
+
+	}
+
+	void
+	BSDFRowSums(
+		FArray2< Real64 > const & Mat, // Property matrix
+		FArray1< Real64 > const & Wt, // Weight for each column
+		FArray1D< Real64 > & Sums // Weighted sum of each row
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Forms Sums( I ) = sum over K of Wt( K ) * Mat( I, K ).
+
+		// METHODOLOGY EMPLOYED:
+		// The matrix is walked once in storage order, adding each weighted column to the sums, rather
+		// than striding across the columns for each row.  Columns with zero weight are skipped.
+
+		int const NRows( Mat.isize1() );
+		int const NCols( Mat.isize2() );
+		Sums.dimension( NRows, 0.0 );
+		for ( int K = 1; K <= NCols; ++K ) {
+			Real64 const W( Wt( K ) );
+			if ( W == 0.0 ) continue;
+			for ( int I = 1; I <= NRows; ++I ) {
+				Sums( I ) += W * Mat( I, K );
+			}
+		}
+
+	}
+
+	void
+	FindBSDFBands(
+		FArray2< Real64 > const & Mat, // Property matrix
+		FArray1D_int & First, // First nonzero row of each column
+		FArray1D_int & Last // Last nonzero row of each column
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the range of rows holding the nonzero entries of each column of a property matrix.
+		// Specular and nearly specular layers give matrices that are zero away from the diagonal, and
+		// loops over one column can then be limited to this range without changing their result.
+		// A column of zeros gets First = 1 and Last = 0.
+
+		int const NRows( Mat.isize1() );
+		int const NCols( Mat.isize2() );
+		First.dimension( NCols );
+		Last.dimension( NCols );
+		for ( int K = 1; K <= NCols; ++K ) {
+			int I1( 1 );
+			while ( I1 <= NRows && Mat( I1, K ) == 0.0 ) ++I1;
+			int I2( NRows );
+			while ( I2 > I1 && Mat( I2, K ) == 0.0 ) --I2;
+			if ( I1 > NRows ) {
+				First( K ) = 1;
+				Last( K ) = 0;
+			} else {
+				First( K ) = I1;
+				Last( K ) = I2;
+			}
+		}
+
+	}
+
 	Real64
 	SkyWeight( Vector const & DirVec ) // Direction of the element to be weighted
 	{
@@ -2967,6 +3140,7 @@ namespace WindowComplexManager {
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   October 2009
 		//       MODIFIED       Simon Vidanovic
+		//                      October 2026, reuse of stored solutions for nearby boundary conditions
 		//       RE-ENGINEERED  September 2011
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2975,6 +3149,10 @@ namespace WindowComplexManager {
 		// METHODOLOGY EMPLOYED:
 		// draft out an attempt for proof-of-concept, to reuse native TARCOG implementation
 		// based off of 1-26-2009 version of WinCOG/TARCOG solution from Carli, Inc.
+		// With a solution reuse method in WindowThermalModel:Params the time step solutions are stored
+		// by construction and window geometry with the boundary conditions divided into tolerance bands.
+		// A solution in the same bands is taken as it is (ReuseWithinTolerance); otherwise tarcog
+		// starts from the closest stored solution if it is closer than the last time step of the window.
 
 		// REFERENCES:
 		// na
@@ -2991,6 +3169,8 @@ namespace WindowComplexManager {
 		using General::InterpSw;
 		using InputProcessor::SameString;
 		using DataHeatBalSurface::HcExtSurf;
+		using ShadingCache::HashSeed;
+		using ShadingCache::HashValue;
 		using DataGlobals::StefanBoltzmann;
 		using TARCOGGassesParams::maxgas;
 		using TARCOGParams::maxlay;
@@ -3704,8 +3884,102 @@ namespace WindowComplexManager {
 			theta = 273.15;
 		}
 
+		// Look for a stored solution for nearby boundary conditions
+		int const SolutionReuse( CalcCondition == noCondition ? WindowThermalModel( ThermalModelNum ).SolutionReuse : rmNoReuse );
+		TARCOGSystemSolutions * Stored( nullptr );
+		std::uint64_t SystemKey( HashSeed );
+		std::vector< std::int64_t > Bins;
+		bool Reused( false );
+		if ( SolutionReuse != rmNoReuse ) {
+			auto const & Model( WindowThermalModel( ThermalModelNum ) );
+			SystemKey = HashValue( SystemKey, ConstrNum );
+			SystemKey = HashValue( SystemKey, tilt );
+			SystemKey = HashValue( SystemKey, height );
+			SystemKey = HashValue( SystemKey, width );
+			SystemKey = HashValue( SystemKey, isky ); // Sky model and outdoor film choice are not in the bands
+			SystemKey = HashValue( SystemKey, esky );
+			SystemKey = HashValue( SystemKey, ibc( 1 ) );
+			Stored = &TARCOGSolutions[ SystemKey ];
+
+			Bins.reserve( nlayer + 12 );
+			Bins.push_back( TARCOGBin( tout, Model.ReuseTemperatureTolerance ) );
+			Bins.push_back( TARCOGBin( tind, Model.ReuseTemperatureTolerance ) );
+			Bins.push_back( TARCOGBin( trmin, Model.ReuseTemperatureTolerance ) );
+			Bins.push_back( TARCOGBin( tsky, Model.ReuseTemperatureTolerance ) );
+			Bins.push_back( TARCOGBin( outir, Model.ReuseIrradianceTolerance ) );
+			Bins.push_back( TARCOGBin( dir, Model.ReuseIrradianceTolerance ) );
+			for ( k = 1; k <= nlayer; ++k ) {
+				Bins.push_back( TARCOGBin( asol( k ), Model.ReuseIrradianceTolerance ) );
+			}
+			Bins.push_back( TARCOGBin( wso, Model.ReuseWindSpeedTolerance ) );
+			Bins.push_back( TARCOGBin( hout, Model.ReuseFilmCoefficientTolerance ) );
+			if ( ibc( 2 ) > 0 ) Bins.push_back( TARCOGBin( hin, Model.ReuseFilmCoefficientTolerance ) ); // Otherwise hin is calculated
+			Bins.push_back( TARCOGBin( Pa, TARCOGPressureBin ) );
+			Bins.push_back( TARCOGBin( presure( 1 ), TARCOGPressureBin ) );
+			Bins.push_back( TARCOGBin( fclr, 0.01 ) );
+
+			if ( LastTARCOGBins.size() < std::size_t( TotSurfaces ) ) {
+				LastTARCOGSystem.resize( TotSurfaces, HashSeed );
+				LastTARCOGBins.resize( TotSurfaces );
+			}
+			std::int64_t Distance( 0 );
+			int const Closest( FindTARCOGSolution( *Stored, Bins, Distance ) );
+			if ( Closest >= 0 ) {
+				TARCOGSolution const & Solution( Stored->Solutions[ Closest ] );
+				if ( Distance == 0 && SolutionReuse == rmReuseWithinTolerance ) {
+					for ( k = 1; k <= 2 * nlayer; ++k ) {
+						theta( k ) = Solution.Theta[ k - 1 ];
+					}
+					for ( k = 1; k <= nlayer + 1; ++k ) {
+						qv( k ) = Solution.Qv[ k - 1 ];
+					}
+					for ( k = 1; k <= nlayer; ++k ) {
+						thick( k ) = Solution.Thick[ k - 1 ];
+						scon( k ) = Solution.Scon[ k - 1 ];
+					}
+					hcin = Solution.Hcin;
+					tind = Solution.Tind;
+					nperr = 0;
+					NumOfIterations = 0;
+					Reused = true;
+					++NumTARCOGReused;
+				} else if ( LastTARCOGSystem[ SurfNum - 1 ] != SystemKey || Distance < TARCOGBinDistance( Bins, LastTARCOGBins[ SurfNum - 1 ] ) ) {
+					// Stored solution is closer than the last time step that theta now holds
+					for ( k = 1; k <= 2 * nlayer; ++k ) {
+						theta( k ) = Solution.Theta[ k - 1 ];
+					}
+					++NumTARCOGWarmStarts;
+				}
+			}
+		}
+
 		//  call TARCOG
-		TARCOG90( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, CalcDeflection, Pa, Pini, Tini, gap, GapDefMax, thick, scon, YoungsMod, PoissonsRat, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, gcon, gvis, gcp, wght, gama, nmix, SupportPlr, PillarSpacing, PillarRadius, theta, LayerDef, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgap, hrgap, shgc, nperr, tarcogErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, hg, hr, hs, he, hi, Ra, Nu, standard, ThermalMod, Debug_mode, Debug_dir, Debug_file, Window_ID, IGU_ID, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, SDScalar, CalcSHGC, NumOfIterations );
+		if ( ! Reused ) {
+			TARCOG90( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, CalcDeflection, Pa, Pini, Tini, gap, GapDefMax, thick, scon, YoungsMod, PoissonsRat, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, gcon, gvis, gcp, wght, gama, nmix, SupportPlr, PillarSpacing, PillarRadius, theta, LayerDef, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgap, hrgap, shgc, nperr, tarcogErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, hg, hr, hs, he, hi, Ra, Nu, standard, ThermalMod, Debug_mode, Debug_dir, Debug_file, Window_ID, IGU_ID, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, SDScalar, CalcSHGC, NumOfIterations );
+
+			if ( Stored != nullptr && nperr == 0 ) {
+				TARCOGSolution Solution;
+				Solution.Bins = Bins;
+				for ( k = 1; k <= 2 * nlayer; ++k ) {
+					Solution.Theta.push_back( theta( k ) );
+				}
+				for ( k = 1; k <= nlayer + 1; ++k ) {
+					Solution.Qv.push_back( qv( k ) );
+				}
+				for ( k = 1; k <= nlayer; ++k ) {
+					Solution.Thick.push_back( thick( k ) );
+					Solution.Scon.push_back( scon( k ) );
+				}
+				Solution.Hcin = hcin;
+				Solution.Tind = tind;
+				SaveTARCOGSolution( *Stored, Solution );
+				++NumTARCOGSolved;
+			}
+		}
+		if ( Stored != nullptr ) {
+			LastTARCOGSystem[ SurfNum - 1 ] = SystemKey;
+			LastTARCOGBins[ SurfNum - 1 ].swap( Bins );
+		}
 
 		// process results from TARCOG
 		if ( ( nperr > 0 ) && ( nperr < 1000 ) ) { // process error signal from tarcog
@@ -3932,6 +4206,128 @@ namespace WindowComplexManager {
 
 	}
 
+	std::int64_t
+	TARCOGBin(
+		Real64 const Value,
+		Real64 const Tolerance // Band width
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the tolerance band of a tarcog boundary condition.  Values in the same band differ
+		// by less than the tolerance.
+
+		return std::llround( Value / Tolerance );
+
+	}
+
+	std::int64_t
+	TARCOGBinDistance(
+		std::vector< std::int64_t > const & A,
+		std::vector< std::int64_t > const & B
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Largest difference in bands between two sets of boundary conditions, or the largest
+		// representable distance if they do not have the same conditions.
+
+		if ( A.size() != B.size() ) return std::numeric_limits< std::int64_t >::max();
+		std::int64_t Distance( 0 );
+		for ( std::size_t I = 0; I < A.size(); ++I ) {
+			Distance = std::max( Distance, std::abs( A[ I ] - B[ I ] ) );
+		}
+		return Distance;
+
+	}
+
+	int
+	FindTARCOGSolution(
+		TARCOGSystemSolutions const & System,
+		std::vector< std::int64_t > const & Bins, // Current boundary conditions
+		std::int64_t & Distance // Distance to the solution found, 0 if its conditions are in the same bands
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the stored solution (0-based) whose boundary conditions are in the same bands as the
+		// given ones, or else the closest stored solution; -1 if none is stored.
+
+		// METHODOLOGY EMPLOYED:
+		// Solutions in the same bands are found through the hash index.  Otherwise all stored
+		// solutions are compared by TARCOGBinDistance; the earliest of equally close ones is taken.
+
+		auto const Found( System.Index.find( TARCOGBinsKey( Bins ) ) );
+		if ( Found != System.Index.end() && System.Solutions[ Found->second ].Bins == Bins ) {
+			Distance = 0;
+			return int( Found->second );
+		}
+
+		int Closest( -1 );
+		Distance = std::numeric_limits< std::int64_t >::max();
+		for ( std::size_t I = 0; I < System.Solutions.size(); ++I ) {
+			std::int64_t const D( TARCOGBinDistance( Bins, System.Solutions[ I ].Bins ) );
+			if ( D < Distance ) {
+				Distance = D;
+				Closest = int( I );
+			}
+		}
+		return Closest;
+
+	}
+
+	void
+	SaveTARCOGSolution(
+		TARCOGSystemSolutions & System,
+		TARCOGSolution const & Solution
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stores a tarcog solution.  A solution with the same bands replaces the stored one; once
+		// MaxTARCOGSolutions are stored the oldest one is replaced.
+
+		std::uint64_t const Key( TARCOGBinsKey( Solution.Bins ) );
+		auto const Found( System.Index.find( Key ) );
+		if ( Found != System.Index.end() ) {
+			System.Solutions[ Found->second ] = Solution;
+		} else if ( System.Solutions.size() < MaxTARCOGSolutions ) {
+			System.Index[ Key ] = System.Solutions.size();
+			System.Solutions.push_back( Solution );
+		} else {
+			TARCOGSolution & Oldest( System.Solutions[ System.Next ] );
+			System.Index.erase( TARCOGBinsKey( Oldest.Bins ) );
+			Oldest = Solution;
+			System.Index[ Key ] = System.Next;
+			System.Next = ( System.Next + 1 ) % MaxTARCOGSolutions;
+		}
+
+	}
+
 	// This function check if gas with molecular weight has already been feed into coefficients and
 	// feed arrays
 
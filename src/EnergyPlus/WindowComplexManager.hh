@@ -1,6 +1,11 @@
 #ifndef WindowComplexManager_hh_INCLUDED
 #define WindowComplexManager_hh_INCLUDED
 
+// C++ Headers
+#include <cstdint>
+#include <map>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
 #include <ObjexxFCL/FArray1S.hh>
@@ -43,6 +48,9 @@ namespace WindowComplexManager {
 	extern int const Back_Transmitted;
 	extern int const Back_Reflected;
 
+	extern std::size_t const MaxTARCOGSolutions; // Stored tarcog solutions per window system
+	extern Real64 const TARCOGPressureBin; // Band width of the gas pressure for tarcog solution reuse [Pa]
+
 	// DERIVED TYPE DEFINITIONS:
 
 	// MODULE VARIABLE DECLARATIONS:
@@ -55,6 +63,9 @@ namespace WindowComplexManager {
 	extern Real64 DdbgTheta;
 	extern Real64 DdbgPhi;
 	//EndDebug
+	extern int NumTARCOGSolved; // Window heat balances solved by tarcog with solution reuse on
+	extern int NumTARCOGReused; // Window heat balances taken from a stored tarcog solution
+	extern int NumTARCOGWarmStarts; // Tarcog solutions started from a stored solution
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowComplexManager:
 
@@ -121,13 +132,52 @@ namespace WindowComplexManager {
 
 	};
 
+	struct TARCOGSolution
+	{
+		// Members
+		std::vector< std::int64_t > Bins; // Boundary conditions in units of the reuse tolerances
+		std::vector< Real64 > Theta; // Surface temperatures [K] {2*nlayer}
+		std::vector< Real64 > Qv; // Heat fluxes to each gap by ventilation [W/m^2] {nlayer+1}
+		std::vector< Real64 > Thick; // Layer thicknesses returned by tarcog [m] {nlayer}
+		std::vector< Real64 > Scon; // Layer conductivities returned by tarcog [W/m.K] {nlayer}
+		Real64 Hcin; // Indoor convective film coefficient [W/m^2.K]
+		Real64 Tind; // Indoor temperature [K]
+
+		// Default Constructor
+		TARCOGSolution() :
+			Hcin( 0.0 ),
+			Tind( 0.0 )
+		{}
+
+	};
+
+	struct TARCOGSystemSolutions
+	{
+		// Members
+		std::vector< TARCOGSolution > Solutions; // Stored solutions of one construction and window geometry
+		std::map< std::uint64_t, std::size_t > Index; // Solution by hash of its bins
+		std::size_t Next; // Solution replaced next once MaxTARCOGSolutions are stored
+
+		// Default Constructor
+		TARCOGSystemSolutions() :
+			Next( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< BasisStruct > BasisList;
 	extern FArray1D< WindowIndex > WindowList;
 	extern FArray2D< WindowStateIndex > WindowStateList;
+	extern std::map< std::uint64_t, TARCOGSystemSolutions > TARCOGSolutions; // By construction and window geometry
 
 	// Functions
 
+	// Clears the global data in WindowComplexManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	InitBSDFWindows();
 
@@ -222,6 +272,33 @@ namespace WindowComplexManager {
 		BSDFStateDescr & State // State Description
 	);
 
+	void
+	CalcWindowOverlapReflection(
+		BSDFGeomDescr const & Geom, // State Geometry
+		BSDFStateDescr & State // State Description
+	);
+
+	void
+	BSDFColumnSums(
+		FArray2< Real64 > const & Mat, // Property matrix
+		FArray1< Real64 > const & Wt, // Weight for each row
+		FArray1D< Real64 > & Sums // Weighted sum of each column
+	);
+
+	void
+	BSDFRowSums(
+		FArray2< Real64 > const & Mat, // Property matrix
+		FArray1< Real64 > const & Wt, // Weight for each column
+		FArray1D< Real64 > & Sums // Weighted sum of each row
+	);
+
+	void
+	FindBSDFBands(
+		FArray2< Real64 > const & Mat, // Property matrix
+		FArray1D_int & First, // First nonzero row of each column
+		FArray1D_int & Last // Last nonzero row of each column
+	);
+
 	Real64
 	SkyWeight( Vector const & DirVec ); // Direction of the element to be weighted
 
@@ -272,6 +349,31 @@ namespace WindowComplexManager {
 		int const CalcCondition // Calucation condition (summer, winter or no condition)
 	);
 
+	std::int64_t
+	TARCOGBin(
+		Real64 const Value,
+		Real64 const Tolerance // Band width
+	);
+
+	std::int64_t
+	TARCOGBinDistance(
+		std::vector< std::int64_t > const & A,
+		std::vector< std::int64_t > const & B
+	);
+
+	int
+	FindTARCOGSolution(
+		TARCOGSystemSolutions const & System,
+		std::vector< std::int64_t > const & Bins, // Current boundary conditions
+		std::int64_t & Distance // Distance to the solution found, 0 if its conditions are in the same bands
+	);
+
+	void
+	SaveTARCOGSolution(
+		TARCOGSystemSolutions & System,
+		TARCOGSolution const & Solution
+	);
+
 	// This function check if gas with molecular weight has already been feed into coefficients and
 	// feed arrays
 
@@ -1,5 +1,7 @@
 // C++ Headers
 #include <cmath>
+#include <cstdint>
+#include <map>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -21,6 +23,7 @@
 #include <General.hh>
 #include <InputProcessor.hh>
 #include <Psychrometrics.hh>
+#include <ShadingCache.hh>
 #include <UtilityRoutines.hh>
 
 namespace EnergyPlus {
@@ -110,6 +113,22 @@ namespace WindowEquivalentLayer {
 
 	FArray3D< Real64 > CFSDiffAbsTrans;
 	FArray1D_bool EQLDiffPropFlag;
+	int NumEQLOpticsCalculated( 0 ); // Equivalent layer optical calculations done
+	int NumEQLOpticsReused( 0 ); // Equivalent layer optical properties shared with a window seeing the sun at the same angles
+
+	namespace {
+		// Optical properties of a construction for one set of incidence and profile angles
+		struct EQLOpticsEntry
+		{
+			FArray2D< Real64 > Abs; // Layer absorptances and system transmittance
+			FArray1D< CFSLAYER > Layers; // Layers after shade control (controlled constructions only)
+		};
+
+		std::map< std::uint64_t, EQLOpticsEntry > EQLOpticsStore; // By construction, beam or diffuse, and angles
+		int EQLOpticsDay( 0 ); // Time step of the entries in EQLOpticsStore
+		int EQLOpticsHour( 0 );
+		int EQLOpticsTimeStep( 0 );
+	}
 
 	// MODULE SUBROUTINES:
 	// Initialization routines for module
@@ -929,8 +948,9 @@ namespace WindowEquivalentLayer {
 		NL = CFS( EQLNum ).NL;
 		QAllSWwinAbs( {1,NL + 1} ) = QRadSWwinAbs( SurfNum, {1,NL + 1} );
 		//  Solve energy balance(s) for temperature at each node/layer and
-		//  heat flux, including components, between each pair of nodes/layers
-		ASHWAT_ThermalR = ASHWAT_Thermal( CFS( EQLNum ), TIN, Tout, HcIn, HcOut, TRMOUT, TRMIN, 0.0, QAllSWwinAbs( {1,NL+1} ), TOL, QOCF, QOCFRoom, T, Q, JF, JB, H, UCG, SHGC );
+		//  heat flux, including components, between each pair of nodes/layers.  UCG and SHGC are not
+		//  used here, so the indices of merit are skipped
+		ASHWAT_ThermalR = ASHWAT_Thermal( CFS( EQLNum ), TIN, Tout, HcIn, HcOut, TRMOUT, TRMIN, 0.0, QAllSWwinAbs( {1,NL+1} ), TOL, QOCF, QOCFRoom, T, Q, JF, JB, H, UCG, SHGC, _, false );
 		// long wave radiant power to room not including reflected
 		QRLWX = JB( NL ) - ( 1.0 - LWAbsIn ) * JF( NL + 1 );
 		// nominal surface temp = effective radiant temperature
@@ -4860,7 +4880,8 @@ namespace WindowEquivalentLayer {
 		FArray1A< Real64 > HC, // returned: gap convective heat transfer coefficient, W/m2K
 		Real64 & UCG, // returned: center-glass U-factor, W/m2-K
 		Real64 & SHGC, // returned: center-glass SHGC (Solar Heat Gain Coefficient)
-		Optional_bool_const HCInFlag // If true uses ISO Std 150099 routine for HCIn calc
+		Optional_bool_const HCInFlag, // If true uses ISO Std 150099 routine for HCIn calc
+		Optional_bool_const CalcIndices // If false UCG and SHGC (indices of merit) are not calculated
 	)
 	{
 		// SUBROUTINE INFORMATION:
@@ -4870,6 +4891,7 @@ namespace WindowEquivalentLayer {
 		//       MODIFIED       Bereket Nigusse, June 2013
 		//                      added standard 155099 inside convection
 		//                      coefficient calculation for U-Factor
+		//                      October 2026, optional bypass of the indices of merit
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5016,6 +5038,9 @@ namespace WindowEquivalentLayer {
 		HCOCFout = HCOUT; // outdoor side
 
 		IM_ON = 1;
+		if ( present( CalcIndices ) ) {
+			if ( ! CalcIndices ) IM_ON = 0;
+		}
 
 		HHAT = 0.0;
 		HC = 0.0;
@@ -5328,7 +5353,11 @@ namespace WindowEquivalentLayer {
 		// NOTE: This code can be bypassed if
 		//       indices of merit are not needed
 
-		if ( IM_ON != 1 ) return ASHWAT_Thermal;
+		if ( IM_ON != 1 ) {
+			UCG = 0.0;
+			SHGC = 0.0;
+			return ASHWAT_Thermal;
+		}
 
 		//  Initialize various things
 		HR = 0.0;
@@ -9255,7 +9284,7 @@ namespace WindowEquivalentLayer {
 			}
 			// Incident angle
 			IncAng = std::acos( CosIncAng( SurfNum, HourOfDay, TimeStep ) );
-			CalcEQLWindowOpticalProperty( CFS( EQLNum ), BeamDIffFlag, Abs1, IncAng, ProfAngVer, ProfAngHor );
+			GetEQLWindowOpticalProperty( EQLNum, BeamDIffFlag, Abs1, IncAng, ProfAngVer, ProfAngHor );
 			CFSAbs( {1,CFSMAXNL + 1}, 1 ) = Abs1( {1,CFSMAXNL + 1}, 1 );
 			CFSAbs( {1,CFSMAXNL + 1}, 2 ) = Abs1( {1,CFSMAXNL + 1}, 2 );
 		} else {
@@ -9269,7 +9298,7 @@ namespace WindowEquivalentLayer {
 						}
 					}
 				}
-				CalcEQLWindowOpticalProperty( CFS( EQLNum ), BeamDIffFlag, Abs1, IncAng, ProfAngVer, ProfAngHor );
+				GetEQLWindowOpticalProperty( EQLNum, BeamDIffFlag, Abs1, IncAng, ProfAngVer, ProfAngHor );
 				CFSAbs( {1,CFSMAXNL + 1}, _ ) = Abs1( {1,CFSMAXNL + 1}, _ );
 				CFSDiffAbsTrans( EQLNum, {1,CFSMAXNL + 1}, _ ) = Abs1( {1,CFSMAXNL + 1}, _ );
 				Construct( ConstrNum ).TransDiff = Abs1( CFS( EQLNum ).NL + 1, 1 );
@@ -9288,6 +9317,71 @@ namespace WindowEquivalentLayer {
 
 	}
 
+	void
+	GetEQLWindowOpticalProperty(
+		int const EQLNum, // equivalent layer window construction index
+		int const DiffBeamFlag, // isDIFF: calc diffuse properties
+		FArray2A< Real64 > Abs1, // returned: as for CalcEQLWindowOpticalProperty
+		Real64 const IncA, // angle of incidence, radians
+		Real64 const VProfA, // inc solar vertical profile angle, radians
+		Real64 const HProfA // inc solar horizontal profile angle, radians
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Returns the optical properties of CalcEQLWindowOpticalProperty, calculating them once per
+		// time step for each construction and set of angles.  Windows of one construction facing the
+		// same way see the sun at the same angles, so a facade of identical windows is done once.
+
+		// METHODOLOGY EMPLOYED:
+		// Results are kept by a hash of the construction, the beam/diffuse flag and the angles, and
+		// the store is emptied when the time step changes.  Shade control changes the layers of the
+		// shared CFS, so for controlled constructions the layers after control are kept as well and
+		// put back when the result is reused.
+
+		// Using/Aliasing
+		using DataGlobals::DayOfSim;
+		using ShadingCache::HashSeed;
+		using ShadingCache::HashValue;
+
+		// Argument array dimensioning
+		Abs1.dim( CFSMAXNL+1, 2 );
+
+		if ( EQLOpticsDay != DayOfSim || EQLOpticsHour != HourOfDay || EQLOpticsTimeStep != TimeStep ) {
+			EQLOpticsStore.clear();
+			EQLOpticsDay = DayOfSim;
+			EQLOpticsHour = HourOfDay;
+			EQLOpticsTimeStep = TimeStep;
+		}
+
+		std::uint64_t Key( HashValue( HashSeed, EQLNum ) );
+		Key = HashValue( Key, DiffBeamFlag );
+		Key = HashValue( Key, IncA );
+		Key = HashValue( Key, VProfA );
+		Key = HashValue( Key, HProfA );
+		auto const Found( EQLOpticsStore.find( Key ) );
+		if ( Found != EQLOpticsStore.end() ) {
+			Abs1 = Found->second.Abs;
+			if ( CFS( EQLNum ).ISControlled ) CFS( EQLNum ).L = Found->second.Layers;
+			++NumEQLOpticsReused;
+			return;
+		}
+
+		CalcEQLWindowOpticalProperty( CFS( EQLNum ), DiffBeamFlag, Abs1, IncA, VProfA, HProfA );
+		EQLOpticsEntry & Entry( EQLOpticsStore[ Key ] );
+		Entry.Abs.dimension( CFSMAXNL+1, 2 );
+		Entry.Abs = Abs1;
+		if ( CFS( EQLNum ).ISControlled ) Entry.Layers = CFS( EQLNum ).L;
+		++NumEQLOpticsCalculated;
+
+	}
+
 	void
 	CalcEQLWindowStandardRatings( int const ConstrNum ) // construction index
 	{
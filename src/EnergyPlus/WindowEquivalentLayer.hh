@@ -45,6 +45,8 @@ namespace WindowEquivalentLayer {
 
 	extern FArray3D< Real64 > CFSDiffAbsTrans;
 	extern FArray1D_bool EQLDiffPropFlag;
+	extern int NumEQLOpticsCalculated; // Equivalent layer optical calculations done
+	extern int NumEQLOpticsReused; // Equivalent layer optical properties shared with a window seeing the sun at the same angles
 
 	// MODULE SUBROUTINES:
 	// Initialization routines for module
@@ -501,7 +503,8 @@ namespace WindowEquivalentLayer {
 		FArray1A< Real64 > HC, // returned: gap convective heat transfer coefficient, W/m2K
 		Real64 & UCG, // returned: center-glass U-factor, W/m2-K
 		Real64 & SHGC, // returned: center-glass SHGC (Solar Heat Gain Coefficient)
-		Optional_bool_const HCInFlag = _ // If true uses ISO Std 150099 routine for HCIn calc
+		Optional_bool_const HCInFlag = _, // If true uses ISO Std 150099 routine for HCIn calc
+		Optional_bool_const CalcIndices = _ // If false UCG and SHGC (indices of merit) are not calculated
 	);
 
 	void
@@ -869,6 +872,16 @@ namespace WindowEquivalentLayer {
 		FArray2A< Real64 > CFSAbs // absorbed beam solar radiation by layers fraction
 	);
 
+	void
+	GetEQLWindowOpticalProperty(
+		int const EQLNum, // equivalent layer window construction index
+		int const DiffBeamFlag, // isDIFF: calc diffuse properties
+		FArray2A< Real64 > Abs1, // returned: as for CalcEQLWindowOpticalProperty
+		Real64 const IncA, // angle of incidence, radians
+		Real64 const VProfA, // inc solar vertical profile angle, radians
+		Real64 const HProfA // inc solar horizontal profile angle, radians
+	);
+
 	void
 	CalcEQLWindowStandardRatings( int const ConstrNum ); // construction index
 
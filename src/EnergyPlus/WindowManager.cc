@@ -1,6 +1,8 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <map>
 #include <string>
 
 // ObjexxFCL Headers
@@ -22,11 +24,13 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
 #include <Psychrometrics.hh>
 #include <ScheduleManager.hh>
+#include <ShadingCache.hh>
 #include <UtilityRoutines.hh>
 #include <Vectors.hh>
 #include <WindowComplexManager.hh>
@@ -173,22 +177,8 @@ namespace WindowManager {
 	FArray2D< Real64 > t( MaxSpectralDataElements, 5, 0.0 ); // normal transmittance
 	FArray2D< Real64 > rff( MaxSpectralDataElements, 5, 0.0 ); // normal front reflectance
 	FArray2D< Real64 > rbb( MaxSpectralDataElements, 5, 0.0 ); // normal back reflectance
-	FArray2D< Real64 > tPhi( MaxSpectralDataElements, 5, 0.0 ); // transmittance at angle of incidence
-	FArray2D< Real64 > rfPhi( MaxSpectralDataElements, 5, 0.0 ); // front reflectance at angle of incidence
-	FArray2D< Real64 > rbPhi( MaxSpectralDataElements, 5, 0.0 ); // back reflectance at angle of incidence
-	FArray2D< Real64 > tadjPhi( MaxSpectralDataElements, 5, 0.0 ); // transmittance at angle of incidence
-	FArray2D< Real64 > rfadjPhi( MaxSpectralDataElements, 5, 0.0 ); // front reflectance at angle of incidence
-	FArray2D< Real64 > rbadjPhi( MaxSpectralDataElements, 5, 0.0 ); // back reflectance at angle of incidence
 
 	FArray1D_int numpt( 5, 0 ); // Number of spectral data wavelengths for each layer; =2 if no spectra data for a layer
-	FArray1D< Real64 > stPhi( nume, 0.0 ); // Glazing system transmittance at angle of incidence for each wavelength in wle
-	FArray1D< Real64 > srfPhi( nume, 0.0 ); // Glazing system front reflectance at angle of incidence for each wavelength in wle
-	FArray1D< Real64 > srbPhi( nume, 0.0 ); // Glazing system back reflectance at angle of incidence for each wavelenth in wle
-	FArray2D< Real64 > saPhi( nume, 5, 0.0 ); // For each layer, glazing system absorptance at angle of incidence
-	// for each wavelenth in wle
-	FArray2D< Real64 > top( 5, 5, 0.0 ); // Transmittance matrix for subr. op
-	FArray2D< Real64 > rfop( 5, 5, 0.0 ); // Front reflectance matrix for subr. op
-	FArray2D< Real64 > rbop( 5, 5, 0.0 ); // Back transmittance matrix for subr. op
 	FArray1D< Real64 > IndepVarCurveFit( 10, 0.0 ); // Values of independent variable (cos of inc. angle) for curve fit
 	FArray1D< Real64 > DepVarCurveFit( 10, 0.0 ); // Values of dependent variable corresponding to IndepVarCurveFit values
 	FArray1D< Real64 > CoeffsCurveFit( 6, 0.0 ); // Polynomial coefficients from curve fit
@@ -202,6 +192,15 @@ namespace WindowManager {
 	FArray1D< Real64 > rfvisPhi( 10, 0.0 ); // Glazing system visible front reflectance for each angle of incidence
 	FArray1D< Real64 > rbvisPhi( 10, 0.0 ); // Glazing system visible back reflectance for each angle of incidence
 	FArray1D< Real64 > CosPhiIndepVar( 10, 0.0 ); // Cos of incidence angles at 10-deg increments for curve fits
+	int NumGlazingOpticsCalculated( 0 ); // Bare glass angular properties integrated over the spectrum
+	int NumGlazingOpticsReused( 0 ); // Bare glass angular properties copied from identical glass layers
+	int NumGlazingOpticsFromFile( 0 ); // Bare glass angular properties read from the glazing optics cache file
+
+	namespace {
+		int const GlazingOpticsVersion( 1 ); // Change whenever the optical calculation changes its results
+		ShadingCache::RecordFile GlazingOpticsFile( "EPGLZ", { "solar or visible spectrum changed" } );
+		std::map< std::uint64_t, ShadingCache::ShadingRecord > GlazingOpticsStore; // Bare glass properties by GlazingOpticsKey
+	}
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowManager:
 	//   Optical Calculation Routines
@@ -224,6 +223,8 @@ namespace WindowManager {
 		//                      May 2006 (RR): add exterior window screen
 		//                      Aug 2010 (TH): allow spectral data for between-glass shade/blind
 		//                      Aug 2013 (TH): allow user defined solar and visible spectrum data
+		//                      October 2026, share bare glass angular properties between constructions
+		//                       and runs; incidence angles done in parallel
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -231,15 +232,20 @@ namespace WindowManager {
 		// system from the properties of the individual glazing and shading layers
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The bare glass properties at each angle of incidence depend only on the normal incidence
+		// spectral properties of the glass layers (after the dirt correction), so they are found once
+		// for each distinct set of glass layers, front and back, and kept by GlazingOpticsKey.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
 		using namespace Vectors;
+		using General::RoundSigDigits;
 		using General::TrimSigDigits;
 		using WindowEquivalentLayer::InitEquivalentLayerWindowCalculations;
+		using namespace ShadingCache;
+		using DataSystemVariables::GlazingOpticsCacheFileName;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -277,9 +283,6 @@ namespace WindowManager {
 		bool ShadeOn; // True if IntShade, ExtShade or BGShade is true
 		int BlNum; // Blind number
 		int ScNum; // Screen number
-		FArray1D< Real64 > sabsPhi( nume ); // Glazing system absorptance for a glass layer
-		//  and angle of incidence, for each wavelength
-		//   glass layer for an angle of incidence, for each wavelength
 		FArray1D< Real64 > solabsDiff( 5 ); // Glazing system layer solar absorptance for each glass layer
 		FArray1D< Real64 > solabsPhiLay( 10 ); // Glazing system solar absorptance for a layer at each incidence angle
 		FArray1D< Real64 > tsolPhiFit( 10 ); // Glazing system solar transmittance from fit at each incidence angle
@@ -409,10 +412,35 @@ namespace WindowManager {
 		static FArray1D< Real64 > DbgBkAbsDiff( 5, 0.0 );
 
 		//EndDebug
+		std::uint64_t StoreKey; // Hash of the glass layer properties (see GlazingOpticsKey)
+		ShadingCache::ShadingRecord Record; // Packed bare glass properties at each angle of incidence
+		std::size_t Pos; // Position in Record
+
+		// Formats
+		static gio::Fmt fmtA( "(A)" );
 
 		// check and read custom solar and/or visible spectrum data if any
 		CheckAndReadCustomSprectrumData();
 
+		// Bare glass properties found for one construction are reused for all constructions with
+		// the same glass layers, and with GLAZING_OPTICS_CACHE set, in later runs
+		NumGlazingOpticsCalculated = 0;
+		NumGlazingOpticsReused = 0;
+		NumGlazingOpticsFromFile = 0;
+		GlazingOpticsStore.clear();
+		if ( ! GlazingOpticsCacheFileName.empty() ) {
+			std::uint64_t Spectrum( HashValue( HashSeed, GlazingOpticsVersion ) );
+			for ( j = 1; j <= nume; ++j ) {
+				Spectrum = HashValue( Spectrum, wle( j ) );
+				Spectrum = HashValue( Spectrum, e( j ) );
+			}
+			for ( j = 1; j <= numt3; ++j ) {
+				Spectrum = HashValue( Spectrum, wlt3( j ) );
+				Spectrum = HashValue( Spectrum, y30( j ) );
+			}
+			OpenRecordFile( GlazingOpticsFile, GlazingOpticsCacheFileName, { Spectrum } );
+		}
+
 		W5InitGlassParameters();
 
 		// Calculate optical properties of blind-type layers entered with MATERIAL:WindowBlind
@@ -634,67 +662,124 @@ namespace WindowManager {
 			// Loop over incidence angle from 0 to 90 deg in 10 deg increments.
 			// Get glass layer properties, then glazing system properties (which include the
 			// effect of inter-reflection among glass layers) at each incidence angle.
-
-			for ( IPhi = 1; IPhi <= 10; ++IPhi ) {
-				Phi = double( IPhi - 1 ) * 10.0;
-				CosPhi = std::cos( Phi * DegToRadians );
-				if ( std::abs( CosPhi ) < 0.0001 ) CosPhi = 0.0;
-
-				// For each wavelength, get glass layer properties at this angle of incidence
-				// from properties at normal incidence
+			// The angles are independent of each other and are done in parallel.  Constructions
+			// with the same glass layers share the result (see GlazingOpticsKey).
+
+			StoreKey = GlazingOpticsKey( 1, NGlass, lquasi, AllGlassIsSpectralAverage, lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
+			if ( FindGlazingOptics( StoreKey, 10 * ( 6 + NGlass * ( AllGlassIsSpectralAverage ? 9 : 1 ) ), Record ) ) {
+				Pos = 0;
+				UnpackGlazingOptics( Record, Pos, tsolPhi );
+				UnpackGlazingOptics( Record, Pos, rfsolPhi );
+				UnpackGlazingOptics( Record, Pos, rbsolPhi );
+				UnpackGlazingOptics( Record, Pos, tvisPhi );
+				UnpackGlazingOptics( Record, Pos, rfvisPhi );
+				UnpackGlazingOptics( Record, Pos, rbvisPhi );
 				for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
-					for ( ILam = 1; ILam <= numpt( IGlass ); ++ILam ) {
-
-						TransAndReflAtPhi( CosPhi, t( ILam, IGlass ), rff( ILam, IGlass ), rbb( ILam, IGlass ), tPhi( ILam, IGlass ), rfPhi( ILam, IGlass ), rbPhi( ILam, IGlass ), lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
-					}
-
-					// For use with between-glass shade/blind, save angular properties of isolated glass
-					// for case that all glass layers were input with spectral-average properties
-					//  only used by between-glass shades or blinds
+					UnpackGlazingOptics( Record, Pos, solabsPhi( {1,10}, IGlass ) );
 					if ( AllGlassIsSpectralAverage ) {
-						tBareSolPhi( IPhi, IGlass ) = tPhi( 1, IGlass );
-						tBareVisPhi( IPhi, IGlass ) = tPhi( 2, IGlass );
-						rfBareSolPhi( IPhi, IGlass ) = rfPhi( 1, IGlass );
-						rfBareVisPhi( IPhi, IGlass ) = rfPhi( 2, IGlass );
-						rbBareSolPhi( IPhi, IGlass ) = rbPhi( 1, IGlass );
-						rbBareVisPhi( IPhi, IGlass ) = rbPhi( 2, IGlass );
-						afBareSolPhi( IPhi, IGlass ) = max( 0.0, 1.0 - ( tBareSolPhi( IPhi, IGlass ) + rfBareSolPhi( IPhi, IGlass ) ) );
-						abBareSolPhi( IPhi, IGlass ) = max( 0.0, 1.0 - ( tBareSolPhi( IPhi, IGlass ) + rbBareSolPhi( IPhi, IGlass ) ) );
+						UnpackGlazingOptics( Record, Pos, tBareSolPhi( {1,10}, IGlass ) );
+						UnpackGlazingOptics( Record, Pos, tBareVisPhi( {1,10}, IGlass ) );
+						UnpackGlazingOptics( Record, Pos, rfBareSolPhi( {1,10}, IGlass ) );
+						UnpackGlazingOptics( Record, Pos, rfBareVisPhi( {1,10}, IGlass ) );
+						UnpackGlazingOptics( Record, Pos, rbBareSolPhi( {1,10}, IGlass ) );
+						UnpackGlazingOptics( Record, Pos, rbBareVisPhi( {1,10}, IGlass ) );
+						UnpackGlazingOptics( Record, Pos, afBareSolPhi( {1,10}, IGlass ) );
+						UnpackGlazingOptics( Record, Pos, abBareSolPhi( {1,10}, IGlass ) );
 					}
 				}
+			} else {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+				{
+					SpectralAngleWork Work; // Work arrays of this thread (loop counters are declared in the loop for the same reason)
+#ifdef _OPENMP
+#pragma omp for schedule( static )
+#endif
+					for ( int IPhi = 1; IPhi <= 10; ++IPhi ) {
+						Real64 const Phi( double( IPhi - 1 ) * 10.0 );
+						Real64 CosPhi( std::cos( Phi * DegToRadians ) );
+						if ( std::abs( CosPhi ) < 0.0001 ) CosPhi = 0.0;
+
+						// For each wavelength, get glass layer properties at this angle of incidence
+						// from properties at normal incidence
+						for ( int IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+							for ( int ILam = 1; ILam <= numpt( IGlass ); ++ILam ) {
+
+								TransAndReflAtPhi( CosPhi, t( ILam, IGlass ), rff( ILam, IGlass ), rbb( ILam, IGlass ), Work.tPhi( ILam, IGlass ), Work.rfPhi( ILam, IGlass ), Work.rbPhi( ILam, IGlass ), lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
+							}
 
-				// For each wavelength in the solar spectrum, calculate system properties
-				// stPhi, srfPhi, srbPhi and saPhi at this angle of incidence.
-				// In the following the argument "1" indicates that spectral average solar values
-				// should be used for layers without spectral data.
-				SystemSpectralPropertiesAtPhi( 1, NGlass, 0.0, 2.54 );
+							// For use with between-glass shade/blind, save angular properties of isolated glass
+							// for case that all glass layers were input with spectral-average properties
+							//  only used by between-glass shades or blinds
+							if ( AllGlassIsSpectralAverage ) {
+								tBareSolPhi( IPhi, IGlass ) = Work.tPhi( 1, IGlass );
+								tBareVisPhi( IPhi, IGlass ) = Work.tPhi( 2, IGlass );
+								rfBareSolPhi( IPhi, IGlass ) = Work.rfPhi( 1, IGlass );
+								rfBareVisPhi( IPhi, IGlass ) = Work.rfPhi( 2, IGlass );
+								rbBareSolPhi( IPhi, IGlass ) = Work.rbPhi( 1, IGlass );
+								rbBareVisPhi( IPhi, IGlass ) = Work.rbPhi( 2, IGlass );
+								afBareSolPhi( IPhi, IGlass ) = max( 0.0, 1.0 - ( tBareSolPhi( IPhi, IGlass ) + rfBareSolPhi( IPhi, IGlass ) ) );
+								abBareSolPhi( IPhi, IGlass ) = max( 0.0, 1.0 - ( tBareSolPhi( IPhi, IGlass ) + rbBareSolPhi( IPhi, IGlass ) ) );
+							}
+						}
 
-				// Get solar properties of system by integrating over solar irradiance spectrum.
-				// For now it is assumed that the exterior and interior irradiance spectra are the same.
-				SolarSprectrumAverage( stPhi, tsolPhi( IPhi ) );
-				SolarSprectrumAverage( srfPhi, rfsolPhi( IPhi ) );
-				SolarSprectrumAverage( srbPhi, rbsolPhi( IPhi ) );
+						// For each wavelength in the solar spectrum, calculate system properties
+						// stPhi, srfPhi, srbPhi and saPhi at this angle of incidence.
+						// In the following the argument "1" indicates that spectral average solar values
+						// should be used for layers without spectral data.
+						SystemSpectralPropertiesAtPhi( Work, 1, NGlass, 0.0, 2.54 );
+
+						// Get solar properties of system by integrating over solar irradiance spectrum.
+						// For now it is assumed that the exterior and interior irradiance spectra are the same.
+						SolarSprectrumAverage( Work.stPhi, tsolPhi( IPhi ) );
+						SolarSprectrumAverage( Work.srfPhi, rfsolPhi( IPhi ) );
+						SolarSprectrumAverage( Work.srbPhi, rbsolPhi( IPhi ) );
+
+						for ( int IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+							for ( int ILam = 1; ILam <= nume; ++ILam ) {
+								Work.sabsPhi( ILam ) = Work.saPhi( ILam, IGlass );
+							}
+							SolarSprectrumAverage( Work.sabsPhi, solabsPhi( IPhi, IGlass ) );
+						}
 
-				for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
-					for ( ILam = 1; ILam <= nume; ++ILam ) {
-						sabsPhi( ILam ) = saPhi( ILam, IGlass );
-					}
-					SolarSprectrumAverage( sabsPhi, solabsPhi( IPhi, IGlass ) );
-				}
+						// Get visible properties of system by integrating over solar irradiance
+						// spectrum weighted by photopic response.
+						// Need to redo the calculation of system spectral properties here only if
+						// one or more glass layers have no spectral data (lquasi = .TRUE.); in this
+						// case the spectral average visible properties will be used for the layers
+						// without spectral data, as indicated by the argument "2".
 
-				// Get visible properties of system by integrating over solar irradiance
-				// spectrum weighted by photopic response.
-				// Need to redo the calculation of system spectral properties here only if
-				// one or more glass layers have no spectral data (lquasi = .TRUE.); in this
-				// case the spectral average visible properties will be used for the layers
-				// without spectral data, as indicated by the argument "2".
+						if ( lquasi ) SystemSpectralPropertiesAtPhi( Work, 2, NGlass, 0.37, 0.78 );
+						VisibleSprectrumAverage( Work.stPhi, tvisPhi( IPhi ) );
+						VisibleSprectrumAverage( Work.srfPhi, rfvisPhi( IPhi ) );
+						VisibleSprectrumAverage( Work.srbPhi, rbvisPhi( IPhi ) );
 
-				if ( lquasi ) SystemSpectralPropertiesAtPhi( 2, NGlass, 0.37, 0.78 );
-				VisibleSprectrumAverage( stPhi, tvisPhi( IPhi ) );
-				VisibleSprectrumAverage( srfPhi, rfvisPhi( IPhi ) );
-				VisibleSprectrumAverage( srbPhi, rbvisPhi( IPhi ) );
+					} // End of loop over incidence angles for front calculation
+				}
 
-			} // End of loop over incidence angles for front calculation
+				Record.clear();
+				PackGlazingOptics( tsolPhi, Record );
+				PackGlazingOptics( rfsolPhi, Record );
+				PackGlazingOptics( rbsolPhi, Record );
+				PackGlazingOptics( tvisPhi, Record );
+				PackGlazingOptics( rfvisPhi, Record );
+				PackGlazingOptics( rbvisPhi, Record );
+				for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+					PackGlazingOptics( solabsPhi( {1,10}, IGlass ), Record );
+					if ( AllGlassIsSpectralAverage ) {
+						PackGlazingOptics( tBareSolPhi( {1,10}, IGlass ), Record );
+						PackGlazingOptics( tBareVisPhi( {1,10}, IGlass ), Record );
+						PackGlazingOptics( rfBareSolPhi( {1,10}, IGlass ), Record );
+						PackGlazingOptics( rfBareVisPhi( {1,10}, IGlass ), Record );
+						PackGlazingOptics( rbBareSolPhi( {1,10}, IGlass ), Record );
+						PackGlazingOptics( rbBareVisPhi( {1,10}, IGlass ), Record );
+						PackGlazingOptics( afBareSolPhi( {1,10}, IGlass ), Record );
+						PackGlazingOptics( abBareSolPhi( {1,10}, IGlass ), Record );
+					}
+				}
+				StoreGlazingOptics( StoreKey, Record );
+			}
 
 			//  only used by between-glass shades or blinds
 			if ( AllGlassIsSpectralAverage ) {
@@ -798,35 +883,59 @@ namespace WindowManager {
 			// Get bare glass layer properties, then glazing system properties at each incidence angle.
 			// The glazing system properties include the effect of inter-reflection among glass layers,
 			// but exclude the effect of a shade or blind if present in the construction.
-			for ( IPhi = 1; IPhi <= 10; ++IPhi ) {
-				Phi = double( IPhi - 1 ) * 10.0;
-				CosPhi = std::cos( Phi * DegToRadians );
-				if ( std::abs( CosPhi ) < 0.0001 ) CosPhi = 0.0;
-
-				// For each wavelength, get glass layer properties at this angle of incidence
-				// from properties at normal incidence
+			// As for the front calculation, the angles are done in parallel and the result is shared.
+			StoreKey = GlazingOpticsKey( 2, NGlass, false, false, lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
+			if ( FindGlazingOptics( StoreKey, 10 * NGlass, Record ) ) {
+				Pos = 0;
 				for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
-					for ( ILam = 1; ILam <= numpt( IGlass ); ++ILam ) {
-
-						TransAndReflAtPhi( CosPhi, t( ILam, IGlass ), rff( ILam, IGlass ), rbb( ILam, IGlass ), tPhi( ILam, IGlass ), rfPhi( ILam, IGlass ), rbPhi( ILam, IGlass ), lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
-					}
+					UnpackGlazingOptics( Record, Pos, solabsBackPhi( {1,10}, IGlass ) );
 				}
+			} else {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+				{
+					SpectralAngleWork Work; // Work arrays of this thread (loop counters are declared in the loop for the same reason)
+#ifdef _OPENMP
+#pragma omp for schedule( static )
+#endif
+					for ( int IPhi = 1; IPhi <= 10; ++IPhi ) {
+						Real64 const Phi( double( IPhi - 1 ) * 10.0 );
+						Real64 CosPhi( std::cos( Phi * DegToRadians ) );
+						if ( std::abs( CosPhi ) < 0.0001 ) CosPhi = 0.0;
+
+						// For each wavelength, get glass layer properties at this angle of incidence
+						// from properties at normal incidence
+						for ( int IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+							for ( int ILam = 1; ILam <= numpt( IGlass ); ++ILam ) {
+
+								TransAndReflAtPhi( CosPhi, t( ILam, IGlass ), rff( ILam, IGlass ), rbb( ILam, IGlass ), Work.tPhi( ILam, IGlass ), Work.rfPhi( ILam, IGlass ), Work.rbPhi( ILam, IGlass ), lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
+							}
+						}
 
-				// For each wavelength in the solar spectrum, calculate system properties
-				// stPhi, srfPhi, srbPhi and saPhi at this angle of incidence
-				SystemSpectralPropertiesAtPhi( 1, NGlass, 0.0, 2.54 );
+						// For each wavelength in the solar spectrum, calculate system properties
+						// stPhi, srfPhi, srbPhi and saPhi at this angle of incidence
+						SystemSpectralPropertiesAtPhi( Work, 1, NGlass, 0.0, 2.54 );
 
-				// Get back absorptance properties of system by integrating over solar irradiance spectrum.
-				// For now it is assumed that the exterior and interior irradiance spectra are the same.
+						// Get back absorptance properties of system by integrating over solar irradiance spectrum.
+						// For now it is assumed that the exterior and interior irradiance spectra are the same.
 
-				for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
-					for ( j = 1; j <= nume; ++j ) {
-						sabsPhi( j ) = saPhi( j, IGlass );
-					}
-					SolarSprectrumAverage( sabsPhi, solabsBackPhi( IPhi, IGlass ) );
+						for ( int IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+							for ( int ILam = 1; ILam <= nume; ++ILam ) {
+								Work.sabsPhi( ILam ) = Work.saPhi( ILam, IGlass );
+							}
+							SolarSprectrumAverage( Work.sabsPhi, solabsBackPhi( IPhi, IGlass ) );
+						}
+
+					} // End of loop over incidence angles for back calculation
 				}
 
-			} // End of loop over incidence angles for back calculation
+				Record.clear();
+				for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+					PackGlazingOptics( solabsBackPhi( {1,10}, IGlass ), Record );
+				}
+				StoreGlazingOptics( StoreKey, Record );
+			}
 
 			for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
 				IGlassBack = NGlass - IGlass + 1;
@@ -1394,6 +1503,13 @@ namespace WindowManager {
 			}
 		} // End of surface loop
 
+		if ( NumGlazingOpticsCalculated + NumGlazingOpticsReused + NumGlazingOpticsFromFile > 0 ) {
+			gio::write( OutputFileInits, fmtA ) << "! <Glazing Optics Store>, Calculated, Reused In Run, Read From Cache File, Hit Rate {%}, Cache Status, Cache File, Records Available, Reason";
+			gio::write( OutputFileInits, fmtA ) << "Glazing Optics Store," + RoundSigDigits( NumGlazingOpticsCalculated ) + ',' + RoundSigDigits( NumGlazingOpticsReused ) + ',' + RoundSigDigits( NumGlazingOpticsFromFile ) + ',' + RoundSigDigits( 100.0 * ( NumGlazingOpticsReused + NumGlazingOpticsFromFile ) / ( NumGlazingOpticsCalculated + NumGlazingOpticsReused + NumGlazingOpticsFromFile ), 1 ) + ',' + cCacheStatus[ GlazingOpticsFile.Status ] + ',' + GlazingOpticsFile.FileName + ',' + RoundSigDigits( GlazingOpticsFile.NumRecordsAvailable ) + ',' + GlazingOpticsFile.StatusReason;
+		}
+		CloseRecordFile( GlazingOpticsFile );
+		GlazingOpticsStore.clear();
+
 		ReportGlass();
 
 	}
@@ -1589,8 +1705,165 @@ namespace WindowManager {
 	// WINDOW 5 Optical Calculation Subroutines
 	//****************************************************************************
 
+	std::uint64_t
+	GlazingOpticsKey(
+		int const Side, // 1 for light incident on the front of the glazing, 2 for the back
+		int const NGlass, // Number of glass layers in construction
+		bool const lquasi, // True if one or more glass layers have no spectral data
+		bool const BareGlassProperties, // True if the isolated glass properties are also wanted
+		bool const SimpleGlazingSystem, // True if using simple glazing system block model
+		Real64 const SimpleGlazingSHGC, // SHGC for simple glazing system block model
+		Real64 const SimpleGlazingU // U-factor for simple glazing system block model
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns a hash of everything the bare glass angular properties of a construction depend on,
+		// for the layer properties at normal incidence currently in wlt, t, rff, rbb and numpt.
+
+		// METHODOLOGY EMPLOYED:
+		// The spectral values themselves are hashed rather than material or spectral data set numbers,
+		// so that constructions using different materials with the same data (and the same dirt
+		// correction) also share the result.  Gas fills do not enter the optical calculation.
+
+		using ShadingCache::HashSeed;
+		using ShadingCache::HashValue;
+
+		std::uint64_t Key( HashValue( HashSeed, Side ) );
+		Key = HashValue( Key, NGlass );
+		Key = HashValue( Key, lquasi );
+		Key = HashValue( Key, BareGlassProperties );
+		Key = HashValue( Key, SimpleGlazingSystem );
+		if ( SimpleGlazingSystem ) {
+			Key = HashValue( Key, SimpleGlazingSHGC );
+			Key = HashValue( Key, SimpleGlazingU );
+		}
+		for ( int IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+			Key = HashValue( Key, numpt( IGlass ) );
+			for ( int ILam = 1; ILam <= numpt( IGlass ); ++ILam ) {
+				if ( numpt( IGlass ) > 2 ) Key = HashValue( Key, wlt( ILam, IGlass ) ); // Not used for spectral average layers
+				Key = HashValue( Key, t( ILam, IGlass ) );
+				Key = HashValue( Key, rff( ILam, IGlass ) );
+				Key = HashValue( Key, rbb( ILam, IGlass ) );
+			}
+		}
+		return Key;
+
+	}
+
+	bool
+	FindGlazingOptics(
+		std::uint64_t const StoreKey, // Hash of the glass layer properties (see GlazingOpticsKey)
+		std::size_t const NumValues, // Number of values packed in a record for StoreKey
+		ShadingCache::ShadingRecord & Record
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true, with the packed properties in Record, if the bare glass angular properties
+		// for StoreKey were already found in this run or are in the glazing optics cache file.
+		// A record without exactly NumValues values is a miss, so the properties are calculated.
+
+		auto const Stored( GlazingOpticsStore.find( StoreKey ) );
+		if ( Stored != GlazingOpticsStore.end() && Stored->second.Reals.size() == NumValues ) {
+			Record = Stored->second;
+			++NumGlazingOpticsReused;
+			return true;
+		} else if ( ShadingCache::GetRecord( GlazingOpticsFile, StoreKey, Record ) && Record.Reals.size() == NumValues ) {
+			GlazingOpticsStore[ StoreKey ] = Record;
+			++NumGlazingOpticsFromFile;
+			return true;
+		}
+		return false;
+
+	}
+
+	void
+	StoreGlazingOptics(
+		std::uint64_t const StoreKey, // Hash of the glass layer properties (see GlazingOpticsKey)
+		ShadingCache::ShadingRecord const & Record
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Keeps newly calculated bare glass angular properties for the rest of this run and,
+		// if a glazing optics cache file is open, for later runs.
+
+		++NumGlazingOpticsCalculated;
+		GlazingOpticsStore[ StoreKey ] = Record;
+		if ( GlazingOpticsFile.Status != ShadingCache::CacheDisabled ) ShadingCache::SaveRecord( GlazingOpticsFile, StoreKey, Record );
+
+	}
+
+	void
+	PackGlazingOptics(
+		FArray1S< Real64 > const Values, // Properties at each angle of incidence
+		ShadingCache::ShadingRecord & Record
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Appends the values of a property at each angle of incidence to a glazing optics record.
+
+		for ( int IPhi = Values.l(); IPhi <= Values.u(); ++IPhi ) {
+			Record.Reals.push_back( Values( IPhi ) );
+		}
+
+	}
+
+	void
+	UnpackGlazingOptics(
+		ShadingCache::ShadingRecord const & Record,
+		std::size_t & Pos, // Position of the next value in Record.Reals
+		FArray1S< Real64 > Values // Properties at each angle of incidence
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the values of a property at each angle of incidence from a record made by
+		// PackGlazingOptics, in the order they were packed.
+
+		for ( int IPhi = Values.l(); IPhi <= Values.u(); ++IPhi ) {
+			Values( IPhi ) = Record.Reals[ Pos++ ];
+		}
+
+	}
+
+	//************************************************************************
+
 	void
 	SystemSpectralPropertiesAtPhi(
+		SpectralAngleWork & Work, // Layer properties at this angle of incidence and work arrays
 		int const iquasi, // When there is no spectral data, this is the wavelength
 		int const ngllayer, // Number of glass layers in construction
 		Real64 const wlbot, // Lowest and highest wavelength considered
@@ -1602,7 +1875,7 @@ namespace WindowManager {
 		//       AUTHOR         Adapted by F.Winkelmann from WINDOW 5
 		//                      subroutine opcalc
 		//       DATE WRITTEN   August 1999
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, work arrays passed in so that angles can be done in parallel
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1643,14 +1916,14 @@ namespace WindowManager {
 				// In the following numpt is the number of spectral data points for each layer;
 				// numpt = 2 if there is no spectral data for a layer.
 				if ( numpt( in ) <= 2 ) {
-					tadjPhi( iwl, in ) = tPhi( iquasi, in );
-					rfadjPhi( iwl, in ) = rfPhi( iquasi, in );
-					rbadjPhi( iwl, in ) = rbPhi( iquasi, in );
+					Work.tadjPhi( iwl, in ) = Work.tPhi( iquasi, in );
+					Work.rfadjPhi( iwl, in ) = Work.rfPhi( iquasi, in );
+					Work.rbadjPhi( iwl, in ) = Work.rbPhi( iquasi, in );
 				} else {
 					// Interpolate to get properties at the solar spectrum wavelengths
-					Interpolate( wlt( 1, in ), tPhi( 1, in ), numpt( in ), wl, tadjPhi( iwl, in ) );
-					Interpolate( wlt( 1, in ), rfPhi( 1, in ), numpt( in ), wl, rfadjPhi( iwl, in ) );
-					Interpolate( wlt( 1, in ), rbPhi( 1, in ), numpt( in ), wl, rbadjPhi( iwl, in ) );
+					Interpolate( wlt( 1, in ), Work.tPhi( 1, in ), numpt( in ), wl, Work.tadjPhi( iwl, in ) );
+					Interpolate( wlt( 1, in ), Work.rfPhi( 1, in ), numpt( in ), wl, Work.rfadjPhi( iwl, in ) );
+					Interpolate( wlt( 1, in ), Work.rbPhi( 1, in ), numpt( in ), wl, Work.rbadjPhi( iwl, in ) );
 				}
 			}
 		}
@@ -1662,24 +1935,24 @@ namespace WindowManager {
 
 			// Set diagonal of matrix for subroutine SystemPropertiesAtLambdaAndPhi
 			for ( i = 1; i <= ngllayer; ++i ) {
-				top( i, i ) = tadjPhi( j, i );
-				rfop( i, i ) = rfadjPhi( j, i );
-				rbop( i, i ) = rbadjPhi( j, i );
+				Work.top( i, i ) = Work.tadjPhi( j, i );
+				Work.rfop( i, i ) = Work.rfadjPhi( j, i );
+				Work.rbop( i, i ) = Work.rbadjPhi( j, i );
 			}
 
 			// Calculate glazing system properties
 			if ( ngllayer == 1 ) { // Single-layer system
-				stPhi( j ) = top( 1, 1 );
-				srfPhi( j ) = rfop( 1, 1 );
-				srbPhi( j ) = rbop( 1, 1 );
-				sabsPhi( 1 ) = 1.0 - stPhi( j ) - srfPhi( j );
+				Work.stPhi( j ) = Work.top( 1, 1 );
+				Work.srfPhi( j ) = Work.rfop( 1, 1 );
+				Work.srbPhi( j ) = Work.rbop( 1, 1 );
+				sabsPhi( 1 ) = 1.0 - Work.stPhi( j ) - Work.srfPhi( j );
 			} else { // Multilayer system
 				// Get glazing system properties stPhi, etc., at this wavelength and incidence angle
-				SystemPropertiesAtLambdaAndPhi( ngllayer, stPhi( j ), srfPhi( j ), srbPhi( j ), sabsPhi );
+				SystemPropertiesAtLambdaAndPhi( Work, ngllayer, Work.stPhi( j ), Work.srfPhi( j ), Work.srbPhi( j ), sabsPhi );
 			}
 
 			for ( i = 1; i <= ngllayer; ++i ) {
-				saPhi( j, i ) = sabsPhi( i );
+				Work.saPhi( j, i ) = sabsPhi( i );
 			}
 
 		} // End of wavelength loop
@@ -1690,6 +1963,7 @@ namespace WindowManager {
 
 	void
 	SystemPropertiesAtLambdaAndPhi(
+		SpectralAngleWork & Work, // Diagonals of the op matrices at this wavelength and work arrays
 		int const n, // Number of glass layers
 		Real64 & tt, // System transmittance
 		Real64 & rft, // System front and back reflectance
@@ -1702,7 +1976,7 @@ namespace WindowManager {
 		//       AUTHOR         Adapted by F. Winkelmann from WINDOW 5
 		//                      subroutine op
 		//       DATE WRITTEN   August 1999
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, op matrices passed in with the work arrays
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1738,22 +2012,22 @@ namespace WindowManager {
 		// Calculate perimeter elements of rt matrix
 		for ( i = 1; i <= n - 1; ++i ) {
 			for ( j = i + 1; j <= n; ++j ) {
-				denom = 1.0 - rfop( j, j ) * rbop( j - 1, i );
+				denom = 1.0 - Work.rfop( j, j ) * Work.rbop( j - 1, i );
 				if ( denom == 0.0 ) {
-					top( i, j ) = 0.0;
-					rfop( i, j ) = 1.0;
-					rbop( j, i ) = 1.0;
+					Work.top( i, j ) = 0.0;
+					Work.rfop( i, j ) = 1.0;
+					Work.rbop( j, i ) = 1.0;
 				} else {
-					top( i, j ) = top( i, j - 1 ) * top( j, j ) / denom;
-					rfop( i, j ) = rfop( i, j - 1 ) + pow_2( top( i, j - 1 ) ) * rfop( j, j ) / denom;
-					rbop( j, i ) = rbop( j, j ) + pow_2( top( j, j ) ) * rbop( j - 1, i ) / denom;
+					Work.top( i, j ) = Work.top( i, j - 1 ) * Work.top( j, j ) / denom;
+					Work.rfop( i, j ) = Work.rfop( i, j - 1 ) + pow_2( Work.top( i, j - 1 ) ) * Work.rfop( j, j ) / denom;
+					Work.rbop( j, i ) = Work.rbop( j, j ) + pow_2( Work.top( j, j ) ) * Work.rbop( j - 1, i ) / denom;
 				}
 			}
 		}
 		// System properties: transmittance, front and back reflectance
-		tt = top( 1, n );
-		rft = rfop( 1, n );
-		rbt = rbop( n, 1 );
+		tt = Work.top( 1, n );
+		rft = Work.rfop( 1, n );
+		rbt = Work.rbop( n, 1 );
 
 		// Absorptance in each layer
 		for ( j = 1; j <= n; ++j ) {
@@ -1761,25 +2035,25 @@ namespace WindowManager {
 				t0 = 1.0;
 				rb0 = 0.0;
 			} else {
-				t0 = top( 1, j - 1 );
-				rb0 = rbop( j - 1, 1 );
+				t0 = Work.top( 1, j - 1 );
+				rb0 = Work.rbop( j - 1, 1 );
 			}
 
 			if ( j == n ) {
 				rf0 = 0.0;
 			} else {
-				rf0 = rfop( j + 1, n );
+				rf0 = Work.rfop( j + 1, n );
 			}
 
-			af = 1.0 - top( j, j ) - rfop( j, j );
-			ab = 1.0 - top( j, j ) - rbop( j, j );
-			denom1 = 1.0 - rfop( j, n ) * rb0;
-			denom2 = 1.0 - rbop( j, 1 ) * rf0;
+			af = 1.0 - Work.top( j, j ) - Work.rfop( j, j );
+			ab = 1.0 - Work.top( j, j ) - Work.rbop( j, j );
+			denom1 = 1.0 - Work.rfop( j, n ) * rb0;
+			denom2 = 1.0 - Work.rbop( j, 1 ) * rf0;
 
 			if ( denom1 == 0.0 || denom2 == 0.0 ) {
 				aft( j ) = 0.0;
 			} else {
-				aft( j ) = ( t0 * af ) / denom1 + ( top( 1, j ) * rf0 * ab ) / denom2;
+				aft( j ) = ( t0 * af ) / denom1 + ( Work.top( 1, j ) * rf0 * ab ) / denom2;
 			}
 		}
 	}
@@ -2601,16 +2875,21 @@ namespace WindowManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         F. Winkelmann
 		//       DATE WRITTEN   February 2000
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, same gap conductance as SolveForWindowTemperatures,
+		//                        analytic Jacobian, any number of glass layers
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Evaluates heat balance functions at each glass face.
 		// Also evaluates Jacobian.
-		// Currently limited to three glass layers.
+		// Limited to bare glazing (no shade or blind and no gap airflow).
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// fvec(i) is the net heat gain of glass face i (W/m2), which is zero at the solution of the
+		// equations that SolveForWindowTemperatures iterates on, including its edge-of-glass correction
+		// of the gap conductance. fjac(i,j) is the derivative of fvec(i) with respect to thetas(j); the
+		// gas conductivity and Nusselt number of a gap are held at their values for the current face
+		// temperatures, which leaves the Jacobian tridiagonal.
 
 		// REFERENCES:
 		// na
@@ -2618,81 +2897,179 @@ namespace WindowManager {
 		// Locals
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		FArray1D< Real64 > hgap( 5 ); // Gap gas conductance
+		int Layer; // Glass layer number
+		int i; // Face on the outside of a glass layer or gap
+		int j; // Face on the inside of a glass layer or gap
+		Real64 hgap; // Gap conductance (W/m2-K)
+		Real64 dhgap; // Derivative of gap conductance with respect to each gap face temperature (W/m2-K2)
+		Real64 Agap; // Gap radiative exchange coefficient (A23, A45 or A67)
+		Real64 q; // Heat flow into face i (W/m2)
+		Real64 dqi; // Derivative of q with respect to thetas(i)
+		Real64 dqj; // Derivative of q with respect to thetas(j)
 		Real64 gr; // Gap gas Grashof number
 		Real64 con; // Gap gas conductivity
 		Real64 pr; // Gap gas Prandtl number
 		Real64 nu; // Gap gas Nusselt number
+		Real64 const EdgeGlCorrFac( SurfaceWindow( SurfNum ).EdgeGlCorrFac );
 
 		// FLOW
 
-		// Have to zero fvec each time since LUdecompostion and LUsolution may
-		// add values to this array in unexpected places
+		// Have to zero fvec and fjac each time since LUdecompostion and LUsolution may
+		// add values to these arrays in unexpected places
 		fvec = 0.0;
+		fjac = 0.0;
 
-		{ auto const SELECT_CASE_var( ngllayer );
+		// Absorbed solar and short-wave radiation from lights
+		for ( i = 1; i <= nglface; ++i ) {
+			fvec( i ) = AbsRadGlassFace( i );
+		}
 
-		if ( SELECT_CASE_var == 1 ) { // single pane
-			fvec( 1 ) = Outir * emis( 1 ) - emis( 1 ) * sigma * pow_4( thetas( 1 ) ) + scon( 1 ) * ( thetas( 2 ) - thetas( 1 ) ) + hcout * ( tout - thetas( 1 ) ) + AbsRadGlassFace( 1 );
-			fvec( 2 ) = Rmir * emis( 2 ) - emis( 2 ) * sigma * pow_4( thetas( 2 ) ) + scon( 1 ) * ( thetas( 1 ) - thetas( 2 ) ) + hcin * ( tin - thetas( 2 ) ) + AbsRadGlassFace( 2 );
-
-		} else if ( SELECT_CASE_var == 2 ) { // double pane
-			WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
-			NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
-			hgap( 1 ) = ( con / gap( 1 ) * nu ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac;
-
-			fvec( 1 ) = Outir * emis( 1 ) - emis( 1 ) * sigma * pow_4( thetas( 1 ) ) + scon( 1 ) * ( thetas( 2 ) - thetas( 1 ) ) + hcout * ( tout - thetas( 1 ) ) + AbsRadGlassFace( 1 );
-			Real64 const thetas_2_3_4( pow_4( thetas( 2 ) ) - pow_4( thetas( 3 ) ) );
-			fvec( 2 ) = scon( 1 ) * ( thetas( 1 ) - thetas( 2 ) ) + hgap( 1 ) * ( thetas( 3 ) - thetas( 2 ) ) + A23 * thetas_2_3_4 + AbsRadGlassFace( 2 );
-			fvec( 3 ) = hgap( 1 ) * ( thetas( 2 ) - thetas( 3 ) ) + scon( 2 ) * ( thetas( 4 ) - thetas( 3 ) ) - A23 * thetas_2_3_4 + AbsRadGlassFace( 3 );
-			fvec( 4 ) = Rmir * emis( 4 ) - emis( 4 ) * sigma * pow_4( thetas( 4 ) ) + scon( 2 ) * ( thetas( 3 ) - thetas( 4 ) ) + hcin * ( tin - thetas( 4 ) ) + AbsRadGlassFace( 4 );
-
-		} else if ( SELECT_CASE_var == 3 ) { // Triple Pane
-			WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
-			NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
-			hgap( 1 ) = con / gap( 1 ) * nu * SurfaceWindow( SurfNum ).EdgeGlCorrFac;
-
-			WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr );
-			NusseltNumber( SurfNum, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu );
-			hgap( 2 ) = con / gap( 2 ) * nu * SurfaceWindow( SurfNum ).EdgeGlCorrFac;
-
-			Real64 const thetas_2_3_4( pow_4( thetas( 2 ) ) - pow_4( thetas( 3 ) ) );
-			Real64 const thetas_4_5_4( pow_4( thetas( 4 ) ) - pow_4( thetas( 5 ) ) );
-			fvec( 1 ) = Outir * emis( 1 ) - emis( 1 ) * sigma * pow_4( thetas( 1 ) ) + scon( 1 ) * ( thetas( 2 ) - thetas( 1 ) ) + hcout * ( tout - thetas( 1 ) ) + AbsRadGlassFace( 1 );
-			fvec( 2 ) = scon( 1 ) * ( thetas( 1 ) - thetas( 2 ) ) + hgap( 1 ) * ( thetas( 3 ) - thetas( 2 ) ) + A23 * thetas_2_3_4 + AbsRadGlassFace( 2 );
-			fvec( 3 ) = hgap( 1 ) * ( thetas( 2 ) - thetas( 3 ) ) + scon( 2 ) * ( thetas( 4 ) - thetas( 3 ) ) - A23 * thetas_2_3_4 + AbsRadGlassFace( 3 );
-			fvec( 4 ) = scon( 2 ) * ( thetas( 3 ) - thetas( 4 ) ) + hgap( 2 ) * ( thetas( 5 ) - thetas( 4 ) ) + A45 * thetas_4_5_4 + AbsRadGlassFace( 4 );
-			fvec( 5 ) = hgap( 2 ) * ( thetas( 4 ) - thetas( 5 ) ) + scon( 3 ) * ( thetas( 6 ) - thetas( 5 ) ) - A45 * thetas_4_5_4 + AbsRadGlassFace( 5 );
-			fvec( 6 ) = Rmir * emis( 6 ) - emis( 6 ) * sigma * pow_4( thetas( 6 ) ) + scon( 3 ) * ( thetas( 5 ) - thetas( 6 ) ) + hcin * ( tin - thetas( 6 ) ) + AbsRadGlassFace( 6 );
-
-		} else if ( SELECT_CASE_var == 4 ) { // Quad Pane
-			WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
-			NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
-			hgap( 1 ) = con / gap( 1 ) * nu * SurfaceWindow( SurfNum ).EdgeGlCorrFac;
-
-			WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr );
-			NusseltNumber( SurfNum, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu );
-			hgap( 2 ) = con / gap( 2 ) * nu * SurfaceWindow( SurfNum ).EdgeGlCorrFac;
-
-			WindowGasConductance( thetas( 6 ), thetas( 7 ), 3, con, pr, gr );
-			NusseltNumber( SurfNum, thetas( 6 ), thetas( 7 ), 3, gr, pr, nu );
-			hgap( 3 ) = con / gap( 3 ) * nu * SurfaceWindow( SurfNum ).EdgeGlCorrFac;
-
-			Real64 const thetas_2_3_4( pow_4( thetas( 2 ) ) - pow_4( thetas( 3 ) ) );
-			Real64 const thetas_4_5_4( pow_4( thetas( 4 ) ) - pow_4( thetas( 5 ) ) );
-			Real64 const thetas_6_7_4( pow_4( thetas( 6 ) ) - pow_4( thetas( 7 ) ) );
-			fvec( 1 ) = Outir * emis( 1 ) - emis( 1 ) * sigma * pow_4( thetas( 1 ) ) + scon( 1 ) * ( thetas( 2 ) - thetas( 1 ) ) + hcout * ( tout - thetas( 1 ) ) + AbsRadGlassFace( 1 );
-			fvec( 2 ) = scon( 1 ) * ( thetas( 1 ) - thetas( 2 ) ) + hgap( 1 ) * ( thetas( 3 ) - thetas( 2 ) ) + A23 * thetas_2_3_4 + AbsRadGlassFace( 2 );
-			fvec( 3 ) = hgap( 1 ) * ( thetas( 2 ) - thetas( 3 ) ) + scon( 2 ) * ( thetas( 4 ) - thetas( 3 ) ) - A23 * thetas_2_3_4 + AbsRadGlassFace( 3 );
-			fvec( 4 ) = scon( 2 ) * ( thetas( 3 ) - thetas( 4 ) ) + hgap( 2 ) * ( thetas( 5 ) - thetas( 4 ) ) + A45 * thetas_4_5_4 + AbsRadGlassFace( 4 );
-			fvec( 5 ) = hgap( 2 ) * ( thetas( 4 ) - thetas( 5 ) ) + scon( 3 ) * ( thetas( 6 ) - thetas( 5 ) ) - A45 * thetas_4_5_4 + AbsRadGlassFace( 5 );
-			fvec( 6 ) = scon( 3 ) * ( thetas( 5 ) - thetas( 6 ) ) + hgap( 3 ) * ( thetas( 7 ) - thetas( 6 ) ) + A67 * thetas_6_7_4 + AbsRadGlassFace( 6 );
-			fvec( 7 ) = hgap( 3 ) * ( thetas( 6 ) - thetas( 7 ) ) + scon( 4 ) * ( thetas( 8 ) - thetas( 7 ) ) - A67 * thetas_6_7_4 + AbsRadGlassFace( 7 );
-			fvec( 8 ) = Rmir * emis( 8 ) - emis( 8 ) * sigma * pow_4( thetas( 8 ) ) + scon( 4 ) * ( thetas( 7 ) - thetas( 8 ) ) + hcin * ( tin - thetas( 8 ) ) + AbsRadGlassFace( 8 );
-		}}
+		// Outside face: long-wave exchange with the surroundings and convection to outside air
+		fvec( 1 ) += Outir * emis( 1 ) - emis( 1 ) * sigma * pow_4( thetas( 1 ) ) + hcout * ( tout - thetas( 1 ) );
+		fjac( 1, 1 ) = -4.0 * emis( 1 ) * sigma * pow_3( thetas( 1 ) ) - hcout;
+
+		// Inside face: long-wave exchange with the zone and convection to zone air
+		fvec( nglface ) += Rmir * emis( nglface ) - emis( nglface ) * sigma * pow_4( thetas( nglface ) ) + hcin * ( tin - thetas( nglface ) );
+		fjac( nglface, nglface ) += -4.0 * emis( nglface ) * sigma * pow_3( thetas( nglface ) ) - hcin;
+
+		for ( Layer = 1; Layer <= ngllayer; ++Layer ) {
+			// Conduction through the glass layer
+			i = 2 * Layer - 1;
+			j = 2 * Layer;
+			q = scon( Layer ) * ( thetas( j ) - thetas( i ) );
+			fvec( i ) += q;
+			fvec( j ) -= q;
+			fjac( i, i ) -= scon( Layer );
+			fjac( i, j ) += scon( Layer );
+			fjac( j, i ) += scon( Layer );
+			fjac( j, j ) -= scon( Layer );
+
+			if ( Layer == ngllayer ) break;
+
+			// Convection and long-wave exchange across the gap on the inside of the layer
+			i = 2 * Layer;
+			j = 2 * Layer + 1;
+			if ( Layer == 1 ) {
+				Agap = A23;
+			} else if ( Layer == 2 ) {
+				Agap = A45;
+			} else {
+				Agap = A67;
+			}
+			WindowGasConductance( thetas( i ), thetas( j ), Layer, con, pr, gr );
+			NusseltNumber( SurfNum, thetas( i ), thetas( j ), Layer, gr, pr, nu );
+			hgap = con / gap( Layer ) * nu;
+			dhgap = 0.0;
+			if ( EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
+				hrgap( Layer ) = 0.5 * std::abs( Agap ) * pow_3( thetas( i ) + thetas( j ) );
+				hgap = hgap * EdgeGlCorrFac + hrgap( Layer ) * ( EdgeGlCorrFac - 1.0 );
+				dhgap = 1.5 * std::abs( Agap ) * pow_2( thetas( i ) + thetas( j ) ) * ( EdgeGlCorrFac - 1.0 );
+			}
+			q = hgap * ( thetas( j ) - thetas( i ) ) + Agap * ( pow_4( thetas( i ) ) - pow_4( thetas( j ) ) );
+			dqi = -hgap + dhgap * ( thetas( j ) - thetas( i ) ) + 4.0 * Agap * pow_3( thetas( i ) );
+			dqj = hgap + dhgap * ( thetas( j ) - thetas( i ) ) - 4.0 * Agap * pow_3( thetas( j ) );
+			fvec( i ) += q;
+			fvec( j ) -= q;
+			fjac( i, i ) += dqi;
+			fjac( i, j ) += dqj;
+			fjac( j, i ) -= dqi;
+			fjac( j, j ) -= dqj;
+		}
+
+	}
+
+	//****************************************************************************
+
+	void
+	SolveForWindowTemperaturesNewton(
+		int const SurfNum, // Surface number
+		int & Iterations, // Number of heat balance evaluations
+		bool & Converged // True if the face heat balances were met
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the glass face temperatures of bare glazing with Newton's method, starting from the
+		// temperatures set by StartingWindowTemps (the previous time step values after the first).
+
+		// METHODOLOGY EMPLOYED:
+		// Each iteration evaluates the face heat balances and their Jacobian (WindowHeatBalanceEquations)
+		// and solves for the Newton step by LU decomposition. Steps are limited to MaxStep at any face.
+		// The iteration stops when the largest face heat balance residual is below ResidualTol. The
+		// inside film coefficient is updated each iteration as in SolveForWindowTemperatures.
+		// If the residual has not come down after MaxNewtonIterations the caller falls back to
+		// the damped iteration.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using ConvectionCoefficients::CalcISO15099WindowIntConvCoeff;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const MaxNewtonIterations( 20 ); // Maximum allowed number of iterations
+		Real64 const ResidualTol( 0.01 ); // Tolerance on the largest face heat balance residual (W/m2)
+		Real64 const MaxStep( 20.0 ); // Largest change of a face temperature in one iteration (K)
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int i; // Face counter
+		int ZoneNum; // Zone number corresponding to SurfNum
+		Real64 Residual; // Largest face heat balance residual (W/m2)
+		Real64 StepSize; // Largest face temperature change of the Newton step (K)
+		Real64 d; // +1 if number of row interchanges is even, -1 if odd (in LU decomposition)
+		static FArray1D_int indx( 10 ); // Vector of row permutations in LU decomposition
+		static FArray1D< Real64 > Step( 10 ); // Newton step in face temperatures (K)
+
+		ZoneNum = Surface( SurfNum ).Zone;
+		Converged = false;
+		Iterations = 0;
+		while ( Iterations < MaxNewtonIterations ) {
+
+			// call for new interior film coeff (since it is temperature dependent) if using Detailed inside coef model
+			if ( ( ( Surface( SurfNum ).IntConvCoeff == 0 ) && ( Zone( ZoneNum ).InsideConvectionAlgo == ASHRAETARP ) ) || ( Surface( SurfNum ).IntConvCoeff == -2 ) ) {
+				CalcISO15099WindowIntConvCoeff( SurfNum, thetas( nglface ) - KelvinConv, tin - KelvinConv );
+				hcin = HConvIn( SurfNum );
+			}
+
+			++Iterations;
+			WindowHeatBalanceEquations( SurfNum );
+			Residual = 0.0;
+			for ( i = 1; i <= nglface; ++i ) {
+				Residual = max( Residual, std::abs( fvec( i ) ) );
+			}
+			SurfaceWindow( SurfNum ).WindowCalcResidualRep = Residual;
+			if ( Residual <= ResidualTol ) {
+				Converged = true;
+				break;
+			}
+
+			for ( i = 1; i <= nglface; ++i ) {
+				Step( i ) = -fvec( i );
+			}
+			LUdecomposition( fjac, nglface, indx, d ); // Note that these routines change fjac;
+			LUsolution( fjac, nglface, indx, Step ); // the Newton step is returned in Step
+
+			StepSize = 0.0;
+			for ( i = 1; i <= nglface; ++i ) {
+				StepSize = max( StepSize, std::abs( Step( i ) ) );
+			}
+			Real64 const StepFac( ( StepSize > MaxStep ) ? MaxStep / StepSize : 1.0 );
+			for ( i = 1; i <= nglface; ++i ) {
+				thetasPrev( i ) = thetas( i );
+				thetas( i ) += StepFac * Step( i );
+			}
+
+		}
 
 	}
 
+
 	//****************************************************************************
 
 	void
@@ -2727,6 +3104,7 @@ namespace WindowManager {
 		//                      May 2006, RR: add exterior window screen
 		//                      January 2009, BG: inserted call to recalc inside face convection inside iteration loop
 		//                        per ISO 15099 Section 8.3.2.2
+		//                      October 2026: solve bare glazing with Newton's method if WindowNewtonSolver
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2758,6 +3136,8 @@ namespace WindowManager {
 		// The Aface and Bface coefficients are determined by the equations for
 		// heat balance at the glass and shade/blind faces. The system of linear equations is solved
 		// by LU decomposition.
+		// With WindowNewtonSolver, bare glazing is solved by SolveForWindowTemperaturesNewton instead;
+		// the iteration here is only done if that does not converge.
 
 		// REFERENCES:
 		// na
@@ -2878,8 +3258,11 @@ namespace WindowManager {
 		//unused REAL(r64)         :: MassFlow              ! Mass flow of air from window gap entering fan (kg/s)
 		Real64 ZoneTemp; // Zone air temperature (C)
 		int InsideFaceIndex; // intermediate variable for index of inside face in thetas
+		int NewtonIter; // Number of iterations of SolveForWindowTemperaturesNewton
+		bool NewtonConverged; // True if SolveForWindowTemperaturesNewton converged
 
 		iter = 0;
+		NewtonIter = 0;
 		ConvHeatFlowNatural = 0.0;
 		ConvHeatFlowForced = 0.0;
 		nglfacep = nglface;
@@ -2920,6 +3303,18 @@ namespace WindowManager {
 		// Calculate radiative conductances
 
 		errtemp = errtemptol * 2.0;
+		TAirflowGapOutlet = 0.0;
+		SurfaceWindow( SurfNum ).WindowCalcResidualRep = 0.0;
+
+		if ( WindowNewtonSolver && nglfacep == nglface && SurfaceWindow( SurfNum ).AirflowThisTS == 0.0 ) {
+			SolveForWindowTemperaturesNewton( SurfNum, NewtonIter, NewtonConverged );
+			SurfaceWindow( SurfNum ).WindowCalcIterationsRep = NewtonIter;
+			if ( NewtonConverged ) {
+				errtemp = 0.0;
+			} else {
+				StartingWindowTemps( SurfNum, AbsRadShadeFace );
+			}
+		}
 
 		while ( iter < MaxIterations && errtemp > errtemptol ) {
 
@@ -2985,7 +3380,7 @@ namespace WindowManager {
 			}
 
 			++iter;
-			SurfaceWindow( SurfNum ).WindowCalcIterationsRep = iter;
+			SurfaceWindow( SurfNum ).WindowCalcIterationsRep = NewtonIter + iter;
 
 			// Calculations based on number of glass layers
 			{ auto const SELECT_CASE_var( ngllayer );
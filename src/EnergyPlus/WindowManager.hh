@@ -1,6 +1,9 @@
 #ifndef WindowManager_hh_INCLUDED
 #define WindowManager_hh_INCLUDED
 
+// C++ Headers
+#include <cstdint>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
 #include <ObjexxFCL/FArray2A.hh>
@@ -8,6 +11,8 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <DataHeatBalance.hh>
+#include <ShadingCache.hh>
 
 namespace EnergyPlus {
 
@@ -107,22 +112,8 @@ namespace WindowManager {
 	extern FArray2D< Real64 > t; // normal transmittance
 	extern FArray2D< Real64 > rff; // normal front reflectance
 	extern FArray2D< Real64 > rbb; // normal back reflectance
-	extern FArray2D< Real64 > tPhi; // transmittance at angle of incidence
-	extern FArray2D< Real64 > rfPhi; // front reflectance at angle of incidence
-	extern FArray2D< Real64 > rbPhi; // back reflectance at angle of incidence
-	extern FArray2D< Real64 > tadjPhi; // transmittance at angle of incidence
-	extern FArray2D< Real64 > rfadjPhi; // front reflectance at angle of incidence
-	extern FArray2D< Real64 > rbadjPhi; // back reflectance at angle of incidence
 
 	extern FArray1D_int numpt; // Number of spectral data wavelengths for each layer; =2 if no spectra data for a layer
-	extern FArray1D< Real64 > stPhi; // Glazing system transmittance at angle of incidence for each wavelength in wle
-	extern FArray1D< Real64 > srfPhi; // Glazing system front reflectance at angle of incidence for each wavelength in wle
-	extern FArray1D< Real64 > srbPhi; // Glazing system back reflectance at angle of incidence for each wavelenth in wle
-	extern FArray2D< Real64 > saPhi; // For each layer, glazing system absorptance at angle of incidence
-	// for each wavelenth in wle
-	extern FArray2D< Real64 > top; // Transmittance matrix for subr. op
-	extern FArray2D< Real64 > rfop; // Front reflectance matrix for subr. op
-	extern FArray2D< Real64 > rbop; // Back transmittance matrix for subr. op
 	extern FArray1D< Real64 > IndepVarCurveFit; // Values of independent variable (cos of inc. angle) for curve fit
 	extern FArray1D< Real64 > DepVarCurveFit; // Values of dependent variable corresponding to IndepVarCurveFit values
 	extern FArray1D< Real64 > CoeffsCurveFit; // Polynomial coefficients from curve fit
@@ -136,6 +127,50 @@ namespace WindowManager {
 	extern FArray1D< Real64 > rfvisPhi; // Glazing system visible front reflectance for each angle of incidence
 	extern FArray1D< Real64 > rbvisPhi; // Glazing system visible back reflectance for each angle of incidence
 	extern FArray1D< Real64 > CosPhiIndepVar; // Cos of incidence angles at 10-deg increments for curve fits
+	extern int NumGlazingOpticsCalculated; // Bare glass angular properties integrated over the spectrum
+	extern int NumGlazingOpticsReused; // Bare glass angular properties copied from identical glass layers
+	extern int NumGlazingOpticsFromFile; // Bare glass angular properties read from the glazing optics cache file
+
+	// Types
+
+	struct SpectralAngleWork // Work arrays for the glazing system properties at one angle of incidence
+	{
+		// Members
+		FArray2D< Real64 > tPhi; // transmittance at angle of incidence
+		FArray2D< Real64 > rfPhi; // front reflectance at angle of incidence
+		FArray2D< Real64 > rbPhi; // back reflectance at angle of incidence
+		FArray2D< Real64 > tadjPhi; // transmittance at angle of incidence for each wavelength in wle
+		FArray2D< Real64 > rfadjPhi; // front reflectance at angle of incidence for each wavelength in wle
+		FArray2D< Real64 > rbadjPhi; // back reflectance at angle of incidence for each wavelength in wle
+		FArray1D< Real64 > stPhi; // Glazing system transmittance at angle of incidence for each wavelength in wle
+		FArray1D< Real64 > srfPhi; // Glazing system front reflectance at angle of incidence for each wavelength in wle
+		FArray1D< Real64 > srbPhi; // Glazing system back reflectance at angle of incidence for each wavelenth in wle
+		FArray2D< Real64 > saPhi; // For each layer, glazing system absorptance at angle of incidence
+		// for each wavelenth in wle
+		FArray1D< Real64 > sabsPhi; // Glazing system absorptance of one glass layer for each wavelength in wle
+		FArray2D< Real64 > top; // Transmittance matrix for subr. op
+		FArray2D< Real64 > rfop; // Front reflectance matrix for subr. op
+		FArray2D< Real64 > rbop; // Back transmittance matrix for subr. op
+
+		// Default Constructor
+		SpectralAngleWork() :
+			tPhi( DataHeatBalance::MaxSpectralDataElements, 5, 0.0 ),
+			rfPhi( DataHeatBalance::MaxSpectralDataElements, 5, 0.0 ),
+			rbPhi( DataHeatBalance::MaxSpectralDataElements, 5, 0.0 ),
+			tadjPhi( nume, 5, 0.0 ),
+			rfadjPhi( nume, 5, 0.0 ),
+			rbadjPhi( nume, 5, 0.0 ),
+			stPhi( nume, 0.0 ),
+			srfPhi( nume, 0.0 ),
+			srbPhi( nume, 0.0 ),
+			saPhi( nume, 5, 0.0 ),
+			sabsPhi( nume, 0.0 ),
+			top( 5, 5, 0.0 ),
+			rfop( 5, 5, 0.0 ),
+			rbop( 5, 5, 0.0 )
+		{}
+
+	};
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowManager:
 	//   Optical Calculation Routines
@@ -155,8 +190,46 @@ namespace WindowManager {
 	// WINDOW 5 Optical Calculation Subroutines
 	//****************************************************************************
 
+	std::uint64_t
+	GlazingOpticsKey(
+		int const Side, // 1 for light incident on the front of the glazing, 2 for the back
+		int const NGlass, // Number of glass layers in construction
+		bool const lquasi, // True if one or more glass layers have no spectral data
+		bool const BareGlassProperties, // True if the isolated glass properties are also wanted
+		bool const SimpleGlazingSystem, // True if using simple glazing system block model
+		Real64 const SimpleGlazingSHGC, // SHGC for simple glazing system block model
+		Real64 const SimpleGlazingU // U-factor for simple glazing system block model
+	);
+
+	bool
+	FindGlazingOptics(
+		std::uint64_t const StoreKey, // Hash of the glass layer properties (see GlazingOpticsKey)
+		std::size_t const NumValues, // Number of values packed in a record for StoreKey
+		ShadingCache::ShadingRecord & Record
+	);
+
+	void
+	StoreGlazingOptics(
+		std::uint64_t const StoreKey, // Hash of the glass layer properties (see GlazingOpticsKey)
+		ShadingCache::ShadingRecord const & Record
+	);
+
+	void
+	PackGlazingOptics(
+		FArray1S< Real64 > const Values, // Properties at each angle of incidence
+		ShadingCache::ShadingRecord & Record
+	);
+
+	void
+	UnpackGlazingOptics(
+		ShadingCache::ShadingRecord const & Record,
+		std::size_t & Pos, // Position of the next value in Record.Reals
+		FArray1S< Real64 > Values // Properties at each angle of incidence
+	);
+
 	void
 	SystemSpectralPropertiesAtPhi(
+		SpectralAngleWork & Work, // Layer properties at this angle of incidence and work arrays
 		int const iquasi, // When there is no spectral data, this is the wavelength
 		int const ngllayer, // Number of glass layers in construction
 		Real64 const wlbot, // Lowest and highest wavelength considered
@@ -167,6 +240,7 @@ namespace WindowManager {
 
 	void
 	SystemPropertiesAtLambdaAndPhi(
+		SpectralAngleWork & Work, // Diagonals of the op matrices at this wavelength and work arrays
 		int const n, // Number of glass layers
 		Real64 & tt, // System transmittance
 		Real64 & rft, // System front and back reflectance
@@ -220,6 +294,15 @@ namespace WindowManager {
 
 	//****************************************************************************
 
+	void
+	SolveForWindowTemperaturesNewton(
+		int const SurfNum, // Surface number
+		int & Iterations, // Number of heat balance evaluations
+		bool & Converged // True if the face heat balances were met
+	);
+
+	//****************************************************************************
+
 	void
 	SolveForWindowTemperatures( int const SurfNum ); // Surface number
 
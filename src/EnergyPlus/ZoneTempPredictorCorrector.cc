@@ -164,6 +164,29 @@ namespace ZoneTempPredictorCorrector {
 	FArray1D< Real64 > TempDepZnLd;
 	FArray1D< Real64 > ZoneAirRelHum; // Zone relative humidity in percent
 
+	// Heat balance sums of each zone from the predict step
+	FArray1D< Real64 > ZoneSumIntGain; // Zone sum of convective internal gains
+	FArray1D< Real64 > ZoneSumHA; // Zone sum of Hc*Area
+	FArray1D< Real64 > ZoneSumHATsurf; // Zone sum of Hc*Area*Tsurf
+	FArray1D< Real64 > ZoneSumHATref; // Zone sum of Hc*Area*Tref, for ceiling diffuser convection correlation
+	FArray1D< Real64 > ZoneSumMCp; // Zone sum of MassFlowRate*Cp
+	FArray1D< Real64 > ZoneSumMCpT; // Zone sum of MassFlowRate*Cp*T
+	FArray1D< Real64 > ZoneSumSysMCp; // Zone sum of air system MassFlowRate*Cp
+	FArray1D< Real64 > ZoneSumSysMCpT; // Zone sum of air system MassFlowRate*Cp*T
+
+	// Air supplied to each zone
+	FArray1D_int ZoneEquipConfigNumOfZone; // Controlled zone equipment configuration, 0 if none
+	FArray1D_int ZoneRetPlenumNumOfZone; // Return plenum in the zone, 0 if none
+	FArray1D_int ZoneSupPlenumNumOfZone; // Supply plenum in the zone, 0 if none
+
+	namespace {
+		// Sizes of the zone, equipment and plenum input when the air supply tables were built
+		int ZoneAirSourcesNumZones( -1 );
+		int ZoneAirSourcesNumEquipConfigs( -1 );
+		int ZoneAirSourcesNumRetPlenums( -1 );
+		int ZoneAirSourcesNumSupPlenums( -1 );
+	}
+
 	// Zone temperature history - used only for oscillation test
 	FArray2D< Real64 > ZoneTempHist;
 	FArray1D< Real64 > ZoneTempOscillate;
@@ -183,6 +206,18 @@ namespace ZoneTempPredictorCorrector {
 
 	// Functions
 
+	void
+	clear_state()
+	{
+		ZoneEquipConfigNumOfZone.deallocate();
+		ZoneRetPlenumNumOfZone.deallocate();
+		ZoneSupPlenumNumOfZone.deallocate();
+		ZoneAirSourcesNumZones = -1;
+		ZoneAirSourcesNumEquipConfigs = -1;
+		ZoneAirSourcesNumRetPlenums = -1;
+		ZoneAirSourcesNumSupPlenums = -1;
+	}
+
 	void
 	ManageZoneAirUpdates(
 		int const UpdateType, // Can be iGetZoneSetPoints, iPredictStep, iCorrectStep
@@ -2005,6 +2040,14 @@ namespace ZoneTempPredictorCorrector {
 			WZoneTimeMinusP.dimension( NumOfZones, 0.0 );
 			TempIndZnLd.dimension( NumOfZones, 0.0 );
 			TempDepZnLd.dimension( NumOfZones, 0.0 );
+			ZoneSumIntGain.dimension( NumOfZones, 0.0 );
+			ZoneSumHA.dimension( NumOfZones, 0.0 );
+			ZoneSumHATsurf.dimension( NumOfZones, 0.0 );
+			ZoneSumHATref.dimension( NumOfZones, 0.0 );
+			ZoneSumMCp.dimension( NumOfZones, 0.0 );
+			ZoneSumMCpT.dimension( NumOfZones, 0.0 );
+			ZoneSumSysMCp.dimension( NumOfZones, 0.0 );
+			ZoneSumSysMCpT.dimension( NumOfZones, 0.0 );
 			NonAirSystemResponse.dimension( NumOfZones, 0.0 );
 			SysDepZoneLoads.dimension( NumOfZones, 0.0 );
 			SysDepZoneLoadsLagged.dimension( NumOfZones, 0.0 );
@@ -2402,7 +2445,7 @@ namespace ZoneTempPredictorCorrector {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Russ Taylor
 		//       DATE WRITTEN   May 1997
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, zone sums gathered into arrays before the coefficient pass
 		//       RE-ENGINEERED  July 2003 (Peter Graham Ellis)
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2488,14 +2531,6 @@ namespace ZoneTempPredictorCorrector {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 SumIntGain; // Zone sum of convective internal gains
-		Real64 SumHA; // Zone sum of Hc*Area
-		Real64 SumHATsurf; // Zone sum of Hc*Area*Tsurf
-		Real64 SumHATref; // Zone sum of Hc*Area*Tref, for ceiling diffuser convection correlation
-		Real64 SumMCp; // Zone sum of MassFlowRate*Cp
-		Real64 SumMCpT; // Zone sum of MassFlowRate*Cp*T
-		Real64 SumSysMCp; // Zone sum of air system MassFlowRate*Cp
-		Real64 SumSysMCpT; // Zone sum of air system MassFlowRate*Cp*T
 		Real64 TempDepCoef; // Formerly CoefSumha
 		Real64 TempIndCoef; // Formerly CoefSumhat
 		Real64 AirCap; // Formerly CoefAirrat
@@ -2567,14 +2602,6 @@ namespace ZoneTempPredictorCorrector {
 			}
 		}
 
-		//Tuned Precompute controlled equip zone numbers for performance
-		std::vector< int > controlledZoneEquipConfigNums;
-		for ( int ZoneEquipConfigNum = 1; ZoneEquipConfigNum <= NumOfZones; ++ZoneEquipConfigNum ) {
-			if ( Zone( ZoneEquipConfigNum ).IsControlled ) {
-				controlledZoneEquipConfigNums.push_back( ZoneEquipConfigNum );
-			}
-		}
-
 		// Update zone temperatures
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
@@ -2637,34 +2664,31 @@ namespace ZoneTempPredictorCorrector {
 			}
 
 			AIRRAT( ZoneNum ) = Zone( ZoneNum ).Volume * ZoneVolCapMultpSens * PsyRhoAirFnPbTdbW( OutBaroPress, MAT( ZoneNum ), ZoneAirHumRat( ZoneNum ) ) * PsyCpAirFnWTdb( ZoneAirHumRat( ZoneNum ), MAT( ZoneNum ) ) / ( TimeStepSys * SecInHour );
-			AirCap = AIRRAT( ZoneNum );
 
 			// Calculate the various heat balance sums
 
 			// NOTE: SumSysMCp and SumSysMCpT are not used in the predict step
-			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT, controlledZoneEquipConfigNums );
+			CalcZoneSums( ZoneNum, ZoneSumIntGain( ZoneNum ), ZoneSumHA( ZoneNum ), ZoneSumHATsurf( ZoneNum ), ZoneSumHATref( ZoneNum ), ZoneSumMCp( ZoneNum ), ZoneSumMCpT( ZoneNum ), ZoneSumSysMCp( ZoneNum ), ZoneSumSysMCpT( ZoneNum ) );
 
-			TempDepCoef = SumHA + SumMCp;
-			TempIndCoef = SumIntGain + SumHATsurf - SumHATref + SumMCpT + SysDepZoneLoadsLagged( ZoneNum );
-			if ( AirModel( ZoneNum ).AirModelType == RoomAirModel_Mixing ) {
-				TempHistoryTerm = AirCap * ( 3.0 * ZTM1( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( ZoneNum ) );
-				TempDepZnLd( ZoneNum ) = ( 11.0 / 6.0 ) * AirCap + TempDepCoef;
-				TempIndZnLd( ZoneNum ) = TempHistoryTerm + TempIndCoef;
-			} else if ( IsZoneDV( ZoneNum ) ) {
-				// UCSD displacement ventilation model - make dynamic term independent of TimeStepSys
-				TempHistoryTerm = AirCap * ( 3.0 * ZTM1( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( ZoneNum ) );
-				TempDepZnLd( ZoneNum ) = ( 11.0 / 6.0 ) * AirCap + TempDepCoef;
-				TempIndZnLd( ZoneNum ) = TempHistoryTerm + TempIndCoef;
-			} else if ( IsZoneUI( ZoneNum ) ) {
-				// UCSD UFAD model - make dynamic term independent of TimeStepSys
-				TempHistoryTerm = AirCap * ( 3.0 * ZTM1( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( ZoneNum ) );
-				TempDepZnLd( ZoneNum ) = ( 11.0 / 6.0 ) * AirCap + TempDepCoef;
-				TempIndZnLd( ZoneNum ) = TempHistoryTerm + TempIndCoef;
-			} else { // other imperfectly mixed room models
+		}
+
+		// Heat balance coefficients of all zones in one pass over the zone arrays
+		// The room air models all use the mixed air coefficients here
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			TempDepCoef = ZoneSumHA( ZoneNum ) + ZoneSumMCp( ZoneNum );
+			TempIndCoef = ZoneSumIntGain( ZoneNum ) + ZoneSumHATsurf( ZoneNum ) - ZoneSumHATref( ZoneNum ) + ZoneSumMCpT( ZoneNum ) + SysDepZoneLoadsLagged( ZoneNum );
+			if ( ZoneAirSolutionAlgo == Use3rdOrder ) {
+				AirCap = AIRRAT( ZoneNum );
 				TempHistoryTerm = AirCap * ( 3.0 * ZTM1( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( ZoneNum ) );
 				TempDepZnLd( ZoneNum ) = ( 11.0 / 6.0 ) * AirCap + TempDepCoef;
 				TempIndZnLd( ZoneNum ) = TempHistoryTerm + TempIndCoef;
+			} else { // Exact solution or Euler method
+				TempDepZnLd( ZoneNum ) = TempDepCoef;
+				TempIndZnLd( ZoneNum ) = TempIndCoef;
 			}
+		}
+
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
 			// Exact solution or Euler method
 			ShortenTimeStepSysRoomAir = false;
@@ -2682,8 +2706,6 @@ namespace ZoneTempPredictorCorrector {
 					ZoneT1( ZoneNum ) = ZT( ZoneNum );
 					ZoneW1( ZoneNum ) = ZoneAirHumRat( ZoneNum );
 				}
-				TempDepZnLd( ZoneNum ) = TempDepCoef;
-				TempIndZnLd( ZoneNum ) = TempIndCoef;
 			}
 
 			// Calculate the predicted zone load to be provided by the system with the given desired zone air temperature
@@ -3648,14 +3670,6 @@ namespace ZoneTempPredictorCorrector {
 		// Initializations
 		ZoneTempChange = constant_zero;
 
-		//Tuned Precompute controlled equip zone numbers for performance
-		std::vector< int > controlledZoneEquipConfigNums;
-		for ( int ZoneEquipConfigNum = 1; ZoneEquipConfigNum <= NumOfZones; ++ZoneEquipConfigNum ) {
-			if ( Zone( ZoneEquipConfigNum ).IsControlled ) {
-				controlledZoneEquipConfigNums.push_back( ZoneEquipConfigNum );
-			}
-		}
-
 		// Update zone temperatures
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
@@ -3704,7 +3718,7 @@ namespace ZoneTempPredictorCorrector {
 			ManageAirModel( ZoneNum );
 
 			// Calculate the various heat balance sums
-			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT, controlledZoneEquipConfigNums );
+			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT );
 			//    ZoneTempHistoryTerm = (3.0D0 * ZTM1(ZoneNum) - (3.0D0/2.0D0) * ZTM2(ZoneNum) + (1.0D0/3.0D0) * ZTM3(ZoneNum))
 			ZoneNodeNum = Zone( ZoneNum ).SystemZoneNodeNumber;
 
@@ -3831,7 +3845,7 @@ namespace ZoneTempPredictorCorrector {
 			SNLoadCoolEnergy( ZoneNum ) = std::abs( min( SNLoad, 0.0 ) * TimeStepSys * SecInHour );
 
 			// Final humidity calcs
-			CorrectZoneHumRat( ZoneNum, controlledZoneEquipConfigNums );
+			CorrectZoneHumRat( ZoneNum );
 
 			ZoneAirHumRat( ZoneNum ) = ZoneAirHumRatTemp( ZoneNum );
 			ZoneAirRelHum( ZoneNum ) = 100.0 * PsyRhFnTdbWPb( ZT( ZoneNum ), ZoneAirHumRat( ZoneNum ), OutBaroPress, RoutineName );
@@ -3872,7 +3886,7 @@ namespace ZoneTempPredictorCorrector {
 				}
 			}}
 
-			CalcZoneComponentLoadSums( ZoneNum, TempDepCoef, TempIndCoef, ZnAirRpt( ZoneNum ).SumIntGains, ZnAirRpt( ZoneNum ).SumHADTsurfs, ZnAirRpt( ZoneNum ).SumMCpDTzones, ZnAirRpt( ZoneNum ).SumMCpDtInfil, ZnAirRpt( ZoneNum ).SumMCpDTsystem, ZnAirRpt( ZoneNum ).SumNonAirSystem, ZnAirRpt( ZoneNum ).CzdTdt, ZnAirRpt( ZoneNum ).imBalance, controlledZoneEquipConfigNums ); // convection part of internal gains | surface convection heat transfer | interzone mixing | OA of various kinds except via system | air system | non air system | air mass energy storage term | measure of imbalance in zone air heat balance
+			CalcZoneComponentLoadSums( ZoneNum, TempDepCoef, TempIndCoef, ZnAirRpt( ZoneNum ).SumIntGains, ZnAirRpt( ZoneNum ).SumHADTsurfs, ZnAirRpt( ZoneNum ).SumMCpDTzones, ZnAirRpt( ZoneNum ).SumMCpDtInfil, ZnAirRpt( ZoneNum ).SumMCpDTsystem, ZnAirRpt( ZoneNum ).SumNonAirSystem, ZnAirRpt( ZoneNum ).CzdTdt, ZnAirRpt( ZoneNum ).imBalance ); // convection part of internal gains | surface convection heat transfer | interzone mixing | OA of various kinds except via system | air system | non air system | air mass energy storage term | measure of imbalance in zone air heat balance
 
 		} // ZoneNum
 
@@ -4135,16 +4149,13 @@ namespace ZoneTempPredictorCorrector {
 	}
 
 	void
-	CorrectZoneHumRat(
-		int const ZoneNum,
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
-	)
+	CorrectZoneHumRat( int const ZoneNum )
 	{
 
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Richard Liesen
 		//       DATE WRITTEN   2000
-		//       MODIFIED       na
+		//       MODIFIED       October 2026, look up the air supplied to the zone in InitZoneAirSources
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4217,29 +4228,15 @@ namespace ZoneTempPredictorCorrector {
 		ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
 
 		// Check to see if this is a controlled zone
-		ZoneEquipConfigNum = 0;
-		ControlledZoneAirFlag = false;
-		for ( std::vector< int >::size_type i = 0, e = controlledZoneEquipConfigNums.size(); i < e; ++i ) {
-			if ( ZoneEquipConfig( controlledZoneEquipConfigNums[ i ] ).ActualZoneNum == ZoneNum ) {
-				ZoneEquipConfigNum = controlledZoneEquipConfigNums[ i ];
-				ControlledZoneAirFlag = true;
-				break;
-			}
-		}
+		InitZoneAirSources();
+		ZoneEquipConfigNum = ZoneEquipConfigNumOfZone( ZoneNum );
+		ControlledZoneAirFlag = ( ZoneEquipConfigNum > 0 );
 
 		// Check to see if this is a plenum zone
-		ZoneRetPlenumAirFlag = false;
-		for ( ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
-			if ( ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneRetPlenumAirFlag = true;
-			break;
-		} // ZoneRetPlenumNum
-		ZoneSupPlenumAirFlag = false;
-		for ( ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
-			if ( ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneSupPlenumAirFlag = true;
-			break;
-		} // ZoneSupPlenumNum
+		ZoneRetPlenumNum = ZoneRetPlenumNumOfZone( ZoneNum );
+		ZoneRetPlenumAirFlag = ( ZoneRetPlenumNum > 0 );
+		ZoneSupPlenumNum = ZoneSupPlenumNumOfZone( ZoneNum );
+		ZoneSupPlenumAirFlag = ( ZoneSupPlenumNum > 0 );
 
 		if ( ControlledZoneAirFlag ) { // If there is system flow then calculate the flow rates
 
@@ -4371,6 +4368,64 @@ namespace ZoneTempPredictorCorrector {
 
 	}
 
+	void
+	InitZoneAirSources()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the controlled zone equipment configuration and the return and supply plenums of
+		// each zone, which CalcZoneSums, CorrectZoneHumRat and CalcZoneComponentLoadSums used to
+		// search for in every call.
+
+		// METHODOLOGY EMPLOYED:
+		// The tables are built again when the number of zones, equipment configurations or plenums
+		// changes.  The plenums are read on the first call to the air system simulation, after
+		// the first predict step.  The first configuration or plenum found for a zone is kept, as
+		// in the searches.
+
+		// Using/Aliasing
+		using DataZoneEquipment::ZoneEquipConfig;
+		using ZonePlenum::ZoneRetPlenCond;
+		using ZonePlenum::ZoneSupPlenCond;
+		using ZonePlenum::NumZoneReturnPlenums;
+		using ZonePlenum::NumZoneSupplyPlenums;
+
+		int const NumEquipConfigs( ZoneEquipConfig.size() );
+		if ( ZoneAirSourcesNumZones == NumOfZones && ZoneAirSourcesNumEquipConfigs == NumEquipConfigs && ZoneAirSourcesNumRetPlenums == NumZoneReturnPlenums && ZoneAirSourcesNumSupPlenums == NumZoneSupplyPlenums ) return;
+		ZoneAirSourcesNumZones = NumOfZones;
+		ZoneAirSourcesNumEquipConfigs = NumEquipConfigs;
+		ZoneAirSourcesNumRetPlenums = NumZoneReturnPlenums;
+		ZoneAirSourcesNumSupPlenums = NumZoneSupplyPlenums;
+
+		ZoneEquipConfigNumOfZone.dimension( NumOfZones, 0 );
+		ZoneRetPlenumNumOfZone.dimension( NumOfZones, 0 );
+		ZoneSupPlenumNumOfZone.dimension( NumOfZones, 0 );
+
+		for ( int ZoneEquipConfigNum = 1; ZoneEquipConfigNum <= NumOfZones; ++ZoneEquipConfigNum ) {
+			if ( ! Zone( ZoneEquipConfigNum ).IsControlled ) continue;
+			int const ZoneNum( ZoneEquipConfig( ZoneEquipConfigNum ).ActualZoneNum );
+			if ( ZoneNum < 1 || ZoneNum > NumOfZones ) continue;
+			if ( ZoneEquipConfigNumOfZone( ZoneNum ) == 0 ) ZoneEquipConfigNumOfZone( ZoneNum ) = ZoneEquipConfigNum;
+		}
+		for ( int ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
+			int const ZoneNum( ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum );
+			if ( ZoneNum < 1 || ZoneNum > NumOfZones ) continue;
+			if ( ZoneRetPlenumNumOfZone( ZoneNum ) == 0 ) ZoneRetPlenumNumOfZone( ZoneNum ) = ZoneRetPlenumNum;
+		}
+		for ( int ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
+			int const ZoneNum( ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum );
+			if ( ZoneNum < 1 || ZoneNum > NumOfZones ) continue;
+			if ( ZoneSupPlenumNumOfZone( ZoneNum ) == 0 ) ZoneSupPlenumNumOfZone( ZoneNum ) = ZoneSupPlenumNum;
+		}
+
+	}
+
 	void
 	DownInterpolate4HistoryValues(
 		Real64 const OldTimeStep,
@@ -4487,8 +4542,7 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & SumMCp, // Zone sum of MassFlowRate*Cp
 		Real64 & SumMCpT, // Zone sum of MassFlowRate*Cp*T
 		Real64 & SumSysMCp, // Zone sum of air system MassFlowRate*Cp
-		Real64 & SumSysMCpT, // Zone sum of air system MassFlowRate*Cp*T
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+		Real64 & SumSysMCpT // Zone sum of air system MassFlowRate*Cp*T
 	)
 	{
 
@@ -4497,6 +4551,7 @@ namespace ZoneTempPredictorCorrector {
 		//       DATE WRITTEN   July 2003
 		//       MODIFIED       Aug 2003, FCW: add SumHA contributions from window frame and divider
 		//                      Aug 2003, CC: change how the reference temperatures are used
+		//                      October 2026, look up the air supplied to the zone in InitZoneAirSources
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4593,30 +4648,15 @@ namespace ZoneTempPredictorCorrector {
 		// Sum all system air flow: SumSysMCp, SumSysMCpT
 		// Check to see if this is a controlled zone
 
-		ZoneEquipConfigNum = 0;
-		ControlledZoneAirFlag = false;
-		for ( std::vector< int >::size_type i = 0, e = controlledZoneEquipConfigNums.size(); i < e; ++i ) {
-			if ( ZoneEquipConfig( controlledZoneEquipConfigNums[ i ] ).ActualZoneNum == ZoneNum ) {
-				ZoneEquipConfigNum = controlledZoneEquipConfigNums[ i ];
-				ControlledZoneAirFlag = true;
-				break;
-			}
-		}
+		InitZoneAirSources();
+		ZoneEquipConfigNum = ZoneEquipConfigNumOfZone( ZoneNum );
+		ControlledZoneAirFlag = ( ZoneEquipConfigNum > 0 );
 
 		// Check to see if this is a plenum zone
-		// BG feb 2008 repeating this do loop every time seems crazy, store ControlledZoneAirFlag in Zone structure?
-		ZoneRetPlenumAirFlag = false;
-		for ( ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
-			if ( ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneRetPlenumAirFlag = true;
-			break;
-		} // ZoneRetPlenumNum
-		ZoneSupPlenumAirFlag = false;
-		for ( ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
-			if ( ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneSupPlenumAirFlag = true;
-			break;
-		} // ZoneSupPlenumNum
+		ZoneRetPlenumNum = ZoneRetPlenumNumOfZone( ZoneNum );
+		ZoneRetPlenumAirFlag = ( ZoneRetPlenumNum > 0 );
+		ZoneSupPlenumNum = ZoneSupPlenumNumOfZone( ZoneNum );
+		ZoneSupPlenumAirFlag = ( ZoneSupPlenumNum > 0 );
 
 		// Plenum and controlled zones have a different set of inlet nodes which must be calculated.
 		if ( ControlledZoneAirFlag ) {
@@ -4797,15 +4837,14 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & SumMCpDTsystem, // Zone sum of air system MassFlowRate*Cp*(Tsup - Tz)
 		Real64 & SumNonAirSystem, // Zone sum of non air system convective heat gains
 		Real64 & CzdTdt, // Zone air energy storage term.
-		Real64 & imBalance, // put all terms in eq. 5 on RHS , should be zero
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+		Real64 & imBalance // put all terms in eq. 5 on RHS , should be zero
 	)
 	{
 
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Brent Griffith
 		//       DATE WRITTEN   Feb 2008
-		//       MODIFIED
+		//       MODIFIED       October 2026, look up the air supplied to the zone in InitZoneAirSources
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4913,29 +4952,15 @@ namespace ZoneTempPredictorCorrector {
 		// Check to see if this is a controlled zone
 
 		// CR 7384 continuation needed below.  eliminate do loop for speed and clarity
-		ZoneEquipConfigNum = 0;
-		ControlledZoneAirFlag = false;
-		for ( std::vector< int >::size_type i = 0, e = controlledZoneEquipConfigNums.size(); i < e; ++i ) {
-			if ( ZoneEquipConfig( controlledZoneEquipConfigNums[ i ] ).ActualZoneNum == ZoneNum ) {
-				ZoneEquipConfigNum = controlledZoneEquipConfigNums[ i ];
-				ControlledZoneAirFlag = true;
-				break;
-			}
-		}
+		InitZoneAirSources();
+		ZoneEquipConfigNum = ZoneEquipConfigNumOfZone( ZoneNum );
+		ControlledZoneAirFlag = ( ZoneEquipConfigNum > 0 );
 
 		// Check to see if this is a plenum zone
-		ZoneRetPlenumAirFlag = false;
-		for ( ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
-			if ( ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneRetPlenumAirFlag = true;
-			break;
-		} // ZoneRetPlenumNum
-		ZoneSupPlenumAirFlag = false;
-		for ( ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
-			if ( ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneSupPlenumAirFlag = true;
-			break;
-		} // ZoneSupPlenumNum
+		ZoneRetPlenumNum = ZoneRetPlenumNumOfZone( ZoneNum );
+		ZoneRetPlenumAirFlag = ( ZoneRetPlenumNum > 0 );
+		ZoneSupPlenumNum = ZoneSupPlenumNumOfZone( ZoneNum );
+		ZoneSupPlenumAirFlag = ( ZoneSupPlenumNum > 0 );
 
 		// Plenum and controlled zones have a different set of inlet nodes which must be calculated.
 		if ( ControlledZoneAirFlag ) {
@@ -91,6 +91,21 @@ namespace ZoneTempPredictorCorrector {
 	extern FArray1D< Real64 > TempDepZnLd;
 	extern FArray1D< Real64 > ZoneAirRelHum; // Zone relative humidity in percent
 
+	// Heat balance sums of each zone from the predict step
+	extern FArray1D< Real64 > ZoneSumIntGain; // Zone sum of convective internal gains
+	extern FArray1D< Real64 > ZoneSumHA; // Zone sum of Hc*Area
+	extern FArray1D< Real64 > ZoneSumHATsurf; // Zone sum of Hc*Area*Tsurf
+	extern FArray1D< Real64 > ZoneSumHATref; // Zone sum of Hc*Area*Tref, for ceiling diffuser convection correlation
+	extern FArray1D< Real64 > ZoneSumMCp; // Zone sum of MassFlowRate*Cp
+	extern FArray1D< Real64 > ZoneSumMCpT; // Zone sum of MassFlowRate*Cp*T
+	extern FArray1D< Real64 > ZoneSumSysMCp; // Zone sum of air system MassFlowRate*Cp
+	extern FArray1D< Real64 > ZoneSumSysMCpT; // Zone sum of air system MassFlowRate*Cp*T
+
+	// Air supplied to each zone
+	extern FArray1D_int ZoneEquipConfigNumOfZone; // Controlled zone equipment configuration, 0 if none
+	extern FArray1D_int ZoneRetPlenumNumOfZone; // Return plenum in the zone, 0 if none
+	extern FArray1D_int ZoneSupPlenumNumOfZone; // Supply plenum in the zone, 0 if none
+
 	// Zone temperature history - used only for oscillation test
 	extern FArray2D< Real64 > ZoneTempHist;
 	extern FArray1D< Real64 > ZoneTempOscillate;
@@ -190,6 +205,11 @@ namespace ZoneTempPredictorCorrector {
 
 	// Functions
 
+	// Clears the global data in ZoneTempPredictorCorrector.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	ManageZoneAirUpdates(
 		int const UpdateType, // Can be iGetZoneSetPoints, iPredictStep, iCorrectStep
@@ -239,10 +259,10 @@ namespace ZoneTempPredictorCorrector {
 	RevertZoneTimestepHistories();
 
 	void
-	CorrectZoneHumRat(
-		int const ZoneNum,
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
-	);
+	CorrectZoneHumRat( int const ZoneNum );
+
+	void
+	InitZoneAirSources();
 
 	void
 	DownInterpolate4HistoryValues(
@@ -270,8 +290,7 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & SumMCp, // Zone sum of MassFlowRate*Cp
 		Real64 & SumMCpT, // Zone sum of MassFlowRate*Cp*T
 		Real64 & SumSysMCp, // Zone sum of air system MassFlowRate*Cp
-		Real64 & SumSysMCpT, // Zone sum of air system MassFlowRate*Cp*T
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+		Real64 & SumSysMCpT // Zone sum of air system MassFlowRate*Cp*T
 	);
 
 	void
@@ -286,8 +305,7 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & SumMCpDTsystem, // Zone sum of air system MassFlowRate*Cp*(Tsup - Tz)
 		Real64 & SumNonAirSystem, // Zone sum of non air system convective heat gains
 		Real64 & CzdTdt, // Zone air energy storage term.
-		Real64 & imBalance, // put all terms in eq. 5 on RHS , should be zero
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+		Real64 & imBalance // put all terms in eq. 5 on RHS , should be zero
 	);
 
 	bool
@@ -0,0 +1,305 @@
+// EnergyPlus::PolygonClipping microbenchmark
+//
+// Times PolygonClipping::ClipPolygon against the original (vertex at a time) Sutherland-Hodgman
+// loop of SolarShading::CLIPPOLY and checks that both give the same polygons.
+//
+// Usage: PolygonClipping_benchmark [polygon pair file] [repetitions]
+//
+// The polygon pair file is written by EnergyPlus when the environment variable
+// TRACE_HCCLIPPING=YES is set (polygons.HCClipping.txt): one pair per line,
+// "NV1 X Y ... NV2 X Y ..." in homogeneous (integer) coordinates.  Without a file a
+// deterministic set of window/shadow sized pairs is generated.
+
+// C++ Headers
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Fmath.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/PolygonClipping.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::PolygonClipping;
+
+namespace {
+
+	int const FigureStride( 32 ); // Column length of a figure, a multiple of 16 as in SolarShading
+
+	struct Figures // HC arrays laid out as the SolarShading columns
+	{
+		std::vector< Int64 > X, Y, A, B, C;
+		std::vector< int > NV;
+
+		int
+		Add( std::vector< Int64 > const & XV, std::vector< Int64 > const & YV )
+		{
+			int const NS( int( NV.size() ) );
+			int const NumVert( int( XV.size() ) );
+			if ( NumVert + 1 > FigureStride ) return -1;
+			X.resize( X.size() + FigureStride, 0 );
+			Y.resize( Y.size() + FigureStride, 0 );
+			A.resize( A.size() + FigureStride, 0 );
+			B.resize( B.size() + FigureStride, 0 );
+			C.resize( C.size() + FigureStride, 0 );
+			int const l( NS * FigureStride );
+			for ( int N = 0; N < NumVert; ++N ) {
+				X[ l + N ] = XV[ N ];
+				Y[ l + N ] = YV[ N ];
+			}
+			HCSidesAndArea( &X[ l ], &Y[ l ], NumVert, &A[ l ], &B[ l ], &C[ l ] );
+			NV.push_back( NumVert );
+			return NS;
+		}
+	};
+
+	// The Sutherland-Hodgman loop of SolarShading::CLIPPOLY before the PolygonClipping kernel
+	int
+	ReferenceClip(
+		Figures const & F,
+		int const NS1,
+		int const NS2,
+		std::vector< Real64 > & XTEMP,
+		std::vector< Real64 > & YTEMP,
+		bool & INTFLAG
+	)
+	{
+		int const NV1( F.NV[ NS1 ] );
+		int const NV2( F.NV[ NS2 ] );
+		std::size_t const Size( 4 * ( NV1 + NV2 ) + 4 ); // Buffers persist between calls like the module arrays
+		static std::vector< Real64 > XTEMP1, YTEMP1, ATEMP, BTEMP, CTEMP;
+		if ( XTEMP.size() < Size ) {
+			XTEMP.resize( Size );
+			YTEMP.resize( Size );
+			XTEMP1.resize( Size );
+			YTEMP1.resize( Size );
+			ATEMP.resize( Size );
+			BTEMP.resize( Size );
+			CTEMP.resize( Size );
+		}
+		int const l1( NS1 * FigureStride );
+		for ( int j = 0; j < NV1; ++j ) { // 1-based below, as in the original
+			XTEMP[ j + 1 ] = Real64( F.X[ l1 + j ] );
+			YTEMP[ j + 1 ] = Real64( F.Y[ l1 + j ] );
+			ATEMP[ j + 1 ] = Real64( F.A[ l1 + j ] );
+			BTEMP[ j + 1 ] = Real64( F.B[ l1 + j ] );
+			CTEMP[ j + 1 ] = Real64( F.C[ l1 + j ] );
+		}
+		int NVOUT( NV1 );
+		int NVTEMP( 0 );
+		int KK( 0 );
+		INTFLAG = false;
+		int const l2( NS2 * FigureStride );
+		for ( int E = 1; E <= NV2; ++E ) {
+			for ( int P = 1; P <= NVOUT; ++P ) {
+				XTEMP1[ P ] = XTEMP[ P ];
+				YTEMP1[ P ] = YTEMP[ P ];
+			}
+			int S( NVOUT );
+			Real64 const HCA_E( F.A[ l2 + E - 1 ] );
+			Real64 const HCB_E( F.B[ l2 + E - 1 ] );
+			Real64 const HCC_E( F.C[ l2 + E - 1 ] );
+			for ( int P = 1; P <= NVOUT; ++P ) {
+				Real64 HFunct( XTEMP1[ P ] * HCA_E + YTEMP1[ P ] * HCB_E + HCC_E );
+				bool const InP( HFunct <= 0.0 );
+				HFunct = XTEMP1[ S ] * HCA_E + YTEMP1[ S ] * HCB_E + HCC_E;
+				bool const InS( HFunct <= 0.0 );
+				bool const Cut( InP ? ! InS : InS );
+				if ( Cut ) {
+					KK = NVTEMP;
+					++NVTEMP;
+					Real64 const W( HCB_E * ATEMP[ S ] - HCA_E * BTEMP[ S ] );
+					if ( W != 0.0 ) {
+						Real64 const W_inv( 1.0 / W );
+						XTEMP[ NVTEMP ] = nint64( ( HCC_E * BTEMP[ S ] - HCB_E * CTEMP[ S ] ) * W_inv );
+						YTEMP[ NVTEMP ] = nint64( ( HCA_E * CTEMP[ S ] - HCC_E * ATEMP[ S ] ) * W_inv );
+					} else {
+						XTEMP[ NVTEMP ] = ( HCC_E * BTEMP[ S ] - HCB_E * CTEMP[ S ] ) / 1.0e-10;
+						YTEMP[ NVTEMP ] = ( HCA_E * CTEMP[ S ] - HCC_E * ATEMP[ S ] ) / 1.0e-10;
+					}
+					INTFLAG = true;
+					if ( E == NV2 && KK != 0 ) {
+						for ( int K = 1; K <= KK; ++K ) {
+							if ( std::abs( XTEMP[ NVTEMP ] - XTEMP[ K ] ) > 2.0 ) continue;
+							if ( std::abs( YTEMP[ NVTEMP ] - YTEMP[ K ] ) > 2.0 ) continue;
+							NVTEMP = KK;
+							break;
+						}
+					}
+				}
+				if ( InP ) {
+					KK = NVTEMP;
+					++NVTEMP;
+					XTEMP[ NVTEMP ] = XTEMP1[ P ];
+					YTEMP[ NVTEMP ] = YTEMP1[ P ];
+					if ( E == NV2 && KK != 0 ) {
+						for ( int K = 1; K <= KK; ++K ) {
+							if ( std::abs( XTEMP[ NVTEMP ] - XTEMP[ K ] ) > 2.0 ) continue;
+							if ( std::abs( YTEMP[ NVTEMP ] - YTEMP[ K ] ) > 2.0 ) continue;
+							NVTEMP = KK;
+							break;
+						}
+					}
+				}
+				S = P;
+			}
+			NVOUT = NVTEMP;
+			if ( NVOUT == 0 ) break;
+			NVTEMP = 0;
+			if ( E != NV2 && NVOUT > 2 ) {
+				XTEMP[ NVOUT + 1 ] = XTEMP[ 1 ];
+				YTEMP[ NVOUT + 1 ] = YTEMP[ 1 ];
+				for ( int P = 1; P <= NVOUT; ++P ) {
+					ATEMP[ P ] = YTEMP[ P ] - YTEMP[ P + 1 ];
+					BTEMP[ P ] = XTEMP[ P + 1 ] - XTEMP[ P ];
+					CTEMP[ P ] = XTEMP[ P ] * YTEMP[ P + 1 ] - YTEMP[ P ] * XTEMP[ P + 1 ];
+				}
+			}
+		}
+		return NVOUT;
+	}
+
+	// Clockwise convex polygon with vertices on an ellipse (HC units)
+	void
+	ConvexPolygon(
+		std::mt19937 & Gen,
+		Real64 const CX,
+		Real64 const CY,
+		Real64 const RX,
+		Real64 const RY,
+		int const NumVert,
+		std::vector< Int64 > & XV,
+		std::vector< Int64 > & YV
+	)
+	{
+		std::uniform_real_distribution< Real64 > Jitter( 0.0, 1.0 );
+		XV.clear();
+		YV.clear();
+		Real64 const Step( 6.283185307179586 / NumVert );
+		Real64 const Start( Step * Jitter( Gen ) );
+		for ( int N = 0; N < NumVert; ++N ) {
+			Real64 const Angle( Start - Step * ( N + 0.2 + 0.6 * Jitter( Gen ) ) ); // Decreasing angle is clockwise
+			XV.push_back( nint64( CX + RX * std::cos( Angle ) ) );
+			YV.push_back( nint64( CY + RY * std::sin( Angle ) ) );
+		}
+	}
+
+	void
+	GeneratePairs(
+		Figures & F,
+		std::vector< std::pair< int, int > > & Pairs
+	)
+	{
+		std::mt19937 Gen( 20141 );
+		std::uniform_real_distribution< Real64 > U( 0.0, 1.0 );
+		std::vector< Int64 > XV, YV;
+		for ( int I = 0; I < 20000; ++I ) {
+			// Receiving surface: 1-10 m rectangle (HC units are 0.01 mm); shadow: 3-8 sided figure nearby
+			Real64 const W( 1.0e5 + 9.0e5 * U( Gen ) );
+			Real64 const H( 1.0e5 + 2.0e5 * U( Gen ) );
+			ConvexPolygon( Gen, 0.0, 0.0, W, H, 4, XV, YV );
+			int const NS1( F.Add( XV, YV ) );
+			int const NumVert( 3 + int( 6.0 * U( Gen ) ) );
+			ConvexPolygon( Gen, 2.0 * W * ( U( Gen ) - 0.5 ), 2.0 * H * ( U( Gen ) - 0.5 ), W * ( 0.2 + U( Gen ) ), H * ( 0.2 + U( Gen ) ), NumVert, XV, YV );
+			int const NS2( F.Add( XV, YV ) );
+			Pairs.push_back( std::make_pair( NS1, NS2 ) );
+		}
+	}
+
+	bool
+	ReadPairs(
+		char const * FileName,
+		Figures & F,
+		std::vector< std::pair< int, int > > & Pairs
+	)
+	{
+		std::ifstream In( FileName );
+		if ( ! In ) return false;
+		std::vector< Int64 > XV, YV;
+		int NV;
+		while ( In >> NV ) {
+			int NS[ 2 ];
+			for ( int Fig = 0; Fig < 2; ++Fig ) {
+				if ( Fig == 1 && ! ( In >> NV ) ) return ! Pairs.empty();
+				XV.resize( NV );
+				YV.resize( NV );
+				for ( int N = 0; N < NV; ++N ) In >> XV[ N ] >> YV[ N ];
+				NS[ Fig ] = F.Add( XV, YV );
+			}
+			if ( NS[ 0 ] >= 0 && NS[ 1 ] >= 0 ) Pairs.push_back( std::make_pair( NS[ 0 ], NS[ 1 ] ) );
+		}
+		return ! Pairs.empty();
+	}
+
+}
+
+int
+main( int argc, char * argv[] )
+{
+	Figures F;
+	std::vector< std::pair< int, int > > Pairs;
+	if ( argc > 1 ) {
+		if ( ! ReadPairs( argv[ 1 ], F, Pairs ) ) {
+			std::cerr << "Could not read polygon pairs from " << argv[ 1 ] << std::endl;
+			return 1;
+		}
+	} else {
+		GeneratePairs( F, Pairs );
+	}
+	int const Repetitions( argc > 2 ? std::atoi( argv[ 2 ] ) : 50 );
+
+	// Check that the kernel reproduces the original clipping exactly
+	ClipWorkspace Work;
+	std::vector< Real64 > XRef, YRef;
+	std::size_t NumMismatch( 0 ), NumOverlap( 0 );
+	for ( auto const & Pair : Pairs ) {
+		int const l1( Pair.first * FigureStride );
+		int const l2( Pair.second * FigureStride );
+		bool Intersected, IntersectedRef;
+		int const NV( ClipPolygon( &F.X[ l1 ], &F.Y[ l1 ], &F.A[ l1 ], &F.B[ l1 ], &F.C[ l1 ], F.NV[ Pair.first ], &F.A[ l2 ], &F.B[ l2 ], &F.C[ l2 ], F.NV[ Pair.second ], Work, Intersected ) );
+		int const NVRef( ReferenceClip( F, Pair.first, Pair.second, XRef, YRef, IntersectedRef ) );
+		bool Same( NV == NVRef && ( NV < 3 || Intersected == IntersectedRef ) );
+		for ( int N = 0; Same && N < NV; ++N ) {
+			Same = ( Work.X[ N ] == XRef[ N + 1 ] && Work.Y[ N ] == YRef[ N + 1 ] );
+		}
+		if ( ! Same ) ++NumMismatch;
+		if ( NV >= 3 ) ++NumOverlap;
+	}
+
+	typedef std::chrono::high_resolution_clock Clock;
+	std::size_t Checksum( 0 );
+
+	Clock::time_point const StartRef( Clock::now() );
+	for ( int R = 0; R < Repetitions; ++R ) {
+		for ( auto const & Pair : Pairs ) {
+			bool IntersectedRef;
+			Checksum += ReferenceClip( F, Pair.first, Pair.second, XRef, YRef, IntersectedRef );
+		}
+	}
+	Clock::time_point const StartNew( Clock::now() );
+	for ( int R = 0; R < Repetitions; ++R ) {
+		for ( auto const & Pair : Pairs ) {
+			int const l1( Pair.first * FigureStride );
+			int const l2( Pair.second * FigureStride );
+			bool Intersected;
+			Checksum += ClipPolygon( &F.X[ l1 ], &F.Y[ l1 ], &F.A[ l1 ], &F.B[ l1 ], &F.C[ l1 ], F.NV[ Pair.first ], &F.A[ l2 ], &F.B[ l2 ], &F.C[ l2 ], F.NV[ Pair.second ], Work, Intersected );
+		}
+	}
+	Clock::time_point const Finish( Clock::now() );
+
+	Real64 const Calls( Real64( Pairs.size() ) * Repetitions );
+	Real64 const NsRef( std::chrono::duration< Real64, std::nano >( StartNew - StartRef ).count() / Calls );
+	Real64 const NsNew( std::chrono::duration< Real64, std::nano >( Finish - StartNew ).count() / Calls );
+	std::cout << "Polygon pairs:          " << Pairs.size() << " (" << NumOverlap << " overlapping)\n";
+	std::cout << "Mismatches:             " << NumMismatch << '\n';
+	std::cout << "Original clip (ns/call): " << NsRef << '\n';
+	std::cout << "ClipPolygon (ns/call):   " << NsNew << '\n';
+	std::cout << "Speedup:                " << NsRef / NsNew << "  (checksum " << Checksum << ")\n";
+	return NumMismatch == 0 ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+// EnergyPlus::SolarReflectionManager ray casting microbenchmark
+//
+// Times the nearest-obstruction search of SolarReflectionManager (PierceSurface over every
+// surface) against the same search over the SurfaceBVH::SurfacesAlongRay candidates, and checks
+// that both find the same hit surface and hit point for every ray.
+//
+// Usage: SolarReflection_benchmark [buildings per side] [rays]
+//
+// The scene is a square block of box shaped buildings, each with four walls and a roof, and a
+// free-standing shading surface beside each one, like the neighbouring buildings of
+// ReflectiveAdjacentBuilding.idf repeated over a district.  Rays start just outside the walls
+// and go out in random directions, as the reflection rays from the receiving points do.
+
+// C++ Headers
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Vector3.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/SolarReflectionManager.hh>
+#include <EnergyPlus/SurfaceBVH.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataSurfaces;
+using SolarReflectionManager::PierceSurface;
+
+namespace {
+
+	struct Ray
+	{
+		Vector3< Real64 > Origin;
+		Vector3< Real64 > Dir;
+	};
+
+	struct Hit
+	{
+		int SurfNum; // 0 if nothing is hit
+		Vector3< Real64 > Pt;
+	};
+
+	void
+	SetRectangle(
+		int const SurfNum,
+		Vector3< Real64 > const & Corner, // Vertex 2 (lower left seen from outside)
+		Vector3< Real64 > const & Up, // Vertex 2 to vertex 1
+		Vector3< Real64 > const & Across // Vertex 2 to vertex 3
+	)
+	{
+		auto & surface( Surface( SurfNum ) );
+		surface.Sides = 4;
+		surface.Shape = Rectangle;
+		surface.Vertex.dimension( 4 );
+		surface.Vertex( 1 ) = Corner + Up;
+		surface.Vertex( 2 ) = Corner;
+		surface.Vertex( 3 ) = Corner + Across;
+		surface.Vertex( 4 ) = Corner + Up + Across;
+	}
+
+	void
+	BuildDistrict(
+		int const PerSide,
+		std::vector< Vector3< Real64 > > & WallPoints, // Points just outside each wall
+		std::vector< Vector3< Real64 > > & WallNormals
+	)
+	{
+		Real64 const Size( 20.0 ); // Building footprint (m)
+		Real64 const Height( 12.0 );
+		Real64 const Spacing( 35.0 );
+		TotSurfaces = PerSide * PerSide * 6;
+		Surface.deallocate();
+		Surface.allocate( TotSurfaces );
+		int SurfNum( 0 );
+		for ( int I = 0; I < PerSide; ++I ) {
+			for ( int J = 0; J < PerSide; ++J ) {
+				Vector3< Real64 > const O( I * Spacing, J * Spacing, 0.0 );
+				Vector3< Real64 > const X( Size, 0.0, 0.0 ), Y( 0.0, Size, 0.0 ), Z( 0.0, 0.0, Height );
+				SetRectangle( ++SurfNum, O, Z, X ); // South wall
+				SetRectangle( ++SurfNum, O + X, Z, Y ); // East wall
+				SetRectangle( ++SurfNum, O + X + Y, Z, -X ); // North wall
+				SetRectangle( ++SurfNum, O + Y, Z, -Y ); // West wall
+				SetRectangle( ++SurfNum, O + Z, Y, X ); // Roof
+				SetRectangle( ++SurfNum, O + Vector3< Real64 >( -6.0, -8.0, 0.0 ), Z * 0.75, X * 0.5 ); // Free-standing shade
+				Vector3< Real64 > const Mid( O + X * 0.5 + Y * 0.5 + Z * 0.5 );
+				WallPoints.push_back( Mid - Y * 0.51 );
+				WallNormals.push_back( Vector3< Real64 >( 0.0, -1.0, 0.0 ) );
+				WallPoints.push_back( Mid + X * 0.51 );
+				WallNormals.push_back( Vector3< Real64 >( 1.0, 0.0, 0.0 ) );
+				WallPoints.push_back( Mid + Y * 0.51 );
+				WallNormals.push_back( Vector3< Real64 >( 0.0, 1.0, 0.0 ) );
+				WallPoints.push_back( Mid - X * 0.51 );
+				WallNormals.push_back( Vector3< Real64 >( -1.0, 0.0, 0.0 ) );
+			}
+		}
+	}
+
+	void
+	GenerateRays(
+		std::vector< Vector3< Real64 > > const & WallPoints,
+		std::vector< Vector3< Real64 > > const & WallNormals,
+		int const NumRays,
+		std::vector< Ray > & Rays
+	)
+	{
+		std::mt19937 Gen( 2003 );
+		std::uniform_int_distribution< std::size_t > Wall( 0, WallPoints.size() - 1 );
+		std::uniform_real_distribution< Real64 > U( -1.0, 1.0 );
+		while ( int( Rays.size() ) < NumRays ) {
+			std::size_t const W( Wall( Gen ) );
+			Vector3< Real64 > Dir( U( Gen ), U( Gen ), U( Gen ) );
+			Real64 const Length( Dir.magnitude() );
+			if ( Length < 0.1 || Length > 1.0 ) continue;
+			Dir /= Length;
+			if ( dot( Dir, WallNormals[ W ] ) <= 0.0 ) continue; // Rays leave the front of the wall
+			Ray R;
+			R.Origin = WallPoints[ W ] + Vector3< Real64 >( U( Gen ), U( Gen ), U( Gen ) ) * 4.0;
+			R.Dir = Dir;
+			Rays.push_back( R );
+		}
+	}
+
+	// Nearest hit over the given surfaces, lowest surface number on ties as in InitSolReflRecSurf
+	template< typename Surfaces >
+	Hit
+	NearestHit(
+		Ray const & R,
+		Surfaces const & SurfNums
+	)
+	{
+		Hit Nearest;
+		Nearest.SurfNum = 0;
+		Real64 NearestDistance( 1.0e+8 );
+		int IHit;
+		Vector3< Real64 > HitPt;
+		for ( int const SurfNum : SurfNums ) {
+			PierceSurface( SurfNum, R.Origin, R.Dir, IHit, HitPt );
+			if ( IHit > 0 ) {
+				Real64 const HitDistance( distance( HitPt, R.Origin ) );
+				if ( HitDistance < NearestDistance ) {
+					NearestDistance = HitDistance;
+					Nearest.SurfNum = SurfNum;
+					Nearest.Pt = HitPt;
+				}
+			}
+		}
+		return Nearest;
+	}
+
+}
+
+int
+main( int argc, char * argv[] )
+{
+	int const PerSide( argc > 1 ? std::atoi( argv[ 1 ] ) : 12 );
+	int const NumRays( argc > 2 ? std::atoi( argv[ 2 ] ) : 200000 );
+
+	std::vector< Vector3< Real64 > > WallPoints, WallNormals;
+	BuildDistrict( PerSide, WallPoints, WallNormals );
+	std::vector< Ray > Rays;
+	GenerateRays( WallPoints, WallNormals, NumRays, Rays );
+
+	std::vector< int > AllSurfaces;
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) AllSurfaces.push_back( SurfNum );
+
+	typedef std::chrono::high_resolution_clock Clock;
+	Clock::time_point const StartBuild( Clock::now() );
+	SurfaceBVH::BuildSurfaceBVH();
+	Clock::time_point const StartRef( Clock::now() );
+	std::vector< Hit > RefHits;
+	RefHits.reserve( Rays.size() );
+	for ( auto const & R : Rays ) {
+		RefHits.push_back( NearestHit( R, AllSurfaces ) );
+	}
+	Clock::time_point const StartNew( Clock::now() );
+	std::vector< Hit > NewHits;
+	NewHits.reserve( Rays.size() );
+	std::vector< int > Candidates;
+	std::size_t NumCandidates( 0 );
+	for ( auto const & R : Rays ) {
+		SurfaceBVH::SurfacesAlongRay( R.Origin, R.Dir, Candidates );
+		NumCandidates += Candidates.size();
+		NewHits.push_back( NearestHit( R, Candidates ) );
+	}
+	Clock::time_point const Finish( Clock::now() );
+
+	std::size_t NumMismatch( 0 ), NumHit( 0 );
+	for ( std::size_t N = 0; N < Rays.size(); ++N ) {
+		if ( RefHits[ N ].SurfNum != NewHits[ N ].SurfNum ) {
+			++NumMismatch;
+		} else if ( RefHits[ N ].SurfNum > 0 ) {
+			++NumHit;
+			if ( RefHits[ N ].Pt != NewHits[ N ].Pt ) ++NumMismatch;
+		}
+	}
+
+	Real64 const Calls( Real64( Rays.size() ) );
+	Real64 const MsBuild( std::chrono::duration< Real64, std::milli >( StartRef - StartBuild ).count() );
+	Real64 const NsRef( std::chrono::duration< Real64, std::nano >( StartNew - StartRef ).count() / Calls );
+	Real64 const NsNew( std::chrono::duration< Real64, std::nano >( Finish - StartNew ).count() / Calls );
+	std::cout << "Surfaces:               " << TotSurfaces << '\n';
+	std::cout << "Rays:                   " << Rays.size() << " (" << NumHit << " hitting a surface)\n";
+	std::cout << "Candidates per ray:     " << Real64( NumCandidates ) / Calls << '\n';
+	std::cout << "Mismatches:             " << NumMismatch << '\n';
+	std::cout << "BVH build (ms):         " << MsBuild << '\n';
+	std::cout << "All surfaces (ns/ray):  " << NsRef << '\n';
+	std::cout << "BVH candidates (ns/ray): " << NsNew << '\n';
+	std::cout << "Speedup:                " << NsRef / NsNew << '\n';
+	return NumMismatch == 0 ? 0 : 1;
+}
@@ -0,0 +1,57 @@
+// EnergyPlus::ConductionTransferFunctionCalc Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/ConductionTransferFunctionCalc.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/ShadingCache.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ConductionTransferFunctionCalc;
+using namespace EnergyPlus::DataHeatBalance;
+
+TEST( ConductionTransferFunctionCalcTest, UnpackCTFs )
+{
+	Construct.allocate( 2 );
+	Construct( 1 ).NumHistories = 1;
+	Construct( 1 ).NumCTFTerms = 2;
+	Construct( 1 ).CTFTimeStep = 0.25;
+	for ( int HistTerm = 0; HistTerm <= 2; ++HistTerm ) {
+		Construct( 1 ).CTFOutside( HistTerm ) = 1.0 + HistTerm;
+		Construct( 1 ).CTFCross( HistTerm ) = 0.5 + HistTerm;
+		Construct( 1 ).CTFInside( HistTerm ) = 2.0 + HistTerm;
+		if ( HistTerm != 0 ) Construct( 1 ).CTFFlux( HistTerm ) = 0.1 * HistTerm;
+	}
+
+	// Round trip
+	ShadingCache::ShadingRecord Record;
+	PackCTFs( 1, Record );
+	ASSERT_TRUE( UnpackCTFs( Record, 2 ) );
+	EXPECT_EQ( 2, Construct( 2 ).NumCTFTerms );
+	EXPECT_EQ( 0.25, Construct( 2 ).CTFTimeStep );
+	for ( int HistTerm = 0; HistTerm <= 2; ++HistTerm ) {
+		EXPECT_EQ( Construct( 1 ).CTFOutside( HistTerm ), Construct( 2 ).CTFOutside( HistTerm ) );
+		EXPECT_EQ( Construct( 1 ).CTFInside( HistTerm ), Construct( 2 ).CTFInside( HistTerm ) );
+	}
+	EXPECT_EQ( 0.2, Construct( 2 ).CTFFlux( 2 ) );
+
+	// Records of another size, or with more terms than the arrays hold, are misses
+	Construct( 2 ).NumCTFTerms = 0;
+	ShadingCache::ShadingRecord Bad( Record );
+	Bad.Reals.pop_back();
+	EXPECT_FALSE( UnpackCTFs( Bad, 2 ) );
+	Bad = Record;
+	Bad.Ints[ 1 ] = MaxCTFTerms;
+	EXPECT_FALSE( UnpackCTFs( Bad, 2 ) );
+	Bad = Record;
+	Bad.Ints[ 1 ] = 3;
+	EXPECT_FALSE( UnpackCTFs( Bad, 2 ) );
+	Bad = Record;
+	Bad.Ints.pop_back();
+	EXPECT_FALSE( UnpackCTFs( Bad, 2 ) );
+	EXPECT_EQ( 0, Construct( 2 ).NumCTFTerms );
+
+	Construct.deallocate();
+}
@@ -4,12 +4,15 @@
 #include <gtest/gtest.h>
 
 // C++ Headers
+#include <algorithm>
 
 // EnergyPlus Headers
 #include <ConvectionCoefficients.hh>
+#include <DataSurfaces.hh>
 
 using namespace EnergyPlus;
 using namespace ConvectionCoefficients;
+using namespace DataSurfaces;
 
 TEST( ConvectionCoefficientsTest, ConvectionCofficiecnts )
 {
@@ -49,4 +52,49 @@ TEST( ConvectionCoefficientsTest, ConvectionCofficiecnts )
 
 }
 
+TEST( ConvectionCoefficientsTest, IntConvDispatchTables )
+{
+
+	TotSurfaces = 3;
+	Surface.allocate( TotSurfaces );
+	Surface( 1 ).Class = SurfaceClass_Wall;
+	Surface( 1 ).Tilt = 90.0;
+	Surface( 2 ).Class = SurfaceClass_Roof;
+	Surface( 2 ).Tilt = 0.0;
+	Surface( 3 ).Class = SurfaceClass_Floor;
+	Surface( 3 ).Tilt = 180.0;
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		Surface( SurfNum ).HeatTransSurf = true;
+		Surface( SurfNum ).IntConvZonePerimLength = 10.0;
+	}
+
+	SetupIntConvDispatchTables();
+	EXPECT_TRUE( IntConvDispatchSetup );
+
+	// Tables hold what the surface classification would find for every regime and sign
+	int HcModelEq;
+	int UserCurveNum;
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		for ( int RegimeCase = 1; RegimeCase <= NumIntConvRegimeCases; ++RegimeCase ) {
+			for ( int Sign = 1; Sign <= 3; ++Sign ) {
+				int const FlowRegime( std::min( RegimeCase, InConvFlowRegime_E ) );
+				int const PriorFlowRegime( RegimeCase == NumIntConvRegimeCases ? InConvFlowRegime_D : InConvFlowRegime_C );
+				int const Classification( ClassifyIntConvSurface( SurfNum, FlowRegime, PriorFlowRegime, 5.0 * ( Sign - 2 ) ) );
+				EXPECT_EQ( Classification, IntConvDispatch( SurfNum ).Classification( Sign, RegimeCase ) );
+				GetIntConvClassHcModel( SurfNum, Classification, HcModelEq, UserCurveNum );
+				EXPECT_EQ( HcModelEq, IntConvDispatch( SurfNum ).HcModelEq( Sign, RegimeCase ) );
+			}
+		}
+	}
+
+	// Buoyancy only: warm floor is unstable, warm ceiling is stable
+	EXPECT_EQ( HcInt_AlamdariHammondUnstableHorizontal, IntConvDispatch( 3 ).HcModelEq( 3, InConvFlowRegime_A3 ) );
+	EXPECT_EQ( HcInt_AlamdariHammondStableHorizontal, IntConvDispatch( 2 ).HcModelEq( 3, InConvFlowRegime_A3 ) );
+	EXPECT_EQ( HcInt_FohannoPolidoriVerticalWall, IntConvDispatch( 1 ).HcModelEq( 1, InConvFlowRegime_A3 ) );
+
+	IntConvDispatch.deallocate();
+	IntConvDispatchSetup = false;
+	Surface.deallocate();
+	TotSurfaces = 0;
 
+}
@@ -39,3 +39,56 @@ TEST_F( DataPlantTest, AnyPlantLoopSidesNeedSim )
 	SetAllPlantSimFlagsToValue( false ); // Set all SimLoopSideNeeded to false
 	EXPECT_FALSE( AnyPlantLoopSidesNeedSim() );
 }
+
+TEST_F( DataPlantTest, GatherHalfLoopState )
+{
+	DataLoopNode::Node.allocate( 6 );
+	for ( int l = 1; l <= TotNumLoops; ++l ) {
+		auto & branch_side( PlantLoop( l ).LoopSide( SupplySide ) );
+		branch_side.TotalBranches = 1;
+		branch_side.Branch.allocate( 1 );
+		branch_side.Branch( 1 ).TotalComponents = 1;
+		branch_side.Branch( 1 ).Comp.allocate( 1 );
+		branch_side.Branch( 1 ).Comp( 1 ).NodeNumIn = 2 * l - 1;
+		branch_side.Branch( 1 ).Comp( 1 ).NodeNumOut = 2 * l;
+	}
+	// Loop 1 demand side is connected to loop 3, as through a chiller condenser
+	PlantLoop( 1 ).LoopSide( DemandSide ).TotalConnected = 1;
+	PlantLoop( 1 ).LoopSide( DemandSide ).Connected.allocate( 1 );
+	PlantLoop( 1 ).LoopSide( DemandSide ).Connected( 1 ).LoopNum = 3;
+
+	std::vector< Real64 > State;
+	GatherHalfLoopState( 1, State );
+	std::vector< Real64 > const Before( State );
+	EXPECT_EQ( 4u + 4u * 11u, State.size() ); // Two flow locks and two nodes for each of loops 1 and 3
+
+	// Nodes of an unconnected loop are not seen
+	DataLoopNode::Node( 3 ).Temp = 12.0;
+	GatherHalfLoopState( 1, State );
+	EXPECT_EQ( Before, State );
+
+	// Nodes of the connected loop are
+	DataLoopNode::Node( 6 ).MassFlowRateRequest = 0.5;
+	GatherHalfLoopState( 1, State );
+	EXPECT_NE( Before, State );
+	DataLoopNode::Node( 6 ).MassFlowRateRequest = 0.0;
+
+	PlantLoop( 1 ).LoopSide( DemandSide ).FlowLock = FlowLocked;
+	GatherHalfLoopState( 1, State );
+	EXPECT_NE( Before, State );
+	PlantLoop( 1 ).LoopSide( DemandSide ).FlowLock = FlowUnlocked;
+
+	// So are the sensor nodes of the operation schemes, which need not be on any loop
+	// (node 3 is on loop 2, which loop 1 does not see otherwise)
+	PlantLoop( 3 ).OpScheme.allocate( 1 );
+	PlantLoop( 3 ).OpScheme( 1 ).ReferenceNodeNumber = 3;
+	GatherHalfLoopState( 1, State );
+	EXPECT_EQ( 4u + 5u * 11u, State.size() );
+	std::vector< Real64 > const WithReference( State );
+	DataLoopNode::Node( 3 ).Temp = 14.0;
+	GatherHalfLoopState( 1, State );
+	EXPECT_NE( WithReference, State );
+	PlantLoop( 3 ).OpScheme.deallocate();
+
+	DataLoopNode::Node.deallocate();
+}
@@ -0,0 +1,181 @@
+// EnergyPlus::DaylightingManager Unit Tests
+
+// C++ Headers
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <DaylightingManager.hh>
+#include <DataDaylighting.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalance.hh>
+#include <DataSurfaces.hh>
+#include <General.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DaylightingManager;
+using namespace EnergyPlus::DataDaylighting;
+using namespace EnergyPlus::DataEnvironment;
+using namespace EnergyPlus::DataGlobals;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::DataSurfaces;
+using namespace ObjexxFCL;
+
+TEST( DaylightingManagerTest, FindDayltgZoneGroups )
+{
+// Zones that see the same exterior window (through interior windows) must share a group, and the
+// groups run in turn must give the zones in the order of the serial zone loop
+
+	NumOfZones = 5;
+	TotSurfaces = 12;
+	ZoneDaylight.allocate( NumOfZones );
+	std::vector< std::vector< int > > const ExtWins( { { 10 }, { 11 }, { 10, 12 }, { 11 }, { 12 } } );
+	for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+		auto const & Wins( ExtWins[ ZoneNum - 1 ] );
+		ZoneDaylight( ZoneNum ).TotalDaylRefPoints = 1;
+		ZoneDaylight( ZoneNum ).NumOfDayltgExtWins = Wins.size();
+		ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums.allocate( Wins.size() );
+		for ( std::size_t loop = 0; loop < Wins.size(); ++loop ) {
+			ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop + 1 ) = Wins[ loop ];
+		}
+	}
+	ZoneDaylight( 4 ).TotalDaylRefPoints = 0; // Not daylit: ignored although it sees window 11
+
+	std::vector< std::vector< int > > ZoneGroups;
+	FindDayltgZoneGroups( ZoneGroups );
+
+	ASSERT_EQ( 2u, ZoneGroups.size() );
+	EXPECT_EQ( std::vector< int >( { 1, 3, 5 } ), ZoneGroups[ 0 ] );
+	EXPECT_EQ( std::vector< int >( { 2 } ), ZoneGroups[ 1 ] );
+
+	// Every exterior window is used by one group only
+	FArray1D_int GroupOfWin( TotSurfaces, -1 );
+	for ( std::size_t Group = 0; Group < ZoneGroups.size(); ++Group ) {
+		for ( int const ZoneNum : ZoneGroups[ Group ] ) {
+			for ( int const IWin : ExtWins[ ZoneNum - 1 ] ) {
+				if ( GroupOfWin( IWin ) < 0 ) GroupOfWin( IWin ) = Group;
+				EXPECT_EQ( int( Group ), GroupOfWin( IWin ) );
+			}
+		}
+	}
+
+	ZoneDaylight.deallocate();
+	NumOfZones = 0;
+	TotSurfaces = 0;
+}
+
+TEST( DaylightingManagerTest, DayltgInteriorMapIllum )
+{
+// The map illuminance from the contiguous factor columns must match the baseline evaluation, which
+// interpolated the factors of each map point in hour and slat angle before weighting by the sky
+
+	int const NumMapPts( 3 );
+	int const NumWins( 2 );
+	int ZoneNum( 1 );
+
+	WarmupFlag = false;
+	DoingSizing = false;
+	KickOffSimulation = false;
+	HourOfDay = 12;
+	PreviousHour = 11;
+	WeightNow = 0.7;
+	WeightPreviousHour = 0.3;
+	SkyClearness = 2.0;
+	SkyBrightness = 0.2;
+	HISKF = 10000.0;
+	HISUNF = 40000.0;
+	for ( int ISky = 1; ISky <= 4; ++ISky ) {
+		for ( int IHR = 1; IHR <= 24; ++IHR ) {
+			GILSK( ISky, IHR ) = 1000.0 * ISky + 10.0 * IHR;
+		}
+	}
+
+	ZoneDaylight.allocate( 1 );
+	ZoneDaylight( 1 ).MapCount = 1;
+	ZoneDaylight( 1 ).ZoneToMap.dimension( 1, 1 );
+	ZoneDaylight( 1 ).NumOfDayltgExtWins = NumWins;
+	ZoneDaylight( 1 ).DayltgExtWinSurfNums.allocate( NumWins );
+	ZoneDaylight( 1 ).DayltgExtWinSurfNums( 1 ) = 1;
+	ZoneDaylight( 1 ).DayltgExtWinSurfNums( 2 ) = 2;
+
+	Construct.allocate( 1 );
+	Surface.allocate( NumWins );
+	SurfaceWindow.allocate( NumWins );
+	for ( int IWin = 1; IWin <= NumWins; ++IWin ) {
+		Surface( IWin ).Construction = 1;
+	}
+	// Window 2 has an interior blind with movable slats between two slat angle factors
+	SurfaceWindow( 2 ).ShadingFlag = IntBlindOn;
+	SurfaceWindow( 2 ).MovableSlats = true;
+	SurfaceWindow( 2 ).SlatAngThisTS = 0.3;
+
+	IllumMapCalc.allocate( 1 );
+	auto & MapCalc( IllumMapCalc( 1 ) );
+	MapCalc.TotalMapRefPoints = NumMapPts;
+	MapCalc.DaylIllumAtMapPt.dimension( NumMapPts, 0.0 );
+	MapCalc.DaylIllFacSky.dimension( NumMapPts, NumWins, 4, MaxSlatAngs + 1, 24 );
+	MapCalc.DaylIllFacSun.dimension( NumMapPts, NumWins, MaxSlatAngs + 1, 24 );
+	MapCalc.DaylIllFacSunDisk.dimension( NumMapPts, NumWins, MaxSlatAngs + 1, 24 );
+	for ( int IL = 1; IL <= NumMapPts; ++IL ) {
+		for ( int loop = 1; loop <= NumWins; ++loop ) {
+			for ( int JSH = 1; JSH <= MaxSlatAngs + 1; ++JSH ) {
+				for ( int IHR = 1; IHR <= 24; ++IHR ) {
+					Real64 const Base( 0.001 * IL + 0.0003 * loop + 0.00002 * JSH + 0.000001 * IHR );
+					for ( int ISky = 1; ISky <= 4; ++ISky ) {
+						MapCalc.DaylIllFacSky( IL, loop, ISky, JSH, IHR ) = Base * ISky;
+					}
+					MapCalc.DaylIllFacSun( IL, loop, JSH, IHR ) = 0.5 * Base;
+					MapCalc.DaylIllFacSunDisk( IL, loop, JSH, IHR ) = 0.25 * Base;
+				}
+			}
+		}
+	}
+
+	// Baseline: sky types 2 and 3 are averaged for this clearness
+	int const ISky1( 2 );
+	int const ISky2( 3 );
+	Real64 const SkyWeight( ( SkyClearness - 1.2 ) / 1.8 );
+	FArray1D< Real64 > HorIllSky( 4 );
+	for ( int ISky = 1; ISky <= 4; ++ISky ) {
+		HorIllSky( ISky ) = WeightNow * GILSK( ISky, HourOfDay ) + WeightPreviousHour * GILSK( ISky, PreviousHour ) + 0.001;
+	}
+	Real64 const HorIllSkyFac( HISKF / ( ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) + SkyWeight * HorIllSky( ISky1 ) ) );
+	Real64 const SlatAng( SurfaceWindow( 2 ).SlatAngThisTS );
+	FArray1D< Real64 > Expected( NumMapPts, 0.0 );
+	for ( int IL = 1; IL <= NumMapPts; ++IL ) {
+		// Bare window
+		Real64 DFSUHR( WeightNow * ( MapCalc.DaylIllFacSun( IL, 1, 1, HourOfDay ) + MapCalc.DaylIllFacSunDisk( IL, 1, 1, HourOfDay ) ) + WeightPreviousHour * ( MapCalc.DaylIllFacSun( IL, 1, 1, PreviousHour ) + MapCalc.DaylIllFacSunDisk( IL, 1, 1, PreviousHour ) ) );
+		Real64 DFSKHR1( WeightNow * MapCalc.DaylIllFacSky( IL, 1, ISky1, 1, HourOfDay ) + WeightPreviousHour * MapCalc.DaylIllFacSky( IL, 1, ISky1, 1, PreviousHour ) );
+		Real64 DFSKHR2( WeightNow * MapCalc.DaylIllFacSky( IL, 1, ISky2, 1, HourOfDay ) + WeightPreviousHour * MapCalc.DaylIllFacSky( IL, 1, ISky2, 1, PreviousHour ) );
+		Expected( IL ) += DFSUHR * HISUNF + HorIllSkyFac * ( DFSKHR1 * SkyWeight * HorIllSky( ISky1 ) + DFSKHR2 * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
+		// Blind with movable slats
+		DFSUHR = WeightNow * ( General::InterpSlatAng( SlatAng, true, MapCalc.DaylIllFacSun( IL, 2, { 2, MaxSlatAngs + 1 }, HourOfDay ) ) + General::InterpSlatAng( SlatAng, true, MapCalc.DaylIllFacSunDisk( IL, 2, { 2, MaxSlatAngs + 1 }, HourOfDay ) ) ) + WeightPreviousHour * ( General::InterpSlatAng( SlatAng, true, MapCalc.DaylIllFacSun( IL, 2, { 2, MaxSlatAngs + 1 }, PreviousHour ) ) + General::InterpSlatAng( SlatAng, true, MapCalc.DaylIllFacSunDisk( IL, 2, { 2, MaxSlatAngs + 1 }, PreviousHour ) ) );
+		DFSKHR1 = WeightNow * General::InterpSlatAng( SlatAng, true, MapCalc.DaylIllFacSky( IL, 2, ISky1, { 2, MaxSlatAngs + 1 }, HourOfDay ) ) + WeightPreviousHour * General::InterpSlatAng( SlatAng, true, MapCalc.DaylIllFacSky( IL, 2, ISky1, { 2, MaxSlatAngs + 1 }, PreviousHour ) );
+		DFSKHR2 = WeightNow * General::InterpSlatAng( SlatAng, true, MapCalc.DaylIllFacSky( IL, 2, ISky2, { 2, MaxSlatAngs + 1 }, HourOfDay ) ) + WeightPreviousHour * General::InterpSlatAng( SlatAng, true, MapCalc.DaylIllFacSky( IL, 2, ISky2, { 2, MaxSlatAngs + 1 }, PreviousHour ) );
+		Expected( IL ) += DFSUHR * HISUNF + HorIllSkyFac * ( DFSKHR1 * SkyWeight * HorIllSky( ISky1 ) + DFSKHR2 * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
+	}
+
+	DayltgInteriorMapIllum( ZoneNum );
+	for ( int IL = 1; IL <= NumMapPts; ++IL ) {
+		EXPECT_NEAR( Expected( IL ), MapCalc.DaylIllumAtMapPt( IL ), 1.e-9 * Expected( IL ) );
+	}
+
+	// The maps are not reported during warmup, so they are not evaluated
+	WarmupFlag = true;
+	MapCalc.DaylIllumAtMapPt = -1.0;
+	DayltgInteriorMapIllum( ZoneNum );
+	for ( int IL = 1; IL <= NumMapPts; ++IL ) {
+		EXPECT_EQ( -1.0, MapCalc.DaylIllumAtMapPt( IL ) );
+	}
+
+	WarmupFlag = false;
+	IllumMapCalc.deallocate();
+	SurfaceWindow.deallocate();
+	Surface.deallocate();
+	Construct.deallocate();
+	ZoneDaylight.deallocate();
+	GILSK = 0.0;
+}
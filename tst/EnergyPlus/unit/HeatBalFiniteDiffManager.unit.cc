@@ -0,0 +1,63 @@
+// EnergyPlus::HeatBalFiniteDiffManager Unit Tests
+
+// C++ Headers
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/HeatBalFiniteDiffManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalFiniteDiffManager;
+using namespace ObjexxFCL;
+
+TEST( HeatBalFiniteDiffManagerTest, SolveNodeEquations )
+{
+	// Six nodes: convective outside face, R layer interface, fixed node, inside face
+	int const NumNodes( 6 );
+	FArray1D< Real64 > CoefM( NumNodes, { 0.0, 0.45, 0.5, 0.0, 0.3, 0.8 } );
+	FArray1D< Real64 > CoefP( NumNodes, { 0.6, 0.45, 0.5, 0.0, 0.3, 0.0 } );
+	FArray1D< Real64 > const Const( NumNodes, { 4.0, 1.5, 0.0, 18.0, 8.0, 4.2 } );
+	FArray1D< Real64 > CoefC( Const );
+	FArray1D< Real64 > Work( NumNodes );
+	FArray1D< Real64 > TDT( NumNodes, 0.0 );
+
+	ASSERT_TRUE( SolveNodeEquations( CoefM, CoefP, CoefC, Work, TDT ) );
+
+	// Every node equation holds
+	for ( int i = 1; i <= NumNodes; ++i ) {
+		Real64 Rhs( Const( i ) );
+		if ( i > 1 ) Rhs += CoefM( i ) * TDT( i - 1 );
+		if ( i < NumNodes ) Rhs += CoefP( i ) * TDT( i + 1 );
+		EXPECT_NEAR( Rhs, TDT( i ), 1.0e-12 );
+	}
+	EXPECT_DOUBLE_EQ( 18.0, TDT( 4 ) );
+
+	// Same result as iterating the node equations one node at a time
+	FArray1D< Real64 > TGS( NumNodes, 0.0 );
+	for ( int Iter = 1; Iter <= 500; ++Iter ) {
+		for ( int i = 1; i <= NumNodes; ++i ) {
+			Real64 T( Const( i ) );
+			if ( i > 1 ) T += CoefM( i ) * TGS( i - 1 );
+			if ( i < NumNodes ) T += CoefP( i ) * TGS( i + 1 );
+			TGS( i ) = T;
+		}
+	}
+	for ( int i = 1; i <= NumNodes; ++i ) {
+		EXPECT_NEAR( TGS( i ), TDT( i ), 1.0e-9 );
+	}
+
+	// Singular system leaves the temperatures alone
+	FArray1D< Real64 > const CoefOne( 2, 1.0 );
+	FArray1D< Real64 > CoefC2( 2, 1.0 );
+	FArray1D< Real64 > Work2( 2 );
+	FArray1D< Real64 > TDT2( 2, 20.0 );
+	EXPECT_FALSE( SolveNodeEquations( CoefOne, CoefOne, CoefC2, Work2, TDT2 ) );
+	EXPECT_EQ( 20.0, TDT2( 1 ) );
+	EXPECT_EQ( 20.0, TDT2( 2 ) );
+}
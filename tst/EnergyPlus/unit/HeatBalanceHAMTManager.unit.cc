@@ -0,0 +1,69 @@
+// EnergyPlus::HeatBalanceHAMTManager Unit Tests
+
+// C++ Headers
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/FArray2D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/HeatBalanceHAMTManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalanceHAMTManager;
+using namespace ObjexxFCL;
+
+TEST( HeatBalanceHAMTManagerTest, SolveCellEquations )
+{
+	// Five cells: fixed boundary cells at each end, a link across two cells in the middle
+	int const n( 5 );
+	int const hband( 2 );
+	int const diag( hband + 1 );
+	FArray2D< Real64 > a( n, n, 0.0 ); // Full matrix of the same equations
+	a( 1, 1 ) = 1.0;
+	a( 2, 1 ) = -0.5; a( 2, 2 ) = 2.0; a( 2, 3 ) = -0.7; a( 2, 4 ) = -0.3;
+	a( 3, 2 ) = -0.7; a( 3, 3 ) = 3.0; a( 3, 4 ) = -1.1;
+	a( 4, 2 ) = -0.3; a( 4, 3 ) = -1.1; a( 4, 4 ) = 2.5; a( 4, 5 ) = -0.9;
+	a( 5, 5 ) = 1.0;
+	FArray1D< Real64 > const x( n, { 20.0, 18.5, 16.0, 12.25, 5.0 } );
+	FArray2D< Real64 > coef( 2 * hband + 1, n, 0.0 );
+	FArray1D< Real64 > rhs( n, 0.0 );
+	for ( int i = 1; i <= n; ++i ) {
+		for ( int j = 1; j <= n; ++j ) {
+			if ( a( i, j ) == 0.0 ) continue;
+			ASSERT_LE( std::abs( j - i ), hband );
+			coef( diag + j - i, i ) = a( i, j );
+			rhs( i ) += a( i, j ) * x( j );
+		}
+	}
+
+	SolveCellEquations( n, hband, coef, rhs );
+
+	for ( int i = 1; i <= n; ++i ) {
+		EXPECT_NEAR( x( i ), rhs( i ), 1.0e-12 );
+	}
+	EXPECT_DOUBLE_EQ( 20.0, rhs( 1 ) );
+	EXPECT_DOUBLE_EQ( 5.0, rhs( 5 ) );
+
+	// Tridiagonal chain as for a single layer wall gives the same result in a wider band
+	int const m( 6 );
+	FArray2D< Real64 > tri( 3, m, 0.0 );
+	FArray2D< Real64 > wide( 5, m, 0.0 );
+	FArray1D< Real64 > rtri( m );
+	FArray1D< Real64 > rwide( m );
+	for ( int i = 1; i <= m; ++i ) {
+		tri( 2, i ) = wide( 3, i ) = 2.5 + 0.1 * i;
+		if ( i > 1 ) tri( 1, i ) = wide( 2, i ) = -1.0;
+		if ( i < m ) tri( 3, i ) = wide( 4, i ) = -1.2;
+		rtri( i ) = rwide( i ) = std::sin( double( i ) );
+	}
+	SolveCellEquations( m, 1, tri, rtri );
+	SolveCellEquations( m, 2, wide, rwide );
+	for ( int i = 1; i <= m; ++i ) {
+		EXPECT_NEAR( rtri( i ), rwide( i ), 1.0e-12 );
+	}
+}
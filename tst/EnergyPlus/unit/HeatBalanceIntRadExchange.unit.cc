@@ -0,0 +1,109 @@
+// EnergyPlus::HeatBalanceIntRadExchange Unit Tests
+
+// C++ Headers
+#include <cmath>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/FArray2D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/HeatBalanceIntRadExchange.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalanceIntRadExchange;
+using namespace ObjexxFCL;
+
+TEST( HeatBalanceIntRadExchangeTest, SymmetricLWExchange )
+{
+	// Surfaces of a sphere-like enclosure, each seeing all of them in proportion to area
+	int const N( 7 ); // Not a whole number of blocks
+	FArray1D< Real64 > A( N ), Emiss( N );
+	FArray2D< Real64 > F( N, N ), ScriptF( N, N );
+	Real64 TotalArea( 0.0 );
+	for ( int i = 1; i <= N; ++i ) {
+		A( i ) = 2.0 + 1.5 * i;
+		Emiss( i ) = ( i == 3 ? 0.84 - 0.5 : 0.9 - 0.02 * i ); // Surface 3 like a window with a shade
+		TotalArea += A( i );
+	}
+	for ( int i = 1; i <= N; ++i ) {
+		for ( int j = 1; j <= N; ++j ) {
+			F( i, j ) = A( j ) / TotalArea;
+		}
+	}
+	CalcScriptF( N, A, F, Emiss, ScriptF );
+
+	std::vector< Real64 > Sym, RowSum;
+	EXPECT_TRUE( FormSymmetricScriptF( N, A, ScriptF, 1.0, Sym, RowSum ) );
+	std::vector< Real64 > TempKTo4th( 8, 0.0 ), Exchange;
+	for ( int i = 0; i < N; ++i ) {
+		TempKTo4th[ i ] = std::pow( 290.0 + 3.0 * i - 0.4 * i * i + 273.15, 4 );
+	}
+	CalcSymmetricLWExchange( N, Sym, TempKTo4th, Exchange );
+
+	// Same as the sum over all sending surfaces, and no energy created
+	Real64 Total( 0.0 );
+	for ( int i = 1; i <= N; ++i ) {
+		Real64 Net( 0.0 ), Incident( 0.0 );
+		for ( int j = 1; j <= N; ++j ) {
+			if ( j != i ) Net += ScriptF( j, i ) * ( TempKTo4th[ j - 1 ] - TempKTo4th[ i - 1 ] ); // ScriptF is transposed
+			Incident += ScriptF( j, i ) * TempKTo4th[ j - 1 ];
+		}
+		EXPECT_NEAR( Net, Exchange[ i - 1 ] / A( i ), 1.0e-9 * std::abs( Net ) + 1.0e-6 );
+		EXPECT_NEAR( Incident, Exchange[ i - 1 ] / A( i ) + RowSum[ i - 1 ] * TempKTo4th[ i - 1 ], 1.0e-12 * Incident );
+		Total += Exchange[ i - 1 ];
+	}
+	EXPECT_NEAR( 0.0, Total, 1.0e-12 * std::abs( Exchange[ 0 ] ) );
+	EXPECT_EQ( 0.0, Exchange[ N ] ); // Padding
+
+	// Equal temperatures: no exchange
+	TempKTo4th.assign( 8, std::pow( 295.0, 4 ) );
+	TempKTo4th[ N ] = 0.0;
+	CalcSymmetricLWExchange( N, Sym, TempKTo4th, Exchange );
+	for ( int i = 0; i < N; ++i ) {
+		EXPECT_EQ( 0.0, Exchange[ i ] );
+	}
+}
+
+TEST( HeatBalanceIntRadExchangeTest, NonReciprocalLWExchange )
+{
+	// Every surface sees the others equally whatever their areas, so A(i)*F(i,j) != A(j)*F(j,i)
+	int const N( 5 );
+	FArray1D< Real64 > A( N ), Emiss( N );
+	FArray2D< Real64 > F( N, N ), ScriptF( N, N );
+	for ( int i = 1; i <= N; ++i ) {
+		A( i ) = 1.0 + 2.0 * i;
+		Emiss( i ) = 0.9 - 0.05 * i;
+		for ( int j = 1; j <= N; ++j ) {
+			F( i, j ) = 1.0 / N;
+		}
+	}
+	CalcScriptF( N, A, F, Emiss, ScriptF );
+
+	std::vector< Real64 > Sym, RowSum, Full;
+	EXPECT_FALSE( FormSymmetricScriptF( N, A, ScriptF, 1.0, Sym, RowSum ) );
+	EXPECT_TRUE( Sym.empty() );
+	EXPECT_EQ( N, int( RowSum.size() ) );
+	FormFullScriptF( N, A, ScriptF, 1.0, Full );
+	std::vector< Real64 > TempKTo4th( 8, 0.0 ), Exchange;
+	for ( int i = 0; i < N; ++i ) {
+		TempKTo4th[ i ] = std::pow( 285.0 + 4.0 * i + 273.15, 4 );
+	}
+	CalcFullLWExchange( N, Full, TempKTo4th, Exchange );
+
+	// Same as the sum over all sending surfaces with the ScriptF of each receiving surface
+	for ( int i = 1; i <= N; ++i ) {
+		Real64 Net( 0.0 ), Incident( 0.0 );
+		for ( int j = 1; j <= N; ++j ) {
+			if ( j != i ) Net += ScriptF( j, i ) * ( TempKTo4th[ j - 1 ] - TempKTo4th[ i - 1 ] ); // ScriptF is transposed
+			Incident += ScriptF( j, i ) * TempKTo4th[ j - 1 ];
+		}
+		EXPECT_NEAR( Net, Exchange[ i - 1 ] / A( i ), 1.0e-12 * std::abs( Net ) + 1.0e-6 );
+		EXPECT_NEAR( Incident, Exchange[ i - 1 ] / A( i ) + RowSum[ i - 1 ] * TempKTo4th[ i - 1 ], 1.0e-12 * Incident );
+	}
+	EXPECT_EQ( 0.0, Exchange[ N ] ); // Padding
+}
@@ -0,0 +1,232 @@
+// EnergyPlus::HeatBalanceSurfaceManager Unit Tests
+
+// C++ Headers
+#include <cmath>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/HeatBalanceSurfaceManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::DataSurfaces;
+using namespace EnergyPlus::HeatBalanceSurfaceManager;
+using namespace ObjexxFCL;
+
+TEST( HeatBalanceSurfaceManagerTest, InsideSurfExtrapolationFactor )
+{
+	std::vector< int > const SurfNums( { 1, 2, 3 } );
+	FArray1D< Real64 > const Limit( { 20.0, 21.5, 18.0 } );
+	FArray1D< Real64 > const Start( { 22.0, 20.0, 19.0 } );
+	FArray1D< Real64 > TempOlder( 3 ), TempOld( 3 ), TempNew( 3 );
+	Real64 const Tolerance( 0.002 );
+
+	// Errors shrinking by 0.9 each iteration: extrapolation lands on the limit
+	for ( int I = 1; I <= 3; ++I ) {
+		TempOlder( I ) = Limit( I ) + ( Start( I ) - Limit( I ) );
+		TempOld( I ) = Limit( I ) + 0.9 * ( Start( I ) - Limit( I ) );
+		TempNew( I ) = Limit( I ) + 0.81 * ( Start( I ) - Limit( I ) );
+	}
+	Real64 const Factor( InsideSurfExtrapolationFactor( SurfNums, TempNew, TempOld, TempOlder, Tolerance ) );
+	EXPECT_NEAR( 9.0, Factor, 1.0e-9 );
+	for ( int I = 1; I <= 3; ++I ) {
+		EXPECT_NEAR( Limit( I ), TempNew( I ) + Factor * ( TempNew( I ) - TempOld( I ) ), 1.0e-9 );
+	}
+
+	// Only the listed surfaces count
+	TempNew( 3 ) += 1.0;
+	EXPECT_EQ( 0.0, InsideSurfExtrapolationFactor( SurfNums, TempNew, TempOld, TempOlder, Tolerance ) );
+	EXPECT_NEAR( 9.0, InsideSurfExtrapolationFactor( { 1, 2 }, TempNew, TempOld, TempOlder, Tolerance ), 1.0e-9 );
+	TempNew( 3 ) -= 1.0;
+
+	// Oscillating or slowly contracting changes are left to the damped iterations
+	for ( int I = 1; I <= 3; ++I ) {
+		TempNew( I ) = Limit( I ) + 0.96 * 0.96 * ( Start( I ) - Limit( I ) );
+		TempOld( I ) = Limit( I ) + 0.96 * ( Start( I ) - Limit( I ) );
+	}
+	EXPECT_EQ( 0.0, InsideSurfExtrapolationFactor( SurfNums, TempNew, TempOld, TempOlder, Tolerance ) );
+	for ( int I = 1; I <= 3; ++I ) {
+		TempOld( I ) = Limit( I ) - 0.5 * ( Start( I ) - Limit( I ) );
+		TempNew( I ) = Limit( I ) + 0.25 * ( Start( I ) - Limit( I ) );
+	}
+	EXPECT_EQ( 0.0, InsideSurfExtrapolationFactor( SurfNums, TempNew, TempOld, TempOlder, Tolerance ) );
+
+	// Nearly converged: the regular iterations finish sooner
+	for ( int I = 1; I <= 3; ++I ) {
+		TempOlder( I ) = Limit( I ) + 0.004 * ( Start( I ) - Limit( I ) );
+		TempOld( I ) = Limit( I ) + 0.002 * ( Start( I ) - Limit( I ) );
+		TempNew( I ) = Limit( I ) + 0.001 * ( Start( I ) - Limit( I ) );
+	}
+	EXPECT_EQ( 0.0, InsideSurfExtrapolationFactor( SurfNums, TempNew, TempOld, TempOlder, Tolerance ) );
+
+	// No change at all
+	EXPECT_EQ( 0.0, InsideSurfExtrapolationFactor( SurfNums, Limit, Limit, Limit, Tolerance ) );
+}
+
+TEST( HeatBalanceSurfaceManagerTest, FindSurfHeatBalGroups )
+{
+	// Zones 1 and 3 share an interzone partition (surfaces 2 and 6), zone 2 stands alone,
+	// zone 4 has a CondFD wall
+	DataGlobals::NumOfZones = 4;
+	Zone.allocate( 4 );
+	for ( int ZoneNum = 1; ZoneNum <= 4; ++ZoneNum ) Zone( ZoneNum ).OutsideConvectionAlgo = ASHRAETARP;
+	TotSurfaces = 9;
+	Surface.allocate( 9 );
+	int const SurfZone[] = { 1, 1, 2, 2, 3, 3, 4, 4, 1 };
+	for ( int SurfNum = 1; SurfNum <= 9; ++SurfNum ) {
+		auto & surface( Surface( SurfNum ) );
+		surface.Zone = SurfZone[ SurfNum - 1 ];
+		surface.HeatTransSurf = true;
+		surface.Class = SurfaceClass_Wall;
+		surface.ExtBoundCond = ExternalEnvironment;
+		surface.HeatTransferAlgorithm = HeatTransferModel_CTF;
+	}
+	Surface( 2 ).ExtBoundCond = 6;
+	Surface( 6 ).ExtBoundCond = 2;
+	Surface( 3 ).Class = SurfaceClass_Window;
+	Surface( 4 ).ExtBoundCond = OtherSideCoefNoCalcExt;
+	Surface( 8 ).HeatTransferAlgorithm = HeatTransferModel_CondFD;
+	Surface( 9 ).HeatTransSurf = false;
+
+	FindSurfHeatBalGroups();
+
+	// Outside: serial surfaces first, then every other opaque surface on its own
+	ASSERT_EQ( 6u, OutsideSurfGroups.size() );
+	EXPECT_EQ( std::vector< int >( { 4, 8 } ), OutsideSurfGroups[ 0 ] );
+	EXPECT_EQ( std::vector< int >( { 1 } ), OutsideSurfGroups[ 1 ] );
+	EXPECT_EQ( std::vector< int >( { 7 } ), OutsideSurfGroups[ 5 ] );
+
+	// Inside: windows in the serial group, the joined zones together, the CondFD zone on its own
+	ASSERT_EQ( 4u, InsideSurfGroups.size() );
+	EXPECT_EQ( std::vector< int >( { 3 } ), InsideSurfGroups[ 0 ] );
+	EXPECT_EQ( std::vector< int >( { 1, 2, 5, 6 } ), InsideSurfGroups[ 1 ] );
+	EXPECT_EQ( std::vector< int >( { 4 } ), InsideSurfGroups[ 2 ] );
+	EXPECT_EQ( std::vector< int >( { 7, 8 } ), InsideSurfGroups[ 3 ] );
+
+	// HAMT keeps its whole zone in the serial group with the default cell by cell solver
+	Surface( 8 ).HeatTransferAlgorithm = HeatTransferModel_HAMT;
+	FindSurfHeatBalGroups();
+	ASSERT_EQ( 3u, InsideSurfGroups.size() );
+	EXPECT_EQ( std::vector< int >( { 3, 7, 8 } ), InsideSurfGroups[ 0 ] );
+
+	// With the band matrix solver HAMT zones run on their own too, but HAMT outside heat balances are serial
+	HAMTBandSolver = true;
+	FindSurfHeatBalGroups();
+	HAMTBandSolver = false;
+	EXPECT_EQ( std::vector< int >( { 4, 8 } ), OutsideSurfGroups[ 0 ] );
+	ASSERT_EQ( 4u, InsideSurfGroups.size() );
+	EXPECT_EQ( std::vector< int >( { 7, 8 } ), InsideSurfGroups[ 3 ] );
+
+	// EMPD keeps its whole zone in the serial group
+	Surface( 8 ).HeatTransferAlgorithm = HeatTransferModel_EMPD;
+	FindSurfHeatBalGroups();
+	ASSERT_EQ( 3u, InsideSurfGroups.size() );
+	EXPECT_EQ( std::vector< int >( { 3, 7, 8 } ), InsideSurfGroups[ 0 ] );
+
+	Surface.deallocate();
+	Zone.deallocate();
+	TotSurfaces = 0;
+	DataGlobals::NumOfZones = 0;
+	HeatBalanceSurfaceManager::clear_state();
+}
+
+TEST( HeatBalanceSurfaceManagerTest, UpdateThermalHistories )
+{
+	using namespace DataHeatBalSurface;
+
+	// Surface 1 has a construction on the zone time step, surface 2 one on twice the zone time step
+	DataGlobals::TimeStepZone = 0.25;
+	TotConstructs = 2;
+	Construct.allocate( 2 );
+	Construct( 1 ).NumCTFTerms = 3;
+	Construct( 1 ).NumHistories = 1;
+	Construct( 1 ).CTFTimeStep = 0.25;
+	Construct( 2 ).NumCTFTerms = 2;
+	Construct( 2 ).NumHistories = 2;
+	Construct( 2 ).CTFTimeStep = 0.5;
+	TotSurfaces = 2;
+	Surface.allocate( 2 );
+	for ( int SurfNum = 1; SurfNum <= 2; ++SurfNum ) {
+		auto & surface( Surface( SurfNum ) );
+		surface.HeatTransSurf = true;
+		surface.Class = SurfaceClass_Wall;
+		surface.ExtBoundCond = ExternalEnvironment;
+		surface.HeatTransferAlgorithm = HeatTransferModel_CTF;
+		surface.Construction = SurfNum;
+		surface.Area = 1.0;
+	}
+
+	TH.dimension( 2, 1, 2, 0.0 );
+	QH.dimension( 2, 1, 2, 0.0 );
+	TsrcHist.dimension( 1, 2, 0.0 );
+	QsrcHist.dimension( 1, 2, 0.0 );
+	TempSurfIn.dimension( 2, 0.0 );
+	TempSource.dimension( 2, 0.0 );
+	CTFConstInPart.dimension( 2, 0.0 );
+	CTFConstOutPart.dimension( 2, 0.0 );
+	OpaqSurfInsFaceConduction.dimension( 2, 0.0 );
+	OpaqSurfInsFaceConductionFlux.dimension( 2, 0.0 );
+	OpaqSurfInsFaceCondGainRep.dimension( 2, 0.0 );
+	OpaqSurfInsFaceCondLossRep.dimension( 2, 0.0 );
+	OpaqSurfOutsideFaceConduction.dimension( 2, 0.0 );
+	OpaqSurfOutsideFaceConductionFlux.dimension( 2, 0.0 );
+	SUMH.dimension( 2, 0 );
+	CTFHistLength = 3;
+	CTFHistHead.dimension( 2, 1 );
+	for ( auto Hist : { &CTFHistTOut, &CTFHistTIn, &CTFHistQOut, &CTFHistQIn, &CTFHistTsrc, &CTFHistQsrc, &CTFHistTOutM, &CTFHistTInM, &CTFHistQOutM, &CTFHistQInM, &CTFHistTsrcM, &CTFHistQsrcM } ) {
+		Hist->dimension( 2 * CTFHistLength, 2, 20.0 );
+	}
+
+	// Outside temperature histories shifted and interpolated as arrays of terms 2 to NumCTFTerms+1
+	std::vector< std::vector< Real64 > > RefTH( 2, std::vector< Real64 >( 5, 20.0 ) );
+	std::vector< std::vector< Real64 > > RefTHM( RefTH );
+	std::vector< int > RefSUMH( 2, 0 );
+	std::vector< Real64 > TempExt1( 2, 0.0 );
+	for ( int Step = 1; Step <= 7; ++Step ) {
+		for ( int SurfNum = 1; SurfNum <= 2; ++SurfNum ) {
+			TH( SurfNum, 1, 1 ) = 10.0 + Step * SurfNum + 0.1 * Step * Step;
+			TempSurfIn( SurfNum ) = 22.0 - Step;
+		}
+		int const Head1( CTFHistHead( 1 ) );
+
+		UpdateThermalHistories();
+
+		EXPECT_EQ( Head1 > 1 ? Head1 - 1 : CTFHistLength, CTFHistHead( 1 ) );
+		EXPECT_EQ( 22.0 - Step, CTFHistTIn( CTFHistHead( 1 ), 1 ) );
+		for ( int SurfNum = 1; SurfNum <= 2; ++SurfNum ) {
+			auto const & construct( Construct( SurfNum ) );
+			int const NumCTFTerms( construct.NumCTFTerms );
+			auto & RefTHs( RefTH[ SurfNum - 1 ] );
+			auto & RefTHMs( RefTHM[ SurfNum - 1 ] );
+			int & SumH( RefSUMH[ SurfNum - 1 ] );
+			if ( SumH == 0 ) TempExt1[ SurfNum - 1 ] = TH( SurfNum, 1, 1 );
+			if ( ++SumH == construct.NumHistories ) {
+				SumH = 0;
+				for ( int Term = NumCTFTerms + 1; Term >= 3; --Term ) RefTHs[ Term ] = RefTHMs[ Term ] = RefTHMs[ Term - 1 ];
+				RefTHs[ 2 ] = RefTHMs[ 2 ] = TempExt1[ SurfNum - 1 ];
+			} else {
+				Real64 const sum_steps( SumH * DataGlobals::TimeStepZone / construct.CTFTimeStep );
+				for ( int Term = NumCTFTerms + 1; Term >= 3; --Term ) RefTHs[ Term ] = RefTHMs[ Term ] - ( RefTHMs[ Term ] - RefTHMs[ Term - 1 ] ) * sum_steps;
+				RefTHs[ 2 ] = RefTHMs[ 2 ] - ( RefTHMs[ 2 ] - TempExt1[ SurfNum - 1 ] ) * sum_steps;
+			}
+			for ( int Term = 2; Term <= NumCTFTerms + 1; ++Term ) {
+				EXPECT_DOUBLE_EQ( RefTHs[ Term ], CTFHistTOut( CTFHistHead( SurfNum ) + Term - 2, SurfNum ) );
+			}
+		}
+	}
+
+	Surface.deallocate();
+	Construct.deallocate();
+	TotSurfaces = 0;
+	TotConstructs = 0;
+}
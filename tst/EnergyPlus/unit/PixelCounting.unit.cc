@@ -0,0 +1,125 @@
+// EnergyPlus::PixelCounting Unit Tests
+
+// C++ Headers
+#include <cmath>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/PixelCounting.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::PixelCounting;
+
+namespace {
+
+	void
+	AddPolygon(
+		RasterJob & Job,
+		std::vector< Real64 > const & X,
+		std::vector< Real64 > const & Y,
+		Real64 const Transmittance = 1.0
+	)
+	{
+		Job.BeginPolygon( Transmittance );
+		for ( std::size_t N = 0; N < X.size(); ++N ) {
+			Job.AddVertex( X[ N ], Y[ N ] );
+		}
+	}
+
+}
+
+TEST( PixelCountingTest, RenderRaster )
+{
+	RasterJob Job;
+
+	// 10 x 4 wall with a 2 x 2 window, clockwise as in SolarShading
+	AddPolygon( Job, { 0.0, 0.0, 10.0, 10.0 }, { 0.0, 4.0, 4.0, 0.0 } );
+	AddPolygon( Job, { 1.0, 1.0, 3.0, 3.0 }, { 1.0, 3.0, 3.0, 1.0 } );
+	Job.NumSubSurfaces = 1;
+
+	// No shadows
+	RenderRaster( Job, 64 );
+	ASSERT_EQ( 2u, Job.LitFraction.size() );
+	EXPECT_EQ( 1.0, Job.LitFraction[ 0 ] );
+	EXPECT_EQ( 1.0, Job.LitFraction[ 1 ] );
+	EXPECT_EQ( 0.0, RasterErrorBound( Job, 64 ) );
+
+	// Opaque shadow over the left half of the wall (and all of the window)
+	AddPolygon( Job, { -1.0, -1.0, 5.0, 5.0 }, { -1.0, 5.0, 5.0, -1.0 }, 0.0 );
+	RenderRaster( Job, 100 ); // Pixel edges fall on the shadow edge: exact
+	EXPECT_NEAR( 0.5, Job.LitFraction[ 0 ], 1.0e-12 );
+	EXPECT_NEAR( 0.0, Job.LitFraction[ 1 ], 1.0e-12 );
+
+	// Half-transparent shadow over the right quarter overlapping the first one
+	AddPolygon( Job, { 4.5, 4.5, 7.5, 7.5 }, { -1.0, 5.0, 5.0, -1.0 }, 0.5 );
+	RenderRaster( Job, 100 );
+	// Lit: 2.5 x 4 at 1.0 plus 2.5 x 4 at 0.5
+	EXPECT_NEAR( 0.375, Job.LitFraction[ 0 ], 1.0e-12 );
+
+	// Error bound holds at a resolution where edges cut pixels, and falls with resolution
+	RasterJob Triangle;
+	AddPolygon( Triangle, { 0.0, 0.0, 1.0, 1.0 }, { 0.0, 1.0, 1.0, 0.0 } );
+	AddPolygon( Triangle, { 0.0, 0.0, 1.0 }, { 0.0, 1.0, 0.0 }, 0.0 ); // Shades half of the square
+	Real64 PreviousBound( 2.0 );
+	for ( int Resolution = 8; Resolution <= 512; Resolution *= 4 ) {
+		RenderRaster( Triangle, Resolution );
+		Real64 const Bound( RasterErrorBound( Triangle, Resolution ) );
+		EXPECT_LE( std::abs( Triangle.LitFraction[ 0 ] - 0.5 ), Bound );
+		EXPECT_LT( Bound, PreviousBound );
+		PreviousBound = Bound;
+	}
+	EXPECT_LT( PreviousBound, 0.025 );
+}
+
+TEST( PixelCountingTest, SmallPolygons )
+{
+	RasterJob Job;
+
+	// Subsurface smaller than a pixel takes the value at its centre
+	AddPolygon( Job, { 0.0, 0.0, 10.0, 10.0 }, { 0.0, 10.0, 10.0, 0.0 } );
+	AddPolygon( Job, { 1.01, 1.01, 1.02, 1.02 }, { 1.01, 1.02, 1.02, 1.01 } );
+	AddPolygon( Job, { 8.01, 8.01, 8.02, 8.02 }, { 8.01, 8.02, 8.02, 8.01 } );
+	Job.NumSubSurfaces = 2;
+	AddPolygon( Job, { 0.0, 0.0, 5.0, 5.0 }, { 0.0, 5.0, 5.0, 0.0 }, 0.25 );
+	RenderRaster( Job, 16 );
+	EXPECT_EQ( 0.25, Job.LitFraction[ 1 ] );
+	EXPECT_EQ( 1.0, Job.LitFraction[ 2 ] );
+
+	EXPECT_EQ( 0.25, PointTransmittance( Job, 2.0, 2.0 ) );
+	EXPECT_EQ( 1.0, PointTransmittance( Job, 6.0, 2.0 ) );
+
+	Job.clear();
+	EXPECT_EQ( 0, Job.NumPolygons() );
+}
+
+TEST( PixelCountingTest, ReweightRaster )
+{
+	RasterJob Job;
+
+	AddPolygon( Job, { 0.0, 0.0, 10.0, 10.0 }, { 0.0, 4.0, 4.0, 0.0 } );
+	AddPolygon( Job, { 1.0, 1.0, 3.0, 3.0 }, { 1.0, 3.0, 3.0, 1.0 } );
+	AddPolygon( Job, { 9.01, 9.01, 9.02, 9.02 }, { 2.01, 2.02, 2.02, 2.01 } ); // Smaller than a pixel
+	Job.NumSubSurfaces = 2;
+	AddPolygon( Job, { -1.0, -1.0, 5.0, 5.0 }, { -1.0, 5.0, 5.0, -1.0 }, 0.0 );
+	AddPolygon( Job, { 2.0, 2.0, 9.5, 9.5 }, { -1.0, 5.0, 5.0, -1.0 }, 1.0 ); // Transparent for now
+	Job.FindCoverSets = true;
+	RenderRaster( Job, 100 );
+	EXPECT_NEAR( 0.5, Job.LitFraction[ 0 ], 1.0e-12 );
+	EXPECT_EQ( 4u, Job.CoverSets.size() ); // None, first, both, second
+
+	// New transmittances give the same result as rendering again
+	Job.Transmittance[ 3 ] = 0.5;
+	Job.Transmittance[ 4 ] = 0.25;
+	ReweightRaster( Job );
+	std::vector< Real64 > const Reweighted( Job.LitFraction );
+	Job.FindCoverSets = false;
+	RenderRaster( Job, 100 );
+	ASSERT_EQ( Job.LitFraction.size(), Reweighted.size() );
+	for ( std::size_t Polygon = 0; Polygon < Reweighted.size(); ++Polygon ) {
+		EXPECT_NEAR( Job.LitFraction[ Polygon ], Reweighted[ Polygon ], 1.0e-12 );
+	}
+	EXPECT_EQ( 0.25, Reweighted[ 2 ] );
+}
@@ -0,0 +1,129 @@
+// EnergyPlus::PolygonClipping Unit Tests
+
+// C++ Headers
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/PolygonClipping.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::PolygonClipping;
+
+namespace {
+
+	// Figure in homogeneous coordinates laid out like a column of the SolarShading HC arrays
+	struct HCFigure
+	{
+		std::vector< Int64 > X;
+		std::vector< Int64 > Y;
+		std::vector< Int64 > A;
+		std::vector< Int64 > B;
+		std::vector< Int64 > C;
+		int NumVertices;
+		Real64 TwiceArea;
+
+		HCFigure(
+			std::vector< Int64 > const & XV,
+			std::vector< Int64 > const & YV
+		) :
+			X( 16, 0 ),
+			Y( 16, 0 ),
+			A( 16, 0 ),
+			B( 16, 0 ),
+			C( 16, 0 ),
+			NumVertices( int( XV.size() ) )
+		{
+			for ( int N = 0; N < NumVertices; ++N ) {
+				X[ N ] = XV[ N ];
+				Y[ N ] = YV[ N ];
+			}
+			TwiceArea = HCSidesAndArea( X.data(), Y.data(), NumVertices, A.data(), B.data(), C.data() );
+		}
+	};
+
+	int
+	Clip(
+		HCFigure const & Subject,
+		HCFigure const & Clipper,
+		ClipWorkspace & Work,
+		bool & Intersected
+	)
+	{
+		return ClipPolygon( Subject.X.data(), Subject.Y.data(), Subject.A.data(), Subject.B.data(), Subject.C.data(), Subject.NumVertices, Clipper.A.data(), Clipper.B.data(), Clipper.C.data(), Clipper.NumVertices, Work, Intersected );
+	}
+
+}
+
+TEST( PolygonClippingTest, SidesAndArea )
+{
+	// Clockwise 100 x 100 square
+	HCFigure Square( { 0, 0, 100, 100 }, { 0, 100, 100, 0 } );
+
+	EXPECT_DOUBLE_EQ( -20000.0, Square.TwiceArea );
+	EXPECT_EQ( 0, Square.X[ 4 ] ); // Wrap-around vertex
+	EXPECT_EQ( 0, Square.Y[ 4 ] );
+	EXPECT_EQ( -100, Square.A[ 0 ] );
+	EXPECT_EQ( 0, Square.B[ 0 ] );
+	EXPECT_EQ( 0, Square.C[ 0 ] );
+	EXPECT_EQ( 0, Square.A[ 1 ] );
+	EXPECT_EQ( 100, Square.B[ 1 ] );
+	EXPECT_EQ( -10000, Square.C[ 1 ] );
+}
+
+TEST( PolygonClippingTest, ClipPolygon )
+{
+	ClipWorkspace Work;
+	bool Intersected;
+
+	HCFigure Square( { 0, 0, 100, 100 }, { 0, 100, 100, 0 } );
+
+	// Partial overlap with a square offset by half its size
+	HCFigure Offset( { 50, 50, 150, 150 }, { 50, 150, 150, 50 } );
+	int NV = Clip( Square, Offset, Work, Intersected );
+	ASSERT_EQ( 4, NV );
+	EXPECT_TRUE( Intersected );
+	HCFigure Overlap( std::vector< Int64 >( Work.X.begin(), Work.X.begin() + NV ), std::vector< Int64 >( Work.Y.begin(), Work.Y.begin() + NV ) );
+	EXPECT_DOUBLE_EQ( -5000.0, Overlap.TwiceArea );
+	for ( int N = 0; N < NV; ++N ) {
+		EXPECT_TRUE( Work.X[ N ] == 50.0 || Work.X[ N ] == 100.0 );
+		EXPECT_TRUE( Work.Y[ N ] == 50.0 || Work.Y[ N ] == 100.0 );
+	}
+
+	// Triangle entirely within the square is returned unchanged
+	HCFigure Triangle( { 10, 20, 30 }, { 10, 40, 10 } );
+	NV = Clip( Triangle, Square, Work, Intersected );
+	ASSERT_EQ( 3, NV );
+	EXPECT_FALSE( Intersected );
+	for ( int N = 0; N < NV; ++N ) {
+		EXPECT_EQ( Real64( Triangle.X[ N ] ), Work.X[ N ] );
+		EXPECT_EQ( Real64( Triangle.Y[ N ] ), Work.Y[ N ] );
+	}
+
+	// Square clipped by the triangle is the triangle
+	NV = Clip( Square, Triangle, Work, Intersected );
+	EXPECT_EQ( 3, NV );
+	EXPECT_TRUE( Intersected );
+
+	// Disjoint figures
+	HCFigure Far( { 500, 500, 600, 600 }, { 0, 100, 100, 0 } );
+	NV = Clip( Square, Far, Work, Intersected );
+	EXPECT_EQ( 0, NV );
+
+	// Intercepts are rounded to integer HC coordinates (3.5 -> 4)
+	HCFigure Sliver( { 0, 0, 7 }, { 0, 100, 0 } );
+	HCFigure Half( { 0, 0, 100, 100 }, { 0, 50, 50, 0 } );
+	NV = Clip( Sliver, Half, Work, Intersected );
+	ASSERT_EQ( 4, NV );
+	EXPECT_EQ( 0.0, Work.X[ 1 ] );
+	EXPECT_EQ( 50.0, Work.Y[ 1 ] );
+	EXPECT_EQ( 4.0, Work.X[ 2 ] );
+	EXPECT_EQ( 50.0, Work.Y[ 2 ] );
+
+	// Vertices within two HC units of one another are merged
+	HCFigure Narrow( { 0, 0, 3 }, { 0, 100, 0 } );
+	NV = Clip( Narrow, Half, Work, Intersected );
+	EXPECT_EQ( 3, NV );
+}
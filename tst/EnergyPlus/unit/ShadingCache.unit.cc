@@ -0,0 +1,204 @@
+// EnergyPlus::ShadingCache Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/ShadingCache.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ShadingCache;
+
+TEST( ShadingCacheTest, HashValue )
+{
+	EXPECT_EQ( HashValue( HashSeed, 0.0 ), HashValue( HashSeed, -0.0 ) );
+	EXPECT_NE( HashValue( HashSeed, 1.0 ), HashValue( HashSeed, 1.0 + 1.0e-15 ) );
+	EXPECT_NE( HashValue( HashValue( HashSeed, 1 ), 2 ), HashValue( HashValue( HashSeed, 2 ), 1 ) );
+}
+
+TEST( ShadingCacheTest, ReuseAndInvalidation )
+{
+	std::string const FileName( "ShadingCacheTest.shdcache" );
+
+	std::vector< std::uint64_t > Keys( NumCacheKeys, HashSeed );
+	for ( int Key = 0; Key < NumCacheKeys; ++Key ) {
+		Keys[ Key ] = HashValue( HashSeed, Key );
+	}
+
+	ShadingRecord Record;
+	Record.Reals = { 0.25, 1.0, -3.5 };
+	Record.Ints = { 2, 7, 9 };
+
+	// First run starts a new file, named for the keys
+	OpenShadingCache( FileName, Keys );
+	std::string const KeyedName( CacheFileName );
+	EXPECT_EQ( FileName + '.', KeyedName.substr( 0, FileName.size() + 1 ) );
+	std::remove( KeyedName.c_str() );
+	OpenShadingCache( FileName, Keys );
+	EXPECT_EQ( CacheCreated, CacheStatus );
+	EXPECT_FALSE( GetShadingRecord( 42, Record ) );
+	SaveShadingRecord( 42, Record );
+	SaveShadingRecord( 43, ShadingRecord() );
+	SaveShadingRecord( 42, Record ); // Already stored
+	EXPECT_EQ( 2, NumRecordsComputed );
+	CloseShadingCache();
+
+	// Same keys: records are read back
+	OpenShadingCache( FileName, Keys );
+	EXPECT_EQ( CacheReused, CacheStatus );
+	EXPECT_EQ( 2, NumRecordsAvailable );
+	ShadingRecord Stored;
+	ASSERT_TRUE( GetShadingRecord( 42, Stored ) );
+	EXPECT_EQ( Record.Reals, Stored.Reals );
+	EXPECT_EQ( Record.Ints, Stored.Ints );
+	ASSERT_TRUE( GetShadingRecord( 43, Stored ) );
+	EXPECT_TRUE( Stored.Reals.empty() );
+	EXPECT_TRUE( Stored.Ints.empty() );
+	EXPECT_EQ( 2, NumRecordsReused );
+
+	// Records added in a later run are kept too
+	SaveShadingRecord( 44, Record );
+	CloseShadingCache();
+	OpenShadingCache( FileName, Keys );
+	EXPECT_EQ( CacheReused, CacheStatus );
+	EXPECT_EQ( 3, NumRecordsAvailable );
+	CloseShadingCache();
+
+	// Changed location: a file of its own, leaving the records of the first keys alone
+	std::vector< std::uint64_t > MovedKeys( Keys );
+	MovedKeys[ KeyLocation ] = HashValue( MovedKeys[ KeyLocation ], 1.0 );
+	OpenShadingCache( FileName, MovedKeys );
+	std::string const MovedName( CacheFileName );
+	EXPECT_NE( KeyedName, MovedName );
+	std::remove( MovedName.c_str() );
+	OpenShadingCache( FileName, MovedKeys );
+	EXPECT_EQ( CacheCreated, CacheStatus );
+	EXPECT_FALSE( GetShadingRecord( 42, Stored ) );
+	SaveShadingRecord( 42, Record );
+	CloseShadingCache();
+	OpenShadingCache( FileName, Keys );
+	EXPECT_EQ( CacheReused, CacheStatus );
+	EXPECT_EQ( 3, NumRecordsAvailable );
+	CloseShadingCache();
+
+	// Interrupted write of the last record
+	{
+		std::ofstream Partial( KeyedName, std::ios::out | std::ios::binary | std::ios::app );
+		std::uint64_t const RecordKey( 45 );
+		std::uint64_t const NumReals( 100 );
+		Partial.write( reinterpret_cast< char const * >( &RecordKey ), sizeof( RecordKey ) );
+		Partial.write( reinterpret_cast< char const * >( &NumReals ), sizeof( NumReals ) );
+	}
+	OpenShadingCache( FileName, Keys );
+	EXPECT_EQ( CacheInvalidated, CacheStatus );
+	EXPECT_EQ( "cache file is incomplete", StatusReason );
+	CloseShadingCache();
+
+	DisableShadingCache( "test" );
+	EXPECT_EQ( CacheDisabled, CacheStatus );
+	EXPECT_FALSE( GetShadingRecord( 42, Stored ) );
+
+	std::remove( KeyedName.c_str() );
+	std::remove( ( KeyedName + ".lock" ).c_str() );
+	std::remove( MovedName.c_str() );
+	std::remove( ( MovedName + ".lock" ).c_str() );
+}
+
+TEST( ShadingCacheTest, RecordFile )
+{
+	std::string const FileName( "ShadingCacheTest.ctfcache" );
+
+	RecordFile File( "EPTEST", { "options changed" } );
+	std::vector< std::uint64_t > const Keys( 1, HashValue( HashSeed, 1 ) );
+	ShadingRecord Record;
+	Record.Reals = { 0.5, -2.0 };
+	Record.Ints = { 3 };
+
+	OpenRecordFile( File, FileName, Keys );
+	std::string const KeyedName( File.FileName );
+	std::remove( KeyedName.c_str() );
+	OpenRecordFile( File, FileName, Keys );
+	EXPECT_EQ( CacheCreated, File.Status );
+	SaveRecord( File, 7, Record );
+	ShadingRecord Stored;
+	ASSERT_TRUE( GetRecord( File, 7, Stored ) ); // Readable before it is written
+	EXPECT_EQ( Record.Reals, Stored.Reals );
+	CloseRecordFile( File );
+
+	OpenRecordFile( File, FileName, Keys );
+	EXPECT_EQ( CacheReused, File.Status );
+	ASSERT_TRUE( GetRecord( File, 7, Stored ) );
+	EXPECT_EQ( Record.Reals, Stored.Reals );
+	EXPECT_EQ( Record.Ints, Stored.Ints );
+	EXPECT_EQ( 1, File.NumRecordsReused );
+	CloseRecordFile( File );
+
+	// Two runs sharing the file at the same time both keep their records
+	RecordFile Other( "EPTEST", { "options changed" } );
+	OpenRecordFile( File, FileName, Keys );
+	OpenRecordFile( Other, FileName, Keys );
+	EXPECT_EQ( KeyedName, Other.FileName );
+	SaveRecord( File, 8, Record );
+	SaveRecord( Other, 9, Record );
+	SaveRecord( Other, 8, ShadingRecord() );
+	CloseRecordFile( File );
+	ASSERT_TRUE( GetRecord( Other, 8, Stored ) );
+	EXPECT_TRUE( Stored.Reals.empty() ); // Its own record until it is closed
+	CloseRecordFile( Other );
+	OpenRecordFile( File, FileName, Keys );
+	EXPECT_EQ( CacheReused, File.Status );
+	EXPECT_EQ( 3, File.NumRecordsAvailable );
+	ASSERT_TRUE( GetRecord( File, 8, Stored ) );
+	EXPECT_EQ( Record.Reals, Stored.Reals ); // The first one written is kept
+	CloseRecordFile( File );
+
+	// Changed options use a file of their own
+	OpenRecordFile( File, FileName, { HashValue( HashSeed, 2 ) } );
+	std::string const ChangedName( File.FileName );
+	EXPECT_NE( KeyedName, ChangedName );
+	CloseRecordFile( File );
+	OpenRecordFile( File, FileName, Keys );
+	EXPECT_EQ( CacheReused, File.Status );
+	CloseRecordFile( File );
+
+	// A file of another kind is not read
+	std::vector< std::uint64_t > const ShadingKeys( NumCacheKeys, HashSeed );
+	OpenShadingCache( FileName, ShadingKeys );
+	std::string const ShadingName( CacheFileName );
+	CloseShadingCache();
+	{
+		std::ifstream Source( KeyedName, std::ios::in | std::ios::binary );
+		std::ofstream Copy( ShadingName, std::ios::out | std::ios::binary | std::ios::trunc );
+		Copy << Source.rdbuf();
+	}
+	OpenShadingCache( FileName, ShadingKeys );
+	EXPECT_EQ( CacheInvalidated, CacheStatus );
+	EXPECT_EQ( "not a cache file of this kind", StatusReason );
+	CloseShadingCache();
+
+	// Counts too large for the file are an incomplete file, not an allocation
+	{
+		std::ofstream Corrupt( KeyedName, std::ios::out | std::ios::binary | std::ios::app );
+		std::uint64_t const RecordKey( 10 );
+		std::uint64_t const NumReals( std::uint64_t( 1 ) << 61 );
+		std::uint64_t const NumInts( 0 );
+		Corrupt.write( reinterpret_cast< char const * >( &RecordKey ), sizeof( RecordKey ) );
+		Corrupt.write( reinterpret_cast< char const * >( &NumReals ), sizeof( NumReals ) );
+		Corrupt.write( reinterpret_cast< char const * >( &NumInts ), sizeof( NumInts ) );
+	}
+	OpenRecordFile( File, FileName, Keys );
+	EXPECT_EQ( CacheInvalidated, File.Status );
+	EXPECT_EQ( "cache file is incomplete", File.StatusReason );
+	EXPECT_FALSE( GetRecord( File, 10, Stored ) );
+	CloseRecordFile( File );
+
+	for ( auto const & Name : { KeyedName, ChangedName, ShadingName } ) {
+		std::remove( Name.c_str() );
+		std::remove( ( Name + ".lock" ).c_str() );
+	}
+}
@@ -103,3 +103,38 @@ TEST( CalcPerSolarBeamTest, Test1 )
 	OverlapAreas.deallocate();
 
 }
+
+TEST( ReweightSkyDifShadingTest, NoScheduledCasters )
+{
+// A scheduled shading surface that shades no sky patch job leaves the ratios of SkyDifSolarShading
+
+	int const NumTimeSteps( 4 );
+
+	TotSurfaces = 2;
+	Surface.allocate( TotSurfaces );
+	Surface( 1 ).HeatTransSurf = true;
+	Surface( 2 ).HeatTransSurf = false;
+	Surface( 2 ).SchedShadowSurfIndex = 1;
+	SkyPatchRasters.clear();
+	DifShdgRatioIsoSky.dimension( TotSurfaces, 0.0 );
+	DifShdgRatioHoriz.dimension( TotSurfaces, 0.0 );
+	DifShdgRatioIsoSky( 1 ) = 0.6;
+	DifShdgRatioHoriz( 1 ) = 0.4;
+	DifShdgRatioIsoSkyHRTS.dimension( TotSurfaces, 24, NumTimeSteps, -1.0 );
+	DifShdgRatioHorizHRTS.dimension( TotSurfaces, 24, NumTimeSteps, -1.0 );
+
+	ReweightSkyDifShading( 12, 2 );
+
+	EXPECT_DOUBLE_EQ( 0.6, DifShdgRatioIsoSkyHRTS( 1, 12, 2 ) );
+	EXPECT_DOUBLE_EQ( 0.4, DifShdgRatioHorizHRTS( 1, 12, 2 ) );
+	EXPECT_DOUBLE_EQ( 0.0, DifShdgRatioIsoSkyHRTS( 2, 12, 2 ) );
+	EXPECT_DOUBLE_EQ( 0.0, DifShdgRatioHorizHRTS( 2, 12, 2 ) );
+	EXPECT_DOUBLE_EQ( 0.6, DifShdgRatioIsoSky( 1 ) );
+
+	Surface.deallocate();
+	DifShdgRatioIsoSky.deallocate();
+	DifShdgRatioHoriz.deallocate();
+	DifShdgRatioIsoSkyHRTS.deallocate();
+	DifShdgRatioHorizHRTS.deallocate();
+	SolarShading::clear_state();
+}
@@ -0,0 +1,107 @@
+// EnergyPlus::SurfaceBVH Unit Tests
+
+// C++ Headers
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/SurfaceBVH.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataSurfaces;
+using namespace EnergyPlus::SurfaceBVH;
+using DataVectorTypes::Vector;
+
+namespace {
+
+	// Unit square in the plane z = Z, offset by X along the x axis
+	void
+	SetupHorizontalSquare(
+		int const SurfNum,
+		Real64 const X,
+		Real64 const Z
+	)
+	{
+		Surface( SurfNum ).Sides = 4;
+		Surface( SurfNum ).Vertex.dimension( 4 );
+		Surface( SurfNum ).Vertex( 1 ) = Vector( X, 1.0, Z );
+		Surface( SurfNum ).Vertex( 2 ) = Vector( X, 0.0, Z );
+		Surface( SurfNum ).Vertex( 3 ) = Vector( X + 1.0, 0.0, Z );
+		Surface( SurfNum ).Vertex( 4 ) = Vector( X + 1.0, 1.0, Z );
+	}
+
+}
+
+TEST( SurfaceBVHTest, RayAndHalfSpaceQueries )
+{
+	// Row of 20 squares at increasing height plus one surface with no geometry
+	TotSurfaces = 21;
+	Surface.allocate( TotSurfaces );
+	for ( int SurfNum = 1; SurfNum <= 20; ++SurfNum ) {
+		SetupHorizontalSquare( SurfNum, 2.0 * ( SurfNum - 1 ), 0.5 * SurfNum );
+	}
+	Surface( 21 ).Sides = 0;
+
+	BuildSurfaceBVH();
+	EXPECT_EQ( SurfaceGeometryGeneration, GenerationInTree );
+	EXPECT_EQ( 20u, SurfaceOrder.size() );
+
+	std::vector< int > SurfNums;
+
+	// Vertical ray up through the middle of square 5 only
+	SurfacesAlongRay( Vector( 8.5, 0.5, -1.0 ), Vector( 0.0, 0.0, 1.0 ), SurfNums );
+	ASSERT_EQ( 1u, SurfNums.size() );
+	EXPECT_EQ( 5, SurfNums[ 0 ] );
+
+	// Same ray pointing down misses everything
+	SurfacesAlongRay( Vector( 8.5, 0.5, -1.0 ), Vector( 0.0, 0.0, -1.0 ), SurfNums );
+	EXPECT_TRUE( SurfNums.empty() );
+
+	// Horizontal ray along the row at y = 0.5, z = 3.0 only meets square 6 (z = 3.0)
+	SurfacesAlongRay( Vector( -1.0, 0.5, 3.0 ), Vector( 1.0, 0.0, 0.0 ), SurfNums );
+	ASSERT_EQ( 1u, SurfNums.size() );
+	EXPECT_EQ( 6, SurfNums[ 0 ] );
+
+	// Everything above z = 7.2 and to the left of x = 29.5 is only square 15
+	std::vector< HalfSpace > Planes;
+	Planes.push_back( HalfSpace( Vector( 0.0, 0.0, 1.0 ), Vector( 0.0, 0.0, 7.2 ), 0.0 ) );
+	Planes.push_back( HalfSpace( Vector( -1.0, 0.0, 0.0 ), Vector( 29.5, 0.0, 0.0 ), 0.0 ) );
+	SurfacesInHalfSpaces( Planes, SurfNums );
+	ASSERT_EQ( 1u, SurfNums.size() );
+	EXPECT_EQ( 15, SurfNums[ 0 ] );
+
+	// Results are in ascending surface order
+	Planes.pop_back();
+	SurfacesInHalfSpaces( Planes, SurfNums );
+	ASSERT_EQ( 6u, SurfNums.size() );
+	for ( std::size_t i = 0; i < SurfNums.size(); ++i ) {
+		EXPECT_EQ( 15 + int( i ), SurfNums[ i ] );
+	}
+
+	// New geometry with the same number of surfaces is picked up once its generation moves on
+	SetupHorizontalSquare( 5, 100.0, 2.5 );
+	++SurfaceGeometryGeneration;
+	SurfacesAlongRay( Vector( 8.5, 0.5, -1.0 ), Vector( 0.0, 0.0, 1.0 ), SurfNums );
+	EXPECT_TRUE( SurfNums.empty() );
+	SurfacesAlongRay( Vector( 100.5, 0.5, -1.0 ), Vector( 0.0, 0.0, 1.0 ), SurfNums );
+	ASSERT_EQ( 1u, SurfNums.size() );
+	EXPECT_EQ( 5, SurfNums[ 0 ] );
+
+	// After clear_state the next query builds the hierarchy again
+	clear_state();
+	EXPECT_EQ( -1, GenerationInTree );
+	EXPECT_TRUE( Node.empty() );
+	SetupHorizontalSquare( 5, 8.0, 2.5 );
+	SurfacesAlongRay( Vector( 8.5, 0.5, -1.0 ), Vector( 0.0, 0.0, 1.0 ), SurfNums );
+	ASSERT_EQ( 1u, SurfNums.size() );
+	EXPECT_EQ( 5, SurfNums[ 0 ] );
+
+	Surface.deallocate();
+	TotSurfaces = 0;
+	BuildSurfaceBVH();
+	EXPECT_TRUE( Node.empty() );
+	clear_state();
+}
@@ -0,0 +1,119 @@
+// EnergyPlus::WindowComplexManager Unit Tests
+
+// C++ Headers
+#include <cstdint>
+#include <limits>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/FArray2D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/WindowComplexManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::WindowComplexManager;
+using namespace ObjexxFCL;
+
+TEST( WindowComplexManagerTest, BSDFMatrixSums )
+{
+	// Banded 4 x 3 matrix with an empty column
+	FArray2D< Real64 > Mat( 4, 3, 0.0 );
+	Mat( 1, 1 ) = 0.5;
+	Mat( 2, 1 ) = 0.25;
+	Mat( 2, 3 ) = 1.0;
+	Mat( 4, 3 ) = 2.0;
+	FArray1D< Real64 > RowWt( 4 );
+	RowWt = { 1.0, 2.0, 3.0, 4.0 };
+	FArray1D< Real64 > ColWt( 3 );
+	ColWt = { 0.5, 7.0, 0.25 };
+
+	FArray1D< Real64 > ColSums;
+	BSDFColumnSums( Mat, RowWt, ColSums );
+	ASSERT_EQ( 3u, ColSums.size() );
+	EXPECT_DOUBLE_EQ( 1.0, ColSums( 1 ) );
+	EXPECT_DOUBLE_EQ( 0.0, ColSums( 2 ) );
+	EXPECT_DOUBLE_EQ( 10.0, ColSums( 3 ) );
+
+	FArray1D< Real64 > RowSums;
+	BSDFRowSums( Mat, ColWt, RowSums );
+	ASSERT_EQ( 4u, RowSums.size() );
+	EXPECT_DOUBLE_EQ( 0.25, RowSums( 1 ) );
+	EXPECT_DOUBLE_EQ( 0.375, RowSums( 2 ) );
+	EXPECT_DOUBLE_EQ( 0.0, RowSums( 3 ) );
+	EXPECT_DOUBLE_EQ( 0.5, RowSums( 4 ) );
+
+	FArray1D_int First;
+	FArray1D_int Last;
+	FindBSDFBands( Mat, First, Last );
+	EXPECT_EQ( 1, First( 1 ) );
+	EXPECT_EQ( 2, Last( 1 ) );
+	EXPECT_GT( First( 2 ), Last( 2 ) ); // Empty column
+	EXPECT_EQ( 2, First( 3 ) );
+	EXPECT_EQ( 4, Last( 3 ) );
+
+	// Sums over the band of a column match the sums over the whole column
+	for ( int K = 1; K <= 3; ++K ) {
+		Real64 Sum( 0.0 );
+		for ( int I = First( K ); I <= Last( K ); ++I ) {
+			Sum += RowWt( I ) * Mat( I, K );
+		}
+		EXPECT_EQ( ColSums( K ), Sum );
+	}
+}
+
+TEST( WindowComplexManagerTest, TARCOGSolutionStore )
+{
+	EXPECT_EQ( 0, TARCOGBin( 0.04, 0.1 ) );
+	EXPECT_EQ( 2931, TARCOGBin( 293.12, 0.1 ) );
+	EXPECT_EQ( -3, TARCOGBin( -2.6, 1.0 ) );
+	EXPECT_EQ( 4, TARCOGBinDistance( { 1, 5, 2 }, { 2, 1, 2 } ) );
+	EXPECT_EQ( std::numeric_limits< std::int64_t >::max(), TARCOGBinDistance( { 1 }, { 1, 2 } ) );
+
+	TARCOGSystemSolutions System;
+	std::int64_t Distance( 0 );
+	EXPECT_EQ( -1, FindTARCOGSolution( System, { 1, 2 }, Distance ) );
+
+	TARCOGSolution Solution;
+	Solution.Bins = { 10, 20 };
+	Solution.Theta = { 280.0, 290.0 };
+	SaveTARCOGSolution( System, Solution );
+	Solution.Bins = { 14, 20 };
+	Solution.Theta = { 281.0, 291.0 };
+	SaveTARCOGSolution( System, Solution );
+
+	// Same bands
+	EXPECT_EQ( 1, FindTARCOGSolution( System, { 14, 20 }, Distance ) );
+	EXPECT_EQ( 0, Distance );
+	// Closest
+	EXPECT_EQ( 0, FindTARCOGSolution( System, { 11, 19 }, Distance ) );
+	EXPECT_EQ( 1, Distance );
+
+	// Same bands replace the stored solution
+	Solution.Theta = { 282.0, 292.0 };
+	SaveTARCOGSolution( System, Solution );
+	ASSERT_EQ( 2u, System.Solutions.size() );
+	EXPECT_EQ( 282.0, System.Solutions[ 1 ].Theta[ 0 ] );
+
+	// Oldest solution is replaced once the store is full
+	for ( std::size_t I = System.Solutions.size(); I <= MaxTARCOGSolutions; ++I ) {
+		Solution.Bins = { 100 + std::int64_t( I ), 0 };
+		SaveTARCOGSolution( System, Solution );
+	}
+	EXPECT_EQ( MaxTARCOGSolutions, System.Solutions.size() );
+	EXPECT_EQ( MaxTARCOGSolutions, System.Index.size() );
+	EXPECT_NE( 0, FindTARCOGSolution( System, { 10, 20 }, Distance ) );
+	EXPECT_NE( 0, Distance );
+	EXPECT_EQ( 0, FindTARCOGSolution( System, { 100 + std::int64_t( MaxTARCOGSolutions ), 0 }, Distance ) );
+	EXPECT_EQ( 0, Distance );
+
+	// Stored solutions and counters of the module are dropped by clear_state
+	SaveTARCOGSolution( TARCOGSolutions[ 1 ], Solution );
+	NumTARCOGSolved = 1;
+	clear_state();
+	EXPECT_TRUE( TARCOGSolutions.empty() );
+	EXPECT_EQ( 0, NumTARCOGSolved );
+}
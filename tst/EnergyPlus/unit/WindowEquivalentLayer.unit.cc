@@ -0,0 +1,67 @@
+// EnergyPlus::WindowEquivalentLayer Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray2D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataWindowEquivalentLayer.hh>
+#include <EnergyPlus/WindowEquivalentLayer.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataWindowEquivalentLayer;
+using namespace EnergyPlus::WindowEquivalentLayer;
+using namespace ObjexxFCL;
+
+TEST( WindowEquivalentLayer, GetEQLWindowOpticalPropertySharedTest )
+{
+	// Single clear glazing
+	CFS.allocate( 1 );
+	CFS( 1 ).NL = 1;
+	CFS( 1 ).L( 1 ).LTYPE = ltyGLAZE;
+	CFS( 1 ).L( 1 ).SWP_EL.RHOSFBB = 0.08;
+	CFS( 1 ).L( 1 ).SWP_EL.RHOSBBB = 0.08;
+	CFS( 1 ).L( 1 ).SWP_EL.TAUSFBB = 0.83;
+	CFS( 1 ).L( 1 ).SWP_EL.TAUSBBB = 0.83;
+	CFS( 1 ).L( 1 ).SWP_EL.RHOSFDD = 0.14;
+	CFS( 1 ).L( 1 ).SWP_EL.RHOSBDD = 0.14;
+	CFS( 1 ).L( 1 ).SWP_EL.TAUS_DD = 0.72;
+
+	DataGlobals::DayOfSim = 1;
+	DataGlobals::HourOfDay = 12;
+	DataGlobals::TimeStep = 1;
+	Real64 const IncA( 0.6 );
+	Real64 const VProfA( 0.4 );
+	Real64 const HProfA( 0.3 );
+
+	// What each window got before the properties were shared
+	FArray2D< Real64 > AbsCalc( CFSMAXNL + 1, 2 );
+	CalcEQLWindowOpticalProperty( CFS( 1 ), isBEAM, AbsCalc, IncA, VProfA, HProfA );
+
+	// Two windows of the construction seeing the sun at the same angles
+	int const NumCalculated( NumEQLOpticsCalculated );
+	int const NumReused( NumEQLOpticsReused );
+	FArray2D< Real64 > AbsWin1( CFSMAXNL + 1, 2, -1.0 );
+	FArray2D< Real64 > AbsWin2( CFSMAXNL + 1, 2, -1.0 );
+	GetEQLWindowOpticalProperty( 1, isBEAM, AbsWin1, IncA, VProfA, HProfA );
+	GetEQLWindowOpticalProperty( 1, isBEAM, AbsWin2, IncA, VProfA, HProfA );
+	EXPECT_EQ( NumCalculated + 1, NumEQLOpticsCalculated );
+	EXPECT_EQ( NumReused + 1, NumEQLOpticsReused );
+	for ( int I = 1; I <= CFSMAXNL + 1; ++I ) {
+		for ( int J = 1; J <= 2; ++J ) {
+			EXPECT_EQ( AbsCalc( I, J ), AbsWin1( I, J ) );
+			EXPECT_EQ( AbsCalc( I, J ), AbsWin2( I, J ) );
+		}
+	}
+	EXPECT_GT( AbsWin1( 2, 1 ), 0.0 ); // Beam-beam transmittance
+
+	// Other angles are calculated
+	GetEQLWindowOpticalProperty( 1, isBEAM, AbsWin2, IncA + 0.1, VProfA, HProfA );
+	EXPECT_EQ( NumCalculated + 2, NumEQLOpticsCalculated );
+	EXPECT_LT( AbsWin2( 2, 1 ), AbsWin1( 2, 1 ) );
+
+	CFS.deallocate();
+}
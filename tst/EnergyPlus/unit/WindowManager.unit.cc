@@ -0,0 +1,228 @@
+// EnergyPlus::WindowManager Unit Tests
+
+// C++ Headers
+#include <cmath>
+#include <cstdint>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/WindowManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::WindowManager;
+
+namespace {
+
+	// Triple glazing with a low-e coating, air gaps and absorbed solar on the outer two panes
+	void
+	SetupTripleGlazing()
+	{
+		DataHeatBalance::WindowNewtonSolver = true;
+		DataHeatBalance::Zone.allocate( 1 );
+		DataHeatBalance::Zone( 1 ).InsideConvectionAlgo = DataHeatBalance::ASHRAESimple;
+		DataSurfaces::Surface.allocate( 1 );
+		DataSurfaces::Surface( 1 ).Zone = 1;
+		DataSurfaces::Surface( 1 ).Height = 1.5;
+		DataSurfaces::Surface( 1 ).IntConvCoeff = 0;
+		DataSurfaces::SurfaceWindow.allocate( 1 );
+		DataSurfaces::SurfaceWindow( 1 ).EdgeGlCorrFac = 1.1;
+
+		ngllayer = 3;
+		nglface = 6;
+		tilt = 90.0;
+		tout = 263.15;
+		tin = 294.15;
+		hcout = 20.0;
+		hcin = 3.0;
+		Outir = sigma * std::pow( tout, 4 );
+		Rmir = sigma * std::pow( tin, 4 );
+		emis = 0.84;
+		emis( 4 ) = 0.1;
+		AbsRadGlassFace = 0.0;
+		AbsRadGlassFace( 1 ) = 60.0;
+		AbsRadGlassFace( 3 ) = 25.0;
+		for ( int Layer = 1; Layer <= ngllayer; ++Layer ) {
+			scon( Layer ) = 0.9 / 0.003;
+		}
+		for ( int IGap = 1; IGap <= ngllayer - 1; ++IGap ) {
+			gap( IGap ) = 0.0127;
+			gnmix( IGap ) = 1;
+			gfract( IGap, 1 ) = 1.0;
+			gwght( IGap, 1 ) = 28.97;
+			gcon( IGap, 1, 1 ) = 2.873e-3;
+			gcon( IGap, 1, 2 ) = 7.760e-5;
+			gvis( IGap, 1, 1 ) = 3.723e-6;
+			gvis( IGap, 1, 2 ) = 4.940e-8;
+			gcp( IGap, 1, 1 ) = 1002.737;
+			gcp( IGap, 1, 2 ) = 1.2324e-2;
+		}
+		A23P = -emis( 3 ) / ( 1.0 - ( 1.0 - emis( 2 ) ) * ( 1.0 - emis( 3 ) ) );
+		A23 = emis( 2 ) * sigma * A23P;
+		A45P = -emis( 5 ) / ( 1.0 - ( 1.0 - emis( 4 ) ) * ( 1.0 - emis( 5 ) ) );
+		A45 = emis( 4 ) * sigma * A45P;
+		for ( int i = 1; i <= nglface; ++i ) {
+			thetas( i ) = tout + ( tin - tout ) * i / ( nglface + 1 );
+		}
+	}
+
+	// Puts back the solver choice and the window globals set by SetupTripleGlazing
+	void
+	ClearTripleGlazing()
+	{
+		DataHeatBalance::WindowNewtonSolver = false;
+		DataHeatBalance::Zone.deallocate();
+		DataSurfaces::Surface.deallocate();
+		DataSurfaces::SurfaceWindow.deallocate();
+
+		ngllayer = 0;
+		nglface = 0;
+		tilt = 0.0;
+		tout = 0.0;
+		tin = 0.0;
+		hcout = 0.0;
+		hcin = 0.0;
+		Outir = 0.0;
+		Rmir = 0.0;
+		emis = 0.0;
+		AbsRadGlassFace = 0.0;
+		scon = 0.0;
+		gap = 0.0;
+		gnmix = 0;
+		gfract = 0.0;
+		gwght = 0.0;
+		gcon = 0.0;
+		gvis = 0.0;
+		gcp = 0.0;
+		A23P = 0.0;
+		A23 = 0.0;
+		A45P = 0.0;
+		A45 = 0.0;
+		thetas = 0.0;
+		fvec = 0.0;
+		fjac = 0.0;
+	}
+
+}
+
+TEST( WindowManagerTest, WindowHeatBalanceJacobian )
+{
+	SetupTripleGlazing();
+
+	// Analytic Jacobian against central differences of the face heat balances; the gas
+	// properties held fixed in the Jacobian change the derivatives by less than a percent
+	WindowHeatBalanceEquations( 1 );
+	FArray2D< Real64 > const Jacobian( fjac );
+	Real64 const dT( 1.0e-3 );
+	for ( int j = 1; j <= nglface; ++j ) {
+		thetas( j ) += dT;
+		WindowHeatBalanceEquations( 1 );
+		FArray1D< Real64 > const Plus( fvec );
+		thetas( j ) -= 2.0 * dT;
+		WindowHeatBalanceEquations( 1 );
+		thetas( j ) += dT;
+		for ( int i = 1; i <= nglface; ++i ) {
+			Real64 const Numeric( ( Plus( i ) - fvec( i ) ) / ( 2.0 * dT ) );
+			EXPECT_NEAR( Numeric, Jacobian( i, j ), 0.01 * std::abs( Numeric ) + 1.0e-6 );
+		}
+	}
+
+	ClearTripleGlazing();
+}
+
+TEST( WindowManagerTest, SolveForWindowTemperaturesNewton )
+{
+	SetupTripleGlazing();
+
+	int Iterations;
+	bool Converged;
+	SolveForWindowTemperaturesNewton( 1, Iterations, Converged );
+	EXPECT_TRUE( Converged );
+	EXPECT_LE( Iterations, 6 );
+	EXPECT_LE( DataSurfaces::SurfaceWindow( 1 ).WindowCalcResidualRep, 0.01 );
+
+	// Heat lost at the outside face is the heat gained at the inside face plus the absorbed solar
+	Real64 const OutsideLoss( hcout * ( thetas( 1 ) - tout ) + emis( 1 ) * ( sigma * std::pow( thetas( 1 ), 4 ) - Outir ) );
+	Real64 const InsideGain( hcin * ( tin - thetas( 6 ) ) + emis( 6 ) * ( Rmir - sigma * std::pow( thetas( 6 ), 4 ) ) );
+	EXPECT_NEAR( OutsideLoss, InsideGain + 85.0, 0.05 );
+
+	// Warm start from the solution needs a single evaluation
+	SolveForWindowTemperaturesNewton( 1, Iterations, Converged );
+	EXPECT_TRUE( Converged );
+	EXPECT_EQ( 1, Iterations );
+
+	ClearTripleGlazing();
+}
+
+TEST( WindowManagerTest, SystemSpectralPropertiesAtPhi )
+{
+	// Double clear glazing with spectral average properties
+	SpectralAngleWork Work;
+	for ( int IGlass = 1; IGlass <= 2; ++IGlass ) {
+		numpt( IGlass ) = 2;
+		Work.tPhi( 1, IGlass ) = 0.8;
+		Work.rfPhi( 1, IGlass ) = 0.08;
+		Work.rbPhi( 1, IGlass ) = 0.07;
+	}
+	SystemSpectralPropertiesAtPhi( Work, 1, 2, 0.0, 2.54 );
+	Real64 const Denom( 1.0 - 0.08 * 0.07 );
+	for ( int ILam = 1; ILam <= nume; ++ILam ) {
+		EXPECT_NEAR( 0.64 / Denom, Work.stPhi( ILam ), 1.0e-12 );
+		EXPECT_NEAR( 0.08 + 0.64 * 0.08 / Denom, Work.srfPhi( ILam ), 1.0e-12 );
+		EXPECT_NEAR( 1.0, Work.stPhi( ILam ) + Work.srfPhi( ILam ) + Work.saPhi( ILam, 1 ) + Work.saPhi( ILam, 2 ), 1.0e-12 );
+	}
+}
+
+TEST( WindowManagerTest, GlazingOpticsStore )
+{
+	numpt( 1 ) = 2;
+	t( 1, 1 ) = 0.8;
+	t( 2, 1 ) = 0.85;
+	rff( 1, 1 ) = 0.08;
+	rbb( 1, 1 ) = 0.07;
+	wlt( 1, 1 ) = 0.5;
+	std::uint64_t const Key( GlazingOpticsKey( 1, 1, true, false, false, 0.0, 0.0 ) );
+
+	// Wavelengths are not used for spectral average layers; the other data and the side are
+	wlt( 1, 1 ) = 0.6;
+	EXPECT_EQ( Key, GlazingOpticsKey( 1, 1, true, false, false, 0.0, 0.0 ) );
+	EXPECT_NE( Key, GlazingOpticsKey( 2, 1, true, false, false, 0.0, 0.0 ) );
+	EXPECT_NE( Key, GlazingOpticsKey( 1, 1, true, true, false, 0.0, 0.0 ) );
+	t( 1, 1 ) = 0.8 * 0.95; // Dirt correction
+	EXPECT_NE( Key, GlazingOpticsKey( 1, 1, true, false, false, 0.0, 0.0 ) );
+
+	// Properties at each angle are read back in the order they were packed
+	FArray1D< Real64 > TransPhi( 10 );
+	FArray2D< Real64 > AbsPhi( 10, 5, 0.0 );
+	for ( int IPhi = 1; IPhi <= 10; ++IPhi ) {
+		TransPhi( IPhi ) = 0.1 * IPhi;
+		AbsPhi( IPhi, 2 ) = 0.01 * IPhi;
+	}
+	ShadingCache::ShadingRecord Record;
+	NumGlazingOpticsCalculated = 0;
+	NumGlazingOpticsReused = 0;
+	EXPECT_FALSE( FindGlazingOptics( Key, 20, Record ) );
+	PackGlazingOptics( TransPhi, Record );
+	PackGlazingOptics( AbsPhi( {1,10}, 2 ), Record );
+	StoreGlazingOptics( Key, Record );
+	EXPECT_EQ( 1, NumGlazingOpticsCalculated );
+
+	ShadingCache::ShadingRecord Stored;
+	EXPECT_FALSE( FindGlazingOptics( Key, 30, Stored ) ); // Record of another size: calculate again
+	ASSERT_TRUE( FindGlazingOptics( Key, 20, Stored ) );
+	EXPECT_EQ( 1, NumGlazingOpticsReused );
+	FArray1D< Real64 > StoredTransPhi( 10, 0.0 );
+	FArray2D< Real64 > StoredAbsPhi( 10, 5, 0.0 );
+	std::size_t Pos( 0 );
+	UnpackGlazingOptics( Stored, Pos, StoredTransPhi );
+	UnpackGlazingOptics( Stored, Pos, StoredAbsPhi( {1,10}, 2 ) );
+	EXPECT_EQ( Stored.Reals.size(), Pos );
+	for ( int IPhi = 1; IPhi <= 10; ++IPhi ) {
+		EXPECT_EQ( TransPhi( IPhi ), StoredTransPhi( IPhi ) );
+		EXPECT_EQ( AbsPhi( IPhi, 2 ), StoredAbsPhi( IPhi, 2 ) );
+		EXPECT_EQ( 0.0, StoredAbsPhi( IPhi, 1 ) );
+	}
+}
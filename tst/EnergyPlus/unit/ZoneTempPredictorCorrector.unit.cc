@@ -45,8 +45,6 @@ TEST( ZoneTempPredictorCorrector, CorrectZoneHumRatTest )
 	ZoneEquipConfig.allocate( 1 );
 	ZoneEquipConfig( 1 ).ZoneName = "Zone 1";
 	ZoneEquipConfig( 1 ).ActualZoneNum = 1;
-	std::vector< int > controlledZoneEquipConfigNums;
-	controlledZoneEquipConfigNums.push_back( 1 );
 
 	ZoneEquipConfig( 1 ).NumInletNodes = 2;
 	ZoneEquipConfig( 1 ).InletNode.allocate( 2 );
@@ -59,8 +57,10 @@ TEST( ZoneTempPredictorCorrector, CorrectZoneHumRatTest )
 
 	Node.allocate( 5 );
 
+	NumOfZones = 1;
 	Zone.allocate( 1 );
 	Zone( 1 ).Name = ZoneEquipConfig( 1 ).ZoneName;
+	Zone( 1 ).IsControlled = true;
 	ZoneEqSizing.allocate( 1 );
 	CurZoneEqNum = 1;
 	Zone( 1 ).Multiplier = 1.0;
@@ -124,7 +124,7 @@ TEST( ZoneTempPredictorCorrector, CorrectZoneHumRatTest )
 	MixingMassFlowZone( 1 ) = 0.0;
 	MDotOA( 1 ) = 0.0;
 
-	CorrectZoneHumRat( 1, controlledZoneEquipConfigNums );
+	CorrectZoneHumRat( 1 );
 	EXPECT_EQ( 0.008, Node( 5 ).HumRat );
 
 	// Case 2 - Unbalanced exhaust flow
@@ -149,7 +149,7 @@ TEST( ZoneTempPredictorCorrector, CorrectZoneHumRatTest )
 	MixingMassFlowZone( 1 ) = 0.0;
 	MDotOA( 1 ) = 0.0;
 
-	CorrectZoneHumRat( 1, controlledZoneEquipConfigNums );
+	CorrectZoneHumRat( 1 );
 	EXPECT_EQ( 0.008, Node( 5 ).HumRat );
 
 	// Case 3 - Balanced exhaust flow with proper source flow from mixing
@@ -174,7 +174,7 @@ TEST( ZoneTempPredictorCorrector, CorrectZoneHumRatTest )
 	MixingMassFlowZone( 1 ) = 0.02;
 	MDotOA( 1 ) = 0.0;
 
-	CorrectZoneHumRat( 1, controlledZoneEquipConfigNums );
+	CorrectZoneHumRat( 1 );
 	EXPECT_EQ( 0.008, Node( 5 ).HumRat );
 
 	// Case 4 - Balanced exhaust flow without source flow from mixing
@@ -199,7 +199,7 @@ TEST( ZoneTempPredictorCorrector, CorrectZoneHumRatTest )
 	MixingMassFlowZone( 1 ) = 0.0;
 	MDotOA( 1 ) = 0.0;
 
-	CorrectZoneHumRat( 1, controlledZoneEquipConfigNums );
+	CorrectZoneHumRat( 1 );
 	EXPECT_FALSE( (0.008 == Node( 5 ).HumRat) );
 
 	// Deallocate everything
@@ -226,5 +226,43 @@ TEST( ZoneTempPredictorCorrector, CorrectZoneHumRatTest )
 	MDotOA.deallocate( );
 	ZoneAirHumRatTemp.deallocate( );
 	ZoneW1.deallocate( );
+	ZoneTempPredictorCorrector::clear_state();
 
 }
+
+TEST( ZoneTempPredictorCorrector, InitZoneAirSourcesTest )
+{
+	NumOfZones = 3;
+	Zone.deallocate();
+	Zone.allocate( 3 );
+	ZoneEquipConfig.deallocate();
+	ZoneEquipConfig.allocate( 3 );
+	Zone( 1 ).IsControlled = true;
+	ZoneEquipConfig( 1 ).ActualZoneNum = 3;
+	Zone( 3 ).IsControlled = true;
+	ZoneEquipConfig( 3 ).ActualZoneNum = 1;
+	NumZoneReturnPlenums = 0;
+	NumZoneSupplyPlenums = 0;
+
+	InitZoneAirSources();
+	EXPECT_EQ( 3, ZoneEquipConfigNumOfZone( 1 ) );
+	EXPECT_EQ( 0, ZoneEquipConfigNumOfZone( 2 ) );
+	EXPECT_EQ( 1, ZoneEquipConfigNumOfZone( 3 ) );
+	EXPECT_EQ( 0, ZoneRetPlenumNumOfZone( 2 ) );
+
+	// Plenums read after the first call
+	ZoneRetPlenCond.allocate( 1 );
+	ZoneRetPlenCond( 1 ).ActualZoneNum = 2;
+	NumZoneReturnPlenums = 1;
+	InitZoneAirSources();
+	EXPECT_EQ( 1, ZoneRetPlenumNumOfZone( 2 ) );
+	EXPECT_EQ( 0, ZoneSupPlenumNumOfZone( 2 ) );
+	EXPECT_EQ( 3, ZoneEquipConfigNumOfZone( 1 ) );
+
+	NumZoneReturnPlenums = 0;
+	ZoneRetPlenCond.deallocate();
+	ZoneEquipConfig.deallocate();
+	Zone.deallocate();
+	NumOfZones = 0;
+	ZoneTempPredictorCorrector::clear_state();
+}